@@ -17,6 +17,8 @@
 
 HIDE := @
 
+COMMA := ,
+
 LOCAL_PATH := $(realpath $(dir $(lastword $(MAKEFILE_LIST))))
 ifeq (true, $(APP_DEBUG))
 	BIN_DIR := $(LOCAL_PATH)/bin/debug
@@ -42,6 +44,17 @@ endif
 C_FLAGS += -I$(THIRD_PARTY_DIR)/OpenCL-ICD-Loader/include
 C_FLAGS += -I$(THIRD_PARTY_DIR)/TensorFlow-Lite/include
 
+# The ISA specific kernels are selected at runtime
+AVX2_FLAGS := 
+AVX2_FLAGS += -mavx2
+AVX2_FLAGS += -mfma
+AVX2_FLAGS += -mf16c
+
+AVX512_FLAGS := 
+AVX512_FLAGS += -mavx512f
+AVX512_FLAGS += -mavx512bw
+AVX512_FLAGS += -mfma
+
 LD_FLAGS := 
 LD_FLAGS += -pthread
 LD_FLAGS += -Wl,--no-undefined
@@ -56,10 +69,44 @@ endif
 all :  \
 	$(BIN_DIR)/Neural-Texture-Mapping
 
+# Test
+# The tests of the modules which have no caller in the executable (e.g. the tile cache), and thus are NOT covered by the regression.
+test: $(BIN_DIR)/ntm-tile-cache-test
+	$(HIDE) $(BIN_DIR)/ntm-tile-cache-test
+
+# Regression
+# The golden images are decoded by the TFLite interpreter of Python (the "golden-main.py", NOT the executable under test), while the baseline of the throughput is of this machine.
+# The golden images are NOT committed (the TensorFlow of Python is required), and thus the "regression-update-golden" must be run once after the checkout (and after the model changes).
+# e.g. make -f Linux.mk regression REGRESSION_ARGS="--backend=cpu --model=neural-texture-mapping.ntm"
+REGRESSION_GOLDEN_DIR := $(LOCAL_PATH)/../assets/golden
+REGRESSION_RESOLUTIONS := 512x512,1024x1024
+
+REGRESSION_FLAGS := 
+REGRESSION_FLAGS += --target=$(LOCAL_PATH)/../assets/target.png
+REGRESSION_FLAGS += --golden=$(REGRESSION_GOLDEN_DIR)
+REGRESSION_FLAGS += --baseline=$(BIN_DIR)/regression-baseline.txt
+REGRESSION_FLAGS += --resolution=$(REGRESSION_RESOLUTIONS)
+REGRESSION_FLAGS += --threads=1,0
+REGRESSION_FLAGS += --layout=linear,morton
+
+regression: $(BIN_DIR)/Neural-Texture-Mapping
+	$(HIDE) for resolution in $(subst $(COMMA), ,$(REGRESSION_RESOLUTIONS)); do if test ! -f $(REGRESSION_GOLDEN_DIR)/$${resolution}.png; then echo "The golden image is missing: $(REGRESSION_GOLDEN_DIR)/$${resolution}.png (make -f Linux.mk regression-update-golden)" >&2; exit 1; fi; done
+	$(HIDE) $(BIN_DIR)/Neural-Texture-Mapping --regression $(REGRESSION_FLAGS) $(REGRESSION_ARGS)
+
+regression-update-golden:
+	$(HIDE) python3 $(SOURCE_DIR)/golden-main.py $(REGRESSION_GOLDEN_DIR) $(REGRESSION_RESOLUTIONS) $(GOLDEN_TFLITE)
+
+regression-update-baseline: $(BIN_DIR)/Neural-Texture-Mapping
+	$(HIDE) $(BIN_DIR)/Neural-Texture-Mapping --regression --update-baseline $(REGRESSION_FLAGS) $(REGRESSION_ARGS)
+
 # Link
-$(BIN_DIR)/Neural-Texture-Mapping: $(OBJ_DIR)/Neural-Texture-Mapping-inference-main.o $(BIN_DIR)/libOpenCL.so $(BIN_DIR)/libtensorflowlite_c.so
+$(BIN_DIR)/Neural-Texture-Mapping: $(OBJ_DIR)/Neural-Texture-Mapping-inference-main.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-pack.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-options.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-predictor.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-benchmark.o $(OBJ_DIR)/Neural-Texture-Mapping-image-writer.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-scheduler.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-baker.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-inference.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-scalar.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx2.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx512.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-shm-presenter.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-frame-pipeline.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-autotune.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-layout.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-file.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-embedded-model.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-model-reloader.o $(OBJ_DIR)/Neural-Texture-Mapping-image-reader.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-regression.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-sparsity.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-encoder.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-scalar.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx2.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx512.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-decode-daemon.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-client.o $(BIN_DIR)/libOpenCL.so $(BIN_DIR)/libtensorflowlite_c.so
+	$(HIDE) mkdir -p $(BIN_DIR)
+	$(HIDE) clang++ -pie $(LD_FLAGS) $(OBJ_DIR)/Neural-Texture-Mapping-inference-main.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-pack.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-options.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-predictor.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-benchmark.o $(OBJ_DIR)/Neural-Texture-Mapping-image-writer.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-scheduler.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-baker.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-inference.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-scalar.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx2.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx512.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-shm-presenter.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-frame-pipeline.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-autotune.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-layout.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-file.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-embedded-model.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-model-reloader.o $(OBJ_DIR)/Neural-Texture-Mapping-image-reader.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-regression.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-sparsity.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-encoder.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-scalar.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx2.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx512.o $(OBJ_DIR)/Neural-Texture-Mapping-inference-decode-daemon.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-client.o -L$(BIN_DIR) -lOpenCL -ltensorflowlite_c -lxcb -lxcb-present -lxcb-shm -o $(BIN_DIR)/Neural-Texture-Mapping
+
+$(BIN_DIR)/ntm-tile-cache-test: $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache-test.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.o
 	$(HIDE) mkdir -p $(BIN_DIR)
-	$(HIDE) clang++ -pie $(LD_FLAGS) $(OBJ_DIR)/Neural-Texture-Mapping-inference-main.o -L$(BIN_DIR) -lOpenCL -ltensorflowlite_c -lxcb -lxcb-present -o $(BIN_DIR)/Neural-Texture-Mapping
+	$(HIDE) clang++ -pie $(LD_FLAGS) $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache-test.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.o -o $(BIN_DIR)/ntm-tile-cache-test
 
 $(BIN_DIR)/libOpenCL.so: $(OBJ_DIR)/OpenCL-ICD-Loader-icd_linux_envvars.o $(OBJ_DIR)/OpenCL-ICD-Loader-icd_linux.o $(OBJ_DIR)/OpenCL-ICD-Loader-icd_dispatch_generated.o $(OBJ_DIR)/OpenCL-ICD-Loader-icd_dispatch.o $(OBJ_DIR)/OpenCL-ICD-Loader-icd.o
 	$(HIDE) mkdir -p $(BIN_DIR)
@@ -70,6 +117,150 @@ $(OBJ_DIR)/Neural-Texture-Mapping-inference-main.o: $(SOURCE_DIR)/inference-main
 	$(HIDE) mkdir -p $(OBJ_DIR)
 	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-main.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-main.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-main.o
 
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.o: $(SOURCE_DIR)/ntm-model.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-model.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.o: $(SOURCE_DIR)/ntm-cpu-inference.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-cpu-inference.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.o: $(SOURCE_DIR)/ntm-cpu-kernels-scalar.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-cpu-kernels-scalar.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.o: $(SOURCE_DIR)/ntm-cpu-kernels-avx2.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(AVX2_FLAGS) $(SOURCE_DIR)/ntm-cpu-kernels-avx2.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.o: $(SOURCE_DIR)/ntm-cpu-kernels-avx512.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(AVX512_FLAGS) $(SOURCE_DIR)/ntm-cpu-kernels-avx512.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-pack.o: $(SOURCE_DIR)/ntm-pack.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-pack.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-pack.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-pack.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-options.o: $(SOURCE_DIR)/inference-options.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-options.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-options.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-options.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-predictor.o: $(SOURCE_DIR)/inference-predictor.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-predictor.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-predictor.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-predictor.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-benchmark.o: $(SOURCE_DIR)/inference-benchmark.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-benchmark.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-benchmark.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-benchmark.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-image-writer.o: $(SOURCE_DIR)/image-writer.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/image-writer.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-image-writer.d -o $(OBJ_DIR)/Neural-Texture-Mapping-image-writer.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.o: $(SOURCE_DIR)/ntm-thread-pool.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-thread-pool.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.o: $(SOURCE_DIR)/ntm-tile-cache.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-tile-cache.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-scheduler.o: $(SOURCE_DIR)/ntm-decode-scheduler.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-decode-scheduler.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-scheduler.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-scheduler.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-baker.o: $(SOURCE_DIR)/inference-baker.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-baker.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-baker.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-baker.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-inference.o: $(SOURCE_DIR)/ntm-aot-inference.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-aot-inference.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-inference.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-inference.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-scalar.o: $(SOURCE_DIR)/ntm-aot-kernels-scalar.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-aot-kernels-scalar.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-scalar.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-scalar.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx2.o: $(SOURCE_DIR)/ntm-aot-kernels-avx2.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(AVX2_FLAGS) $(SOURCE_DIR)/ntm-aot-kernels-avx2.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx2.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx2.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx512.o: $(SOURCE_DIR)/ntm-aot-kernels-avx512.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(AVX512_FLAGS) $(SOURCE_DIR)/ntm-aot-kernels-avx512.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx512.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx512.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-shm-presenter.o: $(SOURCE_DIR)/inference-shm-presenter.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-shm-presenter.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-shm-presenter.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-shm-presenter.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-frame-pipeline.o: $(SOURCE_DIR)/inference-frame-pipeline.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-frame-pipeline.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-frame-pipeline.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-frame-pipeline.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.o: $(SOURCE_DIR)/ntm-profiler.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-profiler.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-autotune.o: $(SOURCE_DIR)/inference-autotune.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-autotune.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-autotune.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-autotune.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-layout.o: $(SOURCE_DIR)/ntm-layout.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-layout.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-layout.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-layout.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-file.o: $(SOURCE_DIR)/ntm-file.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-file.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-file.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-file.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-embedded-model.o: $(SOURCE_DIR)/inference-embedded-model.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-embedded-model.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-embedded-model.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-embedded-model.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-model-reloader.o: $(SOURCE_DIR)/inference-model-reloader.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-model-reloader.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-model-reloader.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-model-reloader.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-image-reader.o: $(SOURCE_DIR)/image-reader.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/image-reader.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-image-reader.d -o $(OBJ_DIR)/Neural-Texture-Mapping-image-reader.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-regression.o: $(SOURCE_DIR)/inference-regression.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-regression.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-regression.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-regression.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-sparsity.o: $(SOURCE_DIR)/inference-sparsity.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-sparsity.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-sparsity.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-sparsity.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-encoder.o: $(SOURCE_DIR)/ntm-bc-encoder.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-bc-encoder.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-encoder.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-encoder.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-scalar.o: $(SOURCE_DIR)/ntm-bc-kernels-scalar.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-bc-kernels-scalar.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-scalar.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-scalar.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx2.o: $(SOURCE_DIR)/ntm-bc-kernels-avx2.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(AVX2_FLAGS) $(SOURCE_DIR)/ntm-bc-kernels-avx2.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx2.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx2.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx512.o: $(SOURCE_DIR)/ntm-bc-kernels-avx512.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(AVX512_FLAGS) $(SOURCE_DIR)/ntm-bc-kernels-avx512.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx512.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx512.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-inference-decode-daemon.o: $(SOURCE_DIR)/inference-decode-daemon.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/inference-decode-daemon.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-inference-decode-daemon.d -o $(OBJ_DIR)/Neural-Texture-Mapping-inference-decode-daemon.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-client.o: $(SOURCE_DIR)/ntm-decode-client.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-decode-client.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-client.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-client.o
+
+$(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache-test.o: $(SOURCE_DIR)/ntm-tile-cache-test.cpp
+	$(HIDE) mkdir -p $(OBJ_DIR)
+	$(HIDE) clang++ -c $(C_FLAGS) $(SOURCE_DIR)/ntm-tile-cache-test.cpp -MD -MF $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache-test.d -o $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache-test.o
+
 $(OBJ_DIR)/OpenCL-ICD-Loader-icd_linux_envvars.o: $(THIRD_PARTY_DIR)/OpenCL-ICD-Loader/src/linux/icd_linux_envvars.c
 	$(HIDE) mkdir -p $(OBJ_DIR)
 	$(HIDE) clang++ -c $(C_FLAGS) $(THIRD_PARTY_DIR)/OpenCL-ICD-Loader/src/linux/icd_linux_envvars.c -MD -MF $(OBJ_DIR)/OpenCL-ICD-Loader-icd_linux_envvars.d -o $(OBJ_DIR)/OpenCL-ICD-Loader-icd_linux_envvars.o
@@ -92,6 +283,42 @@ $(OBJ_DIR)/OpenCL-ICD-Loader-icd.o: $(THIRD_PARTY_DIR)/OpenCL-ICD-Loader/src/icd
 
 -include \
 	$(OBJ_DIR)/Neural-Texture-Mapping-inference-main.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-pack.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-options.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-predictor.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-benchmark.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-image-writer.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-scheduler.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-baker.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-inference.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-scalar.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx2.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx512.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-shm-presenter.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-frame-pipeline.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-autotune.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-layout.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-file.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-embedded-model.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-model-reloader.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-image-reader.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-regression.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-sparsity.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-encoder.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-scalar.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx2.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx512.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-inference-decode-daemon.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-client.d \
+	$(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache-test.d \
 	$(OBJ_DIR)/OpenCL-ICD-Loader-icd_linux_envvars.d \
 	$(OBJ_DIR)/OpenCL-ICD-Loader-icd_linux.d \
 	$(OBJ_DIR)/OpenCL-ICD-Loader-icd_dispatch_generated.d \
@@ -105,9 +332,82 @@ $(BIN_DIR)/libtensorflowlite_c.so: $(THIRD_PARTY_DIR)/TensorFlow-Lite/lib/libten
 
 clean:
 	$(HIDE) rm -f $(BIN_DIR)/Neural-Texture-Mapping
+	$(HIDE) rm -f $(BIN_DIR)/ntm-tile-cache-test
 	$(HIDE) rm -f $(BIN_DIR)/libOpenCL.so
 	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-main.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-pack.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-options.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-predictor.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-benchmark.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-image-writer.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-scheduler.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-baker.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-inference.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-scalar.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx2.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx512.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-shm-presenter.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-frame-pipeline.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-autotune.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-layout.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-file.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-embedded-model.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-model-reloader.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-image-reader.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-regression.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-sparsity.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-encoder.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-scalar.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx2.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx512.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-decode-daemon.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-client.o
 	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-main.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-model.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-inference.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-scalar.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx2.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-cpu-kernels-avx512.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-pack.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-options.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-predictor.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-benchmark.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-image-writer.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-thread-pool.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-scheduler.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-baker.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-inference.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-scalar.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx2.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-aot-kernels-avx512.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-shm-presenter.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-frame-pipeline.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-profiler.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-autotune.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-layout.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-file.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-embedded-model.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-model-reloader.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-image-reader.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-regression.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-sparsity.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-encoder.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-scalar.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx2.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-bc-kernels-avx512.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-inference-decode-daemon.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-decode-client.d
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache-test.o
+	$(HIDE) rm -f $(OBJ_DIR)/Neural-Texture-Mapping-ntm-tile-cache-test.d
 	$(HIDE) rm -f $(OBJ_DIR)/OpenCL-ICD-Loader-icd_linux_envvars.o
 	$(HIDE) rm -f $(OBJ_DIR)/OpenCL-ICD-Loader-icd_linux.o
 	$(HIDE) rm -f $(OBJ_DIR)/OpenCL-ICD-Loader-icd_dispatch_generated.o
@@ -122,4 +422,8 @@ clean:
 
 .PHONY : \
 	all \
+	test \
+	regression \
+	regression-update-golden \
+	regression-update-baseline \
 	clean
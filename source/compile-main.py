@@ -0,0 +1,147 @@
+import os
+import sys
+import struct
+
+# The number of the outputs of each panel, namely, the number of the accumulators (one SIMD vector of NTM_CPU_BATCH_SIZE lanes for each output) which are kept in the registers.
+PANEL_WIDTH = 8
+
+# Usage: python compile-main.py [<input NTM asset> [<output AOT header>]]
+# The input is the (FP32) NTM asset output by the convert-main.py, and the output is included by the "ntm-aot-kernels-*.cpp".
+# Since the shapes (frequencies, layers and widths) and the coefficients are constants of the generated code, there is no shape dispatch at runtime.
+if len(sys.argv) > 3:
+    print("Usage: python compile-main.py [<input NTM asset> [<output AOT header>]]")
+    sys.exit(1)
+
+input_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)), "neural-texture-mapping.ntm")
+output_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(os.path.dirname(os.path.abspath(__file__)), "neural-texture-mapping-aot.inl")
+
+
+def float_literal(value):
+    # 9 significant digits round trip the float32 exactly
+    return "%.9eF" % value
+
+
+def emit_array(name, values):
+    lines = ["alignas(64) static float const %s[%d] = {" % (name, len(values))]
+    for value_index in range(0, len(values), 8):
+        lines.append("    " + ", ".join(float_literal(value) for value in values[value_index:value_index + 8]) + ",")
+    lines.append("};")
+    return lines
+
+
+def fnv1a(hash, data):
+    for byte in data:
+        hash = ((hash ^ byte) * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return hash
+
+
+def emit_layer(layer_index, input_size, output_size, relu):
+    lines = []
+    lines.append("static inline void ntm_aot_layer_%d(float const *in_activations, float *out_activations)" % layer_index)
+    lines.append("{")
+    for panel_begin in range(0, output_size, PANEL_WIDTH):
+        panel_width = min(PANEL_WIDTH, output_size - panel_begin)
+        lines.append("    // outputs [%d, %d)" % (panel_begin, panel_begin + panel_width))
+        lines.append("    {")
+        for output_subindex in range(panel_width):
+            lines.append("        ntm_aot_vector accumulator_%d = ntm_aot_set1(ntm_aot_layer_%d_biases[%d]);" % (output_subindex, layer_index, panel_begin + output_subindex))
+        lines.append("")
+        lines.append("        float const *const panel_weights = ntm_aot_layer_%d_weights + %dU;" % (layer_index, panel_begin * input_size))
+        lines.append("        for (uint32_t input_index = 0U; input_index < %dU; ++input_index)" % input_size)
+        lines.append("        {")
+        lines.append("            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);")
+        for output_subindex in range(panel_width):
+            lines.append("            accumulator_%d = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[%dU * input_index + %dU]), accumulator_%d);" % (output_subindex, panel_width, output_subindex, output_subindex))
+        lines.append("        }")
+        lines.append("")
+        for output_subindex in range(panel_width):
+            value = ("ntm_aot_relu(accumulator_%d)" if relu else "accumulator_%d") % output_subindex
+            lines.append("        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * %dU, %s);" % (panel_begin + output_subindex, value))
+        lines.append("    }")
+    lines.append("}")
+    return lines
+
+
+# Data
+file_ntm_binary = open(input_path, 'rb')
+ntm_data = file_ntm_binary.read()
+file_ntm_binary.close()
+
+fourcc, num_frequencies, num_layers = struct.unpack_from('<4sII', ntm_data, 0)
+# the quantized NTM asset is NOT supported, since the FP32 is the fastest on the CPU (except the INT8 with the VNNI)
+assert fourcc == b'NTM '
+
+layers = []
+offset = 12
+input_size = 4 * num_frequencies
+for layer_index in range(num_layers):
+    num_coefficients, = struct.unpack_from('<I', ntm_data, offset)
+    offset += 4
+    assert num_coefficients % (input_size + 1) == 0
+    output_size = num_coefficients // (input_size + 1)
+    coefficients = struct.unpack_from('<%df' % num_coefficients, ntm_data, offset)
+    offset += 4 * num_coefficients
+
+    layers.append((input_size, output_size, coefficients[:input_size * output_size], coefficients[input_size * output_size:]))
+    input_size = output_size
+assert input_size == 3
+
+# Code Generation
+# the panels of the weights of each layer
+panel_layers = []
+for layer_index, (input_size, output_size, weights, biases) in enumerate(layers):
+    # [number of outputs / PANEL_WIDTH][number of inputs][PANEL_WIDTH] (the last panel may be narrower)
+    panel_weights = []
+    for panel_begin in range(0, output_size, PANEL_WIDTH):
+        panel_width = min(PANEL_WIDTH, output_size - panel_begin)
+        for input_index in range(input_size):
+            for output_subindex in range(panel_width):
+                panel_weights.append(weights[input_index * output_size + panel_begin + output_subindex])
+    panel_layers.append((input_size, output_size, panel_weights, biases))
+
+# FNV-1a of the shapes, the coefficient types (FP32) and the coefficients (in the order of the NTM asset), which is the same as the "ntm_model_hash" of the NTM asset (e.g. the autotune merely offers the AOT engine when the NTM asset is the same network)
+network_hash = fnv1a(0xCBF29CE484222325, struct.pack('<II', num_frequencies, num_layers))
+for input_size, output_size, weights, biases in layers:
+    network_hash = fnv1a(network_hash, struct.pack('<III', input_size, output_size, 0))
+    network_hash = fnv1a(network_hash, struct.pack('<%df' % len(weights), *weights))
+    network_hash = fnv1a(network_hash, struct.pack('<%df' % len(biases), *biases))
+
+lines = []
+lines.append("// Generated by the \"compile-main.py\". Do NOT edit.")
+lines.append("// %d frequencies, %s" % (num_frequencies, " -> ".join(["%d" % layers[0][0]] + ["%d" % layer[1] for layer in layers])))
+lines.append("")
+lines.append("static constexpr uint32_t const NTM_AOT_NUM_FREQUENCIES = %dU;" % num_frequencies)
+lines.append("")
+lines.append("static constexpr uint32_t const NTM_AOT_NUM_LAYERS = %dU;" % num_layers)
+lines.append("")
+lines.append("// the maximum of the widths of all layers (including the positional encoding)")
+lines.append("static constexpr uint32_t const NTM_AOT_MAX_LAYER_WIDTH = %dU;" % max([layers[0][0]] + [layer[1] for layer in layers]))
+lines.append("")
+lines.append("// the same as the \"ntm_model_hash\" of the NTM asset")
+lines.append("static constexpr uint64_t const NTM_AOT_NETWORK_HASH = 0X%016XULL;" % network_hash)
+
+for layer_index, (input_size, output_size, panel_weights, biases) in enumerate(panel_layers):
+    lines.append("")
+    lines.append("// %d x %d (%s)" % (input_size, output_size, "linear" if layer_index == (num_layers - 1) else "relu"))
+    lines.extend(emit_array("ntm_aot_layer_%d_weights" % layer_index, panel_weights))
+    lines.append("")
+    lines.extend(emit_array("ntm_aot_layer_%d_biases" % layer_index, biases))
+    lines.append("")
+    lines.extend(emit_layer(layer_index, input_size, output_size, layer_index != (num_layers - 1)))
+
+lines.append("")
+lines.append("// [4 * NTM_AOT_NUM_FREQUENCIES][NTM_CPU_BATCH_SIZE] -> [3][NTM_CPU_BATCH_SIZE]")
+lines.append("static inline void ntm_aot_network(float const *in_features, float *out_RGBs)")
+lines.append("{")
+lines.append("    alignas(64) float activations[2][NTM_AOT_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];")
+lines.append("")
+for layer_index in range(num_layers):
+    in_activations = "in_features" if layer_index == 0 else "activations[%d]" % ((layer_index - 1) % 2)
+    out_activations = "out_RGBs" if layer_index == (num_layers - 1) else "activations[%d]" % (layer_index % 2)
+    lines.append("    ntm_aot_layer_%d(%s, %s);" % (layer_index, in_activations, out_activations))
+lines.append("}")
+
+# Serialization
+file_aot_text = open(output_path, 'w')
+file_aot_text.write("\n".join(lines) + "\n")
+file_aot_text.close()
@@ -1,4 +1,5 @@
 import os
+import struct
 import numpy
 import tensorflow
 from PositionalEncoding import PositionalEncodingLayer
@@ -44,4 +45,19 @@ file_tflite_model_binary.close()
 
 file_tflite_model_text = open(os.path.join(os.path.dirname(os.path.abspath(__file__)), "neural-texture-mapping.inl"), 'w')
 file_tflite_model_text.write(', '.join([f"0X{ubyte:02X}" for ubyte in tflite_model]))
-file_tflite_model_text.close()
\ No newline at end of file
+file_tflite_model_text.close()
+
+# Neutral Texture Mapping Asset Format
+positional_encoding_layer = [keras_layer for keras_layer in keras_model.layers if isinstance(keras_layer, PositionalEncodingLayer)][0]
+texture_mapping_layers = [keras_layer for keras_layer in keras_model.layers if isinstance(keras_layer, tensorflow.keras.layers.Dense)]
+
+file_ntm_binary = open(os.path.join(os.path.dirname(os.path.abspath(__file__)), "neural-texture-mapping.ntm"), 'wb')
+file_ntm_binary.write(struct.pack('<4sII', b'NTM ', positional_encoding_layer.num_frequencies, len(texture_mapping_layers)))
+for texture_mapping_layer in texture_mapping_layers:
+    # weights: [number of inputs][number of outputs]
+    # biases: [number of outputs]
+    texture_mapping_weights, texture_mapping_biases = texture_mapping_layer.get_weights()
+    texture_mapping_coefficients = numpy.concatenate([texture_mapping_weights.reshape(-1), texture_mapping_biases.reshape(-1)]).astype('<f4')
+    file_ntm_binary.write(struct.pack('<I', texture_mapping_coefficients.size))
+    file_ntm_binary.write(texture_mapping_coefficients.tobytes())
+file_ntm_binary.close()
\ No newline at end of file
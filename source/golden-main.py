@@ -0,0 +1,57 @@
+import os
+import sys
+import numpy
+import tensorflow.lite
+import matplotlib.pyplot
+
+# Usage: python golden-main.py <output directory> <resolutions, e.g. 512x512,1024x1024> [<TFLite model>]
+# The golden images of the "--regression" ("WxH.png") are decoded by the TFLite interpreter of Python (the same as the "inference-main.py"), rather than by the executable under test.
+# By default, the model is the one embedded into the executable ("neural-texture-mapping.inl", written by the "convert-main.py").
+if (len(sys.argv) < 3) or (len(sys.argv) > 4):
+    print("Usage: python golden-main.py <output directory> <resolutions, e.g. 512x512,1024x1024> [<TFLite model>]")
+    sys.exit(1)
+
+output_directory = sys.argv[1]
+resolutions = [tuple(int(size) for size in resolution.split('x')) for resolution in sys.argv[2].split(',')]
+
+# Model
+if len(sys.argv) > 3:
+    tflite_interpreter = tensorflow.lite.Interpreter(model_path=sys.argv[3])
+else:
+    file_tflite_model_text = open(os.path.join(os.path.dirname(os.path.abspath(__file__)), "neural-texture-mapping.inl"), 'r')
+    tflite_model = bytes(int(ubyte, 16) for ubyte in file_tflite_model_text.read().split(','))
+    file_tflite_model_text.close()
+    tflite_interpreter = tensorflow.lite.Interpreter(model_content=tflite_model)
+
+tflite_input_index = tflite_interpreter.get_input_details()[0]["index"]
+tflite_ouput_index = tflite_interpreter.get_output_details()[0]["index"]
+
+os.makedirs(output_directory, exist_ok=True)
+
+for texture_width, texture_height in resolutions:
+    # Data
+    # the texel centers are the same float32 as the "generate_UVs" of the executable
+    input_Us = (numpy.arange(texture_width, dtype=numpy.float32) + numpy.float32(0.5)) / numpy.float32(texture_width)
+    input_Vs = (numpy.arange(texture_height, dtype=numpy.float32) + numpy.float32(0.5)) / numpy.float32(texture_height)
+    input_UVs_u, input_UVs_v = numpy.meshgrid(input_Us, input_Vs)
+    input_UVs = numpy.stack([input_UVs_u, input_UVs_v], axis=-1).reshape(-1, 2)
+    del input_Us
+    del input_Vs
+    del input_UVs_u
+    del input_UVs_v
+
+    assert input_UVs.shape == (texture_width * texture_height, 2)
+
+    # Inference
+    tflite_interpreter.resize_tensor_input(tflite_input_index, [texture_width * texture_height, 2])
+    tflite_interpreter.allocate_tensors()
+    tflite_interpreter.set_tensor(tflite_input_index, input_UVs)
+    tflite_interpreter.invoke()
+    prediction_RGBs = numpy.clip(tflite_interpreter.get_tensor(tflite_ouput_index), 0.0, 1.0).reshape(texture_height, texture_width, 3)
+
+    # Serialization
+    # clamped and rounded to the nearest, which is the same as the output stage of the executable
+    bit_RGBs = numpy.floor(prediction_RGBs * 255.0 + 0.5).astype(numpy.uint8)
+    golden_path = os.path.join(output_directory, "%dx%d.png" % (texture_width, texture_height))
+    matplotlib.pyplot.imsave(golden_path, bit_RGBs)
+    print("Golden: %s" % golden_path)
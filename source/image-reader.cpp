@@ -0,0 +1,600 @@
+#include "image-reader.h"
+#include "ntm-file.h"
+#include <string.h>
+#include <stdio.h>
+#include <assert.h>
+#include <new>
+#include <vector>
+
+// https://www.w3.org/TR/png/
+// https://www.rfc-editor.org/rfc/rfc1950
+// https://www.rfc-editor.org/rfc/rfc1951
+static constexpr uint32_t const DEFLATE_MAX_CODE_LENGTH = 15U;
+
+static constexpr uint32_t const DEFLATE_NUM_LITERAL_LENGTH_CODES = 288U;
+
+static constexpr uint32_t const DEFLATE_NUM_DISTANCE_CODES = 32U;
+
+// the width (or the height) is also the "int" dimension of the predictor
+static constexpr uint32_t const PNG_MAX_DIMENSION = 1U << 16U;
+
+struct image_reader
+{
+    uint32_t width;
+    uint32_t height;
+    std::vector<uint8_t[4]> bit_RGBs;
+};
+
+// canonical Huffman code: the number of the codes of each length, and the symbols ordered by the codes
+struct deflate_huffman
+{
+    uint16_t counts[DEFLATE_MAX_CODE_LENGTH + 1U];
+    uint16_t symbols[DEFLATE_NUM_LITERAL_LENGTH_CODES];
+};
+
+struct deflate_stream
+{
+    uint8_t const *in_data;
+    size_t in_size;
+    size_t in_position;
+    uint32_t bit_buffer;
+    uint32_t num_bits;
+    bool failed;
+    std::vector<uint8_t> *out_data;
+};
+
+static inline uint32_t png_load_uint32(uint8_t const *bytes);
+
+static inline bool png_inflate(uint8_t const *zlib_data, size_t zlib_size, std::vector<uint8_t> &out_data);
+
+static inline bool png_unfilter(uint8_t *data, uint32_t row_size, uint32_t height, uint32_t bytes_per_pixel);
+
+static inline uint8_t png_paeth(uint8_t a, uint8_t b, uint8_t c);
+
+static inline uint32_t deflate_bits(deflate_stream *stream, uint32_t num_bits);
+
+static inline bool deflate_build_huffman(deflate_huffman *huffman, uint8_t const *code_lengths, uint32_t num_symbols);
+
+static inline uint32_t deflate_decode_symbol(deflate_stream *stream, deflate_huffman const *huffman);
+
+static inline bool deflate_inflate_codes(deflate_stream *stream, deflate_huffman const *literal_length_huffman, deflate_huffman const *distance_huffman);
+
+extern image_reader *image_reader_open_png(char const *path)
+{
+    std::vector<uint8_t> file_data;
+    if (!ntm_read_file(path, file_data))
+    {
+        return NULL;
+    }
+
+    static uint8_t const png_signature[8] = {0X89U, 'P', 'N', 'G', '\r', '\n', 0X1AU, '\n'};
+    if ((file_data.size() < sizeof(png_signature)) || (0 != memcmp(&file_data[0], png_signature, sizeof(png_signature))))
+    {
+        return NULL;
+    }
+
+    uint32_t width = 0U;
+    uint32_t height = 0U;
+    uint8_t color_type = 0U;
+    bool header_found = false;
+    uint8_t palette[256][4] = {};
+    std::vector<uint8_t> zlib_data;
+    {
+        // NOTE: the CRC of the chunks is NOT verified
+        size_t position = sizeof(png_signature);
+        bool end_found = false;
+        while ((!end_found) && ((file_data.size() - position) >= 12U))
+        {
+            uint32_t const chunk_size = png_load_uint32(&file_data[position]);
+            uint8_t const *const chunk_type = &file_data[position + 4U];
+            if (chunk_size > (file_data.size() - position - 12U))
+            {
+                return NULL;
+            }
+            uint8_t const *const chunk_data = &file_data[position + 8U];
+
+            if (0 == memcmp(chunk_type, "IHDR", 4U))
+            {
+                if (13U != chunk_size)
+                {
+                    return NULL;
+                }
+
+                width = png_load_uint32(chunk_data);
+                height = png_load_uint32(chunk_data + 4U);
+                uint8_t const bit_depth = chunk_data[8];
+                color_type = chunk_data[9];
+                uint8_t const compression_method = chunk_data[10];
+                uint8_t const filter_method = chunk_data[11];
+                uint8_t const interlace_method = chunk_data[12];
+
+                // merely the 8 bits per channel (without the Adam7) is supported
+                if ((0U == width) || (width > PNG_MAX_DIMENSION) || (0U == height) || (height > PNG_MAX_DIMENSION) || (8U != bit_depth) || (!((0U == color_type) || (2U == color_type) || (3U == color_type) || (4U == color_type) || (6U == color_type))) || (0U != compression_method) || (0U != filter_method) || (0U != interlace_method))
+                {
+                    return NULL;
+                }
+
+                header_found = true;
+            }
+            else if (0 == memcmp(chunk_type, "PLTE", 4U))
+            {
+                if ((0U != (chunk_size % 3U)) || (chunk_size > (3U * 256U)))
+                {
+                    return NULL;
+                }
+
+                for (uint32_t palette_index = 0U; palette_index < (chunk_size / 3U); ++palette_index)
+                {
+                    palette[palette_index][0] = chunk_data[3U * palette_index + 2U];
+                    palette[palette_index][1] = chunk_data[3U * palette_index + 1U];
+                    palette[palette_index][2] = chunk_data[3U * palette_index];
+                    palette[palette_index][3] = 255U;
+                }
+            }
+            else if (0 == memcmp(chunk_type, "IDAT", 4U))
+            {
+                zlib_data.insert(zlib_data.end(), chunk_data, chunk_data + chunk_size);
+            }
+            else if (0 == memcmp(chunk_type, "IEND", 4U))
+            {
+                end_found = true;
+            }
+
+            position += 12U + chunk_size;
+        }
+
+        if ((!header_found) || (!end_found) || zlib_data.empty())
+        {
+            return NULL;
+        }
+    }
+
+    uint32_t const num_channels = (0U == color_type) ? 1U : ((2U == color_type) ? 3U : ((3U == color_type) ? 1U : ((4U == color_type) ? 2U : 4U)));
+    uint32_t const row_size = num_channels * width;
+
+    std::vector<uint8_t> filtered_data;
+    if ((!png_inflate(&zlib_data[0], zlib_data.size(), filtered_data)) || (filtered_data.size() != ((static_cast<size_t>(row_size) + 1U) * height)) || (!png_unfilter(&filtered_data[0], row_size, height, num_channels)))
+    {
+        return NULL;
+    }
+
+    image_reader *reader = new (std::nothrow) image_reader{};
+    if (NULL == reader)
+    {
+        return NULL;
+    }
+
+    reader->width = width;
+    reader->height = height;
+    reader->bit_RGBs = std::vector<uint8_t[4]>(static_cast<size_t>(width) * static_cast<size_t>(height));
+
+    for (uint32_t h = 0U; h < height; ++h)
+    {
+        // the filter type (1 byte) is followed by the row
+        uint8_t const *const row = &filtered_data[(static_cast<size_t>(row_size) + 1U) * h + 1U];
+        for (uint32_t w = 0U; w < width; ++w)
+        {
+            uint8_t *const bit_RGB = reader->bit_RGBs[static_cast<size_t>(width) * h + w];
+            uint8_t const *const pixel = row + num_channels * w;
+            switch (color_type)
+            {
+            case 0U:
+            case 4U:
+            {
+                bit_RGB[0] = pixel[0];
+                bit_RGB[1] = pixel[0];
+                bit_RGB[2] = pixel[0];
+                bit_RGB[3] = (4U == color_type) ? pixel[1] : 255U;
+            }
+            break;
+            case 3U:
+            {
+                memcpy(bit_RGB, palette[pixel[0]], sizeof(uint8_t[4]));
+            }
+            break;
+            default:
+            {
+                assert((2U == color_type) || (6U == color_type));
+                bit_RGB[0] = pixel[2];
+                bit_RGB[1] = pixel[1];
+                bit_RGB[2] = pixel[0];
+                bit_RGB[3] = (6U == color_type) ? pixel[3] : 255U;
+            }
+            }
+        }
+    }
+
+    return reader;
+}
+
+extern void image_reader_close(image_reader *reader)
+{
+    delete reader;
+}
+
+extern uint32_t image_reader_get_width(image_reader const *reader)
+{
+    return reader->width;
+}
+
+extern uint32_t image_reader_get_height(image_reader const *reader)
+{
+    return reader->height;
+}
+
+extern uint8_t const (*image_reader_get_bit_RGBs(image_reader const *reader))[4]
+{
+    return &reader->bit_RGBs[0];
+}
+
+static inline uint32_t png_load_uint32(uint8_t const *bytes)
+{
+    // big-endian
+    return (static_cast<uint32_t>(bytes[0]) << 24U) | (static_cast<uint32_t>(bytes[1]) << 16U) | (static_cast<uint32_t>(bytes[2]) << 8U) | static_cast<uint32_t>(bytes[3]);
+}
+
+static inline bool png_inflate(uint8_t const *zlib_data, size_t zlib_size, std::vector<uint8_t> &out_data)
+{
+    // CMF (deflate with the window of at most 32KB) + FLG (without the preset dictionary)
+    if ((zlib_size < 2U) || (8U != (zlib_data[0] & 0XFU)) || ((zlib_data[0] >> 4U) > 7U) || (0U != (((static_cast<uint32_t>(zlib_data[0]) << 8U) | zlib_data[1]) % 31U)) || (0U != (zlib_data[1] & 0X20U)))
+    {
+        return false;
+    }
+
+    // NOTE: the Adler-32 is NOT verified
+    deflate_stream stream;
+    stream.in_data = zlib_data + 2U;
+    stream.in_size = zlib_size - 2U;
+    stream.in_position = 0U;
+    stream.bit_buffer = 0U;
+    stream.num_bits = 0U;
+    stream.failed = false;
+    stream.out_data = &out_data;
+
+    bool final_block = false;
+    while ((!final_block) && (!stream.failed))
+    {
+        final_block = (0U != deflate_bits(&stream, 1U));
+        uint32_t const block_type = deflate_bits(&stream, 2U);
+
+        if (0U == block_type)
+        {
+            // stored: the remaining bits of the current byte are discarded
+            stream.bit_buffer = 0U;
+            stream.num_bits = 0U;
+
+            if ((stream.in_size - stream.in_position) < 4U)
+            {
+                return false;
+            }
+
+            uint32_t const length = static_cast<uint32_t>(stream.in_data[stream.in_position]) | (static_cast<uint32_t>(stream.in_data[stream.in_position + 1U]) << 8U);
+            uint32_t const length_complement = static_cast<uint32_t>(stream.in_data[stream.in_position + 2U]) | (static_cast<uint32_t>(stream.in_data[stream.in_position + 3U]) << 8U);
+            stream.in_position += 4U;
+
+            if ((length != ((~length_complement) & 0XFFFFU)) || ((stream.in_size - stream.in_position) < length))
+            {
+                return false;
+            }
+
+            out_data.insert(out_data.end(), stream.in_data + stream.in_position, stream.in_data + stream.in_position + length);
+            stream.in_position += length;
+        }
+        else if (1U == block_type)
+        {
+            // fixed Huffman codes
+            static deflate_huffman fixed_literal_length_huffman;
+            static deflate_huffman fixed_distance_huffman;
+            static bool const fixed_huffman_built = []() -> bool
+            {
+                uint8_t code_lengths[DEFLATE_NUM_LITERAL_LENGTH_CODES];
+                for (uint32_t symbol = 0U; symbol < DEFLATE_NUM_LITERAL_LENGTH_CODES; ++symbol)
+                {
+                    code_lengths[symbol] = (symbol < 144U) ? 8U : ((symbol < 256U) ? 9U : ((symbol < 280U) ? 7U : 8U));
+                }
+                bool const result_literal_length = deflate_build_huffman(&fixed_literal_length_huffman, code_lengths, DEFLATE_NUM_LITERAL_LENGTH_CODES);
+
+                memset(code_lengths, 5, DEFLATE_NUM_DISTANCE_CODES);
+                bool const result_distance = deflate_build_huffman(&fixed_distance_huffman, code_lengths, DEFLATE_NUM_DISTANCE_CODES);
+
+                return result_literal_length && result_distance;
+            }();
+            assert(fixed_huffman_built);
+            (void)fixed_huffman_built;
+
+            if (!deflate_inflate_codes(&stream, &fixed_literal_length_huffman, &fixed_distance_huffman))
+            {
+                return false;
+            }
+        }
+        else if (2U == block_type)
+        {
+            // dynamic Huffman codes
+            uint32_t const num_literal_length_codes = deflate_bits(&stream, 5U) + 257U;
+            uint32_t const num_distance_codes = deflate_bits(&stream, 5U) + 1U;
+            uint32_t const num_code_length_codes = deflate_bits(&stream, 4U) + 4U;
+            if ((num_literal_length_codes > 286U) || (num_distance_codes > 30U))
+            {
+                return false;
+            }
+
+            static uint8_t const code_length_order[19] = {16U, 17U, 18U, 0U, 8U, 7U, 9U, 6U, 10U, 5U, 11U, 4U, 12U, 3U, 13U, 2U, 14U, 1U, 15U};
+
+            uint8_t code_length_code_lengths[19] = {};
+            for (uint32_t code_index = 0U; code_index < num_code_length_codes; ++code_index)
+            {
+                code_length_code_lengths[code_length_order[code_index]] = static_cast<uint8_t>(deflate_bits(&stream, 3U));
+            }
+
+            deflate_huffman code_length_huffman;
+            if (!deflate_build_huffman(&code_length_huffman, code_length_code_lengths, 19U))
+            {
+                return false;
+            }
+
+            // the literal/length and the distance code lengths are one sequence (the repeat may cross the boundary)
+            uint8_t code_lengths[DEFLATE_NUM_LITERAL_LENGTH_CODES + DEFLATE_NUM_DISTANCE_CODES];
+            uint32_t num_code_lengths = 0U;
+            while ((num_code_lengths < (num_literal_length_codes + num_distance_codes)) && (!stream.failed))
+            {
+                uint32_t const symbol = deflate_decode_symbol(&stream, &code_length_huffman);
+                if (symbol < 16U)
+                {
+                    code_lengths[num_code_lengths] = static_cast<uint8_t>(symbol);
+                    ++num_code_lengths;
+                }
+                else
+                {
+                    uint8_t repeat_length;
+                    uint32_t repeat_count;
+                    if (16U == symbol)
+                    {
+                        if (0U == num_code_lengths)
+                        {
+                            return false;
+                        }
+                        repeat_length = code_lengths[num_code_lengths - 1U];
+                        repeat_count = 3U + deflate_bits(&stream, 2U);
+                    }
+                    else if (17U == symbol)
+                    {
+                        repeat_length = 0U;
+                        repeat_count = 3U + deflate_bits(&stream, 3U);
+                    }
+                    else if (18U == symbol)
+                    {
+                        repeat_length = 0U;
+                        repeat_count = 11U + deflate_bits(&stream, 7U);
+                    }
+                    else
+                    {
+                        return false;
+                    }
+
+                    if ((num_code_lengths + repeat_count) > (num_literal_length_codes + num_distance_codes))
+                    {
+                        return false;
+                    }
+
+                    memset(code_lengths + num_code_lengths, repeat_length, repeat_count);
+                    num_code_lengths += repeat_count;
+                }
+            }
+
+            // the end-of-block code is required
+            if (stream.failed || (0U == code_lengths[256]))
+            {
+                return false;
+            }
+
+            deflate_huffman literal_length_huffman;
+            deflate_huffman distance_huffman;
+            if ((!deflate_build_huffman(&literal_length_huffman, code_lengths, num_literal_length_codes)) || (!deflate_build_huffman(&distance_huffman, code_lengths + num_literal_length_codes, num_distance_codes)))
+            {
+                return false;
+            }
+
+            if (!deflate_inflate_codes(&stream, &literal_length_huffman, &distance_huffman))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return (!stream.failed);
+}
+
+static inline bool png_unfilter(uint8_t *data, uint32_t row_size, uint32_t height, uint32_t bytes_per_pixel)
+{
+    uint8_t const *previous_row = NULL;
+    for (uint32_t h = 0U; h < height; ++h)
+    {
+        uint8_t const filter_type = data[(static_cast<size_t>(row_size) + 1U) * h];
+        uint8_t *const row = data + (static_cast<size_t>(row_size) + 1U) * h + 1U;
+
+        for (uint32_t byte_index = 0U; byte_index < row_size; ++byte_index)
+        {
+            // the bytes outside the image are zero
+            uint8_t const a = (byte_index >= bytes_per_pixel) ? row[byte_index - bytes_per_pixel] : 0U;
+            uint8_t const b = (NULL != previous_row) ? previous_row[byte_index] : 0U;
+            uint8_t const c = ((NULL != previous_row) && (byte_index >= bytes_per_pixel)) ? previous_row[byte_index - bytes_per_pixel] : 0U;
+
+            switch (filter_type)
+            {
+            case 0U:
+                break;
+            case 1U:
+                row[byte_index] = static_cast<uint8_t>(row[byte_index] + a);
+                break;
+            case 2U:
+                row[byte_index] = static_cast<uint8_t>(row[byte_index] + b);
+                break;
+            case 3U:
+                row[byte_index] = static_cast<uint8_t>(row[byte_index] + ((static_cast<uint32_t>(a) + static_cast<uint32_t>(b)) >> 1U));
+                break;
+            case 4U:
+                row[byte_index] = static_cast<uint8_t>(row[byte_index] + png_paeth(a, b, c));
+                break;
+            default:
+                return false;
+            }
+        }
+
+        previous_row = row;
+    }
+
+    return true;
+}
+
+static inline uint8_t png_paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int const p = static_cast<int>(a) + static_cast<int>(b) - static_cast<int>(c);
+    int const pa = (p > a) ? (p - a) : (a - p);
+    int const pb = (p > b) ? (p - b) : (b - p);
+    int const pc = (p > c) ? (p - c) : (c - p);
+    return ((pa <= pb) && (pa <= pc)) ? a : ((pb <= pc) ? b : c);
+}
+
+static inline uint32_t deflate_bits(deflate_stream *stream, uint32_t num_bits)
+{
+    assert(num_bits <= 16U);
+
+    // the bits are packed starting with the least significant bit
+    while (stream->num_bits < num_bits)
+    {
+        if (stream->in_position >= stream->in_size)
+        {
+            stream->failed = true;
+            return 0U;
+        }
+
+        stream->bit_buffer |= static_cast<uint32_t>(stream->in_data[stream->in_position]) << stream->num_bits;
+        ++stream->in_position;
+        stream->num_bits += 8U;
+    }
+
+    uint32_t const value = stream->bit_buffer & ((1U << num_bits) - 1U);
+    stream->bit_buffer >>= num_bits;
+    stream->num_bits -= num_bits;
+    return value;
+}
+
+static inline bool deflate_build_huffman(deflate_huffman *huffman, uint8_t const *code_lengths, uint32_t num_symbols)
+{
+    assert(num_symbols <= DEFLATE_NUM_LITERAL_LENGTH_CODES);
+
+    memset(huffman->counts, 0, sizeof(huffman->counts));
+    for (uint32_t symbol = 0U; symbol < num_symbols; ++symbol)
+    {
+        ++huffman->counts[code_lengths[symbol]];
+    }
+
+    // the over-subscribed code is invalid (the incomplete code is allowed, e.g. one distance code)
+    int remaining_codes = 1;
+    for (uint32_t code_length = 1U; code_length <= DEFLATE_MAX_CODE_LENGTH; ++code_length)
+    {
+        remaining_codes = (remaining_codes << 1) - static_cast<int>(huffman->counts[code_length]);
+        if (remaining_codes < 0)
+        {
+            return false;
+        }
+    }
+
+    uint16_t offsets[DEFLATE_MAX_CODE_LENGTH + 1U];
+    offsets[1] = 0U;
+    for (uint32_t code_length = 1U; code_length < DEFLATE_MAX_CODE_LENGTH; ++code_length)
+    {
+        offsets[code_length + 1U] = static_cast<uint16_t>(offsets[code_length] + huffman->counts[code_length]);
+    }
+
+    for (uint32_t symbol = 0U; symbol < num_symbols; ++symbol)
+    {
+        if (0U != code_lengths[symbol])
+        {
+            huffman->symbols[offsets[code_lengths[symbol]]] = static_cast<uint16_t>(symbol);
+            ++offsets[code_lengths[symbol]];
+        }
+    }
+
+    return true;
+}
+
+static inline uint32_t deflate_decode_symbol(deflate_stream *stream, deflate_huffman const *huffman)
+{
+    // the codes are packed starting with the most significant bit, and thus the code is read bit by bit
+    int code = 0;
+    int first = 0;
+    int index = 0;
+    for (uint32_t code_length = 1U; code_length <= DEFLATE_MAX_CODE_LENGTH; ++code_length)
+    {
+        code |= static_cast<int>(deflate_bits(stream, 1U));
+        int const count = huffman->counts[code_length];
+        if ((code - first) < count)
+        {
+            return huffman->symbols[index + (code - first)];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    stream->failed = true;
+    return 0U;
+}
+
+static inline bool deflate_inflate_codes(deflate_stream *stream, deflate_huffman const *literal_length_huffman, deflate_huffman const *distance_huffman)
+{
+    static uint16_t const length_bases[29] = {3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 13U, 15U, 17U, 19U, 23U, 27U, 31U, 35U, 43U, 51U, 59U, 67U, 83U, 99U, 115U, 131U, 163U, 195U, 227U, 258U};
+    static uint8_t const length_extra_bits[29] = {0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 1U, 1U, 1U, 1U, 2U, 2U, 2U, 2U, 3U, 3U, 3U, 3U, 4U, 4U, 4U, 4U, 5U, 5U, 5U, 5U, 0U};
+    static uint16_t const distance_bases[30] = {1U, 2U, 3U, 4U, 5U, 7U, 9U, 13U, 17U, 25U, 33U, 49U, 65U, 97U, 129U, 193U, 257U, 385U, 513U, 769U, 1025U, 1537U, 2049U, 3073U, 4097U, 6145U, 8193U, 12289U, 16385U, 24577U};
+    static uint8_t const distance_extra_bits[30] = {0U, 0U, 0U, 0U, 1U, 1U, 2U, 2U, 3U, 3U, 4U, 4U, 5U, 5U, 6U, 6U, 7U, 7U, 8U, 8U, 9U, 9U, 10U, 10U, 11U, 11U, 12U, 12U, 13U, 13U};
+
+    std::vector<uint8_t> &out_data = (*stream->out_data);
+
+    while (!stream->failed)
+    {
+        uint32_t const symbol = deflate_decode_symbol(stream, literal_length_huffman);
+        if (symbol < 256U)
+        {
+            out_data.push_back(static_cast<uint8_t>(symbol));
+        }
+        else if (256U == symbol)
+        {
+            return (!stream->failed);
+        }
+        else
+        {
+            uint32_t const length_index = symbol - 257U;
+            if (length_index >= 29U)
+            {
+                return false;
+            }
+            uint32_t const length = length_bases[length_index] + deflate_bits(stream, length_extra_bits[length_index]);
+
+            uint32_t const distance_index = deflate_decode_symbol(stream, distance_huffman);
+            if (distance_index >= 30U)
+            {
+                return false;
+            }
+            uint32_t const distance = distance_bases[distance_index] + deflate_bits(stream, distance_extra_bits[distance_index]);
+
+            if (stream->failed || (distance > out_data.size()))
+            {
+                return false;
+            }
+
+            // the source may overlap the destination (e.g. the run-length)
+            size_t const source_position = out_data.size() - distance;
+            for (uint32_t byte_index = 0U; byte_index < length; ++byte_index)
+            {
+                out_data.push_back(out_data[source_position + byte_index]);
+            }
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,22 @@
+#ifndef _IMAGE_READER_H_
+#define _IMAGE_READER_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct image_reader;
+
+// The whole PNG (8 bits per channel, grayscale, RGB, palette or with alpha, NOT interlaced) is decoded when opened, e.g. the "assets/target.png" or the images written by the "image_writer".
+// NULL: the file can NOT be read, or the PNG is invalid (or NOT supported)
+extern image_reader *image_reader_open_png(char const *path);
+
+extern void image_reader_close(image_reader *reader);
+
+extern uint32_t image_reader_get_width(image_reader const *reader);
+
+extern uint32_t image_reader_get_height(image_reader const *reader);
+
+// The pixels are B8G8R8A8 (rows from top to bottom) which is the same as the "bit_RGBs".
+extern uint8_t const (*image_reader_get_bit_RGBs(image_reader const *reader))[4];
+
+#endif
@@ -0,0 +1,519 @@
+#include "image-writer.h"
+#include "ntm-file.h"
+#include <string.h>
+#include <stdio.h>
+#include <assert.h>
+#include <new>
+#include <vector>
+
+// https://www.w3.org/TR/png/
+// https://www.rfc-editor.org/rfc/rfc1950
+// https://www.rfc-editor.org/rfc/rfc1951
+static constexpr uint32_t const DEFLATE_MAX_STORED_BLOCK_SIZE = 65535U;
+
+// The "IDAT" chunk is flushed when the buffer exceeds this size.
+static constexpr size_t const PNG_CHUNK_FLUSH_SIZE = 1U << 20U;
+
+// https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+// https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html
+static constexpr uint32_t const KTX2_VK_FORMAT_R8G8B8A8_SRGB = 43U;
+static constexpr uint32_t const KTX2_VK_FORMAT_BC1_RGB_SRGB_BLOCK = 132U;
+static constexpr uint32_t const KTX2_VK_FORMAT_BC7_SRGB_BLOCK = 146U;
+
+// KHR_DF_MODEL_BC1A / KHR_DF_MODEL_BC7
+static constexpr uint8_t const KTX2_DF_MODEL_BC1A = 128U;
+static constexpr uint8_t const KTX2_DF_MODEL_BC7 = 134U;
+
+// identifier (12) + header (36) + index (32) + level index (24 * 1)
+static constexpr uint32_t const KTX2_DFD_OFFSET = 12U + 36U + 32U + 24U;
+
+// dfdTotalSize (4) + basic descriptor block (24 + 16 * 4 samples)
+static constexpr uint32_t const KTX2_DFD_SIZE = 4U + 24U + 16U * 4U;
+
+// dfdTotalSize (4) + basic descriptor block (24 + 16 * 1 sample): the whole block is one sample
+static constexpr uint32_t const KTX2_BLOCK_DFD_SIZE = 4U + 24U + 16U;
+
+// aligned to lcm(texel block size, 4) = 4
+static constexpr uint32_t const KTX2_LEVEL_OFFSET = KTX2_DFD_OFFSET + KTX2_DFD_SIZE;
+
+// aligned to lcm(texel block size, 4) = 16 (which is also a multiple of 8)
+static constexpr uint32_t const KTX2_BLOCK_LEVEL_OFFSET = (KTX2_DFD_OFFSET + KTX2_BLOCK_DFD_SIZE + 15U) & (~15U);
+
+struct image_writer
+{
+    FILE *file;
+    image_format format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t num_written_rows;
+    bool failed;
+
+    // PNG
+    uint32_t crc32_table[256];
+    uint64_t zlib_raw_size;
+    uint64_t zlib_raw_offset;
+    uint32_t adler32;
+    std::vector<uint8_t> chunk_data;
+
+    // the converted rows of the RAW / KTX2
+    std::vector<uint8_t> row_data;
+
+    // KTX2 BC1 / BC7: the size of one 4x4 block (0: NOT block-compressed)
+    uint32_t block_size;
+};
+
+static inline void png_write_chunk(image_writer *writer, char const type[4], uint8_t const *data, size_t size);
+
+static inline void png_append_zlib_raw(image_writer *writer, uint8_t const *data, size_t size);
+
+static inline void png_flush_idat(image_writer *writer);
+
+static inline void png_store_uint32(uint8_t *destination, uint32_t value);
+
+static inline void ktx2_write_header(image_writer *writer);
+
+static inline void ktx2_write_block_header(image_writer *writer);
+
+static inline void ktx2_store_uint16(uint8_t *destination, uint16_t value);
+
+static inline void ktx2_store_uint32(uint8_t *destination, uint32_t value);
+
+static inline void ktx2_store_uint64(uint8_t *destination, uint64_t value);
+
+extern image_writer *image_writer_open(char const *path, image_format format, uint32_t width, uint32_t height)
+{
+    assert((IMAGE_FORMAT_PNG == format) || (IMAGE_FORMAT_RAW == format) || (IMAGE_FORMAT_KTX2 == format) || (IMAGE_FORMAT_KTX2_BC1 == format) || (IMAGE_FORMAT_KTX2_BC7 == format));
+
+    if ((width < 1U) || (height < 1U))
+    {
+        return NULL;
+    }
+
+    FILE *file = ntm_fopen_utf8(path, "wb");
+    if (NULL == file)
+    {
+        return NULL;
+    }
+
+    image_writer *writer = new (std::nothrow) image_writer;
+    if (NULL == writer)
+    {
+        fclose(file);
+        return NULL;
+    }
+
+    writer->file = file;
+    writer->format = format;
+    writer->width = width;
+    writer->height = height;
+    writer->num_written_rows = 0U;
+    writer->failed = false;
+    writer->block_size = (IMAGE_FORMAT_KTX2_BC1 == format) ? 8U : ((IMAGE_FORMAT_KTX2_BC7 == format) ? 16U : 0U);
+
+    if (IMAGE_FORMAT_PNG != format)
+    {
+        if (IMAGE_FORMAT_KTX2 == format)
+        {
+            ktx2_write_header(writer);
+        }
+        else if (0U != writer->block_size)
+        {
+            ktx2_write_block_header(writer);
+        }
+
+        return writer;
+    }
+
+    for (uint32_t table_index = 0U; table_index < 256U; ++table_index)
+    {
+        uint32_t crc = table_index;
+        for (int bit_index = 0; bit_index < 8; ++bit_index)
+        {
+            crc = (0U != (crc & 1U)) ? (0XEDB88320U ^ (crc >> 1U)) : (crc >> 1U);
+        }
+        writer->crc32_table[table_index] = crc;
+    }
+
+    // filter type (1 byte) + RGB8 for each row
+    writer->zlib_raw_size = static_cast<uint64_t>(height) * (1U + 3U * static_cast<uint64_t>(width));
+    writer->zlib_raw_offset = 0U;
+    writer->adler32 = 1U;
+
+    static uint8_t const png_signature[8] = {0X89, 'P', 'N', 'G', '\r', '\n', 0X1A, '\n'};
+    writer->failed = writer->failed || (sizeof(png_signature) != fwrite(png_signature, 1U, sizeof(png_signature), file));
+
+    uint8_t ihdr[13];
+    png_store_uint32(ihdr, width);
+    png_store_uint32(ihdr + 4, height);
+    // bit depth
+    ihdr[8] = 8U;
+    // color type: truecolor
+    ihdr[9] = 2U;
+    // compression method
+    ihdr[10] = 0U;
+    // filter method
+    ihdr[11] = 0U;
+    // interlace method
+    ihdr[12] = 0U;
+    png_write_chunk(writer, "IHDR", ihdr, sizeof(ihdr));
+
+    // CMF: deflate with 32K window
+    // FLG: no preset dictionary, fastest compression, and (CMF * 256 + FLG) is a multiple of 31
+    writer->chunk_data.push_back(0X78U);
+    writer->chunk_data.push_back(0X01U);
+
+    return writer;
+}
+
+extern bool image_writer_write_rows(image_writer *writer, uint32_t num_rows, uint8_t const (*bit_RGBs)[4])
+{
+    // the blocks are written by the "image_writer_write_block_rows"
+    assert(0U == writer->block_size);
+
+    if ((writer->num_written_rows > writer->height) || (num_rows > (writer->height - writer->num_written_rows)))
+    {
+        writer->failed = true;
+        return false;
+    }
+
+    if (IMAGE_FORMAT_PNG != writer->format)
+    {
+        // R8G8B8A8
+        writer->row_data.resize(4U * static_cast<size_t>(writer->width));
+        for (uint32_t row_index = 0U; row_index < num_rows; ++row_index)
+        {
+            for (uint32_t w = 0U; w < writer->width; ++w)
+            {
+                uint8_t const *const bit_RGB = bit_RGBs[static_cast<size_t>(writer->width) * row_index + w];
+                writer->row_data[4U * w] = bit_RGB[2];
+                writer->row_data[4U * w + 1U] = bit_RGB[1];
+                writer->row_data[4U * w + 2U] = bit_RGB[0];
+                writer->row_data[4U * w + 3U] = bit_RGB[3];
+            }
+
+            writer->failed = writer->failed || (writer->row_data.size() != fwrite(&writer->row_data[0], 1U, writer->row_data.size(), writer->file));
+        }
+
+        writer->num_written_rows += num_rows;
+
+        return !writer->failed;
+    }
+
+    std::vector<uint8_t> row(1U + 3U * static_cast<size_t>(writer->width));
+    for (uint32_t row_index = 0U; row_index < num_rows; ++row_index)
+    {
+        // filter type: none
+        row[0] = 0U;
+        for (uint32_t w = 0U; w < writer->width; ++w)
+        {
+            uint8_t const *const bit_RGB = bit_RGBs[static_cast<size_t>(writer->width) * row_index + w];
+            row[1U + 3U * w] = bit_RGB[2];
+            row[1U + 3U * w + 1U] = bit_RGB[1];
+            row[1U + 3U * w + 2U] = bit_RGB[0];
+        }
+
+        png_append_zlib_raw(writer, &row[0], row.size());
+
+        if (writer->chunk_data.size() >= PNG_CHUNK_FLUSH_SIZE)
+        {
+            png_flush_idat(writer);
+        }
+    }
+
+    writer->num_written_rows += num_rows;
+
+    return !writer->failed;
+}
+
+extern bool image_writer_write_block_rows(image_writer *writer, uint32_t num_block_rows, void const *blocks)
+{
+    assert(0U != writer->block_size);
+
+    uint32_t const num_remaining_block_rows = (writer->num_written_rows < writer->height) ? ((writer->height - writer->num_written_rows + 3U) / 4U) : 0U;
+    if (num_block_rows > num_remaining_block_rows)
+    {
+        writer->failed = true;
+        return false;
+    }
+
+    size_t const size = static_cast<size_t>(writer->block_size) * ((writer->width + 3U) / 4U) * num_block_rows;
+    writer->failed = writer->failed || ((size > 0U) && (size != fwrite(blocks, 1U, size, writer->file)));
+
+    // the last row of the blocks may cover less than 4 rows
+    uint32_t const num_rows = 4U * num_block_rows;
+    writer->num_written_rows = (num_rows < (writer->height - writer->num_written_rows)) ? (writer->num_written_rows + num_rows) : writer->height;
+
+    return !writer->failed;
+}
+
+extern bool image_writer_close(image_writer *writer)
+{
+    bool const complete = (writer->height == writer->num_written_rows);
+
+    if (complete && (IMAGE_FORMAT_PNG == writer->format))
+    {
+        assert(writer->zlib_raw_size == writer->zlib_raw_offset);
+
+        // ADLER32 (big-endian)
+        uint8_t adler32[4];
+        png_store_uint32(adler32, writer->adler32);
+        writer->chunk_data.insert(writer->chunk_data.end(), adler32, adler32 + 4);
+        png_flush_idat(writer);
+
+        png_write_chunk(writer, "IEND", NULL, 0U);
+    }
+
+    bool const result = complete && (!writer->failed) && (0 == fclose(writer->file));
+
+    delete writer;
+
+    return result;
+}
+
+static inline void png_write_chunk(image_writer *writer, char const type[4], uint8_t const *data, size_t size)
+{
+    assert(size <= 0X7FFFFFFFU);
+
+    uint8_t length[4];
+    png_store_uint32(length, static_cast<uint32_t>(size));
+
+    // the CRC covers the type and the data
+    uint32_t crc = 0XFFFFFFFFU;
+    for (int type_index = 0; type_index < 4; ++type_index)
+    {
+        crc = writer->crc32_table[(crc ^ static_cast<uint8_t>(type[type_index])) & 0XFFU] ^ (crc >> 8U);
+    }
+    for (size_t data_index = 0U; data_index < size; ++data_index)
+    {
+        crc = writer->crc32_table[(crc ^ data[data_index]) & 0XFFU] ^ (crc >> 8U);
+    }
+
+    uint8_t crc32[4];
+    png_store_uint32(crc32, crc ^ 0XFFFFFFFFU);
+
+    writer->failed = writer->failed || (4U != fwrite(length, 1U, 4U, writer->file));
+    writer->failed = writer->failed || (4U != fwrite(type, 1U, 4U, writer->file));
+    writer->failed = writer->failed || ((size > 0U) && (size != fwrite(data, 1U, size, writer->file)));
+    writer->failed = writer->failed || (4U != fwrite(crc32, 1U, 4U, writer->file));
+}
+
+static inline void png_append_zlib_raw(image_writer *writer, uint8_t const *data, size_t size)
+{
+    // ADLER32
+    {
+        uint32_t s1 = writer->adler32 & 0XFFFFU;
+        uint32_t s2 = (writer->adler32 >> 16U) & 0XFFFFU;
+        for (size_t data_index = 0U; data_index < size; ++data_index)
+        {
+            s1 = (s1 + data[data_index]) % 65521U;
+            s2 = (s2 + s1) % 65521U;
+        }
+        writer->adler32 = (s2 << 16U) | s1;
+    }
+
+    // Since the total size is known in advance, the stored blocks are always split at the multiples of 65535 bytes, and the last block is marked as final.
+    size_t data_offset = 0U;
+    while (data_offset < size)
+    {
+        uint64_t const block_offset = writer->zlib_raw_offset % DEFLATE_MAX_STORED_BLOCK_SIZE;
+        if (0U == block_offset)
+        {
+            uint64_t const remaining_size = writer->zlib_raw_size - writer->zlib_raw_offset;
+            uint32_t const block_size = (remaining_size < DEFLATE_MAX_STORED_BLOCK_SIZE) ? static_cast<uint32_t>(remaining_size) : DEFLATE_MAX_STORED_BLOCK_SIZE;
+            bool const final_block = (remaining_size <= DEFLATE_MAX_STORED_BLOCK_SIZE);
+
+            // BFINAL (1 bit) BTYPE = 00 (2 bits) LEN NLEN
+            writer->chunk_data.push_back(final_block ? 1U : 0U);
+            writer->chunk_data.push_back(static_cast<uint8_t>(block_size & 0XFFU));
+            writer->chunk_data.push_back(static_cast<uint8_t>((block_size >> 8U) & 0XFFU));
+            writer->chunk_data.push_back(static_cast<uint8_t>((~block_size) & 0XFFU));
+            writer->chunk_data.push_back(static_cast<uint8_t>(((~block_size) >> 8U) & 0XFFU));
+        }
+
+        uint64_t const block_remaining_size = DEFLATE_MAX_STORED_BLOCK_SIZE - block_offset;
+        size_t const copy_size = ((size - data_offset) < block_remaining_size) ? (size - data_offset) : static_cast<size_t>(block_remaining_size);
+
+        writer->chunk_data.insert(writer->chunk_data.end(), data + data_offset, data + data_offset + copy_size);
+
+        data_offset += copy_size;
+        writer->zlib_raw_offset += copy_size;
+    }
+}
+
+static inline void png_flush_idat(image_writer *writer)
+{
+    if (!writer->chunk_data.empty())
+    {
+        png_write_chunk(writer, "IDAT", &writer->chunk_data[0], writer->chunk_data.size());
+        writer->chunk_data.clear();
+    }
+}
+
+static inline void png_store_uint32(uint8_t *destination, uint32_t value)
+{
+    destination[0] = static_cast<uint8_t>((value >> 24U) & 0XFFU);
+    destination[1] = static_cast<uint8_t>((value >> 16U) & 0XFFU);
+    destination[2] = static_cast<uint8_t>((value >> 8U) & 0XFFU);
+    destination[3] = static_cast<uint8_t>(value & 0XFFU);
+}
+
+static inline void ktx2_write_header(image_writer *writer)
+{
+    uint8_t header[KTX2_LEVEL_OFFSET] = {};
+
+    static uint8_t const ktx2_identifier[12] = {0XAB, 'K', 'T', 'X', ' ', '2', '0', 0XBB, '\r', '\n', 0X1A, '\n'};
+    memcpy(header, ktx2_identifier, sizeof(ktx2_identifier));
+
+    // The values of the NTM are trained from the (sRGB) PNG
+    ktx2_store_uint32(header + 12U, KTX2_VK_FORMAT_R8G8B8A8_SRGB);
+    // typeSize
+    ktx2_store_uint32(header + 16U, 1U);
+    ktx2_store_uint32(header + 20U, writer->width);
+    ktx2_store_uint32(header + 24U, writer->height);
+    // pixelDepth / layerCount (0: NOT array)
+    ktx2_store_uint32(header + 28U, 0U);
+    ktx2_store_uint32(header + 32U, 0U);
+    // faceCount / levelCount
+    ktx2_store_uint32(header + 36U, 1U);
+    ktx2_store_uint32(header + 40U, 1U);
+    // supercompressionScheme: none
+    ktx2_store_uint32(header + 44U, 0U);
+
+    // index: DFD, KVD (none), SGD (none)
+    ktx2_store_uint32(header + 48U, KTX2_DFD_OFFSET);
+    ktx2_store_uint32(header + 52U, KTX2_DFD_SIZE);
+    ktx2_store_uint32(header + 56U, 0U);
+    ktx2_store_uint32(header + 60U, 0U);
+    ktx2_store_uint64(header + 64U, 0U);
+    ktx2_store_uint64(header + 72U, 0U);
+
+    // level index: byteOffset, byteLength, uncompressedByteLength
+    uint64_t const level_size = 4U * static_cast<uint64_t>(writer->width) * writer->height;
+    ktx2_store_uint64(header + 80U, KTX2_LEVEL_OFFSET);
+    ktx2_store_uint64(header + 88U, level_size);
+    ktx2_store_uint64(header + 96U, level_size);
+
+    // DFD
+    uint8_t *const dfd = header + KTX2_DFD_OFFSET;
+    ktx2_store_uint32(dfd, KTX2_DFD_SIZE);
+    // vendorId (17 bits) = KHRONOS, descriptorType (15 bits) = BASICFORMAT
+    ktx2_store_uint32(dfd + 4U, 0U);
+    // versionNumber = 1.3, descriptorBlockSize
+    ktx2_store_uint16(dfd + 8U, 2U);
+    ktx2_store_uint16(dfd + 10U, static_cast<uint16_t>(KTX2_DFD_SIZE - 4U));
+    // colorModel = RGBSDA, colorPrimaries = BT709, transferFunction = SRGB, flags = ALPHA_STRAIGHT
+    dfd[12] = 1U;
+    dfd[13] = 1U;
+    dfd[14] = 2U;
+    dfd[15] = 0U;
+    // texelBlockDimension (0: 1x1x1x1) is zero
+    // bytesPlane0
+    dfd[20] = 4U;
+
+    // samples: R G B A (the alpha is linear)
+    static uint8_t const channel_types[4] = {0U, 1U, 2U, 15U | 0X10U};
+    for (uint32_t sample_index = 0U; sample_index < 4U; ++sample_index)
+    {
+        uint8_t *const sample = dfd + 28U + 16U * sample_index;
+        // bitOffset, bitLength - 1, channelType
+        ktx2_store_uint16(sample, static_cast<uint16_t>(8U * sample_index));
+        sample[2] = 7U;
+        sample[3] = channel_types[sample_index];
+        // samplePosition is zero
+        // sampleLower, sampleUpper
+        ktx2_store_uint32(sample + 8U, 0U);
+        ktx2_store_uint32(sample + 12U, 255U);
+    }
+
+    writer->failed = writer->failed || (sizeof(header) != fwrite(header, 1U, sizeof(header), writer->file));
+}
+
+static inline void ktx2_write_block_header(image_writer *writer)
+{
+    uint8_t header[KTX2_BLOCK_LEVEL_OFFSET] = {};
+
+    static uint8_t const ktx2_identifier[12] = {0XAB, 'K', 'T', 'X', ' ', '2', '0', 0XBB, '\r', '\n', 0X1A, '\n'};
+    memcpy(header, ktx2_identifier, sizeof(ktx2_identifier));
+
+    bool const bc7 = (IMAGE_FORMAT_KTX2_BC7 == writer->format);
+
+    ktx2_store_uint32(header + 12U, bc7 ? KTX2_VK_FORMAT_BC7_SRGB_BLOCK : KTX2_VK_FORMAT_BC1_RGB_SRGB_BLOCK);
+    // typeSize (1 for the block-compressed formats)
+    ktx2_store_uint32(header + 16U, 1U);
+    ktx2_store_uint32(header + 20U, writer->width);
+    ktx2_store_uint32(header + 24U, writer->height);
+    // pixelDepth / layerCount (0: NOT array)
+    ktx2_store_uint32(header + 28U, 0U);
+    ktx2_store_uint32(header + 32U, 0U);
+    // faceCount / levelCount
+    ktx2_store_uint32(header + 36U, 1U);
+    ktx2_store_uint32(header + 40U, 1U);
+    // supercompressionScheme: none
+    ktx2_store_uint32(header + 44U, 0U);
+
+    // index: DFD, KVD (none), SGD (none)
+    ktx2_store_uint32(header + 48U, KTX2_DFD_OFFSET);
+    ktx2_store_uint32(header + 52U, KTX2_BLOCK_DFD_SIZE);
+    ktx2_store_uint32(header + 56U, 0U);
+    ktx2_store_uint32(header + 60U, 0U);
+    ktx2_store_uint64(header + 64U, 0U);
+    ktx2_store_uint64(header + 72U, 0U);
+
+    // level index: byteOffset, byteLength, uncompressedByteLength
+    uint64_t const level_size = static_cast<uint64_t>(writer->block_size) * ((writer->width + 3U) / 4U) * ((writer->height + 3U) / 4U);
+    ktx2_store_uint64(header + 80U, KTX2_BLOCK_LEVEL_OFFSET);
+    ktx2_store_uint64(header + 88U, level_size);
+    ktx2_store_uint64(header + 96U, level_size);
+
+    // DFD
+    uint8_t *const dfd = header + KTX2_DFD_OFFSET;
+    ktx2_store_uint32(dfd, KTX2_BLOCK_DFD_SIZE);
+    // vendorId (17 bits) = KHRONOS, descriptorType (15 bits) = BASICFORMAT
+    ktx2_store_uint32(dfd + 4U, 0U);
+    // versionNumber = 1.3, descriptorBlockSize
+    ktx2_store_uint16(dfd + 8U, 2U);
+    ktx2_store_uint16(dfd + 10U, static_cast<uint16_t>(KTX2_BLOCK_DFD_SIZE - 4U));
+    // colorModel = BC1A / BC7, colorPrimaries = BT709, transferFunction = SRGB, flags = ALPHA_STRAIGHT
+    dfd[12] = bc7 ? KTX2_DF_MODEL_BC7 : KTX2_DF_MODEL_BC1A;
+    dfd[13] = 1U;
+    dfd[14] = 2U;
+    dfd[15] = 0U;
+    // texelBlockDimension (minus 1): 4x4x1x1
+    dfd[16] = 3U;
+    dfd[17] = 3U;
+    // bytesPlane0
+    dfd[20] = static_cast<uint8_t>(writer->block_size);
+
+    // one sample: the color of the whole block (KHR_DF_CHANNEL_BC1A_COLOR / KHR_DF_CHANNEL_BC7_COLOR)
+    uint8_t *const sample = dfd + 28U;
+    // bitOffset, bitLength - 1, channelType
+    ktx2_store_uint16(sample, 0U);
+    sample[2] = static_cast<uint8_t>(8U * writer->block_size - 1U);
+    sample[3] = 0U;
+    // samplePosition is zero
+    // sampleLower, sampleUpper
+    ktx2_store_uint32(sample + 8U, 0U);
+    ktx2_store_uint32(sample + 12U, 0XFFFFFFFFU);
+
+    writer->failed = writer->failed || (sizeof(header) != fwrite(header, 1U, sizeof(header), writer->file));
+}
+
+static inline void ktx2_store_uint16(uint8_t *destination, uint16_t value)
+{
+    destination[0] = static_cast<uint8_t>(value & 0XFFU);
+    destination[1] = static_cast<uint8_t>((value >> 8U) & 0XFFU);
+}
+
+static inline void ktx2_store_uint32(uint8_t *destination, uint32_t value)
+{
+    destination[0] = static_cast<uint8_t>(value & 0XFFU);
+    destination[1] = static_cast<uint8_t>((value >> 8U) & 0XFFU);
+    destination[2] = static_cast<uint8_t>((value >> 16U) & 0XFFU);
+    destination[3] = static_cast<uint8_t>((value >> 24U) & 0XFFU);
+}
+
+static inline void ktx2_store_uint64(uint8_t *destination, uint64_t value)
+{
+    ktx2_store_uint32(destination, static_cast<uint32_t>(value & 0XFFFFFFFFU));
+    ktx2_store_uint32(destination + 4U, static_cast<uint32_t>(value >> 32U));
+}
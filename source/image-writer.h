@@ -0,0 +1,36 @@
+#ifndef _IMAGE_WRITER_H_
+#define _IMAGE_WRITER_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum image_format
+{
+    // RGB8 PNG with the stored (uncompressed) deflate blocks
+    IMAGE_FORMAT_PNG = 0,
+    // R8G8B8A8 rows (from top to bottom) without any header
+    IMAGE_FORMAT_RAW = 1,
+    // KTX2 with one level of VK_FORMAT_R8G8B8A8_SRGB (no supercompression)
+    IMAGE_FORMAT_KTX2 = 2,
+    // KTX2 with one level of VK_FORMAT_BC1_RGB_SRGB_BLOCK (the blocks are written by the "image_writer_write_block_rows")
+    IMAGE_FORMAT_KTX2_BC1 = 3,
+    // KTX2 with one level of VK_FORMAT_BC7_SRGB_BLOCK (the blocks are written by the "image_writer_write_block_rows")
+    IMAGE_FORMAT_KTX2_BC7 = 4
+};
+
+struct image_writer;
+
+// The rows are written from top to bottom, and the memory of the image writer does NOT depend on the height of the image.
+extern image_writer *image_writer_open(char const *path, image_format format, uint32_t width, uint32_t height);
+
+// The pixels are B8G8R8A8 which is the same as the "bit_RGBs".
+extern bool image_writer_write_rows(image_writer *writer, uint32_t num_rows, uint8_t const (*bit_RGBs)[4]);
+
+// The rows of the 4x4 blocks (8 bytes for the BC1 and 16 bytes for the BC7) are written from top to bottom, and each row is "(width + 3) / 4" contiguous blocks.
+// The last row of the blocks may cover less than 4 rows of the image.
+extern bool image_writer_write_block_rows(image_writer *writer, uint32_t num_block_rows, void const *blocks);
+
+// Returns false if any write has failed or NOT all rows have been written.
+extern bool image_writer_close(image_writer *writer);
+
+#endif
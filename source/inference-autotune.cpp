@@ -0,0 +1,351 @@
+#include "inference-autotune.h"
+#include "inference-predictor.h"
+#include "ntm-file.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdio.h>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+
+#if defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+#include <sys/types.h>
+#include <sys/stat.h>
+#elif defined(_MSC_VER)
+#include <sdkddkver.h>
+#define WIN32_LEAN_AND_MEAN
+#define NOCOMM
+#define NOMINMAX
+#include <Windows.h>
+#include <intrin.h>
+#else
+#error Unknown Compiler
+#endif
+
+static inline uint64_t autotune_hash(uint64_t hash, void const *data, size_t size);
+
+static inline void autotune_cpu_signature(char out_signature[128]);
+
+static inline void autotune_build_signature(char out_signature[256]);
+
+static inline bool autotune_cache_path(std::string &out_path);
+
+static inline bool autotune_cache_find(char const *path, uint64_t key, inference_backend *out_backend, int *out_num_threads);
+
+static inline double autotune_measure(inference_predictor *predictor, int texture_width, int texture_height, std::vector<uint8_t[4]> &bit_RGBs);
+
+extern bool inference_autotune(char const *cache_path, TfLiteModel *tflite_model, void const *tflite_model_data, size_t tflite_model_size, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine, ntm_cpu_isa cpu_isa, int texture_width, int texture_height, inference_backend *out_backend, int *out_num_threads)
+{
+    // FNV-1a offset basis
+    uint64_t key = 0XCBF29CE484222325ULL;
+    {
+        char cpu_signature[128];
+        autotune_cpu_signature(cpu_signature);
+
+        // a rebuild (e.g. the other compiler flags or the other TFLite) may change the ranking even if the models are the same
+        char build_signature[256];
+        autotune_build_signature(build_signature);
+
+        int32_t const resolution[2] = {texture_width, texture_height};
+        uint8_t const has_tflite_model = (NULL != tflite_model) ? 1U : 0U;
+        uint8_t const has_cpu_engine = (NULL != cpu_engine) ? 1U : 0U;
+        uint8_t const has_aot_engine = (NULL != aot_engine) ? 1U : 0U;
+        uint32_t const output_isa = static_cast<uint32_t>(cpu_isa);
+
+        key = autotune_hash(key, cpu_signature, strlen(cpu_signature));
+        key = autotune_hash(key, build_signature, strlen(build_signature));
+        key = autotune_hash(key, resolution, sizeof(resolution));
+        key = autotune_hash(key, &output_isa, sizeof(output_isa));
+        key = autotune_hash(key, &has_tflite_model, sizeof(has_tflite_model));
+        if (NULL != tflite_model)
+        {
+            key = autotune_hash(key, tflite_model_data, tflite_model_size);
+        }
+        key = autotune_hash(key, &has_cpu_engine, sizeof(has_cpu_engine));
+        if (NULL != cpu_engine)
+        {
+            uint32_t const cpu_isa = static_cast<uint32_t>(cpu_engine->isa);
+            key = autotune_hash(key, &cpu_isa, sizeof(cpu_isa));
+            uint64_t const model_hash = ntm_model_hash(&cpu_engine->model);
+            key = autotune_hash(key, &model_hash, sizeof(model_hash));
+        }
+        key = autotune_hash(key, &has_aot_engine, sizeof(has_aot_engine));
+        if (NULL != aot_engine)
+        {
+            // the network compiled into the executable (NOT the NTM asset)
+            uint32_t const aot_isa = static_cast<uint32_t>(aot_engine->isa);
+            key = autotune_hash(key, &aot_isa, sizeof(aot_isa));
+            key = autotune_hash(key, &aot_engine->network_hash, sizeof(aot_engine->network_hash));
+        }
+    }
+
+    std::string default_cache_path;
+    if ((NULL == cache_path) && autotune_cache_path(default_cache_path))
+    {
+        cache_path = default_cache_path.c_str();
+    }
+
+    if ((NULL != cache_path) && autotune_cache_find(cache_path, key, out_backend, out_num_threads))
+    {
+        return true;
+    }
+
+    std::vector<int> thread_counts;
+    {
+        // may be zero if NOT computable
+        int const num_hardware_threads = static_cast<int>(std::thread::hardware_concurrency());
+        for (int num_threads = 1; num_threads < num_hardware_threads; num_threads *= 2)
+        {
+            thread_counts.push_back(num_threads);
+        }
+        thread_counts.push_back((num_hardware_threads >= 1) ? num_hardware_threads : 1);
+    }
+
+    static inference_backend const backends[] = {INFERENCE_BACKEND_TFLITE_GPU, INFERENCE_BACKEND_TFLITE_XNNPACK, INFERENCE_BACKEND_TFLITE, INFERENCE_BACKEND_CPU, INFERENCE_BACKEND_AOT};
+
+    std::vector<uint8_t[4]> bit_RGBs = std::vector<uint8_t[4]>(static_cast<size_t>(texture_width) * static_cast<size_t>(texture_height));
+
+    bool found = false;
+    double best_ms = 0.0;
+    for (inference_backend const backend : backends)
+    {
+        if (((INFERENCE_BACKEND_CPU == backend) && (NULL == cpu_engine)) || ((INFERENCE_BACKEND_AOT == backend) && (NULL == aot_engine)) || ((INFERENCE_BACKEND_CPU != backend) && (INFERENCE_BACKEND_AOT != backend) && (NULL == tflite_model)))
+        {
+            continue;
+        }
+
+        int tile_width;
+        int tile_height;
+        inference_predictor_get_tile_size(backend, texture_width, texture_height, &tile_width, &tile_height);
+
+        for (int const num_threads : thread_counts)
+        {
+            inference_predictor *predictor = inference_predictor_create(backend, tflite_model, cpu_engine, aot_engine, cpu_isa, num_threads, tile_width, tile_height);
+            if (NULL == predictor)
+            {
+                fprintf(stderr, "Autotune: %s is NOT available\n", inference_backend_name(backend));
+                break;
+            }
+
+            double const ms = autotune_measure(predictor, texture_width, texture_height, bit_RGBs);
+
+            inference_predictor_destroy(predictor);
+
+            fprintf(stderr, "Autotune: %s (%d threads) %.3f ms\n", inference_backend_name(backend), num_threads, ms);
+
+            if ((!found) || (ms < best_ms))
+            {
+                found = true;
+                best_ms = ms;
+                (*out_backend) = backend;
+                (*out_num_threads) = num_threads;
+            }
+
+            // the thread count is NOT applicable
+            if (INFERENCE_BACKEND_TFLITE_GPU == backend)
+            {
+                break;
+            }
+        }
+    }
+
+    if (!found)
+    {
+        return false;
+    }
+
+    if (NULL != cache_path)
+    {
+        FILE *file = ntm_fopen_utf8(cache_path, "ab");
+        if ((NULL == file) || (fprintf(file, "%016llx %s %d\n", static_cast<unsigned long long>(key), inference_backend_name(*out_backend), (*out_num_threads)) < 0) || (0 != fclose(file)))
+        {
+            // the calibration merely runs again at the next startup
+            fprintf(stderr, "Autotune: failed to write the cache: %s\n", cache_path);
+        }
+    }
+
+    return true;
+}
+
+static inline uint64_t autotune_hash(uint64_t hash, void const *data, size_t size)
+{
+    // FNV-1a
+    uint8_t const *const bytes = static_cast<uint8_t const *>(data);
+    for (size_t byte_index = 0U; byte_index < size; ++byte_index)
+    {
+        hash ^= bytes[byte_index];
+        hash *= 0X100000001B3ULL;
+    }
+    return hash;
+}
+
+static inline void autotune_cpu_signature(char out_signature[128])
+{
+    // the brand string: e.g. "Intel(R) Xeon(R) Platinum 8375C CPU @ 2.90GHz"
+    char brand[49] = {};
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    unsigned int max_extended_leaf = __get_cpuid_max(0X80000000U, NULL);
+    if (max_extended_leaf >= 0X80000004U)
+    {
+        for (unsigned int leaf_index = 0U; leaf_index < 3U; ++leaf_index)
+        {
+            unsigned int registers[4];
+            __get_cpuid(0X80000002U + leaf_index, &registers[0], &registers[1], &registers[2], &registers[3]);
+            memcpy(brand + sizeof(registers) * leaf_index, registers, sizeof(registers));
+        }
+    }
+#elif defined(_MSC_VER) && defined(_M_X64)
+    int cpu_info[4];
+    __cpuid(cpu_info, 0X80000000);
+    if (static_cast<unsigned int>(cpu_info[0]) >= 0X80000004U)
+    {
+        for (int leaf_index = 0; leaf_index < 3; ++leaf_index)
+        {
+            __cpuid(cpu_info, 0X80000002 + leaf_index);
+            memcpy(brand + sizeof(cpu_info) * leaf_index, cpu_info, sizeof(cpu_info));
+        }
+    }
+#endif
+
+    snprintf(out_signature, 128U, "%s %s %u", brand, ntm_cpu_isa_name(ntm_cpu_detect_isa()), std::thread::hardware_concurrency());
+}
+
+static inline void autotune_build_signature(char out_signature[256])
+{
+    // the size and the modification time of the executable change on each rebuild
+    unsigned long long executable_size = 0U;
+    unsigned long long executable_time = 0U;
+#if defined(__GNUC__)
+    char const compiler[] = __VERSION__;
+
+    struct stat executable_stat;
+    if (0 == stat("/proc/self/exe", &executable_stat))
+    {
+        executable_size = static_cast<unsigned long long>(executable_stat.st_size);
+        executable_time = static_cast<unsigned long long>(executable_stat.st_mtime);
+    }
+#elif defined(_MSC_VER)
+    char compiler[32];
+    snprintf(compiler, sizeof(compiler), "MSVC %d", static_cast<int>(_MSC_FULL_VER));
+
+    wchar_t executable_path[MAX_PATH];
+    DWORD const executable_path_length = GetModuleFileNameW(NULL, executable_path, MAX_PATH);
+    WIN32_FILE_ATTRIBUTE_DATA executable_attribute;
+    if ((0U != executable_path_length) && (executable_path_length < MAX_PATH) && GetFileAttributesExW(executable_path, GetFileExInfoStandard, &executable_attribute))
+    {
+        executable_size = (static_cast<unsigned long long>(executable_attribute.nFileSizeHigh) << 32U) | static_cast<unsigned long long>(executable_attribute.nFileSizeLow);
+        executable_time = (static_cast<unsigned long long>(executable_attribute.ftLastWriteTime.dwHighDateTime) << 32U) | static_cast<unsigned long long>(executable_attribute.ftLastWriteTime.dwLowDateTime);
+    }
+#else
+#error Unknown Compiler
+#endif
+
+    snprintf(out_signature, 256U, "%s TFLite %s %llu %llu", compiler, TfLiteVersion(), executable_size, executable_time);
+}
+
+static inline bool autotune_cache_path(std::string &out_path)
+{
+#if defined(__GNUC__)
+    // https://specifications.freedesktop.org/basedir-spec/latest/
+    char const *const xdg_cache_home = getenv("XDG_CACHE_HOME");
+    if ((NULL != xdg_cache_home) && ('\0' != xdg_cache_home[0]))
+    {
+        out_path = xdg_cache_home;
+    }
+    else
+    {
+        char const *const home = getenv("HOME");
+        if ((NULL == home) || ('\0' == home[0]))
+        {
+            return false;
+        }
+
+        out_path = home;
+        out_path += "/.cache";
+    }
+
+    out_path += "/neural-texture-mapping-autotune.txt";
+    return true;
+#elif defined(_MSC_VER)
+    wchar_t const *const local_app_data = _wgetenv(L"LOCALAPPDATA");
+    if ((NULL == local_app_data) || (L'\0' == local_app_data[0]))
+    {
+        return false;
+    }
+
+    // UTF-16 to UTF-8
+    int utf8_path_size = WideCharToMultiByte(CP_UTF8, 0U, local_app_data, -1, NULL, 0, NULL, NULL);
+    if (utf8_path_size <= 0)
+    {
+        return false;
+    }
+
+    std::vector<char> utf8_path(static_cast<size_t>(utf8_path_size));
+
+    int result_wide_char_to_multi_byte = WideCharToMultiByte(CP_UTF8, 0U, local_app_data, -1, &utf8_path[0], utf8_path_size, NULL, NULL);
+    assert(utf8_path_size == result_wide_char_to_multi_byte);
+    (void)result_wide_char_to_multi_byte;
+
+    out_path = &utf8_path[0];
+    out_path += "\\neural-texture-mapping-autotune.txt";
+    return true;
+#else
+#error Unknown Compiler
+#endif
+}
+
+static inline bool autotune_cache_find(char const *path, uint64_t key, inference_backend *out_backend, int *out_num_threads)
+{
+    FILE *file = ntm_fopen_utf8(path, "rb");
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    // one entry for each line: "<key> <backend> <threads>" (the last entry of the key wins)
+    bool found = false;
+    char line[256];
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        unsigned long long line_key;
+        char backend_name[32];
+        int num_threads;
+        inference_backend backend;
+        if ((3 == sscanf(line, "%llx %31s %d", &line_key, backend_name, &num_threads)) && (key == line_key) && inference_parse_backend(backend_name, &backend) && (INFERENCE_BACKEND_AUTO != backend) && (num_threads >= 0))
+        {
+            found = true;
+            (*out_backend) = backend;
+            (*out_num_threads) = num_threads;
+        }
+    }
+
+    fclose(file);
+
+    return found;
+}
+
+static inline double autotune_measure(inference_predictor *predictor, int texture_width, int texture_height, std::vector<uint8_t[4]> &bit_RGBs)
+{
+    // warmup: e.g. the GPU delegate compiles the kernels at the first invocation
+    predict(&bit_RGBs[0], texture_width, texture_height, predictor);
+
+    double best_ms = 0.0;
+    for (int iteration_index = 0; iteration_index < INFERENCE_AUTOTUNE_ITERATIONS; ++iteration_index)
+    {
+        std::chrono::steady_clock::time_point const begin = std::chrono::steady_clock::now();
+
+        predict(&bit_RGBs[0], texture_width, texture_height, predictor);
+
+        double const ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        best_ms = ((0 == iteration_index) || (ms < best_ms)) ? ms : best_ms;
+    }
+
+    return best_ms;
+}
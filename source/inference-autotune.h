@@ -0,0 +1,19 @@
+#ifndef _INFERENCE_AUTOTUNE_H_
+#define _INFERENCE_AUTOTUNE_H_ 1
+
+#include <tensorflow/lite/c/c_api.h>
+#include "inference-options.h"
+#include "ntm-aot-inference.h"
+#include <stddef.h>
+#include <stdint.h>
+
+static constexpr int const INFERENCE_AUTOTUNE_ITERATIONS = 3;
+
+// The candidates are the GPU delegate, the XNNPACK delegate and the reference interpreter (merely if the "tflite_model" is NOT NULL), the CPU engine (merely if the "cpu_engine" is NOT NULL) and the AOT engine (merely if the "aot_engine" is NOT NULL), and the thread counts (1, 2, 4, ... and all the hardware threads) of each backend except the GPU delegate.
+// All candidates must evaluate the same network, since the fastest one is displayed (see the "inference-main.cpp").
+// Each candidate decodes the texture INFERENCE_AUTOTUNE_ITERATIONS times (after one warmup), and the fastest (by the minimum) is selected. The candidates which can NOT be created (e.g. no GPU) are skipped.
+// The choice is cached in the "cache_path" (NULL: the default location) keyed by the hash of the models (including the network compiled into the AOT engine), the ISAs (of the engines and of the output stage), the resolution, the signature of the CPU and the signature of the build (the compiler, the TFLite version and the size and the modification time of the executable), and thus the calibration merely runs once on each machine.
+// false: no candidate can be created
+extern bool inference_autotune(char const *cache_path, TfLiteModel *tflite_model, void const *tflite_model_data, size_t tflite_model_size, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine, ntm_cpu_isa cpu_isa, int texture_width, int texture_height, inference_backend *out_backend, int *out_num_threads);
+
+#endif
@@ -0,0 +1,328 @@
+#include "inference-baker.h"
+#include "inference-predictor.h"
+#include "image-writer.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+static constexpr int const BAKE_NUM_BANDS = 2;
+
+struct bake_band_queue
+{
+    std::mutex mutex;
+    std::condition_variable condition_variable;
+    // 0: the band is free to be decoded
+    // otherwise: the number of the decoded rows which have NOT been written
+    int num_pending_rows[BAKE_NUM_BANDS];
+    // all the bands have been decoded
+    bool finished;
+    bool failed;
+};
+
+static inline bool bake_level(inference_predictor *predictor, inference_backend backend, char const *path, image_format format, ntm_bc_encoder const *bc_encoder, ntm_bc_encoding const *bc_encoding, int texture_width, int texture_height, int max_band_rows);
+
+static inline std::string bake_mip_path(char const *path, int mip_level);
+
+static inline bool bake_select_format(char const *path, image_format *out_format);
+
+static inline bool bake_match_extension(char const *path, char const *extension);
+
+static void bake_write_bands(bake_band_queue *queue, image_writer *writer, bool blocks, std::vector<uint8_t[4]> *bands);
+
+extern int bake(inference_options const *options, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine)
+{
+    assert(options->bake);
+    assert(NULL != options->output_path);
+    assert(options->benchmark_num_resolutions >= 1);
+    assert(options->bake_band_rows >= 1);
+    assert(options->bake_mip_levels >= 0);
+
+    int const texture_width = options->benchmark_resolutions[0][0];
+    int const texture_height = options->benchmark_resolutions[0][1];
+
+    // the full chain is down to 1x1
+    int num_mip_levels = 1;
+    while (((texture_width >> num_mip_levels) >= 1) || ((texture_height >> num_mip_levels) >= 1))
+    {
+        ++num_mip_levels;
+    }
+
+    if ((0 != options->bake_mip_levels) && (options->bake_mip_levels < num_mip_levels))
+    {
+        num_mip_levels = options->bake_mip_levels;
+    }
+
+    image_format format;
+    if (!bake_select_format(options->output_path, &format))
+    {
+        fprintf(stderr, "Unknown format of the output (.png, .raw or .ktx2 is expected): %s\n", options->output_path);
+        return 1;
+    }
+
+    ntm_bc_encoder bc_encoder;
+    if (options->bake_bc)
+    {
+        if (IMAGE_FORMAT_KTX2 != format)
+        {
+            fprintf(stderr, "The block-compressed output must be \".ktx2\": %s\n", options->output_path);
+            return 1;
+        }
+
+        format = (NTM_BC_FORMAT_BC1 == options->bake_bc_encoding.format) ? IMAGE_FORMAT_KTX2_BC1 : IMAGE_FORMAT_KTX2_BC7;
+        ntm_bc_encoder_init(&bc_encoder, options->cpu_isa);
+    }
+
+    // the bands of the blocks are the rows of the blocks
+    int const max_band_rows = options->bake_bc ? ((options->bake_band_rows + 3) & (~3)) : options->bake_band_rows;
+
+    // The tile is NOT the whole texture even if the TFLite delegates are used, and thus the input and output tensors are independent of the resolution.
+    // Thus, the same predictor decodes all the mip levels.
+    inference_backend backend = options->backend;
+    inference_predictor *predictor = inference_predictor_create_with_fallback(&backend, tflite_model, cpu_engine, aot_engine, options->cpu_isa, options->threads[0], INFERENCE_TILE_SIZE, INFERENCE_TILE_SIZE);
+    if (NULL == predictor)
+    {
+        fprintf(stderr, "Failed to create the predictor\n");
+        return 1;
+    }
+
+    // Each level is decoded directly at the resolution of the level (rather than box-filtering the level 0).
+    // NOTE: merely the CPU engine with the LOD enabled band-limits the positional encoding, and the other backends merely sample the network at the texel centers of the level.
+    bool const lod = (INFERENCE_BACKEND_CPU == backend) && (0U != cpu_engine->lod_base_width);
+
+    int result = 0;
+    for (int mip_level = 0; mip_level < num_mip_levels; ++mip_level)
+    {
+        int const mip_width = ((texture_width >> mip_level) > 1) ? (texture_width >> mip_level) : 1;
+        int const mip_height = ((texture_height >> mip_level) > 1) ? (texture_height >> mip_level) : 1;
+        std::string const mip_path = (0 == mip_level) ? std::string(options->output_path) : bake_mip_path(options->output_path, mip_level);
+
+        if (lod)
+        {
+            fprintf(stderr, "Mip %d: %u frequencies\n", mip_level, ntm_cpu_engine_lod_num_frequencies(cpu_engine, 1.0F / static_cast<float>(mip_width), 1.0F / static_cast<float>(mip_height)));
+        }
+
+        if (!bake_level(predictor, backend, mip_path.c_str(), format, options->bake_bc ? &bc_encoder : NULL, options->bake_bc ? &options->bake_bc_encoding : NULL, mip_width, mip_height, max_band_rows))
+        {
+            result = 1;
+            break;
+        }
+    }
+
+    inference_predictor_destroy(predictor);
+    return result;
+}
+
+static inline bool bake_level(inference_predictor *predictor, inference_backend backend, char const *path, image_format format, ntm_bc_encoder const *bc_encoder, ntm_bc_encoding const *bc_encoding, int texture_width, int texture_height, int max_band_rows)
+{
+    assert((NULL == bc_encoding) || (0 == (max_band_rows % 4)));
+
+    int const band_rows = (max_band_rows < texture_height) ? max_band_rows : texture_height;
+
+    image_writer *writer = image_writer_open(path, format, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height));
+    if (NULL == writer)
+    {
+        fprintf(stderr, "Failed to open the output: %s\n", path);
+        return false;
+    }
+
+    // blocks: the size of one block (8 or 16 bytes) is a multiple of 4
+    size_t const band_size = (NULL != bc_encoding) ? (static_cast<size_t>(ntm_bc_block_size(bc_encoding->format) / 4U) * static_cast<size_t>((texture_width + 3) / 4) * static_cast<size_t>((band_rows + 3) / 4)) : (static_cast<size_t>(texture_width) * static_cast<size_t>(band_rows));
+
+    std::vector<uint8_t[4]> bands[BAKE_NUM_BANDS];
+    for (int band_index = 0; band_index < BAKE_NUM_BANDS; ++band_index)
+    {
+        bands[band_index] = std::vector<uint8_t[4]>(band_size);
+    }
+
+    bake_band_queue queue;
+    for (int band_index = 0; band_index < BAKE_NUM_BANDS; ++band_index)
+    {
+        queue.num_pending_rows[band_index] = 0;
+    }
+    queue.finished = false;
+    queue.failed = false;
+
+    std::thread writer_thread(bake_write_bands, &queue, writer, (NULL != bc_encoding), bands);
+
+    // the sum of the squared errors of the blocks
+    uint64_t bc_error = 0U;
+
+    int const num_bands = (texture_height + band_rows - 1) / band_rows;
+    for (int band_index = 0; band_index < num_bands; ++band_index)
+    {
+        int const slot_index = band_index % BAKE_NUM_BANDS;
+        int const row_begin = band_rows * band_index;
+        int const num_rows = ((texture_height - row_begin) < band_rows) ? (texture_height - row_begin) : band_rows;
+
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.condition_variable.wait(lock, [&queue, slot_index]
+                                          { return (0 == queue.num_pending_rows[slot_index]) || queue.failed; });
+
+            if (queue.failed)
+            {
+                break;
+            }
+        }
+
+        if (NULL != bc_encoding)
+        {
+            bc_error += predict_blocks(&bands[slot_index][0], texture_width, texture_height, row_begin, num_rows, bc_encoder, bc_encoding, predictor);
+        }
+        else
+        {
+            predict_rows(&bands[slot_index][0], texture_width, texture_height, row_begin, num_rows, predictor);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.num_pending_rows[slot_index] = num_rows;
+        }
+        queue.condition_variable.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.finished = true;
+    }
+    queue.condition_variable.notify_all();
+
+    writer_thread.join();
+
+    bool const result_close = image_writer_close(writer);
+
+    if (queue.failed || (!result_close))
+    {
+        fprintf(stderr, "Failed to write the output: %s\n", path);
+        return false;
+    }
+
+    fprintf(stderr, "Baked %dx%d (%d bands of %d rows, %s, %d threads): %s\n", texture_width, texture_height, num_bands, band_rows, inference_backend_name(backend), inference_predictor_get_num_threads(predictor), path);
+
+    if (NULL != bc_encoding)
+    {
+        // against the decoded texels (the texels of the blocks at the edges replicate the edges)
+        double const num_samples = 3.0 * 16.0 * static_cast<double>((texture_width + 3) / 4) * static_cast<double>((texture_height + 3) / 4);
+        double const mse = static_cast<double>(bc_error) / num_samples;
+        if (mse > 0.0)
+        {
+            fprintf(stderr, "%s (%s): %.2f dB PSNR against the decoded texels\n", ntm_bc_format_name(bc_encoding->format), ntm_bc_quality_name(bc_encoding->quality), 10.0 * log10((255.0 * 255.0) / mse));
+        }
+        else
+        {
+            fprintf(stderr, "%s (%s): lossless against the decoded texels\n", ntm_bc_format_name(bc_encoding->format), ntm_bc_quality_name(bc_encoding->quality));
+        }
+    }
+
+    return true;
+}
+
+static inline std::string bake_mip_path(char const *path, int mip_level)
+{
+    // the extension has been matched by the "bake_select_format"
+    char const *const extension = strrchr(path, '.');
+    assert(NULL != extension);
+
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), "-mip%d", mip_level);
+
+    return std::string(path, static_cast<size_t>(extension - path)) + suffix + extension;
+}
+
+static inline bool bake_select_format(char const *path, image_format *out_format)
+{
+    if (bake_match_extension(path, ".png"))
+    {
+        (*out_format) = IMAGE_FORMAT_PNG;
+        return true;
+    }
+    else if (bake_match_extension(path, ".raw"))
+    {
+        (*out_format) = IMAGE_FORMAT_RAW;
+        return true;
+    }
+    else if (bake_match_extension(path, ".ktx2"))
+    {
+        (*out_format) = IMAGE_FORMAT_KTX2;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+static inline bool bake_match_extension(char const *path, char const *extension)
+{
+    size_t const path_length = strlen(path);
+    size_t const extension_length = strlen(extension);
+    if (path_length < extension_length)
+    {
+        return false;
+    }
+
+    // case insensitive (the extension is lower case)
+    for (size_t character_index = 0U; character_index < extension_length; ++character_index)
+    {
+        char character = path[path_length - extension_length + character_index];
+        if (('A' <= character) && (character <= 'Z'))
+        {
+            character = static_cast<char>(character - 'A' + 'a');
+        }
+
+        if (character != extension[character_index])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void bake_write_bands(bake_band_queue *queue, image_writer *writer, bool blocks, std::vector<uint8_t[4]> *bands)
+{
+    // the bands are decoded in the order of the slots
+    int slot_index = 0;
+    while (true)
+    {
+        int num_rows;
+        {
+            std::unique_lock<std::mutex> lock(queue->mutex);
+            queue->condition_variable.wait(lock, [queue, slot_index]
+                                           { return (0 != queue->num_pending_rows[slot_index]) || queue->finished; });
+
+            num_rows = queue->num_pending_rows[slot_index];
+        }
+
+        if (0 == num_rows)
+        {
+            // the "finished" is set after the last band has been decoded
+            break;
+        }
+
+        // the file I/O (and the PNG checksums) overlap the decoding of the next band
+        bool const result_write_rows = blocks ? image_writer_write_block_rows(writer, static_cast<uint32_t>((num_rows + 3) / 4), &bands[slot_index][0]) : image_writer_write_rows(writer, static_cast<uint32_t>(num_rows), &bands[slot_index][0]);
+
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->num_pending_rows[slot_index] = 0;
+            queue->failed = queue->failed || (!result_write_rows);
+        }
+        queue->condition_variable.notify_all();
+
+        if (!result_write_rows)
+        {
+            break;
+        }
+
+        slot_index = (slot_index + 1) % BAKE_NUM_BANDS;
+    }
+}
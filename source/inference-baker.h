@@ -0,0 +1,15 @@
+#ifndef _INFERENCE_BAKER_H_
+#define _INFERENCE_BAKER_H_ 1
+
+#include <tensorflow/lite/c/c_api.h>
+#include "inference-options.h"
+#include "ntm-aot-inference.h"
+
+// The texture is decoded band by band (each band is "bake_band_rows" rows), and each band is written as soon as it has been decoded.
+// There are merely two bands: the writer thread writes one band while the workers decode the other one, and thus the peak memory is independent of the height.
+// The format is selected by the extension of the output: ".png", ".raw" (R8G8B8A8 rows) or ".ktx2".
+// "--bc": each tile is encoded into the BC1 / BC7 blocks as soon as it has been decoded, the bands are the rows of the blocks (the band rows are rounded up to a multiple of 4), and the output must be ".ktx2".
+// The mip levels ("bake_mip_levels") are decoded directly at the resolution of each level, and the level L (> 0) is written to "<output>-mip<L>.<extension>".
+extern int bake(inference_options const *options, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine);
+
+#endif
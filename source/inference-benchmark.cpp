@@ -0,0 +1,320 @@
+#include "inference-benchmark.h"
+#include "inference-predictor.h"
+#include "image-writer.h"
+#include "ntm-file.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+#include <string>
+
+#if defined(__GNUC__)
+#include <sys/resource.h>
+#include <time.h>
+#elif defined(_MSC_VER)
+#include <sdkddkver.h>
+#define WIN32_LEAN_AND_MEAN
+#define NOCOMM
+#define NOMINMAX
+#include <Windows.h>
+#include <psapi.h>
+#else
+#error Unknown Compiler
+#endif
+
+struct benchmark_result
+{
+    int texture_width;
+    int texture_height;
+    int num_threads;
+    ntm_layout layout;
+    double mean_ms;
+    double p50_ms;
+    double p99_ms;
+    double megapixels_per_second;
+    // the mean of the deswizzle (to the row-major image) which is NOT included in the decode
+    double deswizzle_ms;
+    uint64_t peak_rss_bytes;
+};
+
+static inline double benchmark_time_ms();
+
+static inline uint64_t benchmark_peak_rss_bytes();
+
+static inline double benchmark_percentile(std::vector<double> const &sorted_latencies, double percentile);
+
+static inline bool benchmark_write_image(char const *path, int texture_width, int texture_height, uint8_t const (*bit_RGBs)[4]);
+
+extern int benchmark(inference_options const *options, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine)
+{
+    assert(options->benchmark);
+    assert(options->benchmark_iterations >= 1);
+
+    bool const multiple_configurations = ((options->benchmark_num_resolutions * options->num_threads * options->num_layouts) > 1);
+
+    std::vector<benchmark_result> results;
+
+    bool failed = false;
+    for (int resolution_index = 0; (!failed) && (resolution_index < options->benchmark_num_resolutions); ++resolution_index)
+    {
+        int const texture_width = options->benchmark_resolutions[resolution_index][0];
+        int const texture_height = options->benchmark_resolutions[resolution_index][1];
+
+        for (int threads_index = 0; (!failed) && (threads_index < options->num_threads); ++threads_index)
+        {
+            int tile_width;
+            int tile_height;
+            inference_predictor_get_tile_size(options->backend, texture_width, texture_height, &tile_width, &tile_height);
+
+            // NOTE: the benchmark never falls back, since the report is of the specified backend
+            inference_predictor *predictor = inference_predictor_create(options->backend, tflite_model, cpu_engine, aot_engine, options->cpu_isa, options->threads[threads_index], tile_width, tile_height);
+            if (NULL == predictor)
+            {
+                fprintf(stderr, "Failed to create the predictor\n");
+                failed = true;
+                break;
+            }
+
+            // 0 is resolved to the number of hardware threads
+            int const num_threads = inference_predictor_get_num_threads(predictor);
+
+            // row-major (the deswizzled image)
+            std::vector<uint8_t[4]> bit_RGBs(static_cast<size_t>(texture_width) * static_cast<size_t>(texture_height));
+
+            for (int layout_index = 0; (!failed) && (layout_index < options->num_layouts); ++layout_index)
+            {
+                ntm_layout const layout = options->layouts[layout_index];
+
+                // the storage of the layout (merely used by the TILED and the MORTON)
+                std::vector<uint8_t[4]> texels((NTM_LAYOUT_LINEAR != layout) ? ntm_layout_get_size(layout, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height)) : 0U);
+                uint8_t(*const out_texels)[4] = (NTM_LAYOUT_LINEAR != layout) ? &texels[0] : &bit_RGBs[0];
+
+                for (int iteration_index = 0; iteration_index < options->benchmark_warmup_iterations; ++iteration_index)
+                {
+                    predict_layout(out_texels, texture_width, texture_height, layout, predictor);
+                }
+
+                std::vector<double> latencies(static_cast<size_t>(options->benchmark_iterations));
+                double total_deswizzle_ms = 0.0;
+                for (int iteration_index = 0; iteration_index < options->benchmark_iterations; ++iteration_index)
+                {
+                    double const begin_ms = benchmark_time_ms();
+
+                    predict_layout(out_texels, texture_width, texture_height, layout, predictor);
+
+                    double const end_ms = benchmark_time_ms();
+                    latencies[iteration_index] = end_ms - begin_ms;
+
+                    if (NTM_LAYOUT_LINEAR != layout)
+                    {
+                        ntm_layout_deswizzle(layout, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height), out_texels, &bit_RGBs[0], sizeof(uint8_t[4]) * static_cast<size_t>(texture_width));
+
+                        total_deswizzle_ms += benchmark_time_ms() - end_ms;
+                    }
+                }
+
+                double total_ms = 0.0;
+                for (double const latency : latencies)
+                {
+                    total_ms += latency;
+                }
+
+                std::sort(latencies.begin(), latencies.end());
+
+                benchmark_result result;
+                result.texture_width = texture_width;
+                result.texture_height = texture_height;
+                result.num_threads = num_threads;
+                result.layout = layout;
+                result.mean_ms = total_ms / static_cast<double>(latencies.size());
+                result.p50_ms = benchmark_percentile(latencies, 0.5);
+                result.p99_ms = benchmark_percentile(latencies, 0.99);
+                result.megapixels_per_second = (result.mean_ms > 0.0) ? ((static_cast<double>(texture_width) * static_cast<double>(texture_height)) / (result.mean_ms * 1000.0)) : 0.0;
+                result.deswizzle_ms = total_deswizzle_ms / static_cast<double>(latencies.size());
+                // The peak is of the whole process, namely, it is monotonic across the configurations.
+                result.peak_rss_bytes = benchmark_peak_rss_bytes();
+                results.push_back(result);
+
+                if (NULL != options->output_path)
+                {
+                    std::string output_path = options->output_path;
+                    if (multiple_configurations)
+                    {
+                        // "decoded.png" -> "decoded-1024x1024-t4.png" (or "decoded-1024x1024-t4-morton.png" when there are multiple layouts)
+                        char suffix[64];
+                        if (options->num_layouts > 1)
+                        {
+                            snprintf(suffix, sizeof(suffix), "-%dx%d-t%d-%s", texture_width, texture_height, num_threads, ntm_layout_name(layout));
+                        }
+                        else
+                        {
+                            snprintf(suffix, sizeof(suffix), "-%dx%d-t%d", texture_width, texture_height, num_threads);
+                        }
+
+                        size_t const separator_position = output_path.find_last_of("/\\");
+                        size_t const extension_position = output_path.find_last_of('.');
+                        size_t const insert_position = ((std::string::npos != extension_position) && ((std::string::npos == separator_position) || (extension_position > separator_position))) ? extension_position : output_path.size();
+                        output_path.insert(insert_position, suffix);
+                    }
+
+                    if (!benchmark_write_image(output_path.c_str(), texture_width, texture_height, &bit_RGBs[0]))
+                    {
+                        fprintf(stderr, "Failed to write the decoded image: %s\n", output_path.c_str());
+                        failed = true;
+                    }
+                }
+            }
+
+            inference_predictor_destroy(predictor);
+        }
+    }
+
+    if (failed)
+    {
+        return 1;
+    }
+
+    std::string report;
+    {
+        char buffer[512];
+
+        char const *const backend_name = inference_backend_name(options->backend);
+        // NULL: the ISA is NOT applicable (TFLite)
+        char const *isa_name;
+        switch (options->backend)
+        {
+        case INFERENCE_BACKEND_CPU:
+            isa_name = ntm_cpu_isa_name(cpu_engine->isa);
+            break;
+        case INFERENCE_BACKEND_AOT:
+            isa_name = ntm_cpu_isa_name(aot_engine->isa);
+            break;
+        default:
+            assert((INFERENCE_BACKEND_TFLITE == options->backend) || (INFERENCE_BACKEND_TFLITE_XNNPACK == options->backend) || (INFERENCE_BACKEND_TFLITE_GPU == options->backend));
+            isa_name = NULL;
+        }
+
+        snprintf(buffer, sizeof(buffer), "{\n  \"backend\": \"%s\",\n  \"isa\": %s%s%s,\n  \"warmup_iterations\": %d,\n  \"iterations\": %d,\n  \"results\": [", backend_name, (NULL != isa_name) ? "\"" : "", (NULL != isa_name) ? isa_name : "null", (NULL != isa_name) ? "\"" : "", options->benchmark_warmup_iterations, options->benchmark_iterations);
+        report += buffer;
+
+        for (size_t result_index = 0U; result_index < results.size(); ++result_index)
+        {
+            benchmark_result const &result = results[result_index];
+            snprintf(buffer, sizeof(buffer), "%s\n    {\"width\": %d, \"height\": %d, \"threads\": %d, \"layout\": \"%s\", \"mean_ms\": %.4f, \"p50_ms\": %.4f, \"p99_ms\": %.4f, \"megapixels_per_second\": %.4f, \"deswizzle_ms\": %.4f, \"peak_rss_bytes\": %llu}", (result_index > 0U) ? "," : "", result.texture_width, result.texture_height, result.num_threads, ntm_layout_name(result.layout), result.mean_ms, result.p50_ms, result.p99_ms, result.megapixels_per_second, result.deswizzle_ms, static_cast<unsigned long long>(result.peak_rss_bytes));
+            report += buffer;
+        }
+
+        report += "\n  ]\n}\n";
+    }
+
+    if (NULL != options->benchmark_report_path)
+    {
+        FILE *file = ntm_fopen_utf8(options->benchmark_report_path, "wb");
+        if ((NULL == file) || (report.size() != fwrite(report.data(), 1U, report.size(), file)))
+        {
+            fprintf(stderr, "Failed to write the benchmark report: %s\n", options->benchmark_report_path);
+            if (NULL != file)
+            {
+                fclose(file);
+            }
+            return 1;
+        }
+
+        if (0 != fclose(file))
+        {
+            fprintf(stderr, "Failed to write the benchmark report: %s\n", options->benchmark_report_path);
+            return 1;
+        }
+    }
+    else
+    {
+        fputs(report.c_str(), stdout);
+        fflush(stdout);
+    }
+
+    return 0;
+}
+
+static inline double benchmark_time_ms()
+{
+#if defined(__GNUC__)
+    struct timespec time_monotonic;
+    clock_gettime(CLOCK_MONOTONIC, &time_monotonic);
+    return 1E3 * static_cast<double>(time_monotonic.tv_sec) + 1E-6 * static_cast<double>(time_monotonic.tv_nsec);
+#elif defined(_MSC_VER)
+    LARGE_INTEGER int64_frequency;
+    BOOL result_query_performance_frequency = QueryPerformanceFrequency(&int64_frequency);
+    assert(FALSE != result_query_performance_frequency);
+    (void)result_query_performance_frequency;
+
+    LARGE_INTEGER int64_performance_count;
+    BOOL result_query_performance_counter = QueryPerformanceCounter(&int64_performance_count);
+    assert(FALSE != result_query_performance_counter);
+    (void)result_query_performance_counter;
+
+    return 1E3 * static_cast<double>(int64_performance_count.QuadPart) / static_cast<double>(int64_frequency.QuadPart);
+#else
+#error Unknown Compiler
+#endif
+}
+
+static inline uint64_t benchmark_peak_rss_bytes()
+{
+#if defined(__GNUC__)
+    struct rusage resource_usage;
+    if (0 != getrusage(RUSAGE_SELF, &resource_usage))
+    {
+        return 0U;
+    }
+
+    // kilobytes on Linux
+    return static_cast<uint64_t>(resource_usage.ru_maxrss) * 1024U;
+#elif defined(_MSC_VER)
+    PROCESS_MEMORY_COUNTERS process_memory_counters;
+    if (FALSE == GetProcessMemoryInfo(GetCurrentProcess(), &process_memory_counters, sizeof(process_memory_counters)))
+    {
+        return 0U;
+    }
+
+    return static_cast<uint64_t>(process_memory_counters.PeakWorkingSetSize);
+#else
+#error Unknown Compiler
+#endif
+}
+
+static inline double benchmark_percentile(std::vector<double> const &sorted_latencies, double percentile)
+{
+    assert(!sorted_latencies.empty());
+
+    // nearest-rank
+    size_t rank = static_cast<size_t>(ceil(percentile * static_cast<double>(sorted_latencies.size())));
+    if (rank < 1U)
+    {
+        rank = 1U;
+    }
+    else if (rank > sorted_latencies.size())
+    {
+        rank = sorted_latencies.size();
+    }
+
+    return sorted_latencies[rank - 1U];
+}
+
+static inline bool benchmark_write_image(char const *path, int texture_width, int texture_height, uint8_t const (*bit_RGBs)[4])
+{
+    image_writer *writer = image_writer_open(path, IMAGE_FORMAT_PNG, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height));
+    if (NULL == writer)
+    {
+        return false;
+    }
+
+    bool const result_write_rows = image_writer_write_rows(writer, static_cast<uint32_t>(texture_height), bit_RGBs);
+
+    bool const result_close = image_writer_close(writer);
+
+    return result_write_rows && result_close;
+}
@@ -0,0 +1,12 @@
+#ifndef _INFERENCE_BENCHMARK_H_
+#define _INFERENCE_BENCHMARK_H_ 1
+
+#include <tensorflow/lite/c/c_api.h>
+#include "inference-options.h"
+#include "ntm-aot-inference.h"
+
+// Neither the window nor the GPU delegate is created, and the report is written as JSON.
+// The TFLite backend uses one interpreter (without any delegate) for each worker of the thread pool.
+extern int benchmark(inference_options const *options, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine);
+
+#endif
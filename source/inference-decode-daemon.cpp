@@ -0,0 +1,749 @@
+#include "inference-decode-daemon.h"
+#include "ntm-pack.h"
+#include "ntm-decode-protocol.h"
+#include "ntm-decode-scheduler.h"
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <errno.h>
+#include <signal.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <stdio.h>
+#include <new>
+#include <vector>
+#include <string>
+
+// The pending tiles (of all the clients) are decoded at most this many at once, and thus the urgent request submitted by any client waits at most one batch.
+static constexpr uint32_t const DECODE_DAEMON_BATCH_TILES = 256U;
+
+static constexpr int const DECODE_DAEMON_LISTEN_BACKLOG = 64;
+
+// The pending requests and the unsent completions of one client are at most this many, and then the messages of the client are NOT received until the client has read the completions.
+// Thus, the client which never reads the completions is pushed back by its own socket rather than growing the memory of the daemon.
+static constexpr size_t const DECODE_DAEMON_MAX_CLIENT_MESSAGES = 1024U;
+
+struct decode_daemon_texture
+{
+    std::string name;
+    ntm_cpu_engine engine;
+};
+
+struct decode_daemon_buffer
+{
+    uint32_t buffer_id;
+    void *memory;
+    size_t size;
+    // the buffer is still mapped by the daemon until the pending requests (which write into it) have been completed
+    uint32_t num_pending_requests;
+    bool unmapped;
+};
+
+struct decode_daemon_client
+{
+    // -1: disconnected, and the client is destroyed after the pending requests have been completed
+    int socket_fd;
+    uint32_t num_pending_requests;
+    std::vector<decode_daemon_buffer *> buffers;
+    // the "COMPLETE" messages which can NOT be sent without blocking
+    std::vector<ntm_decode_message> outgoing_messages;
+};
+
+struct decode_daemon_context
+{
+    inference_options const *options;
+    ntm_pack *pack;
+    ntm_decode_scheduler *scheduler;
+    std::vector<decode_daemon_texture *> textures;
+    std::vector<decode_daemon_client *> clients;
+    uint32_t num_pending_requests;
+};
+
+// the "user_data" of the "ntm_decode_request"
+struct decode_daemon_request
+{
+    decode_daemon_context *daemon;
+    decode_daemon_client *client;
+    decode_daemon_buffer *buffer;
+    uint32_t request_id;
+};
+
+static volatile sig_atomic_t decode_daemon_stop_requested = 0;
+
+static void decode_daemon_signal_handler(int);
+
+static inline int decode_daemon_listen(char const *socket_path);
+
+static inline void decode_daemon_receive(decode_daemon_context *daemon, decode_daemon_client *client);
+
+static inline void decode_daemon_map_buffer(decode_daemon_client *client, ntm_decode_message const *message, int fd);
+
+static inline void decode_daemon_unmap_buffer(decode_daemon_client *client, uint32_t buffer_id);
+
+static inline void decode_daemon_decode(decode_daemon_context *daemon, decode_daemon_client *client, ntm_decode_message const *message);
+
+static inline ntm_cpu_engine const *decode_daemon_find_engine(decode_daemon_context *daemon, char const *name);
+
+static inline void decode_daemon_complete(decode_daemon_client *client, uint32_t request_id, ntm_decode_status status);
+
+static void decode_daemon_request_callback(void *user_data);
+
+static inline void decode_daemon_release_buffer(decode_daemon_client *client, decode_daemon_buffer *buffer);
+
+static inline void decode_daemon_flush(decode_daemon_client *client);
+
+static inline void decode_daemon_disconnect(decode_daemon_client *client);
+
+static inline bool decode_daemon_client_throttled(decode_daemon_client const *client);
+
+extern int decode_daemon(inference_options const *options)
+{
+    assert(NULL != options->daemon_socket_path);
+    assert(NULL != options->pack_path);
+
+    decode_daemon_context daemon;
+    daemon.options = options;
+    daemon.num_pending_requests = 0U;
+
+    daemon.pack = ntm_pack_open(options->pack_path);
+    if (NULL == daemon.pack)
+    {
+        fprintf(stderr, "Failed to open the NTM pack: %s\n", options->pack_path);
+        return 1;
+    }
+
+    int const listen_fd = decode_daemon_listen(options->daemon_socket_path);
+    if (-1 == listen_fd)
+    {
+        ntm_pack_close(daemon.pack);
+        return 1;
+    }
+
+    // The SIGINT and the SIGTERM are blocked except within the "ppoll", and thus the signal which arrives between the check of the "decode_daemon_stop_requested" and the "ppoll" interrupts the "ppoll" rather than being missed.
+    // NOTE: blocked before the workers are created, since the signal is NOT delivered to the thread which blocks it
+    struct sigaction previous_sigint_action;
+    struct sigaction previous_sigterm_action;
+    sigset_t previous_signal_mask;
+    sigset_t poll_signal_mask;
+    {
+        struct sigaction signal_action = {};
+        signal_action.sa_handler = decode_daemon_signal_handler;
+        sigemptyset(&signal_action.sa_mask);
+        // the "ppoll" is interrupted (the "ppoll" is never restarted after the signal handler)
+        signal_action.sa_flags = 0;
+        sigaction(SIGINT, &signal_action, &previous_sigint_action);
+        sigaction(SIGTERM, &signal_action, &previous_sigterm_action);
+
+        sigset_t stop_signal_mask;
+        sigemptyset(&stop_signal_mask);
+        sigaddset(&stop_signal_mask, SIGINT);
+        sigaddset(&stop_signal_mask, SIGTERM);
+        sigprocmask(SIG_BLOCK, &stop_signal_mask, &previous_signal_mask);
+
+        poll_signal_mask = previous_signal_mask;
+        sigdelset(&poll_signal_mask, SIGINT);
+        sigdelset(&poll_signal_mask, SIGTERM);
+    }
+
+    daemon.scheduler = ntm_decode_scheduler_create(static_cast<uint32_t>(options->threads[0]));
+    if (NULL == daemon.scheduler)
+    {
+        fprintf(stderr, "Failed to create the decode scheduler\n");
+        sigprocmask(SIG_SETMASK, &previous_signal_mask, NULL);
+        sigaction(SIGINT, &previous_sigint_action, NULL);
+        sigaction(SIGTERM, &previous_sigterm_action, NULL);
+        close(listen_fd);
+        unlink(options->daemon_socket_path);
+        ntm_pack_close(daemon.pack);
+        return 1;
+    }
+
+    fprintf(stdout, "Daemon: %s (%u textures, %d threads)\n", options->daemon_socket_path, ntm_pack_get_count(daemon.pack), options->threads[0]);
+    fflush(stdout);
+
+    int result = 0;
+    std::vector<pollfd> poll_fds;
+    while (0 == decode_daemon_stop_requested)
+    {
+        // [0]: the listen socket, [1 + i]: the client i
+        poll_fds.resize(1U + daemon.clients.size());
+        poll_fds[0].fd = listen_fd;
+        poll_fds[0].events = POLLIN;
+        poll_fds[0].revents = 0;
+        for (size_t client_index = 0U; client_index < daemon.clients.size(); ++client_index)
+        {
+            decode_daemon_client const *const client = daemon.clients[client_index];
+            // the negative fd is ignored by the "ppoll"
+            poll_fds[1U + client_index].fd = client->socket_fd;
+            poll_fds[1U + client_index].events = ((!decode_daemon_client_throttled(client)) ? POLLIN : 0) | ((!client->outgoing_messages.empty()) ? POLLOUT : 0);
+            poll_fds[1U + client_index].revents = 0;
+        }
+
+        // the pending requests are dispatched without waiting for the sockets
+        struct timespec const no_wait = {0, 0};
+        int const result_poll = ppoll(&poll_fds[0], poll_fds.size(), (daemon.num_pending_requests > 0U) ? &no_wait : NULL, &poll_signal_mask);
+        if (-1 == result_poll)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            perror("ppoll");
+            result = 1;
+            break;
+        }
+
+        if (0 != (poll_fds[0].revents & POLLIN))
+        {
+            while (true)
+            {
+                int const socket_fd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                if (-1 == socket_fd)
+                {
+                    // e.g. EAGAIN, or the client has already closed the connection
+                    break;
+                }
+
+                decode_daemon_client *client = new (std::nothrow) decode_daemon_client;
+                if (NULL == client)
+                {
+                    close(socket_fd);
+                    break;
+                }
+
+                client->socket_fd = socket_fd;
+                client->num_pending_requests = 0U;
+                daemon.clients.push_back(client);
+            }
+        }
+
+        // NOTE: the clients accepted above are NOT in the "poll_fds"
+        for (size_t client_index = 0U; client_index < (poll_fds.size() - 1U); ++client_index)
+        {
+            decode_daemon_client *const client = daemon.clients[client_index];
+            short const revents = poll_fds[1U + client_index].revents;
+
+            if ((-1 != client->socket_fd) && (0 != (revents & POLLOUT)))
+            {
+                decode_daemon_flush(client);
+            }
+
+            // the remaining messages are received before the hang up is observed by the "recv"
+            if ((-1 != client->socket_fd) && (0 != (revents & (POLLIN | POLLHUP | POLLERR))))
+            {
+                decode_daemon_receive(&daemon, client);
+            }
+        }
+
+        // the requests of all the clients are batched
+        if (daemon.num_pending_requests > 0U)
+        {
+            ntm_decode_scheduler_dispatch(daemon.scheduler, DECODE_DAEMON_BATCH_TILES);
+        }
+
+        for (size_t client_index = 0U; client_index < daemon.clients.size();)
+        {
+            decode_daemon_client *const client = daemon.clients[client_index];
+
+            if ((-1 != client->socket_fd) && (!client->outgoing_messages.empty()))
+            {
+                decode_daemon_flush(client);
+            }
+
+            if ((-1 == client->socket_fd) && (0U == client->num_pending_requests))
+            {
+                for (decode_daemon_buffer *const buffer : client->buffers)
+                {
+                    assert(0U == buffer->num_pending_requests);
+                    munmap(buffer->memory, buffer->size);
+                    delete buffer;
+                }
+
+                delete client;
+
+                daemon.clients.erase(daemon.clients.begin() + client_index);
+            }
+            else
+            {
+                ++client_index;
+            }
+        }
+    }
+
+    sigprocmask(SIG_SETMASK, &previous_signal_mask, NULL);
+    sigaction(SIGINT, &previous_sigint_action, NULL);
+    sigaction(SIGTERM, &previous_sigterm_action, NULL);
+
+    // the workers may still write into the buffers
+    ntm_decode_scheduler_flush(daemon.scheduler, DECODE_DAEMON_BATCH_TILES);
+    assert(0U == daemon.num_pending_requests);
+
+    ntm_decode_scheduler_statistics statistics;
+    ntm_decode_scheduler_get_statistics(daemon.scheduler, &statistics);
+    fprintf(stderr, "Daemon: %llu requests, %llu missed deadlines, %llu tiles, %llu batches\n", static_cast<unsigned long long>(statistics.completed_requests), static_cast<unsigned long long>(statistics.missed_deadlines), static_cast<unsigned long long>(statistics.decoded_tiles), static_cast<unsigned long long>(statistics.batches));
+
+    ntm_decode_scheduler_destroy(daemon.scheduler);
+
+    for (decode_daemon_client *const client : daemon.clients)
+    {
+        if (-1 != client->socket_fd)
+        {
+            decode_daemon_flush(client);
+        }
+
+        if (-1 != client->socket_fd)
+        {
+            close(client->socket_fd);
+        }
+
+        for (decode_daemon_buffer *const buffer : client->buffers)
+        {
+            munmap(buffer->memory, buffer->size);
+            delete buffer;
+        }
+
+        delete client;
+    }
+
+    close(listen_fd);
+    unlink(options->daemon_socket_path);
+
+    // NOTE: the engines reference the coefficients in the mapped memory of the pack
+    for (decode_daemon_texture *const texture : daemon.textures)
+    {
+        delete texture;
+    }
+
+    ntm_pack_close(daemon.pack);
+
+    return result;
+}
+
+static void decode_daemon_signal_handler(int)
+{
+    decode_daemon_stop_requested = 1;
+}
+
+static inline int decode_daemon_listen(char const *socket_path)
+{
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(address.sun_path))
+    {
+        fprintf(stderr, "Too long socket path: %s\n", socket_path);
+        return -1;
+    }
+    strcpy(address.sun_path, socket_path);
+
+    // The socket file of the previous daemon which has crashed is replaced, while the socket of the running daemon is NOT.
+    {
+        int const probe_fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+        if (-1 == probe_fd)
+        {
+            perror("socket");
+            return -1;
+        }
+
+        bool const running = (0 == connect(probe_fd, reinterpret_cast<sockaddr const *>(&address), sizeof(address)));
+        close(probe_fd);
+
+        if (running)
+        {
+            fprintf(stderr, "The daemon is already running: %s\n", socket_path);
+            return -1;
+        }
+
+        unlink(socket_path);
+    }
+
+    int const listen_fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (-1 == listen_fd)
+    {
+        perror("socket");
+        return -1;
+    }
+
+    if ((-1 == bind(listen_fd, reinterpret_cast<sockaddr const *>(&address), sizeof(address))) || (-1 == listen(listen_fd, DECODE_DAEMON_LISTEN_BACKLOG)))
+    {
+        fprintf(stderr, "Failed to listen on the socket: %s (%s)\n", socket_path, strerror(errno));
+        close(listen_fd);
+        return -1;
+    }
+
+    return listen_fd;
+}
+
+static inline void decode_daemon_receive(decode_daemon_context *daemon, decode_daemon_client *client)
+{
+    // all the messages which have arrived are received (unless the client is throttled), and thus the requests of this "ppoll" are batched together
+    while ((-1 != client->socket_fd) && (!decode_daemon_client_throttled(client)))
+    {
+        ntm_decode_message message;
+
+        iovec io_vector;
+        io_vector.iov_base = &message;
+        io_vector.iov_len = sizeof(message);
+
+        union
+        {
+            cmsghdr header;
+            char data[CMSG_SPACE(sizeof(int))];
+        } control;
+
+        msghdr message_header = {};
+        message_header.msg_iov = &io_vector;
+        message_header.msg_iovlen = 1;
+        message_header.msg_control = control.data;
+        message_header.msg_controllen = sizeof(control.data);
+
+        ssize_t const result_recv = recvmsg(client->socket_fd, &message_header, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+        if (-1 == result_recv)
+        {
+            if ((EAGAIN != errno) && (EWOULDBLOCK != errno) && (EINTR != errno))
+            {
+                decode_daemon_disconnect(client);
+            }
+            break;
+        }
+
+        int fd = -1;
+        for (cmsghdr *control_header = CMSG_FIRSTHDR(&message_header); NULL != control_header; control_header = CMSG_NXTHDR(&message_header, control_header))
+        {
+            if ((SOL_SOCKET == control_header->cmsg_level) && (SCM_RIGHTS == control_header->cmsg_type) && (CMSG_LEN(sizeof(int)) == control_header->cmsg_len))
+            {
+                memcpy(&fd, CMSG_DATA(control_header), sizeof(int));
+            }
+        }
+
+        // 0: the client has closed the connection
+        // the message which is NOT valid is regarded as the protocol violation
+        bool const valid = (sizeof(message) == static_cast<size_t>(result_recv)) && (0 == (message_header.msg_flags & (MSG_TRUNC | MSG_CTRUNC))) && (NTM_DECODE_PROTOCOL_VERSION == message.version) && ((NTM_DECODE_MESSAGE_MAP_BUFFER == message.type) == (-1 != fd));
+        if (!valid)
+        {
+            if (-1 != fd)
+            {
+                close(fd);
+            }
+
+            decode_daemon_disconnect(client);
+            break;
+        }
+
+        switch (message.type)
+        {
+        case NTM_DECODE_MESSAGE_MAP_BUFFER:
+        {
+            decode_daemon_map_buffer(client, &message, fd);
+        }
+        break;
+        case NTM_DECODE_MESSAGE_UNMAP_BUFFER:
+        {
+            decode_daemon_unmap_buffer(client, message.buffer_id);
+        }
+        break;
+        case NTM_DECODE_MESSAGE_DECODE:
+        {
+            decode_daemon_decode(daemon, client, &message);
+        }
+        break;
+        default:
+        {
+            decode_daemon_disconnect(client);
+        }
+        }
+    }
+}
+
+static inline void decode_daemon_map_buffer(decode_daemon_client *client, ntm_decode_message const *message, int fd)
+{
+    // The buffer which can NOT be mapped is NOT added, and thus the requests which write into it are completed with the "UNKNOWN_BUFFER".
+    bool duplicated = false;
+    for (decode_daemon_buffer const *const buffer : client->buffers)
+    {
+        duplicated = duplicated || ((!buffer->unmapped) && (message->buffer_id == buffer->buffer_id));
+    }
+
+    // The client can NOT shrink the sealed memfd, and thus the daemon is never killed by the SIGBUS.
+    int const seals = fcntl(fd, F_GET_SEALS);
+    struct stat file_status;
+    bool const valid = (!duplicated) && (message->buffer_size >= 1U) && (message->buffer_size <= SIZE_MAX) && (-1 != seals) && (0 != (seals & F_SEAL_SHRINK)) && (0 == fstat(fd, &file_status)) && (static_cast<uint64_t>(file_status.st_size) >= message->buffer_size);
+
+    void *const memory = valid ? mmap(NULL, static_cast<size_t>(message->buffer_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+
+    // the mapping holds its own reference
+    close(fd);
+
+    if (MAP_FAILED == memory)
+    {
+        return;
+    }
+
+    decode_daemon_buffer *buffer = new (std::nothrow) decode_daemon_buffer;
+    if (NULL == buffer)
+    {
+        munmap(memory, static_cast<size_t>(message->buffer_size));
+        return;
+    }
+
+    buffer->buffer_id = message->buffer_id;
+    buffer->memory = memory;
+    buffer->size = static_cast<size_t>(message->buffer_size);
+    buffer->num_pending_requests = 0U;
+    buffer->unmapped = false;
+    client->buffers.push_back(buffer);
+}
+
+static inline void decode_daemon_unmap_buffer(decode_daemon_client *client, uint32_t buffer_id)
+{
+    for (decode_daemon_buffer *const buffer : client->buffers)
+    {
+        if ((!buffer->unmapped) && (buffer_id == buffer->buffer_id))
+        {
+            buffer->unmapped = true;
+            decode_daemon_release_buffer(client, buffer);
+            return;
+        }
+    }
+}
+
+static inline void decode_daemon_decode(decode_daemon_context *daemon, decode_daemon_client *client, ntm_decode_message const *message)
+{
+    ntm_cpu_engine const *const engine = (NULL != memchr(message->texture_name, '\0', NTM_DECODE_MAX_NAME_SIZE)) ? decode_daemon_find_engine(daemon, message->texture_name) : NULL;
+    if (NULL == engine)
+    {
+        decode_daemon_complete(client, message->request_id, NTM_DECODE_STATUS_UNKNOWN_TEXTURE);
+        return;
+    }
+
+    // the resolution of the mip level
+    uint32_t const level_width = ((message->mip_level < 32U) && (message->width >= 1U)) ? ((message->width >> message->mip_level) > 1U ? (message->width >> message->mip_level) : 1U) : 0U;
+    uint32_t const level_height = ((message->mip_level < 32U) && (message->height >= 1U)) ? ((message->height >> message->mip_level) > 1U ? (message->height >> message->mip_level) : 1U) : 0U;
+    if ((0U == level_width) || (0U == level_height) || (message->region_width < 1U) || (message->region_height < 1U) || (message->region_x >= level_width) || (message->region_width > (level_width - message->region_x)) || (message->region_y >= level_height) || (message->region_height > (level_height - message->region_y)))
+    {
+        decode_daemon_complete(client, message->request_id, NTM_DECODE_STATUS_INVALID_REGION);
+        return;
+    }
+
+    if ((message->pixel_format > static_cast<uint32_t>(NTM_PIXEL_FORMAT_R16G16B16A16_SFLOAT)) || (message->linear_to_srgb > 1U))
+    {
+        decode_daemon_complete(client, message->request_id, NTM_DECODE_STATUS_INVALID_FORMAT);
+        return;
+    }
+
+    decode_daemon_buffer *buffer = NULL;
+    for (decode_daemon_buffer *const client_buffer : client->buffers)
+    {
+        if ((!client_buffer->unmapped) && (message->buffer_id == client_buffer->buffer_id))
+        {
+            buffer = client_buffer;
+            break;
+        }
+    }
+
+    if (NULL == buffer)
+    {
+        decode_daemon_complete(client, message->request_id, NTM_DECODE_STATUS_UNKNOWN_BUFFER);
+        return;
+    }
+
+    ntm_pixel_encoding encoding;
+    encoding.format = static_cast<ntm_pixel_format>(message->pixel_format);
+    encoding.linear_to_srgb = (0U != message->linear_to_srgb);
+
+    // [buffer_offset, buffer_offset + row_pitch * (region_height - 1) + pixel_size * region_width) is within the buffer (without the overflow)
+    uint64_t const pixel_size = ntm_pixel_format_size(encoding.format);
+    uint64_t const row_size = pixel_size * message->region_width;
+    uint64_t const buffer_size = buffer->size;
+    bool const aligned = (0U == (message->buffer_offset % pixel_size)) && (0U == (message->row_pitch % pixel_size));
+    bool const pitch_valid = (message->row_pitch >= row_size) && ((message->region_height < 2U) || (message->row_pitch <= ((buffer_size - row_size) / (message->region_height - 1U))));
+    if ((!aligned) || (row_size > buffer_size) || (!pitch_valid) || (message->buffer_offset > (buffer_size - row_size - message->row_pitch * (message->region_height - 1U))))
+    {
+        decode_daemon_complete(client, message->request_id, NTM_DECODE_STATUS_OUT_OF_BUFFER);
+        return;
+    }
+
+    decode_daemon_request *request_data = new (std::nothrow) decode_daemon_request;
+    if (NULL == request_data)
+    {
+        decode_daemon_disconnect(client);
+        return;
+    }
+
+    request_data->daemon = daemon;
+    request_data->client = client;
+    request_data->buffer = buffer;
+    request_data->request_id = message->request_id;
+
+    ++buffer->num_pending_requests;
+    ++client->num_pending_requests;
+    ++daemon->num_pending_requests;
+
+    ntm_decode_request request;
+    request.engine = engine;
+    request.texture_width = level_width;
+    request.texture_height = level_height;
+    request.x = message->region_x;
+    request.y = message->region_y;
+    request.width = message->region_width;
+    request.height = message->region_height;
+    request.encoding = encoding;
+    request.out_pixels = static_cast<uint8_t *>(buffer->memory) + static_cast<size_t>(message->buffer_offset);
+    request.out_row_pitch = static_cast<size_t>(message->row_pitch);
+    request.priority = message->priority;
+    request.deadline = (0U != message->deadline_microseconds) ? (ntm_decode_scheduler_now() + static_cast<uint64_t>(message->deadline_microseconds) * 1000U) : 0U;
+    request.callback = decode_daemon_request_callback;
+    request.user_data = request_data;
+    ntm_decode_scheduler_submit(daemon->scheduler, &request);
+}
+
+static inline ntm_cpu_engine const *decode_daemon_find_engine(decode_daemon_context *daemon, char const *name)
+{
+    for (decode_daemon_texture const *const texture : daemon->textures)
+    {
+        if (texture->name == name)
+        {
+            return &texture->engine;
+        }
+    }
+
+    // The engine is initialized at the first request of the texture, and thus the pages of the other textures of the pack are never touched.
+    ntm_model model;
+    if (!ntm_pack_find(daemon->pack, name, &model))
+    {
+        return NULL;
+    }
+
+    decode_daemon_texture *texture = new (std::nothrow) decode_daemon_texture;
+    if (NULL == texture)
+    {
+        return NULL;
+    }
+
+    texture->name = name;
+
+    ntm_cpu_engine_init(&texture->engine, &model, daemon->options->cpu_isa);
+
+    if (0 != daemon->options->lod_base_width)
+    {
+        ntm_cpu_engine_enable_lod(&texture->engine, static_cast<uint32_t>(daemon->options->lod_base_width), static_cast<uint32_t>(daemon->options->lod_base_height));
+    }
+
+    if (daemon->options->sparse)
+    {
+        ntm_cpu_engine_enable_sparsity(&texture->engine);
+    }
+
+    daemon->textures.push_back(texture);
+
+    return &texture->engine;
+}
+
+static inline void decode_daemon_complete(decode_daemon_client *client, uint32_t request_id, ntm_decode_status status)
+{
+    if (-1 == client->socket_fd)
+    {
+        return;
+    }
+
+    ntm_decode_message message = {};
+    message.version = NTM_DECODE_PROTOCOL_VERSION;
+    message.type = NTM_DECODE_MESSAGE_COMPLETE;
+    message.request_id = request_id;
+    message.status = status;
+
+    // sent after the dispatch (or at the next "POLLOUT")
+    client->outgoing_messages.push_back(message);
+}
+
+static void decode_daemon_request_callback(void *user_data)
+{
+    // invoked by the thread of the "ntm_decode_scheduler_dispatch", namely, the thread of the "ppoll"
+    decode_daemon_request *const request_data = static_cast<decode_daemon_request *>(user_data);
+
+    assert(request_data->buffer->num_pending_requests > 0U);
+    assert(request_data->client->num_pending_requests > 0U);
+    assert(request_data->daemon->num_pending_requests > 0U);
+    --request_data->buffer->num_pending_requests;
+    --request_data->client->num_pending_requests;
+    --request_data->daemon->num_pending_requests;
+
+    decode_daemon_complete(request_data->client, request_data->request_id, NTM_DECODE_STATUS_SUCCESS);
+
+    decode_daemon_release_buffer(request_data->client, request_data->buffer);
+
+    delete request_data;
+}
+
+static inline void decode_daemon_release_buffer(decode_daemon_client *client, decode_daemon_buffer *buffer)
+{
+    if (buffer->unmapped && (0U == buffer->num_pending_requests))
+    {
+        for (size_t buffer_index = 0U; buffer_index < client->buffers.size(); ++buffer_index)
+        {
+            if (buffer == client->buffers[buffer_index])
+            {
+                client->buffers.erase(client->buffers.begin() + buffer_index);
+                break;
+            }
+        }
+
+        munmap(buffer->memory, buffer->size);
+        delete buffer;
+    }
+}
+
+static inline void decode_daemon_flush(decode_daemon_client *client)
+{
+    assert(-1 != client->socket_fd);
+
+    size_t num_sent_messages = 0U;
+    while (num_sent_messages < client->outgoing_messages.size())
+    {
+        ssize_t const result_send = send(client->socket_fd, &client->outgoing_messages[num_sent_messages], sizeof(ntm_decode_message), MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (-1 == result_send)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
+            {
+                // e.g. EPIPE
+                decode_daemon_disconnect(client);
+                return;
+            }
+
+            break;
+        }
+
+        assert(sizeof(ntm_decode_message) == static_cast<size_t>(result_send));
+        ++num_sent_messages;
+    }
+
+    client->outgoing_messages.erase(client->outgoing_messages.begin(), client->outgoing_messages.begin() + num_sent_messages);
+}
+
+static inline void decode_daemon_disconnect(decode_daemon_client *client)
+{
+    assert(-1 != client->socket_fd);
+
+    // The pending requests still write into the buffers (which are still mapped by the daemon), and the client is destroyed after these requests have been completed.
+    close(client->socket_fd);
+    client->socket_fd = -1;
+    client->outgoing_messages.clear();
+}
+
+static inline bool decode_daemon_client_throttled(decode_daemon_client const *client)
+{
+    // each message received may add one pending request (or one completion)
+    return ((static_cast<size_t>(client->num_pending_requests) + client->outgoing_messages.size()) >= DECODE_DAEMON_MAX_CLIENT_MESSAGES);
+}
@@ -0,0 +1,11 @@
+#ifndef _INFERENCE_DECODE_DAEMON_H_
+#define _INFERENCE_DECODE_DAEMON_H_ 1
+
+#include "inference-options.h"
+
+// The local decode service: the processes on the same machine ("ntm-decode-client.h") connect to the Unix domain socket, and request the regions of the textures of the pack.
+// The decoded pixels are written into the buffers shared by the clients (memfd), and the concurrent requests of all the clients are batched onto one worker pool (the "ntm_decode_scheduler").
+// Runs until the SIGINT or the SIGTERM.
+extern int decode_daemon(inference_options const *options);
+
+#endif
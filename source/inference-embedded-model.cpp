@@ -0,0 +1,16 @@
+#include "inference-embedded-model.h"
+
+// NOTE: the memory of the "model_data" must remain valid as long as the "TfLiteModel" is still in use.
+static uint8_t const tflite_model_data[] = {
+#include "neural-texture-mapping.inl"
+};
+
+extern uint8_t const *inference_embedded_tflite_model_data()
+{
+    return tflite_model_data;
+}
+
+extern size_t inference_embedded_tflite_model_size()
+{
+    return sizeof(tflite_model_data);
+}
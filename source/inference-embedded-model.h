@@ -0,0 +1,13 @@
+#ifndef _INFERENCE_EMBEDDED_MODEL_H_
+#define _INFERENCE_EMBEDDED_MODEL_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The TFLite model compiled into the executable ("neural-texture-mapping.inl"), which is used when the "--tflite" is NOT specified.
+// The "neural-texture-mapping.inl" is merely included by this translation unit, and thus the other translation units are NOT recompiled when the model changes.
+extern uint8_t const *inference_embedded_tflite_model_data();
+
+extern size_t inference_embedded_tflite_model_size();
+
+#endif
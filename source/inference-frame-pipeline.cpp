@@ -0,0 +1,316 @@
+#include "inference-frame-pipeline.h"
+#include "ntm-profiler.h"
+#include <assert.h>
+#include <stdio.h>
+#include <new>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+struct inference_frame_pipeline_slot
+{
+    uint8_t (*bit_RGBs)[4];
+    // written by the decode thread before the "decoded_count" is published
+    std::chrono::steady_clock::time_point decode_begin;
+    double decode_time;
+    // merely accessed by the presentation thread
+    bool released;
+};
+
+struct inference_frame_pipeline
+{
+    // merely accessed by the decode thread after created
+    inference_predictor *predictor;
+    inference_model_reloader *reloader;
+    int texture_width;
+    int texture_height;
+    // TILED or MORTON: the decode thread decodes into the "swizzled_texels" and then deswizzles into the buffer
+    ntm_layout layout;
+    std::vector<uint8_t[4]> swizzled_texels;
+    int depth;
+    inference_frame_pipeline_slot slots[INFERENCE_MAX_PIPELINE_DEPTH];
+
+    // The frame i is decoded into the slot (i % depth).
+    // written by the decode thread
+    alignas(64) std::atomic<uint64_t> decoded_count;
+    // written by the presentation thread: the frames [0, released_count) have been released
+    alignas(64) std::atomic<uint64_t> released_count;
+    std::atomic<bool> quit;
+
+    // merely accessed by the presentation thread
+    alignas(64) uint64_t acquired_count;
+    // the first frame after the "inference_frame_pipeline_resize" has NOT been acquired
+    bool resize_pending;
+    std::chrono::steady_clock::time_point resize_begin;
+    inference_frame_pipeline_statistics statistics;
+    double total_decode_time;
+    double total_latency;
+    double total_wait_time;
+    double total_resize_latency;
+
+    std::thread decode_thread;
+};
+
+static void inference_frame_pipeline_decode_main(inference_frame_pipeline *pipeline);
+
+static inline void inference_frame_pipeline_start(inference_frame_pipeline *pipeline, int texture_width, int texture_height, uint8_t (*const *buffers)[4]);
+
+static inline void inference_frame_pipeline_reserve(inference_frame_pipeline *pipeline);
+
+static inline void inference_frame_pipeline_backoff(uint32_t *spin_count);
+
+extern inference_frame_pipeline *inference_frame_pipeline_create(inference_predictor *predictor, inference_model_reloader *reloader, int texture_width, int texture_height, ntm_layout layout, int depth, uint8_t (*const *buffers)[4])
+{
+    assert((depth >= 1) && (depth <= INFERENCE_MAX_PIPELINE_DEPTH));
+
+    inference_frame_pipeline *pipeline = new (std::nothrow) inference_frame_pipeline;
+    if (NULL == pipeline)
+    {
+        return NULL;
+    }
+
+    pipeline->predictor = predictor;
+    pipeline->reloader = reloader;
+    pipeline->layout = layout;
+    pipeline->depth = depth;
+
+    pipeline->resize_pending = false;
+    pipeline->statistics.num_frames = 0U;
+    pipeline->statistics.mean_decode_time = 0.0;
+    pipeline->statistics.mean_latency = 0.0;
+    pipeline->statistics.max_latency = 0.0;
+    pipeline->statistics.mean_wait_time = 0.0;
+    pipeline->statistics.num_resizes = 0U;
+    pipeline->statistics.mean_resize_latency = 0.0;
+    pipeline->statistics.max_resize_latency = 0.0;
+    pipeline->total_decode_time = 0.0;
+    pipeline->total_latency = 0.0;
+    pipeline->total_wait_time = 0.0;
+    pipeline->total_resize_latency = 0.0;
+
+    inference_frame_pipeline_start(pipeline, texture_width, texture_height, buffers);
+
+    return pipeline;
+}
+
+extern void inference_frame_pipeline_destroy(inference_frame_pipeline *pipeline)
+{
+    pipeline->quit.store(true, std::memory_order_release);
+
+    pipeline->decode_thread.join();
+
+    delete pipeline;
+}
+
+extern bool inference_frame_pipeline_acquire(inference_frame_pipeline *pipeline, inference_frame *out_frame)
+{
+    uint64_t const acquired_count = pipeline->acquired_count;
+
+    // the "released_count" is merely written by this thread
+    if ((acquired_count - pipeline->released_count.load(std::memory_order_relaxed)) >= static_cast<uint64_t>(pipeline->depth))
+    {
+        return false;
+    }
+
+    std::chrono::steady_clock::time_point const wait_begin = std::chrono::steady_clock::now();
+
+    uint32_t spin_count = 0U;
+    while (pipeline->decoded_count.load(std::memory_order_acquire) <= acquired_count)
+    {
+        inference_frame_pipeline_backoff(&spin_count);
+    }
+
+    std::chrono::steady_clock::time_point const wait_end = std::chrono::steady_clock::now();
+
+    int const slot_index = static_cast<int>(acquired_count % static_cast<uint64_t>(pipeline->depth));
+    inference_frame_pipeline_slot const *const slot = &pipeline->slots[slot_index];
+
+    out_frame->index = slot_index;
+    out_frame->bit_RGBs = slot->bit_RGBs;
+    out_frame->decode_time = slot->decode_time;
+    out_frame->latency = std::chrono::duration<double, std::milli>(wait_end - slot->decode_begin).count();
+    out_frame->resize_latency = -1.0;
+
+    pipeline->acquired_count = acquired_count + 1U;
+
+    if (pipeline->resize_pending)
+    {
+        pipeline->resize_pending = false;
+
+        out_frame->resize_latency = std::chrono::duration<double, std::milli>(wait_end - pipeline->resize_begin).count();
+
+        ++pipeline->statistics.num_resizes;
+        pipeline->total_resize_latency += out_frame->resize_latency;
+        pipeline->statistics.mean_resize_latency = pipeline->total_resize_latency / static_cast<double>(pipeline->statistics.num_resizes);
+        if (out_frame->resize_latency > pipeline->statistics.max_resize_latency)
+        {
+            pipeline->statistics.max_resize_latency = out_frame->resize_latency;
+        }
+    }
+
+    double const wait_time = std::chrono::duration<double, std::milli>(wait_end - wait_begin).count();
+
+    ++pipeline->statistics.num_frames;
+    pipeline->total_decode_time += out_frame->decode_time;
+    pipeline->total_latency += out_frame->latency;
+    pipeline->total_wait_time += wait_time;
+    pipeline->statistics.mean_decode_time = pipeline->total_decode_time / static_cast<double>(pipeline->statistics.num_frames);
+    pipeline->statistics.mean_latency = pipeline->total_latency / static_cast<double>(pipeline->statistics.num_frames);
+    pipeline->statistics.mean_wait_time = pipeline->total_wait_time / static_cast<double>(pipeline->statistics.num_frames);
+    if (out_frame->latency > pipeline->statistics.max_latency)
+    {
+        pipeline->statistics.max_latency = out_frame->latency;
+    }
+
+    return true;
+}
+
+extern void inference_frame_pipeline_release(inference_frame_pipeline *pipeline, int index)
+{
+    assert((index >= 0) && (index < pipeline->depth));
+    assert(!pipeline->slots[index].released);
+
+    pipeline->slots[index].released = true;
+
+    // the slots are decoded in order, and thus the "released_count" merely advances over the released frames which are contiguous
+    uint64_t released_count = pipeline->released_count.load(std::memory_order_relaxed);
+    while (released_count < pipeline->acquired_count)
+    {
+        inference_frame_pipeline_slot *const slot = &pipeline->slots[released_count % static_cast<uint64_t>(pipeline->depth)];
+        if (!slot->released)
+        {
+            break;
+        }
+
+        slot->released = false;
+        ++released_count;
+    }
+
+    pipeline->released_count.store(released_count, std::memory_order_release);
+}
+
+extern void inference_frame_pipeline_resize(inference_frame_pipeline *pipeline, int texture_width, int texture_height, uint8_t (*const *buffers)[4])
+{
+    // the wait for the current frame is a part of the resize latency
+    pipeline->resize_begin = std::chrono::steady_clock::now();
+    pipeline->resize_pending = true;
+
+    pipeline->quit.store(true, std::memory_order_release);
+
+    pipeline->decode_thread.join();
+
+    inference_frame_pipeline_start(pipeline, texture_width, texture_height, buffers);
+}
+
+extern void inference_frame_pipeline_get_statistics(inference_frame_pipeline const *pipeline, inference_frame_pipeline_statistics *out_statistics)
+{
+    (*out_statistics) = pipeline->statistics;
+}
+
+static void inference_frame_pipeline_decode_main(inference_frame_pipeline *pipeline)
+{
+    uint64_t decoded_count = 0U;
+
+    // the predictor may be of the previous size (or the size of the creation)
+    inference_frame_pipeline_reserve(pipeline);
+
+    uint32_t spin_count = 0U;
+    while (!pipeline->quit.load(std::memory_order_acquire))
+    {
+        // all the buffers are still being presented
+        if ((decoded_count - pipeline->released_count.load(std::memory_order_acquire)) >= static_cast<uint64_t>(pipeline->depth))
+        {
+            inference_frame_pipeline_backoff(&spin_count);
+            continue;
+        }
+
+        spin_count = 0U;
+
+        inference_frame_pipeline_slot *const slot = &pipeline->slots[decoded_count % static_cast<uint64_t>(pipeline->depth)];
+
+        // between the frames
+        if (NULL != pipeline->reloader)
+        {
+            inference_predictor *const predictor = inference_model_reloader_update(pipeline->reloader, pipeline->predictor);
+
+            // the predictor of the reloaded model is created at the size of the "inference_model_reloader_create"
+            if (predictor != pipeline->predictor)
+            {
+                pipeline->predictor = predictor;
+                inference_frame_pipeline_reserve(pipeline);
+            }
+        }
+
+        std::chrono::steady_clock::time_point const decode_begin = std::chrono::steady_clock::now();
+
+        if (NTM_LAYOUT_LINEAR == pipeline->layout)
+        {
+            predict(slot->bit_RGBs, pipeline->texture_width, pipeline->texture_height, pipeline->predictor);
+        }
+        else
+        {
+            predict_layout(&pipeline->swizzled_texels[0], pipeline->texture_width, pipeline->texture_height, pipeline->layout, pipeline->predictor);
+
+            uint64_t const deswizzle_begin = ntm_profiler_now();
+
+            ntm_layout_deswizzle(pipeline->layout, static_cast<uint32_t>(pipeline->texture_width), static_cast<uint32_t>(pipeline->texture_height), &pipeline->swizzled_texels[0], slot->bit_RGBs, sizeof(uint8_t[4]) * static_cast<size_t>(pipeline->texture_width));
+
+            ntm_profiler_record(NTM_PROFILER_STAGE_DESWIZZLE, deswizzle_begin, ntm_profiler_now());
+        }
+
+        std::chrono::steady_clock::time_point const decode_end = std::chrono::steady_clock::now();
+
+        slot->decode_begin = decode_begin;
+        slot->decode_time = std::chrono::duration<double, std::milli>(decode_end - decode_begin).count();
+
+        ++decoded_count;
+        pipeline->decoded_count.store(decoded_count, std::memory_order_release);
+    }
+}
+
+static inline void inference_frame_pipeline_start(inference_frame_pipeline *pipeline, int texture_width, int texture_height, uint8_t (*const *buffers)[4])
+{
+    pipeline->texture_width = texture_width;
+    pipeline->texture_height = texture_height;
+    if (NTM_LAYOUT_LINEAR != pipeline->layout)
+    {
+        pipeline->swizzled_texels = std::vector<uint8_t[4]>(ntm_layout_get_size(pipeline->layout, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height)));
+    }
+    for (int slot_index = 0; slot_index < pipeline->depth; ++slot_index)
+    {
+        pipeline->slots[slot_index].bit_RGBs = buffers[slot_index];
+        pipeline->slots[slot_index].decode_time = 0.0;
+        pipeline->slots[slot_index].released = false;
+    }
+
+    pipeline->decoded_count.store(0U, std::memory_order_relaxed);
+    pipeline->released_count.store(0U, std::memory_order_relaxed);
+    pipeline->quit.store(false, std::memory_order_relaxed);
+
+    pipeline->acquired_count = 0U;
+
+    pipeline->decode_thread = std::thread(inference_frame_pipeline_decode_main, pipeline);
+}
+
+static inline void inference_frame_pipeline_reserve(inference_frame_pipeline *pipeline)
+{
+    if (!inference_predictor_reserve(pipeline->predictor, pipeline->texture_width, pipeline->texture_height))
+    {
+        fprintf(stderr, "Failed to resize the predictor to %dx%d, the tiles of the previous size are used\n", pipeline->texture_width, pipeline->texture_height);
+    }
+}
+
+static inline void inference_frame_pipeline_backoff(uint32_t *spin_count)
+{
+    // the wait is usually short (the other thread is finishing the frame), and the sleep bounds the CPU time of the longer wait (e.g. the window is minimized)
+    if ((*spin_count) < 64U)
+    {
+        ++(*spin_count);
+        std::this_thread::yield();
+    }
+    else
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
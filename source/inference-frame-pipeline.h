@@ -0,0 +1,66 @@
+#ifndef _INFERENCE_FRAME_PIPELINE_H_
+#define _INFERENCE_FRAME_PIPELINE_H_ 1
+
+#include "inference-predictor.h"
+#include "inference-model-reloader.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// The decode thread decodes the frames into the "depth" buffers in turn, while the presentation thread (the event loop) presents the decoded frames in order.
+// Thus, the decode of the frame N+1 overlaps the presentation of the frame N, and the frame time is close to max(decode, present) instead of the sum.
+// The handoff is lock-free (single producer and single consumer), and the buffer is NOT decoded again until it has been released by the presentation thread.
+struct inference_frame_pipeline;
+
+struct inference_frame
+{
+    // the index of the buffer: [0, depth)
+    int index;
+    uint8_t (*bit_RGBs)[4];
+    // milliseconds
+    double decode_time;
+    // milliseconds: from the beginning of the decode to the handoff to the presentation thread
+    double latency;
+    // milliseconds: from the "inference_frame_pipeline_resize" to the handoff (merely the first frame of the new size, otherwise negative)
+    double resize_latency;
+};
+
+struct inference_frame_pipeline_statistics
+{
+    uint64_t num_frames;
+    // milliseconds
+    double mean_decode_time;
+    double mean_latency;
+    double max_latency;
+    // milliseconds: the time which the presentation thread waited for the decode thread
+    double mean_wait_time;
+    uint64_t num_resizes;
+    // milliseconds: the "resize_latency" of the frames
+    double mean_resize_latency;
+    double max_resize_latency;
+};
+
+// Each of the "buffers" is [texture_height][texture_width], and the decode thread starts immediately.
+// TILED or MORTON: the texture is decoded in the "layout" and deswizzled into the buffer (the decode time includes the deswizzle).
+// The "reloader" (may be NULL) swaps in the predictor of the reloaded model before each frame.
+// The decode thread reserves the predictor ("inference_predictor_reserve") for the resolution, and thus the predictor may be created for another resolution.
+extern inference_frame_pipeline *inference_frame_pipeline_create(inference_predictor *predictor, inference_model_reloader *reloader, int texture_width, int texture_height, ntm_layout layout, int depth, uint8_t (*const *buffers)[4]);
+
+// Waits for the decode of the current frame.
+extern void inference_frame_pipeline_destroy(inference_frame_pipeline *pipeline);
+
+// The following functions are merely called by the presentation thread.
+
+// Waits for the next decoded frame.
+// false: all the buffers have been acquired and NOT released, namely, no frame can be decoded until the next "inference_frame_pipeline_release"
+extern bool inference_frame_pipeline_acquire(inference_frame_pipeline *pipeline, inference_frame *out_frame);
+
+// The buffers may be released in any order (e.g. by the "IdleNotify" of the X server).
+extern void inference_frame_pipeline_release(inference_frame_pipeline *pipeline, int index);
+
+// Waits for the decode of the current frame, and then the decode thread restarts with the new "buffers" ([texture_height][texture_width]).
+// The frames which have NOT been released are dropped (the buffers of the previous size are no longer used), while the predictor (may be reloaded) and the statistics are kept.
+extern void inference_frame_pipeline_resize(inference_frame_pipeline *pipeline, int texture_width, int texture_height, uint8_t (*const *buffers)[4]);
+
+extern void inference_frame_pipeline_get_statistics(inference_frame_pipeline const *pipeline, inference_frame_pipeline_statistics *out_statistics);
+
+#endif
@@ -1,8 +1,26 @@
 #include <tensorflow/lite/c/c_api.h>
-#include <tensorflow/lite/delegates/gpu/delegate.h>
+#include "ntm-cpu-inference.h"
+#include "ntm-pack.h"
+#include "ntm-profiler.h"
+#include "ntm-file.h"
+#include "inference-options.h"
+#include "inference-predictor.h"
+#include "inference-autotune.h"
+#include "inference-embedded-model.h"
+#include "inference-model-reloader.h"
+#include "inference-benchmark.h"
+#include "inference-regression.h"
+#include "inference-sparsity.h"
+#include "inference-baker.h"
+#include "inference-frame-pipeline.h"
+#include "inference-decode-daemon.h"
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <stdlib.h>
 #include <vector>
+#include <string>
 #include <assert.h>
 #include <stdio.h>
 
@@ -11,6 +29,8 @@
 #include <xcb/xcb.h>
 #include <xcb/present.h>
 #include <time.h>
+#include <signal.h>
+#include "inference-shm-presenter.h"
 #elif defined(_MSC_VER)
 // https://docs.microsoft.com/en-us/cpp/preprocessor/predefined-macros
 #include <sdkddkver.h>
@@ -23,11 +43,18 @@
 #error Unknown Compiler
 #endif
 
+static inline bool write_profile(inference_options const *options);
+
 static inline void tflite_error_reporter(void *, const char *format, va_list args);
 
-static inline void tflite_predict(uint8_t (*out_bit_RGBs)[4], int texture_width, int texture_height, TfLiteInterpreter *tflite_interpreter, float *tflite_input, float *tflite_output);
+static inline int validate(int texture_width, int texture_height, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine);
 
 #if defined(__GNUC__)
+// SIGUSR1: the profile is written at the next frame
+static volatile sig_atomic_t profile_requested = 0;
+
+static void profile_signal_handler(int);
+
 int main(int argc, char *argv[], char *envp[])
 #elif defined(_MSC_VER)
 struct window_data
@@ -37,12 +64,12 @@ struct window_data
     HDC device_context;
     HDC memory_device_context;
     HBITMAP bitmap;
-    uint8_t (*bit_RGBs)[4];
     double performance_frequency;
     double performance_count;
-    TfLiteInterpreter *tflite_interpreter;
-    float *tflite_input;
-    float *tflite_output;
+    inference_frame_pipeline *pipeline;
+    // the buffers of the "pipeline" (replaced by the "WM_SIZE")
+    std::vector<uint8_t[4]> *frame_buffers;
+    int pipeline_depth;
 };
 
 static LRESULT CALLBACK WindowProcedure(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
@@ -54,60 +81,300 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
 #error Unknown Compiler
 #endif
 {
+    // Options
+    inference_options options;
+#if defined(__GNUC__)
+    if (!parse_options(argc, argv, &options))
+    {
+        return 1;
+    }
+#elif defined(_MSC_VER)
+    // NOTE: the "model_path" of the "options" references the "utf8_arguments"
+    std::vector<std::string> utf8_arguments(static_cast<size_t>(argc));
+    std::vector<char *> utf8_argv(static_cast<size_t>(argc) + 1U, NULL);
+    for (int argument_index = 0; argument_index < argc; ++argument_index)
+    {
+        int utf8_argument_size = WideCharToMultiByte(CP_UTF8, 0U, argv[argument_index], -1, NULL, 0, NULL, NULL);
+        assert(utf8_argument_size > 0);
+
+        utf8_arguments[argument_index].resize(static_cast<size_t>(utf8_argument_size));
+
+        int result_wide_char_to_multi_byte = WideCharToMultiByte(CP_UTF8, 0U, argv[argument_index], -1, &utf8_arguments[argument_index][0], utf8_argument_size, NULL, NULL);
+        assert(utf8_argument_size == result_wide_char_to_multi_byte);
+
+        utf8_argv[argument_index] = &utf8_arguments[argument_index][0];
+    }
+
+    if (!parse_options(argc, &utf8_argv[0], &options))
+    {
+        return 1;
+    }
+#else
+#error Unknown Compiler
+#endif
+
+    if ((NULL != options.profile_path) || (NULL != options.trace_path))
+    {
+        ntm_profiler_enable(NULL != options.trace_path);
+    }
+
+    // The daemon neither uses the TFLite model nor creates the window.
+    if (NULL != options.daemon_socket_path)
+    {
+#if defined(__GNUC__)
+        int result_daemon = decode_daemon(&options);
+
+        if (!write_profile(&options))
+        {
+            result_daemon = 1;
+        }
+
+        return result_daemon;
+#elif defined(_MSC_VER)
+        fprintf(stderr, "The daemon is merely supported on Linux\n");
+        return 1;
+#else
+#error Unknown Compiler
+#endif
+    }
+
     // Data
-    constexpr int const texture_width = 512;
-    constexpr int const texture_height = 512;
+    // the initial size of the window, and the texture is decoded at the size of the window after resized
+    int texture_width = 512;
+    int texture_height = 512;
 
     // Model
-    TfLiteModel *tflite_model = NULL;
+    // NOTE: the memory of the "tflite_model_data" must remain valid as long as the "TfLiteModel" is still in use.
+    std::vector<uint8_t> tflite_data;
+    uint8_t const *tflite_model_data = inference_embedded_tflite_model_data();
+    size_t tflite_model_size = inference_embedded_tflite_model_size();
+    if (NULL != options.tflite_path)
     {
-        // NOTE: the memory of the "model_data" must remain valid as long as the "TfLiteModel" is still in use.
-        // We use "static" keyword for convenience
-        static uint8_t tflite_model_data[] = {
-#include "neural-texture-mapping.inl"
-        };
+        if (!ntm_read_file(options.tflite_path, tflite_data))
+        {
+            fprintf(stderr, "Failed to read the TFLite model: %s\n", options.tflite_path);
+            return 1;
+        }
 
-        tflite_model = TfLiteModelCreateWithErrorReporter(tflite_model_data, sizeof(tflite_model_data), tflite_error_reporter, NULL);
+        tflite_model_data = &tflite_data[0];
+        tflite_model_size = tflite_data.size();
     }
-    assert(tflite_model);
 
-    TfLiteDelegate *tflite_delegate = NULL;
+    TfLiteModel *tflite_model = TfLiteModelCreateWithErrorReporter(tflite_model_data, tflite_model_size, tflite_error_reporter, NULL);
+    if (NULL == tflite_model)
     {
-        TfLiteGpuDelegateOptionsV2 tflite_delegate_options = TfLiteGpuDelegateOptionsV2Default();
-        tflite_delegate_options.experimental_flags = TFLITE_GPU_EXPERIMENTAL_FLAGS_NONE;
+        fprintf(stderr, "Invalid TFLite model: %s\n", (NULL != options.tflite_path) ? options.tflite_path : "neural-texture-mapping.inl");
+        return 1;
+    }
+
+    // NOTE: the memory of the "ntm_data" or the "ntm_pack" must remain valid as long as the "ntm_cpu_engine" is still in use.
+    std::vector<uint8_t> ntm_data;
+    ntm_pack *pack = NULL;
+    ntm_cpu_engine cpu_engine = {};
+    // The CPU engine is merely a candidate of the autotune when the NTM asset (or the NTM pack) is provided.
+    if ((INFERENCE_BACKEND_CPU == options.backend) || options.validate || ((INFERENCE_BACKEND_AUTO == options.backend) && ((NULL != options.model_path) || ((NULL != options.pack_path) && (NULL != options.texture_name)))))
+    {
+        ntm_model model;
+        if (NULL != options.model_path)
+        {
+            if (!ntm_read_file(options.model_path, ntm_data))
+            {
+                fprintf(stderr, "Failed to read the NTM asset: %s\n", options.model_path);
+                TfLiteModelDelete(tflite_model);
+                return 1;
+            }
 
-        tflite_delegate = TfLiteGpuDelegateV2Create(&tflite_delegate_options);
+            if (!ntm_model_parse(&ntm_data[0], ntm_data.size(), &model))
+            {
+                fprintf(stderr, "Invalid NTM asset: %s\n", options.model_path);
+                TfLiteModelDelete(tflite_model);
+                return 1;
+            }
+        }
+        else
+        {
+            pack = ntm_pack_open(options.pack_path);
+            if (NULL == pack)
+            {
+                fprintf(stderr, "Failed to open the NTM pack: %s\n", options.pack_path);
+                TfLiteModelDelete(tflite_model);
+                return 1;
+            }
+
+            if (!ntm_pack_find(pack, options.texture_name, &model))
+            {
+                fprintf(stderr, "Failed to find the texture \"%s\" in the NTM pack: %s\n", options.texture_name, options.pack_path);
+                ntm_pack_close(pack);
+                TfLiteModelDelete(tflite_model);
+                return 1;
+            }
+        }
+
+        ntm_cpu_engine_init(&cpu_engine, &model, options.cpu_isa);
+
+        // NOTE: the stdout is reserved for the report of the benchmark
+        fprintf((options.benchmark || options.regression || options.bake || options.sparsity) ? stderr : stdout, "CPU ISA: %s\n", ntm_cpu_isa_name(cpu_engine.isa));
+
+        if (0 != options.lod_base_width)
+        {
+            ntm_cpu_engine_enable_lod(&cpu_engine, static_cast<uint32_t>(options.lod_base_width), static_cast<uint32_t>(options.lod_base_height));
+
+            fprintf((options.benchmark || options.regression || options.bake || options.sparsity) ? stderr : stdout, "LOD Base: %dx%d\n", options.lod_base_width, options.lod_base_height);
+        }
+
+        if (options.sparse)
+        {
+            ntm_cpu_engine_enable_sparsity(&cpu_engine);
+        }
     }
-    assert(tflite_delegate);
 
-    TfLiteInterpreter *tflite_interpreter = NULL;
+    // The AOT engine does NOT use the NTM asset, since the network is compiled into the executable.
+    ntm_aot_engine aot_engine = {};
+    if ((INFERENCE_BACKEND_AOT == options.backend) || (INFERENCE_BACKEND_AUTO == options.backend))
     {
-        TfLiteInterpreterOptions *tflite_interpreter_options = TfLiteInterpreterOptionsCreate();
-        assert(tflite_interpreter_options);
+        ntm_aot_engine_init(&aot_engine, options.cpu_isa);
 
-        TfLiteInterpreterOptionsAddDelegate(tflite_interpreter_options, tflite_delegate);
+        fprintf((options.benchmark || options.regression || options.bake) ? stderr : stdout, "AOT ISA: %s\n", ntm_cpu_isa_name(aot_engine.isa));
+    }
 
-        tflite_interpreter = TfLiteInterpreterCreate(tflite_model, tflite_interpreter_options);
-        assert(tflite_interpreter);
+    if (options.validate)
+    {
+        int const result_validate = validate(texture_width, texture_height, tflite_model, &cpu_engine);
 
-        TfLiteInterpreterOptionsDelete(tflite_interpreter_options);
+        if (NULL != pack)
+        {
+            ntm_pack_close(pack);
+        }
+
+        TfLiteModelDelete(tflite_model);
+        return result_validate;
     }
 
+    if (options.sparsity)
     {
-        int tflite_input_dims[2] = {texture_width * texture_height, 2};
-        TfLiteStatus tflite_status_resize_input_tensor = TfLiteInterpreterResizeInputTensor(tflite_interpreter, 0, tflite_input_dims, sizeof(tflite_input_dims) / sizeof(tflite_input_dims[0]));
-        assert(kTfLiteOk == tflite_status_resize_input_tensor);
+        int const result_sparsity = sparsity(&options, &cpu_engine);
+
+        if (NULL != pack)
+        {
+            ntm_pack_close(pack);
+        }
+
+        TfLiteModelDelete(tflite_model);
+        return result_sparsity;
     }
 
+    if (INFERENCE_BACKEND_AUTO == options.backend)
     {
-        TfLiteStatus tflite_status_allocate_tensors = TfLiteInterpreterAllocateTensors(tflite_interpreter);
-        assert(kTfLiteOk == tflite_status_allocate_tensors);
+        // The headless modes are calibrated at the first resolution.
+        int const autotune_width = (options.benchmark || options.regression || options.bake) ? options.benchmark_resolutions[0][0] : texture_width;
+        int const autotune_height = (options.benchmark || options.regression || options.bake) ? options.benchmark_resolutions[0][1] : texture_height;
+
+        // The candidates must decode the same texture. When the NTM asset (or the NTM pack) is provided, the TFLite model is merely the same network if the "--tflite" is specified as well, and the AOT engine is merely the same network if the NTM asset is the one which it is compiled from.
+        // Otherwise, the embedded TFLite model is the same network as the AOT engine (while the "--tflite" may NOT be).
+        bool const has_cpu_engine = (NULL != cpu_engine.kernels);
+        TfLiteModel *const autotune_tflite_model = ((!has_cpu_engine) || (NULL != options.tflite_path)) ? tflite_model : NULL;
+        ntm_aot_engine const *const autotune_aot_engine = (has_cpu_engine ? (ntm_model_hash(&cpu_engine.model) == aot_engine.network_hash) : (NULL == options.tflite_path)) ? &aot_engine : NULL;
+
+        inference_backend backend;
+        int num_threads;
+        if (inference_autotune(options.autotune_cache_path, autotune_tflite_model, tflite_model_data, tflite_model_size, has_cpu_engine ? &cpu_engine : NULL, autotune_aot_engine, options.cpu_isa, autotune_width, autotune_height, &backend, &num_threads))
+        {
+            options.backend = backend;
+            // NOTE: the benchmark (and the regression) still measures each of the specified thread counts
+            if (!(options.benchmark || options.regression))
+            {
+                options.threads[0] = num_threads;
+            }
+        }
+        else
+        {
+            options.backend = has_cpu_engine ? INFERENCE_BACKEND_CPU : INFERENCE_BACKEND_TFLITE;
+        }
+
+        fprintf((options.benchmark || options.regression || options.bake) ? stderr : stdout, "Backend: %s (Threads: %d)\n", inference_backend_name(options.backend), options.threads[0]);
     }
 
-    float *tflite_input = TfLiteInterpreterGetInputTensor(tflite_interpreter, 0)->data.f;
-    float *tflite_output = TfLiteInterpreterGetOutputTensor(tflite_interpreter, 0)->data.f;
+    if (options.benchmark)
+    {
+        int result_benchmark = benchmark(&options, tflite_model, &cpu_engine, &aot_engine);
 
-    std::vector<uint8_t[4]> bit_RGBs(static_cast<size_t>(texture_width * texture_height));
+        if (!write_profile(&options))
+        {
+            result_benchmark = 1;
+        }
+
+        if (NULL != pack)
+        {
+            ntm_pack_close(pack);
+        }
+
+        TfLiteModelDelete(tflite_model);
+        return result_benchmark;
+    }
+
+    if (options.regression)
+    {
+        int const result_regression = regression(&options, tflite_model, &cpu_engine, &aot_engine);
+
+        if (NULL != pack)
+        {
+            ntm_pack_close(pack);
+        }
+
+        TfLiteModelDelete(tflite_model);
+        return result_regression;
+    }
+
+    if (options.bake)
+    {
+        int result_bake = bake(&options, tflite_model, &cpu_engine, &aot_engine);
+
+        if (!write_profile(&options))
+        {
+            result_bake = 1;
+        }
+
+        if (NULL != pack)
+        {
+            ntm_pack_close(pack);
+        }
+
+        TfLiteModelDelete(tflite_model);
+        return result_bake;
+    }
+
+    // The delegates decode the whole texture in one invocation, while the others decode the tiles on all workers.
+    // The missing GPU never fails the startup (falls back to the XNNPACK delegate and then the reference interpreter).
+    int tile_width;
+    int tile_height;
+    inference_predictor_get_tile_size(options.backend, texture_width, texture_height, &tile_width, &tile_height);
+
+    inference_predictor *predictor = inference_predictor_create_with_fallback(&options.backend, tflite_model, &cpu_engine, &aot_engine, options.cpu_isa, options.threads[0], tile_width, tile_height);
+    assert(NULL != predictor);
+
+    // The file of the model used by the backend is watched, and the reloaded model is swapped in between the frames.
+    inference_model_reloader *reloader = NULL;
+    {
+        char const *const reload_path = (INFERENCE_BACKEND_CPU == options.backend) ? options.model_path : ((INFERENCE_BACKEND_AOT != options.backend) ? options.tflite_path : NULL);
+        if (NULL != reload_path)
+        {
+            reloader = inference_model_reloader_create(reload_path, options.backend, options.cpu_isa, options.lod_base_width, options.lod_base_height, options.sparse, options.threads[0], tile_width, tile_height);
+            if (NULL != reloader)
+            {
+                printf("Hot Reload: %s\n", reload_path);
+            }
+            else
+            {
+                fprintf(stderr, "Failed to watch the model: %s\n", reload_path);
+            }
+        }
+    }
+
+    // The buffers of the "inference_frame_pipeline" (the pixmaps of the MIT-SHM are used instead when available).
+    size_t frame_buffer_size = static_cast<size_t>(texture_width * texture_height);
+    std::vector<uint8_t[4]> frame_buffers;
+    uint8_t(*frame_buffer_pointers[INFERENCE_MAX_PIPELINE_DEPTH])[4] = {};
+    inference_frame_pipeline *pipeline = NULL;
 
 #if defined(__GNUC__)
     xcb_connection_t *connection = NULL;
@@ -184,7 +451,7 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
         // Both "border pixel" and "colormap" are required when the depth is NOT equal to the root window's.
         uint32_t value_mask = XCB_CW_BACK_PIXEL | XCB_CW_BORDER_PIXEL | XCB_CW_BACKING_STORE | XCB_CW_EVENT_MASK | XCB_CW_COLORMAP;
 
-        uint32_t value_list[5] = {screen->black_pixel, 0, XCB_BACKING_STORE_NOT_USEFUL, XCB_EVENT_MASK_EXPOSURE, colormap};
+        uint32_t value_list[5] = {screen->black_pixel, 0, XCB_BACKING_STORE_NOT_USEFUL, XCB_EVENT_MASK_EXPOSURE | XCB_EVENT_MASK_STRUCTURE_NOTIFY, colormap};
 
         xcb_void_cookie_t cookie_create_window = xcb_create_window_checked(connection, depth, window, screen->root, 0, 0, texture_width, texture_height, 0, XCB_WINDOW_CLASS_INPUT_OUTPUT, visual_id, value_mask, value_list);
 
@@ -217,7 +484,6 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
 
         // xcb/xcb_icccm.h
         constexpr uint32_t const ICCCM_SIZE_HINT_P_MIN_SIZE = 1 << 4;
-        constexpr uint32_t const ICCCM_SIZE_HINT_P_MAX_SIZE = 1 << 5;
         struct
         {
             uint32_t flags;
@@ -231,11 +497,10 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
             int32_t base_width, base_height;
             uint32_t win_gravity;
         } size_hints = {};
-        size_hints.flags = ICCCM_SIZE_HINT_P_MIN_SIZE | ICCCM_SIZE_HINT_P_MAX_SIZE;
-        size_hints.min_width = texture_width;
-        size_hints.min_height = texture_height;
-        size_hints.max_width = texture_width;
-        size_hints.max_height = texture_height;
+        // the window may be resized (at least one tile)
+        size_hints.flags = ICCCM_SIZE_HINT_P_MIN_SIZE;
+        size_hints.min_width = INFERENCE_TILE_SIZE;
+        size_hints.min_height = INFERENCE_TILE_SIZE;
         xcb_void_cookie_t cookie_change_property_size_hints = xcb_change_property_checked(connection, XCB_PROP_MODE_REPLACE, window, XCB_ATOM_WM_NORMAL_HINTS, XCB_ATOM_WM_SIZE_HINTS, 8 * sizeof(uint32_t), sizeof(size_hints) / sizeof(uint32_t), &size_hints);
 
         xcb_void_cookie_t cookie_change_property_wm_protocols_delete_window = xcb_change_property_checked(connection, XCB_PROP_MODE_REPLACE, window, atom_wm_protocols, XCB_ATOM_ATOM, 8 * sizeof(uint32_t), sizeof(xcb_atom_t) / sizeof(uint32_t), &atom_wm_delete_window);
@@ -250,11 +515,45 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
         assert(NULL == error_change_property_wm_protocols_delete_window);
     }
 
+    // NULL: fall back to the "xcb_put_image"
+    inference_shm_presenter *shm_presenter = NULL;
+    if (options.present_shm)
+    {
+        shm_presenter = inference_shm_presenter_create(connection, window, depth, texture_width, texture_height, options.pipeline_depth);
+    }
+    printf("Present: %s (Pipeline Depth: %d)\n", (NULL != shm_presenter) ? "MIT-SHM" : "xcb_put_image", options.pipeline_depth);
+
+    // the decode thread starts immediately
+    {
+        if (NULL == shm_presenter)
+        {
+            frame_buffers = std::vector<uint8_t[4]>(frame_buffer_size * options.pipeline_depth);
+        }
+
+        for (int frame_buffer_index = 0; frame_buffer_index < options.pipeline_depth; ++frame_buffer_index)
+        {
+            if (NULL != shm_presenter)
+            {
+                inference_shm_presenter_get_pixmap(shm_presenter, frame_buffer_index, NULL, &frame_buffer_pointers[frame_buffer_index]);
+            }
+            else
+            {
+                frame_buffer_pointers[frame_buffer_index] = &frame_buffers[frame_buffer_size * frame_buffer_index];
+            }
+        }
+
+        pipeline = inference_frame_pipeline_create(predictor, reloader, texture_width, texture_height, options.layouts[0], options.pipeline_depth, frame_buffer_pointers);
+        assert(NULL != pipeline);
+    }
+
     xcb_present_event_t present_event = 0;
     {
         present_event = xcb_generate_id(connection);
 
-        xcb_void_cookie_t cookie_present_select_input = xcb_present_select_input_checked(connection, present_event, window, XCB_PRESENT_EVENT_MASK_COMPLETE_NOTIFY);
+        // the pixmap of the ring is NOT written until the "IdleNotify"
+        uint32_t const present_event_mask = (NULL != shm_presenter) ? (XCB_PRESENT_EVENT_MASK_COMPLETE_NOTIFY | XCB_PRESENT_EVENT_MASK_IDLE_NOTIFY) : XCB_PRESENT_EVENT_MASK_COMPLETE_NOTIFY;
+
+        xcb_void_cookie_t cookie_present_select_input = xcb_present_select_input_checked(connection, present_event, window, present_event_mask);
 
         xcb_generic_error_t *error_present_select_input = xcb_request_check(connection, cookie_present_select_input);
         assert(NULL == error_present_select_input);
@@ -281,7 +580,9 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
         assert(NULL == error_create_graphics_context);
     }
 
+    // the "back buffer" of the "xcb_put_image" (the pixmaps of the ring are owned by the "shm_presenter")
     xcb_pixmap_t pixmap = 0;
+    if (NULL == shm_presenter)
     {
         pixmap = xcb_generate_id(connection);
 
@@ -291,10 +592,17 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
         assert(NULL == error_create_pixmap);
     }
 
+    if (ntm_profiler_is_enabled())
+    {
+        signal(SIGUSR1, profile_signal_handler);
+    }
+
     struct timespec time_monotonic;
     clock_gettime(CLOCK_MONOTONIC, &time_monotonic);
 
     bool quit = false;
+    // all the frame buffers are still being used by the X server, and thus the frame is presented at the next "IdleNotify"
+    bool frame_deferred = false;
     xcb_generic_event_t *event;
 
     while ((!quit) && ((event = xcb_wait_for_event(connection)) != NULL))
@@ -311,16 +619,58 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
 
             xcb_ge_generic_event_t *ge_generic_event = reinterpret_cast<xcb_ge_generic_event_t *>(event);
 
-            assert(present_extension_opcode == ge_generic_event->extension && XCB_PRESENT_COMPLETE_NOTIFY == ge_generic_event->event_type);
+            assert(present_extension_opcode == ge_generic_event->extension);
 
-            xcb_present_complete_notify_event_t *present_complete_notify_event = reinterpret_cast<xcb_present_complete_notify_event_t *>(event);
+            if (XCB_PRESENT_IDLE_NOTIFY == ge_generic_event->event_type)
+            {
+                xcb_present_idle_notify_event_t *present_idle_notify_event = reinterpret_cast<xcb_present_idle_notify_event_t *>(event);
+
+                assert(present_idle_notify_event->event == present_event);
+
+                // the pixmap can be decoded into again
+                // -1: the pixmap of the previous size, whose frame has been dropped by the resize (or the "xcb_put_image" has been fallen back to, whose buffer has been released after copied)
+                int const frame_buffer_index = (NULL != shm_presenter) ? inference_shm_presenter_find_pixmap(shm_presenter, present_idle_notify_event->pixmap) : -1;
+                if (frame_buffer_index >= 0)
+                {
+                    inference_frame_pipeline_release(pipeline, frame_buffer_index);
+                }
 
-            assert(present_complete_notify_event->event == present_event);
+                if (!frame_deferred)
+                {
+                    break;
+                }
+
+                frame_deferred = false;
+            }
+            else
+            {
+                assert(XCB_PRESENT_COMPLETE_NOTIFY == ge_generic_event->event_type);
+
+                xcb_present_complete_notify_event_t *present_complete_notify_event = reinterpret_cast<xcb_present_complete_notify_event_t *>(event);
+
+                assert(present_complete_notify_event->event == present_event);
+            }
         }
         case XCB_EXPOSE:
         case XCB_GRAPHICS_EXPOSURE:
         case XCB_NO_EXPOSURE:
         {
+            // Inference
+            // the frame has been (or is being) decoded by the decode thread
+            inference_frame frame;
+            if (!inference_frame_pipeline_acquire(pipeline, &frame))
+            {
+                frame_deferred = true;
+                break;
+            }
+
+            // MIT-SHM: the texture has been decoded into the pixmap directly
+            xcb_pixmap_t frame_pixmap = pixmap;
+            if (NULL != shm_presenter)
+            {
+                inference_shm_presenter_get_pixmap(shm_presenter, frame.index, &frame_pixmap, NULL);
+            }
+
             // FPS
             double fps = -1.0;
             {
@@ -332,45 +682,74 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
                 time_monotonic = new_time_monotonic;
             }
 
-            // Inference
-            tflite_predict(&bit_RGBs[0], texture_width, texture_height, tflite_interpreter, tflite_input, tflite_output);
-
 #ifdef NDEBUG
             // write "texture" into "back buffer"
-            xcb_put_image(connection, XCB_IMAGE_FORMAT_Z_PIXMAP, pixmap, graphics_context, texture_width, texture_height, 0, 0, 0, depth, bit_RGBs.size() * sizeof(bit_RGBs[0]), &bit_RGBs[0][0]);
+            if (NULL == shm_presenter)
+            {
+                uint64_t const upload_begin = ntm_profiler_now();
+
+                xcb_put_image(connection, XCB_IMAGE_FORMAT_Z_PIXMAP, pixmap, graphics_context, texture_width, texture_height, 0, 0, 0, depth, frame_buffer_size * sizeof(frame.bit_RGBs[0]), &frame.bit_RGBs[0][0]);
+
+                ntm_profiler_record(NTM_PROFILER_STAGE_UPLOAD, upload_begin, ntm_profiler_now());
+
+                // the "xcb_put_image" has copied the texels
+                inference_frame_pipeline_release(pipeline, frame.index);
+            }
 
             // write "text" into "back buffer"
             {
                 char fps_string[64];
-                int fps_string_length = sprintf(fps_string, "FPS: %d", static_cast<int>(fps));
+                int fps_string_length = sprintf(fps_string, "FPS: %d Latency: %d ms", static_cast<int>(fps), static_cast<int>(frame.latency));
 
-                xcb_image_text_8(connection, fps_string_length, pixmap, graphics_context, 7, 17, fps_string);
+                xcb_image_text_8(connection, fps_string_length, frame_pixmap, graphics_context, 7, 17, fps_string);
             }
 
             // copy from "back-buffer" into "front buffer"
-            xcb_present_pixmap(connection, window, pixmap, 0, XCB_NONE, XCB_NONE, 0, 0, XCB_NONE, XCB_NONE, XCB_NONE, XCB_PRESENT_OPTION_NONE, 0, 0, 0, 0, NULL);
+            uint64_t const present_begin = ntm_profiler_now();
+
+            xcb_present_pixmap(connection, window, frame_pixmap, 0, XCB_NONE, XCB_NONE, 0, 0, XCB_NONE, XCB_NONE, XCB_NONE, XCB_PRESENT_OPTION_NONE, 0, 0, 0, 0, NULL);
 
             int result_flush = xcb_flush(connection);
             assert(result_flush > 0);
 
+            ntm_profiler_record(NTM_PROFILER_STAGE_PRESENT, present_begin, ntm_profiler_now());
+
 #else
             // write "texture" into "back buffer"
-            xcb_void_cookie_t cookie_put_image = xcb_put_image_checked(connection, XCB_IMAGE_FORMAT_Z_PIXMAP, pixmap, graphics_context, texture_width, texture_height, 0, 0, 0, depth, bit_RGBs.size() * sizeof(bit_RGBs[0]), &bit_RGBs[0][0]);
+            xcb_void_cookie_t cookie_put_image = {};
+            if (NULL == shm_presenter)
+            {
+                uint64_t const upload_begin = ntm_profiler_now();
+
+                cookie_put_image = xcb_put_image_checked(connection, XCB_IMAGE_FORMAT_Z_PIXMAP, pixmap, graphics_context, texture_width, texture_height, 0, 0, 0, depth, frame_buffer_size * sizeof(frame.bit_RGBs[0]), &frame.bit_RGBs[0][0]);
+
+                ntm_profiler_record(NTM_PROFILER_STAGE_UPLOAD, upload_begin, ntm_profiler_now());
+
+                // the "xcb_put_image" has copied the texels
+                inference_frame_pipeline_release(pipeline, frame.index);
+            }
 
             // write "text" into "back buffer"
             xcb_void_cookie_t cookie_image_text = {};
             {
                 char fps_string[64];
-                int fps_string_length = sprintf(fps_string, "FPS: %d", static_cast<int>(fps));
+                int fps_string_length = sprintf(fps_string, "FPS: %d Latency: %d ms", static_cast<int>(fps), static_cast<int>(frame.latency));
 
-                cookie_image_text = xcb_image_text_8_checked(connection, fps_string_length, pixmap, graphics_context, 7, 17, fps_string);
+                cookie_image_text = xcb_image_text_8_checked(connection, fps_string_length, frame_pixmap, graphics_context, 7, 17, fps_string);
             }
 
             // copy from "back-buffer" into "front buffer"
-            xcb_void_cookie_t cookie_present_pixmap = xcb_present_pixmap_checked(connection, window, pixmap, 0, XCB_NONE, XCB_NONE, 0, 0, XCB_NONE, XCB_NONE, XCB_NONE, XCB_PRESENT_OPTION_NONE, 0, 0, 0, 0, NULL);
+            uint64_t const present_begin = ntm_profiler_now();
 
-            xcb_generic_error_t *error_put_image = xcb_request_check(connection, cookie_put_image);
-            assert(NULL == error_put_image);
+            xcb_void_cookie_t cookie_present_pixmap = xcb_present_pixmap_checked(connection, window, frame_pixmap, 0, XCB_NONE, XCB_NONE, 0, 0, XCB_NONE, XCB_NONE, XCB_NONE, XCB_PRESENT_OPTION_NONE, 0, 0, 0, 0, NULL);
+
+            ntm_profiler_record(NTM_PROFILER_STAGE_PRESENT, present_begin, ntm_profiler_now());
+
+            if (NULL == shm_presenter)
+            {
+                xcb_generic_error_t *error_put_image = xcb_request_check(connection, cookie_put_image);
+                assert(NULL == error_put_image);
+            }
 
             xcb_generic_error_t *error_image_text = xcb_request_check(connection, cookie_image_text);
             assert(NULL == error_image_text);
@@ -378,6 +757,91 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
             xcb_generic_error_t *error_present_pixmap = xcb_request_check(connection, cookie_present_pixmap);
             assert(NULL == error_present_pixmap);
 #endif
+
+            if (frame.resize_latency >= 0.0)
+            {
+                printf("Resize: %dx%d First Frame: %.2f ms\n", texture_width, texture_height, frame.resize_latency);
+            }
+
+            if (0 != profile_requested)
+            {
+                profile_requested = 0;
+                write_profile(&options);
+            }
+        }
+        break;
+        case XCB_CONFIGURE_NOTIFY:
+        {
+            assert(XCB_CONFIGURE_NOTIFY == (event->response_type & (~uint8_t(0X80))));
+
+            xcb_configure_notify_event_t *configure_notify_event = reinterpret_cast<xcb_configure_notify_event_t *>(event);
+
+            // merely the resize (rather than the move) changes the resolution
+            if ((window != configure_notify_event->window) || ((texture_width == configure_notify_event->width) && (texture_height == configure_notify_event->height)))
+            {
+                break;
+            }
+
+            texture_width = configure_notify_event->width;
+            texture_height = configure_notify_event->height;
+            frame_buffer_size = static_cast<size_t>(texture_width) * static_cast<size_t>(texture_height);
+
+            // The buffers of the new size are created before the pipeline is resized, and the previous buffers are destroyed after the decode thread has stopped.
+            inference_shm_presenter *const previous_shm_presenter = shm_presenter;
+            xcb_pixmap_t const previous_pixmap = pixmap;
+            std::vector<uint8_t[4]> previous_frame_buffers;
+            if (NULL != previous_shm_presenter)
+            {
+                // NULL: e.g. the "shmget" of the larger size fails, and falls back to the "xcb_put_image" (the same as the startup)
+                shm_presenter = inference_shm_presenter_create(connection, window, depth, texture_width, texture_height, options.pipeline_depth);
+                if (NULL == shm_presenter)
+                {
+                    printf("Present: xcb_put_image (Resize: %dx%d)\n", texture_width, texture_height);
+                }
+            }
+
+            if (NULL == shm_presenter)
+            {
+                previous_frame_buffers.swap(frame_buffers);
+                frame_buffers = std::vector<uint8_t[4]>(frame_buffer_size * options.pipeline_depth);
+
+                pixmap = xcb_generate_id(connection);
+
+                xcb_void_cookie_t cookie_create_pixmap = xcb_create_pixmap_checked(connection, depth, pixmap, window, texture_width, texture_height);
+
+                xcb_generic_error_t *error_create_pixmap = xcb_request_check(connection, cookie_create_pixmap);
+                assert(NULL == error_create_pixmap);
+            }
+
+            for (int frame_buffer_index = 0; frame_buffer_index < options.pipeline_depth; ++frame_buffer_index)
+            {
+                if (NULL != shm_presenter)
+                {
+                    inference_shm_presenter_get_pixmap(shm_presenter, frame_buffer_index, NULL, &frame_buffer_pointers[frame_buffer_index]);
+                }
+                else
+                {
+                    frame_buffer_pointers[frame_buffer_index] = &frame_buffers[frame_buffer_size * frame_buffer_index];
+                }
+            }
+
+            // The predictor is reserved for the new size by the decode thread, and thus the tensors are merely allocated again when the size leaves the bucket.
+            inference_frame_pipeline_resize(pipeline, texture_width, texture_height, frame_buffer_pointers);
+
+            if (NULL != previous_shm_presenter)
+            {
+                inference_shm_presenter_destroy(previous_shm_presenter);
+            }
+            else
+            {
+                xcb_void_cookie_t cookie_free_pixmap = xcb_free_pixmap_checked(connection, previous_pixmap);
+
+                xcb_generic_error_t *error_free_pixmap = xcb_request_check(connection, cookie_free_pixmap);
+                assert(NULL == error_free_pixmap);
+            }
+
+            // The frames of the previous size have been dropped (NOT waiting for the "IdleNotify" any more), and the first frame of the new size is drawn by the "Expose" of the resize.
+            frame_deferred = false;
         }
         break;
         case XCB_CLIENT_MESSAGE:
@@ -404,6 +868,34 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
         free(event);
     }
 
+    {
+        inference_frame_pipeline_statistics statistics;
+        inference_frame_pipeline_get_statistics(pipeline, &statistics);
+
+        printf("Frames: %llu Decode: %.2f ms Latency: %.2f ms (Max: %.2f ms) Wait: %.2f ms\n", static_cast<unsigned long long>(statistics.num_frames), statistics.mean_decode_time, statistics.mean_latency, statistics.max_latency, statistics.mean_wait_time);
+
+        if (statistics.num_resizes > 0U)
+        {
+            printf("Resizes: %llu First Frame: %.2f ms (Max: %.2f ms)\n", static_cast<unsigned long long>(statistics.num_resizes), statistics.mean_resize_latency, statistics.max_resize_latency);
+        }
+
+        // the decode thread may still be writing the pixmap
+        inference_frame_pipeline_destroy(pipeline);
+    }
+
+    // the decode thread has been stopped
+    if (NULL != reloader)
+    {
+        inference_model_reloader_destroy(reloader);
+    }
+
+    write_profile(&options);
+
+    if (NULL != shm_presenter)
+    {
+        inference_shm_presenter_destroy(shm_presenter);
+    }
+    else
     {
         xcb_void_cookie_t cookie_free_pixmap = xcb_free_pixmap_checked(connection, pixmap);
 
@@ -428,7 +920,8 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
     xcb_disconnect(connection);
 
 #elif defined(_MSC_VER)
-    window_data window_data_instance;
+    // NULL "pipeline": the "WM_SIZE" during the "CreateWindowExW" is ignored
+    window_data window_data_instance = {};
 
     HINSTANCE instance = reinterpret_cast<HINSTANCE>(&__ImageBase);
 
@@ -453,7 +946,7 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
 
     HWND window;
     {
-        constexpr DWORD const dw_style = WS_CLIPSIBLINGS | WS_CLIPCHILDREN | WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU | WS_MINIMIZEBOX;
+        constexpr DWORD const dw_style = WS_CLIPSIBLINGS | WS_CLIPCHILDREN | WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU | WS_THICKFRAME | WS_MINIMIZEBOX | WS_MAXIMIZEBOX;
         constexpr DWORD const dw_ex_style = WS_EX_APPWINDOW;
 
         RECT rect;
@@ -503,12 +996,24 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
     window_data_instance.device_context = device_context;
     window_data_instance.memory_device_context = memory_device_context;
     window_data_instance.bitmap = bitmap;
-    window_data_instance.bit_RGBs = &bit_RGBs[0];
+    // the decode thread starts immediately
+    {
+        frame_buffers = std::vector<uint8_t[4]>(frame_buffer_size * options.pipeline_depth);
+
+        for (int frame_buffer_index = 0; frame_buffer_index < options.pipeline_depth; ++frame_buffer_index)
+        {
+            frame_buffer_pointers[frame_buffer_index] = &frame_buffers[frame_buffer_size * frame_buffer_index];
+        }
+
+        pipeline = inference_frame_pipeline_create(predictor, reloader, texture_width, texture_height, options.layouts[0], options.pipeline_depth, frame_buffer_pointers);
+        assert(NULL != pipeline);
+    }
+
     window_data_instance.performance_frequency = performance_frequency;
     window_data_instance.performance_count = performance_count;
-    window_data_instance.tflite_interpreter = tflite_interpreter;
-    window_data_instance.tflite_input = tflite_input;
-    window_data_instance.tflite_output = tflite_output;
+    window_data_instance.pipeline = pipeline;
+    window_data_instance.frame_buffers = &frame_buffers;
+    window_data_instance.pipeline_depth = options.pipeline_depth;
 
     ShowWindow(window, SW_SHOWDEFAULT);
 
@@ -526,8 +1031,19 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
         }
     }
 
+    inference_frame_pipeline_destroy(pipeline);
+
+    // the decode thread has been stopped
+    if (NULL != reloader)
     {
-        BOOL result_delete_object = DeleteObject(bitmap);
+        inference_model_reloader_destroy(reloader);
+    }
+
+    write_profile(&options);
+
+    // the bitmap may have been replaced by the "WM_SIZE"
+    {
+        BOOL result_delete_object = DeleteObject(window_data_instance.bitmap);
         assert(FALSE != result_delete_object);
     }
 
@@ -540,76 +1056,193 @@ int wmain(int argc, wchar_t *argv[], wchar_t *envp[])
 #error Unknown Compiler
 #endif
 
-    TfLiteInterpreterDelete(tflite_interpreter);
-    TfLiteGpuDelegateV2Delete(tflite_delegate);
+    inference_predictor_destroy(predictor);
+
+    if (NULL != pack)
+    {
+        ntm_pack_close(pack);
+    }
+
     TfLiteModelDelete(tflite_model);
 
     return 0;
 }
 
+static inline bool write_profile(inference_options const *options)
+{
+    bool result = true;
+
+    if (NULL != options->profile_path)
+    {
+        // ".csv" or JSON
+        size_t const path_length = strlen(options->profile_path);
+        bool const csv = (path_length >= 4U) && (0 == strcmp(options->profile_path + (path_length - 4U), ".csv"));
+
+        FILE *file = ntm_fopen_utf8(options->profile_path, "wb");
+        bool const result_write = (NULL != file) && (csv ? ntm_profiler_write_csv(file) : ntm_profiler_write_json(file));
+        bool const result_close = (NULL != file) && (0 == fclose(file));
+        if ((!result_write) || (!result_close))
+        {
+            fprintf(stderr, "Failed to write the profile: %s\n", options->profile_path);
+            result = false;
+        }
+    }
+
+    if (NULL != options->trace_path)
+    {
+        FILE *file = ntm_fopen_utf8(options->trace_path, "wb");
+        bool const result_write = (NULL != file) && ntm_profiler_write_trace(file);
+        bool const result_close = (NULL != file) && (0 == fclose(file));
+        if ((!result_write) || (!result_close))
+        {
+            fprintf(stderr, "Failed to write the trace: %s\n", options->trace_path);
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+#if defined(__GNUC__)
+static void profile_signal_handler(int)
+{
+    profile_requested = 1;
+}
+#endif
+
 static inline void tflite_error_reporter(void *, const char *format, va_list args)
 {
-    vprintf(format, args);
+    vfprintf(stderr, format, args);
     return;
 }
 
-static inline void tflite_predict(uint8_t (*out_bit_RGBs)[4], int texture_width, int texture_height, TfLiteInterpreter *tflite_interpreter, float *tflite_input, float *tflite_output)
+static inline int validate(int texture_width, int texture_height, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine)
 {
-    float(*input_UVs)[2] = reinterpret_cast<float(*)[2]>(tflite_input);
-    for (int h = 0; h < texture_height; ++h)
+    // The reference is the TFLite interpreter without any delegate
+    TfLiteInterpreter *tflite_interpreter = NULL;
     {
-        for (int w = 0; w < texture_width; ++w)
-        {
-            input_UVs[texture_width * h + w][0] = (w + 0.5F) / texture_width;
-            input_UVs[texture_width * h + w][1] = (h + 0.5F) / texture_height;
-        }
+        TfLiteInterpreterOptions *tflite_interpreter_options = TfLiteInterpreterOptionsCreate();
+        assert(tflite_interpreter_options);
+
+        tflite_interpreter = TfLiteInterpreterCreate(tflite_model, tflite_interpreter_options);
+        assert(tflite_interpreter);
+
+        TfLiteInterpreterOptionsDelete(tflite_interpreter_options);
     }
 
+    {
+        int tflite_input_dims[2] = {texture_width * texture_height, 2};
+        TfLiteStatus tflite_status_resize_input_tensor = TfLiteInterpreterResizeInputTensor(tflite_interpreter, 0, tflite_input_dims, sizeof(tflite_input_dims) / sizeof(tflite_input_dims[0]));
+        assert(kTfLiteOk == tflite_status_resize_input_tensor);
+    }
+
+    {
+        TfLiteStatus tflite_status_allocate_tensors = TfLiteInterpreterAllocateTensors(tflite_interpreter);
+        assert(kTfLiteOk == tflite_status_allocate_tensors);
+    }
+
+    float(*tflite_input)[2] = reinterpret_cast<float(*)[2]>(TfLiteInterpreterGetInputTensor(tflite_interpreter, 0)->data.f);
+    float(*tflite_output)[3] = reinterpret_cast<float(*)[3]>(TfLiteInterpreterGetOutputTensor(tflite_interpreter, 0)->data.f);
+
+    generate_UVs(tflite_input, texture_width, texture_height, 0, 0, texture_width, texture_height);
+
     TfLiteStatus tflite_status_invoke = TfLiteInterpreterInvoke(tflite_interpreter);
     assert(kTfLiteOk == tflite_status_invoke);
 
-    float(*prediction_RGBs)[3] = reinterpret_cast<float(*)[3]>(tflite_output);
+    std::vector<float[3]> cpu_output(static_cast<size_t>(texture_width * texture_height));
+
+    std::vector<float[3]> cpu_grid_output(static_cast<size_t>(texture_width * texture_height));
+
+    ntm_cpu_engine_predict(cpu_engine, static_cast<uint32_t>(texture_width * texture_height), tflite_input, &cpu_output[0]);
+
+    ntm_cpu_engine_predict_grid(cpu_engine, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height), 0U, 0U, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height), &cpu_grid_output[0]);
 
-    for (int h = 0; h < texture_height; ++h)
+    // The FP16 / INT8 coefficients are lossy, and thus the tolerance is merely applied when all layers are FP32.
+    bool quantized = false;
+    for (uint32_t layer_index = 0U; layer_index < cpu_engine->model.num_layers; ++layer_index)
     {
-        for (int w = 0; w < texture_width; ++w)
+        if (NTM_COEFFICIENT_TYPE_FP32 != cpu_engine->model.layers[layer_index].coefficient_type)
         {
-            float R = prediction_RGBs[texture_width * h + w][0] * 255.0F;
-            float G = prediction_RGBs[texture_width * h + w][1] * 255.0F;
-            float B = prediction_RGBs[texture_width * h + w][2] * 255.0F;
+            quantized = true;
+        }
+    }
 
-            if (R > 255.0F)
-            {
-                R = 255.0F;
-            }
-            if (G > 255.0F)
-            {
-                G = 255.0F;
-            }
-            if (B > 255.0F)
-            {
-                B = 255.0F;
-            }
+    int num_errors = 0;
+    for (int path_index = 0; path_index < 2; ++path_index)
+    {
+        float const(*const path_output)[3] = (0 == path_index) ? &cpu_output[0] : &cpu_grid_output[0];
 
-            if (R < 0.0F)
-            {
-                R = 0.0F;
-            }
-            if (G < 0.0F)
+        float max_error = 0.0F;
+        int max_bit_error = 0;
+        double sum_squared_error = 0.0;
+        int num_path_errors = 0;
+        for (int pixel_index = 0; pixel_index < (texture_width * texture_height); ++pixel_index)
+        {
+            for (int channel_index = 0; channel_index < 3; ++channel_index)
             {
-                G = 0.0F;
+                float const error = fabsf(path_output[pixel_index][channel_index] - tflite_output[pixel_index][channel_index]);
+                if (error > max_error)
+                {
+                    max_error = error;
+                }
+
+                if ((!quantized) && (!(error <= NTM_CPU_TOLERANCE)))
+                {
+                    ++num_path_errors;
+                }
+
+                // clamped and rounded to the nearest, which is the same as the "store_bit_RGBs"
+                float const path_value = fminf(fmaxf(path_output[pixel_index][channel_index], 0.0F), 1.0F);
+                float const tflite_value = fminf(fmaxf(tflite_output[pixel_index][channel_index], 0.0F), 1.0F);
+
+                int const bit_error = abs(static_cast<int>(lrintf(path_value * 255.0F)) - static_cast<int>(lrintf(tflite_value * 255.0F)));
+                if (bit_error > max_bit_error)
+                {
+                    max_bit_error = bit_error;
+                }
+
+                sum_squared_error += static_cast<double>(path_value - tflite_value) * static_cast<double>(path_value - tflite_value);
             }
-            if (B < 0.0F)
+        }
+
+        // the peak signal is 1.0
+        double const mean_squared_error = sum_squared_error / (3.0 * static_cast<double>(texture_width * texture_height));
+        double const psnr = (mean_squared_error > 0.0) ? (-10.0 * log10(mean_squared_error)) : static_cast<double>(INFINITY);
+
+        if (!quantized)
+        {
+            printf("%s Max Error: %f Tolerance: %f Errors: %d PSNR: %.2f dB Max 8-bit Error: %d\n", (0 == path_index) ? "Pixel" : "Grid", static_cast<double>(max_error), static_cast<double>(NTM_CPU_TOLERANCE), num_path_errors, psnr, max_bit_error);
+        }
+        else
+        {
+            printf("%s Max Error: %f (quantized, no tolerance) PSNR: %.2f dB Max 8-bit Error: %d\n", (0 == path_index) ? "Pixel" : "Grid", static_cast<double>(max_error), psnr, max_bit_error);
+        }
+
+        num_errors += num_path_errors;
+    }
+
+    // The features of the higher frequencies are derived by the double-angle recurrences (SIMD kernels)
+    {
+        float encoding_errors[NTM_MAX_FREQUENCIES];
+        ntm_cpu_engine_measure_encoding_error(cpu_engine, static_cast<uint32_t>(texture_width * texture_height), tflite_input, encoding_errors);
+
+        float max_encoding_error = 0.0F;
+        for (uint32_t frequency_index = 0U; frequency_index < cpu_engine->model.num_frequencies; ++frequency_index)
+        {
+            printf("Encoding Frequency: %u Max Error: %e\n", frequency_index, static_cast<double>(encoding_errors[frequency_index]));
+
+            if (encoding_errors[frequency_index] > max_encoding_error)
             {
-                B = 0.0F;
+                max_encoding_error = encoding_errors[frequency_index];
             }
-
-            out_bit_RGBs[texture_width * h + w][0] = static_cast<uint8_t>(B);
-            out_bit_RGBs[texture_width * h + w][1] = static_cast<uint8_t>(G);
-            out_bit_RGBs[texture_width * h + w][2] = static_cast<uint8_t>(R);
-            out_bit_RGBs[texture_width * h + w][3] = 255;
         }
+
+        printf("Encoding Max Error: %e\n", static_cast<double>(max_encoding_error));
     }
+
+    TfLiteInterpreterDelete(tflite_interpreter);
+
+    return (0 == num_errors) ? 0 : 1;
 }
 
 #if defined(__GNUC__)
@@ -645,7 +1278,11 @@ static LRESULT CALLBACK WindowProcedure(HWND hWnd, UINT uMsg, WPARAM wParam, LPA
         }
 
         // Inference
-        tflite_predict(window_data_instance->bit_RGBs, window_data_instance->texture_width, window_data_instance->texture_height, window_data_instance->tflite_interpreter, window_data_instance->tflite_input, window_data_instance->tflite_output);
+        // the frame has been (or is being) decoded by the decode thread, and the buffer is released as soon as the "SetDIBits" has copied it
+        inference_frame frame;
+        bool const result_acquire = inference_frame_pipeline_acquire(window_data_instance->pipeline, &frame);
+        assert(result_acquire);
+        (void)result_acquire;
 
         {
             // write "texture" into "back buffer"
@@ -657,8 +1294,14 @@ static LRESULT CALLBACK WindowProcedure(HWND hWnd, UINT uMsg, WPARAM wParam, LPA
             bmi.bmiHeader.biPlanes = 1;
             bmi.bmiHeader.biBitCount = 32;
             bmi.bmiHeader.biCompression = BI_RGB;
-            int result_set_dib_bits = SetDIBits(NULL, window_data_instance->bitmap, 0, window_data_instance->texture_height, window_data_instance->bit_RGBs, &bmi, DIB_RGB_COLORS);
+            uint64_t const upload_begin = ntm_profiler_now();
+
+            int result_set_dib_bits = SetDIBits(NULL, window_data_instance->bitmap, 0, window_data_instance->texture_height, frame.bit_RGBs, &bmi, DIB_RGB_COLORS);
             assert(result_set_dib_bits > 0);
+
+            ntm_profiler_record(NTM_PROFILER_STAGE_UPLOAD, upload_begin, ntm_profiler_now());
+
+            inference_frame_pipeline_release(window_data_instance->pipeline, frame.index);
         }
 
         {
@@ -667,19 +1310,70 @@ static LRESULT CALLBACK WindowProcedure(HWND hWnd, UINT uMsg, WPARAM wParam, LPA
 
             // write "text" into "back buffer"
             WCHAR fps_string[64];
-            int fps_string_length = wsprintfW(fps_string, L"FPS: %d", static_cast<int>(fps));
+            int fps_string_length = wsprintfW(fps_string, L"FPS: %d Latency: %d ms", static_cast<int>(fps), static_cast<int>(frame.latency));
 
             int result_text_out = TextOutW(window_data_instance->memory_device_context, 7, 7, fps_string, fps_string_length);
             assert(0 != result_text_out);
 
             // copy from "back-buffer" into "front buffer"
+            uint64_t const present_begin = ntm_profiler_now();
+
             int result_bit_blt = BitBlt(window_data_instance->device_context, 0, 0, window_data_instance->texture_width, window_data_instance->texture_height, window_data_instance->memory_device_context, 0, 0, SRCCOPY);
             assert(0 != result_bit_blt);
 
+            ntm_profiler_record(NTM_PROFILER_STAGE_PRESENT, present_begin, ntm_profiler_now());
+
             HGDIOBJ new_bitmap = reinterpret_cast<HBITMAP>(SelectObject(window_data_instance->memory_device_context, old_bitmap));
             assert(new_bitmap == window_data_instance->bitmap);
         }
 
+        if (frame.resize_latency >= 0.0)
+        {
+            printf("Resize: %dx%d First Frame: %.2f ms\n", window_data_instance->texture_width, window_data_instance->texture_height, frame.resize_latency);
+        }
+
+        return 0;
+    }
+    case WM_SIZE:
+    {
+        window_data *window_data_instance = reinterpret_cast<window_data *>(GetWindowLongPtrW(hWnd, 0));
+
+        int const texture_width = LOWORD(lParam);
+        int const texture_height = HIWORD(lParam);
+
+        // SIZE_MINIMIZED: the client area is empty, and the previous size is still decoded
+        if ((NULL == window_data_instance) || (NULL == window_data_instance->pipeline) || (texture_width < 1) || (texture_height < 1) || ((texture_width == window_data_instance->texture_width) && (texture_height == window_data_instance->texture_height)))
+        {
+            return 0;
+        }
+
+        // The buffers of the new size are created before the pipeline is resized, and the previous buffers are destroyed after the decode thread has stopped.
+        HBITMAP bitmap = CreateCompatibleBitmap(window_data_instance->device_context, texture_width, texture_height);
+        assert(NULL != bitmap);
+
+        size_t const frame_buffer_size = static_cast<size_t>(texture_width) * static_cast<size_t>(texture_height);
+        std::vector<uint8_t[4]> frame_buffers(frame_buffer_size * window_data_instance->pipeline_depth);
+
+        uint8_t(*frame_buffer_pointers[INFERENCE_MAX_PIPELINE_DEPTH])[4] = {};
+        for (int frame_buffer_index = 0; frame_buffer_index < window_data_instance->pipeline_depth; ++frame_buffer_index)
+        {
+            frame_buffer_pointers[frame_buffer_index] = &frame_buffers[frame_buffer_size * frame_buffer_index];
+        }
+
+        // The predictor is reserved for the new size by the decode thread, and thus the tensors are merely allocated again when the size leaves the bucket.
+        inference_frame_pipeline_resize(window_data_instance->pipeline, texture_width, texture_height, frame_buffer_pointers);
+
+        window_data_instance->frame_buffers->swap(frame_buffers);
+
+        {
+            BOOL result_delete_object = DeleteObject(window_data_instance->bitmap);
+            assert(FALSE != result_delete_object);
+        }
+
+        window_data_instance->bitmap = bitmap;
+        window_data_instance->texture_width = texture_width;
+        window_data_instance->texture_height = texture_height;
+
         return 0;
     }
     case WM_DESTROY:
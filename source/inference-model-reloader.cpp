@@ -0,0 +1,396 @@
+#include "inference-model-reloader.h"
+#include "ntm-model.h"
+#include "ntm-file.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <stdio.h>
+#include <new>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if defined(__GNUC__)
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#elif defined(_MSC_VER)
+#include <sdkddkver.h>
+#define WIN32_LEAN_AND_MEAN
+#define NOCOMM
+#define NOMINMAX
+#include <Windows.h>
+#else
+#error Unknown Compiler
+#endif
+
+// The period to check whether the file changes (and whether the reloader is destroyed).
+static constexpr int const INFERENCE_MODEL_RELOADER_POLL_MS = 100;
+
+// The editors may write the file in multiple steps, and thus the file is reloaded after it has NOT changed for this period.
+static constexpr int const INFERENCE_MODEL_RELOADER_DEBOUNCE_MS = 200;
+
+// The model and the predictor created from it.
+// NOTE: the memory of the "data" must remain valid as long as the "TfLiteModel" or the "ntm_cpu_engine" is still in use.
+struct inference_model_generation
+{
+    std::vector<uint8_t> data;
+    TfLiteModel *tflite_model;
+    ntm_cpu_engine cpu_engine;
+    inference_predictor *predictor;
+};
+
+struct inference_model_reloader
+{
+    std::string path;
+    inference_backend backend;
+    ntm_cpu_isa cpu_isa;
+    int lod_base_width;
+    int lod_base_height;
+    bool sparse;
+    int num_threads;
+    int tile_width;
+    int tile_height;
+
+#if defined(__GNUC__)
+    // The directory rather than the file is watched, since the editors may replace the file (by renaming the temporary file).
+    int inotify_fd;
+    std::string file_name;
+#elif defined(_MSC_VER)
+    std::vector<wchar_t> wide_path;
+    WIN32_FILE_ATTRIBUTE_DATA file_attribute_data;
+#else
+#error Unknown Compiler
+#endif
+
+    // The decode thread merely "try_lock", and thus never waits for the background thread.
+    std::mutex mutex;
+    // the latest reloaded generation which has NOT been swapped in
+    inference_model_generation *pending_generation;
+    // the generations which have been swapped out, and are destroyed by the background thread
+    std::vector<inference_model_generation *> retired_generations;
+
+    // merely accessed by the decode thread: NULL: the "predictor" of the caller is in use
+    inference_model_generation *current_generation;
+
+    std::atomic<bool> quit;
+    std::thread watch_thread;
+};
+
+static void inference_model_reloader_watch_main(inference_model_reloader *reloader);
+
+static inline bool inference_model_reloader_wait(inference_model_reloader *reloader);
+
+static inline void inference_model_reloader_reload(inference_model_reloader *reloader);
+
+static inline void inference_model_reloader_collect(inference_model_reloader *reloader);
+
+static inline void inference_model_generation_destroy(inference_model_generation *generation);
+
+extern inference_model_reloader *inference_model_reloader_create(char const *path, inference_backend backend, ntm_cpu_isa cpu_isa, int lod_base_width, int lod_base_height, bool sparse, int num_threads, int tile_width, int tile_height)
+{
+    assert(INFERENCE_BACKEND_AUTO != backend);
+
+    // the network of the AOT engine is compiled into the executable
+    if (INFERENCE_BACKEND_AOT == backend)
+    {
+        return NULL;
+    }
+
+    inference_model_reloader *reloader = new (std::nothrow) inference_model_reloader;
+    if (NULL == reloader)
+    {
+        return NULL;
+    }
+
+    reloader->path = path;
+    reloader->backend = backend;
+    reloader->cpu_isa = cpu_isa;
+    reloader->lod_base_width = lod_base_width;
+    reloader->lod_base_height = lod_base_height;
+    reloader->sparse = sparse;
+    reloader->num_threads = num_threads;
+    reloader->tile_width = tile_width;
+    reloader->tile_height = tile_height;
+
+#if defined(__GNUC__)
+    {
+        size_t const separator_position = reloader->path.find_last_of('/');
+        std::string const directory = (std::string::npos != separator_position) ? reloader->path.substr(0U, separator_position + 1U) : std::string(".");
+        reloader->file_name = (std::string::npos != separator_position) ? reloader->path.substr(separator_position + 1U) : reloader->path;
+
+        reloader->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (-1 == reloader->inotify_fd)
+        {
+            delete reloader;
+            return NULL;
+        }
+
+        if (-1 == inotify_add_watch(reloader->inotify_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE))
+        {
+            close(reloader->inotify_fd);
+            delete reloader;
+            return NULL;
+        }
+    }
+#elif defined(_MSC_VER)
+    {
+        if (!ntm_utf8_to_wide(path, reloader->wide_path))
+        {
+            delete reloader;
+            return NULL;
+        }
+
+        if (FALSE == GetFileAttributesExW(&reloader->wide_path[0], GetFileExInfoStandard, &reloader->file_attribute_data))
+        {
+            delete reloader;
+            return NULL;
+        }
+    }
+#else
+#error Unknown Compiler
+#endif
+
+    reloader->pending_generation = NULL;
+    reloader->current_generation = NULL;
+    reloader->quit.store(false, std::memory_order_relaxed);
+
+    reloader->watch_thread = std::thread(inference_model_reloader_watch_main, reloader);
+
+    return reloader;
+}
+
+extern void inference_model_reloader_destroy(inference_model_reloader *reloader)
+{
+    reloader->quit.store(true, std::memory_order_release);
+
+    reloader->watch_thread.join();
+
+    if (NULL != reloader->pending_generation)
+    {
+        inference_model_generation_destroy(reloader->pending_generation);
+    }
+
+    for (inference_model_generation *const generation : reloader->retired_generations)
+    {
+        inference_model_generation_destroy(generation);
+    }
+
+    if (NULL != reloader->current_generation)
+    {
+        inference_model_generation_destroy(reloader->current_generation);
+    }
+
+#if defined(__GNUC__)
+    close(reloader->inotify_fd);
+#endif
+
+    delete reloader;
+}
+
+extern inference_predictor *inference_model_reloader_update(inference_model_reloader *reloader, inference_predictor *predictor)
+{
+    std::unique_lock<std::mutex> lock(reloader->mutex, std::try_to_lock);
+    if ((!lock.owns_lock()) || (NULL == reloader->pending_generation))
+    {
+        return predictor;
+    }
+
+    // the predictor of the caller is NOT destroyed by the reloader
+    if (NULL != reloader->current_generation)
+    {
+        reloader->retired_generations.push_back(reloader->current_generation);
+    }
+
+    reloader->current_generation = reloader->pending_generation;
+    reloader->pending_generation = NULL;
+
+    return reloader->current_generation->predictor;
+}
+
+static void inference_model_reloader_watch_main(inference_model_reloader *reloader)
+{
+    bool changed = false;
+    std::chrono::steady_clock::time_point last_change_time;
+
+    while (!reloader->quit.load(std::memory_order_acquire))
+    {
+        if (inference_model_reloader_wait(reloader))
+        {
+            changed = true;
+            last_change_time = std::chrono::steady_clock::now();
+        }
+        else if (changed && (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - last_change_time).count() >= INFERENCE_MODEL_RELOADER_DEBOUNCE_MS))
+        {
+            changed = false;
+            inference_model_reloader_reload(reloader);
+        }
+
+        inference_model_reloader_collect(reloader);
+    }
+}
+
+static inline bool inference_model_reloader_wait(inference_model_reloader *reloader)
+{
+#if defined(__GNUC__)
+    struct pollfd poll_fd;
+    poll_fd.fd = reloader->inotify_fd;
+    poll_fd.events = POLLIN;
+    poll_fd.revents = 0;
+    if (poll(&poll_fd, 1U, INFERENCE_MODEL_RELOADER_POLL_MS) <= 0)
+    {
+        return false;
+    }
+
+    bool changed = false;
+
+    alignas(struct inotify_event) char buffer[4096];
+    ssize_t size;
+    while ((size = read(reloader->inotify_fd, buffer, sizeof(buffer))) > 0)
+    {
+        for (ssize_t offset = 0; offset < size;)
+        {
+            struct inotify_event const *const event = reinterpret_cast<struct inotify_event const *>(buffer + offset);
+            if ((event->len > 0U) && (0 == strcmp(event->name, reloader->file_name.c_str())))
+            {
+                changed = true;
+            }
+
+            offset += static_cast<ssize_t>(sizeof(struct inotify_event) + event->len);
+        }
+    }
+
+    return changed;
+#elif defined(_MSC_VER)
+    Sleep(INFERENCE_MODEL_RELOADER_POLL_MS);
+
+    WIN32_FILE_ATTRIBUTE_DATA file_attribute_data;
+    if (FALSE == GetFileAttributesExW(&reloader->wide_path[0], GetFileExInfoStandard, &file_attribute_data))
+    {
+        // e.g. the file is being replaced
+        return false;
+    }
+
+    if ((0 == CompareFileTime(&file_attribute_data.ftLastWriteTime, &reloader->file_attribute_data.ftLastWriteTime)) && (file_attribute_data.nFileSizeHigh == reloader->file_attribute_data.nFileSizeHigh) && (file_attribute_data.nFileSizeLow == reloader->file_attribute_data.nFileSizeLow))
+    {
+        return false;
+    }
+
+    reloader->file_attribute_data = file_attribute_data;
+    return true;
+#else
+#error Unknown Compiler
+#endif
+}
+
+static inline void inference_model_reloader_reload(inference_model_reloader *reloader)
+{
+    inference_model_generation *generation = new (std::nothrow) inference_model_generation;
+    if (NULL == generation)
+    {
+        return;
+    }
+
+    generation->tflite_model = NULL;
+    generation->cpu_engine = {};
+    generation->predictor = NULL;
+
+    if (!ntm_read_file(reloader->path.c_str(), generation->data))
+    {
+        fprintf(stderr, "Failed to reload the model: %s\n", reloader->path.c_str());
+        inference_model_generation_destroy(generation);
+        return;
+    }
+
+    // the previous model is still in use if the new one is invalid (e.g. partially written)
+    if (INFERENCE_BACKEND_CPU == reloader->backend)
+    {
+        ntm_model model;
+        if (!ntm_model_parse(&generation->data[0], generation->data.size(), &model))
+        {
+            fprintf(stderr, "Invalid NTM asset: %s\n", reloader->path.c_str());
+            inference_model_generation_destroy(generation);
+            return;
+        }
+
+        ntm_cpu_engine_init(&generation->cpu_engine, &model, reloader->cpu_isa);
+
+        if (0 != reloader->lod_base_width)
+        {
+            ntm_cpu_engine_enable_lod(&generation->cpu_engine, static_cast<uint32_t>(reloader->lod_base_width), static_cast<uint32_t>(reloader->lod_base_height));
+        }
+
+        if (reloader->sparse)
+        {
+            ntm_cpu_engine_enable_sparsity(&generation->cpu_engine);
+        }
+    }
+    else
+    {
+        generation->tflite_model = TfLiteModelCreate(&generation->data[0], generation->data.size());
+        if (NULL == generation->tflite_model)
+        {
+            fprintf(stderr, "Invalid TFLite model: %s\n", reloader->path.c_str());
+            inference_model_generation_destroy(generation);
+            return;
+        }
+    }
+
+    generation->predictor = inference_predictor_create(reloader->backend, generation->tflite_model, &generation->cpu_engine, NULL, reloader->cpu_isa, reloader->num_threads, reloader->tile_width, reloader->tile_height);
+    if (NULL == generation->predictor)
+    {
+        fprintf(stderr, "Failed to create the predictor of the reloaded model: %s\n", reloader->path.c_str());
+        inference_model_generation_destroy(generation);
+        return;
+    }
+
+    inference_model_generation *replaced_generation;
+    {
+        std::lock_guard<std::mutex> lock(reloader->mutex);
+        replaced_generation = reloader->pending_generation;
+        reloader->pending_generation = generation;
+    }
+
+    // reloaded again before the decode thread swapped in the previous one
+    if (NULL != replaced_generation)
+    {
+        inference_model_generation_destroy(replaced_generation);
+    }
+
+    fprintf(stderr, "Reloaded the model: %s\n", reloader->path.c_str());
+}
+
+static inline void inference_model_reloader_collect(inference_model_reloader *reloader)
+{
+    std::vector<inference_model_generation *> retired_generations;
+    {
+        std::lock_guard<std::mutex> lock(reloader->mutex);
+        retired_generations.swap(reloader->retired_generations);
+    }
+
+    // the decode thread has swapped out these generations, and thus they are NOT in use
+    for (inference_model_generation *const generation : retired_generations)
+    {
+        inference_model_generation_destroy(generation);
+    }
+}
+
+static inline void inference_model_generation_destroy(inference_model_generation *generation)
+{
+    // the predictor must be destroyed before the model
+    if (NULL != generation->predictor)
+    {
+        inference_predictor_destroy(generation->predictor);
+    }
+
+    if (NULL != generation->tflite_model)
+    {
+        TfLiteModelDelete(generation->tflite_model);
+    }
+
+    delete generation;
+}
@@ -0,0 +1,24 @@
+#ifndef _INFERENCE_MODEL_RELOADER_H_
+#define _INFERENCE_MODEL_RELOADER_H_ 1
+
+#include "inference-predictor.h"
+
+// The background thread watches the file of the model (inotify on Linux, and the last write time on Windows).
+// When the file changes, the model is loaded and the new predictor is created by the background thread, and thus the decode thread never waits for the reload.
+// The decode thread swaps in the new predictor between the frames, and the old predictor is destroyed by the background thread.
+struct inference_model_reloader;
+
+// The "path" is the TFLite model (the TFLite backends) or the NTM asset (the CPU backend), and the other arguments are the same as the "inference_predictor_create".
+// The "lod_base_width" / "lod_base_height" (0: the LOD is disabled) and the "sparse" are applied to the CPU engine of each reloaded model.
+// The "predictor" (created by the caller) is in use until the first reload, and is NOT destroyed by the reloader.
+// NULL: the backend does NOT use the file (e.g. the AOT engine), or the file can NOT be watched
+extern inference_model_reloader *inference_model_reloader_create(char const *path, inference_backend backend, ntm_cpu_isa cpu_isa, int lod_base_width, int lod_base_height, bool sparse, int num_threads, int tile_width, int tile_height);
+
+// The predictors of the reloaded models are destroyed, and thus the decode thread must have been stopped.
+extern void inference_model_reloader_destroy(inference_model_reloader *reloader);
+
+// Called by the decode thread between the frames, and never blocks.
+// The predictor of the latest reloaded model is returned, otherwise the "predictor" is returned.
+extern inference_predictor *inference_model_reloader_update(inference_model_reloader *reloader, inference_predictor *predictor);
+
+#endif
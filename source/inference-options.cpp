@@ -0,0 +1,654 @@
+#include "inference-options.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdio.h>
+
+static inline bool parse_integer(char const *string, int min_value, int max_value, char const **out_end, int *out_value);
+
+static inline bool parse_number(char const *string, double min_value, double max_value, double *out_value);
+
+static inline bool parse_resolutions(char const *string, inference_options *options);
+
+static inline bool parse_threads(char const *string, inference_options *options);
+
+static inline bool parse_layouts(char const *string, inference_options *options);
+
+extern bool parse_options(int argc, char *argv[], inference_options *out_options)
+{
+    inference_options options;
+    // resolved after all the arguments have been parsed
+    options.backend = INFERENCE_BACKEND_AUTO;
+    options.tflite_path = NULL;
+    options.model_path = NULL;
+    options.pack_path = NULL;
+    options.texture_name = NULL;
+    options.cpu_isa = ntm_cpu_detect_isa();
+    options.lod_base_width = 0;
+    options.lod_base_height = 0;
+    options.sparse = false;
+    options.validate = false;
+    options.benchmark = false;
+    options.benchmark_warmup_iterations = 3;
+    options.benchmark_iterations = 10;
+    options.benchmark_num_resolutions = 0;
+    options.num_threads = 0;
+    options.num_layouts = 0;
+    options.output_path = NULL;
+    options.benchmark_report_path = NULL;
+    options.regression = false;
+    options.regression_target_path = NULL;
+    options.regression_golden_path = NULL;
+    options.regression_baseline_path = NULL;
+    options.regression_update_golden = false;
+    options.regression_update_baseline = false;
+    // the rounding of the different ISAs (or the thread counts) merely changes a few texels by one
+    options.regression_min_golden_psnr = 45.0;
+    options.regression_min_golden_ssim = 0.995;
+    options.regression_max_psnr_drop = 0.1;
+    options.regression_max_ssim_drop = 0.001;
+    // the noise of the timing is usually within 5%
+    options.regression_max_slowdown = 0.1;
+    options.sparsity = false;
+    options.bake = false;
+    // 4 rows of the tiles
+    options.bake_band_rows = 256;
+    options.bake_mip_levels = 1;
+    options.bake_bc = false;
+    options.bake_bc_encoding.format = NTM_BC_FORMAT_BC7;
+    options.bake_bc_encoding.quality = NTM_BC_QUALITY_FAST;
+    options.daemon_socket_path = NULL;
+    options.present_shm = true;
+    options.pipeline_depth = 3;
+    options.autotune_cache_path = NULL;
+    options.profile_path = NULL;
+    options.trace_path = NULL;
+
+    bool backend_specified = false;
+    bool valid = true;
+    for (int argument_index = 1; argument_index < argc; ++argument_index)
+    {
+        char const *const argument = argv[argument_index];
+        if (0 == strncmp(argument, "--backend=", 10U))
+        {
+            if (!inference_parse_backend(argument + 10U, &options.backend))
+            {
+                fprintf(stderr, "Unknown backend: %s\n", argument + 10U);
+                valid = false;
+            }
+            backend_specified = true;
+        }
+        else if (0 == strncmp(argument, "--autotune-cache=", 17U))
+        {
+            options.autotune_cache_path = argument + 17U;
+        }
+        else if (0 == strncmp(argument, "--tflite=", 9U))
+        {
+            options.tflite_path = argument + 9U;
+        }
+        else if (0 == strncmp(argument, "--model=", 8U))
+        {
+            options.model_path = argument + 8U;
+        }
+        else if (0 == strncmp(argument, "--pack=", 7U))
+        {
+            options.pack_path = argument + 7U;
+        }
+        else if (0 == strncmp(argument, "--texture=", 10U))
+        {
+            options.texture_name = argument + 10U;
+        }
+        else if (0 == strcmp(argument, "--isa=scalar"))
+        {
+            options.cpu_isa = NTM_CPU_ISA_SCALAR;
+        }
+        else if (0 == strcmp(argument, "--isa=avx2"))
+        {
+            options.cpu_isa = NTM_CPU_ISA_AVX2;
+        }
+        else if (0 == strcmp(argument, "--isa=avx512"))
+        {
+            options.cpu_isa = NTM_CPU_ISA_AVX512;
+        }
+        else if (0 == strcmp(argument, "--isa=avx512vnni"))
+        {
+            options.cpu_isa = NTM_CPU_ISA_AVX512_VNNI;
+        }
+        else if (0 == strncmp(argument, "--lod-base=", 11U))
+        {
+            char const *end;
+            if ((!parse_integer(argument + 11U, 1, 1 << 16, &end, &options.lod_base_width)) || ('x' != (*end)) || (!parse_integer(end + 1, 1, 1 << 16, &end, &options.lod_base_height)) || ('\0' != (*end)))
+            {
+                fprintf(stderr, "Invalid LOD base resolution: %s\n", argument + 11U);
+                valid = false;
+            }
+        }
+        else if (0 == strcmp(argument, "--sparse"))
+        {
+            options.sparse = true;
+        }
+        else if (0 == strcmp(argument, "--validate"))
+        {
+            options.validate = true;
+        }
+        else if (0 == strcmp(argument, "--benchmark"))
+        {
+            options.benchmark = true;
+        }
+        else if (0 == strcmp(argument, "--regression"))
+        {
+            options.regression = true;
+        }
+        else if (0 == strncmp(argument, "--target=", 9U))
+        {
+            options.regression_target_path = argument + 9U;
+        }
+        else if (0 == strncmp(argument, "--golden=", 9U))
+        {
+            options.regression_golden_path = argument + 9U;
+        }
+        else if (0 == strncmp(argument, "--baseline=", 11U))
+        {
+            options.regression_baseline_path = argument + 11U;
+        }
+        else if (0 == strcmp(argument, "--update-golden"))
+        {
+            options.regression_update_golden = true;
+        }
+        else if (0 == strcmp(argument, "--update-baseline"))
+        {
+            options.regression_update_baseline = true;
+        }
+        else if (0 == strncmp(argument, "--min-golden-psnr=", 18U))
+        {
+            if (!parse_number(argument + 18U, 0.0, 1000.0, &options.regression_min_golden_psnr))
+            {
+                fprintf(stderr, "Invalid PSNR: %s\n", argument + 18U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--min-golden-ssim=", 18U))
+        {
+            if (!parse_number(argument + 18U, 0.0, 1.0, &options.regression_min_golden_ssim))
+            {
+                fprintf(stderr, "Invalid SSIM: %s\n", argument + 18U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--max-psnr-drop=", 16U))
+        {
+            if (!parse_number(argument + 16U, 0.0, 1000.0, &options.regression_max_psnr_drop))
+            {
+                fprintf(stderr, "Invalid PSNR drop: %s\n", argument + 16U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--max-ssim-drop=", 16U))
+        {
+            if (!parse_number(argument + 16U, 0.0, 1.0, &options.regression_max_ssim_drop))
+            {
+                fprintf(stderr, "Invalid SSIM drop: %s\n", argument + 16U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--max-slowdown=", 15U))
+        {
+            // percent
+            double max_slowdown;
+            if (!parse_number(argument + 15U, 0.0, 100.0, &max_slowdown))
+            {
+                fprintf(stderr, "Invalid slowdown: %s\n", argument + 15U);
+                valid = false;
+            }
+            else
+            {
+                options.regression_max_slowdown = max_slowdown / 100.0;
+            }
+        }
+        else if (0 == strcmp(argument, "--sparsity"))
+        {
+            options.sparsity = true;
+        }
+        else if (0 == strncmp(argument, "--daemon=", 9U))
+        {
+            options.daemon_socket_path = argument + 9U;
+        }
+        else if (0 == strcmp(argument, "--bake"))
+        {
+            options.bake = true;
+        }
+        else if (0 == strncmp(argument, "--band-rows=", 12U))
+        {
+            char const *end;
+            if ((!parse_integer(argument + 12U, 1, 1 << 16, &end, &options.bake_band_rows)) || ('\0' != (*end)))
+            {
+                fprintf(stderr, "Invalid number of band rows: %s\n", argument + 12U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--mip-levels=", 13U))
+        {
+            char const *end;
+            if ((!parse_integer(argument + 13U, 0, 17, &end, &options.bake_mip_levels)) || ('\0' != (*end)))
+            {
+                fprintf(stderr, "Invalid number of mip levels: %s\n", argument + 13U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--bc=", 5U))
+        {
+            options.bake_bc = true;
+            if (!ntm_bc_format_parse(argument + 5U, &options.bake_bc_encoding.format))
+            {
+                fprintf(stderr, "Unknown block-compressed format: %s\n", argument + 5U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--bc-quality=", 13U))
+        {
+            if (!ntm_bc_quality_parse(argument + 13U, &options.bake_bc_encoding.quality))
+            {
+                fprintf(stderr, "Unknown quality of the block compression: %s\n", argument + 13U);
+                valid = false;
+            }
+        }
+        else if (0 == strcmp(argument, "--present=shm"))
+        {
+            options.present_shm = true;
+        }
+        else if (0 == strcmp(argument, "--present=put-image"))
+        {
+            options.present_shm = false;
+        }
+        else if (0 == strncmp(argument, "--pipeline-depth=", 17U))
+        {
+            char const *end;
+            if ((!parse_integer(argument + 17U, 1, INFERENCE_MAX_PIPELINE_DEPTH, &end, &options.pipeline_depth)) || ('\0' != (*end)))
+            {
+                fprintf(stderr, "Invalid pipeline depth: %s\n", argument + 17U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--warmup=", 9U))
+        {
+            char const *end;
+            if ((!parse_integer(argument + 9U, 0, 1 << 20, &end, &options.benchmark_warmup_iterations)) || ('\0' != (*end)))
+            {
+                fprintf(stderr, "Invalid number of warm-up iterations: %s\n", argument + 9U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--iterations=", 13U))
+        {
+            char const *end;
+            if ((!parse_integer(argument + 13U, 1, 1 << 20, &end, &options.benchmark_iterations)) || ('\0' != (*end)))
+            {
+                fprintf(stderr, "Invalid number of iterations: %s\n", argument + 13U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--resolution=", 13U))
+        {
+            if (!parse_resolutions(argument + 13U, &options))
+            {
+                fprintf(stderr, "Invalid resolutions: %s\n", argument + 13U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--threads=", 10U))
+        {
+            if (!parse_threads(argument + 10U, &options))
+            {
+                fprintf(stderr, "Invalid thread counts: %s\n", argument + 10U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--layout=", 9U))
+        {
+            if (!parse_layouts(argument + 9U, &options))
+            {
+                fprintf(stderr, "Invalid layouts: %s\n", argument + 9U);
+                valid = false;
+            }
+        }
+        else if (0 == strncmp(argument, "--output=", 9U))
+        {
+            options.output_path = argument + 9U;
+        }
+        else if (0 == strncmp(argument, "--report=", 9U))
+        {
+            options.benchmark_report_path = argument + 9U;
+        }
+        else if (0 == strncmp(argument, "--profile=", 10U))
+        {
+            options.profile_path = argument + 10U;
+        }
+        else if (0 == strncmp(argument, "--trace=", 8U))
+        {
+            options.trace_path = argument + 8U;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option: %s\n", argument);
+            valid = false;
+        }
+    }
+
+    // The headless modes measure (or use) the reference interpreter by default, while the interactive mode selects the fastest backend.
+    // The LOD, the sparsity (and the measurement of the sparsity) are merely supported by the CPU backend.
+    // The daemon shares one CPU engine (for each texture of the pack) among all the clients.
+    bool const cpu_required = (0 != options.lod_base_width) || options.sparse || options.sparsity || (NULL != options.daemon_socket_path);
+    if (!backend_specified)
+    {
+        options.backend = cpu_required ? INFERENCE_BACKEND_CPU : ((options.benchmark || options.regression || options.bake || options.validate) ? INFERENCE_BACKEND_TFLITE : INFERENCE_BACKEND_AUTO);
+    }
+    else if (cpu_required && (INFERENCE_BACKEND_CPU != options.backend))
+    {
+        fprintf(stderr, "The LOD, the sparsity and the daemon are merely supported by the CPU backend\n");
+        valid = false;
+    }
+
+    if (((INFERENCE_BACKEND_CPU == options.backend) || options.validate) && (NULL == options.daemon_socket_path) && (NULL == options.model_path) && ((NULL == options.pack_path) || (NULL == options.texture_name)))
+    {
+        fprintf(stderr, "Either the NTM asset or the NTM pack and the texture name is required by the CPU backend\n");
+        valid = false;
+    }
+
+    // the reference interpreter is NOT band-limited
+    if (options.validate && (0 != options.lod_base_width))
+    {
+        fprintf(stderr, "The validation can NOT be used with the LOD\n");
+        valid = false;
+    }
+
+    if (options.sparsity && (options.benchmark || options.regression || options.bake || options.validate))
+    {
+        fprintf(stderr, "The sparsity can NOT be used with the benchmark, the regression, the bake or the validation\n");
+        valid = false;
+    }
+
+    // the texture name is chosen by each request of the clients
+    if ((NULL != options.daemon_socket_path) && ((NULL == options.pack_path) || (NULL != options.model_path)))
+    {
+        fprintf(stderr, "The NTM pack (rather than the NTM asset) is required by the daemon\n");
+        valid = false;
+    }
+
+    if ((NULL != options.daemon_socket_path) && (options.benchmark || options.regression || options.bake || options.sparsity || options.validate))
+    {
+        fprintf(stderr, "The daemon can NOT be used with the benchmark, the regression, the bake, the sparsity or the validation\n");
+        valid = false;
+    }
+
+    if (options.benchmark && options.validate)
+    {
+        fprintf(stderr, "The benchmark and the validation can NOT be used at the same time\n");
+        valid = false;
+    }
+
+    if (options.bake && (options.benchmark || options.validate))
+    {
+        fprintf(stderr, "The bake can NOT be used with the benchmark or the validation\n");
+        valid = false;
+    }
+
+    if (options.regression && (options.benchmark || options.bake || options.validate))
+    {
+        fprintf(stderr, "The regression can NOT be used with the benchmark, the bake or the validation\n");
+        valid = false;
+    }
+
+    if ((options.regression_update_golden && (NULL == options.regression_golden_path)) || (options.regression_update_baseline && (NULL == options.regression_baseline_path)))
+    {
+        fprintf(stderr, "The golden images (or the baseline) to update are required\n");
+        valid = false;
+    }
+
+    if (options.bake && (NULL == options.output_path))
+    {
+        fprintf(stderr, "The output is required by the bake\n");
+        valid = false;
+    }
+
+    if (options.bake_bc && (!options.bake))
+    {
+        fprintf(stderr, "The block compression is merely supported by the bake\n");
+        valid = false;
+    }
+
+    // the number of pixels is used as the "int" dimension of the TFLite tensor (the bake decodes the bands and thus is NOT limited)
+    if (!options.bake)
+    {
+        for (int resolution_index = 0; resolution_index < options.benchmark_num_resolutions; ++resolution_index)
+        {
+            if ((static_cast<int64_t>(options.benchmark_resolutions[resolution_index][0]) * static_cast<int64_t>(options.benchmark_resolutions[resolution_index][1])) > (static_cast<int64_t>(1) << 28))
+            {
+                fprintf(stderr, "Too large resolution: %dx%d\n", options.benchmark_resolutions[resolution_index][0], options.benchmark_resolutions[resolution_index][1]);
+                valid = false;
+            }
+        }
+    }
+
+    if (0 == options.benchmark_num_resolutions)
+    {
+        options.benchmark_num_resolutions = 1;
+        options.benchmark_resolutions[0][0] = 512;
+        options.benchmark_resolutions[0][1] = 512;
+    }
+
+    if (0 == options.num_threads)
+    {
+        options.num_threads = 1;
+        options.threads[0] = 0;
+    }
+
+    if (0 == options.num_layouts)
+    {
+        options.num_layouts = 1;
+        options.layouts[0] = NTM_LAYOUT_LINEAR;
+    }
+
+    // the bands of the bake are row-major
+    if (options.bake && ((options.num_layouts > 1) || (NTM_LAYOUT_LINEAR != options.layouts[0])))
+    {
+        fprintf(stderr, "The bake merely supports the linear layout\n");
+        valid = false;
+    }
+
+    if (!valid)
+    {
+        fprintf(stderr, "Usage: %s [--backend=auto|tflite|xnnpack|gpu|cpu|aot] [--autotune-cache=<path>] [--tflite=<TFLite model>] [--model=<NTM asset>] [--pack=<NTM pack> --texture=<name>] [--isa=scalar|avx2|avx512|avx512vnni] [--lod-base=<W>x<H>] [--sparse] [--threads=<N>] [--layout=linear|tiled|morton] [--present=shm|put-image] [--pipeline-depth=<N>] [--profile=<JSON|CSV>] [--trace=<JSON>] [--validate]\n", (argc > 0) ? argv[0] : "Neural-Texture-Mapping");
+        fprintf(stderr, "       %s --benchmark [--warmup=<N>] [--iterations=<N>] [--resolution=<W>x<H>[,<W>x<H>...]] [--threads=<N>[,<N>...]] [--layout=linear|tiled|morton[,...]] [--output=<PNG>] [--report=<JSON>] [--profile=<JSON|CSV>] [--trace=<JSON>] [<backend options>]\n", (argc > 0) ? argv[0] : "Neural-Texture-Mapping");
+        fprintf(stderr, "       %s --regression [--target=<PNG>] [--golden=<directory>] [--baseline=<path>] [--update-golden] [--update-baseline] [--min-golden-psnr=<dB>] [--min-golden-ssim=<SSIM>] [--max-psnr-drop=<dB>] [--max-ssim-drop=<SSIM>] [--max-slowdown=<percent>] [--warmup=<N>] [--iterations=<N>] [--resolution=<W>x<H>[,<W>x<H>...]] [--threads=<N>[,<N>...]] [--layout=linear|tiled|morton[,...]] [--report=<JSON>] [<backend options>]\n", (argc > 0) ? argv[0] : "Neural-Texture-Mapping");
+        fprintf(stderr, "       %s --sparsity (--model=<NTM asset> | --pack=<NTM pack> --texture=<name>) [--resolution=<W>x<H>] [--report=<JSON>]\n", (argc > 0) ? argv[0] : "Neural-Texture-Mapping");
+        fprintf(stderr, "       %s --bake --output=<PNG|RAW|KTX2> [--resolution=<W>x<H>] [--band-rows=<N>] [--mip-levels=<N>] [--bc=bc1|bc7 [--bc-quality=fast|high]] [--threads=<N>] [--profile=<JSON|CSV>] [--trace=<JSON>] [<backend options>]\n", (argc > 0) ? argv[0] : "Neural-Texture-Mapping");
+        fprintf(stderr, "       %s --daemon=<socket> --pack=<NTM pack> [--isa=scalar|avx2|avx512|avx512vnni] [--lod-base=<W>x<H>] [--sparse] [--threads=<N>] [--profile=<JSON|CSV>] [--trace=<JSON>]\n", (argc > 0) ? argv[0] : "Neural-Texture-Mapping");
+        return false;
+    }
+
+    (*out_options) = options;
+    return true;
+}
+
+extern char const *inference_backend_name(inference_backend backend)
+{
+    switch (backend)
+    {
+    case INFERENCE_BACKEND_CPU:
+        return "cpu";
+    case INFERENCE_BACKEND_AOT:
+        return "aot";
+    case INFERENCE_BACKEND_TFLITE_XNNPACK:
+        return "xnnpack";
+    case INFERENCE_BACKEND_TFLITE_GPU:
+        return "gpu";
+    case INFERENCE_BACKEND_AUTO:
+        return "auto";
+    default:
+        assert(INFERENCE_BACKEND_TFLITE == backend);
+        return "tflite";
+    }
+}
+
+extern bool inference_parse_backend(char const *name, inference_backend *out_backend)
+{
+    static inference_backend const backends[] = {INFERENCE_BACKEND_TFLITE, INFERENCE_BACKEND_CPU, INFERENCE_BACKEND_AOT, INFERENCE_BACKEND_TFLITE_XNNPACK, INFERENCE_BACKEND_TFLITE_GPU, INFERENCE_BACKEND_AUTO};
+
+    for (inference_backend const backend : backends)
+    {
+        if (0 == strcmp(name, inference_backend_name(backend)))
+        {
+            (*out_backend) = backend;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static inline bool parse_integer(char const *string, int min_value, int max_value, char const **out_end, int *out_value)
+{
+    // "strtol" accepts the leading white spaces and signs
+    if (!(('0' <= (*string)) && ((*string) <= '9')))
+    {
+        return false;
+    }
+
+    char *end = NULL;
+    long const value = strtol(string, &end, 10);
+    if ((value < min_value) || (value > max_value))
+    {
+        return false;
+    }
+
+    (*out_end) = end;
+    (*out_value) = static_cast<int>(value);
+    return true;
+}
+
+static inline bool parse_number(char const *string, double min_value, double max_value, double *out_value)
+{
+    // "strtod" accepts the leading white spaces and signs
+    if (!((('0' <= (*string)) && ((*string) <= '9')) || ('.' == (*string))))
+    {
+        return false;
+    }
+
+    char *end = NULL;
+    double const value = strtod(string, &end);
+    if (('\0' != (*end)) || (!(value >= min_value)) || (!(value <= max_value)))
+    {
+        return false;
+    }
+
+    (*out_value) = value;
+    return true;
+}
+
+static inline bool parse_resolutions(char const *string, inference_options *options)
+{
+    char const *cursor = string;
+    while (true)
+    {
+        if (options->benchmark_num_resolutions >= INFERENCE_MAX_BENCHMARK_RESOLUTIONS)
+        {
+            return false;
+        }
+
+        int width;
+        int height;
+        if ((!parse_integer(cursor, 1, 1 << 16, &cursor, &width)) || ('x' != (*cursor)) || (!parse_integer(cursor + 1, 1, 1 << 16, &cursor, &height)))
+        {
+            return false;
+        }
+
+        options->benchmark_resolutions[options->benchmark_num_resolutions][0] = width;
+        options->benchmark_resolutions[options->benchmark_num_resolutions][1] = height;
+        ++options->benchmark_num_resolutions;
+
+        if ('\0' == (*cursor))
+        {
+            return true;
+        }
+        else if (',' == (*cursor))
+        {
+            ++cursor;
+        }
+        else
+        {
+            return false;
+        }
+    }
+}
+
+static inline bool parse_threads(char const *string, inference_options *options)
+{
+    char const *cursor = string;
+    while (true)
+    {
+        if (options->num_threads >= INFERENCE_MAX_THREAD_COUNTS)
+        {
+            return false;
+        }
+
+        int num_threads;
+        if (!parse_integer(cursor, 0, 256, &cursor, &num_threads))
+        {
+            return false;
+        }
+
+        options->threads[options->num_threads] = num_threads;
+        ++options->num_threads;
+
+        if ('\0' == (*cursor))
+        {
+            return true;
+        }
+        else if (',' == (*cursor))
+        {
+            ++cursor;
+        }
+        else
+        {
+            return false;
+        }
+    }
+}
+
+static inline bool parse_layouts(char const *string, inference_options *options)
+{
+    char const *cursor = string;
+    while (true)
+    {
+        if (options->num_layouts >= static_cast<int>(NTM_LAYOUT_COUNT))
+        {
+            return false;
+        }
+
+        char const *const separator = strchr(cursor, ',');
+        size_t const length = (NULL != separator) ? static_cast<size_t>(separator - cursor) : strlen(cursor);
+
+        char name[16];
+        if (length >= sizeof(name))
+        {
+            return false;
+        }
+        memcpy(name, cursor, length);
+        name[length] = '\0';
+
+        if (!ntm_layout_parse(name, &options->layouts[options->num_layouts]))
+        {
+            return false;
+        }
+        ++options->num_layouts;
+
+        if (NULL == separator)
+        {
+            return true;
+        }
+
+        cursor = separator + 1;
+    }
+}
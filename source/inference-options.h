@@ -0,0 +1,122 @@
+#ifndef _INFERENCE_OPTIONS_H_
+#define _INFERENCE_OPTIONS_H_ 1
+
+#include "ntm-cpu-inference.h"
+#include "ntm-layout.h"
+#include "ntm-bc-encoder.h"
+
+enum inference_backend
+{
+    // the reference TFLite interpreter (without any delegate)
+    INFERENCE_BACKEND_TFLITE = 0,
+    INFERENCE_BACKEND_CPU = 1,
+    // the network compiled ahead of time ("neural-texture-mapping-aot.inl")
+    INFERENCE_BACKEND_AOT = 2,
+    INFERENCE_BACKEND_TFLITE_XNNPACK = 3,
+    INFERENCE_BACKEND_TFLITE_GPU = 4,
+    // resolved by the "inference_autotune" before any predictor is created
+    INFERENCE_BACKEND_AUTO = 5
+};
+
+static constexpr int const INFERENCE_MAX_BENCHMARK_RESOLUTIONS = 16;
+
+static constexpr int const INFERENCE_MAX_THREAD_COUNTS = 16;
+
+static constexpr int const INFERENCE_MAX_PIPELINE_DEPTH = 8;
+
+struct inference_options
+{
+    inference_backend backend;
+    // NULL: the TFLite model compiled into the executable
+    char const *tflite_path;
+    char const *model_path;
+    char const *pack_path;
+    char const *texture_name;
+    ntm_cpu_isa cpu_isa;
+    // The base resolution of the LOD of the CPU backend (see the "ntm_cpu_engine_enable_lod"), 0: the LOD is disabled
+    int lod_base_width;
+    int lod_base_height;
+    // The "dense_sparse" kernels of the CPU backend (see the "ntm_cpu_engine_enable_sparsity")
+    bool sparse;
+    bool validate;
+    // The interactive mode uses the first thread count, and 0 is one worker for each hardware thread.
+    int num_threads;
+    int threads[INFERENCE_MAX_THREAD_COUNTS];
+    // The order in which the texels are evaluated and stored (the interactive mode uses the first layout and deswizzles for the presentation).
+    int num_layouts;
+    ntm_layout layouts[NTM_LAYOUT_COUNT];
+
+    // Headless Benchmark
+    // Each combination of the resolutions, the "threads" and the "layouts" is measured.
+    bool benchmark;
+    int benchmark_warmup_iterations;
+    int benchmark_iterations;
+    int benchmark_num_resolutions;
+    // The bake merely uses the first resolution.
+    int benchmark_resolutions[INFERENCE_MAX_BENCHMARK_RESOLUTIONS][2];
+    // NULL: the decoded image is NOT dumped (the bake requires the output)
+    char const *output_path;
+    // NULL: the report is written to the stdout
+    char const *benchmark_report_path;
+
+    // Regression
+    // Each combination of the resolutions, the "threads" and the "layouts" is decoded, and compared with the target, the golden images and the baseline.
+    bool regression;
+    // NULL: the quality is NOT measured against the target (e.g. the "assets/target.png")
+    char const *regression_target_path;
+    // The directory of the golden images ("<W>x<H>.png"), NULL: the golden images are NOT compared
+    char const *regression_golden_path;
+    // The throughput and the quality against the target of each combination (on this machine), NULL: NOT compared
+    char const *regression_baseline_path;
+    // The golden images (or the baseline) are written instead of compared.
+    bool regression_update_golden;
+    bool regression_update_baseline;
+    // The thresholds: the golden images must be (almost) the same, while the baseline merely allows the small loss.
+    double regression_min_golden_psnr;
+    double regression_min_golden_ssim;
+    double regression_max_psnr_drop;
+    double regression_max_ssim_drop;
+    // the fraction of the throughput of the baseline, e.g. 0.1 for 10% slower
+    double regression_max_slowdown;
+
+    // Sparsity
+    // The rates of the zero outputs of each neuron are measured at the first resolution, and the report (JSON) is written to the "benchmark_report_path" (NULL: the stdout).
+    bool sparsity;
+
+    // Streaming Bake
+    bool bake;
+    int bake_band_rows;
+    // The mip chain: the level L (> 0) is written to "<output>-mip<L>.<extension>", 0: the full chain (down to 1x1)
+    int bake_mip_levels;
+    // The texture is encoded into the BC1 / BC7 blocks as soon as each tile has been decoded (the output must be ".ktx2").
+    bool bake_bc;
+    ntm_bc_encoding bake_bc_encoding;
+
+    // Decode Daemon (Linux)
+    // The Unix domain socket of the daemon, NULL: NOT the daemon
+    // The clients request the regions of the textures of the "pack_path", and all the requests are decoded by the CPU backend (see the "ntm-decode-client.h").
+    char const *daemon_socket_path;
+
+    // XCB: the decoder writes into the shared memory which backs the pixmap (MIT-SHM) instead of the "xcb_put_image" (falls back when the MIT-SHM is NOT available)
+    bool present_shm;
+    // The number of the frame buffers between the decode thread and the presentation thread (the interactive mode).
+    int pipeline_depth;
+
+    // NULL: the default location (the user cache directory)
+    char const *autotune_cache_path;
+
+    // Profiler (all modes): the histograms of the stages are written at the exit (and on the SIGUSR1 for the interactive mode on Linux)
+    // NULL: the profiler is disabled unless the trace is required
+    char const *profile_path;
+    // NULL: the trace events are NOT recorded
+    char const *trace_path;
+};
+
+extern bool parse_options(int argc, char *argv[], inference_options *out_options);
+
+// The same as the "--backend" option: "tflite", "xnnpack", "gpu", "cpu", "aot" or "auto"
+extern char const *inference_backend_name(inference_backend backend);
+
+extern bool inference_parse_backend(char const *name, inference_backend *out_backend);
+
+#endif
@@ -0,0 +1,767 @@
+#include "inference-predictor.h"
+#include "ntm-thread-pool.h"
+#include "ntm-profiler.h"
+#include <tensorflow/lite/delegates/gpu/delegate.h>
+#include <tensorflow/lite/delegates/xnnpack/xnnpack_delegate.h>
+#include <assert.h>
+#include <stdio.h>
+#include <new>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+struct inference_worker
+{
+    TfLiteInterpreter *tflite_interpreter;
+    float (*tflite_input)[2];
+    float (*tflite_output)[3];
+    // AOT: the UVs and the RGBs of the tile
+    std::vector<float[2]> aot_input;
+    std::vector<float[3]> cpu_output;
+    // CPU (MORTON): the row-major pixels of the tile before swizzled
+    // AOT or TFLite (blocks): the row-major pixels of the tile before encoded
+    std::vector<uint8_t[4]> cpu_tile;
+};
+
+struct inference_predictor
+{
+    inference_backend backend;
+    // GPU or XNNPACK: owned by the predictor
+    TfLiteDelegate *tflite_delegate;
+    // XNNPACK: the threads of the delegate, otherwise: the workers
+    int num_threads;
+    ntm_cpu_engine const *cpu_engine;
+    ntm_aot_engine const *aot_engine;
+    // TFLite or AOT: the ISA of the output stage (the "ntm_cpu_pack_pixels")
+    ntm_cpu_isa cpu_isa;
+    int tile_width;
+    int tile_height;
+    // TFLite: the first dimension of the input tensor, which may be larger than the tile (the bucket of the "inference_predictor_reserve")
+    int tflite_input_size;
+    ntm_thread_pool *thread_pool;
+    std::vector<inference_worker> workers;
+};
+
+struct inference_predict_job
+{
+    inference_predictor *predictor;
+    uint8_t (*out_bit_RGBs)[4];
+    int texture_width;
+    int texture_height;
+    int row_begin;
+    int row_end;
+    int num_tiles_x;
+    // TILED or MORTON: the storage is split into the chunks of "tile_width * tile_height" texels
+    ntm_layout layout;
+    size_t layout_size;
+    // NOT NULL: the rows of the blocks (the "out_bit_RGBs" is NOT used)
+    uint8_t *out_blocks;
+    size_t out_blocks_row_pitch;
+    ntm_bc_encoder const *bc_encoder;
+    ntm_bc_encoding const *bc_encoding;
+    std::atomic<uint64_t> bc_error;
+};
+
+static void inference_predict_tile(void *user_data, uint32_t worker_index, uint32_t tile_index);
+
+static void inference_predict_chunk(void *user_data, uint32_t worker_index, uint32_t chunk_index);
+
+static inline void inference_encode_tile(inference_predict_job *job, int tile_x, int tile_y, int tile_width, int tile_height, uint8_t const (*tile)[4]);
+
+static inline bool inference_backend_is_tflite(inference_backend backend);
+
+static inline int inference_tflite_input_bucket(int tile_size);
+
+static inline bool inference_tflite_resize_input(inference_worker *worker, int input_size);
+
+static inline void inference_tflite_delegate_delete(inference_backend backend, TfLiteDelegate *tflite_delegate);
+
+extern inference_predictor *inference_predictor_create(inference_backend backend, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine, ntm_cpu_isa cpu_isa, int num_threads, int tile_width, int tile_height)
+{
+    assert(INFERENCE_BACKEND_AUTO != backend);
+    assert((tile_width >= 1) && (tile_height >= 1));
+    assert(num_threads >= 0);
+
+    TfLiteDelegate *tflite_delegate = NULL;
+    int num_workers = num_threads;
+    if (INFERENCE_BACKEND_TFLITE_GPU == backend)
+    {
+        TfLiteGpuDelegateOptionsV2 tflite_delegate_options = TfLiteGpuDelegateOptionsV2Default();
+        tflite_delegate_options.experimental_flags = TFLITE_GPU_EXPERIMENTAL_FLAGS_NONE;
+
+        // NULL: e.g. there is no GPU (or no OpenCL driver)
+        tflite_delegate = TfLiteGpuDelegateV2Create(&tflite_delegate_options);
+        if (NULL == tflite_delegate)
+        {
+            return NULL;
+        }
+
+        num_threads = 1;
+        num_workers = 1;
+    }
+    else if (INFERENCE_BACKEND_TFLITE_XNNPACK == backend)
+    {
+        if (0 == num_threads)
+        {
+            // may be zero if NOT computable
+            num_threads = static_cast<int>(std::thread::hardware_concurrency());
+            num_threads = (num_threads >= 1) ? num_threads : 1;
+        }
+
+        TfLiteXNNPackDelegateOptions tflite_delegate_options = TfLiteXNNPackDelegateOptionsDefault();
+        tflite_delegate_options.num_threads = num_threads;
+
+        tflite_delegate = TfLiteXNNPackDelegateCreate(&tflite_delegate_options);
+        if (NULL == tflite_delegate)
+        {
+            return NULL;
+        }
+
+        // the parallelism is provided by the delegate
+        num_workers = 1;
+    }
+
+    inference_predictor *predictor = new (std::nothrow) inference_predictor;
+    if (NULL == predictor)
+    {
+        if (NULL != tflite_delegate)
+        {
+            inference_tflite_delegate_delete(backend, tflite_delegate);
+        }
+        return NULL;
+    }
+
+    predictor->backend = backend;
+    predictor->tflite_delegate = tflite_delegate;
+
+    predictor->thread_pool = ntm_thread_pool_create(static_cast<uint32_t>(num_workers));
+    if (NULL == predictor->thread_pool)
+    {
+        inference_predictor_destroy(predictor);
+        return NULL;
+    }
+
+    predictor->num_threads = (INFERENCE_BACKEND_TFLITE_XNNPACK == backend) ? num_threads : static_cast<int>(ntm_thread_pool_get_num_workers(predictor->thread_pool));
+    predictor->cpu_engine = cpu_engine;
+    predictor->aot_engine = aot_engine;
+    predictor->cpu_isa = cpu_isa;
+    predictor->tile_width = tile_width;
+    predictor->tile_height = tile_height;
+    predictor->tflite_input_size = tile_width * tile_height;
+
+    size_t const tile_size = static_cast<size_t>(tile_width) * static_cast<size_t>(tile_height);
+
+    predictor->workers.resize(ntm_thread_pool_get_num_workers(predictor->thread_pool));
+    for (inference_worker &worker : predictor->workers)
+    {
+        worker.tflite_interpreter = NULL;
+    }
+
+    for (inference_worker &worker : predictor->workers)
+    {
+        worker.tflite_input = NULL;
+        worker.tflite_output = NULL;
+
+        if (inference_backend_is_tflite(backend))
+        {
+            {
+                TfLiteInterpreterOptions *tflite_interpreter_options = TfLiteInterpreterOptionsCreate();
+                assert(tflite_interpreter_options);
+
+                // the parallelism is provided by the workers
+                TfLiteInterpreterOptionsSetNumThreads(tflite_interpreter_options, 1);
+
+                if (NULL != tflite_delegate)
+                {
+                    TfLiteInterpreterOptionsAddDelegate(tflite_interpreter_options, tflite_delegate);
+                }
+
+                // NULL: e.g. the delegate fails to be applied
+                worker.tflite_interpreter = TfLiteInterpreterCreate(tflite_model, tflite_interpreter_options);
+
+                TfLiteInterpreterOptionsDelete(tflite_interpreter_options);
+            }
+
+            if (NULL == worker.tflite_interpreter)
+            {
+                inference_predictor_destroy(predictor);
+                return NULL;
+            }
+
+            // the delegate may fail to prepare the resized tensors
+            if (!inference_tflite_resize_input(&worker, predictor->tflite_input_size))
+            {
+                inference_predictor_destroy(predictor);
+                return NULL;
+            }
+        }
+        else if (INFERENCE_BACKEND_CPU == backend)
+        {
+            // the output stage is fused into the "ntm_cpu_engine_predict_grid_pixels" and thus there is no intermediate float RGB
+            assert(NULL != cpu_engine);
+
+            worker.cpu_tile = std::vector<uint8_t[4]>(tile_size);
+        }
+        else
+        {
+            assert(INFERENCE_BACKEND_AOT == backend);
+            assert(NULL != aot_engine);
+
+            worker.aot_input = std::vector<float[2]>(tile_size);
+            worker.cpu_output = std::vector<float[3]>(tile_size);
+        }
+
+        if (INFERENCE_BACKEND_CPU != backend)
+        {
+            worker.cpu_tile = std::vector<uint8_t[4]>(tile_size);
+        }
+    }
+
+    return predictor;
+}
+
+extern inference_predictor *inference_predictor_create_with_fallback(inference_backend *inout_backend, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine, ntm_cpu_isa cpu_isa, int num_threads, int tile_width, int tile_height)
+{
+    while (true)
+    {
+        inference_predictor *predictor = inference_predictor_create((*inout_backend), tflite_model, cpu_engine, aot_engine, cpu_isa, num_threads, tile_width, tile_height);
+        if (NULL != predictor)
+        {
+            return predictor;
+        }
+
+        inference_backend fallback_backend;
+        if (INFERENCE_BACKEND_TFLITE_GPU == (*inout_backend))
+        {
+            fallback_backend = INFERENCE_BACKEND_TFLITE_XNNPACK;
+        }
+        else if (INFERENCE_BACKEND_TFLITE_XNNPACK == (*inout_backend))
+        {
+            fallback_backend = INFERENCE_BACKEND_TFLITE;
+        }
+        else
+        {
+            return NULL;
+        }
+
+        fprintf(stderr, "Failed to create the \"%s\" backend, falls back to the \"%s\" backend\n", inference_backend_name(*inout_backend), inference_backend_name(fallback_backend));
+        (*inout_backend) = fallback_backend;
+    }
+}
+
+extern void inference_predictor_destroy(inference_predictor *predictor)
+{
+    for (inference_worker &worker : predictor->workers)
+    {
+        if (NULL != worker.tflite_interpreter)
+        {
+            TfLiteInterpreterDelete(worker.tflite_interpreter);
+        }
+    }
+
+    // the interpreters must be deleted before the delegate
+    if (NULL != predictor->tflite_delegate)
+    {
+        inference_tflite_delegate_delete(predictor->backend, predictor->tflite_delegate);
+    }
+
+    if (NULL != predictor->thread_pool)
+    {
+        ntm_thread_pool_destroy(predictor->thread_pool);
+    }
+
+    delete predictor;
+}
+
+extern int inference_predictor_get_num_threads(inference_predictor const *predictor)
+{
+    return predictor->num_threads;
+}
+
+extern void inference_predictor_get_tile_size(inference_backend backend, int texture_width, int texture_height, int *out_tile_width, int *out_tile_height)
+{
+    if ((INFERENCE_BACKEND_TFLITE_GPU == backend) || (INFERENCE_BACKEND_TFLITE_XNNPACK == backend))
+    {
+        // one invocation: the delegate parallelizes within the invocation
+        (*out_tile_width) = texture_width;
+        (*out_tile_height) = texture_height;
+    }
+    else
+    {
+        (*out_tile_width) = INFERENCE_TILE_SIZE;
+        (*out_tile_height) = INFERENCE_TILE_SIZE;
+    }
+}
+
+extern bool inference_predictor_reserve(inference_predictor *predictor, int texture_width, int texture_height)
+{
+    int tile_width;
+    int tile_height;
+    inference_predictor_get_tile_size(predictor->backend, texture_width, texture_height, &tile_width, &tile_height);
+
+    int const tile_size = tile_width * tile_height;
+
+    // The input tensor is reused as long as it is NOT smaller than the tile and NOT larger than the bucket of the tile, namely, at most 25% of the invocation is the padding.
+    // CPU or AOT (or the INFERENCE_TILE_SIZE tiles of the TFLite): the size of the tile is independent of the resolution, and thus nothing is reallocated.
+    if (inference_backend_is_tflite(predictor->backend) && ((predictor->tflite_input_size < tile_size) || (predictor->tflite_input_size > inference_tflite_input_bucket(tile_size))))
+    {
+        int const input_size = inference_tflite_input_bucket(tile_size);
+
+        for (inference_worker &worker : predictor->workers)
+        {
+            if (!inference_tflite_resize_input(&worker, input_size))
+            {
+                // the previous tensors have been prepared before, and the texture is decoded in the tiles of the previous size
+                for (inference_worker &restored_worker : predictor->workers)
+                {
+                    bool result_resize_input = inference_tflite_resize_input(&restored_worker, predictor->tflite_input_size);
+                    assert(result_resize_input);
+                    (void)result_resize_input;
+                }
+
+                return false;
+            }
+        }
+
+        predictor->tflite_input_size = input_size;
+    }
+
+    predictor->tile_width = tile_width;
+    predictor->tile_height = tile_height;
+
+    for (inference_worker &worker : predictor->workers)
+    {
+        if (INFERENCE_BACKEND_AOT == predictor->backend)
+        {
+            if (worker.aot_input.size() < static_cast<size_t>(tile_size))
+            {
+                worker.aot_input = std::vector<float[2]>(static_cast<size_t>(tile_size));
+                worker.cpu_output = std::vector<float[3]>(static_cast<size_t>(tile_size));
+            }
+        }
+
+        if ((INFERENCE_BACKEND_CPU != predictor->backend) && (worker.cpu_tile.size() < static_cast<size_t>(tile_size)))
+        {
+            worker.cpu_tile = std::vector<uint8_t[4]>(static_cast<size_t>(tile_size));
+        }
+    }
+
+    return true;
+}
+
+extern void predict(uint8_t (*out_bit_RGBs)[4], int texture_width, int texture_height, inference_predictor *predictor)
+{
+    predict_rows(out_bit_RGBs, texture_width, texture_height, 0, texture_height, predictor);
+}
+
+extern void predict_rows(uint8_t (*out_bit_RGBs)[4], int texture_width, int texture_height, int row_begin, int num_rows, inference_predictor *predictor)
+{
+    assert((row_begin >= 0) && (num_rows >= 1) && ((row_begin + num_rows) <= texture_height));
+
+    inference_predict_job job;
+    job.predictor = predictor;
+    job.out_bit_RGBs = out_bit_RGBs;
+    job.texture_width = texture_width;
+    job.texture_height = texture_height;
+    job.row_begin = row_begin;
+    job.row_end = row_begin + num_rows;
+    job.num_tiles_x = (texture_width + predictor->tile_width - 1) / predictor->tile_width;
+    job.layout = NTM_LAYOUT_LINEAR;
+    job.layout_size = 0U;
+    job.out_blocks = NULL;
+    job.out_blocks_row_pitch = 0U;
+    job.bc_encoder = NULL;
+    job.bc_encoding = NULL;
+    job.bc_error = 0U;
+
+    int const num_tiles_y = (num_rows + predictor->tile_height - 1) / predictor->tile_height;
+
+    uint64_t const decode_begin = ntm_profiler_now();
+
+    ntm_thread_pool_parallel_for(predictor->thread_pool, static_cast<uint32_t>(job.num_tiles_x * num_tiles_y), inference_predict_tile, &job);
+
+    ntm_profiler_record(NTM_PROFILER_STAGE_DECODE, decode_begin, ntm_profiler_now());
+}
+
+extern uint64_t predict_blocks(void *out_blocks, int texture_width, int texture_height, int row_begin, int num_rows, ntm_bc_encoder const *bc_encoder, ntm_bc_encoding const *bc_encoding, inference_predictor *predictor)
+{
+    assert((row_begin >= 0) && (num_rows >= 1) && ((row_begin + num_rows) <= texture_height));
+    assert((0 == (row_begin % 4)) && ((0 == (num_rows % 4)) || ((row_begin + num_rows) == texture_height)));
+    assert((0 == (predictor->tile_width % 4)) && (0 == (predictor->tile_height % 4)));
+
+    inference_predict_job job;
+    job.predictor = predictor;
+    job.out_bit_RGBs = NULL;
+    job.texture_width = texture_width;
+    job.texture_height = texture_height;
+    job.row_begin = row_begin;
+    job.row_end = row_begin + num_rows;
+    job.num_tiles_x = (texture_width + predictor->tile_width - 1) / predictor->tile_width;
+    job.layout = NTM_LAYOUT_LINEAR;
+    job.layout_size = 0U;
+    job.out_blocks = static_cast<uint8_t *>(out_blocks);
+    job.out_blocks_row_pitch = static_cast<size_t>(ntm_bc_block_size(bc_encoding->format)) * static_cast<size_t>((texture_width + 3) / 4);
+    job.bc_encoder = bc_encoder;
+    job.bc_encoding = bc_encoding;
+    job.bc_error = 0U;
+
+    int const num_tiles_y = (num_rows + predictor->tile_height - 1) / predictor->tile_height;
+
+    uint64_t const decode_begin = ntm_profiler_now();
+
+    ntm_thread_pool_parallel_for(predictor->thread_pool, static_cast<uint32_t>(job.num_tiles_x * num_tiles_y), inference_predict_tile, &job);
+
+    ntm_profiler_record(NTM_PROFILER_STAGE_DECODE, decode_begin, ntm_profiler_now());
+
+    return job.bc_error.load();
+}
+
+extern void predict_layout(uint8_t (*out_texels)[4], int texture_width, int texture_height, ntm_layout layout, inference_predictor *predictor)
+{
+    if (NTM_LAYOUT_LINEAR == layout)
+    {
+        predict(out_texels, texture_width, texture_height, predictor);
+        return;
+    }
+
+    inference_predict_job job;
+    job.predictor = predictor;
+    job.out_bit_RGBs = out_texels;
+    job.texture_width = texture_width;
+    job.texture_height = texture_height;
+    job.row_begin = 0;
+    job.row_end = texture_height;
+    job.num_tiles_x = (texture_width + static_cast<int>(NTM_LAYOUT_TILE_SIZE) - 1) / static_cast<int>(NTM_LAYOUT_TILE_SIZE);
+    job.layout = layout;
+    job.layout_size = ntm_layout_get_size(layout, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height));
+    job.out_blocks = NULL;
+    job.out_blocks_row_pitch = 0U;
+    job.bc_encoder = NULL;
+    job.bc_encoding = NULL;
+    job.bc_error = 0U;
+
+    // The CPU engine evaluates one tile of the layout as the grid.
+    size_t const chunk_size = static_cast<size_t>(predictor->tile_width) * static_cast<size_t>(predictor->tile_height);
+    assert((INFERENCE_BACKEND_CPU != predictor->backend) || ((NTM_LAYOUT_TILE_SIZE * NTM_LAYOUT_TILE_SIZE) == chunk_size));
+
+    uint64_t const decode_begin = ntm_profiler_now();
+
+    ntm_thread_pool_parallel_for(predictor->thread_pool, static_cast<uint32_t>((job.layout_size + chunk_size - 1U) / chunk_size), inference_predict_chunk, &job);
+
+    ntm_profiler_record(NTM_PROFILER_STAGE_DECODE, decode_begin, ntm_profiler_now());
+}
+
+static void inference_predict_tile(void *user_data, uint32_t worker_index, uint32_t tile_index)
+{
+    inference_predict_job *const job = static_cast<inference_predict_job *>(user_data);
+    inference_predictor *const predictor = job->predictor;
+    inference_worker *const worker = &predictor->workers[worker_index];
+
+    int const tile_x = (static_cast<int>(tile_index) % job->num_tiles_x) * predictor->tile_width;
+    int const tile_y = job->row_begin + (static_cast<int>(tile_index) / job->num_tiles_x) * predictor->tile_height;
+    int const tile_width = ((job->texture_width - tile_x) < predictor->tile_width) ? (job->texture_width - tile_x) : predictor->tile_width;
+    int const tile_height = ((job->row_end - tile_y) < predictor->tile_height) ? (job->row_end - tile_y) : predictor->tile_height;
+    int const tile_size = tile_width * tile_height;
+
+    // blocks: the pixels of the tile are written into the scratch of the worker (the row pitch is the tile width) and then encoded
+    uint8_t(*const out_pixels)[4] = (NULL != job->out_blocks) ? &worker->cpu_tile[0] : job->out_bit_RGBs;
+    int const out_pixels_width = (NULL != job->out_blocks) ? tile_width : job->texture_width;
+    int const out_pixels_x = (NULL != job->out_blocks) ? 0 : tile_x;
+    int const out_pixels_y = (NULL != job->out_blocks) ? 0 : (tile_y - job->row_begin);
+
+    if ((INFERENCE_BACKEND_CPU == predictor->backend) && (NULL != job->out_blocks))
+    {
+        // The decoding is fused with the encoding, and thus the pixels never touch the memory of the tile.
+        uint8_t *const out_tile_blocks = job->out_blocks + (job->out_blocks_row_pitch * static_cast<size_t>((tile_y - job->row_begin) / 4) + static_cast<size_t>(ntm_bc_block_size(job->bc_encoding->format)) * static_cast<size_t>(tile_x / 4));
+        job->bc_error += ntm_bc_encoder_predict_grid(job->bc_encoder, job->bc_encoding, predictor->cpu_engine, static_cast<uint32_t>(job->texture_width), static_cast<uint32_t>(job->texture_height), static_cast<uint32_t>(tile_x), static_cast<uint32_t>(tile_y), static_cast<uint32_t>(tile_width), static_cast<uint32_t>(tile_height), out_tile_blocks, job->out_blocks_row_pitch);
+    }
+    else if (INFERENCE_BACKEND_CPU == predictor->backend)
+    {
+        // The tile is a regular grid, and thus the UVs are NOT generated.
+        // The pixels are written into the texture directly.
+        ntm_pixel_encoding const encoding = {NTM_PIXEL_FORMAT_B8G8R8A8_UNORM, false};
+        uint8_t(*const out_tile)[4] = job->out_bit_RGBs + (static_cast<size_t>(job->texture_width) * (tile_y - job->row_begin) + tile_x);
+        ntm_cpu_engine_predict_grid_pixels(predictor->cpu_engine, static_cast<uint32_t>(job->texture_width), static_cast<uint32_t>(job->texture_height), static_cast<uint32_t>(tile_x), static_cast<uint32_t>(tile_y), static_cast<uint32_t>(tile_width), static_cast<uint32_t>(tile_height), &encoding, out_tile, sizeof(uint8_t[4]) * static_cast<size_t>(job->texture_width));
+    }
+    else if (INFERENCE_BACKEND_AOT == predictor->backend)
+    {
+        uint64_t const generate_UVs_begin = ntm_profiler_now();
+
+        generate_UVs(&worker->aot_input[0], job->texture_width, job->texture_height, tile_x, tile_y, tile_width, tile_height);
+
+        uint64_t const predict_begin = ntm_profiler_now();
+        ntm_profiler_record(NTM_PROFILER_STAGE_GENERATE_UVS, generate_UVs_begin, predict_begin);
+
+        ntm_aot_engine_predict(predictor->aot_engine, static_cast<uint32_t>(tile_size), &worker->aot_input[0], &worker->cpu_output[0]);
+
+        uint64_t const output_begin = ntm_profiler_now();
+        ntm_profiler_record(NTM_PROFILER_STAGE_AOT_PREDICT, predict_begin, output_begin);
+
+        store_bit_RGBs(predictor->cpu_isa, out_pixels, out_pixels_width, out_pixels_x, out_pixels_y, tile_width, tile_height, &worker->cpu_output[0]);
+
+        ntm_profiler_record(NTM_PROFILER_STAGE_OUTPUT, output_begin, ntm_profiler_now());
+
+        if (NULL != job->out_blocks)
+        {
+            inference_encode_tile(job, tile_x, tile_y, tile_width, tile_height, out_pixels);
+        }
+    }
+    else
+    {
+        assert(inference_backend_is_tflite(predictor->backend));
+
+        uint64_t const generate_UVs_begin = ntm_profiler_now();
+
+        generate_UVs(worker->tflite_input, job->texture_width, job->texture_height, tile_x, tile_y, tile_width, tile_height);
+
+        // The input tensor is NOT resized for the smaller tiles at the edges (or the tile smaller than the bucket), and the remaining inputs replicate the last pixel.
+        int const input_size = predictor->tflite_input_size;
+        for (int pixel_index = tile_size; pixel_index < input_size; ++pixel_index)
+        {
+            worker->tflite_input[pixel_index][0] = worker->tflite_input[tile_size - 1][0];
+            worker->tflite_input[pixel_index][1] = worker->tflite_input[tile_size - 1][1];
+        }
+
+        uint64_t const invoke_begin = ntm_profiler_now();
+        ntm_profiler_record(NTM_PROFILER_STAGE_GENERATE_UVS, generate_UVs_begin, invoke_begin);
+
+        TfLiteStatus tflite_status_invoke = TfLiteInterpreterInvoke(worker->tflite_interpreter);
+        assert(kTfLiteOk == tflite_status_invoke);
+        (void)tflite_status_invoke;
+
+        uint64_t const output_begin = ntm_profiler_now();
+        ntm_profiler_record(NTM_PROFILER_STAGE_TFLITE_INVOKE, invoke_begin, output_begin);
+
+        store_bit_RGBs(predictor->cpu_isa, out_pixels, out_pixels_width, out_pixels_x, out_pixels_y, tile_width, tile_height, worker->tflite_output);
+
+        ntm_profiler_record(NTM_PROFILER_STAGE_OUTPUT, output_begin, ntm_profiler_now());
+
+        if (NULL != job->out_blocks)
+        {
+            inference_encode_tile(job, tile_x, tile_y, tile_width, tile_height, out_pixels);
+        }
+    }
+}
+
+static void inference_predict_chunk(void *user_data, uint32_t worker_index, uint32_t chunk_index)
+{
+    inference_predict_job const *const job = static_cast<inference_predict_job const *>(user_data);
+    inference_predictor *const predictor = job->predictor;
+    inference_worker *const worker = &predictor->workers[worker_index];
+
+    size_t const chunk_size = static_cast<size_t>(predictor->tile_width) * static_cast<size_t>(predictor->tile_height);
+    size_t const chunk_begin = chunk_size * chunk_index;
+    int const count = static_cast<int>(((job->layout_size - chunk_begin) < chunk_size) ? (job->layout_size - chunk_begin) : chunk_size);
+
+    if (INFERENCE_BACKEND_CPU == predictor->backend)
+    {
+        // The chunk is exactly one tile of the layout.
+        int const tile_x = (static_cast<int>(chunk_index) % job->num_tiles_x) * static_cast<int>(NTM_LAYOUT_TILE_SIZE);
+        int const tile_y = (static_cast<int>(chunk_index) / job->num_tiles_x) * static_cast<int>(NTM_LAYOUT_TILE_SIZE);
+        int const tile_width = ((job->texture_width - tile_x) < static_cast<int>(NTM_LAYOUT_TILE_SIZE)) ? (job->texture_width - tile_x) : static_cast<int>(NTM_LAYOUT_TILE_SIZE);
+        int const tile_height = ((job->texture_height - tile_y) < static_cast<int>(NTM_LAYOUT_TILE_SIZE)) ? (job->texture_height - tile_y) : static_cast<int>(NTM_LAYOUT_TILE_SIZE);
+
+        // TILED: the storage of the tile is the row-major grid whose row pitch is the tile size
+        // MORTON: the grid is decoded into the scratch of the worker (within the cache) and then swizzled
+        ntm_pixel_encoding const encoding = {NTM_PIXEL_FORMAT_B8G8R8A8_UNORM, false};
+        uint8_t(*const out_tile)[4] = job->out_bit_RGBs + chunk_begin;
+        uint8_t(*const out_grid)[4] = (NTM_LAYOUT_TILED == job->layout) ? out_tile : &worker->cpu_tile[0];
+        ntm_cpu_engine_predict_grid_pixels(predictor->cpu_engine, static_cast<uint32_t>(job->texture_width), static_cast<uint32_t>(job->texture_height), static_cast<uint32_t>(tile_x), static_cast<uint32_t>(tile_y), static_cast<uint32_t>(tile_width), static_cast<uint32_t>(tile_height), &encoding, out_grid, sizeof(uint8_t[4]) * NTM_LAYOUT_TILE_SIZE);
+
+        if (NTM_LAYOUT_MORTON == job->layout)
+        {
+            uint64_t const output_begin = ntm_profiler_now();
+
+            ntm_layout_swizzle_tile(NTM_LAYOUT_MORTON, static_cast<uint32_t>(tile_width), static_cast<uint32_t>(tile_height), out_grid, sizeof(uint8_t[4]) * NTM_LAYOUT_TILE_SIZE, out_tile);
+
+            ntm_profiler_record(NTM_PROFILER_STAGE_OUTPUT, output_begin, ntm_profiler_now());
+        }
+        return;
+    }
+
+    // The UVs are generated in the order of the storage, and thus each batch of the network and the written texels are contiguous in the storage.
+    float(*const UVs)[2] = (INFERENCE_BACKEND_AOT == predictor->backend) ? &worker->aot_input[0] : worker->tflite_input;
+
+    uint64_t const generate_UVs_begin = ntm_profiler_now();
+
+    generate_layout_UVs(UVs, job->texture_width, job->texture_height, job->layout, chunk_begin, count);
+
+    uint64_t const predict_begin = ntm_profiler_now();
+    ntm_profiler_record(NTM_PROFILER_STAGE_GENERATE_UVS, generate_UVs_begin, predict_begin);
+
+    float const(*prediction_RGBs)[3];
+    if (INFERENCE_BACKEND_AOT == predictor->backend)
+    {
+        ntm_aot_engine_predict(predictor->aot_engine, static_cast<uint32_t>(count), UVs, &worker->cpu_output[0]);
+        prediction_RGBs = &worker->cpu_output[0];
+
+        ntm_profiler_record(NTM_PROFILER_STAGE_AOT_PREDICT, predict_begin, ntm_profiler_now());
+    }
+    else
+    {
+        assert(inference_backend_is_tflite(predictor->backend));
+
+        // the same as the tiles at the edges
+        for (size_t texel_index = static_cast<size_t>(count); texel_index < static_cast<size_t>(predictor->tflite_input_size); ++texel_index)
+        {
+            UVs[texel_index][0] = UVs[count - 1][0];
+            UVs[texel_index][1] = UVs[count - 1][1];
+        }
+
+        TfLiteStatus tflite_status_invoke = TfLiteInterpreterInvoke(worker->tflite_interpreter);
+        assert(kTfLiteOk == tflite_status_invoke);
+        (void)tflite_status_invoke;
+
+        prediction_RGBs = worker->tflite_output;
+
+        ntm_profiler_record(NTM_PROFILER_STAGE_TFLITE_INVOKE, predict_begin, ntm_profiler_now());
+    }
+
+    uint64_t const output_begin = ntm_profiler_now();
+
+    ntm_pixel_encoding const encoding = {NTM_PIXEL_FORMAT_B8G8R8A8_UNORM, false};
+    ntm_cpu_pack_pixels(predictor->cpu_isa, &encoding, static_cast<uint32_t>(count), prediction_RGBs, job->out_bit_RGBs + chunk_begin);
+
+    ntm_profiler_record(NTM_PROFILER_STAGE_OUTPUT, output_begin, ntm_profiler_now());
+}
+
+static inline void inference_encode_tile(inference_predict_job *job, int tile_x, int tile_y, int tile_width, int tile_height, uint8_t const (*tile)[4])
+{
+    uint64_t const encode_begin = ntm_profiler_now();
+
+    size_t const block_size = ntm_bc_block_size(job->bc_encoding->format);
+
+    uint64_t error = 0U;
+    for (int block_y = 0; block_y < tile_height; block_y += 4)
+    {
+        uint32_t const num_rows = ((tile_height - block_y) < 4) ? static_cast<uint32_t>(tile_height - block_y) : 4U;
+        uint8_t *const out_block_row = job->out_blocks + (job->out_blocks_row_pitch * static_cast<size_t>((tile_y - job->row_begin + block_y) / 4) + block_size * static_cast<size_t>(tile_x / 4));
+        error += ntm_bc_encoder_encode_rows(job->bc_encoder, job->bc_encoding, static_cast<uint32_t>(tile_width), num_rows, tile + static_cast<size_t>(tile_width) * block_y, sizeof(uint8_t[4]) * static_cast<size_t>(tile_width), out_block_row);
+    }
+
+    job->bc_error += error;
+
+    ntm_profiler_record(NTM_PROFILER_STAGE_BLOCK_COMPRESS, encode_begin, ntm_profiler_now());
+}
+
+extern void generate_UVs(float (*out_UVs)[2], int texture_width, int texture_height, int tile_x, int tile_y, int tile_width, int tile_height)
+{
+    for (int h = 0; h < tile_height; ++h)
+    {
+        for (int w = 0; w < tile_width; ++w)
+        {
+            out_UVs[tile_width * h + w][0] = ((tile_x + w) + 0.5F) / texture_width;
+            out_UVs[tile_width * h + w][1] = ((tile_y + h) + 0.5F) / texture_height;
+        }
+    }
+}
+
+extern void generate_layout_UVs(float (*out_UVs)[2], int texture_width, int texture_height, ntm_layout layout, size_t index_begin, int count)
+{
+    if (NTM_LAYOUT_LINEAR == layout)
+    {
+        for (int texel_index = 0; texel_index < count; ++texel_index)
+        {
+            size_t const index = index_begin + static_cast<size_t>(texel_index);
+            out_UVs[texel_index][0] = (static_cast<int>(index % static_cast<size_t>(texture_width)) + 0.5F) / texture_width;
+            out_UVs[texel_index][1] = (static_cast<int>(index / static_cast<size_t>(texture_width)) + 0.5F) / texture_height;
+        }
+        return;
+    }
+
+    // The range is walked tile by tile, and thus the division is merely for each tile rather than each texel.
+    int texel_index = 0;
+    while (texel_index < count)
+    {
+        size_t const index = index_begin + static_cast<size_t>(texel_index);
+
+        uint32_t tile_x;
+        uint32_t tile_y;
+        ntm_layout_get_coordinate(layout, static_cast<uint32_t>(texture_width), index - (index % (NTM_LAYOUT_TILE_SIZE * NTM_LAYOUT_TILE_SIZE)), &tile_x, &tile_y);
+
+        uint32_t const tile_texel_begin = static_cast<uint32_t>(index % (NTM_LAYOUT_TILE_SIZE * NTM_LAYOUT_TILE_SIZE));
+        uint32_t const tile_texel_end = ((NTM_LAYOUT_TILE_SIZE * NTM_LAYOUT_TILE_SIZE - tile_texel_begin) < static_cast<uint32_t>(count - texel_index)) ? (NTM_LAYOUT_TILE_SIZE * NTM_LAYOUT_TILE_SIZE) : (tile_texel_begin + static_cast<uint32_t>(count - texel_index));
+
+        for (uint32_t tile_texel_index = tile_texel_begin; tile_texel_index < tile_texel_end; ++tile_texel_index)
+        {
+            uint32_t x;
+            uint32_t y;
+            ntm_layout_get_coordinate(layout, NTM_LAYOUT_TILE_SIZE, tile_texel_index, &x, &y);
+            x += tile_x;
+            y += tile_y;
+
+            // the padding texels replicate the edges of the texture
+            x = (x < static_cast<uint32_t>(texture_width)) ? x : static_cast<uint32_t>(texture_width - 1);
+            y = (y < static_cast<uint32_t>(texture_height)) ? y : static_cast<uint32_t>(texture_height - 1);
+
+            out_UVs[texel_index][0] = (x + 0.5F) / texture_width;
+            out_UVs[texel_index][1] = (y + 0.5F) / texture_height;
+            ++texel_index;
+        }
+    }
+}
+
+extern void store_bit_RGBs(ntm_cpu_isa isa, uint8_t (*out_bit_RGBs)[4], int texture_width, int tile_x, int tile_y, int tile_width, int tile_height, float const (*prediction_RGBs)[3])
+{
+    ntm_pixel_encoding const encoding = {NTM_PIXEL_FORMAT_B8G8R8A8_UNORM, false};
+
+    for (int h = 0; h < tile_height; ++h)
+    {
+        uint8_t(*const out_row)[4] = out_bit_RGBs + (static_cast<size_t>(texture_width) * (tile_y + h) + tile_x);
+
+        ntm_cpu_pack_pixels(isa, &encoding, static_cast<uint32_t>(tile_width), prediction_RGBs + tile_width * h, out_row);
+    }
+}
+
+static inline bool inference_backend_is_tflite(inference_backend backend)
+{
+    return (INFERENCE_BACKEND_TFLITE == backend) || (INFERENCE_BACKEND_TFLITE_XNNPACK == backend) || (INFERENCE_BACKEND_TFLITE_GPU == backend);
+}
+
+static inline int inference_tflite_input_bucket(int tile_size)
+{
+    assert(tile_size >= 1);
+
+    // the buckets are "m * 2^k" (m = 4, 5, 6 or 7), and thus the adjacent buckets differ by at most 25%
+    int exponent = 0;
+    while ((7 << exponent) < tile_size)
+    {
+        ++exponent;
+    }
+
+    int mantissa = 4;
+    while ((mantissa << exponent) < tile_size)
+    {
+        ++mantissa;
+    }
+
+    return (mantissa << exponent);
+}
+
+static inline bool inference_tflite_resize_input(inference_worker *worker, int input_size)
+{
+    // The arena of the interpreter is NOT shrunk, and thus merely the larger bucket than before allocates the memory.
+    int tflite_input_dims[2] = {input_size, 2};
+    if ((kTfLiteOk != TfLiteInterpreterResizeInputTensor(worker->tflite_interpreter, 0, tflite_input_dims, sizeof(tflite_input_dims) / sizeof(tflite_input_dims[0]))) || (kTfLiteOk != TfLiteInterpreterAllocateTensors(worker->tflite_interpreter)))
+    {
+        return false;
+    }
+
+    // the tensors may have been moved by the allocation
+    worker->tflite_input = reinterpret_cast<float(*)[2]>(TfLiteInterpreterGetInputTensor(worker->tflite_interpreter, 0)->data.f);
+    worker->tflite_output = reinterpret_cast<float(*)[3]>(TfLiteInterpreterGetOutputTensor(worker->tflite_interpreter, 0)->data.f);
+    return true;
+}
+
+static inline void inference_tflite_delegate_delete(inference_backend backend, TfLiteDelegate *tflite_delegate)
+{
+    if (INFERENCE_BACKEND_TFLITE_GPU == backend)
+    {
+        TfLiteGpuDelegateV2Delete(tflite_delegate);
+    }
+    else
+    {
+        assert(INFERENCE_BACKEND_TFLITE_XNNPACK == backend);
+        TfLiteXNNPackDelegateDelete(tflite_delegate);
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef _INFERENCE_PREDICTOR_H_
+#define _INFERENCE_PREDICTOR_H_ 1
+
+#include <tensorflow/lite/c/c_api.h>
+#include "inference-options.h"
+#include "ntm-aot-inference.h"
+#include "ntm-layout.h"
+#include "ntm-bc-encoder.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// The texture is decoded tile by tile, and the tiles are scheduled by the work-stealing thread pool.
+static constexpr int const INFERENCE_TILE_SIZE = 64;
+
+static_assert(NTM_LAYOUT_TILE_SIZE == INFERENCE_TILE_SIZE, "one tile of the layout is one tile of the worker");
+
+struct inference_predictor;
+
+// Each worker owns its inference state: the TFLite interpreter (whose input is resized to one tile) or the scratch memory of the CPU engine (or the AOT engine).
+// The GPU (or XNNPACK) delegate is owned by the predictor. A delegate can only be applied to one interpreter, and thus there is exactly one worker when the delegate is used (the XNNPACK delegate owns the "num_threads" threads instead).
+// The tile may be as large as the whole texture (e.g. the GPU delegate prefers one invocation), and the tiles at the edges of the texture may be smaller.
+// 0 == num_threads: one worker (or one thread of the XNNPACK delegate) for each hardware thread
+// The "cpu_isa" (e.g. the "--isa") is the ISA of the output stage of the TFLite and AOT backends, which is downgraded to the best ISA supported by the current CPU.
+// NULL: the delegate (or the interpreter) can NOT be created, e.g. there is no GPU
+extern inference_predictor *inference_predictor_create(inference_backend backend, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine, ntm_cpu_isa cpu_isa, int num_threads, int tile_width, int tile_height);
+
+// The GPU delegate falls back to the XNNPACK delegate, and the XNNPACK delegate falls back to the reference interpreter, such that the missing accelerator never fails the startup.
+// The "inout_backend" is updated to the backend which is actually used.
+extern inference_predictor *inference_predictor_create_with_fallback(inference_backend *inout_backend, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine, ntm_cpu_isa cpu_isa, int num_threads, int tile_width, int tile_height);
+
+extern void inference_predictor_destroy(inference_predictor *predictor);
+
+// XNNPACK: the threads of the delegate, otherwise: the workers
+extern int inference_predictor_get_num_threads(inference_predictor const *predictor);
+
+// The delegates decode the whole texture in one invocation, while the others decode the INFERENCE_TILE_SIZE tiles on the workers.
+extern void inference_predictor_get_tile_size(inference_backend backend, int texture_width, int texture_height, int *out_tile_width, int *out_tile_height);
+
+// Called when the resolution changes (e.g. the window is resized), and the tile of the predictor is updated by the "inference_predictor_get_tile_size".
+// The input tensor is bucketed ("m * 2^k", m = 4, 5, 6 or 7), and thus the interpreter is merely resized (and the tensors are merely allocated again) when the tile leaves the bucket.
+// The following "predict" (or "predict_rows", etc.) must be of the same resolution, and must NOT be concurrent with the "inference_predictor_reserve".
+// false: the delegate fails to prepare the resized tensors, and the texture is decoded in the tiles of the previous size
+extern bool inference_predictor_reserve(inference_predictor *predictor, int texture_width, int texture_height);
+
+extern void predict(uint8_t (*out_bit_RGBs)[4], int texture_width, int texture_height, inference_predictor *predictor);
+
+// Merely the rows [row_begin, row_begin + num_rows) of the texture are decoded, and the "out_bit_RGBs" is the band ([num_rows][texture_width]) rather than the whole texture.
+// The UVs are still of the whole texture, and thus the bands are exactly the same as the rows decoded by the "predict".
+extern void predict_rows(uint8_t (*out_bit_RGBs)[4], int texture_width, int texture_height, int row_begin, int num_rows, inference_predictor *predictor);
+
+// The same rows as the "predict_rows" except that the rows are encoded into the 4x4 blocks: each row of the blocks is "(texture_width + 3) / 4" contiguous blocks.
+// The "row_begin" is a multiple of 4, and the "num_rows" is a multiple of 4 unless the band is at the bottom of the texture (the tile size of the predictor must be a multiple of 4).
+// CPU: each tile is decoded strip by strip and encoded by the "ntm_bc_encoder_predict_grid", otherwise: each tile is decoded into the scratch of the worker and then encoded.
+// The sum of the squared errors of the blocks is returned.
+extern uint64_t predict_blocks(void *out_blocks, int texture_width, int texture_height, int row_begin, int num_rows, ntm_bc_encoder const *bc_encoder, ntm_bc_encoding const *bc_encoding, inference_predictor *predictor);
+
+// The "out_texels" is the storage of the "layout" (ntm_layout_get_size texels), and the LINEAR is the same as the "predict".
+// TILED or MORTON: the UVs are generated (and evaluated) in the order of the storage, and each tile of the layout is written contiguously.
+extern void predict_layout(uint8_t (*out_texels)[4], int texture_width, int texture_height, ntm_layout layout, inference_predictor *predictor);
+
+// The UVs of the tile are contiguous: [tile_height][tile_width]
+extern void generate_UVs(float (*out_UVs)[2], int texture_width, int texture_height, int tile_x, int tile_y, int tile_width, int tile_height);
+
+// The UVs of the texels [index_begin, index_begin + count) of the storage of the "layout" (the padding texels are clamped to the edges)
+extern void generate_layout_UVs(float (*out_UVs)[2], int texture_width, int texture_height, ntm_layout layout, size_t index_begin, int count);
+
+// The RGBs of the tile are contiguous while the "out_bit_RGBs" is the whole texture
+// The same output stage as the "ntm_cpu_engine_predict_grid_pixels" (clamped and rounded to the nearest, BGRA) of the "isa" (downgraded to the best ISA supported by the current CPU)
+extern void store_bit_RGBs(ntm_cpu_isa isa, uint8_t (*out_bit_RGBs)[4], int texture_width, int tile_x, int tile_y, int tile_width, int tile_height, float const (*prediction_RGBs)[3]);
+
+#endif
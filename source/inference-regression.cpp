@@ -0,0 +1,547 @@
+#include "inference-regression.h"
+#include "inference-predictor.h"
+#include "image-reader.h"
+#include "image-writer.h"
+#include "ntm-file.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <string>
+
+// the PSNR of the identical images is infinite, and is clamped such that the report is still valid JSON
+static constexpr double const REGRESSION_MAX_PSNR = 100.0;
+
+// the SSIM is averaged over the 8x8 windows (with the stride of 4) of each channel
+static constexpr int const REGRESSION_SSIM_WINDOW_SIZE = 8;
+
+static constexpr int const REGRESSION_SSIM_WINDOW_STRIDE = 4;
+
+struct regression_baseline_entry
+{
+    std::string backend;
+    int texture_width;
+    int texture_height;
+    int num_threads;
+    std::string layout;
+    double megapixels_per_second;
+    // negative: the target was NOT compared
+    double target_psnr;
+    double target_ssim;
+};
+
+struct regression_result
+{
+    int texture_width;
+    int texture_height;
+    int num_threads;
+    ntm_layout layout;
+    double megapixels_per_second;
+    // negative: NOT compared
+    double target_psnr;
+    double target_ssim;
+    double golden_psnr;
+    double golden_ssim;
+    // NULL: the baseline is NOT compared (or NOT found)
+    regression_baseline_entry const *baseline;
+    bool passed;
+};
+
+static inline bool regression_load_baseline(char const *path, std::vector<regression_baseline_entry> &out_entries);
+
+static inline bool regression_write_baseline(char const *path, char const *backend_name, std::vector<regression_result> const &results);
+
+static inline void regression_compare(int texture_width, int texture_height, uint8_t const (*bit_RGBs)[4], uint8_t const (*reference_bit_RGBs)[4], double *out_psnr, double *out_ssim);
+
+extern int regression(inference_options const *options, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine)
+{
+    assert(options->regression);
+    assert(options->benchmark_iterations >= 1);
+
+    char const *const backend_name = inference_backend_name(options->backend);
+
+    image_reader *target = NULL;
+    if (NULL != options->regression_target_path)
+    {
+        target = image_reader_open_png(options->regression_target_path);
+        if (NULL == target)
+        {
+            fprintf(stderr, "Failed to read the target: %s\n", options->regression_target_path);
+            return 1;
+        }
+    }
+
+    std::vector<regression_baseline_entry> baseline_entries;
+    // NOTE: the golden images are usually updated with the reference backend rather than the backend of the baseline
+    bool const compare_baseline = (NULL != options->regression_baseline_path) && (!options->regression_update_baseline) && (!options->regression_update_golden);
+    if (compare_baseline && (!regression_load_baseline(options->regression_baseline_path, baseline_entries)))
+    {
+        fprintf(stderr, "Failed to read the baseline: %s (--update-baseline)\n", options->regression_baseline_path);
+        if (NULL != target)
+        {
+            image_reader_close(target);
+        }
+        return 1;
+    }
+
+    std::vector<regression_result> results;
+
+    bool failed = false;
+    for (int resolution_index = 0; (!failed) && (resolution_index < options->benchmark_num_resolutions); ++resolution_index)
+    {
+        int const texture_width = options->benchmark_resolutions[resolution_index][0];
+        int const texture_height = options->benchmark_resolutions[resolution_index][1];
+        size_t const num_texels = static_cast<size_t>(texture_width) * static_cast<size_t>(texture_height);
+
+        // The target is sampled (nearest) at the texel centers, namely, the UVs of the decode, and thus any resolution is compared.
+        std::vector<uint8_t[4]> target_bit_RGBs((NULL != target) ? num_texels : 0U);
+        if (NULL != target)
+        {
+            uint32_t const target_width = image_reader_get_width(target);
+            uint32_t const target_height = image_reader_get_height(target);
+            uint8_t const(*const target_texels)[4] = image_reader_get_bit_RGBs(target);
+            for (int y = 0; y < texture_height; ++y)
+            {
+                uint32_t const target_y = static_cast<uint32_t>((static_cast<uint64_t>(2 * y + 1) * target_height) / (2U * static_cast<uint64_t>(texture_height)));
+                for (int x = 0; x < texture_width; ++x)
+                {
+                    uint32_t const target_x = static_cast<uint32_t>((static_cast<uint64_t>(2 * x + 1) * target_width) / (2U * static_cast<uint64_t>(texture_width)));
+                    memcpy(target_bit_RGBs[static_cast<size_t>(texture_width) * y + x], target_texels[static_cast<size_t>(target_width) * target_y + target_x], sizeof(uint8_t[4]));
+                }
+            }
+        }
+
+        // The golden image is of the resolution, and is shared by all thread counts and layouts (all of them must decode the same image).
+        // The "--update-golden" uses the first decode of the resolution.
+        std::string golden_path;
+        image_reader *golden = NULL;
+        std::vector<uint8_t[4]> golden_bit_RGBs;
+        if (NULL != options->regression_golden_path)
+        {
+            char golden_name[64];
+            snprintf(golden_name, sizeof(golden_name), "%dx%d.png", texture_width, texture_height);
+
+            golden_path = options->regression_golden_path;
+            if ((!golden_path.empty()) && ('/' != golden_path.back()) && ('\\' != golden_path.back()))
+            {
+                golden_path += '/';
+            }
+            golden_path += golden_name;
+
+            if (!options->regression_update_golden)
+            {
+                golden = image_reader_open_png(golden_path.c_str());
+                if (NULL == golden)
+                {
+                    fprintf(stderr, "Failed to read the golden image: %s (written by the \"golden-main.py\", or by the --update-golden)\n", golden_path.c_str());
+                    failed = true;
+                    break;
+                }
+
+                if ((static_cast<uint32_t>(texture_width) != image_reader_get_width(golden)) || (static_cast<uint32_t>(texture_height) != image_reader_get_height(golden)))
+                {
+                    fprintf(stderr, "The resolution of the golden image is NOT %dx%d: %s\n", texture_width, texture_height, golden_path.c_str());
+                    image_reader_close(golden);
+                    failed = true;
+                    break;
+                }
+            }
+        }
+
+        for (int threads_index = 0; (!failed) && (threads_index < options->num_threads); ++threads_index)
+        {
+            int tile_width;
+            int tile_height;
+            inference_predictor_get_tile_size(options->backend, texture_width, texture_height, &tile_width, &tile_height);
+
+            // NOTE: the regression never falls back, since the baseline is of the specified backend
+            inference_predictor *predictor = inference_predictor_create(options->backend, tflite_model, cpu_engine, aot_engine, options->cpu_isa, options->threads[threads_index], tile_width, tile_height);
+            if (NULL == predictor)
+            {
+                fprintf(stderr, "Failed to create the predictor\n");
+                failed = true;
+                break;
+            }
+
+            // 0 is resolved to the number of hardware threads
+            int const num_threads = inference_predictor_get_num_threads(predictor);
+
+            // row-major (the deswizzled image)
+            std::vector<uint8_t[4]> bit_RGBs(num_texels);
+
+            for (int layout_index = 0; (!failed) && (layout_index < options->num_layouts); ++layout_index)
+            {
+                ntm_layout const layout = options->layouts[layout_index];
+
+                std::vector<uint8_t[4]> texels((NTM_LAYOUT_LINEAR != layout) ? ntm_layout_get_size(layout, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height)) : 0U);
+                uint8_t(*const out_texels)[4] = (NTM_LAYOUT_LINEAR != layout) ? &texels[0] : &bit_RGBs[0];
+
+                for (int iteration_index = 0; iteration_index < options->benchmark_warmup_iterations; ++iteration_index)
+                {
+                    predict_layout(out_texels, texture_width, texture_height, layout, predictor);
+                }
+
+                // the fastest iteration is the least sensitive to the noise (e.g. the other processes), which is the same as the autotune
+                double best_ms = 0.0;
+                for (int iteration_index = 0; iteration_index < options->benchmark_iterations; ++iteration_index)
+                {
+                    std::chrono::steady_clock::time_point const begin = std::chrono::steady_clock::now();
+
+                    predict_layout(out_texels, texture_width, texture_height, layout, predictor);
+
+                    double const ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+                    best_ms = ((0 == iteration_index) || (ms < best_ms)) ? ms : best_ms;
+                }
+
+                if (NTM_LAYOUT_LINEAR != layout)
+                {
+                    ntm_layout_deswizzle(layout, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height), out_texels, &bit_RGBs[0], sizeof(uint8_t[4]) * static_cast<size_t>(texture_width));
+                }
+
+                regression_result result;
+                result.texture_width = texture_width;
+                result.texture_height = texture_height;
+                result.num_threads = num_threads;
+                result.layout = layout;
+                result.megapixels_per_second = (best_ms > 0.0) ? (static_cast<double>(num_texels) / (best_ms * 1000.0)) : 0.0;
+                result.target_psnr = -1.0;
+                result.target_ssim = -1.0;
+                result.golden_psnr = -1.0;
+                result.golden_ssim = -1.0;
+                result.baseline = NULL;
+                result.passed = true;
+
+                char configuration_name[96];
+                snprintf(configuration_name, sizeof(configuration_name), "%s %dx%d t%d %s", backend_name, texture_width, texture_height, num_threads, ntm_layout_name(layout));
+
+                if (NULL != target)
+                {
+                    regression_compare(texture_width, texture_height, &bit_RGBs[0], &target_bit_RGBs[0], &result.target_psnr, &result.target_ssim);
+                }
+
+                if (NULL != options->regression_golden_path)
+                {
+                    if ((NULL == golden) && golden_bit_RGBs.empty())
+                    {
+                        assert(options->regression_update_golden);
+
+                        golden_bit_RGBs = std::vector<uint8_t[4]>(num_texels);
+                        memcpy(&golden_bit_RGBs[0], &bit_RGBs[0], sizeof(uint8_t[4]) * num_texels);
+
+                        image_writer *writer = image_writer_open(golden_path.c_str(), IMAGE_FORMAT_PNG, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height));
+                        bool const result_write_rows = (NULL != writer) && image_writer_write_rows(writer, static_cast<uint32_t>(texture_height), &bit_RGBs[0]);
+                        bool const result_close = (NULL != writer) && image_writer_close(writer);
+                        if ((!result_write_rows) || (!result_close))
+                        {
+                            fprintf(stderr, "Failed to write the golden image: %s\n", golden_path.c_str());
+                            failed = true;
+                        }
+                        else
+                        {
+                            fprintf(stderr, "Golden: %s\n", golden_path.c_str());
+                        }
+                    }
+
+                    uint8_t const(*const reference_bit_RGBs)[4] = (NULL != golden) ? image_reader_get_bit_RGBs(golden) : &golden_bit_RGBs[0];
+                    regression_compare(texture_width, texture_height, &bit_RGBs[0], reference_bit_RGBs, &result.golden_psnr, &result.golden_ssim);
+
+                    if ((result.golden_psnr < options->regression_min_golden_psnr) || (result.golden_ssim < options->regression_min_golden_ssim))
+                    {
+                        fprintf(stderr, "Regression (%s): the golden image PSNR %.4f dB SSIM %.6f (the thresholds: %.4f dB %.6f)\n", configuration_name, result.golden_psnr, result.golden_ssim, options->regression_min_golden_psnr, options->regression_min_golden_ssim);
+                        result.passed = false;
+                    }
+                }
+
+                if (compare_baseline)
+                {
+                    for (regression_baseline_entry const &entry : baseline_entries)
+                    {
+                        // the last matching entry wins
+                        if ((entry.backend == backend_name) && (entry.texture_width == texture_width) && (entry.texture_height == texture_height) && (entry.num_threads == num_threads) && (entry.layout == ntm_layout_name(layout)))
+                        {
+                            result.baseline = &entry;
+                        }
+                    }
+
+                    if (NULL == result.baseline)
+                    {
+                        fprintf(stderr, "Regression (%s): NOT in the baseline (--update-baseline)\n", configuration_name);
+                        result.passed = false;
+                    }
+                    else
+                    {
+                        if (result.megapixels_per_second < (result.baseline->megapixels_per_second * (1.0 - options->regression_max_slowdown)))
+                        {
+                            fprintf(stderr, "Regression (%s): %.4f MP/s while the baseline is %.4f MP/s (the threshold: %.1f%% slower)\n", configuration_name, result.megapixels_per_second, result.baseline->megapixels_per_second, 100.0 * options->regression_max_slowdown);
+                            result.passed = false;
+                        }
+
+                        if ((NULL != target) && (result.baseline->target_psnr >= 0.0) && ((result.target_psnr < (result.baseline->target_psnr - options->regression_max_psnr_drop)) || (result.target_ssim < (result.baseline->target_ssim - options->regression_max_ssim_drop))))
+                        {
+                            fprintf(stderr, "Regression (%s): the target PSNR %.4f dB SSIM %.6f while the baseline is %.4f dB %.6f\n", configuration_name, result.target_psnr, result.target_ssim, result.baseline->target_psnr, result.baseline->target_ssim);
+                            result.passed = false;
+                        }
+                    }
+                }
+
+                results.push_back(result);
+            }
+
+            inference_predictor_destroy(predictor);
+        }
+
+        if (NULL != golden)
+        {
+            image_reader_close(golden);
+        }
+    }
+
+    if (NULL != target)
+    {
+        image_reader_close(target);
+    }
+
+    if (failed)
+    {
+        return 1;
+    }
+
+    if (options->regression_update_baseline)
+    {
+        if (!regression_write_baseline(options->regression_baseline_path, backend_name, results))
+        {
+            fprintf(stderr, "Failed to write the baseline: %s\n", options->regression_baseline_path);
+            return 1;
+        }
+
+        fprintf(stderr, "Baseline: %s\n", options->regression_baseline_path);
+    }
+
+    bool passed = true;
+    std::string report;
+    {
+        char buffer[512];
+
+        snprintf(buffer, sizeof(buffer), "{\n  \"backend\": \"%s\",\n  \"warmup_iterations\": %d,\n  \"iterations\": %d,\n  \"results\": [", backend_name, options->benchmark_warmup_iterations, options->benchmark_iterations);
+        report += buffer;
+
+        for (size_t result_index = 0U; result_index < results.size(); ++result_index)
+        {
+            regression_result const &result = results[result_index];
+
+            // null: NOT compared
+            char target_psnr[32] = "null";
+            char target_ssim[32] = "null";
+            char golden_psnr[32] = "null";
+            char golden_ssim[32] = "null";
+            char baseline_megapixels_per_second[32] = "null";
+            if (result.target_psnr >= 0.0)
+            {
+                snprintf(target_psnr, sizeof(target_psnr), "%.4f", result.target_psnr);
+                snprintf(target_ssim, sizeof(target_ssim), "%.6f", result.target_ssim);
+            }
+            if (result.golden_psnr >= 0.0)
+            {
+                snprintf(golden_psnr, sizeof(golden_psnr), "%.4f", result.golden_psnr);
+                snprintf(golden_ssim, sizeof(golden_ssim), "%.6f", result.golden_ssim);
+            }
+            if (NULL != result.baseline)
+            {
+                snprintf(baseline_megapixels_per_second, sizeof(baseline_megapixels_per_second), "%.4f", result.baseline->megapixels_per_second);
+            }
+
+            snprintf(buffer, sizeof(buffer), "%s\n    {\"width\": %d, \"height\": %d, \"threads\": %d, \"layout\": \"%s\", \"megapixels_per_second\": %.4f, \"baseline_megapixels_per_second\": %s, \"target_psnr\": %s, \"target_ssim\": %s, \"golden_psnr\": %s, \"golden_ssim\": %s, \"passed\": %s}", (result_index > 0U) ? "," : "", result.texture_width, result.texture_height, result.num_threads, ntm_layout_name(result.layout), result.megapixels_per_second, baseline_megapixels_per_second, target_psnr, target_ssim, golden_psnr, golden_ssim, result.passed ? "true" : "false");
+            report += buffer;
+
+            passed = passed && result.passed;
+        }
+
+        snprintf(buffer, sizeof(buffer), "\n  ],\n  \"passed\": %s\n}\n", passed ? "true" : "false");
+        report += buffer;
+    }
+
+    if (NULL != options->benchmark_report_path)
+    {
+        FILE *file = ntm_fopen_utf8(options->benchmark_report_path, "wb");
+        bool const result_write = (NULL != file) && (report.size() == fwrite(report.data(), 1U, report.size(), file));
+        bool const result_close = (NULL != file) && (0 == fclose(file));
+        if ((!result_write) || (!result_close))
+        {
+            fprintf(stderr, "Failed to write the regression report: %s\n", options->benchmark_report_path);
+            return 1;
+        }
+    }
+    else
+    {
+        fputs(report.c_str(), stdout);
+        fflush(stdout);
+    }
+
+    fprintf(stderr, "Regression: %s\n", passed ? "passed" : "FAILED");
+    return passed ? 0 : 1;
+}
+
+static inline bool regression_load_baseline(char const *path, std::vector<regression_baseline_entry> &out_entries)
+{
+    FILE *file = ntm_fopen_utf8(path, "rb");
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    // "<backend> <W>x<H> t<threads> <layout> <MP/s> <target PSNR> <target SSIM>" ("-" when the target was NOT compared), and "#" is the comment
+    char line[256];
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        if ('#' == line[0])
+        {
+            continue;
+        }
+
+        char backend[32];
+        char layout[32];
+        char target_psnr[32];
+        char target_ssim[32];
+        regression_baseline_entry entry;
+        if (8 != sscanf(line, "%31s %dx%d t%d %31s %lf %31s %31s", backend, &entry.texture_width, &entry.texture_height, &entry.num_threads, layout, &entry.megapixels_per_second, target_psnr, target_ssim))
+        {
+            continue;
+        }
+
+        entry.backend = backend;
+        entry.layout = layout;
+        entry.target_psnr = (0 != strcmp(target_psnr, "-")) ? strtod(target_psnr, NULL) : -1.0;
+        entry.target_ssim = (0 != strcmp(target_ssim, "-")) ? strtod(target_ssim, NULL) : -1.0;
+        out_entries.push_back(entry);
+    }
+
+    fclose(file);
+    return true;
+}
+
+static inline bool regression_write_baseline(char const *path, char const *backend_name, std::vector<regression_result> const &results)
+{
+    // NOTE: the baseline of the other backends (or the other combinations) is preserved
+    std::vector<regression_baseline_entry> entries;
+    regression_load_baseline(path, entries);
+
+    std::string text = "# <backend> <W>x<H> t<threads> <layout> <MP/s> <target PSNR> <target SSIM>\n";
+    char buffer[256];
+    for (regression_baseline_entry const &entry : entries)
+    {
+        bool replaced = false;
+        for (regression_result const &result : results)
+        {
+            replaced = replaced || ((entry.backend == backend_name) && (entry.texture_width == result.texture_width) && (entry.texture_height == result.texture_height) && (entry.num_threads == result.num_threads) && (entry.layout == ntm_layout_name(result.layout)));
+        }
+
+        if (!replaced)
+        {
+            char target_psnr[32] = "-";
+            char target_ssim[32] = "-";
+            if (entry.target_psnr >= 0.0)
+            {
+                snprintf(target_psnr, sizeof(target_psnr), "%.4f", entry.target_psnr);
+                snprintf(target_ssim, sizeof(target_ssim), "%.6f", entry.target_ssim);
+            }
+
+            snprintf(buffer, sizeof(buffer), "%s %dx%d t%d %s %.4f %s %s\n", entry.backend.c_str(), entry.texture_width, entry.texture_height, entry.num_threads, entry.layout.c_str(), entry.megapixels_per_second, target_psnr, target_ssim);
+            text += buffer;
+        }
+    }
+
+    for (regression_result const &result : results)
+    {
+        char target_psnr[32] = "-";
+        char target_ssim[32] = "-";
+        if (result.target_psnr >= 0.0)
+        {
+            snprintf(target_psnr, sizeof(target_psnr), "%.4f", result.target_psnr);
+            snprintf(target_ssim, sizeof(target_ssim), "%.6f", result.target_ssim);
+        }
+
+        snprintf(buffer, sizeof(buffer), "%s %dx%d t%d %s %.4f %s %s\n", backend_name, result.texture_width, result.texture_height, result.num_threads, ntm_layout_name(result.layout), result.megapixels_per_second, target_psnr, target_ssim);
+        text += buffer;
+    }
+
+    FILE *file = ntm_fopen_utf8(path, "wb");
+    bool const result_write = (NULL != file) && (text.size() == fwrite(text.data(), 1U, text.size(), file));
+    bool const result_close = (NULL != file) && (0 == fclose(file));
+    return result_write && result_close;
+}
+
+static inline void regression_compare(int texture_width, int texture_height, uint8_t const (*bit_RGBs)[4], uint8_t const (*reference_bit_RGBs)[4], double *out_psnr, double *out_ssim)
+{
+    // the alpha is NOT compared (the target does NOT have the alpha)
+    constexpr int const num_channels = 3;
+
+    double squared_error = 0.0;
+    for (size_t texel_index = 0U; texel_index < (static_cast<size_t>(texture_width) * static_cast<size_t>(texture_height)); ++texel_index)
+    {
+        for (int channel_index = 0; channel_index < num_channels; ++channel_index)
+        {
+            double const error = static_cast<double>(bit_RGBs[texel_index][channel_index]) - static_cast<double>(reference_bit_RGBs[texel_index][channel_index]);
+            squared_error += error * error;
+        }
+    }
+
+    double const mean_squared_error = squared_error / (static_cast<double>(texture_width) * static_cast<double>(texture_height) * num_channels);
+    (*out_psnr) = (mean_squared_error > 0.0) ? std::min(10.0 * log10((255.0 * 255.0) / mean_squared_error), REGRESSION_MAX_PSNR) : REGRESSION_MAX_PSNR;
+
+    // https://en.wikipedia.org/wiki/Structural_similarity_index_measure
+    constexpr double const c1 = (0.01 * 255.0) * (0.01 * 255.0);
+    constexpr double const c2 = (0.03 * 255.0) * (0.03 * 255.0);
+
+    // the window is clamped to the texture (which may be smaller than the window)
+    int const window_width = std::min(REGRESSION_SSIM_WINDOW_SIZE, texture_width);
+    int const window_height = std::min(REGRESSION_SSIM_WINDOW_SIZE, texture_height);
+    double const window_size = static_cast<double>(window_width) * static_cast<double>(window_height);
+
+    double total_ssim = 0.0;
+    size_t num_windows = 0U;
+    for (int window_y = 0; (window_y + window_height) <= texture_height; window_y += REGRESSION_SSIM_WINDOW_STRIDE)
+    {
+        for (int window_x = 0; (window_x + window_width) <= texture_width; window_x += REGRESSION_SSIM_WINDOW_STRIDE)
+        {
+            for (int channel_index = 0; channel_index < num_channels; ++channel_index)
+            {
+                double sum_x = 0.0;
+                double sum_y = 0.0;
+                double sum_xx = 0.0;
+                double sum_yy = 0.0;
+                double sum_xy = 0.0;
+                for (int y = window_y; y < (window_y + window_height); ++y)
+                {
+                    for (int x = window_x; x < (window_x + window_width); ++x)
+                    {
+                        size_t const texel_index = static_cast<size_t>(texture_width) * y + x;
+                        double const value_x = static_cast<double>(bit_RGBs[texel_index][channel_index]);
+                        double const value_y = static_cast<double>(reference_bit_RGBs[texel_index][channel_index]);
+                        sum_x += value_x;
+                        sum_y += value_y;
+                        sum_xx += value_x * value_x;
+                        sum_yy += value_y * value_y;
+                        sum_xy += value_x * value_y;
+                    }
+                }
+
+                double const mean_x = sum_x / window_size;
+                double const mean_y = sum_y / window_size;
+                double const variance_x = sum_xx / window_size - mean_x * mean_x;
+                double const variance_y = sum_yy / window_size - mean_y * mean_y;
+                double const covariance = sum_xy / window_size - mean_x * mean_y;
+
+                total_ssim += ((2.0 * mean_x * mean_y + c1) * (2.0 * covariance + c2)) / ((mean_x * mean_x + mean_y * mean_y + c1) * (variance_x + variance_y + c2));
+                ++num_windows;
+            }
+        }
+    }
+
+    (*out_ssim) = total_ssim / static_cast<double>(num_windows);
+}
@@ -0,0 +1,12 @@
+#ifndef _INFERENCE_REGRESSION_H_
+#define _INFERENCE_REGRESSION_H_ 1
+
+#include <tensorflow/lite/c/c_api.h>
+#include "inference-options.h"
+#include "ntm-aot-inference.h"
+
+// The decoded image of each combination of the resolutions, the "threads" and the "layouts" is compared with the target (PSNR/SSIM) and the golden image, and the throughput is compared with the baseline.
+// 1: any regression beyond the thresholds (or any missing golden image or baseline), and the report (JSON) is still written
+extern int regression(inference_options const *options, TfLiteModel *tflite_model, ntm_cpu_engine const *cpu_engine, ntm_aot_engine const *aot_engine);
+
+#endif
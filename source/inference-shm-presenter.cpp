@@ -0,0 +1,198 @@
+#include "inference-shm-presenter.h"
+#include <xcb/shm.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <new>
+
+struct inference_shm_presenter_slot
+{
+    xcb_shm_seg_t segment;
+    xcb_pixmap_t pixmap;
+    void *address;
+};
+
+struct inference_shm_presenter
+{
+    xcb_connection_t *connection;
+    int width;
+    int height;
+    int num_slots;
+    inference_shm_presenter_slot slots[INFERENCE_MAX_PIPELINE_DEPTH];
+};
+
+static inline bool inference_shm_presenter_create_slot(xcb_connection_t *connection, xcb_drawable_t drawable, uint8_t depth, int width, int height, inference_shm_presenter_slot *out_slot);
+
+static inline void inference_shm_presenter_destroy_slot(xcb_connection_t *connection, inference_shm_presenter_slot *slot);
+
+extern inference_shm_presenter *inference_shm_presenter_create(xcb_connection_t *connection, xcb_drawable_t drawable, uint8_t depth, int width, int height, int num_pixmaps)
+{
+    assert((num_pixmaps >= 1) && (num_pixmaps <= INFERENCE_MAX_PIPELINE_DEPTH));
+
+    xcb_query_extension_reply_t const *const extension_shm = xcb_get_extension_data(connection, &xcb_shm_id);
+    if ((NULL == extension_shm) || (!extension_shm->present))
+    {
+        return NULL;
+    }
+
+    {
+        xcb_shm_query_version_cookie_t cookie_shm_query_version = xcb_shm_query_version(connection);
+
+        xcb_generic_error_t *error_reply_shm_query_version = NULL;
+        xcb_shm_query_version_reply_t *reply_shm_query_version = xcb_shm_query_version_reply(connection, cookie_shm_query_version, &error_reply_shm_query_version);
+        if (NULL == reply_shm_query_version)
+        {
+            free(error_reply_shm_query_version);
+            return NULL;
+        }
+
+        // the layout of the shared pixmap is the same as the "xcb_put_image" merely when it is the Z pixmap
+        bool const shared_pixmaps = (0U != reply_shm_query_version->shared_pixmaps) && (XCB_IMAGE_FORMAT_Z_PIXMAP == reply_shm_query_version->pixmap_format);
+
+        free(reply_shm_query_version);
+
+        if (!shared_pixmaps)
+        {
+            return NULL;
+        }
+    }
+
+    inference_shm_presenter *presenter = new (std::nothrow) inference_shm_presenter;
+    if (NULL == presenter)
+    {
+        return NULL;
+    }
+
+    presenter->connection = connection;
+    presenter->width = width;
+    presenter->height = height;
+    presenter->num_slots = 0;
+
+    for (int slot_index = 0; slot_index < num_pixmaps; ++slot_index)
+    {
+        if (!inference_shm_presenter_create_slot(connection, drawable, depth, width, height, &presenter->slots[slot_index]))
+        {
+            // e.g. the X server is on the other machine, and thus can NOT attach the segment
+            inference_shm_presenter_destroy(presenter);
+            return NULL;
+        }
+
+        ++presenter->num_slots;
+    }
+
+    return presenter;
+}
+
+extern void inference_shm_presenter_destroy(inference_shm_presenter *presenter)
+{
+    for (int slot_index = 0; slot_index < presenter->num_slots; ++slot_index)
+    {
+        inference_shm_presenter_destroy_slot(presenter->connection, &presenter->slots[slot_index]);
+    }
+
+    delete presenter;
+}
+
+extern void inference_shm_presenter_get_pixmap(inference_shm_presenter const *presenter, int index, xcb_pixmap_t *out_pixmap, uint8_t (**out_bit_RGBs)[4])
+{
+    assert((index >= 0) && (index < presenter->num_slots));
+
+    if (NULL != out_pixmap)
+    {
+        (*out_pixmap) = presenter->slots[index].pixmap;
+    }
+
+    if (NULL != out_bit_RGBs)
+    {
+        (*out_bit_RGBs) = static_cast<uint8_t(*)[4]>(presenter->slots[index].address);
+    }
+}
+
+extern int inference_shm_presenter_find_pixmap(inference_shm_presenter const *presenter, xcb_pixmap_t pixmap)
+{
+    for (int slot_index = 0; slot_index < presenter->num_slots; ++slot_index)
+    {
+        if (pixmap == presenter->slots[slot_index].pixmap)
+        {
+            return slot_index;
+        }
+    }
+
+    return -1;
+}
+
+static inline bool inference_shm_presenter_create_slot(xcb_connection_t *connection, xcb_drawable_t drawable, uint8_t depth, int width, int height, inference_shm_presenter_slot *out_slot)
+{
+    size_t const size = sizeof(uint8_t[4]) * static_cast<size_t>(width) * static_cast<size_t>(height);
+
+    int const shm_id = shmget(IPC_PRIVATE, size, IPC_CREAT | 0600);
+    if (-1 == shm_id)
+    {
+        return false;
+    }
+
+    void *const address = shmat(shm_id, NULL, 0);
+    if (reinterpret_cast<void *>(-1) == address)
+    {
+        shmctl(shm_id, IPC_RMID, NULL);
+        return false;
+    }
+
+    xcb_shm_seg_t const segment = xcb_generate_id(connection);
+    {
+        xcb_void_cookie_t cookie_shm_attach = xcb_shm_attach_checked(connection, segment, static_cast<uint32_t>(shm_id), 0);
+
+        xcb_generic_error_t *error_shm_attach = xcb_request_check(connection, cookie_shm_attach);
+
+        // the segment is destroyed when both the client and the X server have detached it (even if the process crashes)
+        shmctl(shm_id, IPC_RMID, NULL);
+
+        if (NULL != error_shm_attach)
+        {
+            free(error_shm_attach);
+            shmdt(address);
+            return false;
+        }
+    }
+
+    xcb_pixmap_t const pixmap = xcb_generate_id(connection);
+    {
+        xcb_void_cookie_t cookie_shm_create_pixmap = xcb_shm_create_pixmap_checked(connection, pixmap, drawable, static_cast<uint16_t>(width), static_cast<uint16_t>(height), depth, segment, 0U);
+
+        xcb_generic_error_t *error_shm_create_pixmap = xcb_request_check(connection, cookie_shm_create_pixmap);
+        if (NULL != error_shm_create_pixmap)
+        {
+            free(error_shm_create_pixmap);
+            xcb_shm_detach(connection, segment);
+            shmdt(address);
+            return false;
+        }
+    }
+
+    out_slot->segment = segment;
+    out_slot->pixmap = pixmap;
+    out_slot->address = address;
+    return true;
+}
+
+static inline void inference_shm_presenter_destroy_slot(xcb_connection_t *connection, inference_shm_presenter_slot *slot)
+{
+    {
+        xcb_void_cookie_t cookie_free_pixmap = xcb_free_pixmap_checked(connection, slot->pixmap);
+
+        xcb_generic_error_t *error_free_pixmap = xcb_request_check(connection, cookie_free_pixmap);
+        assert(NULL == error_free_pixmap);
+    }
+
+    {
+        xcb_void_cookie_t cookie_shm_detach = xcb_shm_detach_checked(connection, slot->segment);
+
+        xcb_generic_error_t *error_shm_detach = xcb_request_check(connection, cookie_shm_detach);
+        assert(NULL == error_shm_detach);
+    }
+
+    int const result_shm_detach = shmdt(slot->address);
+    assert(0 == result_shm_detach);
+    (void)result_shm_detach;
+}
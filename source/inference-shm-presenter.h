@@ -0,0 +1,25 @@
+#ifndef _INFERENCE_SHM_PRESENTER_H_
+#define _INFERENCE_SHM_PRESENTER_H_ 1
+
+#include "inference-options.h"
+#include <xcb/xcb.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Each pixmap of the ring is backed by a System V shared memory segment (MIT-SHM), and thus the decoder writes the BGRA texels into the pixmap directly, instead of the "xcb_put_image" which copies the whole texture through the X socket every frame.
+// The pixmaps are the buffers of the "inference_frame_pipeline", and the pixmap which has been presented is NOT released (decoded again) until the X server reports that it is idle (the "IdleNotify" of the Present extension).
+struct inference_shm_presenter;
+
+// NULL: the MIT-SHM extension (or the shared pixmap of the Z pixmap format) is NOT available, e.g. the remote X server, and the caller should fall back to the "xcb_put_image".
+extern inference_shm_presenter *inference_shm_presenter_create(xcb_connection_t *connection, xcb_drawable_t drawable, uint8_t depth, int width, int height, int num_pixmaps);
+
+extern void inference_shm_presenter_destroy(inference_shm_presenter *presenter);
+
+// The texels of the pixmap are [height][width]. Either of the outputs may be NULL.
+extern void inference_shm_presenter_get_pixmap(inference_shm_presenter const *presenter, int index, xcb_pixmap_t *out_pixmap, uint8_t (**out_bit_RGBs)[4]);
+
+// The index of the "pixmap" of the "IdleNotify".
+// -1: the "pixmap" does NOT belong to the ring
+extern int inference_shm_presenter_find_pixmap(inference_shm_presenter const *presenter, xcb_pixmap_t pixmap);
+
+#endif
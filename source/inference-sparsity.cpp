@@ -0,0 +1,124 @@
+#include "inference-sparsity.h"
+#include "ntm-file.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <stdio.h>
+#include <new>
+#include <vector>
+#include <string>
+
+extern int sparsity(inference_options const *options, ntm_cpu_engine const *cpu_engine)
+{
+    assert(options->sparsity);
+    assert(NULL != cpu_engine->kernels);
+    assert(options->benchmark_num_resolutions >= 1);
+
+    int const texture_width = options->benchmark_resolutions[0][0];
+    int const texture_height = options->benchmark_resolutions[0][1];
+
+    // too large for the stack
+    ntm_cpu_sparsity_statistics *const statistics = new (std::nothrow) ntm_cpu_sparsity_statistics;
+    if (NULL == statistics)
+    {
+        fprintf(stderr, "Failed to allocate the sparsity statistics\n");
+        return 1;
+    }
+
+    ntm_cpu_engine_measure_sparsity(cpu_engine, static_cast<uint32_t>(texture_width), static_cast<uint32_t>(texture_height), statistics);
+
+    ntm_model const *const model = &cpu_engine->model;
+
+    // The multiply-adds of the hidden layers (the 1st layer is merely evaluated for each column and each row by the grid path) for each pixel.
+    // The inputs of the layer L are the outputs of the layer L - 1, and the "dense_sparse" kernels skip the rows of the weights of the inputs which are zero for the whole batch.
+    double dense_multiply_adds = 0.0;
+    double sparse_multiply_adds = 0.0;
+    for (uint32_t layer_index = 1U; layer_index < model->num_layers; ++layer_index)
+    {
+        ntm_layer const *const layer = &model->layers[layer_index];
+        for (uint32_t input_index = 0U; input_index < layer->input_size; ++input_index)
+        {
+            double const batch_zero_rate = static_cast<double>(statistics->zero_batches[layer_index - 1U][input_index]) / static_cast<double>(statistics->num_batches);
+            dense_multiply_adds += static_cast<double>(layer->output_size);
+            sparse_multiply_adds += (1.0 - batch_zero_rate) * static_cast<double>(layer->output_size);
+        }
+    }
+
+    std::string report;
+    {
+        char buffer[512];
+
+        snprintf(buffer, sizeof(buffer), "{\n  \"width\": %d,\n  \"height\": %d,\n  \"dense_multiply_adds_per_pixel\": %.1f,\n  \"sparse_multiply_adds_per_pixel\": %.1f,\n  \"layers\": [", texture_width, texture_height, dense_multiply_adds, sparse_multiply_adds);
+        report += buffer;
+
+        for (uint32_t layer_index = 0U; layer_index < statistics->num_layers; ++layer_index)
+        {
+            uint32_t const layer_size = statistics->layer_sizes[layer_index];
+
+            std::string dead;
+            std::string zero_rates;
+            std::string batch_zero_rates;
+            uint32_t num_dead = 0U;
+            double mean_zero_rate = 0.0;
+            double mean_batch_zero_rate = 0.0;
+            for (uint32_t neuron_index = 0U; neuron_index < layer_size; ++neuron_index)
+            {
+                double const zero_rate = static_cast<double>(statistics->zero_pixels[layer_index][neuron_index]) / static_cast<double>(statistics->num_pixels);
+                double const batch_zero_rate = static_cast<double>(statistics->zero_batches[layer_index][neuron_index]) / static_cast<double>(statistics->num_batches);
+
+                if (statistics->num_pixels == statistics->zero_pixels[layer_index][neuron_index])
+                {
+                    snprintf(buffer, sizeof(buffer), "%s%u", (num_dead > 0U) ? ", " : "", neuron_index);
+                    dead += buffer;
+                    ++num_dead;
+                }
+
+                snprintf(buffer, sizeof(buffer), "%s%.4f", (neuron_index > 0U) ? ", " : "", zero_rate);
+                zero_rates += buffer;
+
+                snprintf(buffer, sizeof(buffer), "%s%.4f", (neuron_index > 0U) ? ", " : "", batch_zero_rate);
+                batch_zero_rates += buffer;
+
+                mean_zero_rate += zero_rate / static_cast<double>(layer_size);
+                mean_batch_zero_rate += batch_zero_rate / static_cast<double>(layer_size);
+            }
+
+            snprintf(buffer, sizeof(buffer), "%s\n    {\"layer\": %u, \"neurons\": %u, \"dead\": [", (layer_index > 0U) ? "," : "", layer_index, layer_size);
+            report += buffer;
+            report += dead;
+            report += "], \"zero_rates\": [";
+            report += zero_rates;
+            report += "], \"batch_zero_rates\": [";
+            report += batch_zero_rates;
+            report += "]}";
+
+            fprintf(stderr, "Layer %u: %u neurons, %u dead, zero %.1f%%, batch zero %.1f%%\n", layer_index, layer_size, num_dead, 100.0 * mean_zero_rate, 100.0 * mean_batch_zero_rate);
+        }
+
+        report += "\n  ]\n}\n";
+    }
+
+    delete statistics;
+
+    fprintf(stderr, "Hidden multiply-adds per pixel: %.1f (dense) -> %.1f (sparse)\n", dense_multiply_adds, sparse_multiply_adds);
+
+    if (NULL != options->benchmark_report_path)
+    {
+        FILE *file = ntm_fopen_utf8(options->benchmark_report_path, "wb");
+        bool const result_write = (NULL != file) && (report.size() == fwrite(report.data(), 1U, report.size(), file));
+        bool const result_close = (NULL != file) && (0 == fclose(file));
+        if ((!result_write) || (!result_close))
+        {
+            fprintf(stderr, "Failed to write the sparsity report: %s\n", options->benchmark_report_path);
+            return 1;
+        }
+    }
+    else
+    {
+        fputs(report.c_str(), stdout);
+        fflush(stdout);
+    }
+
+    return 0;
+}
@@ -0,0 +1,10 @@
+#ifndef _INFERENCE_SPARSITY_H_
+#define _INFERENCE_SPARSITY_H_ 1
+
+#include "inference-options.h"
+
+// The offline pass of the pruning: the rates of the zero outputs of each neuron of the hidden layers (the "ntm_cpu_engine_measure_sparsity") are measured at the texel centers of the first resolution (e.g. the 512x512 of the "target.png").
+// The report (JSON) lists the dead neurons of each layer, which is the input of the "prune-main.py".
+extern int sparsity(inference_options const *options, ntm_cpu_engine const *cpu_engine);
+
+#endif
@@ -0,0 +1,4095 @@
+// Generated by the "compile-main.py". Do NOT edit.
+// 16 frequencies, 64 -> 64 -> 64 -> 64 -> 64 -> 64 -> 3
+
+static constexpr uint32_t const NTM_AOT_NUM_FREQUENCIES = 16U;
+
+static constexpr uint32_t const NTM_AOT_NUM_LAYERS = 6U;
+
+// the maximum of the widths of all layers (including the positional encoding)
+static constexpr uint32_t const NTM_AOT_MAX_LAYER_WIDTH = 64U;
+
+// the same as the "ntm_model_hash" of the NTM asset
+static constexpr uint64_t const NTM_AOT_NETWORK_HASH = 0XC32282F74E7B5623ULL;
+
+// 64 x 64 (relu)
+alignas(64) static float const ntm_aot_layer_0_weights[4096] = {
+    9.890186787e-02F, -3.958994895e-02F, 2.956518531e-01F, -3.006179929e-01F, -3.476941288e-01F, -8.523843884e-01F, -1.353368312e-01F, -1.115368456e-01F,
+    -7.600715160e-01F, -3.221764266e-01F, 3.674356639e-02F, 1.734013408e-01F, -5.461634398e-01F, 3.254988492e-01F, -6.694535017e-01F, -9.208214283e-02F,
+    8.966457248e-01F, 1.010298491e+00F, -7.753615379e-01F, 7.840768695e-01F, 1.403099775e+00F, 1.848967552e+00F, 1.078686211e-02F, 5.266419649e-01F,
+    -6.183789968e-01F, -1.019541860e+00F, 1.005038500e+00F, 2.189918905e-01F, -2.304860204e-02F, -3.229795992e-01F, -1.747447550e-01F, -9.229957461e-01F,
+    -3.315022290e-01F, 7.661746740e-01F, 7.837152481e-02F, 6.015974283e-01F, 7.091343403e-01F, 6.474849582e-01F, 1.252446055e+00F, -6.196810603e-01F,
+    1.024792433e+00F, -8.789847493e-01F, 4.588062167e-01F, 5.041359663e-01F, -2.019481659e-01F, -6.278944612e-01F, 6.318430305e-01F, -8.711746335e-01F,
+    -7.157168984e-01F, 1.641198434e-02F, -5.941554904e-01F, 7.536185384e-01F, 5.093755722e-01F, 1.231662631e+00F, 7.827900350e-02F, -6.194613576e-01F,
+    8.955742717e-01F, 8.649470210e-01F, -5.882704258e-01F, -3.909994960e-01F, 1.385089874e+00F, -2.586555779e-01F, 1.284170747e+00F, 9.024636149e-01F,
+    7.490265965e-01F, 5.096822381e-01F, -7.742323279e-01F, 8.739703298e-01F, -1.100558415e-01F, 1.416009814e-01F, -8.869329095e-01F, 4.101498425e-01F,
+    -9.043667316e-01F, -1.157424927e+00F, -1.267837286e+00F, -4.736597836e-01F, 8.992199600e-02F, 6.295953393e-01F, 1.676480770e-01F, -3.509232402e-01F,
+    9.442588091e-01F, -1.577140689e+00F, -6.894005090e-02F, 1.325873733e+00F, 6.591206789e-01F, 1.448912263e+00F, 7.867684364e-01F, 1.183048368e+00F,
+    3.894059220e-03F, 1.652169526e-01F, -3.187332451e-01F, 7.283958793e-01F, -9.261298776e-01F, -2.577319443e-01F, -5.460289121e-01F, -1.458434463e+00F,
+    8.757560253e-01F, 1.121056557e+00F, -6.233321428e-01F, -1.874147773e+00F, -4.986150265e-01F, 6.940589100e-02F, -9.478316307e-01F, 1.233029366e+00F,
+    -9.916208386e-01F, 8.430160284e-01F, 2.805886269e-01F, 2.269655019e-01F, -1.162556171e+00F, 1.274916887e+00F, -4.984846339e-02F, -2.882834077e-01F,
+    -1.429502726e+00F, 9.227627516e-01F, -5.127182603e-01F, 7.970981002e-01F, 7.863578200e-01F, 8.426697850e-01F, -1.092264891e+00F, -3.565253913e-01F,
+    7.618792653e-01F, -7.515477538e-01F, -2.717789710e-01F, 7.421267033e-01F, -3.412237763e-01F, -3.564854264e-01F, 1.181957603e+00F, 8.514165282e-01F,
+    -1.682743579e-01F, 1.287902240e-02F, 6.140166521e-01F, -6.467225552e-01F, -2.616861761e-01F, -1.059010029e+00F, 9.500676990e-01F, 1.181945801e+00F,
+    -1.085714340e+00F, -1.674222946e+00F, -5.961048603e-01F, -8.232961297e-01F, 5.657811761e-01F, -1.952507049e-01F, 6.283176541e-01F, 5.534095168e-01F,
+    -1.038256645e+00F, 1.088439345e+00F, -4.388777614e-01F, 5.688694119e-01F, -4.643313587e-01F, -4.812420011e-01F, 5.090228915e-01F, 2.958583534e-01F,
+    -3.061438203e-01F, -2.920871973e-01F, -5.968021750e-01F, 1.669931710e-01F, -5.566726327e-01F, 5.771563388e-03F, 7.945187688e-01F, -1.382913589e+00F,
+    -1.214090228e+00F, -6.695142388e-01F, 6.386544108e-01F, -1.294270873e+00F, 3.521182761e-02F, 4.320378006e-01F, 5.331872106e-01F, -1.257077754e-01F,
+    2.220030725e-01F, -6.530229449e-01F, 1.474977136e-01F, 6.227435470e-01F, 3.985771909e-02F, 1.414683908e-01F, -8.785517812e-01F, -3.872914985e-02F,
+    -1.659464687e-01F, -3.338912725e-01F, 3.886881769e-01F, -2.468631230e-02F, -7.107632756e-01F, 1.896840334e-01F, -4.096123576e-01F, -2.149845846e-02F,
+    -8.696548343e-01F, -2.891254611e-02F, -5.334828496e-01F, 7.237362862e-02F, 5.803800821e-01F, 4.417442251e-03F, -1.621622205e+00F, 3.648809493e-01F,
+    -1.784602925e-02F, 5.175763369e-01F, -6.335440874e-01F, -3.853738308e-01F, 1.809571385e-01F, -1.558220088e-01F, 3.255861625e-02F, -4.720452130e-01F,
+    -5.387080908e-01F, -4.352786765e-02F, 4.940125346e-01F, -1.816098690e-01F, -3.497019410e-01F, -1.497663110e-01F, -5.090298504e-02F, 8.965032548e-02F,
+    5.888479576e-02F, -3.616133928e-01F, 4.834591150e-01F, -9.672569484e-02F, -4.470360875e-01F, 1.164412498e+00F, -9.116972685e-01F, -4.416390508e-02F,
+    -7.921093702e-01F, -2.110681236e-01F, 2.635955215e-01F, 1.970211044e-02F, -1.231388599e-01F, -2.143259943e-01F, 8.866967559e-01F, -6.015133485e-02F,
+    1.784795523e-02F, -3.270176006e-03F, 5.188741535e-02F, 3.995060548e-02F, 5.926710740e-02F, -4.280973971e-02F, 6.843387149e-03F, 1.392766833e-01F,
+    -1.726127118e-01F, 6.375378370e-02F, -4.995337874e-02F, -5.959539860e-02F, -1.854603738e-01F, 4.625314102e-02F, -2.951252274e-02F, 1.134245321e-01F,
+    2.903028131e-01F, -5.258207396e-02F, 1.983156204e-01F, 1.152854133e-02F, 2.378069758e-01F, -1.137540266e-01F, -7.293201983e-02F, -1.377262622e-01F,
+    -4.746347200e-03F, 2.002828419e-01F, 7.688852400e-02F, 1.807427853e-01F, 5.064961910e-01F, 9.777702391e-02F, -1.896876246e-01F, -8.291333169e-02F,
+    -4.122637212e-02F, -2.504144982e-02F, 6.280058064e-03F, 6.410147995e-02F, -3.334870934e-02F, 2.313063852e-02F, 1.671605743e-02F, 8.879125863e-02F,
+    -1.589190215e-01F, -1.997454278e-02F, -1.482879743e-02F, 1.176712066e-01F, -1.345192431e-03F, -1.905082017e-01F, 5.272974446e-02F, 1.217311472e-01F,
+    -7.486291230e-02F, 4.685668647e-02F, 6.769010331e-03F, -2.073923312e-02F, -2.531824447e-02F, -4.119391367e-02F, 1.560734399e-02F, 4.282102361e-02F,
+    1.383090857e-02F, -4.583391920e-02F, -5.264277011e-02F, -4.570590332e-02F, 1.335935891e-01F, -7.684835792e-02F, -5.591795966e-02F, -5.214171857e-02F,
+    1.720313542e-02F, 2.848352678e-02F, 5.899580661e-03F, 4.999252502e-03F, -1.222204231e-02F, 2.675104327e-02F, -2.493801061e-03F, -2.056356519e-02F,
+    -3.362470493e-02F, -9.520910680e-03F, 3.659467772e-02F, -6.918720435e-03F, 5.320703611e-02F, -6.295035034e-02F, -1.261276565e-02F, 2.116981708e-02F,
+    -3.801292777e-01F, 7.280525565e-02F, 1.638476178e-02F, 1.882885844e-01F, -1.761344969e-01F, 5.554869398e-02F, 1.679384857e-01F, 1.191498563e-01F,
+    -8.535654843e-02F, -3.714424372e-01F, 4.265633821e-01F, 3.329904974e-01F, -1.236089319e-01F, -4.302959442e-01F, -6.317634881e-02F, 1.908522397e-01F,
+    7.986254990e-02F, 5.367460251e-01F, -1.966150552e-01F, -4.522673320e-03F, 5.191889033e-02F, 4.853606820e-01F, 6.144260988e-02F, -7.656777650e-02F,
+    4.613897800e-01F, -1.725710183e-01F, 2.248255014e-01F, 4.377965629e-02F, -5.505403280e-01F, -8.367006779e-01F, -3.633612692e-01F, -3.348025382e-01F,
+    2.675813437e-01F, 8.036524057e-02F, -2.262344509e-01F, 1.062347367e-01F, 1.147241239e-02F, 1.283072680e-01F, 3.031165898e-01F, 6.278547645e-02F,
+    -8.093036711e-02F, 1.820169240e-01F, -8.050170541e-02F, -1.357358396e-01F, -9.395734221e-02F, 6.163599342e-02F, 4.775740951e-02F, 5.730770156e-02F,
+    -2.724337876e-01F, -7.540842295e-01F, 2.275560945e-01F, -1.444612592e-01F, -2.807744443e-01F, -7.443341017e-01F, -6.467403173e-01F, -4.008335248e-02F,
+    -1.012186646e+00F, 5.446358919e-01F, -6.600888073e-02F, -2.484015077e-01F, 5.773558617e-01F, 1.327350140e+00F, 1.020866930e-01F, 2.268690169e-01F,
+    -9.577986598e-02F, -1.553858966e-01F, 1.641225964e-01F, 1.456426382e-01F, -5.229790881e-02F, 5.167924613e-02F, -2.135976255e-01F, 5.054349080e-02F,
+    4.366330802e-02F, -2.100655288e-01F, 1.893280298e-01F, -7.355699688e-02F, -2.107757926e-01F, -7.806739211e-02F, 2.361709811e-02F, 3.455004469e-02F,
+    -3.321751952e-01F, -1.487848520e+00F, 2.419643551e-01F, 2.421046980e-02F, -1.223646924e-01F, -1.053668380e+00F, -6.128816009e-01F, -4.560300708e-02F,
+    -1.251303196e+00F, 5.855814815e-01F, -1.469820142e-01F, -2.967364788e-01F, 1.214451075e+00F, 1.655838251e+00F, 4.927732646e-01F, 4.331684113e-01F,
+    -5.599047989e-02F, 3.462643921e-02F, 1.487246901e-01F, -2.514559925e-01F, 1.641672850e-01F, 8.732219040e-02F, -2.355332673e-01F, -9.286990017e-02F,
+    2.137276717e-02F, -2.828520834e-01F, 2.197762392e-02F, -9.661179036e-02F, 4.759414122e-02F, 2.221274935e-02F, -2.065039277e-01F, -3.789128363e-02F,
+    -2.808750272e-01F, -1.735040545e+00F, 1.284872591e-01F, 1.717676520e-01F, -3.723071516e-01F, -1.437509060e+00F, -6.753171086e-01F, -1.124727950e-01F,
+    -1.447966695e+00F, 7.031561732e-01F, -4.906223118e-01F, 1.011529192e-01F, 1.096537471e+00F, 1.990942121e+00F, 6.244552135e-01F, 6.250241399e-01F,
+    -2.229859978e-01F, 3.356060013e-02F, -3.886445239e-02F, -1.898381710e-01F, 4.549072310e-02F, 1.162731051e-01F, 2.080914751e-02F, 1.109181419e-01F,
+    -1.874510199e-01F, -1.235119998e-01F, -7.401325554e-02F, -1.735700667e-01F, -2.575484570e-03F, -1.403367221e-01F, -3.406324238e-02F, -1.296999902e-01F,
+    -6.499485373e-01F, -1.829655886e+00F, 2.387868315e-01F, 2.969301045e-01F, -3.942494094e-01F, -1.537446856e+00F, -7.159745097e-01F, -4.273806512e-01F,
+    -2.003027439e+00F, 9.539533854e-01F, -4.930034280e-01F, -1.014434174e-01F, 1.277891040e+00F, 2.681268215e+00F, 8.221204877e-01F, 6.147036552e-01F,
+    -2.216966301e-01F, -2.253696471e-01F, 1.346014291e-01F, -2.056542784e-02F, -9.024284035e-02F, -2.218846977e-01F, -2.220872343e-01F, -2.535391152e-01F,
+    -3.062239885e-01F, -2.964975536e-01F, 4.068609327e-03F, -1.158834784e-03F, -3.668233752e-03F, -2.650990486e-01F, -2.137154937e-01F, -1.801434159e-02F,
+    -6.863845587e-01F, -2.051548958e+00F, 3.147066757e-02F, -4.557453096e-03F, -2.946649492e-01F, -1.821686864e+00F, -8.250382543e-01F, -5.290315747e-01F,
+    -2.091536522e+00F, 8.193349242e-01F, -6.141524911e-01F, -3.378285468e-02F, 1.626531839e+00F, 2.674459219e+00F, 9.998765588e-01F, 4.608019292e-01F,
+    -2.993512750e-01F, -1.813064665e-01F, -1.215229034e-01F, -1.708507538e-01F, -5.588549748e-02F, -5.274893343e-02F, -2.882087529e-01F, -5.338422954e-03F,
+    -1.973430365e-01F, -1.588317603e-01F, 1.144881696e-01F, -2.208786011e-01F, 3.656884655e-02F, 3.336871415e-02F, -2.573293746e-01F, -1.499184221e-02F,
+    -3.040797114e-01F, 2.263553590e-01F, 3.629684448e-01F, 4.811203778e-01F, -6.495685577e-01F, -2.833135128e-01F, -4.929557443e-01F, 1.882043332e-01F,
+    -2.527776062e-01F, 8.046121597e-01F, 2.197984010e-01F, -1.447430104e-01F, -7.411314547e-02F, 2.302743495e-02F, -2.448753566e-01F, 2.277826667e-01F,
+    -9.887394905e-01F, 3.744247258e-01F, 1.201059371e-01F, -5.957267284e-01F, 3.472123146e-01F, -4.972975552e-01F, 1.049907923e+00F, 2.413546592e-01F,
+    -6.319779754e-01F, -4.809836447e-01F, 4.945680201e-01F, -2.330959141e-01F, 7.535310984e-01F, 1.041259408e+00F, 1.289292455e+00F, 4.938299358e-01F,
+    -5.330456495e-01F, -1.465306133e-01F, 3.638541996e-01F, -1.366522431e+00F, 2.046663463e-01F, -8.042772412e-01F, 6.821760535e-01F, 1.746088415e-01F,
+    -7.467559576e-01F, -5.955007076e-01F, 6.329264641e-01F, -7.741787434e-01F, 8.828178048e-01F, 6.530997753e-01F, 8.974364400e-01F, -2.440935075e-01F,
+    4.903141260e-01F, -9.710723758e-01F, -1.158704042e+00F, -1.015464187e+00F, 1.963671088e+00F, 4.225507975e-01F, 6.247253418e-01F, -6.327368617e-01F,
+    -3.729593456e-01F, -2.194057226e+00F, -4.823788404e-01F, 4.040669203e-01F, 6.156573296e-01F, -8.636881113e-01F, 2.374985218e-01F, -8.447939754e-01F,
+    -1.133020818e-01F, -4.972678721e-01F, 8.590584993e-01F, 1.781176209e+00F, 4.696554244e-01F, -1.417179465e+00F, 1.132986099e-01F, -9.252997637e-01F,
+    -1.499522924e-01F, 6.822568178e-01F, -2.349754572e-01F, -5.337066650e-01F, 6.198745966e-01F, 4.668100476e-01F, 1.090930939e+00F, -9.887319803e-01F,
+    -2.679601610e-01F, 4.832445458e-02F, -6.741563082e-01F, -3.999831378e-01F, -4.449239075e-01F, 1.514964819e+00F, 9.696090817e-01F, 5.282737613e-01F,
+    1.261216253e-01F, -9.432651997e-01F, -4.214798287e-02F, -7.455355525e-01F, 3.747613132e-01F, 1.507465448e-02F, -1.004327059e+00F, 7.887496352e-01F,
+    -1.505638838e+00F, 7.501268983e-01F, 5.981048346e-01F, 4.043195248e-01F, -5.543051362e-01F, 2.083572149e-01F, 8.359728456e-01F, 1.025637388e+00F,
+    -5.557863116e-01F, 4.015741944e-01F, 3.267555535e-01F, 2.140779644e-01F, 4.534798265e-01F, -1.193194270e+00F, -1.162355542e+00F, 1.228879452e+00F,
+    -7.323982120e-01F, 6.635500193e-01F, -7.121088505e-01F, 3.946465850e-01F, -2.317076027e-01F, 6.902660131e-01F, -9.611433744e-02F, -2.711583078e-01F,
+    -2.605739832e-01F, 3.125425577e-01F, -1.167219281e+00F, 3.589811325e-01F, 3.174682558e-01F, -1.294195056e-01F, 1.967674345e-01F, 3.673470914e-01F,
+    -1.217487901e-01F, 9.600929618e-01F, 5.744057894e-01F, -1.258507133e+00F, 9.507180005e-02F, 8.735597730e-01F, -9.565784782e-02F, 2.474094182e-01F,
+    -6.937589645e-01F, -3.992498219e-01F, -3.334871531e-01F, -1.916377842e-01F, -4.881047606e-01F, 1.474312246e-01F, -2.257304639e-01F, 8.400074206e-03F,
+    -1.451456547e-01F, -7.923081517e-01F, 1.729063988e-01F, 1.804724783e-01F, 4.892627895e-01F, -7.960306406e-01F, -1.132267714e+00F, -6.503347158e-01F,
+    -1.099165082e+00F, 3.098816574e-01F, -8.933393657e-02F, -5.325611681e-02F, 4.777296782e-01F, 3.185578883e-01F, -7.666758448e-02F, 7.283532619e-02F,
+    1.578760147e+00F, 1.219193101e+00F, 5.642115474e-01F, -2.140155137e-01F, 2.121732086e-01F, -1.049442768e+00F, -8.935062289e-01F, -1.713465214e+00F,
+    1.660134673e+00F, 2.876640558e-01F, -1.023862123e+00F, 1.419625245e-02F, -4.358461201e-01F, 9.049431682e-01F, 1.370181084e+00F, -1.574450135e-01F,
+    8.406264782e-01F, -7.398367524e-01F, -7.657056451e-01F, -2.445342578e-02F, -2.577486932e-01F, 7.148872614e-01F, 4.398263991e-01F, -8.657642454e-02F,
+    1.961006820e-01F, 3.851096332e-01F, -1.892099530e-01F, 3.946915865e-01F, -2.295262963e-01F, -3.822478950e-01F, 8.661716580e-01F, 7.677457333e-01F,
+    3.301940560e-01F, 2.328508496e-01F, 5.361899734e-01F, -5.943993330e-01F, 1.036696434e+00F, -5.302315950e-02F, 1.157810315e-01F, 5.208137631e-01F,
+    -9.814603329e-01F, 4.409146030e-03F, -6.411991119e-01F, 4.450878501e-01F, 1.506495625e-01F, 5.710588396e-02F, 3.714322299e-02F, -3.824545145e-01F,
+    -8.919719458e-01F, 1.959206313e-01F, 3.844512999e-01F, -2.049795240e-01F, -2.252473384e-01F, -3.535069525e-01F, 4.111204147e-01F, -5.678142905e-01F,
+    -4.029388130e-01F, 1.759163290e-02F, 2.660389245e-01F, 3.251648843e-01F, 6.249305606e-01F, 9.372843057e-02F, -1.155317500e-01F, -7.096718997e-02F,
+    1.768217832e-01F, -6.008243933e-02F, -5.903857201e-02F, 6.449365616e-02F, 5.982140452e-02F, -1.626455341e-03F, -2.023106664e-01F, 2.093443722e-01F,
+    -3.456696272e-01F, 2.019681484e-01F, -8.069231175e-03F, -5.174203217e-02F, 7.287395000e-01F, -5.294280052e-01F, 2.668591961e-02F, -3.133249581e-01F,
+    -5.057690665e-02F, 2.470521443e-02F, -2.859763205e-01F, 6.687641144e-02F, 4.618949816e-02F, -7.884509861e-02F, -1.631150842e-01F, 8.098939061e-02F,
+    2.270479947e-01F, 1.382494271e-01F, 4.315456748e-02F, -1.408892125e-01F, 5.532391667e-01F, 5.600121021e-01F, 5.919507146e-02F, -7.882001996e-02F,
+    -1.940019429e-02F, 1.109716147e-01F, -4.531468451e-02F, -5.725965276e-02F, 5.694340542e-02F, -3.448333591e-02F, -6.532244850e-03F, 1.374178194e-02F,
+    6.089535356e-02F, 1.133676805e-02F, 1.812534183e-01F, -7.840701193e-02F, -1.547084749e-01F, 5.441867933e-02F, 4.982479215e-01F, 4.083303362e-02F,
+    1.890148968e-01F, -2.030015364e-02F, 3.193469346e-02F, 1.700092852e-02F, -1.091437694e-02F, -2.371121943e-02F, 2.052741684e-02F, -4.624164850e-02F,
+    4.090131447e-02F, -1.159288920e-02F, -1.330112107e-02F, -7.624641061e-02F, -7.210104913e-02F, 1.751422286e-01F, -1.560969055e-01F, -7.121469826e-02F,
+    2.302649058e-02F, 2.372510545e-02F, 4.558891058e-02F, -2.221509203e-04F, 5.203827471e-02F, 4.365591332e-03F, -8.388989419e-02F, -2.327306196e-03F,
+    -4.287949204e-02F, 1.121716946e-02F, -4.620840773e-02F, -5.144893378e-02F, 7.861730456e-02F, -6.495869905e-02F, 7.519362867e-02F, 1.166988397e-03F,
+    -9.155404568e-02F, 2.164457738e-01F, 1.437564492e-01F, 2.331401259e-01F, 1.293665171e-01F, -8.968536556e-02F, -2.871910036e-01F, -7.211581618e-02F,
+    4.718676955e-02F, 3.653336763e-01F, 5.896843076e-01F, -2.111289464e-02F, 2.568260133e-01F, -5.363818407e-01F, -1.371612549e-01F, 3.638793528e-01F,
+    5.616547912e-02F, 1.530123949e-01F, -4.998438060e-01F, -3.159295321e-01F, -9.502244741e-02F, 4.797023237e-01F, -1.124671623e-01F, 2.136981040e-01F,
+    -4.058587849e-01F, -7.823111117e-02F, -2.347747982e-01F, -1.153760403e-02F, -1.296486855e-01F, 1.950338781e-01F, 1.136219203e-01F, -5.941892266e-01F,
+    4.699011743e-01F, -1.496780068e-01F, -1.023481414e-01F, 1.448175311e-01F, 8.690528572e-02F, 3.331599757e-02F, 1.092968062e-01F, -4.898347706e-02F,
+    4.806960523e-01F, 1.185201183e-01F, 1.980321258e-01F, -9.765031934e-02F, -1.052366197e-01F, 1.675719470e-01F, 3.716175556e-01F, 2.100533396e-01F,
+    -1.450101882e-01F, -4.892444909e-01F, 5.659608245e-01F, 4.516996443e-01F, 4.404967427e-01F, -1.090169311e+00F, -1.732069254e-02F, -6.598014832e-01F,
+    3.095905781e-01F, -1.626474410e-01F, 5.230339766e-01F, 1.620939672e-01F, 2.050431073e-02F, -6.601142883e-01F, -4.426058531e-01F, 7.134318352e-01F,
+    -3.257984221e-01F, 2.208676003e-02F, -1.102853715e-01F, -1.733758152e-01F, -2.771458030e-01F, -1.976536959e-01F, -2.526137531e-01F, -4.594935570e-03F,
+    -4.971689284e-01F, -8.495546877e-02F, -1.267495900e-01F, 1.384771168e-01F, -6.038051844e-02F, 8.596254885e-02F, -8.221968263e-02F, -7.110815495e-02F,
+    -3.432505727e-01F, -6.442325711e-01F, 9.003089666e-01F, 3.188605905e-01F, 6.389559507e-01F, -1.109472156e+00F, -3.257024586e-01F, -6.479041576e-01F,
+    4.524883628e-01F, -3.359076083e-01F, 9.321751595e-01F, 3.485665619e-01F, -2.561856294e-03F, -9.122357368e-01F, -6.249778271e-01F, 1.198643208e+00F,
+    -1.874365658e-01F, -1.363801509e-01F, 1.006674990e-01F, -2.061112821e-01F, -2.073837519e-01F, -1.028610468e-01F, -2.059967071e-01F, 1.545814723e-01F,
+    -4.182071388e-01F, -1.984614879e-01F, -1.093671471e-01F, 9.718606248e-03F, 9.700171649e-02F, -3.003403246e-01F, -2.377290092e-02F, 5.266372114e-02F,
+    -3.783630133e-01F, -7.968868017e-01F, 1.006610751e+00F, 4.800306559e-01F, 6.454287171e-01F, -1.385301948e+00F, -1.955368184e-02F, -9.405092001e-01F,
+    8.384522796e-01F, -3.698020577e-01F, 1.143437743e+00F, 4.978188276e-01F, -9.358451352e-04F, -1.039261460e+00F, -6.919929981e-01F, 1.242869496e+00F,
+    -1.255201995e-01F, 1.588909775e-01F, 1.047487482e-01F, -1.891390085e-01F, -1.364221871e-01F, 4.325410351e-02F, -3.640632033e-01F, 1.396782547e-01F,
+    -4.138629735e-01F, -7.155606151e-02F, 1.193414703e-01F, 1.606358290e-01F, 1.835911907e-02F, -1.124215964e-02F, -1.636796743e-01F, -4.537290335e-02F,
+    -7.279955149e-01F, -8.677347302e-01F, 1.228151798e+00F, 4.261522293e-01F, 8.153864145e-01F, -1.868332028e+00F, -5.239109695e-02F, -1.049501419e+00F,
+    1.204814315e+00F, -5.980826542e-02F, 1.391601920e+00F, 4.715066254e-01F, 1.687103533e-03F, -1.330717444e+00F, -9.284173846e-01F, 1.622438192e+00F,
+    -3.091771901e-01F, -8.015111089e-02F, -1.088494360e-01F, -7.964430749e-02F, -2.804104090e-01F, -1.576476693e-01F, -2.975989580e-01F, -8.248702437e-02F,
+    -3.709760010e-01F, 1.118875444e-01F, 1.045095846e-01F, -3.839344904e-02F, -4.290777072e-02F, -2.814603746e-01F, -3.826066256e-01F, 1.555470973e-01F,
+    -8.096234202e-01F, -7.631334662e-01F, 1.407193661e+00F, 4.651276767e-01F, 8.920270801e-01F, -2.074242592e+00F, -3.313533366e-01F, -1.010350347e+00F,
+    1.299481988e+00F, -2.242428660e-01F, 1.725249290e+00F, 2.834750116e-01F, -1.326442957e-01F, -1.731923342e+00F, -1.136439919e+00F, 1.618515372e+00F,
+    -3.105259836e-01F, -1.654112786e-01F, -2.292643636e-01F, -1.945882738e-01F, -1.747668087e-01F, -2.904346287e-01F, -2.100394219e-01F, -5.734804273e-02F,
+    -4.748713672e-01F, -2.568176985e-01F, -4.683540016e-02F, -6.543207169e-02F, -3.632638231e-02F, -2.254402786e-01F, -1.052579954e-01F, -7.108437712e-04F,
+    1.455393136e-01F, -4.596439004e-01F, 2.826611996e-01F, -3.392162621e-01F, -4.566234723e-02F, 1.636587828e-02F, -5.605387315e-02F, 1.061780900e-01F,
+    -1.023436904e+00F, 3.874738701e-03F, 4.250740409e-01F, 1.665859222e-01F, -1.509265751e-01F, 3.760327101e-01F, -1.485100389e-01F, -5.791029930e-01F,
+    4.862435162e-01F, 2.591203153e-01F, -3.456312418e-02F, -9.127922058e-01F, -5.324268937e-01F, 5.406066775e-01F, -1.355159283e-01F, -1.705557257e-01F,
+    5.745984316e-01F, 5.825938582e-01F, -1.255115271e+00F, -4.019877315e-01F, -6.195289493e-01F, 2.410112470e-01F, 9.891391993e-01F, 8.519112468e-01F,
+    5.737774372e-01F, 1.075323939e+00F, 3.520487249e-01F, -5.394924879e-01F, -9.294218421e-01F, -7.305385917e-02F, -4.431282636e-03F, 4.313645661e-01F,
+    -2.415948510e-01F, 6.509440541e-01F, -6.122094393e-01F, -1.227844000e+00F, 2.374439240e-01F, -7.136533260e-01F, 1.107295394e+00F, 6.413406134e-01F,
+    -1.564653963e-01F, 1.262594700e+00F, -1.623966813e+00F, 4.152884781e-01F, -6.089039445e-01F, 1.689766794e-01F, 4.257397354e-01F, -8.260349631e-01F,
+    1.586980343e+00F, -2.748233676e-01F, -1.007391572e+00F, -7.823591828e-01F, -2.907537520e-01F, -1.137072682e+00F, 7.969120741e-01F, 1.517297745e+00F,
+    3.931235373e-01F, 7.444948554e-01F, -1.083838463e+00F, 8.139679581e-02F, 9.456498623e-01F, 9.528595805e-01F, 1.376600862e-01F, 3.719942644e-02F,
+    7.064465284e-01F, -9.439673275e-03F, -1.416675448e+00F, 6.655653119e-01F, 7.596226931e-01F, 1.336235046e+00F, -1.034089088e+00F, 1.299714327e+00F,
+    -3.460478485e-01F, -1.100267172e+00F, 2.094606638e+00F, -7.766659856e-01F, -6.224644780e-01F, 8.385956287e-01F, 7.295505702e-02F, -6.118976474e-01F,
+    6.825315356e-01F, -4.161100984e-01F, -1.018117070e+00F, -1.027771592e+00F, 1.197899461e+00F, 3.469038988e-03F, -1.328546882e+00F, 1.999507099e-01F,
+    -6.851786748e-03F, -1.182757735e+00F, 9.876730293e-02F, -6.529766917e-01F, -1.856698692e-01F, 2.092383862e+00F, -3.626786172e-01F, -1.252315380e-02F,
+    7.864946723e-01F, 5.605223030e-02F, -1.026220620e-01F, -1.358605146e+00F, 7.190932035e-01F, -1.175096631e-01F, -6.125110984e-01F, 6.240943670e-01F,
+    -3.007632792e-01F, -1.552889585e+00F, 3.728290200e-01F, 2.379018515e-01F, -2.538159788e-01F, -5.398445129e-01F, -8.903344274e-01F, 2.343448550e-01F,
+    -1.111854315e+00F, -3.611074090e-01F, 6.041741371e-01F, -3.174020946e-01F, 3.410139680e-01F, -6.617106795e-01F, -2.986351848e-01F, -6.977983117e-01F,
+    1.219569296e-01F, 3.482589126e-01F, -5.077878833e-01F, 7.295619249e-01F, 1.494290709e+00F, -1.707088947e+00F, -5.191803575e-01F, -1.094016507e-01F,
+    1.982747912e-01F, -3.583336249e-02F, -3.527489603e-01F, -7.591319680e-01F, -1.050090909e+00F, 2.722216249e-01F, 5.889233351e-01F, -1.314225674e+00F,
+    2.326141000e-01F, 3.303504884e-01F, 7.441890836e-01F, -7.637952566e-01F, -1.223544478e+00F, -4.484216571e-01F, 6.520416737e-01F, -4.889271259e-01F,
+    1.741572499e+00F, -1.141183376e+00F, -2.824915051e-01F, -8.423678279e-01F, -1.889132261e-01F, -2.293355763e-01F, 9.892990813e-03F, -4.155897498e-01F,
+    -5.342303216e-02F, 7.014129162e-01F, 6.875529140e-02F, 1.161715537e-01F, -1.172754288e+00F, 4.248178601e-01F, -7.601203918e-01F, -7.572078109e-01F,
+    7.267529368e-01F, 2.714298368e-01F, -2.439980507e-01F, -5.281085372e-01F, 4.887251183e-02F, -3.492971361e-01F, -3.199316859e-01F, 9.029753804e-01F,
+    4.695913494e-01F, 5.371710062e-01F, -4.400631189e-01F, -1.281777978e+00F, 5.108376741e-01F, 5.473748446e-01F, 5.274174213e-01F, -1.567112923e+00F,
+    -8.678375185e-02F, 5.316680074e-01F, -3.534764051e-01F, -1.094499350e+00F, -9.744130820e-02F, -1.246640563e+00F, 5.431553721e-01F, 1.237137794e+00F,
+    -3.795657754e-01F, -5.024486408e-02F, 7.631786913e-02F, -3.267227113e-01F, 4.341202080e-01F, -1.901518852e-01F, 3.188905716e-01F, 8.097584359e-03F,
+    9.380137175e-02F, -3.858679235e-01F, 4.968185127e-01F, 1.784515083e-01F, -5.256794393e-03F, 1.672219336e-01F, 3.668675432e-03F, 2.441369891e-01F,
+    1.677121385e-03F, 1.771059930e-01F, 2.676595747e-01F, 3.748751581e-01F, -4.858740568e-01F, -3.299714923e-01F, -2.530580163e-01F, -2.407073081e-01F,
+    -2.185350955e-01F, 7.623390108e-02F, 2.003721148e-01F, 7.324250340e-01F, 1.992049962e-01F, 3.764266372e-01F, 7.230891380e-03F, 3.100124300e-01F,
+    -8.645940572e-02F, 1.639766842e-01F, 9.358272702e-02F, 1.286234111e-01F, 2.320688590e-02F, -5.377890170e-02F, 2.068190128e-01F, -1.640668064e-01F,
+    -1.314431801e-02F, -7.644189596e-01F, 1.777215004e-01F, 4.453871027e-02F, 2.584462613e-02F, 3.352824152e-01F, 3.031494915e-01F, 6.802847236e-02F,
+    -7.033728063e-02F, 3.437160701e-02F, 2.684718370e-02F, 4.983947054e-02F, -1.072729230e-01F, 1.277415156e-01F, -1.154380292e-01F, 1.279412806e-01F,
+    1.377147138e-01F, -4.239039421e-01F, 2.834120393e-01F, 5.987005830e-01F, -2.125214785e-01F, 5.639203787e-01F, 1.138225496e-01F, -1.970304921e-02F,
+    7.751680166e-02F, 5.138848349e-02F, 4.864224792e-02F, 5.732753873e-02F, 7.606393844e-02F, 2.986202762e-02F, 2.482346725e-03F, -3.188901022e-02F,
+    6.818476319e-02F, -2.312815189e-01F, -3.860622644e-02F, 9.548218548e-02F, -3.450391814e-02F, -2.222373188e-01F, -2.589859767e-03F, -1.275954843e-01F,
+    1.031573862e-03F, 4.295205325e-02F, 1.509211585e-02F, 1.545976661e-02F, 4.789457191e-03F, -3.331488743e-02F, 1.876145601e-02F, -1.533372048e-02F,
+    -7.193588465e-02F, 2.376197875e-01F, -2.063599788e-02F, -4.430599883e-02F, 3.442638740e-02F, -1.129402518e-01F, 3.166986629e-02F, -8.795735985e-02F,
+    7.532945275e-02F, 6.346562877e-03F, -3.100222442e-03F, -4.771884065e-03F, 3.288730234e-02F, 4.405266047e-02F, 5.772941280e-03F, 2.584373578e-02F,
+    -2.256055176e-02F, 7.872087508e-02F, 3.173935413e-02F, -9.105546772e-02F, -6.082456931e-02F, 7.988827303e-03F, 1.719024964e-02F, -2.547795419e-03F,
+    -3.490958810e-01F, 4.656487703e-02F, -9.065039456e-03F, -2.040919363e-01F, -1.328535527e-01F, 1.491626948e-01F, -2.996437252e-03F, -4.099933505e-01F,
+    -3.561592102e-02F, 6.076532602e-01F, 6.573588848e-01F, -5.879399776e-01F, -8.643963933e-02F, 5.051025748e-02F, 7.457071543e-01F, 2.626735866e-01F,
+    -6.684212685e-01F, -1.586032510e-01F, 1.201830879e-01F, -4.305726588e-01F, 3.856536746e-02F, 3.564973474e-01F, -2.612114251e-01F, -3.709146380e-01F,
+    1.811146438e-01F, 6.433309317e-01F, 2.908591740e-02F, -1.376773238e+00F, 4.474922419e-01F, -8.264628053e-01F, -1.688448638e-01F, 1.637765020e-01F,
+    2.582266927e-01F, 1.181291714e-01F, -1.680330932e-01F, 2.504569292e-01F, 7.880793884e-03F, 1.179019809e-01F, -1.814346611e-01F, -1.847645268e-02F,
+    2.187741846e-01F, 2.634809539e-02F, -1.074826345e-01F, 1.128107756e-01F, 3.519631326e-01F, 7.247025147e-03F, -1.049334407e-01F, 1.688594371e-01F,
+    1.189791918e+00F, 5.508100986e-01F, -3.221881390e-01F, 5.605117083e-01F, -1.629627347e-01F, -5.628045797e-01F, 5.146708488e-01F, 6.711362600e-01F,
+    -5.905568972e-02F, -1.292872071e+00F, -9.207149595e-02F, 1.829808593e+00F, -9.310710430e-01F, 1.779524326e+00F, 5.653921962e-01F, -3.369164839e-02F,
+    -6.479748990e-03F, 4.875233397e-02F, -1.624082327e-01F, -1.754135340e-01F, -3.021326363e-01F, -1.982666850e-01F, 5.792726949e-02F, -2.524776161e-01F,
+    -2.447306663e-01F, -1.335587800e-01F, 8.270134777e-02F, -1.981674880e-01F, -2.296337634e-01F, -1.784009039e-01F, -1.200094521e-01F, -1.989504546e-01F,
+    1.645826221e+00F, 8.034787178e-01F, -1.203396730e-02F, 7.366296053e-01F, -2.673764527e-01F, -6.021745205e-01F, 6.092725396e-01F, 8.139480948e-01F,
+    -3.996808082e-03F, -1.603778005e+00F, 3.097776771e-01F, 2.655349016e+00F, -1.405309558e+00F, 2.066018343e+00F, 4.110242128e-01F, -3.471601605e-01F,
+    -1.924134046e-01F, -1.986824274e-01F, -1.923343241e-01F, -1.165495291e-01F, -2.032056898e-01F, -2.654437423e-01F, -1.183890104e-01F, 3.763980418e-02F,
+    -1.263888180e-01F, -1.717844903e-01F, -1.339855492e-01F, -2.240809053e-02F, 1.914265379e-02F, -1.364233494e-01F, 6.100225821e-02F, -1.845196038e-01F,
+    1.767526746e+00F, 1.168243647e+00F, -1.293712407e-01F, 1.063213229e+00F, -4.020958543e-01F, -8.946614265e-01F, 7.141528726e-01F, 8.136536479e-01F,
+    -5.760635436e-02F, -2.087486744e+00F, 1.961010993e-01F, 3.288995981e+00F, -1.665000081e+00F, 2.802754641e+00F, 5.950764418e-01F, -1.038849428e-01F,
+    -1.425705999e-01F, -1.317729950e-01F, -1.555730999e-01F, 1.610095054e-02F, -1.448241621e-01F, -3.425011635e-01F, -6.922443211e-02F, -2.275698036e-01F,
+    1.488844007e-01F, -3.282807395e-02F, -1.069697663e-01F, -3.631656468e-01F, -2.790290415e-01F, -3.319119215e-01F, 1.332523227e-01F, -3.053220809e-01F,
+    2.224811554e+00F, 1.220151544e+00F, -1.073399559e-01F, 1.354653835e+00F, -4.497579932e-01F, -1.197423935e+00F, 5.211463571e-01F, 1.102067232e+00F,
+    1.458966434e-01F, -2.277833939e+00F, 1.831285059e-01F, 3.812640429e+00F, -2.348267555e+00F, 3.270473480e+00F, 8.165603876e-01F, -2.535915077e-01F,
+    -1.386345923e-01F, -2.099264264e-01F, -2.048450522e-02F, -3.213289678e-01F, -1.775737256e-01F, 2.442268841e-02F, 1.271328926e-01F, -1.116752401e-01F,
+    1.646583825e-01F, -1.989322901e-01F, -2.235518396e-01F, -1.534370929e-01F, -4.084246233e-02F, -1.247372329e-01F, 2.451582849e-01F, -1.603398472e-01F,
+    2.356290579e+00F, 1.182765126e+00F, -3.165741265e-01F, 1.502576351e+00F, -5.083333254e-01F, -1.329487324e+00F, 7.323725820e-01F, 1.111628294e+00F,
+    -1.224012598e-01F, -2.775591612e+00F, 3.109399080e-01F, 3.930756330e+00F, -2.227564096e+00F, 3.509727478e+00F, 1.007635593e+00F, -4.026158452e-01F,
+    1.286042482e-01F, 6.199565902e-02F, -1.054772660e-01F, -3.189935386e-01F, -3.735363781e-01F, -3.145073652e-01F, -1.157309413e-01F, -2.733134925e-01F,
+    5.146810040e-02F, -2.157492638e-01F, -2.016587257e-01F, -2.746466696e-01F, -3.177745044e-01F, -1.817669272e-01F, 2.175195813e-01F, -6.701146811e-02F,
+    5.154377222e-02F, 2.541821599e-01F, -4.863928556e-01F, 3.566038013e-01F, 3.610422611e-01F, 1.771055609e-01F, -3.379566595e-02F, -2.872460186e-01F,
+    1.623250991e-01F, 4.500437379e-01F, 7.425714284e-02F, -3.180733621e-01F, 4.618819654e-01F, -2.683954686e-02F, -9.129146338e-01F, -2.390155345e-01F,
+    9.427332282e-01F, -7.834399343e-01F, -1.038861632e+00F, 1.127078906e-01F, 6.484471560e-01F, 6.211285293e-02F, -1.967944056e-01F, -1.914780736e+00F,
+    -4.906545579e-01F, 7.894002795e-01F, 8.552570343e-01F, -4.381883442e-01F, 2.407258898e-01F, -2.612624168e-01F, -6.033372283e-01F, -1.228407502e+00F,
+    2.072355151e-01F, -8.533794880e-01F, -4.896984994e-01F, 3.202875257e-01F, 8.864270449e-01F, -2.156459540e-01F, 2.839526236e-01F, -3.150554001e-01F,
+    8.189319074e-02F, 1.304835200e+00F, 1.187935233e+00F, 2.487650365e-01F, -2.857615352e-01F, -3.150647879e-01F, 7.193732262e-02F, -2.565799654e-01F,
+    4.222730994e-01F, -1.783776999e+00F, 1.732912302e+00F, -7.160727978e-01F, -9.626034498e-01F, -1.044601679e+00F, 6.402722001e-01F, 2.319602489e+00F,
+    1.068271101e-01F, -1.528128982e+00F, -2.415122092e-01F, 1.029213071e-01F, -8.329550624e-01F, 7.840864062e-01F, 1.810892224e+00F, 4.781204164e-01F,
+    -2.592090964e-01F, 7.213325500e-01F, -3.252421618e-01F, -8.617352247e-01F, -3.582662046e-01F, -1.821128130e-01F, 1.285109371e-01F, -1.390680194e+00F,
+    -1.311945081e+00F, -7.824730277e-01F, 4.157787561e-02F, -1.989065170e+00F, -4.457588792e-01F, 4.007475674e-01F, 2.114288807e-01F, 3.180811405e-01F,
+    -8.785032630e-01F, -3.688184917e-01F, 6.141722798e-01F, -8.539752364e-01F, 7.320351601e-01F, 1.051884532e+00F, 4.579159245e-02F, -7.893916965e-01F,
+    -6.067115664e-01F, -6.578204036e-01F, 4.531412572e-02F, 9.323759079e-01F, -9.068917632e-01F, -1.268881321e+00F, 5.231847763e-01F, -8.411929607e-01F,
+    3.606033623e-01F, -1.293799639e+00F, 2.301548272e-01F, 7.365861535e-01F, 4.260753989e-01F, 3.274873793e-01F, -2.341893315e-01F, 3.398866355e-01F,
+    3.832935393e-01F, -3.488477319e-02F, -1.104557514e+00F, -8.622177839e-01F, -7.462453842e-02F, -2.317966074e-01F, 2.861673385e-02F, -7.548665255e-02F,
+    -6.941277981e-01F, -8.053125739e-01F, -1.122351527e+00F, -5.342780799e-02F, -6.790697575e-01F, 1.584984899e+00F, 9.537929296e-01F, 6.970048547e-01F,
+    -6.482917666e-01F, 5.070025325e-01F, 1.620092541e-01F, 5.920453668e-01F, 8.082615733e-01F, -9.846233130e-01F, 5.185161829e-01F, 8.835694939e-02F,
+    8.924490958e-02F, -4.979405403e-01F, 4.091268778e-01F, 4.852003753e-01F, 2.364465408e-02F, -9.106349945e-01F, 3.794405758e-01F, 3.080991209e-01F,
+    6.282766461e-01F, -5.176528096e-01F, -2.200893164e-01F, 9.147351980e-02F, -1.122917175e+00F, 5.237662196e-01F, -5.654891729e-01F, -2.498435974e-01F,
+    -4.140827358e-01F, 3.741578460e-01F, -4.767907560e-01F, -4.865844846e-01F, -1.311604679e-01F, 4.257034957e-01F, -5.293284059e-01F, 1.061181903e+00F,
+    -8.772218823e-01F, 5.162876248e-01F, -1.743260920e-01F, 8.006822467e-01F, -1.209868789e+00F, -4.247421324e-01F, -2.157824486e-01F, -3.010438085e-01F,
+    -6.110500097e-01F, 6.608803272e-01F, 6.501859426e-01F, 1.011207938e+00F, 3.769247532e-01F, 3.479107618e-01F, 3.809595853e-02F, 8.652710915e-01F,
+    3.568443358e-01F, 3.942905664e-01F, -2.152388990e-01F, 9.775007367e-01F, 1.165620685e-01F, 1.135992408e+00F, -1.861093491e-01F, 2.362672538e-01F,
+    -3.964312375e-01F, -1.213958502e+00F, -5.125622153e-01F, 5.065466762e-01F, 3.257361054e-01F, -9.790404886e-02F, 3.380949423e-02F, -1.892123669e-01F,
+    -8.298920393e-01F, -1.016412154e-01F, 1.603539884e-01F, -2.385751307e-01F, 1.024318337e+00F, -1.018178940e+00F, -4.382993653e-02F, -3.003139794e-02F,
+    2.635183185e-02F, -2.403683960e-02F, -3.977480233e-01F, 9.082408249e-02F, 3.597874939e-01F, 8.312050253e-02F, -6.384193301e-01F, -2.963308990e-01F,
+    -3.370164633e-01F, 6.590055674e-02F, -3.432134688e-01F, -3.990060985e-01F, -3.082517087e-01F, -4.306128621e-01F, -6.962774396e-01F, -3.241650164e-01F,
+    2.671743333e-01F, -4.337523282e-01F, 1.980990916e-01F, 6.987345815e-01F, 5.461256504e-01F, -1.607325524e-01F, -4.731305838e-01F, -1.333714128e-01F,
+    -1.608392596e-01F, -7.747507840e-02F, -1.120795906e-01F, 4.472776949e-01F, -7.625511289e-01F, 3.233024478e-01F, -2.666057944e-01F, -1.817356050e-01F,
+    -1.101994216e-01F, 1.141313165e-01F, -7.892248221e-03F, -5.767830834e-02F, -1.040789112e-01F, -5.329387262e-02F, -1.274290383e-01F, -1.055930089e-02F,
+    7.453721762e-02F, 8.104550652e-03F, 2.660426795e-01F, 1.987418234e-01F, -7.255293429e-02F, 2.955527306e-01F, 2.848150730e-01F, -2.813033164e-01F,
+    -1.329395324e-01F, -4.020635411e-02F, -6.446765363e-02F, -1.715725958e-01F, 1.238864437e-01F, -5.645709578e-03F, -2.126815170e-01F, -9.618448466e-02F,
+    4.215049744e-02F, -3.318546340e-02F, -1.238536984e-01F, 1.740994304e-01F, -1.050446704e-01F, -3.357653618e-01F, -1.463630497e-01F, 1.021372378e-01F,
+    2.412180044e-02F, -5.455769226e-02F, 2.698086202e-02F, 5.107662454e-02F, 4.913496971e-02F, 1.362456568e-02F, -1.329171658e-02F, 8.907844312e-03F,
+    -6.982170045e-02F, 2.981025539e-02F, 2.102421038e-02F, -1.261132360e-01F, -1.455454156e-02F, -3.007882461e-02F, -4.292394500e-03F, 2.776755020e-02F,
+    8.042570204e-02F, -2.555760182e-02F, 3.331346810e-02F, 5.742881820e-02F, -1.007203534e-01F, -4.706699867e-03F, 8.411677554e-03F, -2.090046555e-02F,
+    4.303726554e-02F, 6.274335831e-02F, -4.661075771e-02F, 9.915717877e-03F, 3.187757358e-02F, 2.890866064e-02F, 4.102080688e-02F, -5.434463173e-02F,
+    1.574140228e-02F, 2.869464271e-02F, -1.496774890e-02F, -1.447057445e-02F, -3.009564988e-02F, -4.518999532e-02F, 2.224902250e-02F, 2.197257243e-02F,
+    1.947381534e-02F, -1.150452881e-03F, -1.791146700e-03F, 2.790961042e-02F, -1.619469188e-02F, 5.442016292e-03F, 1.919953898e-02F, -4.847613350e-02F,
+    -2.179665416e-01F, 3.918089867e-01F, 3.704891801e-01F, 1.614882201e-01F, -4.578106850e-02F, -2.067128122e-01F, 8.697173744e-02F, -1.335547566e-01F,
+    5.507127941e-02F, 3.978047669e-01F, 3.382391036e-01F, 1.509108245e-01F, -9.373759851e-03F, -4.565258324e-01F, 9.179146588e-02F, -1.469865292e-01F,
+    -8.074221015e-01F, -6.119490266e-01F, 6.350743771e-01F, -4.081847072e-01F, 3.821669221e-01F, -1.125952788e-02F, -9.179841876e-01F, 4.742681384e-01F,
+    -9.141121507e-01F, 6.427477300e-02F, 1.209721327e+00F, 2.168716937e-01F, 3.756988943e-01F, 9.697624445e-01F, -5.758583546e-02F, -4.258886874e-01F,
+    -7.291570771e-03F, 1.638166457e-01F, 2.852934413e-02F, 3.204191104e-02F, -4.820662364e-02F, 1.261807978e-01F, -1.730657071e-01F, -1.707785130e-01F,
+    -1.323369443e-01F, 3.392490149e-01F, -3.748654202e-02F, 5.890051648e-02F, -1.545974053e-02F, 2.242915481e-01F, 6.466314942e-02F, 6.196455657e-02F,
+    1.540843844e+00F, 6.226266026e-01F, -8.589051366e-01F, 9.314337969e-01F, -7.121950388e-01F, -1.201386005e-01F, 1.031455994e+00F, -1.156913996e+00F,
+    1.328773022e+00F, 1.267240047e-01F, -1.430690527e+00F, -8.173605204e-01F, -5.798127651e-01F, -1.103027105e+00F, -2.021661699e-01F, 2.771030068e-01F,
+    -1.076935753e-01F, -3.685203791e-01F, 9.280839562e-02F, 1.142401621e-02F, -6.559469551e-02F, -2.290899865e-03F, 1.677434891e-01F, -4.025160521e-02F,
+    7.052068412e-02F, -2.898583412e-01F, 7.033534348e-02F, -2.578920126e-01F, -8.654804900e-03F, 1.354103535e-01F, 1.566114277e-01F, -1.594870389e-01F,
+    2.056258440e+00F, 8.070353270e-01F, -1.077528954e+00F, 1.494840503e+00F, -1.176370740e+00F, -2.049337924e-01F, 1.557211637e+00F, -1.298453093e+00F,
+    1.624221921e+00F, 8.922930062e-02F, -2.082252026e+00F, -8.163714409e-01F, -7.905809283e-01F, -1.520680666e+00F, -4.369111657e-01F, 4.783098102e-01F,
+    1.465211902e-02F, -1.405487508e-01F, 2.157685161e-02F, -1.514789164e-01F, 1.487346143e-01F, -1.803740277e-03F, 1.640856117e-01F, -1.411762238e-01F,
+    1.773136854e-01F, -1.173975021e-01F, 1.172322780e-01F, -1.458780766e-01F, 2.919914387e-02F, -8.824062347e-02F, 1.508662850e-01F, 2.009321153e-01F,
+    2.177789927e+00F, 7.818776369e-01F, -1.590846419e+00F, 1.499841094e+00F, -1.761099696e+00F, -2.676687539e-01F, 2.139050961e+00F, -1.529570103e+00F,
+    2.170732260e+00F, -7.101050764e-02F, -2.966550112e+00F, -1.201943398e+00F, -1.063815713e+00F, -2.392231703e+00F, -3.752766252e-01F, 6.807771325e-01F,
+    1.967413425e-01F, 6.316238549e-03F, 5.083383247e-02F, 1.538439691e-01F, -2.368387431e-01F, -1.591255218e-01F, 2.350585014e-01F, 1.826239526e-01F,
+    -5.253015831e-02F, 7.383425720e-03F, 7.855847478e-02F, -5.834294483e-02F, -2.421946079e-02F, -8.500637114e-02F, 8.986350149e-02F, -1.563077271e-01F,
+    2.602196217e+00F, 9.520735145e-01F, -1.433842301e+00F, 2.111950159e+00F, -1.643412471e+00F, -3.641840219e-01F, 2.608510256e+00F, -1.759736776e+00F,
+    2.028087854e+00F, 7.003427483e-03F, -3.302677393e+00F, -1.171845436e+00F, -1.283846140e+00F, -2.633655310e+00F, -2.463985234e-01F, 9.260231256e-01F,
+    1.513141096e-01F, -3.878641129e-01F, -8.555586636e-02F, 3.669122234e-02F, 3.984088823e-02F, 3.698693216e-02F, -1.637078673e-01F, 1.682072282e-01F,
+    1.008465365e-01F, -9.260403365e-02F, -2.939938381e-02F, -2.634279430e-02F, 1.441097409e-01F, 4.313790053e-02F, -8.408113569e-02F, -8.038168401e-02F,
+    2.719433069e+00F, 1.047239065e+00F, -1.591507912e+00F, 2.048344374e+00F, -2.039516926e+00F, -3.332168460e-01F, 2.567728281e+00F, -1.922581434e+00F,
+    2.202335119e+00F, 2.495852411e-01F, -3.734608650e+00F, -1.224273920e+00F, -1.117806792e+00F, -2.543427944e+00F, -3.425199687e-01F, 8.852894306e-01F,
+    1.636244059e-01F, -2.449931949e-01F, 4.703395069e-02F, -1.632309258e-01F, 1.395760197e-02F, 1.145985648e-01F, -1.094575003e-01F, 2.053655684e-01F,
+    -2.077213824e-01F, -3.783648610e-01F, 7.406193018e-02F, -1.066192463e-01F, 9.446048737e-02F, 7.496875711e-03F, -1.789201349e-01F, -5.503240600e-02F,
+    -5.304175019e-01F, -3.608145937e-02F, 5.076546073e-01F, -4.618788958e-01F, -2.036783099e-02F, 2.839095294e-01F, -4.388515651e-02F, 2.522596121e-01F,
+    2.488358170e-01F, -1.688026935e-01F, 2.627615631e-01F, -1.378320694e+00F, 1.508151740e-01F, 3.715115786e-01F, -2.354159504e-01F, 3.078119457e-01F,
+    -4.113287106e-02F, 9.873326421e-01F, -5.053061247e-01F, -1.344717890e-01F, 9.701867700e-01F, 6.810691357e-01F, -7.943061739e-02F, -1.530232956e-03F,
+    -4.275933206e-01F, -4.605101421e-02F, -5.313929915e-01F, -1.807091355e+00F, -7.010605335e-01F, 4.961292446e-01F, -7.334873662e-04F, -5.424930155e-02F,
+    -9.982833266e-01F, 3.803251982e-01F, -1.014954209e+00F, -3.349155188e-01F, 4.733465016e-01F, 4.372897446e-01F, 5.997283012e-02F, -3.005742431e-01F,
+    -3.244359493e-01F, -5.045484304e-01F, -8.287693858e-01F, 1.028235555e+00F, -1.367654681e+00F, 1.632354409e-01F, 1.260725409e-01F, -7.073507905e-01F,
+    1.085303068e+00F, -4.262153208e-01F, -1.647586703e+00F, -1.557379067e-01F, -7.643662691e-01F, -7.355465889e-01F, -9.350584447e-02F, -7.668358088e-01F,
+    -1.512678117e-01F, -1.312927306e-01F, -3.536525369e-01F, 5.969486833e-01F, -1.040489674e-01F, -6.671487093e-01F, -1.865953058e-01F, -5.563377142e-01F,
+    9.657734036e-01F, -8.424912095e-01F, -4.682879746e-01F, 5.380338803e-02F, -8.113362640e-02F, 2.614474483e-02F, -2.378527075e-02F, -1.046509147e+00F,
+    2.167964429e-01F, 2.705530822e-01F, 1.384747773e-01F, 1.351538062e+00F, -3.729860187e-01F, 1.698233724e+00F, 6.763380021e-02F, -5.234001279e-01F,
+    1.496894240e+00F, 3.585978746e-01F, -3.983746171e-01F, -4.878696501e-01F, 3.642213345e-01F, -1.354018927e+00F, -7.842443138e-02F, 1.152634859e+00F,
+    1.559063196e+00F, -1.144074678e+00F, -7.241674066e-01F, 8.387708664e-01F, 5.915248394e-01F, 1.254694313e-01F, 1.532475054e-01F, -1.913957596e-01F,
+    6.824585199e-01F, 6.225813627e-01F, -1.451271534e+00F, -4.041797668e-02F, -9.787250161e-01F, -3.109406233e-01F, -9.227210283e-02F, 2.828928530e-01F,
+    -1.459271312e-01F, 1.425891042e+00F, -1.160132051e+00F, 1.164789557e+00F, -9.236673713e-01F, 2.881102562e-01F, -4.410761595e-02F, -9.778074622e-01F,
+    -5.377385616e-01F, -1.106313393e-01F, -6.610934734e-01F, 1.653758585e-01F, 5.939689279e-01F, 4.223177135e-01F, -8.255402558e-03F, 1.628131509e+00F,
+    -5.813149214e-01F, -1.648080051e-01F, -6.272012591e-01F, 1.210097790e+00F, 9.145585895e-01F, -1.525380164e-01F, 1.314529628e-01F, -9.857720137e-01F,
+    8.693114519e-01F, 1.310191154e+00F, 4.815149903e-01F, -1.927400529e-01F, -8.743473291e-01F, 1.348430514e-01F, -1.270842999e-01F, 3.387604952e-01F,
+    -3.936442733e-01F, -4.375573099e-01F, 9.346427917e-01F, 5.193716884e-01F, -1.060612917e+00F, -2.996320724e-01F, -5.686024949e-02F, 2.023383081e-01F,
+    3.878824711e-01F, -4.694024026e-01F, -2.183850557e-01F, 1.918531256e-03F, -1.199741006e+00F, -1.044113655e-02F, 5.604395270e-02F, -3.759073317e-01F,
+    4.937390611e-02F, -6.048201919e-01F, 9.206196666e-01F, 6.230629683e-01F, -8.565418422e-02F, 5.073528886e-01F, -7.039403915e-02F, 3.201062679e-01F,
+    1.298647374e-01F, 7.382043451e-02F, -8.482154012e-01F, -8.892165869e-02F, 9.380646944e-01F, 5.643046498e-01F, -1.142337359e-02F, -4.083743319e-02F,
+    4.954221845e-01F, 6.797982454e-01F, 7.095938921e-01F, 4.160502851e-01F, -7.821979523e-01F, 1.035327435e+00F, -1.759853661e-01F, -8.821778297e-01F,
+    4.676941633e-01F, 1.042971849e+00F, 1.108790413e-01F, -6.097948179e-02F, 8.440943956e-01F, 9.433558583e-01F, 1.283379644e-01F, 1.509473771e-01F,
+    2.514532804e-01F, -1.693494797e+00F, 4.155488610e-01F, 1.662929773e+00F, -1.096221581e-01F, -3.376408219e-01F, -5.275553465e-02F, 6.119221449e-02F,
+    -6.222773790e-01F, 1.795193180e-02F, -1.909870654e-01F, -2.486380488e-01F, -3.196571469e-01F, 1.801213324e-01F, 8.805815130e-02F, -5.006891489e-01F,
+    5.600640774e-01F, 4.049393833e-01F, 1.385814399e-01F, 4.099752307e-01F, -3.381146789e-01F, -2.350355834e-01F, -1.244354099e-01F, -6.241642237e-01F,
+    6.619632989e-02F, -3.317518830e-01F, 2.679018676e-01F, 2.104525566e-01F, -2.845793664e-01F, -4.890313148e-01F, 1.112230420e-01F, -2.565957904e-01F,
+    1.236821532e+00F, -3.816175759e-01F, -1.508318335e-01F, 1.158938766e+00F, 3.824329376e-01F, 2.817377448e-01F, 1.091839671e-01F, -8.185080253e-03F,
+    3.945267200e-02F, 1.482038200e-01F, -6.167371199e-02F, 2.429910377e-02F, 2.783528902e-02F, -1.206057817e-01F, 1.490036994e-01F, -6.254078448e-02F,
+    1.204160824e-01F, 2.592559457e-01F, 2.637521327e-01F, 4.127951339e-02F, 5.496611446e-02F, 1.202792972e-01F, 7.946603931e-03F, -3.845531046e-01F,
+    8.480726182e-02F, -1.399654597e-01F, 1.969820857e-01F, 4.606370255e-02F, -7.018515468e-02F, 2.008077055e-01F, -7.063793391e-02F, -1.048571318e-01F,
+    3.227385506e-02F, 5.939759687e-02F, 5.105412751e-02F, 1.351332664e+00F, -8.781259507e-02F, 1.553623378e-01F, -1.569485068e-01F, 7.431257516e-02F,
+    3.384422883e-02F, -1.187647111e-03F, -1.983737014e-02F, -3.441682085e-03F, 1.022879854e-01F, 8.597718179e-02F, 3.031818755e-02F, 2.367447875e-02F,
+    -1.934187114e-01F, 8.176115900e-02F, 3.559818491e-02F, -3.646968305e-01F, -1.472944766e-01F, -4.570934922e-02F, -6.530986726e-02F, 3.803921118e-02F,
+    -4.117940366e-02F, 2.731387317e-02F, 2.096794918e-02F, -5.567158572e-03F, 3.863840178e-02F, 3.625467047e-02F, -1.707844585e-01F, 5.905398354e-02F,
+    -7.094358653e-02F, -1.221679896e-01F, -7.012092322e-02F, 1.240829349e+00F, -5.588551983e-02F, 2.677506208e-02F, -1.292333305e-01F, 9.083665162e-02F,
+    1.909790188e-02F, 8.763993159e-03F, -2.457976528e-02F, -4.887840524e-02F, -2.439777553e-02F, 1.907263696e-02F, 1.591192931e-01F, 1.271216106e-02F,
+    4.169527069e-02F, 1.734551042e-02F, -2.438846976e-02F, -1.074938893e+00F, -5.662496388e-02F, 2.631313540e-02F, 1.020672694e-01F, -3.540560231e-02F,
+    -9.851168096e-02F, -7.975186408e-02F, 4.785244353e-03F, -2.369678020e-01F, 5.209426880e-01F, 4.707092643e-01F, 3.851572424e-02F, -1.866451800e-01F,
+    -5.073747039e-01F, 6.665721536e-01F, -2.675212026e-01F, -1.777505688e-02F, -3.416546881e-01F, -3.874155283e-01F, 1.341982633e-01F, -1.606009752e-01F,
+    7.987938523e-01F, -9.494475089e-03F, 1.065169275e-01F, 1.844642013e-01F, 2.129542530e-01F, -6.048843265e-01F, 1.585845947e-01F, -5.767627805e-02F,
+    -2.397829741e-01F, -2.113420703e-02F, 2.558174431e-01F, -1.240217984e-01F, 1.335818619e-01F, 1.269230127e+00F, 1.361212879e-01F, 1.036925614e-01F,
+    -2.194439024e-01F, 7.275859267e-02F, 3.266028166e-01F, 3.314123452e-01F, 2.176225930e-01F, -9.828791022e-02F, 3.368868306e-02F, -2.431933880e-01F,
+    5.621928722e-02F, 1.689847261e-01F, 1.096077785e-01F, 5.411181450e-01F, 4.809634760e-02F, 1.231145347e-03F, -1.013771445e-01F, 9.536635876e-02F,
+    -1.521020889e+00F, -1.462610811e-02F, -1.111174002e-02F, -1.455101222e-01F, -4.560207576e-02F, 1.255572200e+00F, -1.694708876e-02F, 2.437017672e-02F,
+    4.960583150e-01F, 3.070297837e-01F, -4.501916170e-01F, 4.667343795e-01F, -6.218139082e-03F, -2.269648790e+00F, -1.595150679e-02F, -3.405590951e-01F,
+    1.089995429e-01F, -1.065747887e-01F, 4.942423850e-02F, -3.178187311e-01F, -1.132003441e-01F, -1.427911520e-01F, -9.647553414e-02F, 4.129866511e-02F,
+    -1.047715172e-01F, -7.153418660e-02F, -2.144036740e-01F, -4.218648970e-01F, -1.689980365e-02F, -2.519296110e-01F, -3.045045733e-01F, -6.259045005e-02F,
+    -1.866780639e+00F, -3.873899579e-01F, -1.262891442e-01F, -4.412595034e-01F, -3.199113607e-01F, 1.588916063e+00F, -5.377339199e-02F, -2.931892872e-01F,
+    1.154703617e+00F, 3.648770750e-01F, -5.593535900e-01F, 4.171266258e-01F, -4.418758750e-01F, -2.692784548e+00F, 1.866978258e-01F, -4.578986168e-01F,
+    -1.669537509e-03F, -1.072840244e-01F, -2.787697911e-01F, -3.592898548e-01F, -1.624699086e-01F, -1.728522405e-02F, -1.554678679e-01F, -7.763457298e-02F,
+    -1.927785762e-02F, 2.112264000e-02F, 6.463906914e-02F, -5.771027803e-01F, -8.399107307e-02F, -1.803485453e-01F, -3.039427288e-02F, 1.206515580e-01F,
+    -2.617978334e+00F, -2.891512215e-02F, -3.072758615e-01F, -8.668123484e-01F, -1.703657955e-01F, 2.164947987e+00F, -4.605833814e-02F, -2.264159173e-01F,
+    1.097073078e+00F, 7.025908828e-01F, -6.757402420e-01F, 5.685266256e-01F, -4.902812839e-01F, -3.643270731e+00F, -6.537001580e-02F, -8.419544101e-01F,
+    1.622025520e-01F, 2.552310936e-02F, -3.164686561e-01F, -2.530328631e-01F, -2.343880478e-03F, -1.285182834e-01F, -2.466506362e-01F, 7.965776138e-03F,
+    7.425756776e-04F, -2.223416120e-01F, -1.884666532e-01F, -5.353176594e-01F, -2.654342055e-01F, 6.727461517e-02F, -1.916550398e-01F, 2.421898246e-01F,
+    -2.834394455e+00F, -3.206580579e-01F, 4.137081653e-02F, -9.300081134e-01F, -8.593782037e-02F, 2.125165701e+00F, 1.152945980e-01F, -2.177718729e-01F,
+    1.490174890e+00F, 7.674962878e-01F, -3.207454085e-01F, 8.063970804e-01F, -2.909953892e-01F, -4.217765331e+00F, 6.661727279e-02F, -6.360256672e-01F,
+    1.746935397e-01F, -1.035756767e-01F, -2.995715737e-01F, -5.526386499e-01F, -1.351433527e-02F, 1.027952284e-01F, -9.366446733e-02F, -4.549015313e-02F,
+    -1.602919847e-01F, 8.622528613e-02F, -1.299292892e-01F, -6.628854275e-01F, -6.210852042e-02F, -1.066219658e-01F, -1.692709029e-01F, -1.057690196e-02F,
+    -3.222297430e+00F, -4.358823299e-01F, -2.639828324e-01F, -1.165339947e+00F, -3.772433996e-01F, 2.307895899e+00F, 1.043684483e-01F, 1.584305987e-02F,
+    1.479683399e+00F, 6.524463296e-01F, -3.454489112e-01F, 1.217494249e+00F, -4.765529037e-01F, -4.230558872e+00F, -2.097017616e-01F, -8.241528273e-01F,
+    6.817343086e-02F, -1.647651941e-01F, -8.610312827e-03F, -4.762884080e-01F, 2.870844491e-02F, 7.243978977e-02F, -1.492687464e-01F, 1.011932790e-01F,
+    -1.705837399e-01F, -1.055572331e-01F, -3.133877516e-01F, -5.361934900e-01F, -1.012920663e-01F, -2.630653977e-01F, -2.993300855e-01F, 1.888746619e-01F,
+    -3.834565878e-01F, -4.418615103e-01F, 2.162041701e-02F, 1.245474219e-01F, -3.893900514e-01F, -2.158697098e-01F, -6.168778613e-02F, 2.971906364e-01F,
+    -1.008810282e+00F, -4.434416294e-01F, -1.818192005e-02F, -9.322594851e-02F, -7.919390798e-01F, -5.461016204e-03F, -2.753820121e-01F, -3.536357284e-01F,
+    3.155044317e-01F, 3.658716381e-01F, 2.621340454e-01F, -4.663558006e-01F, -3.854534924e-01F, -1.063460708e+00F, 3.541660309e-01F, -2.333421856e-01F,
+    5.826504827e-01F, -4.577285945e-01F, -1.045880556e+00F, 7.910487056e-01F, -2.062423378e-01F, 2.963366508e-01F, -1.283294916e+00F, -1.053357646e-01F,
+    1.424477696e-01F, 3.586335182e-01F, 1.525484174e-01F, -7.536026239e-01F, 5.139891431e-02F, -1.099266648e+00F, 2.309937179e-01F, 5.719004869e-01F,
+    1.373168230e-01F, -3.057231903e-01F, -6.860428303e-02F, -1.622858271e-02F, 7.964614779e-02F, -4.620190859e-01F, 1.642160714e-01F, -4.593812302e-02F,
+    2.405906618e-01F, 1.293979883e+00F, -2.334021777e-01F, -6.048887223e-02F, 8.838521242e-01F, 8.492167592e-01F, -2.081455588e-01F, -8.048299700e-02F,
+    1.208429098e+00F, 8.262428641e-01F, -2.712588310e-01F, 5.895878673e-01F, 1.539891958e+00F, 1.625050306e-01F, 7.086641788e-01F, 3.384495899e-02F,
+    1.167852640e+00F, 3.992416263e-01F, 3.126937151e-01F, -2.328065336e-01F, -1.068070650e+00F, -8.839120865e-01F, 2.990505695e-01F, -8.006533980e-01F,
+    6.431946158e-01F, -5.045136213e-01F, -2.885369658e-01F, 7.377736270e-02F, -6.185035706e-01F, 1.700453520e+00F, -2.737791836e-01F, -3.171462100e-03F,
+    -4.636026025e-01F, -5.372967124e-01F, 3.215918541e-01F, -2.524851263e-02F, -4.679491371e-02F, -8.729456663e-01F, 3.800588101e-02F, -2.062032223e+00F,
+    3.597802818e-01F, -1.223509908e+00F, 1.654758453e+00F, -2.853279114e-01F, 9.418787956e-01F, -9.664877057e-01F, -4.001208544e-01F, 1.244546771e-01F,
+    -7.395501733e-01F, -1.396776736e-01F, -8.474821448e-01F, -3.207204044e-01F, 9.093137980e-01F, 4.344999194e-01F, 7.243951559e-01F, 1.458155274e+00F,
+    -1.242979169e+00F, 4.927567840e-01F, -4.433738589e-01F, -3.986127079e-01F, -2.609624565e-01F, -4.985120595e-01F, -2.337103635e-01F, -1.260020882e-01F,
+    7.487469912e-01F, 4.155767560e-01F, 1.122797608e+00F, 6.207150221e-01F, -2.990100980e-01F, 1.750981569e+00F, -1.761941433e+00F, -3.302879035e-01F,
+    7.584707141e-01F, 3.704838753e-01F, 4.226351082e-01F, 8.999589682e-01F, -2.056529820e-01F, 1.441503465e-01F, -3.103043512e-02F, -2.265148312e-01F,
+    -7.253880501e-01F, -8.469172120e-01F, 2.672330439e-01F, -9.496722817e-01F, -1.358937860e+00F, 1.429338753e-01F, -7.465246916e-01F, -9.278061986e-01F,
+    1.404398918e+00F, -2.641015947e-01F, -4.116246402e-01F, 3.465324342e-01F, -4.925336838e-01F, 4.707962871e-01F, -9.555419087e-01F, 1.623995602e-01F,
+    -2.206717581e-01F, -1.523008108e+00F, 3.790103495e-01F, -1.280631125e-01F, 2.333837152e-01F, 6.550052762e-01F, -1.917515695e-01F, -4.909477532e-01F,
+    4.357717931e-01F, -4.002154171e-01F, 6.745718718e-01F, 1.429554701e+00F, -5.020292997e-01F, 1.550825983e-01F, 2.164405584e+00F, 2.734416723e-01F,
+    4.668300226e-02F, -4.141292870e-01F, 3.350557759e-02F, 1.281883121e-01F, -8.181574941e-01F, -2.915022373e-01F, 6.140024066e-01F, 9.712667763e-02F,
+    8.509511352e-01F, 9.908512235e-02F, -7.633033991e-01F, 3.195002675e-02F, 1.026300073e+00F, -4.915747792e-03F, 2.077827305e-01F, -1.048031211e+00F,
+    5.679513812e-01F, 1.362917759e-02F, -1.106826305e+00F, -9.446352720e-01F, 3.318545520e-01F, 1.267150789e-01F, 4.102903605e-01F, -4.347216785e-01F,
+    -1.334747076e+00F, 1.346085310e+00F, 2.087493390e-01F, 1.133532524e-01F, -5.223619938e-01F, -7.306486368e-01F, 5.324419737e-01F, 3.211424053e-01F,
+    -2.437230796e-01F, -4.142657220e-01F, 2.682535052e-01F, 5.244175196e-01F, 1.844847053e-01F, 3.301670030e-02F, -5.264760926e-02F, -1.157908365e-01F,
+    -9.012680054e-01F, -5.295205712e-01F, 4.982484877e-01F, 2.539415061e-01F, 5.453480482e-01F, 6.039150357e-01F, -1.098099053e-01F, 2.460086793e-01F,
+    6.725756526e-01F, 8.727304339e-01F, 1.116065904e-01F, 1.890204102e-01F, 3.059820235e-01F, -5.030249804e-02F, -4.091387242e-02F, -3.806967735e-01F,
+    7.842957377e-01F, 1.489604473e+00F, -1.403730661e-01F, -4.182429314e-01F, -4.820834398e-01F, -1.394544840e-01F, 3.119902909e-01F, 3.881804943e-01F,
+    6.931547821e-02F, -3.529363312e-03F, 1.698117256e-01F, -5.070350692e-02F, 3.728857264e-02F, -5.420918390e-02F, 9.292160720e-02F, 4.360807240e-01F,
+    -1.774245054e-01F, 1.484421194e-01F, 2.290234715e-01F, -3.541065454e-01F, 4.013842344e-01F, 3.869278431e-01F, -1.747727990e-01F, -4.682819545e-01F,
+    -2.109935880e-01F, -6.033202261e-02F, 2.208175659e-01F, -2.218146995e-02F, -5.068595707e-02F, -7.816516445e-04F, 1.232752949e-01F, 1.144135967e-01F,
+    3.550174832e-02F, -1.066670120e-01F, -3.613312542e-02F, 3.869454563e-01F, -3.352522254e-01F, -3.892802894e-01F, 6.243736669e-02F, -6.090298295e-01F,
+    -2.824566327e-02F, 5.086450651e-02F, 4.848337173e-02F, 6.578720361e-02F, -6.727255881e-02F, 6.551608443e-03F, -1.031468585e-01F, 7.604851574e-02F,
+    -2.257375792e-02F, -1.187894866e-01F, 5.376351066e-03F, 3.359228745e-02F, -6.698844489e-03F, -5.185878277e-02F, 1.227453649e-01F, 2.549954876e-02F,
+    4.198766872e-02F, 6.869752891e-03F, -5.531126633e-02F, -7.122468203e-02F, -3.451392427e-02F, -5.941225681e-03F, -2.569412626e-02F, -1.285459939e-02F,
+    -1.644957252e-02F, 8.317390457e-03F, -6.414648145e-02F, -4.138224944e-02F, 9.532477707e-02F, -2.874546126e-02F, 6.745023280e-02F, -2.086620331e-01F,
+    -5.524052680e-02F, 4.876872897e-02F, -1.423341688e-02F, -1.860019751e-02F, 3.522534668e-02F, 2.861630637e-03F, 5.897362158e-02F, 2.056683227e-02F,
+    -1.078267545e-01F, 1.043170225e-02F, 2.318957262e-02F, -7.022474706e-02F, -2.171445079e-02F, -1.853262447e-02F, -1.943490282e-02F, 4.414905328e-03F,
+    8.908193558e-03F, -2.440792024e-01F, -5.772756413e-02F, -8.919110894e-02F, -1.190604717e-01F, -1.481649727e-01F, -7.435638458e-02F, 1.013064012e-01F,
+    -2.749471068e-01F, 2.416124791e-01F, -3.940398991e-01F, -1.870072037e-01F, -8.738647401e-02F, -6.351751685e-01F, -1.230073422e-01F, -5.059806108e-01F,
+    -3.994880617e-01F, -1.298548579e-01F, -6.300252676e-01F, -1.441471130e-01F, -4.198222756e-01F, 4.751808643e-01F, 6.360620856e-01F, 9.192948043e-02F,
+    6.415686756e-02F, -9.007591009e-01F, 7.171291858e-02F, -2.400227338e-01F, 1.038394123e-01F, 6.058999896e-01F, 5.098046064e-01F, -4.800132662e-02F,
+    3.877811134e-01F, -1.254539937e-01F, -9.485923499e-02F, 2.331700474e-01F, 7.024214417e-02F, 1.998118013e-01F, -3.797026351e-02F, 1.608833112e-02F,
+    1.589556783e-01F, 1.335882396e-01F, 2.187457234e-01F, 4.921024293e-02F, -1.639309525e-01F, 1.048717797e-01F, 2.290838212e-02F, 1.202201024e-01F,
+    4.313467443e-01F, 2.288854122e-01F, 8.173825145e-01F, 2.528690100e-01F, 4.368830621e-01F, -5.818603635e-01F, -8.865832686e-01F, -6.394822150e-02F,
+    -2.893663943e-01F, 1.462575674e+00F, 5.282246321e-02F, 6.828122139e-01F, -3.546389639e-01F, -6.785009503e-01F, -5.961236954e-01F, -2.833330631e-02F,
+    -9.382075816e-02F, 1.196676344e-01F, -8.638235182e-02F, 5.138039589e-02F, -2.531009912e-01F, 1.400190871e-02F, -2.805868089e-01F, 1.483028978e-01F,
+    -4.226226509e-01F, 9.322801977e-02F, 1.759710759e-01F, -1.660015620e-02F, -2.210292965e-02F, 1.281762775e-02F, 8.432485163e-02F, -5.618167669e-02F,
+    9.182708263e-01F, 3.007768989e-01F, 1.331486106e+00F, 1.848279536e-01F, 5.603131056e-01F, -9.725981951e-01F, -1.179306746e+00F, 1.903865337e-01F,
+    -7.857305408e-01F, 2.204105377e+00F, 3.284517527e-01F, 1.170480132e+00F, -5.557402968e-01F, -1.256477475e+00F, -1.022377968e+00F, -7.329154015e-02F,
+    -1.459127069e-01F, -1.884025782e-01F, -2.176948935e-01F, 1.155541614e-01F, -5.773697048e-02F, 1.604662687e-01F, 1.315397620e-01F, 3.740673419e-03F,
+    -2.788854539e-01F, -1.464537531e-01F, 1.133332327e-01F, 4.591131955e-02F, 9.572865814e-02F, -2.481045574e-01F, -2.794223726e-01F, 4.649243504e-02F,
+    1.284732819e+00F, 2.903722525e-01F, 1.393250585e+00F, 4.457394481e-01F, 8.934052587e-01F, -1.308458328e+00F, -1.602479815e+00F, 5.085528642e-02F,
+    -7.600653172e-01F, 2.554114819e+00F, 6.819798797e-02F, 1.619227648e+00F, -1.035895944e+00F, -1.216538191e+00F, -1.091962099e+00F, 2.077241987e-01F,
+    -1.114387140e-01F, 2.458628081e-02F, 9.539230913e-02F, 5.727463402e-03F, -4.280969501e-02F, 5.171374604e-02F, -7.631757110e-02F, 1.066140309e-01F,
+    -2.243641466e-01F, -5.226716772e-02F, 2.773472667e-02F, 8.174967766e-02F, 5.001082271e-02F, -1.135553569e-01F, 8.300677873e-03F, -2.133353204e-01F,
+    1.273249030e+00F, 4.525932968e-01F, 1.594626665e+00F, 4.792265296e-01F, 8.543673754e-01F, -1.390971661e+00F, -1.841558933e+00F, 2.928371727e-01F,
+    -1.294239640e+00F, 2.603951931e+00F, 2.760605812e-01F, 1.555722713e+00F, -9.098412991e-01F, -1.743316889e+00F, -1.328963280e+00F, 9.457495064e-02F,
+    -7.510615140e-02F, -3.384020552e-02F, -2.114593750e-03F, 4.866989329e-03F, 2.762845531e-02F, 2.025750233e-03F, -2.774118781e-01F, -8.846925944e-02F,
+    -4.390434921e-01F, 6.327493489e-02F, 1.302236617e-01F, -2.845740020e-01F, -6.342365593e-02F, 6.590752304e-02F, -6.396314502e-02F, -1.731920391e-01F,
+    1.301535010e+00F, 4.469627738e-01F, 1.825264573e+00F, 4.855937362e-01F, 8.027654290e-01F, -1.544481635e+00F, -2.127646685e+00F, 3.005622327e-01F,
+    -1.078170657e+00F, 3.120071411e+00F, 2.417521179e-01F, 1.964812040e+00F, -1.046889186e+00F, -1.530942798e+00F, -1.121200323e+00F, 2.210465819e-02F,
+    -3.412909210e-01F, 2.940051444e-02F, 1.545623392e-01F, -1.173401475e-01F, -7.030230016e-03F, -1.650482267e-01F, 9.218576550e-02F, -7.841820270e-02F,
+    -3.705389798e-01F, -4.310939088e-02F, 1.856563836e-01F, -3.022658229e-01F, -6.535243243e-02F, -2.383003384e-01F, -1.152982861e-01F, 1.323357522e-01F,
+    -4.279829264e-01F, 8.409291506e-02F, -2.263228148e-01F, -3.134272620e-02F, -4.398261197e-03F, -3.484337777e-02F, -2.865155041e-01F, -4.176918883e-03F,
+    2.172137201e-01F, -2.166979015e-02F, 3.821679950e-02F, -2.598858178e-01F, 2.521060407e-02F, 7.514148951e-01F, -1.437212825e-01F, 6.100293249e-02F,
+    1.197882071e-01F, -4.773294628e-01F, 3.230139613e-01F, -1.176137209e+00F, -4.475907981e-02F, 1.321822703e-01F, 1.460947514e+00F, -4.444449842e-01F,
+    -2.134195864e-01F, -4.543804824e-01F, 8.801432252e-01F, 4.543941915e-01F, -1.332055926e-01F, 1.978594810e-01F, -9.899927974e-01F, 5.694099143e-02F,
+    -3.413303792e-01F, -3.412745893e-02F, 1.098755717e+00F, -1.064354062e+00F, -8.832670748e-02F, -6.447882056e-01F, 1.091030836e+00F, -4.705012590e-02F,
+    3.987441957e-01F, 3.009828925e-01F, 1.255714536e+00F, 5.936215520e-01F, 1.099499390e-01F, 8.489034176e-01F, -1.535907507e+00F, 2.266207635e-01F,
+    1.067430615e+00F, -6.652025580e-01F, -7.653971761e-02F, -7.707453370e-01F, -9.975265712e-02F, -5.951825380e-01F, -1.684166193e-01F, -5.779971480e-01F,
+    -4.636795521e-01F, -7.465720177e-01F, -4.552404583e-01F, 3.365676850e-02F, -1.180283204e-01F, -1.283538580e+00F, 3.461542130e-01F, 5.436744168e-02F,
+    5.305421948e-01F, 1.535586715e-01F, -5.304009914e-01F, 1.699853301e+00F, -1.074820384e-01F, 4.237713814e-01F, 4.564904422e-02F, 2.260403931e-01F,
+    -1.423317075e+00F, 8.701215982e-01F, 1.991591454e-01F, -7.676244527e-02F, -2.326488495e-02F, -8.272625804e-01F, -7.752861381e-01F, 3.534238636e-01F,
+    -9.974371195e-01F, -1.694411755e+00F, 6.980153322e-01F, -5.820317268e-01F, -2.246746793e-02F, 5.076222867e-02F, 1.744868159e+00F, 1.009111285e+00F,
+    -2.055336237e-01F, 1.149578333e+00F, 3.184811175e-01F, 6.507373452e-01F, 4.144635051e-02F, 3.920701444e-01F, -1.271325350e+00F, 1.542750001e-02F,
+    5.268955231e-01F, 1.524048448e-01F, -1.589916468e+00F, -3.771666586e-01F, -1.182039604e-01F, 5.192292333e-01F, 2.025863826e-01F, 1.189001799e-01F,
+    5.664561987e-01F, -5.291238055e-02F, 3.643415868e-01F, 8.187211156e-01F, 5.522549152e-02F, -1.203459382e+00F, 8.865362406e-01F, 1.528790951e+00F,
+    -1.389418125e+00F, -8.868770003e-01F, 6.241231561e-01F, 4.150299132e-01F, -1.577176750e-01F, 6.626206040e-01F, -1.227624893e+00F, 2.080009699e+00F,
+    -1.386188269e+00F, 1.476538628e-01F, -8.167108893e-01F, 3.834520280e-01F, -3.186229989e-02F, -3.472505510e-02F, 6.690535545e-01F, -7.975865602e-01F,
+    2.202038839e-02F, 2.797335573e-02F, -8.196263313e-01F, -5.398874879e-01F, -2.070486695e-01F, -3.333399892e-01F, -9.327458143e-01F, 2.481069565e-01F,
+    -3.067904413e-01F, 7.145294547e-02F, 5.611537099e-01F, -4.062747061e-01F, -8.193774521e-02F, 5.559782386e-01F, -2.546609938e-01F, -1.984659582e-01F,
+    -1.098702550e+00F, 9.448389411e-01F, -1.663005352e-01F, -6.289067864e-01F, -3.634578735e-02F, 2.015475750e+00F, 2.941176891e-01F, -4.955824912e-01F,
+    4.591124952e-01F, -1.280035675e-01F, 3.450423181e-01F, -1.464146972e+00F, -8.449288458e-02F, -8.840883523e-02F, 1.401959658e+00F, -7.020612061e-02F,
+    1.566443563e+00F, -4.928053617e-01F, 7.483443022e-01F, 8.059397936e-01F, -8.037099242e-02F, 7.453153133e-01F, 9.137727320e-02F, 5.764661431e-01F,
+    3.968240321e-01F, -5.898677707e-01F, 5.929476768e-02F, 1.668445110e+00F, -5.849376321e-02F, 3.457802236e-01F, 2.739329338e-01F, -1.046413898e+00F,
+    -6.527418494e-01F, 5.491222739e-01F, 1.341723561e+00F, 1.668491811e-01F, -2.257930674e-02F, 1.067930102e+00F, 1.689811945e-01F, 5.894863605e-01F,
+    -4.476264492e-02F, 6.476740837e-01F, -1.046144485e+00F, 1.270828962e+00F, 6.294811517e-02F, -3.902466297e-01F, 2.791795433e-01F, 3.567804396e-01F,
+    6.853317618e-01F, -8.568755984e-01F, -9.975095838e-02F, -1.741771102e-01F, 1.962269098e-02F, 3.979363143e-01F, 3.707539663e-02F, -1.662015468e-01F,
+    1.027009368e+00F, 1.196208894e-01F, -6.957313418e-02F, -2.589913644e-02F, 1.480509639e-01F, -2.450719103e-02F, -2.728649676e-01F, 3.466821611e-01F,
+    1.077153385e-01F, 4.244747460e-01F, 6.073361263e-03F, 2.780696936e-02F, 9.190216660e-03F, 3.386654258e-01F, -4.839802906e-02F, 4.643235505e-01F,
+    4.032494500e-02F, -2.109523565e-01F, 1.219845653e+00F, -3.965748847e-01F, 1.719078273e-01F, -1.259681135e-01F, 2.885635197e-01F, -2.127966434e-01F,
+    5.994478613e-02F, 5.359850451e-02F, 3.134929016e-02F, 1.857167035e-01F, -1.666844338e-01F, -5.897796154e-02F, -4.886647314e-02F, 5.723193288e-01F,
+    1.501871794e-01F, -4.004465416e-02F, -1.161933243e-01F, 6.103125587e-02F, -1.613751054e-02F, -2.691695094e-01F, -1.050211564e-01F, -1.353662461e-01F,
+    3.230711818e-01F, 5.922566354e-02F, 4.532179981e-02F, -3.104696423e-02F, -1.501034051e-01F, -9.879714251e-02F, 8.915148675e-02F, 6.691008210e-01F,
+    -3.802189529e-01F, 1.027317196e-01F, -5.175314546e-01F, -4.357358441e-02F, -6.592205167e-02F, -1.400081906e-02F, -1.384273916e-01F, 4.313661456e-01F,
+    -1.257237047e-02F, -3.138769418e-02F, -1.373188477e-02F, 1.369227748e-02F, -1.285204887e-01F, 5.907811224e-02F, -1.964424923e-02F, -7.698186487e-02F,
+    2.639922127e-02F, 5.500374734e-02F, 3.954657316e-01F, -5.676162243e-02F, -8.444454521e-02F, 8.561299741e-02F, 5.034139007e-02F, 1.486456096e-01F,
+    -2.707860991e-02F, -2.202719823e-02F, -1.543535385e-02F, -6.894081831e-02F, -1.007724926e-01F, 8.133675158e-02F, 2.800460532e-02F, 1.993797719e-02F,
+    -4.538088664e-02F, 3.380456939e-02F, -2.468757480e-01F, 5.831308290e-02F, 2.843651175e-02F, -8.343631774e-02F, -1.103573143e-01F, -3.062926047e-02F,
+    1.967813447e-02F, -4.260054976e-02F, -4.770608619e-02F, -6.140110549e-03F, -1.090733781e-01F, 4.033349827e-02F, -1.881223172e-02F, 2.033527941e-02F,
+    -2.140716463e-02F, -8.221521974e-02F, 7.659116387e-02F, 1.689597219e-02F, -2.683104388e-02F, -4.305930436e-02F, -2.521511400e-03F, -2.968003601e-02F,
+    3.609346151e-01F, 2.762127519e-01F, 1.850858331e-01F, -2.444419265e-01F, 1.083743274e-01F, 3.360993266e-01F, 1.186058372e-01F, 3.474637121e-02F,
+    -2.816325128e-01F, 4.081608653e-01F, -1.336755753e-01F, -2.224595994e-01F, -1.367723346e-01F, -6.904610991e-02F, -1.144537106e-01F, -2.645828426e-01F,
+    -5.147889256e-01F, -1.687162161e+00F, 5.284278989e-01F, -4.271551967e-01F, 1.203774288e-01F, -4.955278337e-01F, 2.326219082e-01F, 4.766059518e-01F,
+    -6.827939749e-01F, -5.372785330e-01F, 4.710596204e-01F, 2.551296353e-01F, 5.715612322e-02F, 8.913126588e-02F, 3.370063007e-01F, 1.849591732e-01F,
+    1.664951891e-01F, 1.418758631e-01F, 2.762755752e-02F, 4.365376532e-01F, 2.130735964e-01F, -6.892465055e-03F, 1.842386723e-01F, 3.054560721e-01F,
+    -2.053612322e-01F, -1.989036500e-01F, 3.789696097e-01F, 4.131089747e-01F, -1.530709416e-01F, -1.239752173e-01F, 2.261777222e-01F, 2.652767599e-01F,
+    9.637493491e-01F, 2.062130928e+00F, -7.620018125e-01F, 1.072784781e+00F, 1.468977183e-01F, 3.028676212e-01F, -2.761159837e-01F, -8.426442742e-01F,
+    8.815339804e-01F, 4.119924009e-01F, -6.948795319e-01F, -2.169995755e-01F, -5.466526747e-02F, -2.780410945e-01F, -7.825846672e-01F, -2.407393754e-01F,
+    1.178902090e-01F, 1.431152318e-02F, -4.443346858e-01F, -1.638523191e-01F, -1.857376695e-01F, -1.987256855e-02F, -2.427317500e-01F, 1.036373246e-02F,
+    1.716860682e-01F, -3.162354976e-02F, -1.865304410e-01F, -4.469030201e-01F, -2.027468979e-01F, 3.611179069e-02F, -2.429915071e-01F, -3.685830534e-01F,
+    9.498592615e-01F, 2.986654758e+00F, -8.789876103e-01F, 1.547243237e+00F, 1.748661399e-01F, 8.880757093e-01F, -4.336069822e-01F, -1.302905321e+00F,
+    9.201014042e-01F, 7.290655375e-01F, -9.675731063e-01F, -1.907027960e-01F, 1.697535962e-01F, -1.022670940e-01F, -8.836776018e-01F, -4.861640334e-01F,
+    -1.811016649e-01F, 1.132783592e-01F, -1.655713320e-01F, -2.331562042e-01F, -2.698170245e-01F, -4.849381745e-03F, -1.964760721e-01F, -3.387900293e-01F,
+    -4.347026348e-02F, -2.040925920e-01F, -4.571633413e-02F, -4.372516572e-01F, -2.058220506e-01F, -8.797787875e-02F, 1.637587883e-02F, -8.586880565e-02F,
+    1.493762612e+00F, 3.772111654e+00F, -1.113829374e+00F, 1.683399439e+00F, -1.333340704e-01F, 7.248607874e-01F, -3.893137574e-01F, -1.793352604e+00F,
+    1.155608773e+00F, 8.195316792e-01F, -8.401206136e-01F, -7.015049458e-01F, 4.364504013e-03F, -5.428115129e-01F, -1.018725276e+00F, -3.930796087e-01F,
+    -6.913460791e-02F, 1.159302890e-01F, -1.628027260e-01F, -4.235378802e-01F, 1.082411781e-01F, -2.539606690e-01F, 8.158557117e-02F, -2.338459045e-01F,
+    -1.763231307e-01F, -7.203429937e-02F, -4.617658630e-02F, -2.216674984e-01F, -2.449914813e-01F, -5.400798470e-02F, 1.304944456e-01F, -3.522067368e-01F,
+    1.591060996e+00F, 3.997063160e+00F, -1.197169781e+00F, 1.950412273e+00F, -1.423315555e-01F, 1.145601749e+00F, -2.452825606e-01F, -2.500515938e+00F,
+    1.471000314e+00F, 1.121457815e+00F, -1.238632917e+00F, -5.934774280e-01F, 1.007032767e-01F, -5.352824330e-01F, -1.052704096e+00F, -5.748862624e-01F,
+    -3.831500560e-02F, 1.419673264e-01F, -3.539366126e-01F, -4.441616237e-01F, 7.062919438e-02F, -2.472084016e-01F, 4.624686390e-02F, -1.132385898e-02F,
+    1.291559339e-01F, -3.879038244e-02F, -2.472481728e-01F, -2.514151037e-01F, -1.953720599e-01F, -2.464026511e-01F, 5.284903944e-02F, -2.969701402e-02F,
+    1.716499686e+00F, 4.265414238e+00F, -1.430052757e+00F, 2.175986528e+00F, 5.570909008e-02F, 1.178182483e+00F, -3.469752669e-01F, -2.617393970e+00F,
+    1.762696385e+00F, 7.846127152e-01F, -1.057522058e+00F, -5.302301645e-01F, -4.666583613e-02F, -4.557583630e-01F, -1.262331009e+00F, -8.484796286e-01F,
+    -2.051490694e-01F, 1.576042473e-01F, -4.479142427e-01F, -3.894754350e-01F, -1.197451651e-01F, -6.784859113e-03F, 1.739350520e-02F, -2.739633620e-01F,
+    1.386132985e-01F, 1.827540398e-01F, -2.454083711e-01F, -4.450737536e-01F, -2.343932390e-01F, -7.700625807e-02F, 5.664861295e-03F, -8.749012649e-02F,
+    -1.003142118e+00F, 2.952089906e-01F, 4.564191103e-01F, 3.817855120e-01F, -5.356219038e-02F, 1.559666991e-01F, -4.204221070e-01F, 1.569462754e-02F,
+    1.315452307e-01F, 2.406482548e-01F, -5.823779851e-02F, 4.920250475e-01F, -1.329594851e-01F, -1.324429959e-01F, 1.918198764e-01F, -6.302480698e-01F,
+    6.310148835e-01F, -1.680784076e-01F, -1.068986803e-01F, 2.505108416e-01F, 1.557072103e-01F, 5.281046033e-01F, 5.932132602e-01F, -3.890262544e-01F,
+    -6.827851534e-01F, 6.455096006e-01F, -6.733149886e-01F, -1.177431550e-02F, 4.865580499e-01F, 3.610214917e-03F, 4.062758684e-01F, 1.999507397e-01F,
+    -3.861399293e-01F, -1.548762470e-01F, 2.137005627e-01F, 6.624346972e-01F, 4.431529939e-01F, 3.806206286e-01F, 6.695650816e-01F, -5.095830560e-01F,
+    -1.018754721e+00F, 1.119686007e+00F, -4.283371866e-01F, 6.246446073e-02F, -5.028654337e-01F, 4.311837256e-01F, -9.241374135e-01F, 1.610151082e-01F,
+    1.465391278e+00F, -9.064736366e-01F, -1.297004461e+00F, -9.530852437e-01F, -7.795493603e-01F, 8.393454552e-02F, 1.123850703e+00F, 1.291236877e-01F,
+    -6.758453250e-01F, -1.296584249e+00F, 5.966761708e-02F, -1.980747461e+00F, 2.315084487e-01F, 4.236813486e-01F, -7.580223680e-02F, 8.680848479e-01F,
+    3.454113305e-01F, -7.167567015e-01F, -8.087071031e-02F, -3.611211479e-01F, 8.162147999e-01F, 1.017428160e+00F, -4.335180670e-02F, 2.658902705e-01F,
+    4.335180521e-01F, -7.601402998e-01F, -1.069303036e+00F, 6.342535466e-02F, 8.936149478e-01F, 1.513011694e+00F, 8.030678630e-01F, 1.442168117e+00F,
+    1.509658337e+00F, 1.186803699e+00F, 7.860279083e-01F, 3.953307867e-01F, -3.830238581e-01F, -3.514282703e-01F, 3.135129213e-01F, -2.647318840e-01F,
+    4.934898913e-01F, 3.285341263e-01F, 8.950196505e-01F, 7.623980045e-01F, -1.208477020e-01F, -2.860033214e-01F, -1.164183140e+00F, -1.362553686e-01F,
+    6.405898929e-01F, -9.940334558e-01F, -6.966109276e-01F, 2.358837575e-01F, 3.112989664e-01F, -3.377475142e-01F, -1.433169127e+00F, -1.620068997e-01F,
+    1.055394530e+00F, -4.425267130e-02F, -1.558885574e-01F, 5.131629109e-01F, 5.574417710e-01F, -1.217962980e+00F, 6.951521337e-02F, 2.491666228e-01F,
+    1.181916669e-01F, 2.198827982e+00F, 1.494580973e-02F, -1.820035219e+00F, 4.438248277e-01F, 1.229965925e+00F, 3.022841215e-01F, 3.313676417e-01F,
+    3.905405402e-01F, 1.690514684e-01F, 4.858445525e-01F, -2.333389819e-01F, 1.433885098e+00F, -9.682558179e-01F, -2.390235662e-02F, 1.169790983e+00F,
+    -5.558072329e-01F, 1.309924364e+00F, -4.476441145e-01F, -5.684348345e-01F, 1.413777590e+00F, 2.780492045e-02F, -7.265886068e-01F, 1.248426795e+00F,
+    3.272660077e-01F, 1.790415496e-01F, 1.186193228e+00F, 7.253116965e-01F, 1.750180602e+00F, -4.822314978e-01F, 4.522283673e-01F, -7.054865956e-01F,
+    8.961892128e-01F, -9.274657965e-01F, -1.805784106e-01F, 1.317386329e-01F, -1.742085069e-01F, -4.260575473e-01F, 4.031699002e-01F, -2.521044314e-01F,
+    -4.704995155e-01F, 2.148129791e-01F, -8.530750871e-01F, 4.271976650e-01F, -4.527308047e-01F, -5.704392195e-01F, 6.886211038e-01F, 6.939635277e-01F,
+    -5.006402135e-01F, 4.777329564e-01F, 7.058899999e-01F, 5.546863675e-01F, 2.695123553e-01F, 8.277707696e-01F, -4.882796705e-01F, 3.172261715e-01F,
+    -3.275752366e-01F, 5.248276591e-01F, 4.730409980e-01F, 5.742207766e-01F, -1.827074528e+00F, -5.865116119e-01F, -3.826107681e-01F, -1.808697820e+00F,
+    4.822218791e-02F, 6.137569547e-01F, 5.083221197e-01F, -3.919908404e-01F, -4.235364199e-01F, 1.158847690e+00F, -6.215456724e-01F, 2.955218256e-01F,
+    2.839711308e-01F, 9.309110045e-02F, -1.967774034e-01F, -3.814288974e-01F, 3.158055544e-01F, 8.359815478e-01F, -2.993024290e-01F, -3.459475636e-01F,
+    6.577655077e-01F, -4.005608857e-01F, -3.007808700e-02F, -2.400545627e-01F, -3.449858427e-01F, 2.421064526e-01F, -1.103014424e-01F, -8.339773864e-02F,
+    3.544069529e-01F, 1.828458458e-01F, 2.311917692e-01F, 2.095400393e-01F, 4.750424325e-01F, 9.633040428e-01F, -1.691572219e-01F, 8.129596114e-01F,
+    -2.897710800e-01F, -5.006617308e-01F, -2.481361628e-01F, 1.465260983e-01F, 5.300809741e-01F, 1.068349034e-01F, -5.263580084e-01F, 1.368509382e-01F,
+    -7.302267011e-03F, -8.211517334e-02F, -3.541828319e-02F, -3.651500121e-02F, 3.601197600e-01F, 3.066559136e-01F, -2.212876976e-01F, -4.886015356e-01F,
+    8.222255111e-02F, -3.532327116e-01F, -1.856433973e-02F, 1.259811968e-01F, -3.365493193e-02F, 1.310777850e-02F, 1.466502100e-01F, -1.081788093e-01F,
+    -4.240055978e-01F, 2.272951156e-01F, 3.278045654e-01F, -8.182246238e-02F, 1.122766733e-01F, -2.853141129e-01F, -1.935162842e-01F, -3.360222876e-01F,
+    -7.734867185e-02F, -1.874944270e-01F, 4.087762535e-02F, 3.507219627e-02F, -2.643382736e-02F, -1.035202071e-01F, 1.274095625e-01F, -1.572359949e-01F,
+    -4.059177041e-01F, -2.446985841e-01F, -1.483379751e-01F, -2.715058252e-02F, -1.099262238e-01F, 5.685243383e-02F, -9.673231281e-03F, -3.234792054e-01F,
+    7.990974002e-03F, 8.911099285e-03F, -8.147560991e-03F, 9.105607122e-02F, 1.028642431e-02F, -9.070849977e-03F, -1.038619876e-01F, 1.273196470e-02F,
+    -1.267842352e-01F, -1.096893325e-01F, 1.260213852e-01F, -1.193217039e-01F, 7.579573989e-02F, -2.328454405e-01F, -8.975960314e-02F, 3.389357403e-02F,
+    3.142524883e-02F, 3.609059006e-02F, 5.000891909e-02F, 2.867383137e-02F, 1.903239079e-02F, -9.805089794e-03F, -2.424674667e-02F, -6.605508924e-02F,
+    2.239856310e-02F, -7.921329141e-02F, 1.553697586e-01F, -7.977118343e-02F, -1.725854874e-01F, -6.310463697e-02F, -2.058333158e-02F, 8.703968488e-03F,
+    -4.520007968e-02F, -2.827139944e-02F, 1.811906882e-02F, -1.214525476e-02F, -5.654020607e-02F, 6.280830130e-03F, 1.418752968e-02F, 1.667533629e-02F,
+    -1.168941334e-02F, 3.357243724e-03F, -3.349948674e-02F, -1.036994625e-02F, 3.630437702e-02F, 1.215363294e-02F, 7.439781912e-03F, -2.231393196e-02F,
+    -2.260842621e-01F, -9.205898643e-02F, -4.994632676e-02F, 2.190024853e-01F, 8.654335141e-02F, 1.311125010e-01F, 1.432706695e-02F, -8.363749832e-02F,
+    -7.005187273e-01F, 1.974815428e-01F, 4.637814164e-01F, -2.152597159e-01F, 9.570727497e-02F, 6.300426275e-02F, -3.363772035e-01F, -6.466501951e-02F,
+    1.374599189e-01F, 1.051685438e-01F, -1.529030085e+00F, -4.606721997e-01F, -7.066143304e-02F, 3.076888025e-01F, 1.504531801e-01F, -1.036293864e+00F,
+    -4.202540219e-01F, -1.875934154e-01F, -3.681987822e-01F, 1.081114560e-01F, 2.010087371e-01F, 6.712816954e-01F, 7.869306803e-01F, 1.716699637e-02F,
+    7.840779424e-02F, 7.502967864e-02F, 9.108973294e-02F, 1.354432702e-01F, -3.253094107e-02F, -9.441868961e-02F, -2.553474903e-01F, 2.379490435e-01F,
+    -3.015423380e-02F, 3.415652514e-01F, -1.243108213e-01F, -1.357087195e-01F, 1.205087677e-01F, 2.436491251e-01F, -1.638333946e-01F, -2.148297057e-02F,
+    -1.331578940e-01F, -1.264364421e-01F, 2.016519308e+00F, 5.572636127e-01F, 3.695782721e-01F, -8.322470784e-01F, 1.495098621e-01F, 1.333248973e+00F,
+    2.641764283e-01F, 3.609326184e-01F, 8.296553493e-01F, -2.324468046e-01F, -2.431497574e-01F, -1.295167565e+00F, -1.342716336e+00F, -5.158716068e-02F,
+    -1.021630913e-01F, -2.657411695e-01F, -1.716314256e-01F, -1.472637355e-01F, -2.490950078e-01F, -6.389373541e-02F, -2.069291100e-02F, -3.866292536e-02F,
+    -4.750517383e-02F, -3.308862448e-01F, -1.079744026e-01F, -7.997851074e-02F, -1.841689274e-02F, -2.478793710e-01F, 2.038434893e-01F, -1.595934927e-01F,
+    3.230078146e-02F, -3.982470036e-01F, 3.056228876e+00F, 6.531217694e-01F, 5.454697609e-01F, -8.067739010e-01F, -2.297099531e-01F, 1.793626904e+00F,
+    6.483162642e-01F, 8.869354725e-01F, 7.785190344e-01F, -2.663759589e-01F, -3.707806766e-01F, -1.832954526e+00F, -1.879104137e+00F, -1.920074522e-01F,
+    -3.952490166e-02F, -2.624343038e-01F, -1.421722770e-01F, -1.521140635e-01F, -1.979139447e-01F, -3.015411198e-01F, -1.592864841e-01F, -6.470717024e-03F,
+    -1.836272925e-01F, -8.098689467e-02F, 2.037881017e-01F, 1.698950529e-01F, -8.087657392e-02F, 4.239977896e-02F, 2.406262010e-01F, 1.455581188e-01F,
+    -2.997523732e-02F, -6.509052515e-01F, 3.453976154e+00F, 1.074903250e+00F, 8.960812092e-01F, -1.150205374e+00F, 1.949268952e-02F, 2.490494728e+00F,
+    7.877888083e-01F, 1.148177743e+00F, 1.036849856e+00F, -5.118124932e-02F, -4.363323450e-01F, -2.111646414e+00F, -2.512273073e+00F, -1.557381898e-01F,
+    1.538793296e-01F, -3.189297915e-01F, -8.323305100e-02F, 1.792789102e-01F, -2.395653129e-01F, 8.729049563e-02F, -2.977806889e-02F, 1.148565859e-01F,
+    1.901225895e-01F, 4.976658151e-03F, 1.708112657e-01F, -7.993334532e-02F, -2.570577860e-01F, -2.205537707e-01F, 9.185422957e-02F, 4.392564297e-02F,
+    -2.552023530e-02F, -8.270747662e-01F, 4.018032551e+00F, 9.738667011e-01F, 1.087910175e+00F, -1.442408562e+00F, 1.626674235e-01F, 2.821230650e+00F,
+    9.258648157e-01F, 1.499422312e+00F, 1.215865493e+00F, -1.107714996e-01F, -5.271546245e-01F, -2.278234482e+00F, -2.638609171e+00F, 1.705775708e-01F,
+    8.124016225e-02F, -3.126621842e-01F, 1.709696352e-01F, 7.932344079e-02F, -3.514272571e-01F, -2.661338151e-01F, 2.595082670e-02F, -2.169439495e-01F,
+    1.223012581e-01F, -2.565881908e-01F, -3.392729536e-02F, -1.747781038e-01F, -3.293134570e-01F, -2.767278850e-01F, -1.060477197e-01F, -2.501443028e-01F,
+    -1.950841844e-01F, -9.759154320e-01F, 4.368957043e+00F, 1.315563083e+00F, 1.157146335e+00F, -1.614524364e+00F, -2.101948261e-01F, 2.879235268e+00F,
+    1.062498689e+00F, 1.387410879e+00F, 1.448174953e+00F, -1.893719435e-01F, -7.019131780e-01F, -2.555706978e+00F, -3.029403687e+00F, 1.164126843e-01F,
+    3.143023327e-02F, -6.251374632e-02F, 1.664700508e-01F, -2.081885338e-01F, -3.233423233e-01F, -1.497591287e-01F, 1.009519696e-01F, 1.148540229e-01F,
+    -3.111358359e-02F, -3.104727268e-01F, 2.035749890e-02F, -1.317097247e-01F, -1.292943358e-01F, -9.227809310e-02F, 1.956470460e-01F, -2.252669036e-01F,
+};
+
+alignas(64) static float const ntm_aot_layer_0_biases[64] = {
+    -1.321429461e-01F, -8.038401604e-02F, 1.686254144e-02F, -4.999455065e-02F, -2.495603450e-02F, -5.814290792e-02F, -1.468539387e-01F, -4.473657534e-02F,
+    -2.938612103e-01F, -5.518342927e-02F, -9.337852895e-02F, -1.810874604e-02F, -8.770067990e-02F, -1.225585043e-01F, -1.807527989e-01F, -4.395115748e-02F,
+    -4.782483727e-02F, -9.604103118e-02F, -1.030376088e-02F, -1.796698570e-01F, -1.808323860e-01F, -1.471527964e-01F, 5.183500051e-02F, -1.414070129e-01F,
+    -1.791534945e-02F, -2.074081749e-01F, 7.060574740e-02F, -4.658950493e-02F, -5.679259822e-02F, -5.646780506e-02F, 2.343334444e-02F, 5.649531633e-02F,
+    1.241721492e-02F, -1.230938137e-01F, -1.381314397e-01F, -4.507641792e-01F, -5.452861637e-02F, -6.855509430e-02F, -9.957163781e-02F, 6.630558521e-02F,
+    -2.778999805e-01F, -3.084299900e-02F, -2.665246464e-02F, -9.974225610e-02F, -4.755285382e-02F, -3.171829507e-02F, -7.130905986e-02F, -3.541897237e-02F,
+    -9.608526714e-03F, -1.041892543e-02F, -2.406547368e-01F, -2.988888025e-01F, -5.440435559e-02F, -6.288982928e-02F, -7.513535023e-02F, -1.843136102e-01F,
+    -2.636082098e-02F, -1.360583007e-01F, 5.408713128e-03F, -1.541158743e-02F, -1.430073678e-01F, -1.115845218e-01F, 4.731210694e-02F, -3.463451937e-02F,
+};
+
+static inline void ntm_aot_layer_0(float const *in_activations, float *out_activations)
+{
+    // outputs [0, 8)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_0_biases[0]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_0_biases[1]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_0_biases[2]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_0_biases[3]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_0_biases[4]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_0_biases[5]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_0_biases[6]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_0_biases[7]);
+
+        float const *const panel_weights = ntm_aot_layer_0_weights + 0U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 0U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 1U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 2U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 3U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 4U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 5U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 6U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 7U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [8, 16)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_0_biases[8]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_0_biases[9]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_0_biases[10]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_0_biases[11]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_0_biases[12]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_0_biases[13]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_0_biases[14]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_0_biases[15]);
+
+        float const *const panel_weights = ntm_aot_layer_0_weights + 512U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 8U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 9U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 10U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 11U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 12U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 13U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 14U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 15U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [16, 24)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_0_biases[16]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_0_biases[17]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_0_biases[18]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_0_biases[19]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_0_biases[20]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_0_biases[21]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_0_biases[22]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_0_biases[23]);
+
+        float const *const panel_weights = ntm_aot_layer_0_weights + 1024U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 16U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 17U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 18U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 19U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 20U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 21U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 22U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 23U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [24, 32)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_0_biases[24]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_0_biases[25]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_0_biases[26]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_0_biases[27]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_0_biases[28]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_0_biases[29]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_0_biases[30]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_0_biases[31]);
+
+        float const *const panel_weights = ntm_aot_layer_0_weights + 1536U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 24U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 25U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 26U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 27U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 28U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 29U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 30U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 31U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [32, 40)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_0_biases[32]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_0_biases[33]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_0_biases[34]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_0_biases[35]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_0_biases[36]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_0_biases[37]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_0_biases[38]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_0_biases[39]);
+
+        float const *const panel_weights = ntm_aot_layer_0_weights + 2048U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 32U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 33U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 34U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 35U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 36U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 37U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 38U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 39U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [40, 48)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_0_biases[40]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_0_biases[41]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_0_biases[42]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_0_biases[43]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_0_biases[44]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_0_biases[45]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_0_biases[46]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_0_biases[47]);
+
+        float const *const panel_weights = ntm_aot_layer_0_weights + 2560U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 40U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 41U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 42U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 43U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 44U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 45U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 46U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 47U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [48, 56)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_0_biases[48]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_0_biases[49]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_0_biases[50]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_0_biases[51]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_0_biases[52]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_0_biases[53]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_0_biases[54]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_0_biases[55]);
+
+        float const *const panel_weights = ntm_aot_layer_0_weights + 3072U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 48U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 49U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 50U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 51U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 52U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 53U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 54U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 55U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [56, 64)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_0_biases[56]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_0_biases[57]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_0_biases[58]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_0_biases[59]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_0_biases[60]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_0_biases[61]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_0_biases[62]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_0_biases[63]);
+
+        float const *const panel_weights = ntm_aot_layer_0_weights + 3584U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 56U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 57U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 58U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 59U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 60U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 61U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 62U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 63U, ntm_aot_relu(accumulator_7));
+    }
+}
+
+// 64 x 64 (relu)
+alignas(64) static float const ntm_aot_layer_1_weights[4096] = {
+    6.219720840e-01F, -1.377724707e-01F, 7.171471715e-01F, -4.595433176e-02F, -6.827615499e-01F, 6.538479775e-02F, 2.598591447e-01F, -4.439836740e-01F,
+    -2.377301455e-01F, 5.318212137e-02F, 2.670226693e-01F, -1.690534055e-01F, 2.576853633e-01F, -9.613116384e-01F, -6.052923203e-01F, -2.300988913e+00F,
+    -4.524468631e-02F, 3.357365727e-02F, 2.404970974e-01F, 3.061405122e-01F, -9.812238812e-02F, -4.282766581e-01F, -4.881543815e-01F, 1.868206412e-01F,
+    4.046901166e-01F, -1.625466794e-01F, 1.448262483e-01F, -4.695136845e-01F, 2.884572558e-02F, 4.383722246e-01F, 3.206633627e-01F, -1.369130611e+00F,
+    1.185310632e-01F, 8.658318967e-02F, -2.309325784e-01F, -3.879984841e-02F, 5.430424809e-01F, -8.695340157e-02F, -1.371292919e-01F, -6.976948977e-01F,
+    5.285032392e-01F, -1.155364364e-01F, 3.737306595e-01F, -4.522366822e-01F, -3.338197470e-01F, -1.760540996e-03F, -1.191391468e+00F, -4.760272205e-01F,
+    4.175141454e-01F, 1.752481759e-01F, 5.666597486e-01F, 1.712008938e-02F, -7.630695105e-01F, 5.172671080e-01F, 5.129685998e-01F, 1.685676575e-01F,
+    -2.818035781e-01F, -1.332022399e-01F, -2.971732616e-01F, 1.395196915e-01F, 2.821872011e-02F, -4.078942835e-01F, -1.662144214e-01F, -3.914164603e-01F,
+    -4.508899748e-01F, 1.917907894e-01F, -1.334440410e-01F, 9.257519841e-01F, -2.059700727e+00F, -2.382166684e-01F, 1.881250292e-01F, -1.247409821e+00F,
+    5.714041591e-01F, -2.877209485e-01F, -8.608219028e-02F, 4.524328709e-01F, 3.307189941e-01F, -3.260674328e-02F, -9.228182584e-02F, -8.764003515e-01F,
+    7.287151814e-01F, -1.672278643e-01F, 2.994350493e-01F, -4.331052601e-01F, 2.787051909e-02F, -1.066596657e-01F, 3.376441896e-01F, -1.170145068e-02F,
+    -1.099684834e+00F, 1.649673283e-02F, 4.004617333e-01F, 4.319779575e-01F, -8.914902806e-01F, -2.493530065e-01F, 2.441687733e-01F, -3.147586286e-01F,
+    7.640530914e-02F, -1.297309622e-02F, -8.089715242e-01F, -5.066790581e-01F, 3.619576246e-02F, -2.364140302e-01F, 6.330972910e-01F, -5.710113049e-01F,
+    -6.489212066e-02F, 5.458067358e-02F, -1.587654799e-01F, 1.426480561e-01F, -2.381752282e-01F, -9.274832606e-01F, -2.724780440e-01F, 1.755820066e-01F,
+    -2.629606426e-01F, -1.998038590e-01F, -7.760927677e-01F, -1.156926379e-01F, 3.277143538e-01F, -1.672156572e+00F, 5.933986306e-01F, 4.569478929e-01F,
+    2.128792256e-01F, -1.624956429e-01F, 9.878339767e-01F, -2.810861766e-01F, -2.205170393e-01F, 1.733570844e-01F, 2.917097211e-01F, 1.777261496e-01F,
+    4.969024658e-01F, -2.238883972e-01F, -6.185957193e-01F, -9.043942392e-02F, 1.678821295e-01F, 3.782790601e-01F, -3.309982121e-01F, 1.380373985e-01F,
+    -9.354082942e-01F, -9.620653838e-02F, 3.286292255e-01F, 5.395292640e-01F, 6.228391528e-01F, -1.667898178e+00F, -7.570317984e-01F, -6.067666411e-01F,
+    -6.434202194e-02F, 1.253270805e-01F, 5.256013870e-01F, 8.049127460e-02F, -1.316466331e-01F, 7.167088799e-03F, 7.966120243e-01F, -1.120759964e+00F,
+    3.563866019e-01F, 7.544162124e-02F, -1.523526430e+00F, -4.003992081e-01F, -1.295266151e+00F, 3.522654474e-01F, -2.805762887e-01F, -4.445427358e-01F,
+    -8.957439065e-01F, -1.517619938e-01F, -2.987016439e-01F, 1.114997081e-02F, 6.387170404e-02F, 8.850714564e-02F, 3.732137382e-02F, 1.953666061e-01F,
+    3.863102198e-02F, -1.510477345e-02F, 5.379745364e-01F, -8.686578274e-01F, -5.174432397e-01F, -4.535519779e-01F, 4.005454183e-01F, -2.592989206e-01F,
+    1.421293318e-01F, -2.113521993e-01F, 5.407642573e-02F, 4.915215075e-02F, 2.890114486e-01F, -3.721871600e-02F, -2.400970757e-01F, -1.751020551e-01F,
+    3.920868933e-01F, -9.986881912e-02F, -7.847374082e-01F, 2.230592221e-01F, -2.135154605e-01F, -2.008954883e-01F, 5.236631632e-01F, 7.739353776e-01F,
+    -7.159740925e-01F, -6.408918649e-02F, 2.693261504e-01F, -5.881363899e-02F, -9.909223765e-02F, -4.626377523e-01F, -8.362667263e-02F, 3.914826512e-01F,
+    3.253687918e-01F, -2.194898129e-01F, 8.413721919e-01F, 2.300868630e-01F, 8.800724894e-02F, -6.177480817e-01F, 7.254075408e-01F, -1.559728831e-01F,
+    -4.717004001e-01F, -5.858890340e-02F, 5.348313451e-01F, 3.658924401e-01F, 1.823623478e-01F, -1.298524737e+00F, -1.089879200e-01F, 3.107778430e-01F,
+    -1.276054859e+00F, -1.734665930e-01F, 2.749773301e-02F, -2.930908501e-01F, -1.584190875e-02F, -4.685804546e-01F, 6.992297620e-02F, -1.096881106e-01F,
+    -3.374139369e-01F, -9.194308519e-02F, -5.532105640e-02F, 3.112512827e-01F, 5.727596879e-01F, -1.765497565e+00F, -5.112535134e-02F, 2.730609477e-01F,
+    -1.877071522e-02F, -1.409189999e-01F, -2.523264885e-01F, 1.112668812e-01F, -3.853069246e-01F, -3.289607763e-01F, 4.720798433e-01F, 4.299049675e-01F,
+    -6.901301444e-02F, -1.683831587e-02F, -8.637708426e-01F, -8.133186698e-01F, -6.405264139e-02F, 9.385829419e-02F, -1.263287663e-01F, 4.652997851e-01F,
+    -6.167666912e-01F, -2.934730053e-01F, 3.820642233e-01F, 6.528892089e-03F, 2.778443992e-01F, -1.351429522e-01F, -6.116081476e-01F, -6.979926825e-01F,
+    -2.128659189e-01F, -1.872580349e-01F, -3.398525417e-01F, -3.338086009e-01F, -3.023757637e-01F, -3.886040747e-01F, -4.939922690e-02F, -2.198982239e-02F,
+    2.066055834e-01F, -2.794986125e-03F, 3.539937139e-01F, -5.959119797e-01F, -2.949035168e-01F, 3.522609547e-02F, 6.792480350e-01F, 9.752002358e-01F,
+    -2.754928768e-01F, -1.896784157e-01F, -7.150588632e-01F, 2.552134991e-01F, 4.808794558e-01F, 4.109889865e-01F, -8.396447301e-01F, 4.853758812e-01F,
+    -5.915684700e-01F, -7.110576332e-02F, -1.986059666e+00F, -3.438214958e-01F, -1.659617066e+00F, 3.049127758e-02F, -6.258092523e-01F, 1.607633978e-01F,
+    9.974145330e-03F, -1.151104122e-01F, -1.010920167e+00F, -2.432307899e-01F, 4.236939549e-02F, 5.838477015e-01F, -8.321464062e-01F, -4.280219376e-01F,
+    -1.955577880e-01F, 7.806485146e-02F, -4.384210110e-01F, 6.233019233e-01F, -1.569487005e-01F, 3.384059966e-01F, -1.714740396e-01F, -1.523568630e-01F,
+    -1.633296311e-01F, 4.033761472e-02F, -1.826606877e-02F, -1.397419870e-01F, -6.690879911e-02F, 1.002373993e-01F, -1.203433331e-02F, 1.472214982e-02F,
+    3.913858533e-01F, 3.376989439e-02F, -1.959981956e-02F, 1.403854191e-01F, 1.049987003e-01F, 6.044926643e-01F, 2.824291289e-01F, -1.495398283e-01F,
+    -1.605443358e+00F, -2.125501186e-01F, -6.487914324e-01F, 3.416420817e-01F, -1.193120956e+00F, 6.431992650e-01F, -7.668497507e-03F, 8.027534485e-01F,
+    -6.714284420e-01F, -2.547701821e-02F, -1.592104137e-01F, -7.196556926e-01F, 5.975074768e-01F, -7.251352668e-01F, -3.834802508e-01F, 2.482290119e-01F,
+    5.101648569e-01F, -2.281021476e-01F, -6.288275719e-01F, -4.886870086e-01F, -6.745768785e-01F, 1.992546469e-01F, 3.376619518e-01F, 2.059315592e-01F,
+    -2.395173907e-01F, 3.083389439e-02F, 3.469204903e-01F, 6.730126590e-02F, -3.578904271e-01F, 3.384916484e-01F, -3.227626085e-01F, -4.818620533e-02F,
+    -1.974567622e-01F, 5.387179181e-02F, -5.472978950e-01F, -4.986914620e-02F, 1.047793865e+00F, 3.612390161e-01F, -1.079138160e+00F, 1.055365726e-01F,
+    -8.388961107e-02F, -1.189679652e-01F, 2.459809035e-01F, -3.468513489e-01F, -9.223452806e-01F, 1.816155612e-01F, -2.556192577e-01F, -4.346890748e-01F,
+    -9.033443332e-01F, -2.769711018e-01F, -6.267271042e-01F, 3.319317698e-01F, 2.646299601e-01F, -6.823038459e-01F, -2.379157841e-01F, -2.067901790e-01F,
+    -7.730814815e-01F, -2.863349915e-01F, -3.303411901e-01F, 7.053225636e-01F, 3.541731834e-01F, 7.446453571e-01F, 8.266505599e-02F, 3.708846569e-01F,
+    -9.685013294e-01F, -2.791787386e-01F, 5.961214304e-01F, -6.061848402e-01F, -2.069419771e-01F, -6.509452462e-01F, 2.747110426e-01F, -1.114615917e+00F,
+    -4.643813670e-01F, -2.582057193e-02F, -2.834487855e-01F, 5.114918947e-01F, 2.239319086e-01F, 4.903333187e-01F, 3.591013700e-02F, 3.521479964e-01F,
+    7.417057753e-01F, 1.112666428e-01F, -3.901925385e-01F, 5.148956180e-01F, -3.669766709e-02F, -1.057550788e+00F, -1.705196649e-01F, 5.014309883e-01F,
+    -2.488506287e-01F, 1.157765985e-01F, 1.668279618e-01F, -6.772406101e-01F, 1.033681855e-01F, -4.181186557e-01F, 2.004585564e-01F, 1.119328380e+00F,
+    3.594978526e-02F, -1.586466432e-01F, -3.760675713e-02F, 9.413808584e-02F, -5.122632161e-02F, 9.529579431e-02F, -4.387964681e-02F, -3.283705935e-02F,
+    -9.016130120e-02F, 9.104675055e-02F, 9.256187826e-02F, 1.700156331e-01F, -1.003374815e+00F, 2.680950165e-01F, 1.094841242e+00F, -5.372022986e-01F,
+    -3.563558459e-01F, -1.369760185e-01F, -9.598932266e-01F, -1.980255395e-01F, -3.487266302e-01F, -3.226611614e-01F, -4.728437662e-01F, -2.326587915e+00F,
+    2.614467740e-01F, -7.091805339e-02F, 2.023136020e-01F, -2.436975539e-01F, 7.197360992e-01F, 4.735167027e-01F, -7.542683929e-02F, 2.602769732e-01F,
+    7.264373451e-02F, -3.141686320e-01F, -2.573617697e-01F, -3.063317202e-02F, -7.874670029e-01F, -5.434886813e-01F, 4.601331651e-01F, -8.333817869e-02F,
+    1.051440358e+00F, -6.084542722e-02F, 7.905980945e-02F, -2.709163725e-01F, -2.551544905e-01F, 4.279459417e-01F, -9.208183885e-01F, -1.203366295e-01F,
+    1.836967915e-01F, -2.432800233e-01F, -6.914817095e-01F, -1.384595782e-01F, 1.452699155e-01F, 5.487176180e-01F, -1.366618425e-01F, 4.131205082e-01F,
+    1.630570889e-01F, -2.767912149e-01F, 8.900707215e-02F, 3.172304928e-01F, -4.636226296e-01F, -1.529638469e-01F, 5.821479559e-01F, -5.467156321e-02F,
+    -2.625871003e-01F, -1.781410873e-01F, -2.837109566e-01F, 3.203863800e-01F, 2.850763202e-01F, 6.741392612e-01F, -6.368688345e-01F, 1.338795722e-01F,
+    -4.872318823e-03F, -3.192980289e-01F, -2.451769561e-01F, -1.870862991e-01F, 2.370992005e-01F, 1.360978186e-01F, -1.832991838e-01F, -1.611132175e-01F,
+    6.423522234e-01F, -2.926172316e-01F, -9.053436667e-02F, 3.077611029e-01F, 2.193166167e-01F, 1.439667046e-01F, -3.595471382e-01F, -1.034307599e+00F,
+    3.062448502e-01F, 7.999107987e-02F, -8.153721690e-01F, 2.364831567e-01F, -2.566200793e-01F, -4.976039827e-01F, -1.759246737e-01F, -1.154986262e+00F,
+    -1.725570261e-01F, 7.800015807e-01F, 3.553513587e-01F, 1.046303034e+00F, -2.748053789e+00F, -2.261934131e-01F, -6.935927272e-01F, -5.799372215e-03F,
+    -1.300352663e-01F, -6.726691127e-01F, -1.034632474e-01F, 1.312728971e-01F, -1.429639578e+00F, 1.141137332e-01F, -1.253278852e-01F, -7.354042530e-01F,
+    2.350110263e-01F, 4.409396350e-01F, -4.424640164e-02F, 3.651963770e-01F, 7.164026797e-02F, 3.622364700e-01F, 5.180913210e-02F, 2.615978010e-02F,
+    -5.887151957e-01F, 8.297830075e-02F, 8.116170764e-01F, -5.735101178e-02F, -2.791287899e-01F, -2.390043586e-01F, 9.307452440e-01F, -5.735913515e-01F,
+    -3.114797473e-01F, 4.509058222e-02F, 1.439977735e-01F, -1.701109856e-01F, -7.045535836e-03F, 4.513217509e-01F, -6.194311976e-01F, -4.053749442e-01F,
+    -6.469002366e-01F, -3.293887675e-01F, 4.206283987e-01F, -2.548371851e-01F, 4.412563443e-01F, -7.408032417e-01F, -7.229588926e-02F, -6.028841734e-01F,
+    -3.250595033e-01F, 3.508817554e-01F, -7.028408647e-01F, 6.272625327e-01F, -5.920494795e-01F, 4.320834205e-02F, 8.425687253e-02F, 1.024205089e-01F,
+    -4.340281487e-01F, -5.479394197e-01F, 4.888571799e-01F, -7.936509699e-02F, 5.706276279e-03F, 1.383670270e-01F, -5.609511957e-02F, -1.167348623e+00F,
+    5.989885330e-01F, 3.297780454e-01F, -4.872671068e-01F, 8.041758537e-01F, 4.669189453e-01F, 4.584984779e-01F, -8.533759713e-01F, -1.000503777e-03F,
+    4.742101431e-01F, 4.987029135e-01F, 4.182585329e-02F, -1.014991760e+00F, -3.310835063e-01F, 2.849395275e-01F, -4.532396048e-02F, -7.160815597e-01F,
+    1.973828524e-01F, 2.229930460e-01F, -2.589580417e-01F, 1.102545634e-01F, -9.557132721e-01F, -1.447071880e-01F, 7.894845307e-02F, -9.610105157e-01F,
+    -3.976152539e-01F, -1.769836396e-01F, -3.475723416e-02F, 8.267055452e-02F, -1.421096027e-01F, -5.471697450e-01F, -5.215555429e-01F, 3.998264968e-01F,
+    -1.547420740e+00F, 3.846298158e-01F, 3.729530573e-01F, 3.851189017e-01F, -1.760218143e-01F, -1.782462746e-01F, 2.817514241e-01F, -5.258597136e-01F,
+    -6.313158274e-01F, 2.606584430e-01F, 3.804639280e-01F, 9.018232226e-01F, 8.691406250e-01F, 7.796954513e-01F, -2.986398339e-01F, 5.467483997e-01F,
+    5.826220289e-02F, 2.944053113e-01F, 3.203396201e-01F, 1.971007884e-01F, 5.154547095e-01F, -1.601146907e-01F, 9.298139811e-01F, -8.881244659e-01F,
+    5.500978231e-01F, 2.324053831e-02F, 8.395482600e-02F, -2.048700452e-01F, -1.772284955e-01F, 2.480384111e-01F, -1.586171746e+00F, 9.106060266e-01F,
+    -1.908504963e-01F, -3.033423796e-02F, -4.002088010e-01F, -7.115618587e-01F, -1.284307718e+00F, -7.898453474e-01F, 6.149110198e-01F, -1.721309662e+00F,
+    -7.730868459e-01F, -1.199925318e-01F, -7.405526638e-01F, -8.073926568e-01F, -8.937032223e-01F, 2.857634798e-02F, 4.360995442e-02F, 1.336941123e-01F,
+    -4.449285567e-02F, 1.187155098e-01F, 1.274357080e+00F, 4.012212530e-02F, -1.190861225e+00F, 4.465869665e-01F, -2.103149891e+00F, 6.079810858e-02F,
+    5.830246806e-01F, -1.399834394e+00F, 1.628524996e-02F, 7.811100483e-01F, 3.761895001e-01F, -1.647123992e-01F, -8.230893016e-01F, 2.847310305e-01F,
+    2.442111075e-01F, 2.962712646e-01F, 1.767437160e-01F, 4.732836187e-01F, 3.274381906e-02F, -7.736803293e-01F, -6.551533341e-01F, 1.388799250e-01F,
+    -4.077414274e-01F, 8.933248371e-02F, -6.805518270e-01F, -1.319340467e-01F, -2.935917377e-01F, 1.298935860e-01F, -1.130238652e+00F, -3.739405572e-01F,
+    -3.226954937e-01F, -1.372596741e+00F, -4.558316469e-01F, 1.787513196e-01F, -1.039995313e+00F, 6.658756733e-02F, -2.423360795e-01F, 1.501249820e-01F,
+    -9.054611623e-02F, -6.705471873e-01F, -8.677633107e-02F, -3.837966025e-01F, -1.181095839e+00F, 5.056953430e-01F, -1.338346958e+00F, -6.624890566e-01F,
+    -1.110410020e-01F, -2.868587971e-01F, -1.408547759e-01F, 4.554392993e-01F, -8.060877919e-01F, -2.602095902e-01F, -1.113287091e+00F, 3.143594265e-01F,
+    -1.294625849e-01F, 2.186824977e-01F, -3.679364920e-01F, -4.201977253e-01F, 1.963775456e-01F, -7.346984744e-01F, 2.729220688e-01F, 1.513137370e-01F,
+    -9.667620063e-01F, -1.993849128e-02F, -1.546673775e-01F, 2.092433274e-01F, -3.015262447e-02F, 6.294128895e-01F, 2.017316967e-01F, 1.648510993e-01F,
+    4.923541844e-01F, 3.035433590e-01F, -3.500068486e-01F, -1.982784122e-01F, 2.229466438e-01F, -6.393140554e-02F, -4.098306298e-01F, -2.966581285e-01F,
+    -1.819784343e-01F, -7.508784533e-01F, 3.188308179e-01F, 4.053356349e-01F, 7.504884005e-01F, 2.383386530e-02F, 8.287047148e-01F, 2.624269128e-01F,
+    -4.249778390e-01F, -7.882832885e-01F, 2.776232064e-01F, -2.912318408e-01F, -1.326081753e+00F, 2.719744444e-01F, -1.647215605e+00F, -1.281690717e+00F,
+    2.062270194e-01F, 2.278229147e-01F, -2.366738617e-01F, 1.918293387e-01F, -9.221625328e-01F, -2.401317656e-01F, -2.221141942e-02F, -5.442018509e-01F,
+    -1.568032384e+00F, -9.480547309e-01F, -9.275286794e-01F, -3.609130383e-01F, 5.392128825e-01F, -4.051311910e-01F, 2.277669869e-02F, -6.689040661e-01F,
+    3.217593580e-02F, -5.831779838e-01F, -2.006187141e-01F, -3.102375269e-01F, 2.440604270e-01F, -5.917865038e-01F, -8.831552863e-01F, 1.220693886e-01F,
+    -3.038232215e-02F, -7.552433014e-01F, 2.220424712e-01F, 3.964675367e-01F, -1.349360496e-01F, 5.971646309e-01F, 1.128040403e-01F, -2.346583456e-01F,
+    -2.344319969e-01F, 4.165402949e-01F, -7.009120286e-02F, 2.657407522e-01F, 7.662253827e-02F, 2.794430852e-01F, -1.810635775e-01F, 6.828610301e-01F,
+    1.396994740e-01F, 1.158225656e+00F, -3.586674035e-01F, -9.989919662e-01F, -1.947900653e-01F, -2.121714115e+00F, -3.982575238e-01F, 2.736670375e-01F,
+    3.660683930e-01F, 2.341089249e-01F, 2.818776667e-01F, 1.577288657e-01F, -1.160522997e-01F, 6.406562775e-02F, -1.043737054e+00F, -4.869032502e-01F,
+    3.011496067e-01F, -5.847805142e-01F, -5.884741545e-01F, -7.583944798e-01F, 4.671099037e-02F, 2.955544554e-02F, -7.195699811e-01F, 2.327230871e-01F,
+    2.221372724e-01F, -8.146001399e-02F, 1.833331883e-01F, 5.309628695e-02F, 1.163361073e-01F, -1.995423287e-01F, -2.239490449e-01F, 2.787883952e-02F,
+    8.982054144e-02F, 5.186653137e-01F, 6.674410105e-01F, 5.134128034e-02F, -1.946193874e-01F, -2.722220421e-01F, -1.852220893e+00F, -4.114177078e-02F,
+    -2.451096773e-01F, -5.996869877e-04F, -9.487661719e-01F, 1.343268901e-01F, -1.164066672e+00F, -6.348680854e-01F, 3.396895826e-01F, 4.731884301e-01F,
+    1.541436613e-01F, 3.613390923e-01F, 2.951787086e-03F, 1.790444255e-01F, -5.951649547e-01F, -6.208411977e-02F, 6.601472385e-03F, -1.043486834e+00F,
+    -3.752315342e-01F, 9.851938486e-01F, -1.913059801e-01F, 3.455205262e-01F, -1.689579897e-02F, -3.255721927e-01F, 4.386974275e-01F, 2.901635766e-01F,
+    -6.211726069e-01F, 2.174070477e-02F, -5.684554577e-01F, 1.971737146e-01F, 4.296834767e-02F, 4.806281030e-01F, 7.879819870e-01F, 4.762905240e-01F,
+    -2.258798033e-01F, 3.017682135e-01F, 2.972151041e-01F, -1.324554831e-01F, -5.613200068e-01F, 3.802448511e-02F, 4.348720610e-02F, 2.189399116e-02F,
+    -1.450205207e+00F, -1.553284645e+00F, 2.274923325e-01F, -2.057828158e-01F, -1.250252128e-01F, 2.102554291e-01F, -5.064888299e-02F, 1.796633303e-01F,
+    9.303325415e-01F, 3.360138535e-01F, 1.136788353e-01F, -1.448205560e-01F, -2.226866722e+00F, -5.960416198e-01F, -4.784158468e-01F, -6.017494798e-01F,
+    2.140079141e-01F, -3.775819242e-01F, -2.779206634e-01F, -1.567737460e-01F, -6.965547800e-01F, -2.990148365e-01F, 3.759579659e-01F, -5.944576859e-01F,
+    7.319653034e-01F, 2.538658082e-01F, -3.889517188e-01F, -3.234693706e-01F, -1.871734858e-01F, -8.812677264e-01F, 5.363766551e-01F, -1.348375082e+00F,
+    5.529432893e-01F, 5.019937158e-01F, -5.562613606e-01F, -4.884818494e-01F, 3.336371481e-01F, 3.876153231e-01F, 2.632986307e-01F, 2.819137089e-02F,
+    -8.059167303e-03F, 5.730628371e-01F, 5.184603930e-01F, -2.755764127e-01F, 6.967678666e-01F, -2.533702552e-01F, -4.197973907e-01F, 2.368302345e-01F,
+    -5.661123395e-01F, -4.760742784e-01F, -8.693565130e-01F, 3.581136838e-02F, -3.516805172e-01F, -4.868715703e-01F, 4.533149600e-01F, 8.660357594e-01F,
+    -9.389692545e-02F, 1.066679358e-01F, -1.720087379e-01F, -1.826188266e-01F, -1.530309618e-01F, 1.237912178e-01F, 1.223520339e-01F, -1.234524772e-01F,
+    5.716204047e-01F, 1.896648705e-01F, 7.465839386e-02F, -6.467363834e-01F, 9.882288575e-01F, 1.243868470e-01F, -5.359261632e-01F, 5.335960388e-01F,
+    4.252424091e-02F, 1.529009938e-01F, 1.075882912e+00F, -1.953285635e-01F, -1.570650816e+00F, 1.853008121e-01F, -3.454749286e-01F, -7.629920244e-01F,
+    8.398101330e-01F, -7.224181890e-01F, 2.432236075e-01F, -5.221431255e-01F, -3.045157790e-01F, -9.913227558e-01F, -5.420964956e-01F, 8.288550377e-01F,
+    -4.033379257e-01F, -1.664592326e-01F, 1.522125304e-01F, -1.348519683e+00F, 3.479022980e-01F, -1.951826215e-01F, -6.038841009e-01F, -2.922488153e-01F,
+    4.258492887e-01F, 5.772086382e-01F, 7.479277253e-01F, 2.493393272e-01F, 7.219700515e-02F, 3.756287396e-01F, 3.771560490e-01F, 1.089796200e-01F,
+    1.729163677e-01F, -6.224297881e-01F, 8.771571517e-02F, -2.945912182e-01F, -6.952717304e-01F, -2.338579297e-01F, 4.832687676e-01F, 4.994460344e-01F,
+    1.719854921e-01F, -1.413488686e-01F, -4.494108260e-01F, -4.800767899e-01F, 2.172769904e-01F, -7.817865014e-01F, 2.749246955e-01F, -7.297219336e-02F,
+    6.508538723e-01F, 3.906856775e-01F, -1.961928606e-02F, 4.516848624e-01F, 3.817076609e-02F, 6.300493479e-01F, 8.982635140e-01F, -1.312835097e+00F,
+    6.568620205e-01F, -4.225396216e-01F, 3.212554157e-01F, 3.803002536e-01F, -1.068341732e+00F, 3.125948012e-01F, -1.767946243e+00F, 5.905789137e-01F,
+    -1.734910607e+00F, -5.178442597e-01F, 3.695529327e-02F, 5.031937361e-02F, 2.342087626e-01F, -5.622404069e-02F, -3.059735298e-01F, -2.073342949e-01F,
+    2.595559955e-01F, 6.169927716e-01F, -3.971113265e-01F, 3.991610110e-01F, -3.729010820e-01F, 5.011447072e-01F, -2.278890163e-01F, 5.233098567e-02F,
+    5.544742942e-01F, 1.426591128e-01F, -7.145486474e-01F, -6.089946032e-01F, -1.774962693e-01F, -2.567496896e-01F, -1.747032627e-02F, 5.082498863e-02F,
+    -1.559287667e+00F, -1.226948738e+00F, -1.255935931e-04F, 6.084942818e-01F, 2.676157057e-01F, 5.802731961e-02F, -5.048215985e-01F, 5.113627017e-02F,
+    -1.305922627e+00F, -4.223336652e-02F, -4.422526956e-01F, 4.627062976e-01F, 4.990895987e-01F, -1.388194561e-01F, 1.784679294e-02F, -1.670971364e-01F,
+    5.169259310e-01F, -3.969966769e-01F, 7.026379108e-01F, -1.477091294e-02F, -4.046439230e-01F, -5.784898400e-01F, 1.589331478e-01F, -1.756467968e-01F,
+    -1.909754425e-01F, 2.711570263e-01F, -8.357005119e-01F, 1.465253234e-01F, -9.226914048e-01F, 3.744501770e-01F, -5.019646510e-02F, -1.022802014e-02F,
+    -3.015709519e-01F, -1.227866411e+00F, -6.081824899e-01F, -2.077644914e-01F, -2.139751911e-01F, -1.328758001e-01F, -6.711211801e-01F, -5.307459831e-02F,
+    -4.753752053e-01F, 2.166011781e-01F, -2.992757559e+00F, -2.584657669e-01F, -1.243910715e-01F, -1.449522018e+00F, 5.261282325e-01F, -1.032760814e-01F,
+    -4.650129080e-01F, 3.603544533e-01F, -2.397000790e-02F, -6.850084066e-01F, -3.326050639e-01F, 5.731719732e-01F, -3.714273274e-01F, -1.878489703e-01F,
+    -1.852942944e+00F, -6.388750672e-01F, -8.949232101e-02F, -2.792234719e-01F, 2.855193913e-01F, -9.826725125e-01F, -3.099648356e-01F, -2.007976025e-01F,
+    5.947687030e-01F, 5.871543288e-02F, 9.161105752e-02F, 1.517838985e-01F, 5.419850349e-01F, -3.059572279e-01F, 5.484235883e-01F, 2.913943306e-02F,
+    1.186243817e-01F, 5.791764855e-01F, -4.646207690e-01F, 2.420644611e-01F, 2.459400147e-01F, 1.092769727e-01F, -6.552205086e-01F, -2.024964392e-01F,
+    7.371904701e-02F, 1.091019735e-01F, 4.022174478e-01F, 1.132287309e-01F, 2.737166584e-01F, 7.426881045e-02F, -3.870653510e-01F, -1.977148801e-01F,
+    2.069958001e-01F, 7.584786415e-02F, 3.706960380e-01F, -2.114654928e-01F, -3.286993206e-01F, -3.777442276e-01F, 4.576418996e-01F, -1.738461666e-02F,
+    -1.890227675e+00F, -1.021718532e-01F, 1.381743252e-01F, -1.129735261e-01F, -3.115970790e-01F, 2.092313915e-01F, 2.047407925e-01F, -7.316663116e-02F,
+    3.914524615e-02F, -1.832856297e+00F, 8.040065765e-01F, -3.129970431e-01F, 2.374607921e-01F, 3.398424089e-01F, 2.762273848e-01F, 8.713721484e-02F,
+    4.977565706e-01F, -3.881408870e-01F, 7.784000635e-01F, -3.831173778e-01F, -5.265502259e-02F, -3.020992279e-01F, 5.116923451e-01F, -1.186106205e-01F,
+    -1.345082998e+00F, -3.744022846e-01F, -1.120372653e+00F, 4.442743659e-01F, -1.559605747e-01F, -1.977698803e-01F, -6.434177160e-01F, -7.858844101e-02F,
+    4.915064573e-01F, 4.820989072e-01F, -6.939406693e-02F, 2.663292289e-01F, -1.128149927e-01F, -4.683663547e-01F, 3.652347326e-01F, 1.150969714e-01F,
+    -4.406250715e-01F, 2.253266722e-01F, 6.542844176e-01F, -2.288547009e-01F, -4.558124244e-01F, 3.910394609e-01F, -1.337303758e+00F, 2.430682629e-02F,
+    -3.945642337e-02F, -1.393585205e-01F, 1.836006790e-01F, 6.025577784e-01F, 1.518878788e-01F, 2.847553194e-01F, 4.629925266e-02F, 1.359189451e-01F,
+    -1.067777753e+00F, 4.827601314e-01F, -1.086179540e-01F, 1.733133942e-01F, 5.854613185e-01F, -9.350541234e-02F, 1.068435073e+00F, -3.007477522e-02F,
+    -1.863168366e-02F, 3.711299300e-01F, -1.789646223e-02F, 3.159686923e-01F, 4.472308159e-01F, 5.485991836e-01F, 7.204485536e-01F, -1.687509269e-01F,
+    2.767410278e-01F, 4.000679553e-01F, 6.627806425e-01F, 2.346358150e-01F, 4.515155256e-01F, -8.527472615e-01F, -1.834481582e-02F, -1.047039628e-01F,
+    -4.254681766e-01F, -1.106763482e-01F, 4.940020144e-01F, 5.797015429e-01F, -9.486120939e-02F, 7.858554721e-01F, -8.143497705e-01F, -2.007690668e-01F,
+    -1.140392065e+00F, -8.305060863e-02F, 2.549688816e-01F, 1.728764325e-01F, 5.205347538e-01F, 1.307732016e-01F, -4.544720948e-01F, -1.215807199e-01F,
+    -1.652168930e-01F, 1.815684885e-02F, -6.666108966e-01F, 2.168292999e-01F, 8.474366665e-01F, 6.792068481e-03F, -5.680428743e-01F, -2.037989497e-01F,
+    4.384482205e-01F, -3.020817339e-01F, -2.623587251e-01F, -1.115757450e-01F, -3.998542204e-02F, -1.202322960e+00F, 6.728059649e-01F, -1.992699690e-02F,
+    9.046962261e-01F, 3.361600041e-01F, -8.981296420e-02F, -2.367486507e-01F, 3.671548888e-02F, -1.208207682e-01F, -1.362951100e-01F, -1.538744271e-01F,
+    -1.405246705e-01F, -4.661154747e-01F, -7.433522940e-01F, -5.780205131e-01F, 4.126102030e-01F, -2.208013535e-01F, -6.492651999e-03F, -1.175891608e-01F,
+    -4.134553075e-01F, -4.920712113e-02F, 4.812845588e-02F, 3.856019676e-01F, -3.490726650e-01F, 2.303456664e-01F, -7.191231847e-01F, -1.379597038e-01F,
+    -5.036044866e-02F, -2.059010416e-01F, 3.664674237e-02F, 6.842304766e-02F, -6.988222003e-01F, 2.081810497e-02F, 7.611018419e-01F, -4.444726929e-02F,
+    -6.977170706e-02F, -6.488170624e-01F, 1.324621737e-01F, 6.723080873e-01F, -1.083950996e+00F, -2.145506628e-02F, -1.930830181e-01F, -2.344146371e-01F,
+    -1.882483363e-01F, -1.589521766e-01F, -3.091586567e-02F, -5.548503399e-01F, -3.105220199e-01F, -2.850548625e-01F, 8.944279701e-02F, -1.464140564e-01F,
+    -1.404345751e+00F, -1.183863163e+00F, 1.666447669e-01F, -3.216292262e-01F, 5.443434119e-01F, 2.068328261e-01F, 2.669841647e-01F, -1.445890218e-01F,
+    -9.582071304e-01F, 5.809402466e-01F, -3.330019861e-02F, -3.172162175e-01F, -4.790253937e-02F, 3.482260555e-02F, 1.221461773e+00F, -1.014387608e-01F,
+    1.152987406e-01F, 8.448629379e-01F, 6.220141053e-01F, -1.734243512e+00F, -2.728229463e-01F, -8.099845052e-01F, 3.769821525e-01F, -9.280614555e-02F,
+    -1.481137156e+00F, -8.924525380e-01F, 2.104679495e-01F, -4.458056390e-01F, -6.760501862e-01F, 1.024347425e+00F, -1.009961843e+00F, -7.079719752e-02F,
+    -3.163009584e-01F, 1.400754601e-01F, 2.582956553e-01F, 2.485634238e-01F, 6.022948623e-01F, -8.615179360e-02F, -2.574955225e-01F, 8.687415719e-02F,
+    -4.728305340e-02F, -1.034434363e-01F, 1.816429012e-02F, -5.842256173e-02F, 2.092259824e-01F, -5.233171955e-02F, -1.016495749e-01F, -6.615829468e-02F,
+    -5.977094769e-01F, 8.210285008e-02F, 6.494624019e-01F, -1.576296985e-01F, -5.705179274e-02F, -3.700660467e-01F, -1.703781009e+00F, 8.657936752e-02F,
+    1.398096979e-01F, -2.077665925e-01F, -6.935628057e-01F, -1.012057364e-01F, -3.794423938e-01F, -5.255279541e-01F, 6.694731303e-03F, -1.422625482e-01F,
+    1.307408363e-01F, -1.248109698e+00F, -5.501084328e-01F, 3.327929676e-01F, -2.719232142e-01F, -4.082714021e-01F, 5.325134993e-01F, -1.695096046e-01F,
+    -1.742451638e-01F, 2.300304323e-01F, -4.852769077e-01F, -4.260011911e-01F, -3.362663090e-01F, -2.108604908e-01F, -3.262207806e-01F, -5.286457390e-02F,
+    1.257387400e-01F, -1.319500506e-01F, -1.273485422e-01F, 6.611207128e-01F, -3.583608270e-01F, -1.318869442e-01F, -7.177812457e-01F, 3.596929461e-02F,
+    2.325023562e-01F, -3.464111388e-01F, -1.204627007e-01F, 5.673682690e-01F, 4.989470541e-02F, 4.256838858e-01F, -3.720521927e-01F, 6.136399508e-02F,
+    4.124955833e-01F, -8.434208035e-01F, -1.777611524e-01F, -9.436763525e-01F, 2.056633532e-01F, 2.208058834e-01F, 6.743302941e-01F, -8.989041299e-02F,
+    -3.361377418e-01F, 4.243057072e-01F, -6.610996723e-01F, -5.512063857e-03F, -1.867710352e-01F, 7.564058527e-03F, -9.351111650e-01F, 6.012052670e-02F,
+    3.416832089e-01F, -5.810623169e-01F, -4.881130755e-01F, 1.224317700e-01F, 2.385678589e-01F, 3.942335844e-01F, -7.865260839e-01F, -4.046170786e-02F,
+    -6.655094028e-02F, 2.170461267e-01F, -6.828699708e-01F, 2.017276585e-01F, -3.724271432e-02F, 5.280861631e-02F, -4.472215474e-01F, -1.882255226e-01F,
+    3.475790620e-01F, 4.820531905e-01F, 8.116772175e-01F, -4.014056027e-01F, 7.236733437e-01F, 2.632098794e-01F, -8.886458874e-01F, 7.971388102e-02F,
+    -1.113336235e-01F, -4.477668107e-01F, -8.692919016e-01F, -5.072947741e-01F, -3.356606960e-01F, 7.134640813e-01F, -1.074068770e-01F, -1.300707161e-01F,
+    6.024289727e-01F, -1.814744711e+00F, 1.322217226e+00F, 1.762907803e-01F, 7.347127199e-01F, -1.738345325e-01F, -2.662247121e-01F, -1.072088480e-01F,
+    1.100257486e-01F, 8.217131719e-03F, 1.362914033e-02F, 9.773208201e-02F, 3.312534094e-02F, 5.124194920e-02F, -1.107920781e-01F, 1.165374368e-01F,
+    4.575260580e-01F, 2.280799747e-01F, 3.300310075e-01F, -1.145612542e-02F, 2.484392375e-01F, -6.573454142e-01F, -1.090754628e+00F, -3.069591708e-02F,
+    -9.076305032e-01F, 5.283027291e-01F, -4.322894216e-01F, 8.995828032e-02F, -6.531800628e-01F, 4.353263974e-02F, -5.691243336e-03F, -1.809862256e-01F,
+    -1.438550055e-01F, -2.690134048e-01F, -1.565389037e-01F, 3.436832726e-01F, -5.412009954e-01F, -6.426791195e-03F, 4.755608737e-01F, -8.767937124e-02F,
+    7.284782529e-01F, -4.857189953e-01F, -1.645104587e-01F, 4.369087219e-01F, -1.522805393e-01F, 4.810298979e-01F, -3.438644409e-01F, 8.894399554e-02F,
+    6.013571024e-01F, -4.363144636e-01F, 6.025628448e-01F, -3.068273664e-01F, -5.634261370e-01F, -9.097371101e-01F, 3.517938256e-01F, 4.700134695e-02F,
+    -8.489428163e-01F, -1.748379320e-02F, -5.383653641e-01F, -6.447442807e-03F, -1.388908923e-01F, 4.782928154e-02F, -4.304096997e-01F, -2.047271430e-01F,
+    -7.922882438e-01F, 2.672237717e-02F, 8.435544372e-02F, 2.213941701e-02F, -8.363156766e-02F, 9.386211038e-01F, -1.299161017e-01F, -2.907959223e-01F,
+    4.175549150e-01F, 1.819182336e-01F, -5.020974874e-01F, -2.300332673e-02F, 2.551504076e-01F, 5.968266129e-01F, -2.664523125e+00F, 1.096338853e-01F,
+    -3.545557261e-01F, 7.542961091e-02F, -7.281819582e-01F, 1.440423727e-01F, -2.868914604e-02F, -6.419994235e-01F, -5.971913934e-01F, -4.586113617e-03F,
+    3.171610534e-01F, 4.409890771e-01F, -8.399597406e-01F, 3.889737129e-01F, 1.110693738e-01F, 1.804903746e-01F, -1.627958268e-01F, -1.593722254e-01F,
+    -2.735479474e-01F, 6.325371861e-01F, -3.429549932e-01F, -4.769772589e-01F, -1.540623158e-01F, 1.456205845e-01F, -7.706011534e-01F, -1.937374622e-01F,
+    -1.411623955e+00F, 4.833874106e-01F, -9.801249206e-02F, 1.426323205e-01F, 5.709724426e-01F, -7.574601769e-01F, -8.686546087e-01F, -8.725766540e-01F,
+    -7.312930822e-01F, 7.801053524e-01F, -1.543329120e+00F, -8.018021584e-01F, 9.068464041e-01F, 4.846446812e-01F, 5.745891333e-01F, 4.114759862e-01F,
+    -3.370298743e-01F, -2.184022665e-01F, -3.926847279e-01F, -3.055567443e-01F, -5.074133873e-01F, 2.980619967e-01F, 1.542308778e-01F, 1.098994985e-01F,
+    2.705049515e-01F, 5.003903508e-01F, -8.242575526e-01F, -8.766244054e-01F, 6.134585738e-01F, -8.276615292e-02F, 4.305326045e-01F, -2.187318355e-01F,
+    -3.063264489e-01F, -3.573420644e-02F, 4.008908868e-01F, -4.360447526e-01F, 1.199835241e-01F, -1.897874951e+00F, -7.268916368e-01F, 2.901723087e-01F,
+    2.993615866e-01F, -6.106258556e-02F, -2.705171585e+00F, -3.416136205e-01F, -7.169115543e-02F, -2.179679275e-01F, 1.899949759e-01F, 2.472814545e-02F,
+    1.983764321e-01F, -2.316725701e-01F, 8.245548010e-01F, 3.048088551e-01F, -3.888420463e-01F, -4.904105365e-01F, -2.574770451e-01F, -8.510138392e-01F,
+    5.969235301e-01F, 1.056920439e-01F, 3.770884275e-01F, -8.627100587e-01F, 2.639082968e-01F, 1.369374245e-01F, 9.060844779e-01F, 1.380037367e-01F,
+    -4.127038717e-01F, 3.888001144e-01F, 1.580529213e-01F, 8.250528574e-02F, 4.470375180e-01F, -8.304774761e-02F, -1.029208779e+00F, 2.420568168e-01F,
+    6.288022548e-02F, -1.168154359e+00F, -2.585945725e-01F, -3.898339570e-01F, -8.609017134e-01F, -1.523519635e+00F, 4.516333342e-01F, 1.329997927e-01F,
+    8.542228937e-01F, -3.921833262e-02F, 5.076761842e-01F, -3.386458755e-02F, -4.606698453e-02F, 1.887934953e-01F, -8.415578604e-01F, 5.080937594e-02F,
+    2.281076461e-01F, -4.584247246e-03F, 1.798821241e-01F, -5.056672692e-01F, 2.495757639e-01F, -2.834410965e-01F, 6.772617698e-01F, -6.785665751e-01F,
+    -3.956989348e-01F, -3.467929065e-01F, -7.137517631e-02F, 4.514115751e-01F, -3.008383792e-03F, 5.624840856e-01F, -1.399288327e-01F, -9.864199162e-02F,
+    1.730462462e-01F, -5.645280480e-01F, 9.639369249e-01F, -4.451101720e-01F, 1.276039928e-01F, -2.389072813e-02F, -1.588666439e-01F, 6.240862608e-01F,
+    -9.433872104e-01F, 2.230514437e-01F, 6.868954301e-01F, 5.609520674e-01F, 2.287521362e-01F, -4.063870013e-01F, -1.667322218e-01F, -3.167029917e-01F,
+    -3.786272407e-01F, 1.324466765e-01F, 2.103508264e-01F, -3.288712204e-01F, -1.953526497e+00F, -7.618981004e-01F, -1.060053945e+00F, 1.568766683e-01F,
+    -2.233517729e-02F, 1.047760248e-02F, -1.433531642e-01F, 2.785996795e-01F, 4.399147928e-01F, 1.966255903e-01F, -4.931233525e-01F, -6.705499291e-01F,
+    1.955838054e-01F, 3.877750933e-01F, -1.585229278e+00F, -5.879956484e-01F, 5.887793899e-01F, 4.594390392e-01F, 3.137441278e-01F, -6.939827204e-01F,
+    -2.004879951e+00F, -6.550881267e-02F, -2.777379990e+00F, 6.089665890e-01F, -7.122682929e-01F, -3.229829967e-01F, 1.195668243e-02F, 6.951022148e-02F,
+    -1.304583997e-01F, -1.673975736e-01F, -8.229755759e-01F, -3.188279271e-01F, -7.937017083e-02F, -3.285130262e-01F, -1.486813277e-01F, 2.053279877e-01F,
+    8.401346803e-01F, -2.112796307e-01F, -2.871016562e-01F, 5.742630959e-01F, 2.175684087e-03F, 5.881024599e-01F, -5.143350959e-01F, -1.787962675e+00F,
+    4.444860816e-01F, 3.605131805e-01F, -8.395298719e-01F, -9.449602664e-02F, -8.698989451e-02F, 6.304284930e-01F, -1.069553733e+00F, -3.322199285e-01F,
+    3.610906005e-01F, -1.695230007e-01F, 7.919412255e-01F, 4.495395422e-01F, 1.954533607e-01F, -1.230930611e-01F, 3.577822587e-03F, 3.405675590e-01F,
+    6.904822588e-01F, 4.145682156e-01F, 6.411796212e-01F, 5.363954604e-02F, -1.246430397e+00F, 7.190557569e-02F, -6.650166512e-01F, -4.786075950e-01F,
+    -2.043396682e-01F, 8.961107582e-02F, -5.218434930e-01F, -4.731239378e-01F, -7.443806529e-01F, -4.951036870e-01F, -7.321798056e-02F, -4.351856112e-01F,
+    -1.645963937e-01F, -5.892137289e-01F, -1.695617437e+00F, 2.514375746e-01F, -6.585952044e-01F, 2.319446355e-01F, 3.083018064e-01F, 2.990688682e-01F,
+    3.230205774e-01F, -1.618119478e-01F, -4.265802205e-01F, 7.447152138e-01F, -5.469049811e-01F, 4.861760736e-01F, 2.219929919e-02F, 1.062272266e-01F,
+    -1.073534966e+00F, 1.953797340e-01F, -2.310980797e+00F, 3.296605051e-01F, -5.863275528e-01F, -1.240627050e+00F, -8.182193041e-01F, 4.284017384e-01F,
+    7.332399487e-02F, 2.940271199e-01F, -3.718547225e-01F, -3.039712310e-01F, -9.476823807e-01F, -5.086805224e-01F, -8.768976480e-02F, -9.483615309e-02F,
+    1.930823028e-01F, 1.407154799e-01F, 3.623512015e-02F, 3.763896227e-02F, 3.525007069e-01F, -2.106383562e+00F, 1.554423124e-01F, 5.091744065e-01F,
+    -1.034574434e-01F, 8.197944164e-01F, -4.218870997e-01F, 2.707104571e-02F, 1.149291918e-01F, -3.357841671e-01F, 7.388313860e-02F, 8.742307127e-02F,
+    2.362748981e-01F, 4.264176190e-01F, 3.554619849e-01F, -9.104208350e-01F, 7.280584574e-01F, -2.210671604e-01F, 1.718828380e-01F, 4.355137423e-02F,
+    6.244160701e-03F, 2.355005592e-01F, -7.729364038e-01F, -1.313109249e-01F, -5.501294136e-02F, 2.723995447e-01F, -5.222785473e-01F, 6.900637746e-01F,
+    2.191153914e-01F, -5.851686746e-02F, -2.042688616e-02F, -2.182005197e-01F, -3.232236505e-01F, -2.536195219e-01F, -1.119156003e+00F, 6.583771706e-01F,
+    5.247601494e-02F, -7.522579283e-02F, -6.230062619e-02F, -2.333540022e-01F, 3.816122711e-01F, 5.890243649e-01F, 1.004893422e+00F, 3.370547891e-01F,
+    -1.519247293e+00F, -3.050081134e-01F, 1.714598835e-01F, 1.278567076e+00F, -2.001360178e+00F, 8.932208642e-03F, -8.283177018e-01F, -4.102936983e-01F,
+    6.298246980e-01F, -2.154285014e-01F, -9.964693189e-01F, -5.413663387e-01F, -1.998725533e-01F, -1.305606842e+00F, -1.553896964e-01F, 2.865965068e-01F,
+    1.739783585e-01F, 2.804119140e-02F, -1.193313152e-01F, 3.834983706e-01F, -3.117235005e-01F, 2.062765062e-01F, 4.335019886e-01F, 2.978470922e-01F,
+    -1.676621288e-01F, -1.208406463e-01F, -6.744960696e-02F, -9.711201489e-02F, -1.905610710e-01F, -1.935194135e-01F, 9.402804077e-02F, 8.669624478e-02F,
+    -6.623268127e-02F, -2.557491362e-01F, 1.662842035e-01F, 3.461514413e-02F, 4.814574122e-01F, 2.348768525e-02F, 7.911491990e-01F, -2.822231688e-02F,
+    -7.384271026e-01F, -4.261316657e-01F, 9.346768260e-02F, 4.837516695e-02F, 2.241570652e-01F, -4.793198109e-01F, 3.678889275e-01F, -2.600567043e-01F,
+    -7.416275740e-01F, -1.683815122e-01F, 1.636300087e-01F, -3.401218951e-01F, 2.388970703e-01F, -6.695209146e-01F, -7.515467405e-01F, -2.465713918e-01F,
+    -3.736355901e-01F, 1.398526430e-01F, -9.771260619e-01F, 1.991079301e-01F, 2.168983817e-01F, -1.302079082e+00F, 2.214882970e-01F, 1.122371256e-01F,
+    -6.964455843e-01F, -1.877133101e-01F, -1.211977005e+00F, 2.036411315e-01F, -3.493026793e-01F, 6.760234237e-01F, -5.193371773e-01F, 6.226004958e-01F,
+    -5.730778575e-01F, 4.824129045e-01F, -2.849444151e+00F, 4.061460197e-01F, -2.505186498e-01F, -1.749020457e+00F, -7.175653577e-01F, -4.937416613e-01F,
+    4.658924043e-01F, -6.350608468e-01F, -1.475996494e+00F, 1.267031133e-01F, 2.361935377e-01F, -1.113030314e-01F, -3.158695698e-01F, -5.493376851e-01F,
+    -7.417097688e-01F, 4.301087856e-01F, -6.790542006e-01F, 3.638318777e-01F, 4.644585550e-01F, -1.466563493e-01F, -2.580585778e-01F, -1.193147421e+00F,
+    6.981641054e-02F, -2.976549789e-02F, -1.719329357e+00F, 1.340533942e-01F, -2.027246058e-01F, -3.526682854e-01F, -3.694876134e-01F, -5.198987722e-01F,
+    -2.075062692e-01F, -1.624525785e-01F, -2.523746252e+00F, 1.604074985e-01F, 5.687957406e-01F, 5.530414358e-02F, -1.158943176e-01F, 6.541027427e-01F,
+    2.464065999e-01F, 1.988371909e-01F, -6.306740642e-01F, 5.323152989e-02F, -5.719244480e-01F, 5.166058540e-01F, -8.926841430e-03F, -5.095631480e-01F,
+    3.201667964e-01F, 1.289974302e-01F, -1.140241791e-02F, -7.084110975e-01F, -1.639082879e-01F, 5.661330223e-01F, 2.045360357e-01F, 1.765485704e-01F,
+    7.157791257e-01F, 5.327486396e-01F, 9.929683059e-02F, -4.941911399e-01F, -1.145070314e+00F, -1.006188869e+00F, -5.044015050e-01F, -2.221128702e+00F,
+    -1.251710504e-01F, -2.112837322e-02F, 1.939965189e-01F, -1.573897451e-01F, 2.090965360e-01F, 1.892560422e-01F, 2.034039348e-01F, -1.511092931e-01F,
+    6.160501838e-01F, 7.374983430e-01F, -1.977182269e+00F, -2.068204731e-01F, 3.550519943e-01F, -6.061062962e-02F, 5.184628963e-01F, 4.539494514e-01F,
+    -4.587505460e-01F, 2.139963061e-01F, 6.167965941e-03F, 8.508495092e-01F, 3.154197708e-02F, 1.829734743e-01F, -1.418511391e+00F, 6.379810721e-02F,
+    4.363517165e-01F, 2.285602987e-01F, 4.949884489e-03F, -8.660118580e-01F, -1.639280766e-01F, -3.873303235e-01F, 3.105547428e-01F, 4.352971017e-01F,
+    1.865693033e-01F, 5.910664201e-01F, -1.678052187e+00F, 9.751740843e-02F, 2.935847342e-01F, 5.567749143e-01F, -6.691698432e-01F, 1.620191485e-01F,
+    2.689912319e-01F, 1.190274656e-01F, -9.928847104e-02F, 4.102888703e-01F, -1.109890103e+00F, -1.281446934e+00F, 3.336422443e-01F, -5.797492266e-01F,
+    -2.141896337e-01F, 6.101535559e-01F, -1.685710996e-01F, 3.552039564e-01F, 6.158625707e-02F, -2.029239178e+00F, 8.567593992e-02F, 3.657709658e-01F,
+    7.536290586e-02F, 1.581240445e-01F, -5.264258981e-01F, 6.025618315e-01F, 2.261779457e-01F, -2.083540708e-01F, -9.063471109e-02F, -5.223834515e-01F,
+    -2.269071192e-01F, 8.491452783e-02F, -5.398106575e-01F, -4.685000777e-01F, -2.954053640e+00F, -3.440986276e-01F, 9.271174669e-02F, 1.395445466e-01F,
+    3.692162456e-03F, -3.086151779e-01F, 9.645146132e-02F, -2.324668318e-01F, -1.199903712e-01F, 6.121752262e-01F, -4.535969794e-01F, 1.809003353e-01F,
+    1.469083577e-01F, -3.271803558e-01F, -3.419135213e-01F, -1.362308487e-02F, -3.607790470e-01F, -6.104122996e-01F, 4.296253622e-02F, 2.383633852e-01F,
+    -5.628103018e-01F, 2.826470435e-01F, -4.856808484e-01F, 2.804774344e-01F, 2.618985996e-02F, 9.348516911e-02F, -9.205543995e-01F, -2.121596634e-01F,
+    8.887591213e-02F, 8.104697615e-02F, -7.014581561e-01F, -1.581922472e-01F, -7.213503122e-02F, 3.459318280e-01F, 5.345811248e-01F, 9.210252017e-02F,
+    4.484154657e-02F, 3.908431530e-01F, 9.413166046e-01F, -2.422359586e-02F, 9.148770571e-02F, -6.022596955e-01F, -1.433047295e+00F, 6.069020629e-01F,
+    -1.639934480e-01F, 1.338243019e-02F, -1.294627339e-01F, 4.481902421e-01F, 4.933619127e-02F, -8.229441196e-02F, -1.486182332e+00F, -4.450117648e-01F,
+    -2.097543180e-01F, -1.547548175e-01F, -2.861893177e-01F, 5.108748674e-01F, 6.387121975e-02F, 5.269104838e-01F, 5.138387084e-01F, 2.022187412e-01F,
+    -3.126919642e-02F, 4.710999727e-01F, -1.491141319e-01F, -2.833917141e-01F, -1.137598604e-01F, 3.133082986e-01F, 2.998489738e-01F, -7.830812931e-01F,
+    6.833265722e-02F, 7.185789943e-01F, 3.598054349e-01F, -3.184086382e-01F, 2.417475134e-01F, 2.542245388e-02F, -6.027778983e-01F, 2.105755508e-01F,
+    1.206477433e-01F, 1.909806021e-02F, -2.999123931e-01F, 4.755774438e-01F, 3.839827180e-01F, -2.741154730e-01F, 3.569716215e-01F, -2.820337057e+00F,
+    -1.280438304e-01F, 2.462107688e-01F, -3.509756625e-01F, 1.293173581e-01F, 6.220565736e-02F, -3.764667213e-01F, -6.636077887e-04F, -5.834591389e-01F,
+    1.098811626e-01F, 1.173142716e-01F, 2.627470531e-03F, 6.216095090e-01F, 2.450865060e-01F, -1.007411778e-01F, -8.061414957e-02F, -1.197109818e+00F,
+    6.986948848e-02F, -2.947907150e-01F, 2.743838131e-01F, -1.212085128e+00F, -4.381632805e-02F, -2.345716357e-01F, 6.805327535e-01F, 1.979047358e-01F,
+    -1.304965168e-01F, -6.529615521e-01F, 4.446445405e-01F, 4.993018135e-02F, 5.795515180e-01F, -1.924314350e-01F, -1.649593860e-01F, 5.651054978e-01F,
+    -5.086375773e-02F, 1.690638661e-01F, 2.500718534e-01F, -2.159545571e-01F, -3.045170605e-01F, -7.204816341e-01F, 3.812823594e-01F, -1.002465934e-01F,
+    5.149067193e-02F, 3.496129215e-01F, 9.634300321e-02F, -3.179159462e-01F, -7.851325274e-01F, 1.065293476e-01F, 6.093629003e-01F, -1.090407670e-01F,
+    1.938711479e-02F, -1.546956301e+00F, 2.499190420e-01F, -9.400492907e-01F, 1.574192196e-01F, 7.799111605e-01F, -9.284641147e-01F, -2.513062656e-01F,
+    -1.065084487e-01F, -7.923727036e-01F, -4.858535528e-01F, 6.847990751e-01F, -3.460706025e-02F, 9.845030308e-01F, 6.583529711e-01F, -5.125069618e-01F,
+    -1.148356423e-01F, 6.818748266e-02F, -1.982906908e-01F, 5.643098429e-02F, -2.361259311e-01F, -4.356408417e-01F, -2.327832580e-01F, 5.605847836e-01F,
+    -7.072652876e-02F, -2.283518612e-01F, -1.294741780e-01F, 2.453604937e-01F, -7.429478765e-01F, 5.303215384e-01F, 3.995299041e-01F, -1.487124339e-02F,
+    2.936934866e-02F, 5.274122357e-01F, -1.611945927e-01F, 2.083291113e-01F, -2.998805344e-01F, 1.926164180e-01F, -1.390626561e-02F, -7.253054380e-01F,
+    -1.830329895e-01F, 5.637937784e-02F, 5.656740069e-01F, -3.716021404e-02F, 2.487929165e-01F, -9.053274393e-01F, -3.733052909e-01F, 6.696736068e-02F,
+    8.888420463e-02F, 3.816620708e-01F, -5.269894600e-01F, 3.219601214e-01F, 5.644302815e-02F, 1.532934159e-01F, -8.237013966e-02F, -2.538932323e+00F,
+    -1.145690084e-01F, 5.165587068e-01F, -2.036328018e-01F, 8.272499591e-02F, -1.361951083e-01F, 2.448558062e-01F, -4.531606436e-01F, -1.066275001e+00F,
+    8.158762008e-02F, -3.022658527e-01F, 2.815399170e-01F, -3.859548867e-01F, 4.520221353e-01F, -3.804785386e-02F, 6.640767455e-01F, 7.480066419e-01F,
+    -1.992492229e-01F, -2.844516039e-01F, -2.258557677e-01F, -1.814983413e-02F, 2.687410116e-01F, 4.958224297e-01F, -5.674215555e-01F, -1.293748379e+00F,
+    -7.987592369e-02F, -4.206174519e-03F, 4.093627259e-02F, 4.325096905e-01F, 1.220605373e-01F, 2.192405015e-01F, -5.805155039e-01F, -2.018692493e-01F,
+    -1.476093680e-01F, 3.804121614e-01F, 2.972924411e-01F, 4.650438726e-01F, -1.913586706e-01F, -2.759740651e-01F, -1.145006895e+00F, -1.200511977e-01F,
+    -1.596547961e-01F, -7.346272469e-01F, 5.003435016e-01F, -1.253863215e+00F, 1.382335927e-02F, -1.111803055e+00F, 3.021703064e-01F, -6.920690835e-02F,
+    -1.135355085e-01F, -6.857035309e-02F, -1.231891736e-01F, 7.693727314e-02F, 2.526825070e-01F, 1.575309038e-02F, 3.436357677e-01F, 2.687903941e-01F,
+    1.006944329e-01F, -5.245381594e-01F, 5.295394659e-01F, -6.292804480e-01F, 2.071570903e-01F, 4.586411417e-01F, -2.290288210e-01F, 4.849770963e-01F,
+    -3.163170815e-01F, -3.205491304e-01F, -5.820505023e-01F, 2.403961420e-01F, 2.040053755e-01F, -2.720339000e-01F, -2.210131139e-01F, -3.770883381e-01F,
+    -1.162820831e-01F, -5.069585517e-02F, -2.164916396e-01F, -7.438089848e-01F, 9.834057838e-02F, 6.291204481e-04F, 1.602144241e-01F, -2.089100331e-01F,
+    -2.371294647e-01F, 2.559116483e-01F, -5.643033385e-01F, 3.418449685e-02F, 3.849951029e-01F, -3.897604346e-01F, 3.912344277e-01F, -2.187942341e-02F,
+    -2.485646904e-01F, -7.104291022e-02F, -6.615909338e-01F, -5.202543736e-01F, 4.727548957e-01F, -4.416950345e-01F, -5.994822383e-01F, -9.342970252e-01F,
+    -9.628624469e-02F, -4.451411068e-01F, -1.225781560e+00F, -6.396592855e-01F, -5.584050417e-01F, 1.369389445e-01F, -1.094120741e+00F, 7.696207762e-01F,
+    -1.042350475e-02F, 2.179629169e-02F, -1.394829899e-01F, -7.831352204e-02F, -8.683793545e-01F, -2.250815928e-01F, -2.011940718e+00F, -6.747193933e-01F,
+    -1.584817469e-01F, -2.035957016e-02F, -7.193862796e-01F, -3.836287856e-01F, 5.215584040e-01F, -6.779251695e-01F, -7.011812180e-02F, -2.311134100e+00F,
+    2.351119183e-02F, 1.105923176e+00F, 6.137133241e-01F, 5.899582505e-01F, -5.502995849e-01F, -2.333007157e-01F, -5.897142887e-01F, 5.072907209e-01F,
+    -1.634756476e-02F, 5.577456355e-01F, -6.152396798e-01F, -6.347084045e-02F, -5.938227773e-01F, 2.943688817e-02F, -1.600779295e-01F, -5.997817516e-01F,
+    -3.753617033e-02F, 7.408107072e-02F, 2.695997655e-01F, -1.188054681e+00F, -1.344562292e+00F, -2.490141243e-01F, 1.017071530e-01F, -7.794903517e-01F,
+    8.869627118e-02F, -1.706755161e-01F, 8.813592046e-02F, 1.410971433e-01F, 1.352133751e-01F, -1.627058238e-01F, 1.924508214e-01F, -2.194938362e-01F,
+    -7.779492065e-03F, -1.828333586e-01F, -4.770729225e-03F, -5.755723715e-01F, -2.276050486e-02F, 6.164050847e-02F, 3.259544075e-01F, -4.344550967e-01F,
+    5.483135954e-02F, 5.588124394e-01F, -2.419371754e-01F, 4.863219857e-01F, -8.140329123e-01F, 7.216398716e-01F, -7.560133934e-01F, 6.072437167e-01F,
+    -1.739306375e-02F, 2.003572732e-01F, 6.572979093e-01F, 4.059644639e-01F, 8.472479582e-01F, -1.484935641e+00F, 5.422223806e-01F, -2.405309230e-01F,
+    -3.697845340e-01F, 5.039079487e-02F, 2.611871623e-02F, -5.220796466e-01F, 3.352533281e-01F, -6.742978096e-01F, -2.065823227e-01F, -4.958709329e-02F,
+    -1.025062725e-01F, 2.247241288e-01F, 4.556594491e-01F, -1.072276905e-01F, 1.322554648e-01F, -3.073157743e-02F, 8.718234301e-02F, 1.751145720e-01F,
+    1.526377797e-01F, 3.022550344e-01F, -3.348824382e-01F, -4.178102016e-01F, 4.671321213e-01F, 7.287660837e-01F, -1.534826040e+00F, -7.973635793e-01F,
+    -1.663691364e-02F, 2.330458462e-01F, 2.040099055e-01F, -2.818419218e+00F, 9.926878661e-02F, -6.456242800e-01F, -2.328871936e-01F, -2.480845451e+00F,
+    -1.858937591e-01F, -5.486928225e-01F, -4.815776050e-01F, -1.827083379e-01F, 2.734288871e-01F, -1.266484559e-01F, 6.928188801e-01F, -4.163517952e-01F,
+    -2.975380123e-01F, 4.245864153e-01F, 4.317975044e-01F, -1.891656637e+00F, 5.275455713e-01F, 5.029123425e-01F, -2.738501132e-01F, -3.778577149e-01F,
+    1.227860805e-02F, -2.502657771e-01F, -2.050852627e-01F, 8.260233998e-01F, -1.249549866e+00F, -2.539671659e-01F, 7.926039100e-01F, 4.431544244e-01F,
+    -1.768838018e-01F, -6.599388551e-03F, 2.918787599e-01F, -1.904266030e-01F, -3.710606396e-01F, 1.151591986e-01F, -6.137283444e-01F, -3.256762624e-01F,
+    -5.892071500e-02F, -5.563877821e-01F, -4.167908132e-01F, -1.751149297e+00F, 1.436408460e-01F, 2.034428567e-01F, -1.207112193e+00F, -3.195370138e-01F,
+    1.047497615e-01F, -6.862579584e-01F, 4.215928614e-01F, -8.677042276e-02F, -8.751075864e-01F, -7.688347995e-02F, -4.691562653e-01F, -1.526843905e+00F,
+    4.820517078e-02F, 9.178377688e-02F, -1.755224019e-01F, 1.974087059e-01F, -1.383762062e-01F, 1.326089203e-01F, -1.692160219e-01F, -8.603839576e-02F,
+    8.618906885e-02F, -2.429008856e-02F, 7.508620620e-01F, -8.300354481e-01F, 3.927579522e-01F, -4.554505646e-01F, -1.768902391e-01F, -4.983353317e-01F,
+    7.352901250e-02F, 2.300952822e-01F, -3.859002888e-01F, 7.279337645e-01F, -3.626566529e-01F, -2.450718284e-01F, 1.626237482e-01F, 1.711065918e-01F,
+    1.427247524e-01F, 3.701952696e-01F, -1.280174106e-01F, -3.983265162e-02F, -2.397229671e-01F, 3.369936347e-01F, -6.618042588e-01F, -5.471819043e-01F,
+    -2.347087413e-01F, 5.643205345e-02F, -6.423781514e-01F, 5.756456852e-01F, 2.945340872e-01F, 2.663515806e-01F, -3.971763849e-01F, 5.126007795e-01F,
+    1.321893185e-01F, -7.483398318e-01F, 8.479140997e-01F, 3.656955361e-01F, 1.746115983e-01F, -1.817730516e-01F, -7.908191681e-01F, -1.378928591e-02F,
+    -1.695543826e-01F, 4.644313157e-01F, -1.199101210e+00F, 3.942666575e-02F, -1.379449666e-02F, -4.704854190e-01F, 2.010946274e-01F, -3.125951886e-01F,
+    -1.434900016e-01F, -1.131569743e+00F, -8.057945371e-01F, -9.130533040e-02F, 2.794446051e-01F, 3.200511932e-01F, -4.910525680e-02F, 4.067735076e-01F,
+    1.024603993e-01F, 1.690892428e-01F, 6.078715324e-01F, -3.763602674e-02F, -4.281023741e-01F, -5.959749222e-01F, 5.958721042e-01F, -2.943640649e-01F,
+    8.779039606e-03F, 6.455787420e-01F, 1.657098532e-01F, -1.533570290e+00F, 1.443607509e-01F, 1.449057758e-01F, -1.838197947e+00F, 1.627112925e-01F,
+    -5.739378929e-02F, 2.653031349e-01F, 3.130665720e-01F, 5.535587072e-01F, -3.915858567e-01F, 2.739620209e-01F, -8.384944797e-01F, -6.558545232e-01F,
+    -3.388255835e-02F, -2.045837790e-01F, -2.017596215e-01F, 1.198361591e-01F, 2.434990257e-01F, 7.473303676e-01F, -1.048914313e+00F, 9.408944845e-01F,
+    1.580165178e-01F, 3.850634396e-01F, 4.266356528e-01F, -1.440308332e+00F, 3.573379517e-01F, 6.264694333e-01F, 2.053056061e-01F, -2.183603793e-01F,
+    -6.767413579e-03F, 7.702856660e-01F, -5.947433785e-02F, -4.733387232e-01F, -8.811336011e-02F, -6.503115594e-02F, 8.507467806e-02F, -1.171635628e+00F,
+    -1.296973825e+00F, 4.587617218e-01F, -9.946011752e-02F, -6.632747650e-01F, 2.489709295e-02F, -4.600954801e-02F, -3.941726685e-01F, -1.370337456e-01F,
+    -1.072110608e-01F, -1.261942267e+00F, -9.186359048e-01F, 5.529315472e-01F, -3.488718271e-01F, 4.693939090e-01F, -3.041341305e-01F, -5.519472957e-01F,
+    4.040280730e-02F, 1.942567527e-01F, -3.958452940e-01F, 5.403054133e-02F, 2.171186507e-01F, 4.709027708e-01F, 3.339506984e-01F, -1.918708533e-01F,
+    8.397179097e-02F, 1.129070222e-01F, 4.032312036e-01F, 6.797314882e-01F, 9.604537487e-02F, -2.870213389e-01F, 8.094254136e-01F, -1.032235503e+00F,
+    4.975968003e-01F, 9.002177119e-01F, -6.335822940e-01F, -5.772742033e-01F, 4.970297813e-01F, 3.763217330e-01F, -1.115743995e+00F, 6.113770418e-03F,
+    -5.562694669e-01F, 4.396803081e-01F, 3.173739910e-01F, 1.587651223e-01F, -6.363317966e-01F, 1.291113198e-01F, 1.074335098e+00F, 3.285198510e-01F,
+    4.064453840e-01F, -2.579939067e-01F, -7.400196195e-01F, 3.671924174e-01F, 5.063308477e-01F, -6.052215099e-01F, -5.586661696e-01F, -3.875819147e-01F,
+    -2.013933063e-01F, -7.639740109e-01F, 2.202843279e-01F, 2.539967597e-01F, -2.982332706e-01F, -2.901639938e-01F, 4.286647737e-01F, 2.917438745e-02F,
+    -2.096004963e+00F, 2.831000984e-01F, 1.142050028e-01F, -2.793209553e-01F, 2.020338625e-01F, -3.238702714e-01F, -7.618638873e-01F, 2.365290746e-02F,
+    -5.784458518e-01F, -1.022918895e-01F, 4.227072895e-01F, -1.595063210e+00F, -4.138500094e-01F, 4.859795272e-01F, -7.269797325e-01F, -1.368551970e+00F,
+    -6.304198503e-01F, 2.549958527e-01F, -4.060592502e-02F, 1.565967798e-01F, 7.728712261e-02F, 4.430820234e-03F, -4.617270529e-01F, -1.459222078e+00F,
+    7.259145845e-03F, 3.117555678e-01F, 5.051009357e-02F, 2.510831356e-01F, -1.494113263e-02F, -6.706519723e-01F, -4.016886950e-01F, -3.831809461e-01F,
+    -5.164560676e-01F, -1.294699550e+00F, 2.230763137e-01F, -1.705242544e-01F, -3.864509761e-01F, -3.972778618e-01F, 2.203279883e-01F, -8.431987762e-01F,
+    3.236218393e-01F, 1.466606408e-01F, -7.005435824e-01F, -5.117200613e-01F, 5.274003148e-01F, 2.145853266e-02F, 6.462247968e-01F, 4.566199332e-02F,
+    4.357901216e-01F, 4.176624417e-01F, -6.044331789e-01F, -3.107070327e-01F, -4.070191085e-01F, 1.084766388e-01F, 2.351122350e-01F, 3.113795817e-01F,
+    -7.945086956e-01F, -7.273602486e-01F, -1.071272716e-01F, 5.774152875e-01F, -9.557159990e-02F, -3.963258266e-01F, 4.463419914e-01F, 2.982519381e-02F,
+    -3.421058059e-01F, -9.021600708e-03F, 4.376694858e-01F, 2.695187330e-01F, -2.665229440e-01F, -4.499842525e-01F, -6.096538305e-01F, 1.392556578e-01F,
+    -1.952994704e+00F, -2.201344967e-01F, -6.915549040e-01F, -3.207421601e-01F, -4.975894988e-01F, 1.180142403e+00F, -5.552896857e-01F, 9.092764854e-01F,
+    -3.144443035e-01F, -9.701778181e-04F, -4.124301672e-01F, 8.328571916e-02F, 4.591343179e-02F, 4.124672413e-01F, -1.274505705e-01F, 7.961214781e-01F,
+    -7.119287252e-01F, -6.451114416e-01F, 5.024169683e-01F, -8.598406911e-01F, 5.654294491e-01F, 1.110405475e-01F, 1.291003972e-01F, -4.206370711e-01F,
+    -1.850810796e-01F, -3.553121388e-01F, -5.069609284e-01F, -9.706914425e-01F, 4.083569720e-02F, 2.573859505e-02F, -1.178582072e+00F, 2.603349984e-01F,
+    -3.043376505e-01F, -4.026801288e-01F, -4.218678176e-01F, -1.320418119e-01F, -4.695343077e-01F, 1.426933110e-01F, -2.019890547e+00F, -1.330348104e-01F,
+    -1.139242768e+00F, 4.036852345e-02F, -2.294821739e-01F, 5.105019733e-02F, 5.986596942e-01F, -5.078284740e-01F, -2.709131241e-01F, 3.050321043e-01F,
+    1.392985731e-01F, -3.003882468e-01F, 3.148387671e-01F, 5.988755226e-01F, 1.054620743e+00F, 4.443135858e-01F, 5.938470364e-01F, -8.540713191e-01F,
+    -1.592106968e-01F, 3.485353887e-01F, 3.310587406e-01F, -3.451130092e-01F, 7.151730657e-01F, -9.038165212e-01F, 3.097816110e-01F, 2.504133061e-02F,
+    1.215772796e-02F, 6.518001556e-01F, -1.120423794e+00F, -6.715676188e-01F, 2.683532834e-01F, 1.571694463e-01F, -9.570685774e-02F, 6.412454247e-01F,
+    -2.447228730e-01F, -1.262937337e-01F, 7.177647352e-01F, 2.131503224e-01F, 3.750603497e-01F, 5.911899805e-01F, -3.614530563e-01F, 4.694780707e-01F,
+    7.482662201e-01F, -1.659925431e-01F, 1.059724838e-01F, 1.874835938e-01F, -1.244081497e+00F, 1.655969620e-01F, -3.655052185e-01F, 7.509077787e-01F,
+    2.907112837e-01F, -4.133617282e-01F, -1.589594483e-01F, -4.715176821e-01F, -2.245253623e-01F, -5.155823827e-01F, 5.294265747e-01F, -6.902731657e-01F,
+    -3.825337887e-01F, 3.207125068e-01F, -1.370408386e-01F, -9.271025658e-01F, -9.326429367e-01F, -1.303799987e+00F, 2.894999087e-01F, 3.353241086e-01F,
+    -6.018980592e-02F, 3.479980398e-03F, 8.797909319e-02F, 1.053358674e+00F, 1.705865264e-01F, 6.515150070e-01F, 3.377465308e-01F, 3.352629244e-01F,
+    4.730565548e-01F, 4.826179147e-01F, 4.995828569e-01F, 1.562706679e-01F, 2.416361496e-02F, -4.299716651e-01F, 6.004840732e-01F, -7.467303425e-02F,
+    -7.862116694e-01F, -1.979077756e-01F, -9.560501575e-01F, 2.453646809e-02F, -3.012938201e-01F, 2.511728108e-01F, -3.330320120e-01F, 3.743427396e-01F,
+    3.605106592e+00F, -9.661077857e-01F, -6.327291727e-01F, -4.570526481e-01F, -1.124499202e+00F, -1.494456768e+00F, 3.927285969e-01F, 4.942994416e-01F,
+    -8.745246530e-01F, -2.014968842e-01F, 2.124360353e-01F, -8.918560296e-02F, -1.319432110e-01F, 3.091991544e-01F, -5.089754462e-01F, 3.385948539e-01F,
+    -3.170189857e-01F, -7.601297498e-01F, 3.814828992e-01F, 3.408020735e-01F, -6.802644134e-01F, -3.001642227e-01F, 5.085439086e-01F, -6.444771886e-01F,
+    1.310573667e-01F, 1.375042200e-01F, 1.460510790e-01F, -1.463669091e-01F, -1.020465717e-01F, -2.275631391e-02F, 1.047082394e-01F, -1.918330789e-01F,
+    1.374167670e-02F, 1.066793352e-01F, -4.449180067e-01F, -9.819613099e-01F, -5.275617838e-01F, 1.841980517e-01F, -7.709825635e-01F, 1.789456457e-01F,
+    4.905517101e-01F, 1.611505263e-02F, -2.516992688e-01F, 3.618470132e-01F, -1.202927716e-02F, 3.889709711e-01F, 1.617861092e-01F, -1.532548308e+00F,
+    -2.545175850e-01F, -4.995319843e-01F, -3.654313982e-01F, -7.343208045e-02F, 8.594263792e-01F, -3.673689067e-01F, 1.647846252e-01F, -1.483436823e-01F,
+    -2.599118650e-01F, -1.426971853e-01F, -4.294403195e-01F, 2.629724741e-01F, 8.669501543e-02F, 2.894999385e-01F, 7.457283884e-02F, -8.801167011e-01F,
+    -1.136542037e-01F, 6.338676810e-02F, -6.607351303e-01F, 3.964132667e-01F, 2.036224753e-01F, 7.251453996e-01F, 1.014981046e-01F, -8.850893974e-01F,
+    2.095549833e-03F, 3.674023971e-02F, -4.996214807e-02F, -1.103335261e+00F, -1.471086740e-01F, 8.602936268e-01F, 2.014995962e-01F, -3.238051534e-01F,
+    -5.990183726e-02F, 7.286668420e-01F, -1.503365040e+00F, -2.517556548e-01F, -8.229312897e-01F, -2.676931024e-01F, -2.141467929e-01F, -3.851468265e-01F,
+    8.487634659e-01F, 1.121789068e-01F, 7.211198807e-01F, -5.599216819e-01F, 3.325271606e-01F, 2.450947464e-01F, -1.849470586e-01F, 1.866214573e-01F,
+    -9.080489278e-01F, 2.950287759e-01F, 5.541700497e-02F, -1.149963617e+00F, 1.861743927e-01F, -2.057536542e-01F, -5.701909065e-01F, -1.993066519e-01F,
+    -7.196160555e-01F, 6.616587043e-01F, -8.438169956e-01F, -2.555603087e-01F, -1.045465544e-01F, -6.260446310e-01F, 4.551662207e-01F, 3.630551044e-03F,
+    -1.200267315e+00F, -6.267914921e-02F, -6.692792177e-01F, -6.196234003e-02F, 4.343653917e-01F, -2.854525447e-01F, 1.793265045e-01F, -8.431718349e-01F,
+    5.524387360e-01F, -6.851632595e-01F, 1.528697163e-01F, -4.925047755e-01F, -2.807997167e-01F, 7.303311825e-01F, -1.739612520e-01F, -1.093901694e-01F,
+    5.463728905e-01F, -2.181591839e-01F, -8.617299795e-01F, -1.270968094e-02F, 1.454192400e-02F, -3.192066848e-01F, 1.460419148e-01F, -1.003658652e+00F,
+    5.644985661e-02F, 7.921188325e-02F, 1.770680994e-01F, 1.549714804e-01F, -1.092659757e-01F, 1.071410179e-01F, -1.272539794e-01F, -2.007942647e-02F,
+    -3.412719443e-02F, 5.468204021e-01F, -1.944777220e-01F, 6.539004296e-02F, 1.497996151e-01F, 7.846917510e-01F, 1.374690831e-01F, 6.774424016e-02F,
+    -1.665392220e-01F, 2.578370869e-01F, 1.015787482e+00F, 3.368971944e-01F, 1.855801344e-01F, -1.818767339e-01F, 3.690971062e-02F, 4.678567946e-01F,
+    -2.958368659e-01F, -8.626082540e-01F, 6.007823348e-01F, 1.486853510e-01F, -3.634440303e-01F, 4.328613728e-02F, -1.930887550e-01F, -5.384824872e-01F,
+    2.106943130e-01F, 3.224925101e-01F, -3.996298462e-02F, 5.226864815e-01F, -1.274795383e-01F, 1.559349000e-01F, 4.447218478e-01F, 4.676224291e-02F,
+    -3.864187598e-01F, -3.233795166e-01F, 9.595794082e-01F, 6.069765687e-01F, -7.636168003e-01F, -2.958351076e-01F, -1.905181646e+00F, -8.086971045e-01F,
+    2.437242568e-01F, -2.829477191e-02F, 3.102242947e-01F, -2.002058774e-01F, 1.615083069e-01F, 5.821581464e-03F, -9.199830145e-02F, 9.897410870e-02F,
+    -1.947512180e-01F, -8.122507930e-01F, -4.276266694e-02F, 4.081814885e-01F, 4.450796247e-01F, -9.805082679e-01F, -3.826198727e-02F, 2.332679331e-01F,
+    7.073740363e-01F, 3.389793932e-01F, -2.499205619e-01F, 7.346046567e-01F, 5.168380737e-01F, 3.684212863e-01F, 4.034468234e-01F, -2.094229460e-01F,
+    -1.799624711e-01F, -7.583022714e-01F, -3.113754094e-01F, -2.119658887e-01F, -4.734548330e-01F, -4.201587290e-02F, 5.002412200e-01F, 3.723911941e-02F,
+    -3.936603367e-01F, -9.291294813e-01F, 6.523283571e-02F, -1.571927220e-01F, 1.008010954e-01F, -7.883775830e-01F, 2.652691603e-01F, 8.701101691e-02F,
+    1.809655316e-02F, -5.925360918e-01F, 5.164131522e-01F, 1.513095479e-02F, -6.089366674e-01F, -8.768060803e-02F, -5.300918221e-01F, -3.071969450e-01F,
+    -2.207699716e-01F, -2.106128782e-01F, -4.313015640e-01F, -1.609776467e-01F, -4.276062250e-01F, -9.246044755e-01F, -7.195931394e-03F, 3.478439152e-01F,
+    8.324565887e-01F, -1.616343856e+00F, 6.265739799e-01F, -7.677881420e-02F, -1.169368029e+00F, -7.923249155e-02F, 7.121877372e-02F, -1.587140709e-01F,
+    6.087775826e-01F, -3.639240563e-01F, -2.535011172e-01F, -8.555616736e-01F, 1.118438914e-01F, -1.544491768e+00F, 2.166231722e-01F, 2.637789845e-01F,
+    2.107387036e-01F, -2.551134527e-01F, -1.503925491e-02F, 5.253134966e-01F, 1.591212451e-01F, 1.242533773e-01F, -7.188369036e-01F, -5.377095938e-01F,
+    -1.131456271e-01F, -3.289679885e-01F, 3.406966329e-01F, 9.518672526e-02F, -6.842051744e-01F, 3.689417541e-01F, -3.901058733e-01F, 7.072466612e-01F,
+    -2.219125330e-01F, -8.978786319e-02F, 3.863702342e-02F, -3.750338852e-01F, -8.617346883e-01F, 3.066086471e-01F, -8.294906616e-01F, 7.317193598e-02F,
+    -1.091194272e+00F, 2.708593309e-01F, -4.219702780e-01F, -6.336073875e-01F, 6.311042309e-01F, -4.748974368e-02F, 3.531429768e-01F, 9.230962396e-02F,
+    -3.411563337e-01F, 6.356022358e-01F, 2.843610942e-01F, -1.114625573e+00F, -9.002977610e-02F, -4.704582095e-01F, 5.388689041e-01F, -1.355792582e-01F,
+    -8.520547152e-01F, 1.339758039e-01F, 1.115143746e-01F, 1.561557800e-01F, -5.164275765e-01F, 8.733966947e-02F, 2.610146068e-02F, 9.103208184e-01F,
+    -1.137827039e+00F, 4.135745466e-01F, 1.438116729e-01F, -4.847689271e-01F, -8.052616715e-01F, 3.127176762e-01F, 5.250551701e-01F, -2.653726935e-01F,
+    -1.757202148e-01F, -3.317483962e-01F, 3.018890619e-01F, -5.812105536e-01F, -2.283814251e-01F, -5.869580507e-01F, -1.478230059e-01F, 6.084907055e-01F,
+    7.175401449e-01F, -3.037030399e-01F, 3.477867842e-01F, -1.526929975e+00F, 6.891631484e-01F, -2.548790574e-01F, 4.546851516e-01F, -5.076764897e-02F,
+    2.835546732e-01F, -1.182906628e+00F, -3.622764945e-01F, -2.434183359e-01F, 1.121436283e-01F, -1.237254977e+00F, -2.703086734e-01F, -7.493135333e-01F,
+    8.883994818e-02F, 4.440327734e-02F, 5.497951061e-04F, 1.030176520e+00F, -8.437557518e-02F, 1.258342564e-01F, -1.357254237e-01F, -3.313893080e-01F,
+    -3.982017934e-02F, 2.073421478e-01F, -8.137811422e-01F, 6.025801897e-01F, -7.062628865e-01F, 5.174996853e-01F, -4.701245427e-01F, -8.888057619e-02F,
+    6.474202275e-01F, 4.114538133e-01F, 1.168341115e-01F, 5.548402071e-01F, -1.653529108e-01F, -3.346846402e-01F, 7.645386457e-01F, -1.765389889e-01F,
+    2.511411905e-01F, -5.657312274e-01F, -1.014640808e+00F, -5.610168576e-01F, 4.091301858e-01F, -5.133312941e-01F, -1.130372047e+00F, -2.442363352e-01F,
+    -2.626088858e-01F, 4.437962919e-02F, 1.431067474e-02F, 3.939384818e-01F, -6.718606353e-01F, -1.457118839e-01F, 2.421324253e-01F, -5.378592014e-01F,
+    -1.366464794e-01F, 1.266094744e-01F, -2.857819572e-02F, -1.170744672e-01F, 2.222684473e-01F, 2.824891508e-01F, 6.765173674e-01F, 3.196665347e-01F,
+    -1.449090123e+00F, 6.200551391e-01F, 5.761064291e-01F, 4.748375714e-01F, 2.218571752e-01F, 2.813116014e-01F, -1.327696592e-01F, -1.408211142e-01F,
+    -1.447412372e-01F, 3.880610466e-01F, -3.420990407e-01F, 1.249193549e-01F, -7.446073890e-01F, 8.834227324e-01F, -9.039131552e-02F, 2.293666452e-01F,
+    9.245260954e-01F, 5.250787362e-02F, 3.525801897e-01F, -5.884351954e-02F, -7.938765287e-01F, 3.916329443e-01F, -2.644360252e-02F, -5.595756769e-01F,
+    -5.309875682e-02F, -1.294944286e-01F, -1.804732382e-01F, -6.065778732e-01F, -5.142340660e-01F, -6.987230778e-01F, 2.877738560e-03F, 1.025948822e-01F,
+    -7.028855085e-01F, -6.856909394e-01F, -2.361936495e-02F, -6.494094133e-01F, -4.500158131e-01F, -1.846611857e+00F, -1.001259208e+00F, 2.010462247e-02F,
+    -3.576467186e-02F, -6.128008664e-02F, 2.670989633e-01F, -1.010842323e-01F, -2.234139144e-01F, 2.907309532e-01F, 6.724237204e-01F, 3.879837096e-01F,
+    -6.417185068e-01F, 9.459804744e-02F, 6.619571447e-01F, -1.409335732e+00F, 1.424693614e-01F, -8.074046969e-01F, 7.970408797e-01F, 3.671365380e-01F,
+    7.367393374e-01F, 1.795030013e-02F, -9.887323380e-01F, 1.439999342e-01F, 2.041943073e-01F, -5.542742610e-01F, -9.278267622e-01F, -3.358874470e-02F,
+    4.604158103e-01F, -2.397929728e-01F, 2.824063995e-05F, -1.428143233e-01F, -1.498241574e-01F, -8.621992469e-01F, 3.320093080e-02F, 2.805556953e-01F,
+    -4.668456018e-01F, 3.539963067e-01F, 6.121283770e-01F, -3.161085546e-01F, -6.882213354e-01F, 7.964211702e-02F, -3.297360986e-02F, 1.168208271e-01F,
+    -9.687630534e-01F, 1.814341992e-01F, 2.161354423e-01F, -1.895842701e-02F, 5.378707051e-01F, -5.446096417e-03F, -1.644246131e-01F, 4.281741083e-01F,
+    -2.150831521e-01F, -1.907043904e-01F, -2.494563907e-01F, 2.011054195e-02F, 7.094492316e-01F, 3.314148486e-01F, -1.596647501e-01F, -1.780547500e-01F,
+    -4.603427649e-01F, 1.276173592e-01F, 3.929826915e-01F, 5.899360180e-01F, -3.369673789e-01F, -1.545447469e+00F, -3.570595980e-01F, 5.782817677e-02F,
+    2.342652828e-01F, 7.428002954e-01F, -2.750050128e-01F, 2.015063316e-01F, 3.242559731e-01F, -4.260700941e-02F, -1.165202260e-01F, 6.479466558e-01F,
+    5.181869268e-01F, 1.219394878e-01F, 4.957215488e-01F, -8.430144787e-01F, -1.574368328e-01F, -4.765175283e-01F, 3.473993540e-01F, -2.417491525e-01F,
+    -4.429400340e-02F, -1.473171860e-01F, 9.824889153e-02F, -8.439939618e-01F, 2.418168634e-01F, 4.920878708e-01F, 5.245116353e-01F, 3.271967769e-01F,
+    -1.202698350e-01F, -1.632236987e-01F, -1.081595659e+00F, 9.284685850e-01F, -1.532179475e+00F, 9.146822095e-01F, -6.737247705e-01F, -1.157008886e+00F,
+    -1.787315160e-01F, 7.585391402e-02F, 3.303054720e-02F, 4.577349126e-01F, 8.321927488e-02F, 4.477307498e-01F, 2.891779840e-01F, -2.112799138e-01F,
+    -4.488531947e-01F, -7.419381738e-01F, -3.747774065e-01F, 1.705497801e-01F, 2.687581778e-01F, 3.488388360e-01F, -1.508019120e-01F, -1.685965210e-01F,
+    -1.087533087e-01F, 2.496106476e-01F, 8.332169056e-02F, 3.696839485e-05F, -7.046024501e-02F, 9.793158621e-02F, -1.033167243e-01F, -1.094295830e-01F,
+    5.562162995e-01F, 5.917406678e-01F, -1.950164586e-01F, 3.319707811e-01F, 3.235052824e-01F, 7.542006373e-01F, 4.922259450e-01F, 2.789528072e-01F,
+    -2.318100072e-02F, 1.008159637e+00F, 1.569763422e-01F, -3.311831951e-01F, 7.040338516e-01F, -2.445245981e-01F, -5.221356153e-01F, -1.947655678e-01F,
+    -4.877871871e-01F, -3.271599114e-01F, 3.793347478e-01F, -6.606749445e-02F, -2.403095663e-01F, 2.690902054e-01F, -1.083307266e-01F, 4.663218558e-02F,
+    -7.973855138e-01F, 4.875694811e-01F, -6.855885983e-01F, 4.260789454e-01F, 5.471034050e-01F, 3.248969559e-03F, -2.027189434e-01F, 3.516409397e-01F,
+    -1.284468472e-01F, -1.540185660e-01F, 3.277079761e-01F, -2.618629932e-01F, -4.607898369e-02F, -3.389399946e-01F, 2.307198942e-01F, 1.007359400e-01F,
+    -2.133141011e-01F, 2.576593757e-01F, -1.707394570e-01F, 1.953227073e-01F, -4.523951113e-01F, 1.150174811e-01F, -1.093791351e-01F, -3.723147213e-01F,
+    -5.305738449e-01F, -3.135191202e-01F, 4.111497700e-01F, 1.806010455e-01F, 3.299947381e-01F, -7.893736959e-01F, -8.149104118e-01F, 2.211151868e-01F,
+    -5.482940674e-01F, -1.209592462e+00F, -3.378121555e-01F, 4.218862355e-01F, 4.259567559e-01F, -5.391599238e-02F, 9.160658717e-02F, 4.175977409e-01F,
+    -4.255542457e-01F, -9.606406689e-01F, -3.779108822e-01F, 3.702642322e-01F, -1.871508956e-01F, 6.409446150e-02F, 2.201707959e-01F, -3.611291349e-01F,
+    -5.011811256e-01F, -8.660374284e-01F, 6.485737115e-02F, 5.161867142e-01F, -1.042608500e+00F, 5.695020556e-01F, 4.842418730e-01F, -3.781353235e-01F,
+    1.965418309e-01F, -6.908449531e-01F, -5.136660933e-01F, 6.681231856e-01F, -3.010121733e-02F, -1.095773816e+00F, 1.462835670e-01F, -3.854671121e-01F,
+    -7.298351079e-02F, -9.015336633e-01F, -5.119628906e-01F, -1.785723269e-01F, 1.221942678e-01F, -1.440672159e+00F, -2.196013927e-01F, -2.043945156e-02F,
+    7.983577438e-03F, -3.527169302e-02F, -1.523909271e-01F, 6.300894618e-01F, 1.006581262e-01F, -2.678980112e+00F, -4.489025101e-02F, 2.136522084e-01F,
+    1.832007170e-01F, -1.572288573e-01F, -1.025851518e-01F, 1.581142098e-01F, -1.336772591e-01F, 1.609418094e-01F, -1.105005890e-01F, 1.784976870e-01F,
+    -1.416328192e+00F, -1.399817765e-01F, 1.831289679e-01F, 1.202479005e-01F, -5.432673693e-01F, 6.592198610e-01F, 5.093804374e-02F, -1.038018689e-01F,
+    -5.486636981e-02F, -2.854317129e-01F, -1.460118294e-01F, -3.574859500e-01F, -1.756085604e-01F, 6.934983730e-01F, 7.178911567e-02F, -2.827965915e-01F,
+    7.906656861e-01F, -1.201757491e-01F, 7.941415310e-01F, -1.034895331e-01F, 9.708195180e-02F, -2.631096542e-01F, 2.605857551e-01F, -6.801305413e-01F,
+    5.544167757e-02F, -2.392013371e-01F, -9.980000556e-02F, 3.619980216e-01F, 4.931224287e-01F, 7.488794923e-01F, 1.567315459e-01F, 3.551505506e-01F,
+    5.445724130e-01F, -1.289880991e+00F, -1.158210263e-01F, 5.990077853e-01F, -8.177057505e-01F, -6.008404493e-01F, 5.001966953e-01F, -8.120990545e-02F,
+    6.752006412e-01F, -5.201474428e-01F, 3.711894155e-01F, -3.903033137e-01F, -2.594898045e-01F, -2.673659027e-01F, 2.121648192e-01F, 5.858988166e-01F,
+    1.134504974e-01F, 5.757078156e-02F, -4.835326970e-01F, 3.159478307e-01F, -5.182366818e-02F, -3.644427955e-01F, 2.706422210e-01F, 1.024998724e-01F,
+    1.478401870e-01F, 1.036914945e+00F, -6.190702319e-01F, -2.739465535e-01F, -4.988414347e-01F, -1.206604958e+00F, -7.464883327e-01F, 7.432388663e-01F,
+    -1.071243361e-01F, 4.784764647e-01F, 3.592079878e-01F, 2.418435067e-01F, -9.395298362e-01F, 4.052146338e-03F, 6.086040288e-02F, -1.421874046e+00F,
+    2.296625674e-01F, -1.099060893e+00F, 7.925578207e-02F, 4.068618268e-02F, 2.855885625e-01F, 3.741652071e-01F, -6.250455379e-01F, -2.770170867e-01F,
+    4.283720553e-01F, 5.015598726e-04F, -6.110520959e-01F, -1.684090942e-01F, 2.318215370e-01F, 5.613446236e-01F, -9.188234061e-02F, -7.601199150e-01F,
+    -1.209501624e+00F, -1.930144429e-01F, -1.781279296e-01F, 5.333501101e-01F, 9.161255509e-02F, -1.101071715e+00F, -1.544853300e-01F, -7.866395116e-01F,
+    6.780684590e-01F, 1.819957346e-01F, 2.111274153e-01F, -1.637869328e-01F, -1.158799887e+00F, -4.889589548e-01F, 7.043812275e-01F, 1.963622570e-01F,
+    -8.195046335e-03F, -7.997249961e-01F, 1.589963287e-01F, -2.712759972e-01F, -1.185901910e-01F, -2.435931414e-01F, 4.773243070e-01F, 2.489009500e-01F,
+    7.160599232e-01F, 7.123473287e-02F, -2.714059688e-02F, -7.598578930e-01F, -5.093396902e-01F, 5.303918570e-02F, 2.202049047e-01F, 6.888085008e-01F,
+    1.177645177e-01F, 5.947805643e-01F, 4.384711683e-01F, -1.088995337e+00F, 5.062012076e-01F, 2.042450160e-01F, -5.079942942e-02F, 1.416258961e-01F,
+    -6.159744263e-01F, -3.186396956e-01F, 8.577244878e-01F, -1.304401278e+00F, 1.306938231e-01F, -1.003148913e+00F, 1.462792456e-01F, 3.694541752e-01F,
+    -3.565286994e-01F, -1.139883518e+00F, -2.156223543e-02F, -2.262168646e+00F, 1.273092926e-01F, -6.719016433e-01F, -1.978641748e-01F, 1.017076373e+00F,
+    3.290414810e-02F, 3.277449608e-01F, 1.811073720e-01F, 1.028313115e-01F, 8.950028569e-02F, 3.609970212e-01F, -1.494109273e+00F, -4.708790183e-01F,
+    6.877784133e-01F, -7.444296479e-01F, 3.244360387e-01F, -4.811796844e-01F, -6.809027195e-01F, -9.741979241e-01F, -3.688103855e-01F, -3.208543658e-01F,
+    -4.925231263e-02F, -2.822537422e-01F, -1.023645923e-01F, -4.320805669e-01F, -6.496835351e-01F, -3.828360140e-01F, -6.042604446e-01F, -3.652213216e-01F,
+    1.743076146e-01F, -3.646183908e-01F, -2.096902132e-01F, 1.428653300e-01F, -2.261196077e-01F, -2.940047383e-01F, 1.662121713e-01F, -2.588412166e-01F,
+    7.382835448e-02F, 3.241398931e-01F, 7.367102057e-02F, 2.913283110e-01F, 3.356914520e-01F, 4.741623402e-01F, 5.137988925e-01F, -5.313851237e-01F,
+    -7.648040056e-01F, 3.076393902e-01F, 7.299906015e-01F, -2.239596397e-01F, 7.720823288e-01F, 8.511491865e-02F, -4.367360473e-02F, -3.732794430e-03F,
+    2.530667782e-01F, -2.651271820e-01F, -4.930402339e-02F, -2.724112868e-01F, -1.225321293e+00F, -1.922437102e-01F, -2.152650356e-01F, -7.388421148e-02F,
+    -4.101128876e-01F, -3.532083631e-01F, 6.155543923e-01F, 3.067898750e-01F, -1.654678822e+00F, 6.304374933e-01F, 3.119906485e-01F, 8.309404552e-02F,
+    -2.872695327e-01F, 2.448360175e-01F, -2.840607464e-01F, -1.503212929e+00F, -7.146962285e-01F, -1.544762999e-01F, 9.863369167e-03F, -3.162828982e-01F,
+    4.101168513e-01F, 4.495530128e-01F, -2.797695100e-01F, -2.105887651e+00F, -2.321801186e-01F, 1.418432444e-01F, 3.749388754e-01F, 2.656176090e-01F,
+    4.806986749e-01F, -4.470617175e-01F, 3.220843971e-01F, 6.281159520e-01F, -4.404570460e-01F, -1.696508378e-01F, -1.695921421e-01F, 1.507935822e-01F,
+    -8.326416463e-02F, -2.195128053e-01F, -1.929030418e-01F, 4.289659560e-01F, 8.752639294e-01F, 3.359473944e-01F, 1.608915925e-01F, -1.566323519e+00F,
+    -7.392314076e-02F, 6.031538248e-01F, -4.342329204e-01F, -2.104790062e-01F, -7.407973409e-01F, -7.244520783e-01F, 8.619734645e-01F, -6.816899776e-01F,
+    5.559911728e-01F, -3.769768868e-03F, -1.074537635e-03F, -2.727811337e-01F, 1.236246079e-01F, -9.993415475e-01F, 4.465039074e-01F, -2.305994034e-01F,
+    3.878339231e-01F, 2.942132950e-01F, 2.183406204e-01F, 2.772720158e-02F, -1.231856942e+00F, -4.021218777e+00F, -8.747186661e-01F, -5.565548539e-01F,
+    -1.405470729e+00F, -6.629120708e-01F, 3.071551621e-01F, 1.447754055e-01F, 3.724251986e-01F, -6.428086013e-02F, -3.581522107e-01F, 2.877980769e-01F,
+    -7.077855468e-01F, -5.674083233e-01F, 1.056623682e-01F, -4.369345605e-01F, -4.058424234e-01F, 3.504547477e-01F, -4.874722660e-02F, -6.322051883e-01F,
+    -3.135781288e-01F, 5.367235541e-01F, 2.205986381e-01F, -2.217303813e-01F, -3.417251706e-01F, 2.496818081e-02F, 2.886986136e-01F, 3.668227494e-01F,
+    -6.445156336e-01F, 1.642864943e-01F, -3.946923912e-01F, 5.483492017e-01F, 7.268892527e-01F, -3.100089133e-01F, 3.631980419e-01F, -4.846881330e-01F,
+    -6.667042375e-01F, -1.227150798e+00F, 2.707713246e-01F, -3.822800517e-02F, -1.440610439e-01F, 1.578226537e-01F, -3.008913398e-01F, 6.504073143e-01F,
+    3.795703351e-01F, 5.430516601e-01F, 2.273945957e-01F, -4.267082214e-01F, -2.547579288e+00F, 5.062770247e-01F, 2.439641953e-01F, 1.703768522e-01F,
+    7.560717463e-01F, 9.571571648e-02F, -1.066799387e-01F, 4.621987641e-01F, 4.894375801e-01F, -2.198952436e-02F, -1.070887804e+00F, -8.747060895e-01F,
+    6.557086855e-02F, -6.093183160e-01F, -1.365818083e-01F, -5.105425119e-01F, -4.904598594e-01F, 3.772217631e-01F, 3.140562177e-01F, -4.568465650e-01F,
+    -2.230854034e-01F, 1.116334274e-01F, -1.712229662e-02F, -1.072615907e-01F, 2.099580914e-01F, 5.256313086e-01F, 5.458214283e-01F, 8.258254826e-02F,
+    -4.532665610e-01F, 1.464521438e-01F, 4.905533195e-01F, -1.929983869e-02F, -4.604827762e-01F, -4.602957964e-01F, -2.519555092e-01F, -1.201060712e-01F,
+    1.520048082e-01F, -2.718266249e-01F, 7.089018226e-01F, -1.263879776e+00F, -5.524086952e-01F, 2.585422620e-02F, 1.869774759e-01F, -8.580906391e-01F,
+    3.256947696e-01F, -6.853735447e-02F, 2.149226964e-01F, -6.280412078e-01F, 3.762375414e-01F, 6.084001064e-02F, 8.447416872e-02F, 2.713366747e-01F,
+    6.930820346e-01F, 2.021336108e-01F, -7.037910223e-01F, -4.348658919e-01F, -2.744445503e-01F, -1.120355368e+00F, -4.066941440e-01F, 6.670733094e-01F,
+    8.253247738e-01F, 4.253256321e-01F, 1.565244645e-01F, 2.500516474e-01F, -1.804427207e-01F, 2.579429746e-01F, 1.862303019e-01F, 2.739079893e-01F,
+    2.429205179e-01F, 3.278553486e-02F, -1.364599913e-01F, 1.172519803e+00F, 7.185395807e-02F, -1.949096322e+00F, 1.451927871e-01F, 7.144808769e-02F,
+    7.795516402e-02F, -2.038003206e-01F, -6.471998096e-01F, 1.743939370e-01F, -4.042772353e-01F, 5.378526449e-01F, 4.676732421e-01F, 3.114307858e-02F,
+    -7.236690074e-02F, 7.997300476e-02F, -3.962926567e-02F, 5.928541720e-02F, 3.279339895e-02F, 1.253490336e-02F, 8.068252355e-02F, -1.325990409e-01F,
+    4.560694993e-01F, -1.577006280e-01F, -4.071897566e-01F, -1.284643650e+00F, 8.024235070e-02F, -5.345301032e-01F, -7.031841874e-01F, -1.461997926e-01F,
+    -1.300181508e+00F, -3.767926618e-02F, 9.185245633e-02F, 1.166679621e+00F, 1.257036805e+00F, 5.454888344e-01F, -6.352692246e-01F, 5.606155992e-01F,
+    -1.003387928e+00F, 1.024564281e-01F, -1.824967563e-01F, 7.286716998e-02F, -1.072389722e+00F, -4.284168780e-01F, 7.247587442e-01F, -2.090118825e-01F,
+    -6.599620730e-02F, 3.703622818e-01F, -6.058695912e-01F, 6.709081531e-01F, -9.669764340e-02F, -2.334209830e-01F, -3.088903129e-01F, 1.628121585e-01F,
+    -1.789548755e+00F, 6.242083907e-01F, -2.987379730e-01F, -3.155061007e-01F, -2.060397714e-02F, 2.624154277e-02F, -1.424439549e-01F, 1.277035177e-01F,
+    -1.125863910e+00F, -1.664402150e-02F, -4.009728506e-02F, -1.534345001e-01F, -4.030468762e-01F, 2.344274670e-01F, 4.424310848e-02F, 1.955644339e-01F,
+    -6.927205324e-01F, -8.921848238e-02F, -3.747603670e-02F, -6.205899715e-01F, 3.048754930e-01F, 7.754681110e-01F, -5.621415749e-02F, -2.782900818e-02F,
+    -9.461692572e-01F, 1.282192022e-01F, -1.708676517e-01F, 5.874268338e-02F, -2.661957871e-03F, -8.916305900e-01F, -2.457911819e-01F, 1.314555556e-01F,
+    -4.892556667e-01F, 5.758523345e-01F, -2.970550954e-01F, -1.422186941e-01F, 2.180408500e-02F, 4.204241335e-01F, 4.142728746e-01F, -2.508330047e-01F,
+    3.344258666e-01F, 2.484581172e-01F, 4.134623706e-01F, -4.931027889e-01F, -8.189733028e-01F, 8.132828027e-02F, 4.265740514e-01F, 4.840782881e-01F,
+    3.454597294e-02F, 3.439805210e-01F, 9.739916772e-02F, -9.259786457e-02F, 4.549592733e-01F, -1.515353024e-01F, -2.884688079e-01F, 1.597177386e-01F,
+    -2.299557179e-01F, -1.091449380e+00F, 2.003527433e-01F, -4.218060076e-01F, -3.672607839e-01F, 8.683530092e-01F, -3.625608385e-01F, 7.786202431e-01F,
+    8.231130987e-02F, 4.220277965e-01F, -6.989197135e-01F, 5.686523914e-01F, 3.207346657e-03F, -5.425615981e-02F, -4.508187771e-01F, -1.262506992e-01F,
+    -1.812489033e-01F, 6.887434423e-02F, 1.050924361e-01F, -1.298460364e-01F, -1.009240672e-01F, 1.152658835e-01F, -9.343761951e-02F, 1.580678076e-01F,
+    -3.336356580e-01F, 3.749025986e-02F, 2.770130932e-01F, 9.677188396e-01F, 6.314276159e-02F, -3.982226923e-02F, -6.949862838e-01F, 5.480819196e-02F,
+    -1.947902560e+00F, 2.636417449e-01F, 4.361606836e-01F, -1.502995729e+00F, 6.034153104e-01F, -1.984739423e+00F, -2.177809775e-01F, -1.377647638e+00F,
+    -5.402584672e-01F, -1.041703895e-01F, -2.457996011e-01F, 1.452065408e-01F, -4.546292424e-01F, 7.533281296e-02F, 3.743815422e-01F, 4.281464815e-01F,
+    6.868278384e-01F, -4.184264839e-01F, 1.761786938e-01F, -1.177405939e-01F, 5.254514813e-01F, -3.656416237e-01F, -2.193975210e+00F, 5.498508215e-01F,
+    7.540702820e-03F, -5.325800776e-01F, 3.704557568e-02F, 8.465069532e-02F, -1.253421426e+00F, -8.524519801e-01F, 5.933949947e-01F, -2.704823017e-01F,
+    1.641718089e-03F, 2.193786502e-01F, 1.401497517e-02F, -6.857456267e-02F, -2.429869920e-01F, -4.621660709e-01F, -1.527431011e+00F, -8.870027959e-02F,
+    4.111922383e-01F, -1.130325720e-01F, -1.198015332e+00F, -4.498066604e-01F, 3.014887273e-01F, -1.145231605e+00F, -9.602184892e-01F, -3.787174821e-02F,
+    2.354043424e-01F, 2.956624627e-01F, -5.363444239e-02F, -1.408799052e+00F, 1.669842452e-01F, 2.741563618e-01F, -5.242932439e-01F, 6.496561766e-01F,
+    -1.556695849e-01F, -7.968695760e-01F, 4.470474273e-02F, -1.433620214e+00F, -5.780916214e-01F, 5.202941895e-01F, 6.799427420e-02F, 3.186563551e-01F,
+    2.149645388e-01F, -5.036544800e-01F, 6.279124320e-02F, -1.195760489e+00F, -1.817445159e-01F, 7.992760092e-02F, -5.035706758e-01F, 4.503766000e-01F,
+    1.216542572e-01F, 3.337788284e-01F, 5.844485480e-03F, -3.133799434e-01F, 2.569174170e-01F, -2.184056044e-01F, 8.267040849e-01F, -4.806703329e-01F,
+};
+
+alignas(64) static float const ntm_aot_layer_1_biases[64] = {
+    -4.424528182e-01F, -1.161535010e-01F, -2.345684730e-02F, 3.906802833e-02F, 1.814740747e-01F, -7.051622961e-03F, -2.615508735e-01F, 7.701093704e-02F,
+    -1.445789188e-01F, -3.871458173e-01F, -3.939954340e-01F, 4.636290297e-02F, -5.247661471e-01F, -2.675586939e-01F, -3.491945565e-01F, -2.645522058e-01F,
+    1.648032069e-01F, -1.002048925e-01F, -4.042498395e-02F, 9.072498977e-02F, 1.879564486e-02F, -3.350248337e-01F, -7.998505235e-02F, -6.510598212e-02F,
+    2.049827129e-01F, 3.871729970e-01F, 5.615625996e-03F, 1.028684676e-01F, -4.253793359e-01F, -6.410177052e-02F, 1.715697348e-02F, -1.081264988e-01F,
+    -1.421111971e-01F, -2.904973365e-02F, 1.431256831e-01F, 1.011704933e-02F, 7.233784348e-02F, -6.212276593e-02F, -2.633432746e-01F, -2.164353877e-01F,
+    -3.601418734e-01F, 2.984534390e-02F, -2.382690609e-01F, -1.028417721e-01F, -1.998345703e-01F, -1.483372301e-01F, -4.212950468e-01F, -2.564718425e-01F,
+    -2.476764023e-01F, -3.087999225e-01F, -1.542768180e-01F, -4.768634588e-02F, -2.268023491e-01F, -4.754551947e-01F, -3.305282891e-01F, -1.945793778e-01F,
+    -1.242323294e-01F, 2.611497641e-01F, 8.034069836e-02F, -3.179830015e-01F, -2.535689771e-01F, -1.876645684e-01F, 3.916637972e-02F, 2.255049944e-01F,
+};
+
+static inline void ntm_aot_layer_1(float const *in_activations, float *out_activations)
+{
+    // outputs [0, 8)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_1_biases[0]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_1_biases[1]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_1_biases[2]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_1_biases[3]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_1_biases[4]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_1_biases[5]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_1_biases[6]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_1_biases[7]);
+
+        float const *const panel_weights = ntm_aot_layer_1_weights + 0U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 0U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 1U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 2U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 3U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 4U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 5U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 6U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 7U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [8, 16)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_1_biases[8]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_1_biases[9]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_1_biases[10]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_1_biases[11]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_1_biases[12]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_1_biases[13]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_1_biases[14]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_1_biases[15]);
+
+        float const *const panel_weights = ntm_aot_layer_1_weights + 512U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 8U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 9U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 10U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 11U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 12U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 13U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 14U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 15U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [16, 24)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_1_biases[16]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_1_biases[17]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_1_biases[18]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_1_biases[19]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_1_biases[20]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_1_biases[21]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_1_biases[22]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_1_biases[23]);
+
+        float const *const panel_weights = ntm_aot_layer_1_weights + 1024U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 16U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 17U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 18U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 19U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 20U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 21U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 22U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 23U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [24, 32)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_1_biases[24]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_1_biases[25]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_1_biases[26]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_1_biases[27]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_1_biases[28]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_1_biases[29]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_1_biases[30]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_1_biases[31]);
+
+        float const *const panel_weights = ntm_aot_layer_1_weights + 1536U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 24U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 25U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 26U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 27U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 28U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 29U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 30U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 31U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [32, 40)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_1_biases[32]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_1_biases[33]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_1_biases[34]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_1_biases[35]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_1_biases[36]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_1_biases[37]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_1_biases[38]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_1_biases[39]);
+
+        float const *const panel_weights = ntm_aot_layer_1_weights + 2048U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 32U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 33U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 34U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 35U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 36U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 37U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 38U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 39U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [40, 48)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_1_biases[40]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_1_biases[41]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_1_biases[42]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_1_biases[43]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_1_biases[44]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_1_biases[45]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_1_biases[46]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_1_biases[47]);
+
+        float const *const panel_weights = ntm_aot_layer_1_weights + 2560U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 40U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 41U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 42U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 43U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 44U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 45U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 46U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 47U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [48, 56)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_1_biases[48]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_1_biases[49]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_1_biases[50]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_1_biases[51]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_1_biases[52]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_1_biases[53]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_1_biases[54]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_1_biases[55]);
+
+        float const *const panel_weights = ntm_aot_layer_1_weights + 3072U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 48U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 49U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 50U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 51U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 52U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 53U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 54U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 55U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [56, 64)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_1_biases[56]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_1_biases[57]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_1_biases[58]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_1_biases[59]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_1_biases[60]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_1_biases[61]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_1_biases[62]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_1_biases[63]);
+
+        float const *const panel_weights = ntm_aot_layer_1_weights + 3584U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 56U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 57U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 58U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 59U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 60U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 61U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 62U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 63U, ntm_aot_relu(accumulator_7));
+    }
+}
+
+// 64 x 64 (relu)
+alignas(64) static float const ntm_aot_layer_2_weights[4096] = {
+    8.269820362e-02F, 1.699730307e-01F, -3.382658362e-01F, 7.177793384e-01F, -3.838643804e-02F, 4.009878933e-01F, -7.940802574e-01F, 3.630654812e-01F,
+    1.953309923e-01F, 6.223161519e-02F, -4.707828909e-02F, -2.439218611e-01F, -2.118227482e-01F, 9.518475831e-02F, -2.033879608e-02F, 1.504590362e-01F,
+    -1.843925565e-01F, 1.116108447e-01F, 1.062454581e-01F, 6.784968376e-01F, -1.623333842e-01F, -7.596816421e-01F, 3.474797308e-01F, -7.156975567e-02F,
+    1.161825880e-01F, -1.259938776e-01F, -3.889077902e-01F, -4.417437613e-01F, -1.812185198e-01F, 4.902880192e-01F, -2.524182796e-01F, -2.553846836e-01F,
+    7.486727238e-01F, 6.814164668e-02F, -6.414505839e-01F, -6.529338360e-01F, -2.152726948e-01F, 1.529149413e-01F, 6.721079350e-02F, -2.813691795e-01F,
+    6.027921662e-02F, -7.869563997e-02F, 2.419763654e-01F, -8.329295367e-02F, -2.259151489e-01F, 1.176316440e-01F, -1.703976989e-01F, 6.225050986e-02F,
+    5.323712155e-02F, 2.012388706e-01F, 3.381581604e-01F, -4.872178435e-01F, -3.297986984e-01F, -2.583474517e-01F, 7.124603540e-02F, 1.186026540e-02F,
+    5.335486531e-01F, 3.068265617e-01F, -2.043554634e-01F, 5.697347522e-01F, -1.076746464e+00F, -1.127580881e+00F, -1.218776703e+00F, -1.576692015e-01F,
+    -8.993154168e-01F, 2.590894103e-01F, 1.501653045e-01F, 3.946150839e-01F, -2.965887189e-01F, -6.412789226e-02F, -8.973624110e-01F, -2.490148544e-01F,
+    3.508779109e-01F, -4.104188979e-01F, -4.294466376e-01F, -7.141112685e-01F, -2.739086151e-01F, -4.628051221e-01F, -9.749212861e-01F, -9.138152003e-02F,
+    3.666779697e-01F, 2.595535479e-02F, 5.534588099e-01F, 4.866077006e-01F, -3.047122061e-01F, -5.185990781e-02F, -1.034641147e+00F, 2.509157956e-01F,
+    2.077910006e-01F, -9.978991002e-02F, -3.688119352e-01F, -9.728822112e-02F, -9.915503860e-01F, -1.927711219e-01F, -5.124328136e-01F, 2.543428540e-01F,
+    2.437434942e-01F, -4.534965158e-01F, -5.060609579e-01F, 1.120154262e+00F, -8.073086143e-01F, -6.434218884e-01F, -9.377140999e-01F, -1.573577076e-01F,
+    -1.168603376e-01F, 4.895637557e-02F, 6.604526639e-01F, -2.557324767e-01F, -1.624677926e-01F, 2.088619769e-01F, -2.535666823e-01F, 2.457316071e-01F,
+    -5.532468557e-01F, 1.754455566e-01F, 2.434049249e-01F, -3.611076623e-02F, -9.918895960e-01F, 5.741595626e-01F, -1.413031101e+00F, 1.286394596e+00F,
+    5.625966191e-01F, 2.564195730e-02F, -4.153979197e-02F, 4.818440080e-01F, -3.634167016e-01F, -1.340094209e-01F, -3.577411473e-01F, 3.581713438e-01F,
+    -1.616159230e-01F, -1.508447975e-01F, -5.581899881e-01F, 2.357829511e-01F, -8.061190248e-01F, 2.737209797e-01F, 4.922447503e-01F, -1.608049273e+00F,
+    -3.951481879e-01F, -3.435550630e-01F, 1.950581521e-01F, -8.925614357e-01F, -6.216567755e-01F, 3.182097077e-01F, -1.077856541e+00F, -3.795788884e-01F,
+    3.625558615e-01F, -1.930774897e-01F, 1.298207790e-01F, -6.812952161e-01F, -1.333206445e-01F, 2.120415866e-01F, -4.959805608e-01F, 6.449249387e-01F,
+    3.940570727e-02F, -1.870543361e-01F, -1.373237252e+00F, -7.249603868e-01F, 5.779132992e-02F, -5.588501692e-01F, -4.817146659e-01F, -7.260969281e-01F,
+    -4.001977667e-02F, -3.616660833e-03F, -5.255948380e-02F, -5.564600825e-01F, -5.139322877e-01F, -6.082587242e-01F, 5.453881025e-01F, 4.321056604e-01F,
+    1.262883469e-02F, -1.911882907e-01F, 1.844696552e-01F, 3.427050114e-01F, -3.741115034e-01F, 5.728314444e-02F, -3.524667919e-01F, -7.953503728e-02F,
+    -5.356278270e-02F, 4.625306278e-02F, 5.845875144e-01F, 1.380050331e-01F, 1.515699625e-01F, -1.006302953e+00F, -4.676648676e-01F, -6.008344889e-01F,
+    -1.191444620e-01F, 1.536756754e-04F, -7.776478888e-04F, 1.594241858e-01F, -1.074037775e-01F, -1.226712465e-01F, 7.582636923e-02F, 1.792137772e-01F,
+    4.630148709e-01F, -1.172651276e-01F, 3.081039488e-01F, 1.022652313e-01F, 6.756748557e-01F, -6.584359407e-01F, -1.517071873e-01F, -7.906900048e-01F,
+    3.931069970e-01F, 4.753759131e-02F, -4.631735384e-02F, -6.244940162e-01F, -1.570069641e-01F, -2.909786813e-02F, -1.796168685e-01F, -1.750194728e-01F,
+    4.897713661e-01F, -3.013273478e-01F, -9.112234712e-01F, -1.860203385e+00F, 1.293794625e-02F, -1.957090616e+00F, 2.642989624e-03F, 9.732730985e-01F,
+    -1.675834954e-01F, -1.166582853e-01F, -2.698082030e-01F, 7.695302367e-02F, 7.116268277e-01F, -1.257011592e-01F, 1.867340058e-01F, -2.896356583e-01F,
+    4.560254887e-02F, 3.720846772e-02F, -2.107857764e-01F, -2.298015505e-01F, -1.233499169e+00F, 4.280043542e-01F, -2.894769311e-01F, -7.896510959e-01F,
+    -3.233811557e-01F, -1.780745685e-01F, -8.472989500e-02F, -3.366754055e-01F, -6.296078563e-01F, 8.130064011e-01F, -1.055755615e+00F, 1.329097301e-01F,
+    -3.372349739e-01F, 1.368435025e-01F, -3.486096263e-01F, 5.351977348e-01F, -1.615432501e-01F, -1.074007079e-01F, -1.437910199e-01F, 6.288490891e-01F,
+    1.295633763e-01F, -2.151684090e-02F, 1.215732023e-01F, -2.682038955e-02F, 4.475660324e-01F, -3.117192388e-01F, 2.928009927e-01F, 4.226770103e-01F,
+    -1.067005992e-01F, 1.205325276e-01F, -1.601031125e-01F, 2.843521535e-01F, 1.467870921e-01F, 1.047834009e-01F, 1.660821401e-02F, -8.776511252e-02F,
+    1.540892273e-01F, 1.349408180e-01F, -1.094936356e-01F, 2.566914447e-02F, 3.430117965e-01F, -1.871577501e+00F, -1.802916408e+00F, 2.134352773e-01F,
+    6.604099870e-01F, -1.486966908e-01F, 1.334662586e-01F, -1.890554726e-01F, 5.497964621e-01F, -1.280909497e-02F, -5.496422648e-01F, -1.759765595e-01F,
+    -1.008497953e+00F, 8.839804679e-02F, 2.124964893e-01F, -5.663818121e-01F, -6.896907091e-01F, 7.833894342e-02F, 9.070447683e-01F, -2.942309678e-01F,
+    7.508761436e-02F, -1.281349957e-01F, -1.961247176e-01F, 4.438662231e-01F, -9.387431741e-01F, -1.240589917e-01F, -9.692216516e-01F, -2.942021787e-01F,
+    -9.762540460e-01F, -4.424787760e-01F, -1.412744820e-01F, -4.194771349e-01F, -2.096964419e-01F, -3.225687146e-01F, 1.570785940e-01F, -3.841826320e-01F,
+    -8.093920946e-01F, 3.011261225e-01F, 3.847684264e-01F, 7.684744149e-02F, -1.879084468e+00F, -1.085236147e-01F, 2.194507718e-01F, 1.186306551e-01F,
+    1.795045733e-01F, -1.364425123e-01F, -5.467334390e-02F, 4.774128497e-01F, 5.240231752e-01F, 7.220836878e-01F, 1.154677719e-01F, 1.201897636e-01F,
+    2.446921021e-01F, -7.839309052e-03F, -1.271260142e+00F, 4.932003319e-01F, -1.776613593e+00F, -4.723160267e-01F, -4.031696618e-01F, -1.111359477e+00F,
+    5.044426024e-02F, -3.434345424e-01F, -4.673165977e-01F, 4.521921575e-01F, -2.600872993e+00F, -5.271168947e-01F, -9.535775781e-01F, -1.137423635e+00F,
+    -7.455568761e-02F, 2.742381394e-01F, -9.917563945e-02F, -1.232811734e-01F, -1.270395219e-01F, 3.833591640e-01F, -2.728348374e-01F, -4.868430495e-01F,
+    -1.549941182e+00F, -1.133710146e-01F, 2.845037878e-01F, 3.798900917e-02F, 5.672944188e-01F, 5.780479312e-01F, 1.750908643e-01F, -4.900044203e-02F,
+    8.397608250e-02F, -2.361770123e-01F, 7.761566639e-01F, -4.881244302e-01F, 1.638301015e-01F, 1.805669665e-01F, -1.316347718e-01F, -1.289233863e-01F,
+    1.268794984e-01F, 3.879562393e-02F, 5.788279232e-03F, -2.167880237e-01F, -3.575385213e-01F, 2.684473693e-01F, -2.233009100e+00F, -1.627363712e-01F,
+    -1.871487498e-01F, -4.189793766e-01F, -1.835948378e-01F, 1.870453358e-01F, 7.911124825e-02F, -7.793612313e-03F, 1.726417057e-02F, -2.678722441e-01F,
+    1.625176072e-01F, -4.752175510e-01F, -3.566394746e-02F, 4.098637104e-01F, 4.292874038e-01F, 9.506175518e-01F, -6.663258672e-01F, 2.466057390e-01F,
+    -2.450509742e-02F, -6.592997909e-02F, 1.264990121e-01F, -1.364153177e-01F, 1.523920596e-01F, -6.033484340e-01F, -1.650842875e-01F, -1.152206302e+00F,
+    8.017081618e-01F, -3.465212584e-01F, -3.364656866e-01F, 5.353857949e-02F, -1.955301315e-01F, 4.330123663e-01F, 4.782105237e-02F, 1.881954521e-01F,
+    2.162564173e-02F, -9.470421076e-02F, 3.177519888e-02F, 2.129024118e-01F, 5.320835710e-01F, -9.459400177e-02F, -5.558111668e-01F, -9.187680483e-01F,
+    4.232877865e-02F, -6.460955366e-03F, -6.852585077e-02F, -7.644997239e-01F, 6.121634319e-02F, -2.698229626e-03F, 2.144425362e-01F, 4.978871346e-01F,
+    8.844960481e-02F, -8.867406845e-01F, -5.939760208e-01F, 2.321480587e-02F, 5.783103406e-02F, 6.138027832e-02F, -1.137345076e+00F, 2.480344772e-01F,
+    -3.484489024e-01F, -4.266641438e-01F, 1.307675987e-01F, 6.205581427e-01F, -5.728136301e-01F, 3.695518374e-01F, 3.080818355e-01F, 7.238724828e-01F,
+    -9.322302938e-01F, -3.705715239e-01F, 4.573728144e-01F, 5.132962018e-02F, -3.054893576e-02F, 2.447476834e-01F, -1.905885991e-03F, -2.092446685e-01F,
+    -2.824713588e-01F, 2.011006325e-01F, 1.336871535e-01F, 1.947378740e-02F, -8.450365067e-01F, -3.330507874e-01F, -8.874335289e-01F, -1.826591641e-01F,
+    -1.442175031e+00F, -1.745632738e-01F, 3.149770796e-01F, 4.516485631e-01F, 4.273075163e-01F, 4.146878049e-02F, 1.604440361e-01F, 3.029089272e-01F,
+    -2.864589095e-01F, -6.625877619e-01F, -2.151295394e-01F, 1.877039969e-01F, -5.510173440e-01F, -1.895382442e-02F, -1.280971169e-01F, -9.054158330e-01F,
+    -2.076636404e-01F, -4.051069021e-01F, -1.148507819e-01F, 4.248754308e-02F, -1.881774962e-01F, -6.696377397e-01F, -9.009077400e-02F, -3.679271042e-01F,
+    -1.055382639e-01F, 1.025896296e-01F, 3.056071401e-01F, 3.176570833e-01F, 6.311812401e-01F, -7.234956026e-01F, -5.160958171e-01F, -1.159223557e+00F,
+    3.981567323e-01F, -3.807425499e-01F, 1.860712916e-01F, 2.992174625e-01F, -5.894323587e-01F, 1.968656927e-01F, -1.468426466e+00F, 5.164013505e-01F,
+    1.891055852e-01F, 1.464100331e-01F, 2.451329865e-02F, -4.856752455e-01F, -9.254907966e-01F, -5.475230217e-01F, 2.461476624e-01F, 1.022196785e-01F,
+    -4.142442644e-01F, -5.725014582e-02F, -9.329037666e-01F, 3.041369617e-01F, -5.210860372e-01F, -8.759971708e-02F, -1.137236118e+00F, -1.305759907e+00F,
+    -3.447633684e-01F, -5.500535369e-01F, -3.598587513e-01F, 3.742003143e-01F, 3.386644423e-01F, -1.485523343e+00F, 3.952488601e-01F, 4.192181826e-01F,
+    4.943362251e-02F, 1.541777253e-01F, 1.419931501e-01F, 7.216057181e-02F, 2.699206471e-01F, -1.471704096e-01F, -3.369894326e-01F, 6.918492913e-02F,
+    -1.758853346e-01F, -9.011092782e-02F, 5.562864244e-02F, -1.557557732e-01F, 2.926054969e-02F, 2.304627895e-01F, 2.819966339e-02F, -2.008380592e-01F,
+    6.494136527e-03F, 1.739518195e-01F, -1.132831164e-02F, -9.401428699e-01F, -1.025970340e+00F, 2.936001122e-01F, -1.056690693e+00F, -1.864299923e-01F,
+    4.868464172e-01F, 1.916247457e-01F, 2.852889597e-01F, -1.102825180e-01F, -6.382517219e-01F, -2.400550991e-01F, 2.517736256e-01F, -1.203363538e+00F,
+    1.361665279e-01F, -1.122176573e-01F, -2.760398686e-01F, -8.444641829e-01F, -4.129027724e-01F, 4.021022916e-01F, -3.075299561e-01F, -8.584793806e-01F,
+    2.070016861e-01F, -2.447663695e-01F, 1.126707196e-01F, -1.346603483e-01F, 2.433128506e-01F, -1.164473653e+00F, -2.339487374e-01F, -8.181212544e-01F,
+    -1.047642604e-01F, -2.754994668e-02F, 2.185029387e-01F, -4.484913349e-01F, -7.212626189e-02F, -5.734882355e-01F, 1.748731136e-01F, 1.507104784e-01F,
+    -3.677037656e-01F, -9.451182485e-01F, 8.701524884e-02F, -3.659183085e-01F, -1.589266807e-01F, -5.164701343e-01F, 1.313840747e-01F, -8.273049593e-01F,
+    3.180806637e-01F, 5.976126790e-01F, 4.264827669e-01F, 6.128993034e-01F, -1.434141677e-02F, 9.253288805e-02F, -6.164976954e-01F, -6.317357719e-02F,
+    -3.203555346e-01F, 3.315086365e-01F, 4.270487726e-01F, 1.873082966e-01F, -2.766462564e-01F, -6.837962195e-03F, 4.188587666e-01F, 2.028331906e-01F,
+    7.285305858e-01F, -1.332289815e+00F, -3.276116252e-01F, 6.239049602e-03F, -1.443859786e-01F, -3.343517184e-01F, -1.374152184e+00F, 2.360584438e-01F,
+    2.187517285e-01F, -7.786279917e-02F, 1.815828867e-02F, -6.942886114e-01F, 3.960353732e-01F, 5.392227173e-01F, -1.300376058e+00F, -1.214304805e+00F,
+    -9.445879459e-01F, -9.256142378e-01F, -3.643052578e-01F, -1.237361073e+00F, -3.630560338e-01F, -7.677899003e-01F, 2.775926590e-01F, -8.129830956e-01F,
+    1.430196166e-01F, 1.456956714e-01F, -2.319419533e-01F, 9.762015194e-02F, 3.813450336e-01F, 2.592702806e-01F, -9.734930396e-01F, 3.474895060e-01F,
+    -2.129079401e-01F, -6.680303216e-01F, -1.161528099e-02F, -4.220334440e-02F, 8.456750512e-01F, 4.058703482e-01F, -3.872835636e-01F, -1.579490155e-01F,
+    -3.637146056e-01F, 4.270523489e-01F, 3.601371944e-01F, 6.552146673e-01F, -2.888120711e-01F, 1.082236469e-01F, -1.605955362e-01F, -8.243373036e-02F,
+    -6.397444755e-02F, -5.641368628e-01F, 1.395697445e-01F, 2.617410123e-01F, 2.732760906e-01F, 4.141151011e-01F, -2.355193198e-01F, -6.782387495e-01F,
+    -1.744308695e-02F, 2.731156349e-01F, -2.717595920e-02F, -4.589186013e-01F, -1.472836137e-01F, 6.264387965e-01F, 6.854106188e-01F, 5.828492343e-02F,
+    7.161473483e-02F, -7.940553874e-02F, -2.894991338e-01F, 3.931221366e-01F, 2.068205625e-01F, -3.498101234e-01F, 1.493446529e-01F, -1.230184078e+00F,
+    -1.132017136e+00F, -2.542078868e-02F, -1.702447832e-01F, -5.666338801e-01F, 1.176166013e-01F, 1.660365015e-01F, 3.968938589e-01F, 1.919760257e-01F,
+    -2.493691742e-01F, 3.641501367e-01F, 4.544197619e-01F, 1.799280196e-01F, -6.206615567e-01F, 1.273511946e-01F, 1.441155672e-01F, 3.867869377e-01F,
+    -8.371277153e-02F, -1.461063027e+00F, -4.448202550e-01F, 6.234771013e-01F, 3.807680905e-01F, -4.198893309e-01F, 2.025686353e-01F, 1.196378917e-01F,
+    -2.882632315e-01F, 6.225298643e-01F, 8.145141602e-01F, -1.568125725e+00F, -4.700541794e-01F, 4.092141986e-01F, 3.252707720e-01F, 2.888401784e-02F,
+    4.136490077e-02F, 1.953433901e-01F, -8.711659908e-02F, -2.162220329e-01F, -1.908079721e-02F, 2.551980130e-02F, 1.883461773e-01F, -5.442824960e-02F,
+    -9.945334792e-01F, 2.447055429e-01F, -3.876124620e-01F, -7.553127408e-02F, -2.498733252e-02F, -3.018024564e-01F, -2.797021568e-01F, 5.735200047e-01F,
+    -3.854728043e-01F, -3.785563409e-01F, -7.696794271e-01F, -8.409096599e-01F, -2.686954439e-01F, -2.523253560e-01F, -3.148969412e-01F, -4.262330234e-01F,
+    -1.462065339e+00F, -3.417364657e-01F, -2.074468881e-01F, -3.434711993e-01F, 3.854651749e-01F, -6.423460692e-02F, 1.647550017e-01F, 1.113207459e+00F,
+    -8.706253767e-01F, 3.325104415e-01F, -1.063166745e-02F, 2.126821727e-01F, 4.094513506e-02F, -6.239935756e-01F, 4.803815186e-01F, 1.865939982e-02F,
+    -1.629894674e-01F, -6.641175747e-01F, -2.722528530e-03F, -3.095805347e-01F, 2.707660496e-01F, 2.310371250e-01F, -1.769565195e-01F, 3.491644859e-01F,
+    5.046638250e-01F, -3.380742669e-01F, 4.440246522e-02F, -5.147623420e-01F, -9.650049806e-01F, -2.221427858e-01F, 1.401351094e-01F, 2.167806327e-01F,
+    4.060020149e-01F, -2.891682386e-01F, 7.389885783e-01F, -2.108870298e-01F, 2.097018659e-01F, -4.934428930e-01F, 5.473304391e-01F, -1.679524034e-01F,
+    2.533659711e-02F, -4.429298937e-01F, 7.931204140e-02F, -7.609716058e-01F, 5.801976323e-01F, 1.019608080e-01F, -4.154883027e-01F, -1.642148793e-01F,
+    7.376998663e-02F, -1.012035981e-01F, -7.300554961e-02F, -2.093076557e-01F, 1.627135724e-01F, -5.979982018e-02F, -7.307137549e-02F, -1.980524361e-01F,
+    5.284744874e-02F, 2.606906891e-01F, -7.529078722e-01F, -4.943428934e-01F, -2.335955501e-01F, -4.194239080e-01F, -3.841615841e-02F, 2.794795334e-01F,
+    2.947718203e-01F, 4.530761242e-01F, 4.317690134e-01F, -2.643492520e-01F, -5.529952049e-01F, -1.015038013e+00F, -2.819864154e-01F, -3.773769140e-01F,
+    8.659315109e-02F, -3.815298378e-01F, -4.677822292e-01F, -6.357493401e-01F, -1.096630394e-01F, -3.527461290e-01F, -5.531156659e-01F, -5.008968115e-01F,
+    2.405828685e-01F, 3.441555500e-01F, -8.126748353e-02F, -3.145145178e-01F, 9.660952538e-02F, 1.209936216e-01F, -4.642861485e-01F, 4.249046147e-01F,
+    6.135570407e-01F, 4.165584445e-01F, -1.708228886e-01F, 1.283618659e-01F, -1.673473269e-01F, 1.827749461e-01F, 2.049780786e-01F, -3.743054867e-01F,
+    -7.952224612e-01F, 2.968653738e-01F, 4.469760358e-01F, -1.711108685e+00F, -1.619715542e-01F, 4.932057858e-01F, -4.596697092e-01F, -3.319576979e-01F,
+    -5.484647751e-01F, -5.734974742e-01F, 4.000724554e-01F, -1.061462879e+00F, 4.573303886e-05F, -2.083386928e-01F, -3.906041086e-01F, -8.112908602e-01F,
+    5.947331786e-01F, -8.890165091e-01F, -9.935129881e-01F, -1.218612418e-01F, 6.595698595e-01F, -1.395929337e+00F, 7.029455900e-01F, -3.369587660e-02F,
+    -5.401482582e-01F, 2.534618974e-01F, -4.221503735e-01F, 2.095201761e-01F, 1.483424306e-01F, -4.530264437e-01F, -4.944991469e-01F, -2.922195792e-01F,
+    4.926359653e-01F, -6.243657470e-01F, 2.738851905e-01F, 4.264592528e-01F, -2.296089530e-01F, -1.021903828e-01F, 4.529025555e-01F, 2.778849006e-01F,
+    -2.529490590e-01F, 3.431970626e-02F, -1.063821793e+00F, 8.565710187e-01F, -1.053484827e-01F, -1.129404187e+00F, 5.283287764e-01F, -3.990455568e-01F,
+    -7.693200707e-01F, -9.713125415e-03F, 3.708103299e-01F, -8.886598982e-03F, -3.650004864e-01F, 1.515145749e-01F, -4.962005652e-03F, -7.478637993e-02F,
+    2.128352523e-01F, 3.907755315e-01F, -4.475438595e-02F, -4.754215851e-02F, -2.340168506e-02F, -1.376634836e+00F, -4.334180653e-01F, -1.307290196e+00F,
+    -4.151585400e-01F, 3.470069170e-01F, -3.650383651e-01F, -2.025383115e-01F, 2.326938510e-01F, 3.496983945e-01F, 1.493096203e-01F, 1.323269159e-01F,
+    -6.733324528e-01F, -2.266056240e-01F, 5.541053787e-02F, -1.876770705e-01F, 2.293386497e-02F, -1.036386415e-01F, -1.053155139e-01F, -2.406265885e-01F,
+    -2.773974538e-01F, 2.988259196e-01F, -3.119313419e-01F, 3.032399714e-01F, 2.619940639e-01F, 3.666688204e-01F, -7.151371837e-01F, -5.483706594e-01F,
+    -7.992428541e-01F, 8.581813425e-02F, 1.183276698e-01F, 4.097378850e-01F, 1.333148032e-01F, 5.627019703e-02F, 3.245971724e-02F, 3.986222744e-01F,
+    2.008453906e-01F, 7.507908344e-02F, -4.111507237e-01F, -8.838809729e-01F, 1.566763967e-02F, -4.157305229e-03F, -4.127399921e-01F, 1.462659985e-01F,
+    -8.315102458e-01F, -1.197022051e-01F, -6.807345152e-01F, 3.541348279e-01F, 3.009729683e-01F, -4.418159425e-01F, 1.014138460e-01F, -2.928518057e-01F,
+    -8.310719728e-01F, -1.978236139e-01F, -8.285323381e-01F, -1.275067568e+00F, -1.852784157e-01F, -4.154363573e-01F, 1.817132831e-01F, 4.593648612e-01F,
+    -6.347612143e-01F, -1.414548606e-01F, 1.574608982e-01F, -4.915741384e-01F, 1.493438333e-01F, -1.715467453e+00F, 3.039392233e-01F, -2.370967120e-01F,
+    3.459789455e-01F, -2.126197666e-01F, 4.458212852e-01F, 4.111870378e-02F, 6.873141974e-02F, 4.615097940e-01F, -2.748125494e-01F, -1.791736484e-01F,
+    1.255168021e-01F, 8.410925418e-02F, 3.158968389e-01F, -9.156724811e-01F, 6.918109655e-01F, 1.357182860e-01F, 4.301399589e-01F, -3.347322047e-01F,
+    5.145151019e-01F, 3.427885473e-01F, 6.887288094e-01F, 3.607649207e-01F, -1.179687232e-01F, -1.805270612e-01F, -8.465170860e-02F, -1.179358289e-01F,
+    2.580628693e-01F, -4.971849173e-02F, -1.532747447e-01F, -4.228244722e-01F, -5.605664477e-02F, -3.831350207e-01F, -5.859589577e-01F, -7.992432714e-01F,
+    -9.553492665e-01F, -1.448227912e-01F, -7.010675669e-01F, -2.448251396e-01F, -2.572213709e-01F, 1.494179964e-01F, -5.355523229e-01F, 5.341601968e-01F,
+    -1.210915670e-01F, 3.508964479e-01F, 1.066579103e+00F, -3.348649740e-01F, -5.969910622e-01F, 1.711754203e-01F, 8.597435355e-01F, -1.340387225e+00F,
+    7.238177955e-02F, 1.853158772e-01F, 2.781085670e-01F, 5.050333738e-01F, -4.368539527e-02F, 3.471788168e-01F, -3.575988710e-01F, 6.107084155e-01F,
+    5.444929004e-01F, 2.142302245e-01F, -2.685699463e-01F, -5.356300473e-01F, -7.999644279e-01F, -4.234293103e-01F, -2.005701661e-01F, 1.832021922e-01F,
+    -1.683521271e-02F, -7.997427583e-01F, 1.313158274e-01F, 7.885689288e-02F, -1.450702071e+00F, 9.110812545e-01F, -7.315618452e-03F, -1.238788009e+00F,
+    -6.612924933e-01F, 1.468144357e-01F, -6.548795700e-01F, -1.087120846e-01F, -2.302202210e-02F, 5.345788598e-01F, -1.320219338e-01F, -1.180167869e-01F,
+    1.816350073e-01F, 8.696905971e-01F, -2.303912193e-01F, -4.066073298e-01F, 3.781490624e-01F, -2.660891786e-02F, -8.126647472e-01F, 6.761880964e-02F,
+    1.409666091e-01F, -1.419218034e-01F, 1.086370945e-01F, 7.138426602e-02F, 1.114431471e-01F, -1.967602968e-01F, -2.957691550e-01F, -3.726968169e-02F,
+    -3.104021549e-01F, 3.706675721e-03F, -6.964151263e-01F, -4.011158645e-01F, -3.252588212e-01F, 1.859508008e-01F, -9.374202490e-01F, -2.659199527e-03F,
+    -8.644844294e-01F, -2.508423626e-01F, -3.405855298e-01F, 2.096001208e-01F, 1.082177088e-01F, 4.787328243e-01F, -1.377357602e+00F, -3.805766106e-01F,
+    2.659966946e-01F, 5.847938657e-01F, -1.615775675e-01F, 1.315574944e-01F, -1.767556667e-01F, -9.640169144e-02F, 4.413496852e-01F, -2.142342925e-01F,
+    -4.934941828e-01F, -1.938680261e-01F, -8.281061649e-01F, 3.599797785e-01F, 4.769833386e-01F, -3.688355982e-01F, 4.299446940e-01F, 3.972635269e-01F,
+    2.999079823e-01F, 3.003005385e-01F, 1.229608133e-01F, 4.238199890e-01F, 1.185797080e-01F, 2.716415524e-01F, 1.100718305e-01F, -8.981221914e-01F,
+    1.347687989e-01F, -7.640800476e-01F, 1.006905317e+00F, 3.543326557e-01F, -2.580516934e-01F, -1.733866632e-01F, -1.292260528e+00F, 1.014398575e+00F,
+    -1.647487760e+00F, -1.345391721e-01F, -1.506039202e-01F, -3.457782418e-02F, -8.109798282e-02F, 1.928659678e-01F, -2.128434554e-02F, 3.314720392e-01F,
+    -5.424467325e-01F, -1.788382232e-01F, -3.054455817e-01F, -1.004823074e-01F, 2.088813037e-01F, 5.457298085e-02F, -1.241979077e-01F, -2.625264525e-01F,
+    3.436200321e-01F, -2.570759654e-01F, -3.463989794e-01F, -3.076015711e-01F, 2.175990492e-01F, -1.691607237e-01F, 2.041559219e-01F, 4.368667901e-01F,
+    5.621828437e-01F, 4.076655209e-01F, -8.773543239e-01F, 2.922838088e-03F, 2.167980969e-01F, 3.848353773e-02F, -9.331514835e-01F, 5.737326667e-02F,
+    4.302773774e-01F, -6.795228720e-01F, -2.543954611e+00F, 1.070931852e-01F, -4.955398142e-01F, 1.526381820e-01F, 1.856143028e-01F, -1.705173403e-01F,
+    -5.843008310e-02F, 1.545906663e-01F, -8.954167962e-01F, 1.852440536e-01F, -1.339434683e-01F, 2.058563232e-01F, -4.191450477e-01F, -9.451290965e-01F,
+    4.622391760e-01F, -6.669869423e-01F, 6.462139487e-01F, 4.638715088e-01F, 1.863366961e-01F, 9.379969835e-01F, -1.402726293e+00F, -6.545957923e-02F,
+    -1.091170311e+00F, -1.118636131e+00F, -7.519158125e-01F, -2.236884534e-01F, 8.358409628e-03F, 2.052591294e-01F, 9.081884027e-01F, -1.106783748e-01F,
+    -8.197185397e-02F, -2.203408629e-01F, 5.264945030e-01F, -4.156530276e-02F, -1.456430316e+00F, 6.534705758e-01F, 1.622426212e-01F, 9.928145409e-01F,
+    -8.852382898e-01F, -8.345877528e-01F, -1.984068274e+00F, 2.140082121e-01F, 2.379149646e-01F, 2.411880195e-01F, 3.360348940e-01F, 4.479590431e-02F,
+    -5.539460778e-01F, -1.498295069e+00F, 4.666931033e-01F, 2.762742937e-01F, 2.807563730e-02F, -1.517721359e-02F, 6.909946203e-01F, 4.108878374e-01F,
+    4.820554703e-02F, -7.463814616e-01F, -4.087262452e-01F, -8.441699147e-01F, -9.214530885e-02F, -4.389881492e-01F, 1.112651825e-01F, -7.906738669e-02F,
+    9.824039042e-02F, -5.630849600e-01F, -4.960119724e-01F, 2.582376003e-01F, -1.024471819e-01F, -6.633685231e-01F, -1.248166189e-01F, -9.750925004e-02F,
+    3.424257934e-01F, -1.619046181e-01F, -4.220913351e-01F, 2.050592303e-01F, 2.925535142e-01F, -4.232345223e-01F, 7.334735245e-02F, -5.499804616e-01F,
+    -1.116433814e-01F, -7.902067304e-01F, -1.632417440e+00F, -7.974822521e-01F, 3.952991068e-01F, -4.196929038e-01F, 2.624097168e-01F, -2.943185866e-01F,
+    9.897059761e-03F, 6.317491829e-02F, 9.751380980e-02F, -1.557928026e-01F, -9.790400416e-02F, 9.944070876e-02F, -1.174735092e-02F, -1.958508193e-01F,
+    6.603335589e-02F, 2.597364783e-01F, -9.097315073e-01F, 3.133380711e-01F, -5.899174213e-01F, 3.150978386e-01F, -5.749332905e-01F, -8.500389457e-01F,
+    -1.362314671e-01F, -6.802041531e-01F, -1.313676238e-01F, 1.940783672e-02F, 1.252455860e-01F, -2.217333317e-01F, 6.332046539e-02F, -6.531172991e-01F,
+    -3.757373691e-01F, -3.894594312e-01F, 9.119137377e-02F, -4.286558032e-01F, -2.791992426e-01F, 4.491373301e-01F, -2.242028415e-01F, -1.217093706e+00F,
+    -2.134772092e-01F, -1.789285839e-01F, 3.318753839e-01F, 1.866254359e-01F, 2.796099484e-01F, -2.839856744e-01F, 4.996257722e-01F, -7.408764362e-01F,
+    7.153926790e-02F, -3.052956164e-01F, 2.217017114e-01F, -3.905102015e-01F, -2.549032867e-01F, -4.493995011e-02F, -4.565860927e-01F, 2.010878623e-01F,
+    -7.027645707e-01F, -2.759851813e-01F, -4.150029123e-01F, -4.516915083e-01F, -2.533870637e-01F, -1.173238993e+00F, 3.997807801e-01F, 3.146212995e-01F,
+    -1.798651218e+00F, 8.270590901e-01F, -8.292726278e-01F, -1.006686091e-01F, -2.551058829e-01F, 5.604914427e-01F, 3.770264685e-01F, -1.507046700e+00F,
+    1.597226784e-02F, -1.541402787e-01F, -5.616350770e-01F, 1.098781358e-02F, 4.705713689e-02F, 1.253339499e-01F, -7.170958072e-02F, -2.452502847e-01F,
+    2.581871860e-02F, 4.298539832e-02F, 8.134488761e-02F, -1.080693826e-01F, -8.339087665e-02F, -1.794309169e-01F, -1.812098175e-01F, 1.315396875e-01F,
+    2.355121523e-01F, 5.683120713e-02F, -3.534414470e-01F, 2.133452594e-01F, -1.643607765e-01F, 5.990184471e-02F, -1.477320194e-01F, -1.474087000e+00F,
+    1.593189836e-01F, -4.685558677e-01F, -9.299423099e-01F, 1.961397938e-02F, 2.822507024e-01F, -1.874682605e-01F, -4.439430833e-01F, -4.587984979e-01F,
+    -2.492049634e-01F, 2.644304633e-01F, 1.422240734e-01F, -8.799431473e-02F, -8.714814670e-03F, 5.354254246e-01F, 2.434721440e-01F, 3.224938735e-02F,
+    -8.214673996e-01F, -6.379477978e-01F, 2.797280848e-01F, 2.011035830e-01F, 2.444550991e-01F, 1.831897944e-01F, -5.196692944e-01F, -3.287778795e-01F,
+    -1.008303612e-01F, 1.069734618e-01F, -7.277232409e-01F, -3.938174546e-01F, -6.251406074e-01F, 2.740224898e-01F, -3.212905228e-01F, -9.218503833e-01F,
+    6.675086617e-01F, 1.311891675e-01F, 5.709720254e-01F, -2.846840918e-01F, 9.678701870e-03F, -2.568656802e-01F, -1.108313680e+00F, 9.311159849e-01F,
+    -1.272054166e-01F, 5.404888988e-01F, 4.703383446e-01F, -7.663948536e-01F, 6.099869013e-01F, -4.214926064e-01F, 4.643349946e-01F, 1.996162981e-01F,
+    -2.632860541e-01F, 5.609912276e-01F, 5.800716281e-01F, -2.192046791e-01F, -9.520720840e-01F, -6.858174205e-01F, 1.520050406e+00F, 8.619274497e-01F,
+    2.396416515e-01F, -1.003684402e-01F, 6.200101376e-01F, -4.507804215e-01F, 1.561438572e-02F, -1.921766102e-01F, -2.047538310e-01F, 4.831835032e-01F,
+    -3.439033628e-01F, -1.562675089e-02F, -4.912230670e-01F, 1.839950681e-01F, -1.945312619e-01F, 7.362117618e-02F, -1.212805063e-01F, 3.052837551e-01F,
+    5.989409238e-02F, -7.978071570e-01F, -5.459945202e-01F, -9.653254412e-03F, -1.647235602e-01F, -1.986667812e-01F, 2.843317389e-01F, -1.523990482e-01F,
+    3.751534224e-01F, -4.089626670e-01F, -2.460590303e-01F, 4.513624310e-01F, -2.194381952e-01F, 2.871048152e-01F, -1.287425637e+00F, 3.170612752e-01F,
+    -4.377360940e-01F, 2.147202492e-01F, -3.169375062e-01F, 2.765233517e-01F, -1.415063906e-02F, -5.588948727e-01F, -1.916732043e-01F, -6.598848701e-01F,
+    8.778116703e-01F, -9.227125049e-01F, 3.908509314e-01F, -3.908348829e-02F, -7.687483430e-01F, -3.944399059e-01F, 1.610414684e-01F, 1.016230345e+00F,
+    -3.370299637e-01F, -1.239831686e+00F, 3.937424421e-01F, 2.373437732e-01F, -2.082592100e-01F, -3.570115864e-01F, 8.534532189e-01F, 5.042824745e-01F,
+    3.532001078e-01F, 6.878993511e-01F, -2.352459878e-01F, -9.575474262e-02F, 5.775843263e-01F, 2.656067014e-01F, -6.059169173e-01F, 3.706878796e-02F,
+    5.885018706e-01F, -3.722607791e-01F, -1.994319081e+00F, 2.070598602e-01F, 1.054094285e-01F, 2.907657325e-01F, -3.542521894e-01F, 1.274443418e-01F,
+    -5.998684168e-01F, 1.198681295e-01F, -1.037946105e+00F, 1.776943803e-01F, 4.506542087e-01F, 1.310113221e-01F, -9.462991357e-01F, -1.839961857e-01F,
+    -6.427408457e-01F, -1.802395731e-01F, -5.441096425e-01F, -8.278904855e-02F, -5.120197535e-01F, 4.659382701e-01F, 7.337433100e-01F, 9.700739384e-02F,
+    4.327806234e-01F, -4.337215424e-01F, -1.278469618e-02F, 6.896564155e-04F, 1.742157191e-01F, 1.298593730e-01F, -3.053787723e-02F, 3.472372890e-01F,
+    5.083509088e-01F, -4.409447312e-02F, -5.016488433e-01F, -8.706760406e-01F, -2.382677943e-01F, -2.658707798e-01F, -2.381756455e-01F, -7.927922606e-01F,
+    -6.917182207e-01F, -2.479154170e-01F, -8.420807719e-01F, -2.504470758e-02F, 5.057048798e-01F, 4.685324430e-01F, -1.834223270e-01F, 4.757062793e-01F,
+    -1.823332310e-01F, -4.278127253e-01F, 3.184768856e-01F, -7.714062929e-02F, 8.808897808e-03F, -1.694373190e-01F, 1.328209639e-01F, -1.112203822e-01F,
+    -7.475019693e-01F, -1.677331477e-01F, 2.814303339e-01F, 4.404146671e-01F, -8.230481297e-02F, 4.592364728e-01F, -7.545408607e-01F, -2.721428871e-01F,
+    -1.454564184e-01F, -1.899323612e-01F, -4.839131832e-01F, 3.967250586e-01F, -5.284718424e-02F, -3.736787438e-01F, 5.957929492e-01F, -2.681804001e-01F,
+    -1.601223201e-01F, 1.022352576e-01F, 5.606632829e-01F, -3.913117349e-01F, -5.908918977e-01F, 3.367014229e-01F, -7.483807206e-01F, -4.369615018e-01F,
+    9.493807554e-01F, -5.676726997e-02F, 2.700775862e-01F, -2.435717434e-01F, -2.152309716e-01F, 1.217290461e-01F, 1.271177530e-01F, 2.989827394e-01F,
+    -8.701186776e-01F, -9.445819855e-01F, -1.654877186e+00F, -3.384130774e-03F, 3.323918283e-01F, 3.944210410e-01F, 4.342573583e-01F, -6.899206638e-01F,
+    1.439966112e-01F, -7.643879652e-01F, -3.588606417e-01F, -1.020448804e+00F, 4.685450792e-01F, 3.655430079e-01F, -7.200557590e-01F, -5.832953751e-02F,
+    5.796774626e-01F, 2.891087234e-01F, 2.600864768e-01F, -2.197615802e-01F, -2.659093142e-01F, -9.052566886e-01F, 6.677401066e-02F, 1.366993338e-01F,
+    -6.705951691e-01F, -2.010999471e-01F, 2.601689845e-02F, 5.762511492e-02F, -1.887148172e-01F, 4.413047805e-02F, -2.428840399e-01F, -1.332752705e+00F,
+    -1.739339471e+00F, -2.094953656e-01F, -4.169391468e-02F, -6.529596448e-01F, 1.274684966e-01F, -6.614641547e-01F, -3.948470056e-01F, -5.415413380e-01F,
+    5.178711191e-02F, 1.186062172e-01F, -9.195350856e-02F, -2.086538821e-01F, 3.954697028e-02F, 1.756432932e-03F, -1.008112505e-01F, -3.749301657e-02F,
+    2.374266237e-01F, -1.710618138e-01F, -1.704055220e-01F, -1.104207277e+00F, -7.023099065e-01F, -3.660900295e-01F, -1.310727000e+00F, -7.055898309e-01F,
+    -2.249245048e-01F, -1.820071936e-01F, -3.297126889e-01F, -1.710119545e-01F, -1.670020074e-01F, 9.888879955e-02F, 2.980333753e-02F, -2.213646472e-01F,
+    -1.636582494e+00F, -7.859163284e-01F, 1.573136449e-01F, 5.467078686e-01F, -1.302420944e-01F, -1.013062373e-01F, -4.179106057e-01F, -4.815928638e-03F,
+    -1.096530482e-01F, -1.637417316e+00F, -4.375938326e-02F, 3.047384024e-01F, 2.176500708e-01F, 7.532128692e-02F, 2.741243839e-01F, 4.482348859e-01F,
+    4.613466188e-02F, 8.504186571e-02F, 4.381709918e-02F, -1.723587364e-01F, -1.258786798e+00F, 1.197149232e-01F, -1.596033454e+00F, -2.012262940e-01F,
+    1.547971219e-01F, -1.766584516e+00F, 3.862176463e-02F, -1.595450044e+00F, 5.961266533e-02F, -6.016146541e-01F, 2.784855366e-01F, 1.642175764e-02F,
+    3.545702696e-01F, 2.073455602e-01F, -2.692291141e-02F, -2.012163401e+00F, 5.301186442e-01F, -3.767216206e-02F, 1.057168692e-01F, 5.246748924e-01F,
+    -7.644476742e-02F, 3.016669452e-01F, -2.458051033e-02F, -9.447821975e-01F, -4.281477928e-01F, 3.629099950e-02F, 6.764587760e-01F, -1.317377090e-01F,
+    -9.979878664e-01F, 1.929543018e-01F, -1.971887648e-01F, -2.734344900e-01F, -1.118321270e-01F, 1.610796452e-01F, 1.041172594e-01F, -2.533478141e-01F,
+    -3.045080602e-01F, 5.458315015e-01F, -1.376335025e-01F, 6.261754036e-01F, -2.453600466e-01F, 1.217156053e-01F, 5.603740215e-01F, 2.635069750e-02F,
+    -8.072814941e-01F, -4.425608218e-01F, -1.687664539e-02F, 2.760809660e-01F, 3.709351420e-01F, -4.468336701e-01F, 6.812568307e-01F, -2.534204960e+00F,
+    -2.599989772e-01F, -7.861025333e-01F, -1.438821405e-01F, -6.328333914e-02F, 5.130437016e-01F, 1.335802078e-01F, -4.806513488e-01F, -5.792009234e-01F,
+    -8.504431844e-01F, 4.064704478e-01F, 4.089552909e-02F, 5.311526060e-01F, 2.946842313e-01F, -2.997967303e-01F, -9.094043076e-02F, 3.918696940e-01F,
+    1.834207773e-02F, 2.906277478e-01F, -7.802890241e-02F, -6.776210070e-01F, -2.113547087e+00F, -2.107592523e-01F, -4.933004975e-01F, -5.704144239e-01F,
+    -1.034004986e-01F, -8.258442879e-01F, -1.061097011e-01F, -1.097048998e+00F, 5.073542595e-01F, -3.261015713e-01F, 2.357043922e-01F, -7.503103018e-01F,
+    2.301452011e-01F, 4.435740411e-01F, 2.111197822e-02F, -1.227216274e-01F, 4.751927853e-01F, -1.036155105e+00F, -2.246793061e-01F, 4.130150974e-01F,
+    -7.399765309e-03F, 6.384027600e-01F, 5.599205196e-02F, 9.684575349e-02F, -8.291319013e-01F, 5.717478395e-01F, -3.243141472e-01F, 3.018281758e-01F,
+    1.624346823e-01F, 2.304045856e-02F, -2.670352161e-01F, -2.160676382e-02F, -3.053668514e-02F, 1.066253521e-02F, 3.546956182e-02F, 4.227818549e-02F,
+    -8.546303026e-03F, 2.047366463e-02F, -1.256465167e-01F, -4.195581079e-01F, -3.024456277e-02F, 3.601379991e-01F, -2.830981910e-01F, -8.306819201e-01F,
+    -5.202740431e-01F, -1.807625055e+00F, -1.658380032e-01F, -3.570780158e-01F, -4.339105189e-01F, -2.074552476e-01F, -1.009497046e-01F, -2.310256809e-01F,
+    5.797718838e-02F, -1.229132295e+00F, 8.332984149e-02F, -1.346771419e-01F, -1.991946220e+00F, -2.424597442e-01F, -1.335510731e+00F, 8.698883653e-01F,
+    4.610374570e-02F, -1.470954418e-01F, -1.595135033e-01F, 1.313429922e-01F, 5.203201994e-02F, 1.848973781e-01F, 7.734481245e-02F, -1.012339145e-01F,
+    1.503121555e-01F, -1.256123185e-01F, 8.303940296e-03F, 2.441285700e-01F, 1.461075395e-01F, 2.401802689e-01F, 5.101005435e-01F, -1.420534372e+00F,
+    -4.891962409e-01F, -1.222732902e+00F, -2.636561990e-01F, -5.502974391e-01F, 2.972486019e-01F, -3.624704480e-01F, -2.356883049e+00F, -2.537615970e-02F,
+    1.367723227e+00F, 9.322460890e-01F, 5.172926560e-02F, -1.097526073e+00F, -7.582652569e-01F, -3.657547235e-01F, 2.748594582e-01F, 6.264618039e-01F,
+    -5.698600411e-01F, -9.776926786e-02F, -1.051707566e-01F, -5.046307668e-02F, -7.738571167e-01F, -4.952050447e-01F, -6.728069186e-01F, 5.893076062e-01F,
+    -2.610857487e-01F, -1.444177151e+00F, 1.358347684e-01F, -1.225678682e+00F, 2.590051293e-01F, -1.428189576e-01F, 2.496153265e-01F, 1.213439927e-01F,
+    -8.491143584e-01F, 8.184365183e-02F, -2.052848786e-01F, -7.203722000e-01F, 4.175442755e-01F, -1.299840093e+00F, 5.473752618e-01F, 6.380292177e-01F,
+    8.303065896e-01F, 6.961167455e-01F, -1.159564257e-01F, -1.302809119e+00F, -3.101777732e-01F, 2.615498900e-01F, -1.781502962e-01F, -1.005971193e+00F,
+    5.476700887e-02F, -4.849960506e-01F, -1.602609456e-01F, -4.761825502e-01F, 6.690924615e-02F, 2.303575575e-01F, -1.381816715e-01F, 4.068570733e-01F,
+    8.476891369e-02F, 1.766790003e-01F, 1.970448792e-01F, -1.005910933e-01F, 6.899411231e-02F, 2.328008413e-02F, -2.306186594e-02F, 3.016599454e-02F,
+    -1.934189200e-01F, -2.047575116e-01F, -2.707966864e-01F, 4.597243667e-01F, -1.145428568e-01F, -1.628476568e-02F, 1.178819612e-01F, 4.390821755e-01F,
+    2.647858560e-01F, 3.665501475e-01F, -6.872150116e-03F, 2.734971344e-01F, 7.947895527e-01F, 6.925339252e-02F, -1.210753441e+00F, 2.214751840e-01F,
+    4.605386555e-01F, 6.749593019e-01F, -5.419774447e-03F, 4.166787267e-01F, -1.072796345e+00F, -4.309255183e-01F, -2.040350884e-01F, -5.834452063e-02F,
+    1.230018735e-01F, -8.449971676e-02F, -3.335500956e-01F, -1.070328474e+00F, 3.071881831e-01F, -7.725628018e-01F, -1.985927671e-01F, -4.490052164e-01F,
+    -9.166138172e-01F, -6.845113635e-01F, -1.538304985e-01F, 3.815854490e-01F, -8.274493366e-02F, -4.123019278e-01F, 7.719111443e-02F, 2.008013725e-01F,
+    -3.541869521e-01F, 7.494944930e-01F, -1.402403265e-01F, -1.472825766e+00F, -6.823566556e-01F, 1.601340920e-01F, -1.326496482e+00F, 6.223710999e-02F,
+    8.916697502e-01F, -1.000115871e-01F, -8.196050674e-02F, -1.420439601e+00F, 2.167911828e-01F, -1.660331041e-01F, -8.924533129e-01F, -5.434415936e-01F,
+    -4.298765957e-01F, -1.293542888e-02F, 1.421146560e-02F, 1.431360096e-01F, -6.964277625e-01F, -3.821016848e-01F, -1.709195226e-01F, -7.566943765e-02F,
+    -1.438253671e-01F, 3.200442791e-01F, -7.217746228e-02F, -9.916107059e-01F, -2.030594945e-01F, 3.698017597e-01F, 1.530731320e-01F, 3.906567097e-01F,
+    1.941410601e-01F, -9.489608407e-01F, 6.285679340e-02F, 1.375218779e-01F, 1.352492273e-01F, -2.225223184e-01F, 1.528115869e-01F, -3.224124610e-01F,
+    -2.465492487e-01F, 7.204669714e-01F, 1.304837316e-01F, -1.268106937e+00F, 1.235205382e-01F, 2.035624534e-01F, -1.107493997e+00F, -5.200010911e-02F,
+    -2.728329301e-01F, 1.777156591e-01F, -8.548283577e-02F, -4.459162354e-01F, -3.731236756e-01F, -1.894854456e-01F, -4.820642173e-01F, 3.071061373e-01F,
+    -7.008081675e-02F, -2.938426733e-01F, -1.813755333e-01F, -2.081317902e-01F, 3.170551360e-02F, 1.848064065e-01F, 3.648891449e-01F, -1.180097610e-01F,
+    -1.110646963e+00F, 2.039366961e-01F, -2.255969197e-01F, -4.746736884e-01F, -5.733023286e-01F, -2.874618471e-01F, -1.813440681e+00F, 3.645186126e-02F,
+    5.245945230e-02F, -4.543679357e-01F, 7.297347486e-02F, 3.981342912e-01F, -2.516028583e-01F, -1.859788150e-01F, -1.665108949e-01F, -6.956013441e-01F,
+    4.932967424e-01F, -1.218136430e+00F, 6.221429259e-02F, -5.046692491e-01F, -3.865611851e-01F, 7.601734251e-02F, 3.451394439e-01F, 6.685609221e-01F,
+    1.128352433e-01F, 8.024426699e-01F, -2.142087668e-01F, -2.015986204e+00F, -5.988563895e-01F, -3.014691472e-01F, -6.048954129e-01F, -5.067818165e-01F,
+    -2.266706377e-01F, -1.537575483e+00F, -2.482441813e-01F, 2.536752522e-01F, -2.132524699e-01F, 4.544118047e-01F, 2.105159014e-01F, 2.695448995e-01F,
+    -1.939639598e-01F, 3.931173980e-01F, -2.503948212e-01F, 4.505635202e-01F, -5.641936660e-01F, 6.166622043e-02F, -1.822755694e+00F, -1.121878400e-01F,
+    -9.494432211e-01F, 2.903716862e-01F, 7.789997011e-02F, 2.767215967e-01F, -1.426652193e+00F, -2.841501534e-01F, 3.352894261e-02F, 1.072807312e-01F,
+    8.714768291e-01F, -1.042809606e+00F, -1.447370350e-01F, 4.363119304e-01F, 1.613149643e-01F, 1.408310235e-01F, 4.335308671e-01F, 1.393789798e-01F,
+    5.192773342e-01F, -2.897284627e-01F, 5.851482973e-03F, -6.047852039e-01F, 4.507471919e-01F, 8.958628774e-02F, -3.099708557e-01F, -4.041007757e-01F,
+    1.239894107e-01F, -2.245157212e-01F, -7.250750065e-02F, 2.620576918e-01F, -8.816318959e-02F, 2.374389209e-02F, 3.786821067e-01F, 7.081487030e-02F,
+    8.198650926e-02F, -8.819825649e-01F, -2.990819141e-02F, -8.875172585e-02F, 2.378470264e-02F, -5.416283011e-01F, 2.014846802e-01F, 2.339721173e-01F,
+    3.068511188e-01F, -3.078334033e-01F, -2.286256552e-01F, -4.327348620e-02F, 9.139297158e-02F, 3.412984610e-01F, -9.278660268e-02F, 1.526696831e-01F,
+    5.619162694e-02F, -4.987131357e-01F, -5.093455315e-02F, 9.528849274e-02F, 1.042829081e-01F, 3.343614638e-01F, -1.029360890e+00F, 2.314090580e-01F,
+    1.047171950e+00F, -5.007752776e-01F, 1.210100800e-01F, -9.975308180e-01F, -2.197134972e+00F, 7.438899279e-01F, -2.105213851e-01F, -9.587341547e-02F,
+    -2.653138041e-01F, -1.258299470e+00F, -1.095820069e-01F, -1.292112619e-01F, -3.500661254e-01F, -5.928175449e-01F, 7.867560983e-01F, 3.492434919e-01F,
+    1.625273228e-01F, 5.000346899e-01F, -1.305743456e-01F, 5.546388030e-01F, 1.590479910e-01F, -4.745208621e-01F, -8.929054737e-01F, -5.425102711e-01F,
+    1.051444113e-01F, 2.458519191e-01F, 8.645345457e-03F, -7.648080587e-01F, -5.046402216e-01F, 9.146105498e-02F, 4.144468307e-01F, 1.388458014e-01F,
+    4.908007383e-02F, -3.807319701e-01F, -1.661864370e-01F, 2.642596886e-02F, -3.825829029e-01F, -9.714627638e-03F, 9.278347343e-02F, -3.310174942e-01F,
+    -1.237757206e+00F, -4.256795943e-01F, -3.969640434e-01F, -5.721288323e-01F, 5.657194182e-02F, 4.709836245e-01F, 4.791062176e-01F, -2.758396789e-02F,
+    4.817061499e-02F, 1.467440128e-01F, -1.230474487e-01F, 1.397386491e-01F, 6.423586607e-02F, 6.886488944e-02F, 1.872576177e-01F, -6.587319076e-02F,
+    -3.914541304e-01F, 3.069241643e-01F, -4.723994136e-01F, 9.861186147e-02F, -1.119474880e-02F, -1.664721608e+00F, -6.136704683e-01F, -5.156296492e-01F,
+    3.720130026e-01F, -8.947976679e-02F, -4.329010248e-01F, -5.343873501e-01F, -6.024954319e-01F, 2.713945210e-01F, 1.678041369e-01F, -1.581995748e-02F,
+    3.962709904e-01F, 2.086703032e-01F, 1.835916787e-01F, -3.561222553e-02F, 1.795793474e-01F, 7.018775344e-01F, 5.403317213e-01F, 4.337089881e-02F,
+    6.235051900e-02F, 7.264289260e-01F, -1.203062296e+00F, -3.545312211e-02F, -1.076870680e+00F, -3.347589448e-02F, -8.424411416e-01F, 1.424060017e-01F,
+    -1.300135851e-01F, -6.141020060e-01F, -1.084048375e-01F, -4.880646169e-01F, -4.727250934e-01F, 2.614272535e-01F, -1.298094392e+00F, 2.299922556e-01F,
+    -5.819205940e-02F, -3.997531235e-01F, 3.986772299e-01F, 4.221554101e-01F, -9.234776497e-01F, -7.060903907e-01F, -3.385964036e-02F, 3.423125148e-01F,
+    8.762603998e-02F, -7.944205403e-02F, -7.972390652e-01F, -4.116644263e-01F, -5.140753463e-02F, 1.309167743e-01F, -5.549764633e-01F, -1.650405377e-01F,
+    -7.973571420e-01F, 1.391303688e-01F, -1.846840382e+00F, -7.395241857e-01F, -1.473171949e+00F, -4.671056867e-01F, 5.438235998e-01F, -2.467224300e-01F,
+    -7.386171818e-01F, -3.623778224e-01F, 2.799443603e-01F, -1.450160891e-01F, -3.963854536e-02F, 2.979940474e-01F, -1.823825240e-01F, -2.091716051e+00F,
+    -1.515345216e+00F, 1.469923109e-01F, 1.521277875e-01F, 2.715665847e-02F, 4.473143220e-01F, -2.115876079e-01F, -1.123306274e+00F, -2.283348590e-01F,
+    -4.527524579e-04F, 2.018889636e-01F, -1.925142527e+00F, 2.096949816e-01F, -1.387889385e+00F, -2.853338718e-01F, -7.696930170e-01F, 3.239090145e-01F,
+    1.435650438e-01F, 4.761095345e-01F, -6.410693377e-02F, 1.565811969e-02F, -1.737124920e-01F, -7.716180682e-01F, -1.285816729e-01F, -5.723468065e-01F,
+    -9.970104694e-02F, 9.783113003e-02F, 6.761920452e-01F, 8.499803543e-01F, -8.283252716e-01F, 1.103289500e-01F, 2.025101632e-01F, 1.478929371e-01F,
+    9.817261696e-01F, 1.084580347e-01F, -7.918881178e-01F, 1.009615183e+00F, -2.852483273e+00F, 3.926827312e-01F, 9.430525303e-01F, -6.883463860e-01F,
+    -1.932343692e-01F, -6.912941337e-01F, -4.563236609e-02F, 8.027863503e-02F, -3.993644118e-01F, 4.694544077e-01F, 5.224111676e-01F, 6.255472302e-01F,
+    -1.025026321e+00F, -4.573582411e-01F, -3.797596693e-02F, -1.216508150e+00F, 1.723020822e-01F, -5.322112441e-01F, -1.086176652e-02F, -1.119858176e-01F,
+    -3.293473423e-01F, -5.676802993e-01F, 1.943940520e-01F, 7.759775519e-01F, -1.163822487e-01F, 2.691378891e-01F, 6.648731828e-01F, -1.416155845e-01F,
+    2.792093456e-01F, 2.105104625e-01F, 1.840497106e-01F, -1.125653312e-01F, 5.378594398e-01F, 4.465228915e-01F, 1.783906966e-01F, 1.142573506e-01F,
+    -5.629642606e-01F, 6.196897626e-01F, -2.631791122e-02F, 5.805557966e-02F, -5.496279597e-01F, -3.777923584e-01F, -7.724969387e-01F, 2.948484719e-01F,
+    -3.249089122e-01F, -2.640579641e-01F, 1.179550141e-01F, 5.171407461e-01F, -6.363777518e-01F, 3.513919413e-01F, 3.008669913e-01F, -5.767400861e-01F,
+    -9.451488853e-01F, 1.556621939e-01F, -1.686383486e+00F, 3.374767303e-01F, -5.987567902e-01F, 6.595633030e-01F, -5.988719314e-02F, -4.873612523e-01F,
+    -1.390779018e-01F, -6.578087807e-03F, 9.459342062e-02F, -1.355902553e-01F, 2.963473834e-02F, -1.945464686e-02F, 7.941158116e-02F, 5.939860642e-02F,
+    -1.501893163e+00F, -4.967299104e-01F, 9.276364744e-02F, -5.473337173e-01F, 2.041798234e-01F, -3.559176624e-01F, 3.280079961e-01F, 2.681290805e-01F,
+    4.893552884e-02F, -4.380373061e-01F, 3.629305959e-02F, 3.423394859e-01F, -1.747057401e-02F, -5.232297778e-01F, -1.973200887e-01F, -1.537281722e-01F,
+    -9.885711670e-01F, 1.988798529e-01F, -4.086174369e-01F, 1.559765264e-02F, -1.286545247e-01F, 4.557004571e-01F, 3.980484307e-01F, 9.066697955e-01F,
+    1.574898809e-01F, 2.943380475e-01F, -6.899847090e-02F, -7.229624391e-01F, -5.253336430e-01F, 2.738871872e-01F, -1.079994559e+00F, 3.114785941e-04F,
+    2.279109508e-01F, 6.359044909e-01F, 2.621061802e-01F, 1.739749014e-01F, -2.118048444e-02F, -8.285209537e-01F, -8.136902004e-02F, 3.582830429e-01F,
+    -8.978605866e-01F, -1.135401368e+00F, 7.157760113e-02F, 2.941802442e-01F, 1.641757935e-01F, -4.134173989e-01F, -2.648252845e-01F, -2.058769763e-01F,
+    -4.782846570e-01F, 5.395807326e-02F, 9.399831295e-02F, -1.021605283e-01F, -6.506281495e-01F, 4.375362396e-01F, 8.768314123e-01F, 2.973829508e-01F,
+    -1.308671355e+00F, 2.467748672e-01F, -6.921391934e-02F, 2.895269394e-01F, -1.193668604e+00F, 2.996656857e-02F, -1.356088400e+00F, -8.064453602e-01F,
+    -8.385653794e-02F, -1.617897749e-01F, 6.555967033e-02F, -1.293845568e-02F, -1.118062586e-01F, 1.887716204e-01F, 1.071664765e-01F, 4.043698311e-02F,
+    -3.845168650e-02F, 4.319767281e-02F, 7.600013167e-02F, -9.911926836e-02F, -3.659443855e-01F, -7.741310596e-01F, 5.141184926e-01F, -1.017250061e+00F,
+    1.076430548e-02F, -9.478718042e-02F, -1.014101386e+00F, -1.538320333e-01F, 1.568995565e-01F, 4.579805434e-01F, 1.065258458e-01F, 7.872273214e-03F,
+    -3.806139529e-02F, 1.362693608e-01F, 5.416897535e-01F, -1.583181322e-01F, 3.803160191e-01F, -1.353615075e-01F, -1.552056432e+00F, 4.020648897e-01F,
+    -5.996394753e-01F, 4.353670478e-01F, -1.919028908e-01F, -1.342288852e+00F, 5.311749876e-02F, -1.190646052e+00F, -6.449931264e-01F, -5.366706252e-01F,
+    1.525983363e-01F, 1.535847634e-01F, 2.832866013e-01F, 3.639298975e-01F, 3.307996690e-01F, 3.728850484e-01F, -2.153490335e-01F, -2.005870640e-02F,
+    3.954393789e-02F, -2.606778033e-02F, -7.501668334e-01F, -5.011248589e-01F, 7.790963352e-02F, 2.140136212e-01F, -5.764892325e-02F, 1.063335776e+00F,
+    9.133152366e-01F, -8.256015182e-01F, 1.302115023e-01F, -1.638764739e-01F, -3.748708963e-02F, 1.696581542e-01F, -6.885322332e-01F, -2.100988626e+00F,
+    -1.733105816e-02F, -7.916796803e-01F, 1.956729144e-01F, -9.148678780e-01F, -7.027747631e-01F, -2.810215950e-01F, -1.440602899e+00F, 2.689456046e-01F,
+    4.297632277e-01F, -4.032091200e-01F, -3.116216697e-02F, 1.398787200e-01F, 2.087348998e-01F, -1.357970595e+00F, 2.178612202e-01F, 1.932485700e-01F,
+    3.816347718e-01F, -8.477947116e-01F, 4.294579625e-01F, 3.898665011e-01F, -3.433623016e-01F, -3.550437093e-01F, -1.975785375e+00F, -3.978646994e-01F,
+    -5.552391410e-01F, -1.547060311e-01F, -7.029889226e-01F, 1.596459150e-01F, -2.325950146e+00F, 5.432192683e-01F, -1.391681284e-01F, -7.336106896e-01F,
+    -9.293635488e-01F, 1.600864530e-01F, 3.268342912e-01F, -4.897642508e-02F, 8.583858013e-01F, 3.756617308e-01F, -4.099441469e-01F, -6.539943814e-02F,
+    -7.636293024e-02F, -3.128330708e-01F, -1.402215123e+00F, -9.466819167e-01F, -1.010742664e+00F, -9.638845921e-01F, 8.720842749e-02F, -4.657911956e-01F,
+    -2.066733122e+00F, 3.051821887e-01F, 1.483203322e-01F, 6.612411886e-02F, -6.970785856e-01F, 1.163553149e-01F, -3.935775161e-01F, -1.130908012e+00F,
+    -2.171545923e-01F, -2.044787854e-01F, 2.302617431e-01F, -9.415165335e-02F, -5.905845165e-01F, 4.206897318e-01F, -1.297995925e+00F, -8.242138624e-01F,
+    3.214116693e-01F, 1.002106518e-01F, 3.006630242e-01F, -7.932577729e-01F, -7.677686810e-01F, 1.963720471e-01F, 2.691231668e-01F, 8.002588749e-01F,
+    1.301575661e+00F, -5.561948419e-01F, -7.765680552e-01F, -2.540060692e-02F, 7.996096015e-01F, -3.783681393e-01F, -7.486006618e-02F, 2.010203451e-01F,
+    1.253896505e-01F, 4.471848905e-01F, -2.222641408e-01F, -5.734222531e-01F, 4.494791329e-01F, 1.875991076e-01F, -2.194537520e-01F, 7.191365957e-01F,
+    -3.507773578e-01F, -2.925170064e-01F, -4.670836031e-01F, -1.552012116e-01F, 2.315069288e-01F, -3.807108998e-01F, 4.481224418e-01F, 4.127037525e-01F,
+    4.793488383e-01F, 6.079410315e-01F, 5.112622976e-01F, 4.521774948e-01F, -8.841555119e-01F, -2.556772530e-01F, -3.815449178e-01F, 3.058630228e-01F,
+    -4.547023475e-01F, -7.772252560e-01F, 1.517224759e-01F, -4.024086893e-01F, -3.275762200e-01F, 7.270808816e-01F, 2.927539647e-01F, -1.039733410e+00F,
+    -9.036764503e-01F, -2.739821374e-01F, 2.426981777e-01F, -3.051672876e-01F, -3.573973477e-01F, -2.615931332e-01F, -2.686966658e+00F, -5.270001292e-01F,
+    2.618031204e-01F, -5.812010262e-03F, -5.560360476e-02F, -9.982394576e-01F, -6.136304736e-01F, 1.917170882e-01F, -4.480496347e-01F, 5.733418465e-01F,
+    -3.696474135e-01F, -2.849688530e-01F, -9.866269827e-01F, 7.171646357e-01F, -1.697311163e+00F, 4.034421220e-02F, -8.555833995e-02F, 1.262179762e-01F,
+    8.074008822e-01F, -4.240281582e-01F, 1.495269537e-01F, -1.173411250e+00F, -2.685323358e-01F, -3.019846380e-01F, -1.771132350e-01F, 9.114046395e-02F,
+    -4.699820280e-01F, 1.202587187e-01F, 4.612024128e-01F, -3.633701503e-01F, 1.181212813e-01F, -1.770702302e-01F, 1.994974539e-02F, -9.425480366e-01F,
+    1.831864864e-01F, -7.575659752e-01F, -4.710968435e-01F, 8.213813305e-01F, 6.531527638e-01F, -3.042291403e-01F, -1.031994894e-01F, -4.923159480e-01F,
+    4.998159707e-01F, 4.544041455e-01F, -5.578130484e-01F, 8.507355303e-02F, 5.354845524e-01F, -4.233469442e-02F, -8.970419168e-01F, -2.384274304e-01F,
+    -3.571821451e-01F, 3.667382896e-02F, 2.781114876e-01F, 6.491672397e-01F, -3.037858307e-01F, -2.929698229e-01F, -1.577995718e-01F, -1.538052201e+00F,
+    -9.860927612e-02F, -6.072813869e-01F, -1.014239669e+00F, 1.324738115e-01F, 2.897689641e-01F, -1.304908097e-01F, 6.034346223e-01F, -1.308596849e+00F,
+    -2.547686398e-01F, -5.694757700e-01F, 1.716225296e-01F, -1.309147179e-01F, 3.220628500e-01F, -1.117969304e-01F, -4.111015424e-02F, 2.787173092e-01F,
+    -3.481241167e-01F, 2.393417358e-01F, -7.449691892e-01F, -2.554037869e-01F, -1.322669744e+00F, -2.522452772e-01F, 8.905929327e-02F, 3.185749352e-01F,
+    -4.336076975e-02F, 2.571669519e-01F, -4.447298497e-02F, 1.465132535e-01F, -2.767232992e-02F, -1.996224225e-01F, -7.327476051e-03F, 4.685388878e-02F,
+    -5.150634050e-01F, -2.145881206e-01F, 5.809569359e-01F, -2.927360535e-01F, 6.139017344e-01F, -2.684490681e-01F, -2.435873747e-01F, -7.837379575e-01F,
+    -9.245924652e-02F, -2.263317704e-01F, 1.580351442e-01F, 2.383770049e-01F, 2.253303528e-01F, 1.639456004e-01F, -1.531029791e-01F, 6.815448403e-01F,
+    2.918667197e-01F, -1.514290720e-01F, -5.787981749e-01F, -3.038215041e-01F, 5.601201653e-01F, -5.715634674e-02F, -1.309183240e-01F, -2.914792895e-01F,
+    -7.223295569e-01F, -2.206605971e-01F, -1.850879043e-01F, -5.811314583e-01F, -1.044660687e+00F, -5.163503885e-01F, 5.292735249e-02F, -1.491466165e-01F,
+    -6.162093878e-01F, 4.815725088e-01F, -3.251628876e-01F, 5.456795096e-01F, -8.598706722e-01F, -9.164662659e-02F, -3.481778502e-01F, -9.264417887e-01F,
+    -4.184717238e-01F, -6.529430859e-03F, -1.589241385e+00F, 2.278982252e-01F, -1.542003304e-01F, -6.007992029e-01F, 6.167292595e-02F, 5.134622455e-01F,
+    -1.179777026e+00F, -3.282921910e-01F, -2.263319641e-01F, 5.699684024e-01F, -8.885844350e-01F, -9.414227605e-01F, -1.846725792e-01F, -1.172106043e-01F,
+    1.250167261e-03F, -7.294518948e-01F, -2.472683974e-02F, -3.409376144e-01F, -2.079378814e-02F, -5.660670996e-01F, -1.797789186e-01F, -7.009293437e-01F,
+    -1.995345810e-03F, -2.871251702e-01F, -3.990723789e-01F, -7.383211255e-01F, -3.957479894e-01F, -4.431020319e-01F, -2.135875374e-01F, -4.099350274e-01F,
+    -9.006705880e-02F, 4.302856028e-01F, -6.136090755e-01F, -6.660059094e-02F, -1.554065198e-01F, -4.247238040e-01F, -8.924243599e-02F, 3.310237080e-02F,
+    5.011640191e-01F, 3.623388112e-01F, 5.952076912e-01F, 4.964209497e-01F, -6.736416221e-01F, -7.197448015e-01F, -1.271060705e-01F, -2.279983997e+00F,
+    1.607232541e-01F, 2.107554823e-01F, 8.334310353e-02F, -7.908955216e-01F, 1.885532439e-01F, 4.122024775e-01F, 7.582037896e-02F, 5.676443577e-01F,
+    -1.660885692e+00F, -5.550391078e-01F, -5.390517041e-02F, 5.680279136e-01F, -1.447569609e+00F, 7.484207749e-01F, -1.038562953e-01F, 1.095868707e+00F,
+    -1.000481769e-01F, 3.411643207e-01F, -2.262550890e-01F, 2.608833611e-01F, 1.741014570e-01F, -1.393671632e-01F, -1.242799778e-02F, -1.147099376e+00F,
+    1.811673641e-01F, 1.788043231e-01F, 4.244716763e-01F, 2.684247196e-01F, -9.561926126e-02F, 3.211998641e-01F, -1.493234634e-01F, 4.449074566e-01F,
+    -5.687066913e-01F, -3.745046556e-01F, -4.415139183e-02F, -1.667960733e-01F, 4.395219088e-01F, 3.465309143e-01F, -1.350414008e-01F, -5.826603174e-01F,
+    3.364256322e-01F, -3.413180709e-01F, 3.452819586e-01F, 2.617887855e-01F, 2.927554846e-01F, 6.597691216e-03F, -1.042361706e-01F, 2.323763669e-01F,
+    -3.335401714e-01F, 5.898001194e-01F, -1.210825920e+00F, -2.750287056e-01F, -2.668731809e-01F, 4.461710155e-01F, 2.898237668e-02F, 1.211759448e-01F,
+    -1.720057577e-01F, 3.336601257e-01F, 1.376276463e-01F, 4.055202603e-01F, -3.610655367e-01F, 1.143779010e-01F, -1.977974474e-01F, 1.047532335e-01F,
+    1.048753858e-01F, 3.761440217e-01F, 2.766220272e-01F, 4.718427062e-01F, -3.628327549e-01F, -2.788508236e-01F, -1.292761415e-01F, -2.870714664e-01F,
+    4.840642214e-02F, -6.777375340e-01F, 6.178185940e-01F, 7.338786870e-02F, 4.346561432e-01F, 4.233074188e-01F, 1.237692684e-01F, -4.349257350e-01F,
+    -5.267587304e-02F, -1.147423312e-01F, 6.607599556e-02F, 1.025225744e-01F, 3.657085588e-03F, -1.611118764e-01F, 3.573430702e-02F, -1.024677008e-01F,
+    1.731586158e-01F, 3.104922175e-01F, -8.355721086e-02F, -1.361220032e-01F, -3.847086728e-01F, 1.028112695e-01F, -4.075756297e-02F, -3.705095947e-01F,
+    -1.061143160e+00F, 1.619119942e-01F, -8.643206358e-01F, 1.241528243e-01F, 1.807996184e-01F, -8.389125578e-03F, -2.032696307e-01F, -1.496942043e+00F,
+    5.692923665e-01F, -1.331442237e+00F, -1.378310174e-01F, 4.568834603e-01F, -8.429067135e-01F, 9.426542372e-02F, -1.850186437e-01F, -5.597178936e-01F,
+    -1.041819096e+00F, -5.246071219e-01F, 1.973844320e-01F, 5.153790712e-01F, 3.285986483e-01F, 1.347788721e-01F, -1.326055229e-01F, -3.246854246e-01F,
+    -1.587455750e+00F, -5.687651634e-01F, -2.668533802e+00F, -8.461988568e-01F, -1.820321567e-02F, -3.008193374e-01F, 1.096492633e-01F, -2.015480548e-01F,
+    -7.727184892e-01F, -5.448297262e-01F, -4.822426140e-01F, 9.048267603e-01F, -2.459430546e-01F, 4.524075389e-01F, -2.617729595e-03F, 6.365264058e-01F,
+    6.089817733e-02F, 1.082684323e-01F, -5.203341842e-01F, 6.255994737e-02F, -3.495986462e-01F, -1.657330394e-01F, -1.148496568e-01F, -7.493088394e-02F,
+    4.387918413e-01F, -4.405615479e-02F, -1.007966325e-01F, 3.859372810e-02F, -1.021426264e-02F, -1.537264287e-01F, -3.515190184e-01F, 8.782504499e-02F,
+    -3.048282862e-02F, 5.937074497e-02F, 1.917458177e-01F, -3.560874984e-02F, 7.334668934e-02F, -9.537652880e-02F, -1.540794522e-01F, 7.307154685e-02F,
+    3.653979003e-01F, -2.622376382e-01F, -2.197097391e-01F, -9.594095945e-01F, -5.949339643e-02F, -2.536054552e-01F, -2.875303030e-01F, -6.938867569e-01F,
+    2.673317678e-03F, 3.278322518e-01F, -9.451214969e-02F, 1.664495170e-01F, -5.080077648e-01F, 2.515752614e-01F, 1.381129865e-02F, 2.832593024e-01F,
+    3.617471457e-01F, -4.431739450e-01F, -1.103473827e-02F, -6.568953395e-01F, -1.474449039e+00F, -1.103041992e-01F, -1.223954707e-01F, -4.605666697e-01F,
+    -5.731986165e-01F, 1.515001953e-01F, -1.169724911e-01F, 1.969806403e-01F, 1.746855378e-01F, 3.263238445e-02F, -8.263392001e-02F, -5.487607419e-02F,
+    -1.260439157e-01F, 5.600708723e-01F, 2.450793087e-01F, -3.146779239e-01F, -7.543734461e-02F, 2.491704002e-02F, -1.745051146e-01F, -1.044663489e-01F,
+    7.051119804e-01F, -1.653180569e-01F, 1.070070148e+00F, -4.944532737e-02F, -5.666476488e-01F, -5.123881698e-01F, 1.629044116e-01F, -8.620698452e-01F,
+    -1.501081824e+00F, -1.800828338e+00F, -6.072507426e-02F, -2.056158148e-02F, -1.049078107e-01F, -2.294717729e-01F, -1.596008092e-01F, -1.667690836e-02F,
+    -1.452673078e-01F, 8.320567608e-01F, 8.102503419e-01F, -2.883240879e-01F, -5.031110644e-01F, 2.599903345e-01F, -1.443787366e-01F, -4.551990032e-01F,
+    -8.925943077e-02F, 3.141520023e-01F, 1.940247267e-01F, -8.039651513e-01F, 5.984847546e-01F, -3.436641991e-01F, -1.058480963e-01F, -1.801825464e-01F,
+    -5.402416587e-01F, -1.070957780e-01F, -1.110388190e-01F, -7.874454260e-01F, -1.849411011e+00F, -7.742724847e-03F, 4.510651156e-02F, 2.199381143e-01F,
+    -3.791655600e-01F, -2.197130620e-01F, -1.194453478e+00F, -2.244467437e-01F, 7.895300984e-01F, 4.706864059e-02F, 6.377300620e-02F, 4.777948558e-02F,
+    7.923381031e-02F, -7.642055750e-01F, -2.731664293e-02F, 9.645088762e-02F, -3.496577442e-01F, 4.589204192e-01F, 6.228869408e-02F, -1.588097692e+00F,
+    1.770129800e-01F, 5.266500264e-02F, -1.129211426e+00F, 1.761857122e-01F, -2.877772152e-01F, 2.001186833e-02F, -1.801072657e-01F, 1.578893960e-01F,
+    2.357532978e-01F, -1.229138765e-02F, 1.630774885e-01F, -7.841286659e-01F, -7.587182522e-01F, -2.775621414e-01F, -2.183968127e-01F, -5.640898943e-01F,
+    -1.465194464e+00F, -1.214462668e-01F, -9.855934381e-01F, -5.958639383e-01F, -3.255794644e-01F, -1.110706925e+00F, 4.433687031e-02F, 5.051120520e-01F,
+    5.849006027e-02F, -6.385012865e-01F, 1.042349637e-01F, -2.269891798e-01F, -5.892001837e-02F, 4.888940454e-01F, 1.843228191e-02F, -1.882008433e+00F,
+    -1.855140477e-01F, -3.101682067e-01F, -3.553686142e-01F, -9.329797700e-03F, -8.104635477e-01F, -1.602312446e+00F, 4.290179536e-02F, 1.594980657e-01F,
+    -1.795217022e-02F, -4.837975800e-01F, -3.203984797e-01F, 8.124564588e-02F, 2.756901085e-01F, -1.665521860e-01F, -4.075239897e-01F, -4.413672686e-01F,
+    1.972382367e-01F, 1.922556944e-02F, 6.394125819e-01F, -5.363459587e-01F, 2.633591592e-01F, -5.198114514e-01F, -1.832072288e-01F, 3.975194991e-01F,
+    -2.524028420e-01F, -4.707907885e-02F, -3.921473920e-01F, -3.126005232e-01F, -5.241182446e-01F, 2.682459354e-01F, -1.593013108e-01F, 4.173616320e-02F,
+    1.408286691e-01F, -4.377065003e-01F, 5.069457889e-01F, 5.600356460e-01F, -4.183872640e-01F, -3.149705827e-01F, 3.736405820e-02F, -1.105129361e+00F,
+    2.432420254e-01F, -3.706581891e-01F, -6.353594065e-01F, 2.725743949e-01F, -5.235769972e-02F, -3.241837323e-01F, -8.541359752e-02F, -1.296886206e-01F,
+    -1.988787055e-01F, -2.806966901e-01F, -3.787712157e-01F, -5.702959895e-01F, 1.224528551e-01F, -6.149927974e-01F, -1.538213640e-01F, -1.554275304e-01F,
+    -6.005744934e-01F, 2.215624005e-01F, -1.250910163e+00F, 4.292165935e-01F, -1.225689411e+00F, -1.046321690e-01F, 5.471268296e-02F, -5.780949593e-01F,
+    4.781716168e-01F, 4.966838956e-01F, 4.266705215e-01F, -6.324023008e-02F, 6.385869980e-01F, -1.601350307e-01F, 1.472019870e-02F, -2.764596343e-01F,
+    -6.087131500e-01F, -6.380544305e-01F, -5.915269256e-01F, -3.920892775e-01F, 3.255037367e-01F, 1.834508628e-01F, -1.141531989e-01F, 3.782822937e-02F,
+    -3.692563474e-01F, 5.350588560e-01F, -4.360830784e-02F, -9.931211174e-02F, 1.064812064e+00F, 1.310158819e-01F, 6.136737391e-02F, 1.634913385e-01F,
+    3.809170425e-01F, -6.758199930e-01F, -2.880631447e+00F, 1.113513261e-01F, -9.300240278e-01F, -4.773956239e-01F, -7.165804505e-02F, -3.168182373e-01F,
+    -1.995940328e+00F, -6.386429667e-01F, 2.129390091e-01F, -7.579762936e-01F, 1.607569456e-01F, 5.144551024e-02F, -1.532012969e-01F, 1.371995211e-01F,
+    -6.997107863e-01F, -4.252988845e-02F, 3.419776559e-01F, 3.627581000e-01F, -3.807701170e-01F, 6.532244384e-02F, -2.494584769e-01F, 1.844068170e-01F,
+    4.395496547e-01F, 2.348740548e-01F, -1.731467247e+00F, 2.195855677e-01F, 3.930908144e-01F, 3.457316756e-01F, -1.790503860e-01F, -3.665888906e-01F,
+    5.177513361e-01F, 6.089077592e-01F, -1.837215126e-01F, 1.874478310e-01F, 7.419167459e-02F, 6.117396951e-01F, 9.789904580e-03F, 3.551830649e-01F,
+    1.460214704e-02F, -1.239960194e-01F, -2.105604559e-01F, -4.429734126e-02F, 4.674521089e-02F, -1.297774613e-01F, 2.103271633e-01F, 1.966639310e-01F,
+    1.938830763e-01F, -1.775876731e-01F, -1.762931496e-01F, -2.477055192e-01F, 1.367971748e-01F, 5.226289034e-01F, 2.632876933e-01F, -2.740499377e-01F,
+    1.835371554e-01F, 1.030313298e-01F, -1.691109687e-01F, -2.064507157e-01F, 2.830751538e-01F, -5.706799626e-01F, -1.868612617e-01F, -1.277059037e-02F,
+    -3.407647014e-01F, -4.207586497e-02F, 3.981615007e-01F, 1.271567345e-01F, -2.275578380e-01F, -1.296554599e-02F, -3.513736129e-01F, -1.707421988e-01F,
+    -2.521243989e-01F, -1.329707950e-01F, -2.298004031e-01F, -3.340715766e-01F, 6.149806976e-01F, -4.344636500e-01F, -4.156826735e-01F, 1.947921813e-01F,
+    -3.065411150e-01F, -2.179077864e-01F, -1.567501724e-01F, 5.077587068e-02F, 2.834278345e-01F, 5.742791295e-01F, -2.920154482e-02F, -1.882598847e-01F,
+    -7.167550325e-01F, -5.501572490e-01F, -2.646881044e-01F, -3.435751796e-01F, 2.186095566e-01F, -2.914906144e-01F, 1.401436925e-01F, -4.540390968e-01F,
+    -1.076311469e+00F, -2.211606801e-01F, -5.230869055e-01F, 9.357171506e-02F, -1.892004460e-01F, 2.269752473e-01F, 5.909578204e-01F, 8.697303385e-02F,
+    2.330945283e-01F, -5.360248089e-01F, 5.590459704e-01F, 5.018085837e-01F, -4.905473888e-01F, 3.597540557e-01F, 2.867113650e-01F, 5.326662213e-02F,
+    -4.884227812e-01F, -2.897029221e-01F, 2.651046515e-01F, 4.652921557e-01F, -5.996755362e-01F, 1.980485767e-01F, 1.821432561e-01F, -4.529724419e-01F,
+    -5.279308651e-03F, -7.408201694e-01F, -7.046379615e-03F, -4.404724836e-01F, -5.267570615e-01F, -6.024050117e-01F, 3.130362928e-01F, -1.760853827e-01F,
+    -3.748875856e-01F, -2.150883436e+00F, -4.949431121e-01F, 1.025250033e-01F, 2.213163078e-01F, -6.170402765e-01F, 2.690415382e-01F, 2.662114203e-01F,
+    5.312730074e-01F, -2.393546999e-01F, 7.727994025e-02F, -2.918741703e-01F, 2.877361327e-02F, -4.530411065e-01F, -2.815707028e-01F, -1.147168636e+00F,
+    -7.613992095e-01F, 8.916748762e-01F, -1.793173142e-02F, -7.333396077e-01F, 2.119663544e-02F, 6.326290965e-01F, 4.419603646e-01F, -6.533876061e-01F,
+    -9.743981361e-01F, 1.556616277e-01F, -4.256995618e-01F, 2.779244781e-01F, 5.871806145e-01F, 7.067899704e-01F, 7.855187654e-01F, -1.093223505e-02F,
+    -1.198970437e+00F, -1.205424666e+00F, -7.794707268e-02F, -4.575735033e-01F, 6.303479671e-01F, -1.103827238e+00F, -1.057168990e-01F, 8.898530155e-02F,
+    1.626454294e-01F, 5.101004243e-01F, 1.453302801e-01F, 1.232666075e-01F, 2.536353469e-01F, -5.256560072e-02F, -1.728022099e-01F, 8.625694364e-02F,
+    7.545751333e-01F, 1.645509005e-01F, 3.744664788e-01F, 1.102092043e-01F, -2.415026724e-01F, 1.269411296e-01F, -2.446777932e-02F, 3.650058806e-01F,
+    -2.335462272e-01F, -3.033756651e-02F, -8.378446847e-02F, 2.327832580e-01F, 1.570888311e-01F, -2.476926334e-02F, -4.442496598e-01F, -1.330510974e-01F,
+    -6.544916332e-02F, 1.449752972e-02F, -2.694267929e-01F, 7.775559276e-02F, -2.276399136e-01F, -1.134435058e+00F, -2.708656527e-02F, -4.197564125e-01F,
+    -2.850193381e-01F, 9.183578193e-02F, -3.522039354e-01F, 5.393329859e-01F, -2.463566959e-01F, -6.839448214e-01F, -1.335571855e-01F, -1.597537547e-01F,
+    -1.045187354e+00F, 1.791844517e-01F, 1.791234016e-01F, -9.385249019e-02F, 1.300119609e-01F, -1.095823050e+00F, -1.181359738e-01F, -1.164512277e+00F,
+    1.302821636e-01F, -6.283870339e-02F, -8.707708865e-02F, 3.402972594e-02F, -5.906070396e-02F, -3.432598338e-02F, -8.959320188e-02F, 5.633631349e-02F,
+    -1.024961352e+00F, 2.212626301e-02F, -6.601090077e-03F, -8.083801717e-03F, 2.392266691e-01F, -4.525504634e-02F, -7.691265941e-01F, 1.627265103e-02F,
+    -1.144375920e+00F, -1.475693583e-01F, 4.073928893e-01F, 1.051306799e-01F, 5.545996130e-03F, -1.404625177e-01F, -2.367200702e-01F, 3.481636047e-01F,
+    4.241799116e-01F, 9.816985726e-01F, 7.448553443e-01F, 5.281223059e-01F, -6.592135429e-01F, 3.443969414e-02F, -1.555295467e+00F, 4.078561664e-01F,
+    -1.128083616e-01F, -5.656943917e-01F, -1.631671637e-01F, -1.114273146e-01F, 3.224502504e-01F, 5.249230266e-01F, 1.804386824e-02F, 1.671124250e-01F,
+    -2.415711880e-01F, -1.632991433e+00F, 1.541356891e-01F, 6.160499454e-01F, 1.540799141e-01F, -4.471406639e-01F, 5.660262704e-01F, -6.015550718e-02F,
+    -2.488867283e+00F, 3.633449972e-01F, -1.218573228e-01F, -5.322158337e-01F, -2.524426281e-01F, -6.710835695e-01F, 3.398130238e-01F, -5.333344340e-01F,
+    -1.356044173e+00F, 3.760652244e-02F, -4.585492611e-01F, 1.499986649e-01F, -7.029175162e-01F, -4.150209948e-02F, 4.975050390e-01F, 1.424729377e-01F,
+    -2.153833583e-02F, -8.104217052e-01F, 9.060422331e-02F, 7.358974777e-03F, 3.817288578e-01F, 4.913105667e-01F, -6.865313053e-01F, -5.821444988e-01F,
+    1.213684231e-01F, 1.832727939e-01F, -4.885999858e-02F, -1.398454756e-01F, 2.153570354e-01F, 7.655115426e-02F, -2.067585886e-01F, -7.785268128e-02F,
+    -3.220399320e-01F, -3.240545094e-01F, 2.230641991e-02F, 3.720588684e-01F, -7.901154160e-01F, -2.051366419e-01F, -2.387425900e-01F, 5.436766148e-01F,
+    -8.780272007e-01F, -2.573894501e+00F, -7.092307210e-01F, -4.739378989e-01F, -4.133121967e-01F, 3.098792732e-01F, 1.861369312e-01F, -5.138778687e-01F,
+    1.985245049e-01F, 2.169784158e-02F, 1.394110471e-01F, -5.184067488e-01F, 2.902128994e-01F, -1.382533669e+00F, 3.683306873e-01F, 1.925603598e-01F,
+    -6.709578633e-02F, 4.932625294e-01F, 1.100501493e-01F, -3.569845483e-02F, -1.581858099e-01F, -4.470466077e-01F, 1.180348024e-01F, 2.361324430e-01F,
+    -1.758362651e-01F, -3.939939737e-01F, 2.288391441e-01F, -1.097564220e+00F, 1.501310170e-01F, 5.412243009e-01F, -8.305000663e-01F, -2.448251247e-01F,
+    -9.598810673e-01F, 1.015071392e+00F, 4.074890018e-01F, 6.566767097e-01F, -1.833216697e-01F, 6.973755956e-01F, -4.089200795e-01F, 7.351148129e-01F,
+    1.454211712e+00F, 4.737447798e-01F, 1.201092526e-01F, 1.856546998e-01F, 1.011875629e+00F, 3.845916986e-01F, -1.682512283e+00F, -4.171338677e-01F,
+    2.038259506e-01F, -6.534600258e-01F, -6.841903925e-01F, -4.121338129e-01F, 3.337907791e-01F, 5.995413661e-01F, -7.609696984e-01F, 7.947605252e-01F,
+    -3.223018348e-01F, 4.743009508e-01F, -2.419121712e-01F, 1.025201306e-01F, -3.606472537e-02F, -3.525659740e-01F, 8.207704872e-03F, -4.730611145e-01F,
+    -2.857324481e-02F, 3.406435251e-02F, -1.026406661e-01F, -4.244580492e-02F, 1.776148677e-01F, -1.260844707e+00F, -9.702481627e-01F, 1.082231179e-01F,
+    4.633612931e-02F, -2.477928996e-02F, 1.818342134e-02F, 9.008114040e-02F, -2.717101574e-01F, 1.954697818e-01F, 1.363222450e-01F, 8.812286258e-01F,
+    -5.804622546e-02F, 2.527978420e-01F, 1.017307192e-01F, -7.496026903e-02F, -5.984272361e-01F, -4.515450299e-01F, 2.833721936e-01F, 2.283985019e-01F,
+    1.845268309e-01F, -1.962638497e-01F, -1.452262700e-01F, 1.008679196e-01F, 4.669682086e-01F, 5.259416699e-01F, 3.433164060e-01F, -4.720750153e-01F,
+    -1.859295845e+00F, 1.281749755e-01F, -2.558779716e-01F, 1.082490105e-02F, -1.491185308e+00F, 3.969392180e-01F, -6.714498997e-01F, -2.236058004e-02F,
+    -1.339264065e-01F, 4.880472422e-01F, -2.253735252e-02F, -1.190813407e-01F, 3.092938364e-01F, -1.546793729e-01F, -3.476312757e-02F, 7.765141129e-02F,
+    -8.334259987e-01F, -2.615205944e-01F, -2.347844392e-01F, 7.200130820e-02F, 3.646132536e-03F, -2.859163582e-01F, -9.396575391e-02F, -4.876862764e-01F,
+    3.501259685e-01F, -6.843265891e-01F, -5.115571991e-02F, 7.270775437e-01F, 1.638694406e-01F, 5.278148651e-01F, 1.008458212e-01F, 5.574454367e-02F,
+    6.678404212e-01F, -6.013565138e-02F, -6.720624566e-01F, 1.468869746e-01F, 3.679986671e-02F, 2.436616868e-01F, -1.377565563e-01F, -3.649806976e-01F,
+    -2.767752886e+00F, -3.396435976e-01F, -1.241602078e-01F, -5.702769756e-01F, -3.088422120e-01F, 2.632845044e-01F, -2.682475559e-02F, 4.116151929e-01F,
+    -2.295628935e-01F, -1.310074925e+00F, 3.431887329e-01F, -1.442988664e-01F, 2.814192474e-01F, -8.734610677e-02F, -1.974514276e-01F, 1.558076143e-01F,
+    -4.848331511e-01F, -1.317344189e+00F, -2.972347140e-01F, 6.010177135e-01F, -2.571017444e-01F, -7.151950002e-01F, 8.312113583e-02F, -1.377560943e-02F,
+    2.295799404e-01F, 1.815220714e-01F, 1.835263819e-01F, 3.853797317e-01F, 3.139414191e-01F, -7.687672973e-01F, 4.028006792e-01F, -1.306868076e+00F,
+    4.426652789e-01F, -1.923984103e-02F, 4.789518565e-02F, 3.088478744e-01F, 2.132166475e-01F, 1.142138094e-01F, 1.615813524e-01F, -5.069297552e-01F,
+    -1.466919065e+00F, -1.341760159e-01F, -2.912116647e-01F, 3.082641661e-01F, 3.764231205e-01F, 4.732664824e-01F, -1.984611601e-01F, 3.553051949e-01F,
+    -6.207091212e-01F, 5.496742725e-01F, 9.157503396e-02F, 3.038230836e-01F, -9.575399160e-01F, -8.493901491e-01F, -2.479919493e-01F, 6.914580613e-02F,
+    -7.025700808e-01F, 4.714799523e-01F, 4.799720645e-01F, -2.968385816e-01F, 1.530444175e-01F, 2.530644089e-02F, -1.713946939e+00F, 1.060328856e-01F,
+    7.199500203e-01F, -9.976423532e-02F, 1.048738696e-02F, 2.860944569e-01F, 8.668396473e-01F, -3.586621583e-01F, 7.332257032e-01F, 1.534581482e-01F,
+    2.095697522e-01F, -7.676212788e-01F, -4.767185152e-01F, 4.190445244e-01F, -3.870216608e-01F, 1.232946634e+00F, 9.779703803e-03F, -3.821124509e-02F,
+    -7.629874349e-01F, -8.285796046e-01F, -9.515892267e-01F, -4.382764697e-01F, -9.082810283e-01F, 2.158256620e-01F, -1.067341447e+00F, -2.786877751e-01F,
+    -3.080309153e+00F, -6.212846190e-02F, 1.591275483e-01F, -9.745812975e-03F, -2.552427948e-01F, 6.945342571e-02F, -8.932832628e-02F, 3.079292178e-01F,
+    2.052406967e-01F, -1.006320491e-01F, 4.134314060e-01F, -7.710629702e-01F, 3.063350320e-01F, -4.420123100e-01F, -5.156183988e-02F, 3.474125564e-01F,
+    1.190094054e-01F, -9.533107281e-01F, -1.002931297e-01F, -2.746657133e-01F, -3.818383515e-01F, 4.564618468e-01F, -3.426608741e-01F, -4.140275419e-01F,
+    -3.927512467e-02F, 1.079751328e-01F, 8.253201842e-02F, 7.080037147e-02F, -1.989369094e-01F, -7.849705219e-02F, 7.368314266e-02F, 2.234553099e-01F,
+    4.741221070e-01F, 1.845003515e-01F, 2.556971014e-01F, -2.768193781e-01F, 2.465405166e-01F, -1.017848253e+00F, 3.734678924e-01F, -5.751015544e-01F,
+    -5.602671504e-01F, -2.656054497e-01F, -5.705049634e-01F, 1.078436449e-01F, -4.617455900e-01F, 1.473156363e-01F, -4.285426438e-01F, 1.283746660e-01F,
+    -1.907919496e-01F, 7.994723320e-01F, -4.058335721e-02F, -5.636152029e-01F, 2.350298464e-01F, -5.574608222e-02F, 5.788227320e-01F, 3.280434012e-01F,
+    -1.994247437e-01F, 3.711503744e-01F, -9.820886701e-02F, -1.200520918e-01F, -1.887045056e-02F, -3.565661907e-01F, -5.112764835e-01F, -9.835469723e-01F,
+    -4.372578263e-01F, -6.634180546e-01F, 2.613260746e-01F, -3.411217928e-01F, -4.200319648e-01F, -5.917281657e-02F, -1.258278042e-01F, 8.427059650e-02F,
+    -2.431672253e-02F, -2.678340301e-02F, 5.761991143e-01F, 6.154809594e-01F, 2.740329802e-01F, -1.155097783e-01F, -6.690721512e-01F, 3.437942266e-01F,
+    1.980114281e-01F, 3.511167765e-01F, 6.297546625e-01F, -1.408232093e+00F, 6.162862182e-01F, -4.701533616e-01F, -4.194043279e-01F, -8.576656580e-01F,
+    3.815284371e-01F, -2.463777304e+00F, -1.350790821e-02F, 4.497299790e-01F, -3.838574141e-02F, 3.399296105e-01F, -1.344549358e-01F, 4.068603516e-01F,
+    4.266003668e-01F, -7.825721502e-01F, 9.185343236e-02F, -5.250900388e-01F, -4.172341824e-01F, -8.705869913e-01F, 6.074082106e-02F, 2.882674634e-01F,
+    -1.177303046e-01F, -6.724098325e-01F, -1.145220995e-01F, -1.774504542e+00F, 3.112486899e-01F, 6.921148393e-03F, -7.378501892e-01F, 4.026847780e-01F,
+    -8.509222269e-01F, 4.579544663e-01F, 2.469144911e-01F, -1.953225613e+00F, -8.707878590e-01F, -1.352319717e+00F, 9.123841524e-01F, -4.754495621e-01F,
+    2.925177217e-01F, -4.575842619e-01F, 4.100649953e-01F, 7.254821807e-02F, 9.741553105e-03F, -3.454114124e-02F, -8.651213050e-01F, 3.638810515e-01F,
+    1.413245648e-01F, 4.391655326e-01F, -5.141452551e-01F, 1.091100335e+00F, 8.836196661e-01F, -4.452821314e-01F, -6.847589016e-01F, -1.384850383e+00F,
+    6.226708293e-01F, -8.216798306e-02F, 4.788438678e-01F, 2.915588915e-01F, 2.391999587e-02F, -5.246677399e-01F, 6.850875616e-01F, -7.507337332e-01F,
+    7.643153071e-01F, 5.687711835e-01F, 4.403655976e-02F, 7.398112118e-02F, 6.622378826e-01F, 4.808622003e-01F, 7.798232138e-02F, 4.895905554e-01F,
+    -5.589213967e-01F, 3.107860386e-01F, -8.326265216e-01F, 1.634955853e-01F, 2.190179974e-01F, 4.063373208e-01F, 1.238323972e-01F, -5.952672958e-01F,
+    -2.671546638e-01F, -7.413584590e-01F, 5.737752914e-01F, -9.771613479e-01F, -3.203313947e-01F, -1.615542293e+00F, -1.043733120e+00F, -1.329652369e-01F,
+    -1.847390532e-01F, -2.862157226e-01F, -1.239850186e-02F, -9.116888046e-01F, 4.114204273e-02F, 1.061008424e-01F, -1.474772394e-01F, -4.005287290e-01F,
+    -4.388213754e-01F, 3.095128536e-01F, -1.074800849e+00F, -7.991728783e-01F, 1.293381751e-01F, 1.639648676e-01F, -7.081465721e-01F, -3.830638528e-01F,
+    -3.336983323e-01F, -3.564686282e-03F, 2.185935229e-01F, -1.060367003e-01F, 3.599202335e-01F, 5.215821043e-02F, -4.157746434e-01F, 2.769993246e-02F,
+    6.988030672e-01F, 3.366969228e-01F, -1.480569243e-01F, -5.778754950e-01F, 1.481328607e-01F, 6.257954240e-02F, -3.024877049e-02F, 1.737360209e-01F,
+    -1.037609018e-02F, 1.870645732e-01F, -4.452028126e-02F, -5.309031159e-02F, -1.247537434e-01F, -7.308816910e-02F, 8.155614138e-02F, -2.059421837e-01F,
+    -9.952600002e-01F, 3.969908059e-01F, 6.933476776e-02F, 2.291756421e-01F, 4.524980485e-01F, 5.030125976e-01F, -3.109556437e-02F, -1.589564607e-02F,
+    -4.932991564e-01F, 7.445742190e-02F, 4.731743038e-01F, 6.124827266e-02F, -3.908294439e-02F, -1.058896303e+00F, -3.810413182e-02F, -4.465415776e-01F,
+    5.581710339e-01F, -3.264515400e-01F, 7.146481276e-01F, 7.807241287e-03F, 1.432733089e-01F, -4.675310850e-02F, -1.098937154e+00F, 2.227439173e-02F,
+    9.421431273e-02F, 4.041384459e-01F, 3.977395892e-01F, -7.267473936e-01F, 1.452219337e-01F, -6.886343360e-01F, 1.096434444e-01F, -2.133106738e-01F,
+    -8.119235039e-01F, -9.785215259e-01F, -1.062501371e-01F, -4.540607333e-01F, -6.918454170e-01F, 4.663221538e-01F, -3.279805779e-01F, -4.969563782e-01F,
+    -9.092345834e-01F, 7.773559093e-01F, 1.033363819e+00F, -4.855424538e-02F, 3.734077513e-01F, 5.307623744e-01F, 2.309169620e-02F, -8.862055540e-01F,
+    -5.550797582e-01F, -4.319356680e-01F, 1.014851928e+00F, 3.772544563e-01F, -9.958537221e-01F, 2.540744245e-01F, -4.864753038e-02F, -4.774909317e-01F,
+    -1.594336033e-01F, -1.782768406e-02F, -5.737214088e-01F, -5.675280094e-01F, -4.171148539e-01F, -3.821241558e-01F, 3.992319107e-02F, 3.548518419e-01F,
+    1.315021068e-01F, 1.097926274e-01F, 1.276043355e-01F, 1.390137374e-01F, -7.151103928e-04F, 4.243152216e-02F, 3.173632920e-02F, -2.925022133e-02F,
+    -1.039968133e+00F, -4.014179409e-01F, -1.587544829e-01F, 3.617450595e-01F, -8.340204135e-03F, 7.190726697e-02F, -3.709006310e-01F, -3.068254292e-01F,
+    3.980256617e-01F, -3.520852029e-01F, 2.697739378e-02F, 5.374027491e-01F, -1.135001704e-01F, 1.064196080e-01F, -5.134246349e-01F, -1.935088038e-01F,
+    4.352493584e-01F, -8.008374572e-01F, -2.217008471e-01F, -4.947788715e-01F, -9.621917009e-01F, 7.128114104e-01F, 1.564136147e-01F, -1.076154590e+00F,
+    5.305438638e-01F, -7.253387570e-01F, 1.544880420e-01F, -1.305586249e-01F, 2.894827724e-01F, 5.500530005e-01F, 5.069860220e-01F, -2.119404227e-01F,
+    -1.261011600e+00F, 6.915670037e-01F, 3.729551658e-02F, -3.938585892e-02F, -6.242409348e-01F, -9.663975835e-01F, -9.067101032e-02F, 3.800691366e-01F,
+    -3.626977205e-01F, -4.182933569e-01F, -1.168914080e+00F, -5.715567470e-01F, 4.493840635e-01F, -1.887870669e+00F, 5.440714955e-02F, 1.148870364e-01F,
+    -3.252277672e-01F, -3.535690606e-01F, 9.033764899e-02F, 1.004407883e+00F, -1.765487671e+00F, -1.548071057e-01F, 4.443859756e-01F, -1.740674496e+00F,
+    -1.945387125e-01F, -1.831607968e-01F, -3.757564723e-01F, -1.331870675e+00F, 2.012353420e+00F, -1.704567969e-01F, -1.169860363e+00F, -1.661081612e-01F,
+    -1.436713040e-01F, 5.256373286e-01F, -7.478533387e-01F, -5.531050563e-01F, 4.047800303e-01F, -6.887558699e-01F, -8.788600564e-02F, -1.622210026e+00F,
+    -5.024372339e-01F, 2.839593887e-01F, -2.702053487e-01F, 2.749122977e-01F, -3.839058280e-01F, -8.317321539e-01F, 2.283549905e-01F, 4.440534413e-01F,
+    -1.702967584e-01F, -3.081320047e+00F, 3.431051373e-01F, -5.569563508e-01F, -6.665638685e-01F, -4.945215285e-01F, 3.005643189e-01F, -6.299560666e-01F,
+    -4.022343755e-01F, -9.175325632e-01F, 4.837395847e-01F, 1.787008345e-01F, -5.748117566e-01F, -3.907976151e-01F, 4.546288550e-01F, -2.365204273e-03F,
+    -5.905374289e-01F, -5.425620079e-01F, -1.468999684e-01F, 2.829866707e-01F, -3.061460853e-01F, 4.048932716e-02F, -1.120481730e+00F, 1.961596906e-01F,
+    -6.659063101e-01F, -7.272768617e-01F, 3.902863711e-02F, -3.835572600e-01F, -5.392780900e-01F, -4.284929037e-01F, -9.542942792e-02F, -1.186495543e+00F,
+    -7.270414233e-01F, -1.144333243e+00F, 1.882956736e-02F, -1.445509195e-01F, -1.203954458e+00F, -1.932779998e-01F, -2.688536346e-01F, 3.525148034e-01F,
+    3.341338933e-01F, -7.600237732e-04F, 6.212951541e-01F, -6.632863730e-02F, 1.725020856e-01F, -9.763674736e-01F, 7.259050608e-01F, 4.711100459e-01F,
+    3.603754938e-01F, -1.655705452e+00F, -2.137697041e-01F, -9.531804919e-01F, 5.393539667e-01F, -4.898129404e-01F, 5.816006660e-01F, 3.944626749e-01F,
+    2.578799725e-01F, 4.793801308e-01F, -2.965071797e-01F, 2.399885207e-01F, 1.497976482e-01F, 8.114479184e-01F, -1.693997264e+00F, -6.192176342e-01F,
+    2.769987285e-01F, -2.971906215e-02F, -4.593969882e-01F, 4.134238958e-01F, -1.351862960e-02F, -8.751569986e-01F, 5.213429332e-01F, -2.247460127e+00F,
+    -8.009870052e-01F, -4.366735518e-01F, -3.113194406e-01F, -7.637194991e-01F, 8.005794138e-02F, 1.611093432e-02F, -4.789618850e-01F, -3.699538764e-03F,
+    -1.349584103e+00F, 7.120743394e-01F, -6.186503172e-01F, 1.260237843e-01F, 6.333432198e-01F, 2.267995179e-01F, -6.826348305e-01F, -2.079019099e-01F,
+    2.467009276e-01F, -2.852281928e-01F, -5.105314255e-01F, 7.841229439e-01F, 2.585308850e-01F, 2.473005950e-01F, -5.051405430e-01F, 2.246960104e-01F,
+    6.982020140e-01F, -2.026754916e-01F, -3.396259844e-01F, -6.010342240e-01F, -4.693291783e-01F, -6.177011132e-01F, 6.693397760e-01F, 2.824429888e-03F,
+    -1.784848273e-01F, 8.488067389e-01F, -2.560559511e-01F, -5.300704241e-01F, -1.027602628e-01F, -9.500885010e-02F, 1.938485950e-01F, -1.032088280e+00F,
+    -6.926814318e-01F, -4.308662117e-01F, 2.766875923e-01F, -2.610246539e-01F, 1.278833747e-01F, 3.124960065e-01F, -7.161459923e-01F, -3.165713549e-01F,
+    -9.450387955e-02F, -4.688867033e-01F, -9.048869461e-02F, 7.452105172e-03F, 1.875203103e-01F, -3.438943923e-01F, -2.887920290e-02F, -1.703927368e-01F,
+    3.453561068e-01F, -1.656492233e+00F, 2.266355455e-01F, 4.091707468e-01F, 9.531844854e-01F, -1.737813830e+00F, -1.107896209e+00F, -1.295940638e+00F,
+    -1.119810790e-01F, -3.374974728e-01F, -3.011170961e-02F, 4.002996907e-02F, 2.957347929e-01F, -1.260207891e+00F, 4.148099571e-02F, 2.468286604e-01F,
+    3.525317013e-01F, -7.575197220e-01F, -7.325024605e-01F, -8.777475953e-01F, -2.732365131e-01F, -9.629531503e-01F, 3.900505602e-01F, -9.515523314e-01F,
+    -4.512732029e-01F, 4.401251078e-01F, -1.095225334e+00F, -4.411332905e-01F, -9.174728394e-02F, -2.804507315e-01F, 6.446549296e-01F, 2.800986730e-02F,
+    -1.058820009e+00F, -8.106759787e-01F, -1.745863795e+00F, -6.827172823e-03F, -4.536299706e-01F, -3.730047345e-01F, 2.900755405e-02F, -8.076284528e-01F,
+};
+
+alignas(64) static float const ntm_aot_layer_2_biases[64] = {
+    2.124223411e-01F, -1.608470529e-01F, -5.128822327e-01F, -1.303757191e+00F, -1.982214451e-01F, 6.901972741e-02F, -3.642843068e-01F, -4.975985587e-01F,
+    1.174820289e-01F, -2.228768542e-02F, -7.199276090e-01F, -2.333358079e-01F, -3.964684606e-01F, -2.885757089e-01F, 1.926416457e-01F, 2.691677213e-02F,
+    -3.312222958e-01F, -1.007533818e-01F, -3.049159646e-01F, 7.051726580e-01F, 4.749216139e-01F, -6.078950763e-01F, -5.435526371e-01F, -8.727139235e-01F,
+    -1.694761664e-01F, -9.085329771e-01F, -1.906739622e-01F, -4.152063727e-01F, 1.589408368e-01F, 1.899249405e-01F, -5.398617983e-01F, 1.034761444e-01F,
+    4.825347662e-02F, 2.008130699e-01F, -6.235961914e-01F, -9.597261548e-01F, -3.896730244e-01F, -2.476841062e-01F, -3.827657402e-01F, -1.556216925e-01F,
+    -4.382565618e-02F, 3.599711657e-01F, 1.338824779e-01F, -1.904851347e-01F, -4.303281009e-02F, 7.564618587e-01F, -2.024693936e-01F, 2.665044665e-01F,
+    -6.643630862e-01F, 2.455762774e-01F, -1.957164854e-01F, -5.265148282e-01F, 4.884075820e-01F, -2.886387110e-01F, -2.192146778e-01F, 1.173891798e-01F,
+    -3.355556726e-01F, -4.187012911e-01F, -5.039068460e-01F, 5.778028369e-01F, -2.506432831e-01F, 2.746957839e-01F, -5.918023735e-02F, -1.834975034e-01F,
+};
+
+static inline void ntm_aot_layer_2(float const *in_activations, float *out_activations)
+{
+    // outputs [0, 8)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_2_biases[0]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_2_biases[1]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_2_biases[2]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_2_biases[3]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_2_biases[4]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_2_biases[5]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_2_biases[6]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_2_biases[7]);
+
+        float const *const panel_weights = ntm_aot_layer_2_weights + 0U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 0U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 1U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 2U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 3U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 4U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 5U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 6U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 7U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [8, 16)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_2_biases[8]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_2_biases[9]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_2_biases[10]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_2_biases[11]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_2_biases[12]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_2_biases[13]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_2_biases[14]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_2_biases[15]);
+
+        float const *const panel_weights = ntm_aot_layer_2_weights + 512U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 8U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 9U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 10U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 11U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 12U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 13U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 14U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 15U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [16, 24)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_2_biases[16]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_2_biases[17]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_2_biases[18]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_2_biases[19]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_2_biases[20]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_2_biases[21]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_2_biases[22]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_2_biases[23]);
+
+        float const *const panel_weights = ntm_aot_layer_2_weights + 1024U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 16U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 17U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 18U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 19U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 20U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 21U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 22U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 23U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [24, 32)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_2_biases[24]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_2_biases[25]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_2_biases[26]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_2_biases[27]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_2_biases[28]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_2_biases[29]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_2_biases[30]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_2_biases[31]);
+
+        float const *const panel_weights = ntm_aot_layer_2_weights + 1536U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 24U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 25U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 26U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 27U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 28U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 29U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 30U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 31U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [32, 40)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_2_biases[32]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_2_biases[33]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_2_biases[34]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_2_biases[35]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_2_biases[36]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_2_biases[37]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_2_biases[38]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_2_biases[39]);
+
+        float const *const panel_weights = ntm_aot_layer_2_weights + 2048U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 32U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 33U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 34U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 35U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 36U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 37U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 38U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 39U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [40, 48)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_2_biases[40]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_2_biases[41]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_2_biases[42]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_2_biases[43]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_2_biases[44]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_2_biases[45]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_2_biases[46]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_2_biases[47]);
+
+        float const *const panel_weights = ntm_aot_layer_2_weights + 2560U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 40U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 41U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 42U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 43U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 44U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 45U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 46U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 47U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [48, 56)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_2_biases[48]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_2_biases[49]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_2_biases[50]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_2_biases[51]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_2_biases[52]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_2_biases[53]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_2_biases[54]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_2_biases[55]);
+
+        float const *const panel_weights = ntm_aot_layer_2_weights + 3072U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 48U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 49U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 50U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 51U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 52U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 53U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 54U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 55U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [56, 64)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_2_biases[56]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_2_biases[57]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_2_biases[58]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_2_biases[59]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_2_biases[60]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_2_biases[61]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_2_biases[62]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_2_biases[63]);
+
+        float const *const panel_weights = ntm_aot_layer_2_weights + 3584U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 56U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 57U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 58U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 59U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 60U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 61U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 62U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 63U, ntm_aot_relu(accumulator_7));
+    }
+}
+
+// 64 x 64 (relu)
+alignas(64) static float const ntm_aot_layer_3_weights[4096] = {
+    1.269264966e-01F, -2.495394051e-01F, -2.519040108e-01F, -1.006551683e-01F, -1.234071732e+00F, -4.612883329e-01F, 1.730830520e-01F, -3.476508558e-01F,
+    -2.313438952e-01F, 2.519035041e-01F, -6.485971808e-01F, -7.466682047e-02F, 8.150874823e-02F, -8.331244439e-02F, -1.753580123e-01F, -3.613705337e-01F,
+    4.292588308e-02F, -2.207721025e-01F, -4.818064868e-01F, -1.262075424e+00F, -2.246730030e-03F, 3.012140989e-01F, -7.192719579e-01F, -1.377877593e-01F,
+    -7.656483650e-01F, -1.457076073e+00F, -5.501592904e-02F, -6.705988646e-01F, 5.546695739e-02F, -6.900101900e-01F, -1.143149808e-01F, -4.155591130e-01F,
+    3.167278469e-01F, -3.631608784e-01F, -1.926158667e-01F, 1.814248855e-03F, 4.463100731e-01F, -7.768967003e-02F, -3.033196330e-01F, 3.524677753e-01F,
+    -7.164950371e-01F, -1.330647320e-01F, 8.537127376e-01F, 5.951847434e-01F, 1.790996343e-01F, 1.069487706e-01F, -1.218490720e+00F, -1.196082115e+00F,
+    -5.669596791e-01F, 3.121352792e-01F, 3.786825240e-01F, -5.226120949e-01F, 5.822896361e-01F, 3.458828330e-01F, -6.320576072e-01F, 1.015223622e+00F,
+    -1.506091356e+00F, 1.065539345e-01F, 6.144568324e-02F, -3.809844330e-02F, -6.596472114e-02F, -1.876467943e+00F, -1.969386041e-01F, 1.286111623e-01F,
+    -5.515408516e-01F, -7.418754697e-01F, -7.476720214e-01F, 1.035344154e-01F, -1.349011064e+00F, -6.257694215e-02F, 1.818673164e-01F, -1.106998324e+00F,
+    -8.064756989e-01F, 3.318626434e-02F, -3.876981884e-02F, 5.256750621e-03F, -1.045717120e+00F, -3.958995342e-01F, -5.072720647e-01F, -2.361566871e-01F,
+    6.504140049e-02F, -7.828190923e-01F, -8.268170357e-01F, -6.315895319e-01F, -8.245281577e-01F, 3.539193273e-01F, -1.081434965e+00F, -7.771833986e-02F,
+    -2.629942298e-01F, -2.584502101e-01F, 1.820697337e-01F, -8.899559975e-01F, -4.932793379e-01F, 4.959842563e-01F, -4.386193752e-01F, -5.056267977e-01F,
+    -5.799965858e-01F, -5.187634230e-01F, 1.610789448e-02F, -1.630377471e-01F, 2.911161259e-02F, -2.462332398e-01F, -2.110120803e-01F, -1.809388548e-01F,
+    -3.976417184e-01F, 8.909790218e-02F, -2.831441462e-01F, -2.302063629e-02F, 5.925389379e-02F, -7.800135016e-01F, 6.067265943e-02F, 5.000424385e-02F,
+    -1.053174973e+00F, 6.384695172e-01F, -2.944374084e-01F, -3.469319940e-01F, 5.244536400e-01F, -1.121624351e+00F, -2.438558191e-01F, -3.663400412e-01F,
+    -1.761419535e+00F, -2.934429646e-01F, -1.284003258e-01F, -3.321950138e-01F, -7.601778507e-01F, 7.135763764e-01F, -1.439236850e-01F, 8.190670609e-01F,
+    1.975099891e-01F, -9.263882786e-02F, 2.880925536e-01F, -1.006381437e-01F, 1.263223737e-01F, -7.488641143e-01F, -8.218488693e-01F, 7.877056003e-01F,
+    -1.200768203e-01F, 2.041959018e-01F, 2.070810944e-01F, -1.064004660e+00F, -7.383350730e-01F, 4.623742700e-01F, 1.636757851e-01F, 2.491873950e-01F,
+    2.353525907e-01F, 1.824094802e-01F, 7.229381800e-02F, -4.720155597e-01F, -1.593948007e+00F, 4.629891217e-01F, -1.253986210e-01F, 2.662905157e-01F,
+    1.431366801e-01F, -1.073289290e-01F, -3.096292019e-01F, 2.690855861e-01F, -3.867683411e-01F, -1.232438684e+00F, -1.156470299e+00F, -2.158979140e-02F,
+    -1.750018895e-01F, 1.462958157e-01F, -4.492262602e-01F, -1.162622333e+00F, 2.924216986e-01F, -3.522441909e-02F, 3.033618331e-01F, 2.881014049e-01F,
+    -5.145972371e-01F, -9.170151353e-01F, 4.347853363e-01F, -2.525520325e-01F, 1.831634194e-01F, 2.777995169e-01F, -1.375821382e-01F, -7.912488580e-01F,
+    3.717609495e-02F, 1.064154625e+00F, -1.800455600e-01F, 2.164477557e-01F, 1.408779621e-01F, -5.074569583e-01F, -8.136430383e-02F, 7.344978452e-01F,
+    -6.591875106e-02F, -1.039163351e+00F, 1.047007963e-01F, 4.977762401e-01F, 2.860036790e-01F, -6.012392044e-01F, -8.181501627e-01F, -1.524656653e+00F,
+    -3.340191245e-01F, 9.761274606e-02F, -2.683222890e-01F, 1.849525869e-01F, 9.577468783e-02F, -1.155478001e+00F, 5.104741827e-02F, -4.017736316e-01F,
+    -1.483783245e+00F, 8.036824465e-01F, -2.482496798e-01F, 2.966383100e-01F, -6.302491426e-01F, -1.659681678e+00F, 4.794558883e-01F, 1.151840165e-01F,
+    -1.060854271e-01F, 6.881289929e-02F, 2.228906006e-01F, 9.320556372e-02F, -8.622784168e-02F, 1.201057062e-01F, 6.055497378e-02F, 7.238736749e-02F,
+    -2.149232924e-01F, 1.613482386e-01F, -2.405956388e-01F, 1.975579113e-01F, 5.586462021e-01F, -6.710716486e-01F, -1.559651643e-01F, -4.994633198e-01F,
+    -4.304783344e-01F, 3.186144531e-01F, -8.786324859e-01F, -1.166612625e+00F, 1.521061510e-01F, 4.126365781e-01F, -7.356681675e-02F, -8.758400679e-01F,
+    -2.164620310e-01F, 3.996783197e-01F, -1.641370505e-01F, -1.230682805e-01F, 1.876813471e-01F, -4.381202161e-01F, 5.839164183e-02F, -4.862499535e-01F,
+    5.318440795e-01F, 2.628498152e-02F, -2.038710415e-01F, -6.966316104e-01F, 3.479138017e-01F, 2.080006450e-01F, -3.419351280e-01F, -5.857481360e-01F,
+    6.659357250e-02F, -2.268033475e-01F, 9.900511801e-02F, -1.125544310e+00F, -7.518729568e-02F, -2.022322118e-01F, -8.332955837e-01F, 2.109338939e-01F,
+    -2.940023243e-01F, -1.250856400e+00F, -1.863212138e-01F, -1.123302579e-01F, 1.217965260e-01F, -2.795885131e-02F, -4.943243563e-01F, 2.228309065e-01F,
+    -4.596047401e-01F, -5.620324016e-01F, 7.864377648e-02F, -5.396639705e-01F, -3.400440216e-01F, -1.209256768e+00F, -5.043284297e-01F, -6.276693661e-03F,
+    -3.106646240e-01F, -8.233735561e-01F, 1.148426309e-01F, 2.192667872e-01F, -7.799674273e-01F, -1.024555862e-01F, -3.144809604e-01F, -1.796384692e+00F,
+    -1.714107692e-01F, 1.196861565e-01F, -7.218815088e-01F, -6.630713940e-01F, -6.520709395e-01F, -4.355651438e-01F, 1.350965351e-01F, -2.410199642e-01F,
+    4.444998801e-01F, -1.691377908e-01F, -1.211895123e-01F, -6.694222093e-01F, -7.554557920e-01F, -7.459332943e-01F, 2.117717862e-01F, 3.476037085e-01F,
+    -7.028465271e-01F, -8.479771204e-03F, -2.680191398e-01F, -1.557410657e-01F, -1.908942685e-02F, -6.710048914e-01F, 5.431991816e-01F, -3.244683444e-01F,
+    -4.855487347e-01F, 4.766537249e-01F, -4.174396694e-01F, 6.854290366e-01F, 4.651941657e-01F, -1.184983611e+00F, 5.051202774e-01F, 4.640128613e-01F,
+    -7.318283319e-01F, 2.966223061e-01F, 8.019764721e-02F, 5.677203881e-04F, -1.257441789e-01F, -3.585323095e-01F, -8.282436132e-01F, 6.446656585e-02F,
+    2.914426327e-01F, -2.781302035e-01F, -1.468274891e-01F, 6.080550551e-01F, -1.368901372e+00F, -1.564776525e-02F, 6.779252291e-01F, 1.442871839e-01F,
+    2.182100201e-03F, 3.580616713e-01F, 2.723215707e-02F, -5.043170452e-01F, -7.279696465e-01F, -2.165326625e-01F, -5.926959589e-02F, 1.520259529e-01F,
+    -5.039348602e-01F, 2.899722457e-01F, 4.844315052e-01F, -1.047728658e+00F, -6.846659184e-01F, 5.136786103e-01F, -3.302249610e-01F, -4.890049994e-02F,
+    -1.556796551e+00F, 1.034385785e-01F, -8.348605037e-02F, -1.109546661e+00F, 1.508643031e-01F, 4.048242867e-01F, -1.351143956e+00F, 6.028943658e-01F,
+    4.569780231e-01F, -2.899665833e-01F, -2.394319512e-02F, -1.435955167e-01F, 4.553219974e-01F, 3.736340702e-01F, -3.998521268e-01F, -5.003747344e-01F,
+    -4.177410603e-01F, 2.584420741e-01F, 8.701652288e-02F, 5.005894974e-02F, -7.137759924e-01F, -6.022553444e-01F, -3.850166202e-01F, 1.322232932e-01F,
+    9.470203519e-02F, -5.262431130e-02F, 1.833298504e-01F, -4.342070594e-02F, -2.102370858e-01F, -1.187234819e-01F, 7.490084320e-02F, 1.681369543e-01F,
+    6.456033140e-02F, 7.818794250e-02F, -1.144078255e+00F, 2.200416327e-01F, -2.919246256e-01F, -1.183940053e+00F, 3.454359472e-01F, -3.123023920e-02F,
+    1.743707955e-01F, 4.884564579e-01F, 3.043529689e-01F, 2.696713805e-01F, -1.184461951e+00F, -6.805366278e-01F, -1.148276851e-01F, -5.023435354e-01F,
+    -1.005785838e-01F, -6.671082377e-01F, -4.925286397e-02F, 6.083519757e-02F, -4.022137728e-04F, -6.086872816e-01F, -3.583643734e-01F, 3.383899331e-01F,
+    2.041690499e-01F, -4.200193286e-01F, -1.870962828e-01F, -4.176390171e-01F, 3.726000190e-01F, 3.008483946e-01F, -3.232273757e-01F, -2.206669152e-01F,
+    -3.099941313e-01F, -5.682899952e-01F, -4.491630495e-01F, -4.459560513e-01F, -2.893932760e-01F, -1.926673949e-01F, -3.663023412e-01F, -7.143929601e-01F,
+    -7.379861474e-01F, -3.481091261e-01F, -2.770619653e-02F, -4.421515465e-01F, -1.030658409e-01F, -7.966881394e-01F, 4.391984046e-01F, -2.867842913e-01F,
+    2.510284483e-01F, -5.278366804e-01F, 4.225547910e-01F, -1.636052132e+00F, -1.858834624e-01F, -5.459748954e-02F, 5.568143725e-01F, -1.899576783e-01F,
+    -3.610163629e-01F, 2.084257640e-02F, -2.899610698e-01F, -7.369867563e-01F, -2.033231109e-01F, 1.908188462e-01F, 6.325386465e-02F, -4.745721817e-01F,
+    2.734264731e-01F, 5.696293116e-01F, 2.126152813e-01F, -7.499039173e-01F, -5.401216149e-01F, 4.988943040e-02F, -5.639382005e-01F, -4.568634331e-01F,
+    -1.612113118e+00F, -6.311563253e-01F, -5.862348676e-01F, -7.018902302e-01F, 1.943081915e-01F, -8.063967228e-01F, 1.165394336e-01F, 7.798299789e-01F,
+    -1.868682057e-01F, -9.887481928e-01F, -8.947153687e-01F, -8.293617368e-01F, -5.259394646e-01F, -7.227841616e-01F, -5.609610677e-01F, -7.879036069e-01F,
+    -6.950476170e-01F, -1.915401220e-01F, 3.773495257e-01F, 7.047855258e-01F, -5.323998928e-01F, 1.715378612e-01F, -3.342807665e-02F, -9.760499001e-02F,
+    -3.962489665e-01F, -2.249526978e-01F, 1.607663929e-01F, -3.232553303e-01F, -2.500364184e-01F, 2.241048813e-01F, 4.179927707e-01F, 2.747444212e-01F,
+    2.996167839e-01F, -1.764505915e-02F, -1.058419496e-01F, -1.346198082e+00F, -1.859009415e-01F, 1.869066954e-01F, -2.555842400e-01F, 2.025570720e-01F,
+    -1.121817231e+00F, 9.566673636e-02F, -1.506786823e+00F, 2.398957014e-01F, 7.321738005e-01F, 2.134968340e-02F, -9.190763533e-02F, 6.586647034e-01F,
+    -4.151186347e-01F, -1.754081547e-01F, 1.221304089e-01F, 8.298641443e-02F, -1.378937811e-01F, 3.911651671e-01F, -6.303151250e-01F, -1.433024853e-01F,
+    -1.218443364e-01F, -9.649468958e-02F, -7.458414435e-01F, -4.068025351e-01F, -1.056820869e+00F, 6.291356087e-01F, 2.524175346e-01F, -3.012090027e-01F,
+    3.824633956e-01F, 6.767192483e-02F, 1.709255278e-01F, 3.519867957e-01F, -1.667864919e-01F, -3.443771973e-03F, -3.627843857e-01F, -1.432192028e-01F,
+    -3.409373164e-01F, -1.156202704e-01F, 1.829677224e-01F, 2.576425672e-01F, 5.676909536e-02F, 3.634857535e-01F, -2.300353199e-01F, -9.634412825e-02F,
+    -1.094718933e+00F, -2.537680864e-01F, -2.546926737e-01F, -5.284096599e-01F, -1.011588424e-01F, -1.599803269e-01F, 1.223584861e-01F, -1.706363261e-01F,
+    1.697311103e-01F, -4.922375381e-01F, -2.306045145e-01F, 2.110206783e-01F, -1.415695399e-01F, -7.294959854e-03F, -4.783687294e-01F, 2.519616187e-01F,
+    8.005823195e-02F, -1.667566895e+00F, 3.769100904e-01F, 5.139013529e-01F, -3.026602268e-01F, -1.514737457e-01F, -7.293243408e-01F, 4.589749277e-01F,
+    -1.050815225e+00F, -9.065014124e-02F, 1.591149867e-01F, -1.360902786e-01F, 1.460092366e-01F, -2.494972944e-01F, -3.423716128e-02F, -1.416915953e-01F,
+    -4.143408239e-01F, -7.947474122e-01F, -8.091606498e-01F, -1.978186145e-02F, 1.775627211e-02F, -4.576836228e-01F, 9.185569882e-01F, 7.956784964e-01F,
+    3.211005032e-02F, -9.890637994e-01F, -1.644828469e-01F, -1.625257432e-01F, -2.089323997e-01F, -9.157361835e-02F, -5.292810500e-02F, 2.538811564e-01F,
+    -5.478678942e-01F, -5.464613438e-01F, -8.798106313e-01F, 2.162487209e-01F, 2.888359129e-01F, -1.738106757e-01F, -4.257786274e-01F, 1.347004343e-02F,
+    -3.118998185e-02F, -7.491588593e-02F, -2.017699629e-01F, -1.231281534e-01F, -4.158776999e-01F, 1.026760861e-01F, 1.097287089e-01F, -1.462065816e+00F,
+    2.229189128e-02F, 2.007667422e-01F, -6.296493411e-01F, -1.441764981e-01F, 1.523585469e-01F, 5.368975922e-02F, 1.894022226e-01F, -1.794336438e+00F,
+    1.461635530e-01F, 2.948825657e-01F, -9.601436257e-01F, 4.459395111e-01F, 2.765030861e-01F, -1.264212281e-01F, 4.331354499e-01F, -3.318853974e-01F,
+    1.254711747e-01F, -6.065332294e-01F, 1.795973182e-01F, -1.032632738e-01F, -3.867428377e-02F, -1.315615177e-01F, -2.084212750e-01F, -1.985035837e-01F,
+    1.859819889e-01F, -3.262807131e-01F, 4.304980636e-01F, -3.039784431e-01F, -1.789201498e+00F, -3.232336417e-02F, 2.144995183e-01F, -7.603251338e-01F,
+    -3.501225635e-02F, -6.019275784e-01F, 1.126915440e-01F, 4.228192195e-02F, 6.598329544e-02F, -1.341783535e-02F, 1.739431173e-01F, 2.763887942e-01F,
+    -1.119873524e+00F, 5.231158808e-02F, -1.153025508e+00F, -8.579940200e-01F, -3.281123564e-02F, 2.928817272e-02F, -1.202580333e-02F, 2.668926418e-01F,
+    -6.200922132e-01F, -4.381285310e-01F, 1.512633115e-01F, 6.244964600e-01F, -2.637335099e-02F, -1.505659819e-01F, -2.022551447e-01F, 1.521299332e-01F,
+    4.126560688e-01F, -4.552372694e-01F, -4.199193120e-01F, 5.072941184e-01F, 3.387137353e-01F, -2.372454852e-01F, -2.105044387e-02F, 3.229402304e-01F,
+    -4.183213785e-02F, 2.848680913e-01F, 1.946644634e-01F, 7.223138213e-01F, -1.714451909e+00F, 8.126825094e-02F, -2.876372337e-01F, -1.519190073e+00F,
+    -2.569913566e-01F, 2.573598325e-01F, -2.932047248e-01F, 4.172486961e-01F, -2.531647682e-01F, 2.460620403e-01F, 2.842422388e-02F, -1.122188687e+00F,
+    -1.663658172e-01F, 1.257001013e-01F, 4.511213005e-01F, -1.077796578e+00F, -6.585770100e-02F, 6.229764596e-02F, 5.433548614e-02F, 5.703959614e-02F,
+    -7.026275992e-01F, 1.674547233e-02F, -1.079161406e+00F, 3.352526575e-02F, 5.456581339e-02F, -6.186874583e-02F, -1.319860220e-01F, -2.266678959e-01F,
+    6.666416526e-01F, 3.098648489e-01F, 2.118141949e-01F, -3.626837432e-01F, -5.216826126e-02F, -1.591488868e-01F, -2.009722888e-01F, 4.159180820e-02F,
+    -4.258585274e-01F, -2.694245875e-01F, -1.026523486e-01F, 3.056888282e-01F, -1.225532666e-01F, -5.671877414e-02F, -1.411920488e-01F, 6.130187511e-01F,
+    -8.865531087e-01F, 4.314139783e-01F, -1.793242842e-01F, -6.963058710e-01F, -2.361276448e-01F, 7.325699925e-02F, 6.944600493e-02F, -7.840464115e-01F,
+    1.470058113e-01F, 1.337195188e-01F, 8.507768810e-02F, 6.701670885e-01F, 1.639459878e-01F, -1.064650193e-01F, -6.959283948e-01F, 4.379695654e-01F,
+    5.823403969e-02F, -5.157291517e-02F, -3.049118631e-02F, 1.310984641e-01F, 1.291484386e-01F, -3.383370861e-02F, -1.711288244e-01F, -1.854278496e-03F,
+    1.448839903e-01F, -1.233174279e-01F, 5.993634462e-01F, -4.978459775e-01F, -1.232949138e+00F, -6.962920725e-02F, 1.272407323e-01F, -1.194450539e-02F,
+    2.351210415e-01F, 1.036553606e-01F, 3.822757304e-01F, 1.950701475e-01F, -2.575968206e-01F, 1.359205395e-01F, -3.123123348e-01F, 5.288326740e-01F,
+    1.195407193e-02F, 9.281018376e-02F, 1.208008230e-01F, -3.078718670e-03F, -2.973847091e-01F, 1.921466887e-01F, -2.661645599e-02F, -1.303195506e-01F,
+    -2.253028899e-01F, 1.276117861e-01F, 2.996402979e-02F, -3.428061903e-01F, -1.276455641e+00F, 1.467158794e-01F, -4.203545675e-02F, -3.448913991e-01F,
+    -1.869631261e-01F, 1.274184138e-01F, -1.350453962e-02F, -5.292095542e-01F, 2.413367108e-02F, -1.143808011e-02F, 1.377515942e-01F, 4.715058208e-01F,
+    -7.587220073e-01F, -4.158292711e-01F, 2.560535669e-01F, -1.149818540e+00F, -2.271791697e-01F, 2.232236266e-01F, -3.788453639e-01F, 1.602285802e-01F,
+    2.966378927e-01F, 3.152024373e-02F, -1.032884493e-01F, 6.219736114e-02F, -1.584182084e-01F, 1.045408025e-01F, 9.071862698e-02F, -6.759734750e-01F,
+    -8.785319328e-02F, 1.762944013e-01F, -1.283057183e-01F, -4.746138453e-01F, 3.125132024e-01F, -3.720555827e-02F, -7.904698849e-01F, 1.776778884e-02F,
+    2.318616211e-01F, -6.497394443e-01F, -3.403953910e-01F, 6.431868076e-01F, -7.623665035e-02F, 2.139726281e-01F, -7.419227362e-01F, 3.386029601e-02F,
+    -8.216224909e-01F, 2.723093629e-01F, -6.889601350e-01F, -5.978350639e-01F, -4.780773073e-02F, -9.686111659e-02F, 1.699047685e-01F, 2.169521526e-03F,
+    3.254706860e-01F, 5.284388065e-01F, 9.847091883e-02F, 2.036346942e-01F, 1.642841697e-01F, 3.812569380e-02F, -2.290045470e-01F, -4.461772367e-02F,
+    -2.039559633e-01F, -5.976183414e-01F, -1.652027369e-01F, -4.780337811e-01F, -4.426015317e-01F, 1.539146453e-01F, -5.200688839e-01F, 6.803052872e-02F,
+    4.380252659e-01F, -9.263334870e-01F, -5.451480746e-01F, 2.903525531e-01F, -1.039758995e-01F, 1.728480160e-01F, -1.634640433e-02F, 7.126668692e-01F,
+    2.061679810e-01F, -1.327098161e-01F, -9.740996361e-02F, 2.994980812e-01F, 1.775397807e-01F, 1.820101589e-01F, -2.956084348e-02F, 8.570015430e-02F,
+    -1.050067991e-01F, 4.826861247e-02F, -2.685531080e-01F, 5.235182643e-01F, 3.058114648e-01F, -1.203505769e-01F, 1.289446056e-01F, -1.988646388e-01F,
+    -4.192637801e-01F, 1.004300863e-01F, -6.270910501e-01F, -8.651929498e-01F, 5.924955383e-02F, 1.158945709e-01F, -4.189983010e-01F, 7.347202301e-02F,
+    -2.711694539e-01F, -7.109126449e-02F, -1.574094296e+00F, -1.810147613e-01F, 2.059032470e-01F, 3.676807508e-02F, -1.203856021e-01F, -3.186042607e-01F,
+    -3.437247872e-01F, 2.121228576e-01F, -1.159852184e-02F, -3.063454330e-01F, -9.960768372e-02F, -1.267133355e-01F, 3.676425815e-01F, 4.326918162e-03F,
+    6.173843145e-02F, 2.788793482e-02F, -4.700746536e-01F, 4.373973981e-02F, -2.189255953e-01F, -1.292904466e-01F, -1.371636987e-01F, -5.137854218e-01F,
+    -2.483128905e-01F, -1.029016227e-01F, 1.363558620e-01F, 1.909833401e-01F, -6.028317660e-02F, -1.183165088e-01F, 1.174733341e-01F, 6.778312474e-02F,
+    1.249074414e-01F, -2.315230966e-01F, 5.986463428e-01F, 3.575217724e-01F, -1.234904170e+00F, 7.596948743e-02F, -1.033901095e+00F, -2.100724876e-01F,
+    7.802813500e-02F, -5.731127262e-01F, -2.887726426e-01F, 2.747674286e-01F, -7.105320692e-02F, -2.991746962e-01F, 5.522204041e-01F, -3.943774998e-01F,
+    -3.605699241e-01F, -1.305452138e-01F, -4.278076887e-01F, 1.577101462e-02F, -3.832782209e-01F, 4.626068100e-02F, 6.393749267e-02F, -4.611333013e-01F,
+    -3.267212808e-01F, 5.822922289e-02F, -8.839853853e-02F, -1.598514467e-01F, -2.273583859e-01F, -2.098293900e-01F, 2.112279879e-03F, -9.724332392e-02F,
+    -1.326729178e+00F, -8.083562255e-01F, 2.366165817e-01F, -8.272463679e-01F, 4.558155313e-02F, -3.807080910e-02F, 1.395226717e-01F, -1.543986201e-01F,
+    1.278406829e-01F, -1.384645998e-01F, -4.474199712e-01F, -9.214992821e-02F, -4.041359294e-03F, -5.251489207e-02F, 1.852954626e-01F, -1.336507052e-01F,
+    -3.280548453e-01F, -9.312169999e-02F, -4.531694576e-02F, -4.047541916e-01F, -5.766333267e-02F, -1.943255067e-01F, -7.539616823e-01F, 2.035614103e-01F,
+    -7.954332232e-01F, 7.334978878e-02F, 8.586464077e-02F, -8.096996546e-01F, -1.943551600e-01F, -3.675352037e-02F, 2.312179059e-01F, -7.031170726e-01F,
+    -1.019945741e+00F, -7.575578243e-02F, 1.808764338e-01F, 1.391313225e-01F, 2.169814892e-02F, -2.253255397e-01F, -2.275217772e-01F, 7.837799191e-02F,
+    2.160035223e-01F, 8.073472232e-02F, -2.839348912e-01F, 4.173455536e-01F, 5.993437171e-01F, -1.473832726e-01F, -6.731071472e-01F, -5.397437215e-01F,
+    1.636946499e-01F, 4.472972751e-01F, -3.718078434e-01F, 1.446645986e-02F, 4.197313190e-01F, -1.019272208e-01F, -2.374297529e-01F, 6.015077829e-01F,
+    4.183250368e-01F, -3.231903017e-01F, 4.438410997e-01F, -1.791319847e-01F, -1.435758024e-01F, 6.296141446e-02F, 1.761227101e-02F, -3.042711318e-01F,
+    -2.605914176e-01F, 2.400810719e-01F, -6.084234118e-01F, 7.223227620e-01F, -3.492321074e-01F, -5.656774621e-03F, -2.324505448e-01F, 7.203179002e-01F,
+    -1.251939088e-01F, -2.556795478e-01F, 1.812465489e-01F, -1.693678200e-01F, -2.692631483e-01F, 2.335919812e-02F, 2.494986504e-01F, -7.785714269e-01F,
+    -1.392820925e-01F, -7.788653374e-01F, -6.832525730e-01F, -5.866847038e-01F, 3.677922487e-01F, 6.208808161e-03F, -7.504833937e-01F, 3.496376872e-01F,
+    -1.104079008e+00F, -3.674020469e-01F, 8.808549494e-02F, -1.469330788e-01F, -3.451502621e-01F, -1.233856305e-01F, -1.819689572e-01F, 4.238319397e-01F,
+    -1.455273479e-02F, -3.511099219e-01F, 2.344197035e-01F, 2.590587437e-01F, -6.430041194e-01F, -2.704105079e-01F, -8.158500791e-01F, 6.601904631e-01F,
+    -3.518085182e-01F, -6.710797548e-02F, 1.574478745e-01F, -8.401548266e-01F, 9.701361507e-02F, -2.866462618e-02F, -6.802603006e-01F, -3.376694620e-01F,
+    9.066927433e-02F, -9.305953979e-02F, 1.502171606e-01F, 2.735399008e-01F, 2.604575157e-01F, 1.519123837e-02F, -1.909968406e-01F, -5.415607691e-01F,
+    -2.154942006e-01F, 1.376933069e-03F, 1.249964833e-01F, -9.410352111e-01F, -6.159551740e-01F, 1.176787093e-01F, -1.633629948e-01F, -2.283272296e-01F,
+    -1.212515682e-01F, -7.318367716e-04F, -1.576320678e-01F, -1.434122026e-01F, -3.394500613e-01F, -5.635375977e-01F, -1.070438027e-01F, 1.750286967e-01F,
+    -1.358391881e+00F, -6.617348641e-02F, 4.545489550e-01F, 1.963323802e-01F, -4.065825790e-02F, -3.323885202e-01F, 1.423611343e-01F, -4.612516463e-01F,
+    -1.568221301e-01F, 8.492777497e-02F, -7.382881641e-01F, 2.955260575e-01F, -2.264525183e-02F, 1.833292991e-01F, -1.717468202e-01F, 4.379649758e-01F,
+    -1.014374375e+00F, 1.748473346e-01F, 9.509872645e-02F, 1.057492942e-01F, -2.077486366e-01F, -1.333864450e+00F, -9.074893594e-01F, -1.410162330e+00F,
+    9.825498611e-02F, -1.524960846e-01F, 1.954015940e-01F, -8.705141544e-01F, -2.657597065e-01F, 4.139335752e-01F, 2.547673881e-01F, -9.388317466e-01F,
+    -8.075835705e-01F, -4.729038775e-01F, -8.769697510e-03F, 3.963063359e-01F, -1.496508598e+00F, -8.485553414e-02F, -1.320449859e-01F, 6.080052257e-02F,
+    1.330060698e-02F, -3.820710778e-01F, -1.212340236e+00F, 6.413951516e-02F, -3.157078326e-01F, -8.593528867e-01F, -1.412597597e-01F, -1.991886944e-01F,
+    2.091378421e-01F, -1.390460432e-01F, -1.694251299e-01F, -1.635890722e+00F, 4.244451225e-02F, -5.090322495e-01F, 4.758728296e-02F, -1.001230180e-01F,
+    -2.178836018e-01F, -1.201102138e-01F, -7.284365296e-01F, -1.193256304e-01F, -6.933526993e-01F, -6.241611242e-01F, -1.499106884e-01F, -1.594780535e-01F,
+    -5.898215249e-02F, 1.017948091e-01F, 3.202372491e-01F, -6.541199088e-01F, -1.156330109e+00F, 4.685545340e-02F, -2.478562444e-01F, 3.752281368e-01F,
+    -1.760526448e-01F, -1.477422714e-01F, 4.452044070e-01F, -3.924859688e-02F, 4.582556430e-03F, -7.208318710e-01F, -3.665411845e-02F, -1.450452358e-01F,
+    -2.047717012e-02F, -1.128284484e-01F, -1.072876826e-01F, -3.518614769e-01F, 3.397455513e-01F, -8.241376877e-01F, 1.715646386e-01F, -3.995843828e-01F,
+    -4.039689302e-01F, -4.399473369e-01F, 1.899034828e-01F, -5.359190106e-01F, 2.289129347e-01F, 3.290060461e-01F, 7.611149549e-01F, -1.052883744e+00F,
+    -1.728356928e-01F, -3.642160296e-01F, -6.145379320e-02F, -3.033609688e-01F, 2.649638951e-01F, -8.553467989e-01F, -1.145709038e+00F, -8.020195365e-01F,
+    -9.147217870e-02F, -1.397516131e-01F, -2.507659793e-01F, -8.369523287e-01F, -6.598019600e-01F, -7.720687985e-02F, -1.108623505e+00F, -3.681853712e-01F,
+    6.341656446e-01F, 4.871142805e-01F, -3.085361794e-02F, -4.515777230e-01F, -4.123532772e-01F, 2.921131253e-01F, -1.302563190e+00F, 5.846221447e-01F,
+    5.922795832e-02F, -2.386529148e-01F, -9.280077815e-01F, -7.707458138e-01F, -1.135520637e-01F, 2.801889181e-01F, 3.988732994e-01F, -3.074010611e-01F,
+    -6.346262693e-01F, -2.996036038e-02F, -4.934586957e-02F, -1.093479037e+00F, -1.579840541e+00F, 5.269128829e-02F, -1.390332729e-02F, 1.180218300e-03F,
+    1.394954622e-01F, -1.852487177e-01F, -4.627322853e-01F, -2.132473327e-02F, 5.153813213e-02F, -1.839726269e-01F, 9.042128175e-02F, 4.802680314e-01F,
+    -7.767903060e-02F, -2.230797559e-01F, 1.774103940e-01F, -2.041782588e-01F, -4.211895466e-01F, 3.336568773e-01F, 4.459709823e-01F, -8.360496163e-01F,
+    1.873574108e-01F, 2.388413101e-01F, 2.436202466e-01F, -3.044200540e-01F, 7.184129208e-02F, 7.471515983e-02F, -6.344100833e-01F, 1.632572562e-01F,
+    2.549736798e-01F, -1.937198490e-01F, -2.282707989e-01F, 1.029462934e+00F, 1.752243489e-01F, 1.798902601e-01F, -1.409736723e-01F, 1.310349703e-01F,
+    3.807955384e-01F, -8.440613002e-02F, 2.965848744e-01F, -1.469193339e+00F, -2.245780826e-01F, -7.441767305e-02F, -3.148696423e-01F, -2.805326283e-01F,
+    -2.016755790e-01F, -1.844034046e-01F, -9.344217181e-02F, -4.789511859e-02F, 6.339744478e-02F, -1.150160134e-01F, 7.414647192e-02F, 1.051762924e-01F,
+    -1.683238447e-01F, 1.346397959e-02F, -7.850876451e-01F, 6.661434770e-01F, 7.108072937e-02F, -9.379448891e-01F, 2.462210059e-01F, -4.590734839e-01F,
+    1.651592106e-01F, 4.092436433e-01F, -9.044690132e-01F, 8.285086751e-01F, 7.256273180e-02F, -6.240077019e-01F, -6.517421007e-01F, -3.116253912e-01F,
+    -1.820085645e-01F, -1.226406693e-01F, -1.055577755e+00F, -7.308145761e-01F, -1.187286526e-01F, -4.994686842e-01F, -1.770369411e-01F, 1.845302582e-01F,
+    -2.823718786e-01F, -1.053622551e-02F, -8.514292538e-02F, -7.814960480e-01F, -4.361892641e-01F, -8.259422779e-01F, -1.556764722e+00F, -2.171224505e-01F,
+    -2.821724117e-01F, -2.309516370e-01F, 3.345292211e-01F, -9.283215739e-03F, 7.340379804e-02F, -4.232476950e-01F, -9.356514812e-01F, 2.370726690e-02F,
+    -1.213719606e+00F, 9.801241755e-02F, -6.875733137e-01F, -1.517934084e+00F, 3.066310287e-01F, -1.170115948e+00F, -1.543738961e+00F, -1.033124685e+00F,
+    3.829291761e-01F, 1.078103632e-01F, -2.785372920e-02F, 1.082023606e-01F, -1.312224984e+00F, -8.717347383e-01F, -1.010189950e-01F, -5.285377502e-01F,
+    -1.442624182e-01F, 1.921328157e-01F, 1.351167560e-01F, -1.701728404e-01F, -5.116745830e-02F, -4.577001557e-02F, -4.012578130e-01F, -3.241371512e-01F,
+    7.880970836e-02F, -8.501896262e-02F, 3.793116510e-01F, 2.349120229e-01F, -9.613788128e-02F, -9.291965365e-01F, 3.414467871e-01F, -9.570659995e-01F,
+    -1.553159356e+00F, -4.943830371e-01F, -3.362240493e-01F, -4.560586214e-01F, -7.851242423e-01F, -8.000377417e-01F, -1.288142085e+00F, 1.524469405e-01F,
+    -7.038489450e-03F, 1.290483177e-01F, 5.513195395e-01F, -8.779247291e-03F, -7.286366224e-01F, 2.069642842e-01F, -1.423289478e-01F, 4.184396863e-01F,
+    1.171038598e-01F, 9.470082819e-02F, -6.674530506e-01F, 4.215613306e-01F, -1.146683469e-01F, -1.973015815e-01F, 5.842266083e-01F, 6.129206344e-02F,
+    -1.572999835e+00F, -2.459494919e-01F, -7.656039000e-01F, -3.077910542e-01F, -6.718327999e-01F, -6.765954494e-01F, -5.766727030e-02F, 8.705330640e-02F,
+    1.710186899e-01F, -3.272593915e-01F, 7.907274365e-01F, -7.949905396e-01F, 3.859446347e-01F, -3.575641215e-01F, -3.336396515e-01F, -1.020182073e-01F,
+    -1.176902771e+00F, 3.957083076e-02F, -5.799170136e-01F, -9.738675505e-02F, -1.269671172e-01F, -7.879095525e-02F, -1.007434845e+00F, 6.111415029e-01F,
+    1.158027425e-01F, -2.004590631e-01F, -3.131287098e-01F, 3.512251973e-01F, -1.486986727e-01F, -5.120563135e-02F, -5.907888412e-01F, 2.543091960e-02F,
+    -3.326626867e-02F, -2.101700157e-01F, -1.204071403e+00F, -5.584882498e-01F, -5.014572144e-01F, -2.075284161e-02F, 3.251397610e-02F, -1.296020269e+00F,
+    -4.185272381e-02F, -4.179875925e-02F, -4.412267208e-01F, -4.237001240e-01F, -1.426957846e-01F, 3.063250780e-01F, 1.425083578e-01F, 3.674219549e-02F,
+    -5.480712056e-01F, -4.611958861e-01F, -3.908838034e-01F, -4.644213989e-02F, 2.385011911e-01F, -8.925164342e-01F, -3.250603005e-02F, -1.039593458e+00F,
+    -1.401889920e-01F, 1.855295897e-01F, -6.517840177e-02F, 5.838849023e-02F, 1.278981119e-01F, 2.267907560e-01F, -3.078753948e-01F, -2.027617395e-02F,
+    -1.435599089e+00F, -4.465162158e-01F, 3.743970096e-01F, 1.253039539e-01F, -8.933479190e-01F, 5.881785154e-01F, 6.242980957e-01F, -6.044180598e-03F,
+    4.555620551e-01F, 7.006219029e-02F, 6.499096006e-02F, 1.306581795e-01F, -1.418051422e-01F, -4.718198478e-01F, 6.238825992e-02F, 1.975515485e-01F,
+    -3.640301526e-01F, 2.778314352e-01F, 8.440310955e-01F, -5.010815263e-01F, 6.854647398e-02F, -4.706318974e-01F, 3.809870780e-01F, -1.214543879e-01F,
+    2.431032434e-02F, -1.967005879e-01F, -4.607552290e-01F, 1.711720228e-01F, -6.553945690e-02F, -2.287101895e-01F, -7.852439284e-01F, -5.263414979e-01F,
+    3.268129230e-01F, -2.743583620e-01F, -6.270087361e-01F, -8.216790557e-01F, -7.699714303e-01F, -1.292931139e-01F, -1.062689256e-02F, -4.409176409e-01F,
+    -1.676928103e-01F, -2.421953678e-01F, 1.667479239e-02F, -4.264554083e-01F, -8.026590943e-02F, 4.416521788e-01F, 4.745836556e-02F, -6.918366551e-01F,
+    -6.194605827e-01F, -2.090022117e-01F, -1.694854140e+00F, 4.703629315e-01F, 3.642365336e-01F, -2.008313835e-01F, -4.434691072e-01F, -1.217797875e+00F,
+    -2.429606915e-01F, -3.020927906e-01F, 5.241041780e-01F, 9.653382748e-02F, -7.325084507e-02F, 3.204931021e-01F, -2.136154324e-01F, -5.737112761e-01F,
+    4.007321596e-01F, 8.447854221e-02F, -2.620373964e-01F, 2.811963558e-01F, -1.013437033e+00F, -7.598415613e-01F, -1.001124501e+00F, -3.870437145e-01F,
+    -3.308154643e-01F, 7.012258470e-02F, 1.088117808e-01F, -4.551415145e-02F, 3.624876738e-01F, -2.131160051e-01F, -1.707146466e-01F, 8.452680111e-01F,
+    1.973709315e-01F, -1.354607344e-01F, -1.267000735e-01F, -6.197314858e-01F, -4.333971739e-01F, -9.526458383e-01F, -8.517453074e-01F, 2.694904208e-01F,
+    1.952262074e-01F, -3.290479183e-01F, -2.862576842e-01F, -2.217589915e-01F, -1.201652527e+00F, 3.978342712e-01F, 4.036413040e-03F, 6.996762007e-02F,
+    -5.379989147e-01F, -1.642807573e-01F, -4.223469496e-01F, -1.321632713e-01F, -6.799266338e-01F, 1.688754708e-01F, -3.338716328e-01F, -7.501686811e-01F,
+    3.383346647e-02F, -6.246228144e-02F, -1.191533923e+00F, -1.639336348e+00F, 3.522414565e-01F, -1.255528182e-01F, -3.778777421e-01F, 1.869820058e-01F,
+    3.292917311e-01F, -1.009089202e-01F, 4.002685845e-01F, 1.099153161e+00F, 6.329854727e-01F, -5.555955693e-02F, 3.797502816e-01F, -9.173573852e-01F,
+    -8.822345734e-01F, -2.818180323e-01F, -1.668858647e+00F, -1.052827120e+00F, -3.502996862e-01F, -1.197018549e-01F, -7.183157802e-01F, -3.220422864e-01F,
+    -1.361736536e+00F, 7.664137986e-03F, 3.918401599e-01F, -7.506334186e-01F, -2.224685252e-02F, 2.553147376e-01F, -2.485676259e-01F, -1.102918267e+00F,
+    4.452101290e-01F, -1.532652695e-02F, 5.454385281e-02F, -2.152409315e+00F, 4.055005014e-01F, 1.269898862e-01F, -1.045253515e+00F, -6.923235059e-01F,
+    -2.654581703e-02F, -2.369313240e-01F, -6.579405069e-01F, -1.784860343e-01F, -2.222919650e-02F, 1.081287563e-01F, 1.715125591e-01F, -3.900541365e-02F,
+    -8.673360199e-02F, 8.396635205e-02F, 1.032494232e-01F, -2.905318141e-01F, 9.519840032e-02F, -9.847084880e-01F, 8.815941960e-02F, -1.852964014e-01F,
+    -4.835553095e-02F, -8.161459118e-02F, -3.019858599e-01F, -2.658515573e-01F, -1.003155559e-01F, -1.173711777e+00F, 3.432540968e-02F, -7.662300766e-02F,
+    -7.193704695e-02F, -5.636190772e-01F, 2.074536234e-01F, -3.991086781e-01F, -2.482031733e-01F, -6.336073875e-01F, -4.517671168e-01F, -2.290353477e-01F,
+    -2.265522182e-01F, 1.554054618e-01F, -1.769418120e-01F, 5.272340178e-01F, -3.648343086e-01F, -4.573232830e-01F, -2.450180948e-01F, 2.072308511e-01F,
+    2.296629362e-02F, -1.146654963e+00F, -2.735930383e-01F, -2.391458899e-01F, -3.319051489e-02F, -3.186514974e-01F, 5.730521083e-01F, -9.451617002e-01F,
+    -4.661060497e-02F, 7.774075270e-01F, 1.657891423e-01F, -1.451779246e+00F, -4.683328271e-01F, 3.060342371e-01F, 1.115741208e-01F, 2.556923330e-01F,
+    -3.228920102e-01F, -1.193828940e+00F, 2.245693356e-01F, -1.043601871e+00F, 1.007301882e-01F, -6.521076560e-01F, 1.899839193e-01F, 1.707722396e-01F,
+    -1.693428159e-01F, -1.391637564e+00F, -3.964826837e-02F, 1.542337835e-01F, -6.847277284e-01F, -8.148179948e-02F, -6.717231870e-01F, 4.925473332e-01F,
+    2.446139753e-01F, -2.203829736e-01F, -9.098594189e-01F, -1.998553127e-01F, -7.883042097e-01F, -4.775790274e-01F, -4.203109443e-01F, -2.823213637e-01F,
+    2.584531307e-01F, 1.974634379e-01F, -2.085078210e-01F, -3.557713926e-01F, -1.182091385e-01F, -1.016227841e+00F, -3.373443782e-01F, -7.418669760e-02F,
+    9.721295536e-02F, -1.834407210e+00F, 2.495149523e-01F, -5.937477946e-01F, 4.566494823e-01F, -5.360667109e-01F, 9.135853499e-02F, -1.056082472e-01F,
+    -1.521283835e-01F, -5.809332132e-01F, -5.731367469e-01F, 1.877580732e-01F, 3.358212411e-01F, 3.633208275e-01F, 3.115901649e-01F, 3.406174481e-01F,
+    -2.044949532e+00F, -5.708206296e-01F, -2.633616924e-01F, 3.761711717e-01F, 3.602966666e-01F, -8.766815662e-01F, -1.345682740e+00F, -1.296498030e-01F,
+    2.113737911e-01F, 3.432883620e-01F, -1.250534892e+00F, 2.015472576e-02F, -1.882605851e-01F, 1.818192899e-01F, -2.350474894e-02F, -6.525136232e-01F,
+    2.294531167e-01F, -3.801898360e-01F, -1.288660453e-03F, -1.347484589e-01F, -1.535135508e-01F, -2.140693218e-01F, -3.714056015e-01F, 2.081120573e-02F,
+    -5.928305909e-03F, -3.223246038e-01F, -1.560631514e+00F, 1.938950419e-01F, -9.883434772e-01F, -2.271614671e-01F, -2.531093657e-01F, -1.180390954e+00F,
+    -1.049882054e+00F, 7.380995899e-02F, 4.704518914e-01F, -1.167275071e+00F, 6.663459539e-01F, -2.885891795e-01F, -5.539900810e-02F, -4.493381381e-01F,
+    -6.162190437e-01F, -3.957999498e-02F, 1.256891191e-01F, -4.351655841e-01F, 2.562380731e-01F, 1.230860651e-01F, -7.658988982e-02F, 2.450516820e-01F,
+    -4.546775669e-02F, -3.443884552e-01F, -2.165248394e-01F, -1.733293235e-01F, 7.891615480e-02F, 3.736963570e-01F, 2.601858601e-02F, 1.279198080e-01F,
+    -3.642394766e-02F, -5.804029703e-01F, 2.997006178e-01F, -7.063083053e-01F, 4.308893532e-02F, 4.011429846e-02F, -1.070235893e-01F, -1.697904617e-01F,
+    -1.393070340e+00F, -8.994740993e-02F, 1.481190473e-01F, -8.283349872e-01F, -6.449691206e-02F, -2.337963581e+00F, 3.020860851e-01F, -2.066180855e-01F,
+    5.110405684e-01F, 1.873419583e-01F, -1.579900146e+00F, -1.035486460e+00F, -4.134190381e-01F, -5.263698697e-01F, 4.421512485e-01F, 1.496118959e-02F,
+    -2.489696890e-01F, -7.531833649e-02F, -1.228357926e-01F, 4.233083725e-01F, -1.762463152e-01F, 1.652436405e-01F, 1.347791702e-01F, -2.442829311e-02F,
+    1.793337017e-01F, -2.500336766e-01F, 2.494138926e-01F, 1.722049415e-01F, 4.837234616e-01F, -1.384442687e+00F, -1.162162542e+00F, 2.230520099e-01F,
+    -1.053537652e-01F, 4.494779930e-02F, 7.545851916e-02F, -1.261305362e-01F, -4.029040411e-02F, 1.578463167e-01F, -1.830803305e-01F, 1.929449886e-01F,
+    -7.035737485e-02F, -8.857665062e-01F, 4.021781385e-01F, 7.513549924e-02F, 2.553833425e-01F, -4.248844087e-01F, 5.549998879e-01F, 9.791988134e-02F,
+    -1.984646618e-01F, 1.916103214e-01F, -1.840228289e-01F, 5.029895902e-01F, -5.883463025e-01F, -2.298366576e-01F, -4.860255122e-02F, -4.109040797e-01F,
+    -2.774422765e-01F, 4.158103764e-01F, -8.268910646e-02F, -9.945803881e-02F, -4.517598748e-01F, -1.581796408e+00F, -3.709223568e-01F, 2.311495394e-01F,
+    -5.501733422e-01F, -2.362151891e-01F, -6.680945754e-01F, -1.335755825e+00F, 1.325654835e-01F, 1.425822265e-02F, 4.548721910e-01F, 1.243603379e-01F,
+    -9.087871909e-01F, -7.404282689e-02F, 2.086212039e-01F, 2.974323332e-01F, 2.765844762e-01F, 2.407481670e-01F, -2.661927603e-02F, -1.413008720e-01F,
+    -1.516180038e+00F, 1.784652472e-01F, 5.534186587e-02F, -1.353177130e-01F, 5.452051759e-03F, 6.069231629e-01F, 6.081626937e-02F, -4.271183610e-01F,
+    1.349355280e-01F, -1.180483460e+00F, -7.170631886e-01F, -3.147931099e-01F, -9.479461610e-02F, -6.771752238e-01F, -9.305443764e-01F, 1.177789196e-01F,
+    1.787705347e-02F, 5.989681184e-02F, -5.446089432e-02F, 3.757395223e-02F, -5.524895787e-01F, 9.686088562e-02F, -2.441260666e-01F, 7.667883486e-02F,
+    -8.536641598e-01F, -2.922625840e-01F, -5.886681750e-02F, 1.449472755e-01F, 4.894981086e-01F, 4.020131826e-01F, 1.363145709e-01F, 5.882430673e-01F,
+    1.356092989e-01F, -7.346968651e-01F, -8.595750332e-01F, -3.274207115e-01F, -2.869378626e-01F, -5.179886222e-01F, -4.110360146e-02F, 2.064219303e-02F,
+    3.627291024e-01F, -3.378798664e-01F, -7.476366758e-01F, -1.786298677e-02F, -8.654528260e-01F, 3.870031238e-01F, -2.799427137e-02F, 1.645853627e-03F,
+    -6.955692768e-01F, 4.134659842e-02F, -4.449339807e-01F, -1.234563351e+00F, 3.991103172e-01F, -1.133265495e+00F, -1.261736631e+00F, 4.671507329e-02F,
+    -1.928368330e+00F, 1.849853098e-01F, -3.387794197e-01F, -7.754951119e-01F, 3.573931456e-01F, -1.096292734e+00F, -7.241520882e-01F, 5.084384605e-02F,
+    2.964299917e-01F, -4.237177968e-01F, -1.388230085e+00F, 1.324649006e-01F, -5.025090575e-01F, 2.121563107e-01F, 1.253754854e+00F, 6.937054396e-01F,
+    -1.747365236e+00F, 2.044858634e-01F, 5.003318191e-01F, -7.249681950e-01F, 1.092170253e-01F, 3.044403624e-03F, -5.724091530e-01F, -6.410377622e-01F,
+    -3.169537485e-01F, 6.688746214e-01F, 1.228131577e-01F, -3.715846241e-01F, -3.702609986e-02F, 1.943990886e-01F, -1.954030693e-01F, 5.716212466e-02F,
+    2.293007225e-01F, 2.316319197e-01F, 1.170652732e-01F, 2.802931070e-01F, 2.727944637e-03F, -1.676140904e+00F, 2.669592202e-01F, 7.742242515e-02F,
+    -6.876799464e-01F, -1.001785874e+00F, 3.579858840e-01F, -1.119557619e+00F, -1.403654665e-01F, -7.773016393e-02F, -7.858102918e-01F, -4.364326596e-01F,
+    5.650196597e-02F, -1.088586569e+00F, 4.462507367e-02F, -2.628398500e-02F, -3.682704568e-01F, 3.166095912e-01F, -1.616663933e+00F, -7.060650736e-02F,
+    4.435562342e-02F, 1.376832575e-01F, -8.455988765e-02F, 1.615578979e-01F, -6.115694717e-02F, -1.310339756e-02F, -8.906270564e-02F, 3.470254689e-02F,
+    -2.727705836e-01F, -1.212891340e+00F, -1.978884578e+00F, -1.422231644e-01F, -4.018816398e-04F, -1.054135442e+00F, 1.055574268e-01F, -8.802432418e-01F,
+    -4.999305308e-01F, 4.661135748e-02F, -1.286493063e+00F, -1.801915318e-01F, -5.549801588e-01F, 5.700049400e-01F, -4.823890328e-01F, -5.052894950e-01F,
+    1.385089755e-01F, -5.220915079e-01F, -1.430313289e-01F, -4.082191288e-01F, 1.537137330e-01F, -1.173444912e-01F, -2.389736414e+00F, -3.664928675e-01F,
+    2.447872311e-01F, -6.320879608e-02F, -2.462835312e-01F, -1.855739355e-01F, 1.756281853e-01F, 2.006415129e-01F, -2.320397347e-01F, -7.223829627e-01F,
+    -1.636686176e-01F, -4.565927386e-01F, -1.508976817e-01F, 7.348965853e-02F, -7.741087079e-01F, -4.183813334e-01F, 6.284925342e-02F, -3.847876191e-01F,
+    -9.454160184e-02F, 4.834110290e-02F, -4.924036860e-01F, -2.880517244e-01F, 1.270025223e-01F, -8.645403981e-01F, -4.128983021e-01F, -1.486859918e+00F,
+    -9.217537940e-03F, -2.467648268e+00F, -4.420774579e-01F, 3.058566526e-02F, 3.514266312e-01F, -6.830209494e-02F, 4.600608051e-01F, -8.136370033e-02F,
+    2.214536071e-01F, -5.424433947e-01F, 2.786131203e-01F, -5.531216860e-01F, -1.869800240e-01F, -4.196504951e-01F, 5.318394676e-02F, 2.415640838e-02F,
+    -2.253933102e-01F, -9.758648872e-01F, -1.488932073e-01F, 1.786060035e-01F, 2.632424533e-01F, 2.221726626e-02F, -2.186256051e-01F, -9.939391613e-01F,
+    -4.731408954e-01F, 2.891747952e-01F, 1.340945065e-01F, 6.977707148e-01F, 3.357824385e-01F, 2.206340730e-01F, -2.957498431e-01F, 2.242966741e-01F,
+    -9.901170731e-01F, -2.145366669e-01F, -6.789698005e-01F, -3.074832857e-01F, 1.888602823e-01F, 1.290746033e-01F, -1.023679852e+00F, -3.751747906e-01F,
+    -1.494575888e-01F, 4.125492573e-01F, 2.865414135e-02F, 2.919854224e-01F, -2.724781632e-01F, 5.408211425e-02F, -1.722093076e-01F, -8.807529211e-01F,
+    4.443082511e-01F, -3.598223925e-01F, -2.147161514e-01F, 1.367671043e-01F, 1.775055379e-01F, -3.496559560e-01F, -8.565770984e-01F, -5.263505578e-01F,
+    -9.889402390e-01F, 1.457823217e-01F, -6.137073040e-01F, -1.574426889e-01F, 2.876090631e-02F, -1.279957891e-01F, -6.607824564e-02F, 6.249563396e-02F,
+    7.695838213e-01F, -6.371390820e-01F, -1.280193329e+00F, 5.127875805e-01F, -3.323361278e-01F, 6.542550921e-01F, -1.026360318e-01F, -5.543695763e-02F,
+    1.815069765e-01F, -2.729254961e-01F, 2.705867887e-01F, 2.206446528e-01F, 3.794716895e-01F, -3.804156482e-01F, 1.747385412e-01F, 3.076720424e-02F,
+    -1.672457457e+00F, -2.867709100e-01F, -7.142688036e-01F, -1.360620379e+00F, 4.217536449e-01F, 3.027784228e-01F, 4.281935841e-02F, -4.562285542e-01F,
+    -8.591181785e-02F, -5.924023390e-01F, 1.668196023e-01F, 1.140318364e-01F, -6.379806399e-01F, -1.637594253e-01F, 1.097913682e-01F, -9.813048244e-01F,
+    -6.205885485e-02F, -7.894366980e-03F, -1.494878978e-01F, -4.018636346e-01F, -1.294533461e-01F, -4.604088068e-01F, 4.043089598e-02F, -3.383569792e-02F,
+    -2.464646250e-01F, -8.831215501e-01F, -1.103756189e+00F, 3.435529768e-01F, -9.886589050e-01F, -8.062570691e-01F, -1.024480090e-01F, 6.574345380e-02F,
+    6.433419138e-02F, 1.501075365e-02F, -4.760574400e-01F, 4.133868814e-01F, -4.380685836e-02F, -8.441112936e-02F, -7.301966548e-01F, -5.237449408e-01F,
+    -2.093265504e-01F, 3.767974675e-01F, 3.135317191e-02F, -6.277455688e-01F, -8.949857205e-02F, -1.106432319e+00F, 2.196425498e-01F, -7.445470989e-02F,
+    -2.329154015e-01F, -8.104103804e-01F, -1.937220395e-01F, 1.321715713e-01F, -1.271917485e-02F, 2.680797875e-02F, 2.023626119e-01F, -2.536033094e-01F,
+    -3.462704420e-01F, 1.471903473e-01F, -6.722475886e-01F, -3.084069490e-01F, -1.254195809e+00F, 1.843481809e-01F, -9.569817781e-01F, -1.162329316e+00F,
+    -9.547460079e-02F, 2.301983386e-01F, 3.072457016e-01F, -8.227536678e-01F, 5.351136923e-01F, -1.013201356e+00F, -1.651485860e-01F, -6.203271151e-01F,
+    3.813361749e-02F, -5.577663183e-01F, -2.741027176e-01F, -5.243478417e-01F, -1.195227623e+00F, -1.723862290e-01F, -4.272162318e-01F, 2.516874112e-02F,
+    -1.517235041e-01F, -7.259579301e-01F, -1.798229851e-02F, -5.343053937e-01F, 4.185908735e-01F, -1.505774707e-01F, 3.049005941e-02F, -1.917377710e-01F,
+    1.728782989e-02F, 1.429459900e-01F, -5.722704530e-02F, 2.166407108e-01F, -7.561541200e-01F, 3.020951450e-01F, -8.458544016e-01F, -4.629272223e-01F,
+    9.230178781e-03F, 3.799493909e-01F, -2.259812206e-01F, 2.139484286e-01F, -5.554143786e-01F, 6.809819341e-01F, -3.612895012e-01F, -7.425371408e-01F,
+    2.730332315e-02F, 1.015300900e-01F, 2.155965716e-01F, -6.740277261e-02F, -7.649266720e-02F, -8.566715717e-01F, -8.517033458e-01F, -2.370426655e-01F,
+    -2.434564233e-01F, -4.584140778e-01F, -2.761989236e-01F, -1.695873857e+00F, -8.532795906e-01F, -7.301826477e-01F, -6.399033070e-01F, -7.428593636e-01F,
+    1.401350647e-01F, -6.218175888e-01F, 2.066990286e-01F, -6.541199088e-01F, 1.560149342e-01F, -2.096639872e-01F, -1.188398957e+00F, 4.064717293e-01F,
+    2.200508416e-01F, 5.367156863e-01F, 2.422816157e-01F, 1.924658716e-01F, 3.648487926e-01F, 3.816044629e-01F, -4.693480432e-01F, -6.766468287e-01F,
+    -3.515182436e-01F, -5.107459426e-01F, -1.481417120e-01F, -3.713737428e-01F, -6.201592088e-01F, 1.236182004e-01F, -1.119245529e+00F, -1.291791916e+00F,
+    4.123299122e-01F, -5.784279201e-03F, -1.196045280e+00F, -7.044268250e-01F, 4.965182841e-01F, 1.107913613e+00F, -3.811807036e-01F, 3.981592357e-01F,
+    2.572178543e-01F, 5.660401285e-02F, -3.075408638e-01F, -3.499831632e-02F, -4.208142459e-01F, 1.218798637e+00F, 6.744574755e-02F, -2.539758086e-01F,
+    2.640012205e-01F, -1.237223864e+00F, -3.994931877e-01F, -5.264477730e-01F, 1.338943392e-01F, 2.242527455e-01F, 2.360757142e-01F, 2.745110989e-01F,
+    -1.347277462e-01F, 8.251774311e-02F, 6.057836488e-02F, -4.922193661e-02F, -5.688905120e-01F, -7.361018658e-02F, 4.680980444e-01F, 2.061085403e-01F,
+    -6.123534590e-02F, -2.518025041e-01F, -3.953780234e-01F, 2.966721058e-01F, -3.385445476e-01F, 3.160665184e-02F, -6.624484062e-01F, -8.549995720e-02F,
+    -3.886226192e-02F, 1.399341822e-01F, -2.763199806e-01F, -3.546743691e-01F, 3.296141922e-01F, -5.949425697e-01F, -1.160516977e+00F, 3.655324504e-02F,
+    -1.717967391e-01F, 1.510990709e-01F, -1.871697783e+00F, -2.229189724e-01F, -1.029070616e+00F, -1.970685720e-01F, -5.826830268e-01F, 6.576769352e-01F,
+    4.969236851e-01F, -3.914361298e-01F, -1.258559804e-02F, -1.758799404e-01F, -4.859364778e-02F, -3.965694085e-02F, -9.051816463e-01F, 3.307093978e-01F,
+    9.441498667e-03F, 6.598099470e-01F, -3.403224349e-01F, -6.641893983e-01F, 5.261769295e-01F, -1.690273136e-01F, -1.120663881e+00F, 2.414017171e-01F,
+    1.505739540e-01F, -6.598076224e-02F, 1.095126048e-01F, -2.067464888e-01F, 1.843435019e-01F, -3.794750199e-02F, -1.303158142e-02F, -1.778255105e-01F,
+    -1.182506885e-02F, -3.255847096e-01F, -7.457219958e-01F, -8.089094758e-01F, -5.560915470e-01F, 6.292098165e-01F, 1.446238905e-01F, -7.227965593e-01F,
+    3.011537194e-01F, -1.407787949e-01F, 1.961068660e-01F, 3.650185168e-01F, -2.676565433e-03F, 2.977975309e-01F, -5.035744905e-01F, 6.416907907e-01F,
+    -1.669483930e-01F, 1.140346527e-01F, 1.092633083e-01F, -4.640332609e-02F, 2.437193245e-01F, -2.289591432e-01F, -6.458048820e-01F, 2.485962771e-02F,
+    6.273657084e-01F, 9.236258268e-02F, -9.558630586e-01F, -8.251090646e-01F, -1.208543539e+00F, 6.185989380e-01F, -5.372282863e-01F, 3.343070447e-01F,
+    2.342134416e-01F, -3.772602677e-01F, 1.393210888e-01F, -5.531495214e-01F, 1.391594112e-01F, -6.187205315e-01F, -2.912958264e-01F, 3.285097778e-01F,
+    -2.417380165e-04F, 1.451820731e-01F, -7.778065801e-01F, -7.517650723e-01F, 4.059508443e-01F, 5.165193602e-02F, -2.858763635e-01F, -3.066743016e-01F,
+    -2.068580091e-01F, 1.383128166e-01F, 2.900737226e-01F, 1.300722361e-01F, 3.985105753e-01F, 1.865909994e-01F, 1.451501101e-01F, -1.080084294e-01F,
+    2.726932466e-01F, -3.763501346e-01F, -1.858208627e-01F, 9.513089806e-02F, 3.622279763e-01F, -5.828097463e-01F, -5.297285318e-01F, -6.030919775e-02F,
+    -4.103007317e-01F, 4.044940323e-02F, -5.071836337e-02F, 2.075171471e-01F, -2.569181025e-01F, 7.467744946e-01F, -1.456951797e-01F, -1.824451536e-01F,
+    2.194884866e-01F, -5.996187925e-01F, -9.958765507e-01F, -9.892821908e-01F, -1.249627113e+00F, 7.697672844e-01F, -5.483136326e-02F, -6.232102513e-01F,
+    -1.614826918e-01F, -2.366059273e-01F, -8.083710074e-01F, -1.214356422e-01F, -8.998536468e-01F, -8.488571644e-01F, -1.350872397e+00F, 1.903624386e-01F,
+    4.110086262e-01F, -1.428476870e-01F, -1.073009849e+00F, 2.352652103e-01F, -6.738120317e-01F, 5.255514011e-02F, -9.951555133e-01F, -6.838212609e-01F,
+    -3.498300016e-01F, 4.201906323e-01F, 4.491356015e-01F, -4.621560276e-01F, -3.603864312e-01F, -3.558822870e-01F, -2.100228705e-02F, 2.506666183e-01F,
+    7.728610188e-02F, -2.201687545e-01F, -7.514818311e-01F, 8.480710387e-01F, -9.994224310e-01F, -1.841318160e-01F, -5.143318772e-01F, 5.164880753e-01F,
+    -2.619379461e-01F, -1.564830691e-01F, -5.688204169e-01F, -4.918437004e-01F, 7.265374810e-02F, 2.520366907e-01F, 3.349553049e-01F, 1.585466862e-01F,
+    -1.433693767e+00F, 2.867446244e-01F, -1.950636208e-01F, -6.037423015e-02F, -1.773671508e+00F, 6.492408514e-01F, 8.272435069e-01F, 8.689658344e-02F,
+    -2.088274360e-01F, 4.573590159e-01F, 4.721650109e-02F, -5.946486071e-02F, -2.246352881e-01F, -1.934845746e-01F, -1.051661611e+00F, 2.841104865e-01F,
+    -5.385780707e-02F, -1.004941463e+00F, -2.140866965e-01F, -2.480098158e-01F, -1.031886786e-01F, 1.160546672e-02F, 4.413688779e-01F, -5.951524973e-01F,
+    -1.435637474e+00F, -1.046405435e+00F, -1.153053164e+00F, 3.785732388e-01F, -9.254631586e-03F, -3.367268145e-01F, 1.401100904e-01F, -2.927556038e-01F,
+    -1.844991446e-01F, 1.335256845e-01F, -2.503617704e-01F, 3.045326471e-01F, 1.699029356e-01F, -1.190375313e-01F, -1.170570850e-01F, -6.713355333e-02F,
+    -6.850723028e-01F, 3.413847685e-01F, -4.736959189e-02F, -9.096414596e-02F, 8.623395860e-02F, 2.540154569e-02F, 3.075903356e-01F, 6.707318425e-01F,
+    5.132792592e-01F, 8.969547153e-01F, -9.082947969e-01F, -1.213207841e+00F, 3.999113142e-01F, 4.492684007e-01F, -7.656726241e-02F, -4.468815327e-01F,
+    -1.709033735e-02F, -4.418050051e-01F, -2.886905372e-01F, -1.124255061e+00F, -2.015101314e-01F, -8.435493708e-01F, -5.251574516e-01F, 1.348270625e-01F,
+    7.728264481e-02F, 2.547377944e-01F, 3.281823397e-01F, 1.214670241e-01F, -6.925801039e-01F, -1.806262583e-01F, -6.241566539e-01F, -4.385031387e-02F,
+    -1.587898284e-01F, -8.146907687e-01F, 4.576398805e-02F, -4.345695972e-01F, -4.322276264e-02F, -2.831607759e-01F, 5.934556574e-02F, -2.501777411e-01F,
+    -2.166196406e-01F, -2.845001221e-01F, 3.337530792e-02F, -3.842616379e-01F, -1.521248668e-01F, -4.308955073e-01F, -6.246964335e-01F, -2.534898818e-01F,
+    -6.177606434e-02F, 1.521772444e-01F, -3.318867087e-01F, -7.643650174e-01F, 9.153692424e-02F, -7.198460102e-01F, -4.559996426e-01F, -2.241731808e-02F,
+    4.644074477e-03F, 2.400784940e-01F, -3.087445498e-01F, -8.076297641e-01F, -4.155056775e-01F, -7.887025177e-02F, -9.062551260e-01F, -2.339728326e-01F,
+    1.208307892e-01F, 4.584105909e-01F, -1.229657885e-02F, 5.914102867e-02F, 1.274600774e-01F, -5.193082094e-01F, -7.820963264e-01F, -1.157616615e+00F,
+    2.278863937e-01F, -2.269986868e-01F, 5.133438706e-01F, 1.960574985e-01F, -4.391767681e-01F, 2.241701931e-01F, 1.737731248e-01F, -2.080900967e-01F,
+    8.186186105e-02F, 5.683127046e-01F, -5.368694663e-01F, 3.348771483e-02F, -3.280555904e-01F, 4.574059546e-01F, 2.821746469e-01F, -4.274570644e-01F,
+    -4.487943947e-01F, -1.846905798e-01F, 5.368731543e-02F, -1.500754595e+00F, 3.700527595e-03F, -3.053469658e-01F, 2.575054169e-01F, -9.542431831e-01F,
+    -3.750220239e-01F, -4.476984739e-01F, -3.966954648e-01F, -1.989620328e-01F, 1.075747132e+00F, -5.451453328e-01F, 2.552549243e-01F, -1.020645857e+00F,
+    -2.653681040e-01F, -4.539109468e-01F, -2.280974537e-01F, 4.154777825e-01F, -8.221899271e-01F, -3.980576247e-02F, -1.726867676e+00F, -3.241395950e-01F,
+    -4.857526124e-01F, -4.132141471e-01F, -7.955956459e-01F, -8.357381225e-01F, 7.234311849e-02F, -4.416253865e-01F, -8.137085438e-01F, 3.049277663e-01F,
+    -4.083736539e-01F, 1.230052039e-01F, -6.468845159e-02F, -2.128258049e-01F, -9.020022154e-01F, -7.927122712e-02F, -1.351631045e+00F, -1.424131274e+00F,
+    1.475276798e-01F, 1.556800902e-01F, 2.747474611e-01F, 2.645250261e-01F, 1.993319243e-01F, 1.934311241e-01F, -3.706454337e-01F, 4.154930711e-01F,
+    -4.523182511e-01F, -9.167832732e-01F, 9.035907686e-02F, 3.605573997e-02F, -6.886142492e-01F, -8.743143082e-02F, -1.892457902e-01F, -6.298886538e-01F,
+    -1.516832858e-01F, 1.708881259e-01F, -1.026359946e-01F, -4.463934153e-02F, 7.067988068e-02F, -2.702976763e-01F, -1.359489411e-01F, -2.413196564e-01F,
+    -3.509982526e-01F, -1.599853396e+00F, 1.219726428e-01F, -4.695791751e-02F, -7.090816498e-01F, 1.260430813e-01F, -3.628070652e-01F, 3.403080106e-01F,
+    -2.039559335e-01F, -6.520547867e-01F, -3.819051087e-01F, 1.606093347e-01F, 1.021263897e-01F, 1.563914716e-01F, -8.561359644e-01F, -2.042554319e-02F,
+    3.245374560e-01F, -7.183377147e-01F, -3.897321522e-01F, -5.659480579e-03F, 4.307991564e-01F, 2.283081561e-01F, 2.088663876e-01F, 5.461484790e-01F,
+    7.208508253e-02F, -1.229706109e-01F, -6.746999919e-02F, -5.070345402e-01F, -9.656253457e-01F, -4.094151407e-02F, -2.806945937e-03F, -4.130182564e-01F,
+    -1.876954734e-01F, -3.883887827e-01F, 5.269576311e-01F, -4.882778227e-01F, -4.025110304e-01F, 1.938786507e-01F, -1.356569886e+00F, 4.068903327e-01F,
+    -5.571207404e-01F, -9.262415171e-01F, -1.059400961e-01F, -2.199807912e-01F, -1.023898050e-01F, 1.637603715e-02F, 2.083331496e-01F, -2.724090815e-01F,
+    -1.999419332e-01F, -2.323050797e-01F, 2.088414729e-01F, -6.069086790e-01F, 4.257781506e-01F, -6.378656626e-01F, -7.286189795e-01F, 1.799992323e-01F,
+    -1.351895481e-01F, 7.366152853e-02F, 7.949299365e-02F, 2.902599871e-01F, -4.924894311e-03F, -4.227638245e-01F, 1.187066585e-01F, -2.721562795e-02F,
+    -1.499437243e-01F, -7.472231388e-01F, 1.915475875e-01F, -8.195589483e-02F, -5.709449649e-01F, -5.549745560e-01F, -3.878690004e-01F, -4.593777061e-01F,
+    6.585903168e-01F, -3.866504729e-01F, 9.886945039e-02F, 1.964111477e-01F, -6.090454459e-01F, -4.706277549e-01F, -3.277482390e-01F, -1.991449445e-01F,
+    -6.973894835e-01F, -1.082394361e+00F, 2.681469023e-01F, 1.711752266e-01F, -2.450715452e-01F, 2.236042172e-01F, 7.350014150e-02F, -2.465543896e-01F,
+    7.303774357e-03F, -8.538731188e-02F, -1.133807182e+00F, -5.313873887e-01F, -3.839101791e-01F, -4.779657423e-01F, 2.210660428e-01F, -1.740292273e-02F,
+    8.624028414e-02F, 2.721058726e-01F, 1.213355064e-01F, 4.287157208e-02F, 5.362672210e-01F, 2.990144119e-02F, -3.749502301e-01F, 1.053655818e-01F,
+    2.324637175e-01F, -1.194697767e-01F, 5.051372051e-01F, 3.956685215e-02F, -6.070761085e-01F, 1.427292377e-01F, -7.190637589e-01F, -1.374167949e-01F,
+    -5.860969797e-02F, -8.057545424e-01F, 1.396713108e-01F, 1.600359976e-01F, 1.829996258e-01F, 1.867246777e-01F, -5.705223680e-01F, 1.985943466e-01F,
+    -1.305598617e+00F, -3.678092360e-01F, 2.481769174e-01F, 1.041182354e-01F, -4.093198180e-01F, -1.625985205e-01F, 6.049875617e-01F, 1.121852696e-01F,
+    -1.097536325e+00F, 4.169893861e-01F, -3.531176448e-01F, -2.333970666e-01F, -1.166560054e+00F, 4.742486775e-02F, 1.764417626e-02F, -1.026251674e+00F,
+    -6.753398478e-02F, -2.836915255e-01F, 6.333106756e-02F, -9.270685911e-02F, -9.171942249e-03F, -8.149130940e-01F, 5.783208087e-02F, -1.798424497e-02F,
+    1.668514870e-02F, -1.086788416e+00F, 1.301236302e-01F, -3.300960362e-01F, -5.983711481e-01F, -1.102152705e+00F, 2.029869556e-01F, 2.262648791e-01F,
+    -2.139582783e-01F, -1.341445804e+00F, 4.017699137e-02F, -2.360204048e-02F, -8.001986742e-01F, -5.945320129e-01F, -6.302180886e-01F, 1.119274795e-01F,
+    -1.495127231e-01F, 3.584695160e-01F, -2.794267833e-01F, 3.287601769e-01F, -1.029620245e-01F, -1.397992224e-01F, -2.531239390e-01F, -1.865035594e-01F,
+    -4.680789709e-01F, 2.218521535e-01F, -8.690929413e-02F, -3.031543195e-01F, -3.640285134e-01F, 1.758680791e-01F, -8.690689802e-01F, 1.205848008e-01F,
+    6.252439320e-02F, -1.199901700e+00F, -8.085278869e-01F, -7.268248796e-01F, -4.747343957e-01F, -8.073107153e-02F, 1.556561589e-01F, -7.149292827e-01F,
+    -4.282950163e-01F, 1.458054334e-01F, -5.988333225e-01F, -6.910690665e-01F, 7.797894478e-01F, -6.240590811e-01F, -5.721142516e-02F, 2.521877289e-01F,
+    -4.403963313e-02F, 1.813860238e-01F, -8.243176341e-02F, -1.122895777e-01F, -1.537684351e-01F, -1.173738092e-01F, -4.545809329e-02F, 9.995985031e-02F,
+    -5.702785254e-01F, -3.158282638e-01F, -7.346575856e-01F, 3.203324676e-01F, -6.515556574e-01F, -4.041578174e-01F, -9.927507043e-01F, -9.679629207e-01F,
+    -2.339939773e-02F, 6.504534930e-02F, 9.883036464e-02F, 1.485356539e-01F, -6.781999469e-01F, 2.389346212e-01F, 3.571964204e-01F, -3.321499825e-01F,
+    -4.322514236e-01F, -9.957412481e-01F, 5.044968054e-02F, 2.007718831e-01F, -1.032449007e+00F, 3.155540675e-02F, 4.094109312e-02F, 5.562806129e-01F,
+    6.998005509e-01F, -2.227978408e-01F, -1.470659614e+00F, -1.461093426e-01F, -1.088437513e-01F, 4.225326478e-01F, 3.329444304e-02F, -4.256924689e-01F,
+    8.300600201e-02F, 4.462403432e-02F, -1.477223784e-01F, 6.965724379e-02F, -2.412683815e-01F, -4.146173596e-01F, -2.099822164e-01F, -1.762993783e-01F,
+    -5.850467831e-02F, 2.214705646e-01F, 1.593475193e-01F, -2.146511555e+00F, -7.818018198e-01F, 1.423420608e-01F, -4.125884473e-01F, 4.088999331e-01F,
+    -2.849357724e-01F, 1.921084672e-01F, 4.492842406e-02F, -5.606072545e-01F, 9.440100193e-02F, -7.685347199e-01F, -3.163642287e-01F, -2.210113704e-01F,
+    -6.338523030e-01F, 2.276327461e-01F, 1.921462826e-02F, 3.157560527e-01F, -1.474708766e-01F, -1.772101410e-02F, -7.757659554e-01F, -1.050503366e-02F,
+    -1.050674636e-02F, -1.445900947e-01F, -1.081439257e+00F, 1.775157899e-01F, 2.249279171e-01F, 1.110812947e-01F, -4.640627280e-02F, -3.210619837e-02F,
+    1.227432191e-01F, -3.634857237e-01F, -2.169054151e-01F, -3.658711910e-01F, -3.249568045e-01F, -3.746112287e-01F, 1.413504481e-01F, 4.603793100e-02F,
+    -8.016332984e-02F, 5.881350040e-01F, -8.569300175e-01F, -5.232017860e-02F, 5.555588752e-02F, 9.465385228e-02F, -8.216484785e-01F, -5.806045532e-01F,
+    -1.144387946e-01F, -8.675430417e-01F, -2.603339255e-01F, 2.915892303e-01F, 2.380966395e-02F, -2.192315459e-01F, -1.042998433e+00F, 5.520033836e-01F,
+    4.777982235e-01F, -1.444950514e-02F, -4.443436563e-01F, -1.912606955e-01F, 4.977429509e-01F, -2.913288474e-01F, 1.716085523e-01F, -7.063304633e-02F,
+    -1.004874706e-01F, -8.601050377e-01F, -8.860757202e-02F, 3.621888906e-02F, 6.495902538e-01F, -1.524156928e-01F, -3.841643035e-01F, -2.786900103e-01F,
+    -4.479465783e-01F, -2.850475311e-01F, -1.820892245e-01F, -2.769400775e-01F, -5.329300836e-02F, -2.340851784e+00F, 1.197826117e-01F, 6.297650747e-03F,
+    -7.206085324e-01F, -6.347098351e-01F, -4.900534153e-01F, -2.764193416e-01F, 5.586878583e-02F, -7.197461128e-01F, -7.101485133e-01F, 7.225621343e-01F,
+    -2.778038383e-02F, 2.469462007e-01F, 7.452771813e-02F, 2.717522979e-01F, 2.435260564e-01F, -8.877480626e-01F, -6.259375811e-01F, -5.611589551e-01F,
+    -2.107953280e-01F, -4.309201539e-01F, -4.167591333e-01F, -1.254690289e-01F, -5.151020885e-01F, -2.329902053e-01F, -1.139022708e-01F, -2.233833522e-01F,
+    -6.936160922e-01F, -1.048188061e-01F, -2.763895392e-01F, -1.841529846e+00F, 2.605016232e-01F, 1.505305171e-01F, 9.350260720e-03F, -6.065402180e-02F,
+    -8.464843035e-02F, -2.497220635e-01F, 8.278927207e-02F, -2.267822623e-02F, -1.067207530e-01F, 5.799810588e-02F, 1.821843237e-01F, 1.560206711e-01F,
+    -2.097281665e-01F, -1.946834475e-02F, 2.763457000e-01F, -1.043424487e+00F, 3.322279453e-01F, -2.224229097e+00F, -4.664193988e-01F, -7.664580345e-01F,
+    -4.646237940e-02F, 8.125790209e-02F, -2.698554397e-01F, 8.249000460e-02F, -5.640626550e-01F, -2.297410965e-01F, 4.008164704e-01F, -1.158596277e-01F,
+    1.000717133e-01F, 6.995224208e-02F, 2.383005917e-01F, 1.151283160e-01F, -4.216153622e-01F, -1.433299761e-02F, 3.771714121e-02F, 2.200573310e-02F,
+    4.359444678e-01F, -4.804347456e-01F, -3.100625277e-01F, -3.502238095e-01F, 2.781424299e-02F, -3.176516891e-01F, 4.936035350e-02F, 2.165145278e-01F,
+    2.989022247e-02F, -1.077104330e+00F, -2.000801414e-01F, 8.097627759e-02F, -1.211747050e+00F, -4.195016250e-02F, 1.744939685e-01F, -7.281591892e-01F,
+    1.298194379e-01F, -2.276801914e-01F, -8.435956202e-03F, -2.195769362e-02F, 3.614598215e-01F, -3.554287553e-01F, -1.378148049e-02F, -3.311975300e-02F,
+    2.175023258e-01F, -5.830283761e-01F, -7.237049341e-01F, 1.899108440e-01F, 1.162636951e-01F, 6.779145449e-02F, -5.910835862e-01F, 4.794477522e-01F,
+    -4.545814171e-02F, -7.176254988e-01F, -5.395352095e-02F, 1.136931479e-01F, -8.708941340e-01F, -6.992922425e-01F, 1.810257696e-02F, -3.595615923e-01F,
+    1.270038784e-01F, -3.959884048e-01F, -2.573190928e-01F, -1.857488006e-01F, -4.549250007e-01F, 6.741125137e-02F, -1.255178005e-01F, 1.077643037e-01F,
+    -7.364235073e-02F, 2.047903240e-01F, -6.393392086e-01F, -2.897749543e-01F, 6.035809405e-03F, 7.348417640e-01F, -8.533403873e-01F, -3.801436424e-01F,
+    -1.265163541e+00F, 5.318561792e-01F, -8.168675900e-01F, -6.256589890e-01F, -1.412750602e+00F, 3.270442188e-01F, -8.392171562e-02F, -1.244270682e+00F,
+    1.054079086e-01F, -4.941199720e-01F, -1.017773032e+00F, 1.354681402e-01F, 4.739604592e-01F, -1.117605120e-01F, -4.122070372e-01F, -4.373209178e-01F,
+    3.791672885e-01F, -1.767964065e-01F, -2.652457952e-01F, -9.165681005e-01F, 7.294262052e-01F, 2.994968556e-03F, -2.547666803e-02F, 1.349908710e-01F,
+    -4.872933924e-01F, 1.390319318e-01F, -4.163835347e-01F, 1.987334937e-01F, -4.950736165e-01F, -1.915456802e-01F, -3.201964498e-01F, -6.175793409e-01F,
+    -1.084724188e+00F, 3.134709001e-01F, 3.854805604e-02F, -8.249122649e-02F, -1.778396517e-01F, -9.777538478e-02F, -6.446456164e-02F, -6.971079707e-01F,
+    -7.208843231e-01F, -3.077199459e-01F, -3.105392754e-01F, -2.022087425e-01F, -5.697342157e-01F, -1.283308417e-01F, -2.029699534e-01F, 4.035281837e-01F,
+    3.738507032e-01F, -1.170258373e-01F, -3.975700736e-01F, -5.826898385e-03F, -4.506184161e-01F, -3.519735932e-01F, -4.837457463e-02F, 4.185282290e-01F,
+    -9.534069300e-01F, -2.728407085e-02F, 8.304169774e-02F, -4.367750287e-01F, -3.059951589e-02F, -3.071230948e-01F, -4.386046827e-01F, -7.849857211e-01F,
+    1.879767179e-01F, 7.569406182e-02F, -1.610103995e-01F, -6.556490809e-02F, -4.388855398e-01F, 1.647795886e-01F, 4.182666540e-01F, -6.688933074e-02F,
+    -1.593576521e-01F, 1.755880862e-01F, -1.379227191e-01F, 2.717925906e-01F, -3.251095116e-01F, -2.229408771e-01F, -2.332428992e-01F, -1.181828976e+00F,
+    3.804738522e-01F, -1.520885229e-01F, 2.168813907e-02F, 1.951853931e-01F, 3.773480058e-01F, 4.932387546e-02F, -6.022271514e-01F, 2.717616782e-02F,
+    1.255618036e-02F, -1.729092896e-01F, -6.873124838e-02F, 9.160034359e-03F, -4.106479585e-01F, -2.170738876e-01F, -5.927655101e-01F, 4.682893455e-01F,
+    -4.045442045e-01F, 2.323966175e-01F, -2.217528671e-01F, 2.286333032e-02F, -7.096742392e-01F, 5.213693157e-02F, 2.204744071e-01F, -2.899579704e-01F,
+    -1.626267284e-01F, -6.025438309e-01F, -3.114073873e-01F, 2.770041525e-01F, 7.393637896e-01F, -1.029331461e-01F, -1.440764904e+00F, 5.681660771e-02F,
+    -2.658413351e-02F, 1.044168547e-01F, 7.758882642e-02F, -2.986287177e-01F, 2.995775044e-01F, -7.854036242e-02F, -7.032363415e-01F, 1.454750746e-01F,
+    -7.040434331e-02F, -2.861562930e-02F, -2.339867651e-01F, -3.434175849e-01F, -9.270759821e-01F, 2.168252505e-02F, -6.684277654e-01F, -3.425776660e-01F,
+    -9.757497907e-01F, 2.092187665e-02F, 5.401152000e-02F, -1.738485098e-01F, -6.912520528e-01F, -7.691313326e-02F, -3.920071572e-02F, -1.020583153e+00F,
+    -5.162985325e-01F, 3.298317268e-02F, -4.434794784e-01F, -2.255053282e+00F, 3.221502602e-01F, -1.788633913e-01F, -4.419940114e-01F, -5.556412339e-01F,
+    2.143849619e-02F, 3.037371486e-02F, 5.663970858e-02F, -1.837775856e-01F, -8.426238298e-01F, -1.488391757e-01F, -3.753919303e-01F, -6.775854528e-02F,
+    -1.742454479e-03F, -1.686345190e-01F, -1.471946090e-01F, -1.654506773e-01F, 2.383467406e-01F, -1.614368260e-01F, -1.725001693e+00F, -6.825953722e-01F,
+    -7.796990871e-02F, -5.074691027e-02F, -2.601463161e-02F, 3.978168368e-01F, -1.131918550e+00F, -2.204058468e-01F, 6.317984313e-02F, -3.643354774e-01F,
+    -6.751132756e-02F, -2.547041886e-02F, -1.067460999e-01F, -1.021504760e+00F, 1.865746975e-01F, -2.507650554e-01F, -5.984197259e-01F, 1.295315772e-01F,
+    -2.547587454e-01F, -6.072937325e-02F, 1.850366890e-01F, 2.690868676e-01F, 4.110781476e-02F, -8.454874158e-02F, -1.153148651e+00F, -5.590910316e-01F,
+    -2.267416939e-02F, -9.828493744e-02F, 2.658106089e-01F, -2.310194224e-01F, -8.923547268e-01F, -1.174021661e-01F, -1.693984419e-01F, -8.947600424e-02F,
+    2.166738808e-01F, -1.299403310e-01F, 3.569811881e-01F, -6.053775549e-02F, 7.941330671e-01F, -2.060912102e-01F, 1.405793726e-01F, 9.542196989e-02F,
+    -6.839476824e-01F, -1.298642874e+00F, -2.731615305e-01F, 6.176215410e-01F, -8.336749673e-01F, -4.540830851e-03F, 7.198858857e-01F, -2.577055097e-01F,
+    -4.198395014e-01F, 1.009437591e-01F, -9.327495843e-02F, -7.891439199e-01F, -3.841173947e-01F, -8.464550972e-02F, 4.848816991e-01F, 6.885509193e-02F,
+    2.490107864e-01F, 2.159098983e-01F, -4.761256278e-02F, -6.435522437e-01F, -8.200239539e-01F, -2.966697514e-01F, -1.844636202e-01F, -4.647446275e-01F,
+    -3.702329397e-01F, 1.117585227e-01F, 8.881185949e-02F, 1.631763875e-01F, 2.176096141e-01F, -5.013383552e-02F, -8.154727817e-01F, -2.391053736e-01F,
+    -6.095660925e-01F, -7.746262848e-02F, 1.592184901e-01F, -5.514644384e-01F, -4.192276895e-01F, 3.275621310e-02F, -2.403052449e-01F, 3.810845912e-01F,
+    -5.337297320e-01F, -5.478776246e-02F, -1.897197962e-01F, -4.648219347e-01F, -6.820880771e-01F, -7.619116455e-02F, -1.794490814e-01F, -8.133316636e-01F,
+    4.337922484e-02F, -2.011288702e-01F, 1.547515988e-01F, 2.702858448e-01F, 2.006303817e-01F, -1.809321791e-01F, 1.247782782e-01F, -6.869829893e-01F,
+    1.110398099e-01F, 2.146494389e-01F, -1.174644753e-01F, 7.463048697e-01F, -4.525958300e-01F, 3.623574227e-02F, -2.475370616e-01F, 6.625393629e-01F,
+    2.073842138e-01F, 1.793207675e-01F, 1.465507746e-01F, 5.116272345e-02F, 2.144102305e-01F, -1.563289613e-01F, 1.510231495e-01F, 1.979757398e-01F,
+    2.109281868e-01F, -6.616712809e-01F, -2.086681500e-02F, 2.710038722e-01F, -1.942314804e-01F, -1.872251928e-01F, 5.215248466e-01F, 2.715682089e-01F,
+    -6.385436058e-01F, -1.703490317e-01F, 1.187450066e-01F, 5.775012821e-02F, -8.305896521e-01F, -8.499781787e-02F, -4.651028216e-01F, -1.819050908e-01F,
+    -7.325423956e-01F, 6.013003737e-02F, -9.000347555e-02F, 1.070505306e-01F, 2.875680029e-01F, 2.592197061e-02F, -2.058008686e-02F, -5.494009852e-01F,
+    2.463374585e-01F, -6.423154473e-02F, -2.613049746e-01F, 4.662641883e-02F, 5.242832303e-01F, -8.713084459e-02F, 1.660362780e-01F, 1.713213325e-02F,
+    -1.442937255e-01F, 9.026627988e-02F, 2.953934073e-01F, -2.537063323e-02F, -1.004726529e+00F, -2.099708468e-01F, -1.428163610e-02F, 9.418223053e-02F,
+    6.365656257e-01F, -6.433153749e-01F, 6.801275164e-02F, 3.233329654e-01F, 4.552675784e-02F, 1.588841155e-02F, -3.983259499e-01F, 1.439287215e-01F,
+    -1.047310710e+00F, -1.740268767e-01F, 1.180334762e-01F, 2.470312119e-01F, 2.495879233e-01F, -1.560836434e-01F, -1.310946494e-01F, -8.559682369e-01F,
+    1.362542212e-01F, 1.059782226e-02F, 1.827344447e-01F, -7.626698166e-02F, -1.502027363e-01F, -1.989670843e-01F, -7.831889987e-01F, 6.480584294e-02F,
+    1.183249503e-01F, 3.378898278e-02F, -1.146994252e-02F, -1.040512919e-01F, -5.431657434e-01F, 7.518281043e-02F, 6.438950300e-01F, 2.752008140e-01F,
+    -1.954658180e-01F, 2.815279067e-01F, -3.623889759e-02F, -2.335448712e-01F, 4.099653959e-01F, -1.056439951e-01F, -1.712558717e-01F, 5.117610097e-01F,
+    -1.021616578e+00F, 1.534149647e-01F, 7.066383958e-02F, -3.102801740e-01F, -1.420230418e-01F, -2.101160586e-01F, 1.860475168e-02F, -2.164216191e-01F,
+    -3.972066566e-03F, -3.345081806e-01F, -2.817247622e-02F, -1.385596037e+00F, -1.220560193e+00F, -5.314312130e-02F, -1.443915129e+00F, -9.259338379e-01F,
+    1.595970243e-02F, 3.439697996e-02F, -2.151806206e-01F, -2.041885853e-01F, -1.690675020e-01F, -2.213713527e-01F, -1.037528157e+00F, 5.797891617e-01F,
+    8.904837817e-02F, -2.911951244e-01F, 2.042510659e-01F, 3.407224715e-01F, -5.095961094e-01F, -2.019222230e-01F, -3.407154083e-01F, -2.317971289e-01F,
+    7.904166728e-02F, -2.505183518e-01F, 3.394616768e-02F, -6.189373732e-01F, -2.566320598e-01F, -7.422752678e-02F, 5.076711774e-01F, 2.321190573e-02F,
+    3.519618213e-01F, -5.974723771e-02F, 1.713267714e-01F, -3.010194302e-01F, 8.342975974e-01F, -1.807285249e-01F, 4.149375856e-01F, 1.162161306e-01F,
+    4.073463380e-02F, -1.037665978e-01F, -2.130046487e-01F, -3.606305718e-01F, -1.080657914e-01F, 1.306146383e-03F, -2.469069809e-01F, 5.169373471e-03F,
+    -2.013074607e-01F, -4.685317352e-02F, 3.554018214e-02F, -4.714223146e-01F, 1.059702337e-01F, -3.233857825e-02F, -3.423516452e-01F, -6.169713140e-01F,
+    -1.153995872e+00F, -5.291739106e-01F, 2.508589327e-01F, -1.647977233e-01F, -1.142391801e+00F, -8.262595534e-02F, -3.439152241e-01F, 2.560149729e-01F,
+    -1.923447847e-02F, 1.112465337e-01F, 1.207834333e-01F, -7.766149193e-02F, 1.494358331e-01F, 6.749125570e-02F, -1.423360258e-01F, -1.329884976e-01F,
+    1.693767011e-01F, -2.916823924e-01F, 1.713272631e-01F, -1.279778481e-01F, -1.381742507e-01F, -7.698863745e-02F, 1.785828769e-01F, 6.806597114e-01F,
+    4.864440560e-01F, 2.061371058e-01F, -6.670989394e-01F, -4.210346937e-01F, -1.004410982e+00F, 1.766229272e-01F, 1.863834411e-01F, 1.288103759e-01F,
+    -5.226641297e-01F, -1.252295170e-02F, 2.063561976e-01F, -5.440299511e-01F, -3.479631245e-01F, -4.698266461e-02F, -2.196615636e-01F, -2.154340744e-01F,
+    -4.044745564e-01F, -3.905786201e-02F, 4.063669741e-01F, -2.691976726e-01F, 8.211629838e-02F, -1.981158704e-01F, 1.173286960e-01F, -1.476035595e+00F,
+    -6.762504578e-01F, 1.596065909e-01F, -3.271045163e-03F, 1.359382868e-01F, -5.065207183e-02F, -1.586513072e-01F, -9.565802291e-03F, -7.678324580e-01F,
+    -2.177789658e-01F, 1.367507577e-01F, 1.267369539e-01F, -4.499749094e-02F, 4.842310771e-02F, -2.494062781e-01F, -9.517229795e-01F, -8.828732371e-01F,
+    -3.333146870e-01F, -1.507591754e-01F, -6.028002128e-02F, 1.865350157e-01F, 8.267218620e-02F, -5.554326996e-02F, -9.765245914e-01F, 2.983891070e-01F,
+    1.639186293e-01F, 1.122466009e-02F, -8.188727312e-03F, -4.950945377e-01F, -1.908014536e+00F, 1.313869357e-01F, 2.018128894e-02F, -2.809613943e-01F,
+    4.450382665e-02F, -2.872362137e-01F, 4.772907495e-02F, -1.672840863e-02F, -1.118812799e+00F, -2.806809843e-01F, -6.681750715e-02F, -1.738876402e-01F,
+    -1.947591454e-01F, 6.051759049e-02F, -2.045246214e-02F, 2.696081102e-01F, 3.727255464e-01F, 8.865858614e-02F, 4.849824905e-01F, 1.139092967e-01F,
+    -1.352159679e-01F, -1.556238085e-01F, -1.202417985e-01F, -9.350358844e-01F, 2.883590162e-01F, -1.066221967e-01F, 3.250454962e-01F, -1.322877705e-01F,
+    -3.055681884e-01F, 1.529303729e-03F, 2.673480809e-01F, -2.573115826e-01F, -2.723233402e-01F, 9.849773720e-03F, 9.239161760e-02F, -9.928290248e-01F,
+    -1.855656356e-01F, -6.486259401e-02F, -1.521882713e-01F, -8.931465149e-01F, -5.234548450e-01F, -1.912639737e-01F, -4.393273890e-01F, 4.846007824e-01F,
+    -6.199124455e-01F, -3.492897376e-02F, 7.333013415e-02F, -9.644773602e-01F, -3.070547879e-01F, -2.284720689e-01F, 2.600595951e-01F, -7.686107755e-01F,
+    2.106373757e-01F, -2.727786601e-01F, 2.888427861e-02F, 4.281465709e-02F, -5.310313404e-02F, 2.255650796e-02F, 2.706825547e-02F, -4.359351099e-01F,
+    -1.590110362e-01F, 7.818953134e-03F, 4.622383416e-02F, -2.297781780e-02F, -7.778193951e-01F, -8.357730508e-02F, -9.016541243e-01F, -3.547850624e-02F,
+    2.747395337e-01F, -1.870461553e-01F, -4.052222967e-01F, -2.399048805e-01F, -1.449951082e-01F, -1.229176819e-01F, -8.575977683e-01F, -2.591554821e-01F,
+    8.276359737e-02F, 4.502397180e-01F, 3.669354320e-01F, 1.168060005e-01F, -6.769131869e-02F, 1.048556939e-01F, -2.448987216e-01F, -6.174376011e-01F,
+    -2.712683678e-01F, 1.657134891e-01F, -6.189257652e-02F, 3.089021146e-01F, -3.369662464e-01F, -7.439397275e-02F, -3.437114060e-01F, -2.675082088e-01F,
+    -3.013365343e-02F, -1.556088775e-01F, -2.864602208e-01F, -3.187290132e-01F, -5.650320053e-01F, -4.897189140e-01F, -7.811756432e-02F, -2.480541915e-02F,
+    2.426680326e-01F, -1.319969296e-01F, -1.134437025e-01F, -1.760816425e-01F, -3.644969761e-01F, -9.050643444e-02F, 1.228918433e-01F, -3.661782444e-01F,
+    3.245773911e-01F, -8.645962477e-01F, -9.245237708e-01F, 2.952291444e-02F, 8.612693101e-02F, 6.276341081e-01F, -5.706370473e-01F, -2.265254706e-01F,
+    3.871245980e-01F, 2.420209795e-01F, -1.649602130e-02F, -3.099787831e-01F, -6.216920018e-01F, -3.774631321e-01F, -3.788681328e-02F, -5.097587109e-01F,
+    6.654089093e-01F, 7.253356576e-01F, -8.136906624e-01F, -8.378972411e-01F, -1.315872818e-01F, -7.272144314e-03F, 3.283703923e-01F, -7.818856239e-01F,
+    -6.717963517e-02F, 3.297228515e-01F, 2.682880163e-01F, 2.917960882e-01F, 2.772720456e-01F, -1.579259038e-01F, -1.467373818e-01F, -1.545493603e-01F,
+    1.748914421e-01F, 2.218201458e-01F, -1.845120490e-01F, 2.429578602e-01F, -1.300011128e-01F, -9.991558194e-01F, 2.118685991e-01F, 7.889617980e-02F,
+    -5.384326577e-01F, -7.418678999e-01F, -1.841799915e-02F, 9.204028547e-02F, 5.892556533e-02F, -2.668301165e-01F, -2.531426549e-01F, 4.713796377e-01F,
+    -6.351364404e-02F, -1.698972732e-01F, -4.819698930e-01F, -2.335865349e-01F, -1.359772235e-01F, -6.636965871e-01F, -7.598751783e-02F, -1.056566238e+00F,
+    4.724722803e-01F, -6.201782227e-01F, 1.754339784e-01F, -1.567217231e+00F, -8.462072350e-03F, 2.683886141e-02F, 9.675302356e-02F, -4.877268970e-01F,
+    -3.286734689e-03F, 1.283596754e-01F, -3.168486804e-02F, -8.117606491e-02F, -9.065667391e-01F, 2.082593739e-01F, 7.135991007e-02F, -5.482292175e-01F,
+    -2.515584528e-01F, -2.337485105e-01F, -3.156816959e-01F, 1.741946936e-01F, 1.243576929e-01F, -1.882028133e-01F, 8.650632948e-02F, -5.956666470e-01F,
+    -6.248075962e-01F, -2.163472414e+00F, 3.004524857e-02F, -5.462566018e-01F, 1.069467366e-01F, 3.603635728e-01F, -2.377383411e-01F, 2.968117297e-01F,
+    -4.200850427e-01F, 3.967705071e-01F, 2.620377839e-01F, -4.657286108e-01F, -3.720235229e-01F, 1.557632834e-01F, 1.265818253e-02F, -3.586537540e-01F,
+    -4.720003903e-01F, -1.533912659e+00F, -1.324993521e-01F, -3.924316168e-01F, 2.778689861e-01F, 3.308381513e-02F, 1.474451572e-01F, 2.487030923e-01F,
+    6.003803015e-02F, -6.664895415e-01F, -9.461774826e-01F, 1.654722691e-01F, 3.906286061e-01F, 2.207656950e-01F, -7.902213931e-02F, 9.791356921e-01F,
+    -3.508732915e-01F, 6.241621822e-02F, -6.126501560e-01F, -7.860640287e-01F, -7.697810531e-01F, 4.362906143e-02F, -8.227474689e-01F, -8.789272308e-01F,
+    1.753476262e-01F, -2.667367756e-01F, 2.428152598e-02F, -2.812364995e-01F, 2.257264555e-01F, 1.233525127e-01F, -5.831607431e-02F, -1.554488093e-01F,
+    1.792925596e-01F, -1.255161613e-01F, 5.836278573e-02F, 1.772014350e-01F, -1.195160374e-01F, 5.267494321e-01F, 2.765556574e-01F, 1.108301356e-01F,
+    1.742256433e-02F, -4.519879818e-01F, 5.361440778e-02F, 1.739701480e-01F, -1.443555355e-01F, -7.949084640e-01F, 6.486270577e-02F, 2.688252628e-01F,
+    -6.329304576e-01F, -1.381559610e+00F, -9.279013425e-02F, 1.480642408e-01F, -5.860812590e-02F, -2.385744303e-01F, -2.460851967e-01F, -2.987606823e-01F,
+    3.798327595e-02F, 6.135194302e-01F, -5.514131188e-01F, 6.215517968e-02F, -7.521920204e-01F, 1.831704378e-01F, 1.745524108e-01F, 7.923699617e-01F,
+    1.392570287e-01F, 1.767693013e-01F, 3.769739866e-01F, 1.865857393e-01F, 6.475856900e-02F, -6.860823631e-01F, -1.297132205e-02F, -9.973958731e-01F,
+    4.339435995e-01F, -3.674386144e-01F, -5.287976265e-01F, -2.830389142e-01F, -8.632104993e-01F, -1.460049003e-01F, -2.538380027e-01F, 5.179737229e-03F,
+    6.210831925e-03F, -1.349815875e-01F, 3.105784953e-02F, 2.035705000e-01F, -1.449326724e-01F, 1.762556136e-01F, 1.352740228e-01F, -4.400925338e-02F,
+    -7.420368791e-01F, -5.135614797e-02F, 1.544738412e-01F, 3.553123772e-01F, -5.977624059e-01F, -9.428326488e-01F, -1.934405603e-02F, -3.376067877e-01F,
+    5.370751023e-02F, -2.378449440e-01F, -1.348452419e-01F, -1.200337932e-01F, 2.423285395e-01F, -3.144466132e-02F, 2.307033241e-01F, -1.948627830e-01F,
+    7.458710670e-02F, 3.362494409e-01F, 2.800435126e-01F, -6.460381299e-02F, -6.119937450e-02F, -9.836531281e-01F, -7.023270428e-02F, -2.927631140e-01F,
+    -3.966453373e-01F, -6.978525519e-01F, 2.626633942e-01F, -1.764235348e-01F, -4.471687078e-01F, 1.668842393e-03F, 3.716400266e-01F, 3.551301062e-01F,
+    -5.288752913e-01F, -5.284096599e-01F, 3.397118747e-01F, 1.068295464e-01F, -1.024543524e+00F, -1.991099305e-02F, -3.242963552e-01F, -1.748684943e-01F,
+    3.759495914e-01F, 5.657639503e-01F, 3.692646921e-01F, -9.939146787e-02F, -3.399020731e-01F, 4.081697762e-01F, -9.000774026e-01F, -3.561889827e-01F,
+    -2.536706328e-01F, -1.574621558e+00F, 3.588483632e-01F, -9.896194190e-02F, 3.966952860e-01F, -6.763171554e-01F, -2.185827792e-01F, -4.534415007e-01F,
+    4.637324214e-01F, -5.027145743e-01F, 3.832801059e-02F, -4.626640677e-01F, -4.394882917e-01F, -1.639362276e-01F, 1.540718228e-01F, -1.399562061e-01F,
+    -8.949330449e-01F, -2.959805131e-01F, -4.225595593e-01F, -6.916216016e-02F, -7.680799365e-01F, -1.254203320e-01F, -2.393721491e-01F, 2.625014782e-01F,
+    -9.798098207e-01F, 2.379606962e-01F, 4.810183346e-01F, -7.023824751e-02F, -7.551935315e-01F, -1.934438646e-01F, -1.093208313e+00F, -1.526213437e-01F,
+    2.043792903e-01F, -8.172707558e-01F, 1.301835328e-01F, -7.010877877e-02F, 1.291394234e-01F, -1.072272420e+00F, 2.436269075e-01F, -4.929592907e-01F,
+    4.145709872e-01F, -9.065607786e-01F, -2.157602161e-01F, 2.407092303e-01F, -3.569468111e-02F, 3.725804016e-02F, 4.680338204e-01F, -8.938614279e-02F,
+    2.940482795e-01F, -6.569200158e-01F, -5.988176465e-01F, 6.211871505e-01F, -3.291709721e-01F, -3.099222668e-02F, 4.247530699e-01F, 3.792654574e-01F,
+    3.029721379e-01F, 1.201738939e-01F, -2.479282469e-01F, 2.121644318e-01F, 5.375982523e-01F, 6.305910349e-01F, -2.222784013e-01F, 6.553170085e-01F,
+    2.133025080e-01F, -7.039423585e-01F, -2.371493280e-01F, 6.693375856e-02F, 2.623280585e-01F, 1.215822771e-01F, -1.985567510e-01F, 2.796996757e-02F,
+    6.257398725e-01F, 3.333379924e-01F, 4.254240990e-01F, 5.878713131e-01F, 3.800557926e-02F, -9.861776829e-01F, -1.254675150e+00F, -8.869325519e-01F,
+    -1.106002092e+00F, -1.048513055e+00F, -3.407131732e-01F, -8.489481211e-01F, 4.912166670e-02F, 1.496374607e-01F, -3.776887357e-01F, -1.456337273e-01F,
+    -5.594558120e-01F, 5.084288120e-02F, 1.494952440e-01F, 1.877494603e-01F, -9.760346413e-01F, -8.604761362e-01F, -1.686155200e-01F, -5.651891828e-01F,
+    2.390007824e-01F, -7.376803160e-01F, 5.945165455e-02F, 5.330754071e-02F, -3.725191355e-01F, -2.847521007e-01F, -8.855722547e-01F, 1.711976379e-01F,
+    1.770949960e-01F, 1.723130606e-02F, 3.981504589e-02F, 1.392632276e-01F, -6.059104204e-02F, -1.463931203e-01F, -2.429165542e-01F, 1.153923944e-02F,
+    -1.788308620e-01F, -1.814582348e-01F, 2.407584153e-02F, 4.209277928e-01F, -1.361756213e-02F, -7.732005119e-01F, 5.199386552e-02F, -4.030523598e-01F,
+    -4.209758043e-01F, 6.951674819e-01F, -3.520993292e-01F, 9.812305123e-02F, -1.070306152e-01F, -9.781612158e-01F, -6.107449159e-02F, -6.771163940e-01F,
+    -1.025692448e-01F, 6.798844784e-02F, 6.939923167e-01F, 3.249030709e-01F, -8.118762970e-01F, -3.895954788e-02F, 2.913109213e-02F, -1.459225863e-01F,
+    -1.331933886e-01F, -1.374375343e+00F, -5.861985311e-02F, -3.620100617e-01F, -2.910979390e-01F, -7.719846964e-01F, 6.907196343e-02F, -2.391155660e-01F,
+    9.932353348e-02F, -1.096472666e-01F, 1.460456848e-01F, -3.808640242e-01F, 7.670395076e-02F, -4.759335518e-01F, 3.067054972e-02F, -1.734502614e-02F,
+    -1.590576917e-01F, 4.159530103e-01F, 4.483856633e-02F, 2.810657211e-02F, 3.909024224e-02F, 3.774132729e-01F, 1.871761307e-02F, 2.920636237e-01F,
+    6.980706006e-03F, -9.583393335e-01F, -6.189894080e-01F, 3.658481687e-02F, 8.937842399e-02F, -7.413958758e-02F, 1.113885716e-01F, -5.642708540e-01F,
+    -1.303316467e-02F, -1.386143267e-01F, 2.914363742e-01F, -7.910014130e-03F, 1.103909127e-02F, -8.590871692e-01F, 7.554033399e-02F, -3.678717837e-02F,
+    -3.778012693e-01F, -6.678169370e-01F, -3.588871062e-01F, 9.877606481e-02F, -1.675182721e-03F, -3.474560976e-01F, -1.356386691e-01F, 2.779764533e-01F,
+    2.497417480e-01F, 2.712419033e-01F, -3.944303393e-01F, -3.421250880e-01F, -1.994797140e-01F, -2.890794575e-01F, 1.887794733e-01F, -5.113238692e-01F,
+    -7.565582395e-01F, -1.000856519e+00F, -1.657221168e-01F, -6.987996399e-02F, -5.434002727e-02F, -4.740507007e-01F, 1.590513885e-01F, -2.891049981e-01F,
+    -8.384758830e-01F, 3.748831451e-01F, 1.023636460e-01F, 3.591074049e-02F, -4.751275182e-01F, 2.235152423e-01F, 1.846091002e-01F, 5.753761902e-02F,
+    3.311582804e-01F, -7.584997416e-01F, -3.283596039e-01F, -4.961923063e-01F, 4.521603510e-02F, -1.779313982e-01F, 5.585077032e-02F, -3.140246570e-01F,
+    -1.589057595e-01F, -1.007482260e-01F, 3.455966711e-02F, 2.085066289e-01F, -2.093764208e-02F, 2.626900375e-01F, -2.617920339e-01F, -9.412881732e-01F,
+    9.326853324e-04F, -8.227308393e-01F, 4.124566317e-01F, 4.400162399e-01F, 3.562077284e-01F, 4.721485078e-02F, -1.117008328e+00F, -1.135661677e-01F,
+    -6.331534386e-01F, 3.480431437e-01F, 1.629860699e-01F, 3.170231283e-01F, -6.427969337e-01F, -1.798262447e-01F, -3.747102916e-01F, -5.575769544e-01F,
+    -7.832582593e-01F, 4.796443284e-01F, -3.411237895e-02F, 2.763114870e-01F, 8.420435190e-01F, 7.720314860e-01F, -1.082477276e-03F, -3.792625964e-01F,
+};
+
+alignas(64) static float const ntm_aot_layer_3_biases[64] = {
+    -5.512754321e-01F, 5.365128517e-01F, 2.835154533e-01F, -6.175070405e-01F, -4.823808372e-01F, -1.100757003e+00F, 4.694220126e-01F, 9.594291449e-02F,
+    7.043668535e-03F, -5.970358476e-02F, 7.795464396e-01F, 1.314604521e+00F, -1.404198259e-01F, 1.891778708e+00F, 1.124332666e+00F, -8.960639834e-01F,
+    -1.855430961e+00F, -2.129026949e-01F, -1.043998718e+00F, -7.487952709e-01F, -5.325675607e-01F, -1.877831668e-01F, 3.623692393e-01F, -5.397838950e-01F,
+    -1.223734975e+00F, -1.010809541e+00F, -1.170591593e+00F, -1.479961723e-01F, 4.891986549e-01F, 8.809825778e-01F, -1.853382826e+00F, -4.733568728e-01F,
+    8.018221855e-01F, -1.422551632e+00F, 2.595299780e-01F, 4.514352083e-01F, -5.406781286e-02F, -4.411732852e-01F, -3.003329784e-02F, -2.714795470e-01F,
+    1.461890340e-01F, -4.548855722e-01F, -6.012306809e-01F, 1.972816288e-01F, 1.123027727e-01F, 1.238612905e-01F, 4.029232264e-01F, 1.081461668e+00F,
+    -2.109877616e-01F, -6.002260447e-01F, 1.244597077e+00F, 3.515774608e-01F, -1.020414308e-01F, -3.314573169e-01F, -6.880666614e-01F, 3.197191656e-01F,
+    3.995428979e-02F, -1.305157505e-02F, -8.116442710e-02F, -4.303103983e-01F, 7.493838668e-01F, -3.312459216e-02F, 2.733879164e-02F, 1.445187479e-01F,
+};
+
+static inline void ntm_aot_layer_3(float const *in_activations, float *out_activations)
+{
+    // outputs [0, 8)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_3_biases[0]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_3_biases[1]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_3_biases[2]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_3_biases[3]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_3_biases[4]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_3_biases[5]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_3_biases[6]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_3_biases[7]);
+
+        float const *const panel_weights = ntm_aot_layer_3_weights + 0U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 0U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 1U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 2U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 3U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 4U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 5U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 6U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 7U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [8, 16)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_3_biases[8]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_3_biases[9]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_3_biases[10]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_3_biases[11]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_3_biases[12]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_3_biases[13]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_3_biases[14]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_3_biases[15]);
+
+        float const *const panel_weights = ntm_aot_layer_3_weights + 512U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 8U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 9U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 10U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 11U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 12U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 13U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 14U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 15U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [16, 24)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_3_biases[16]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_3_biases[17]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_3_biases[18]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_3_biases[19]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_3_biases[20]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_3_biases[21]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_3_biases[22]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_3_biases[23]);
+
+        float const *const panel_weights = ntm_aot_layer_3_weights + 1024U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 16U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 17U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 18U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 19U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 20U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 21U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 22U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 23U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [24, 32)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_3_biases[24]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_3_biases[25]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_3_biases[26]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_3_biases[27]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_3_biases[28]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_3_biases[29]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_3_biases[30]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_3_biases[31]);
+
+        float const *const panel_weights = ntm_aot_layer_3_weights + 1536U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 24U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 25U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 26U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 27U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 28U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 29U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 30U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 31U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [32, 40)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_3_biases[32]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_3_biases[33]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_3_biases[34]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_3_biases[35]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_3_biases[36]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_3_biases[37]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_3_biases[38]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_3_biases[39]);
+
+        float const *const panel_weights = ntm_aot_layer_3_weights + 2048U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 32U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 33U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 34U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 35U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 36U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 37U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 38U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 39U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [40, 48)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_3_biases[40]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_3_biases[41]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_3_biases[42]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_3_biases[43]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_3_biases[44]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_3_biases[45]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_3_biases[46]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_3_biases[47]);
+
+        float const *const panel_weights = ntm_aot_layer_3_weights + 2560U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 40U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 41U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 42U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 43U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 44U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 45U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 46U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 47U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [48, 56)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_3_biases[48]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_3_biases[49]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_3_biases[50]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_3_biases[51]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_3_biases[52]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_3_biases[53]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_3_biases[54]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_3_biases[55]);
+
+        float const *const panel_weights = ntm_aot_layer_3_weights + 3072U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 48U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 49U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 50U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 51U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 52U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 53U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 54U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 55U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [56, 64)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_3_biases[56]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_3_biases[57]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_3_biases[58]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_3_biases[59]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_3_biases[60]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_3_biases[61]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_3_biases[62]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_3_biases[63]);
+
+        float const *const panel_weights = ntm_aot_layer_3_weights + 3584U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 56U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 57U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 58U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 59U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 60U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 61U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 62U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 63U, ntm_aot_relu(accumulator_7));
+    }
+}
+
+// 64 x 64 (relu)
+alignas(64) static float const ntm_aot_layer_4_weights[4096] = {
+    -1.252483279e-01F, 1.308269054e-01F, 6.808537245e-02F, -6.400336046e-03F, -7.728520036e-02F, 1.957728118e-01F, 1.259765923e-01F, -3.013088405e-01F,
+    -1.234751225e+00F, -5.239745975e-02F, -1.138638109e-01F, -6.717704237e-02F, -1.076365858e-01F, 5.201129243e-03F, -1.511593233e-03F, -1.302304268e-01F,
+    -5.009503961e-01F, -9.685575217e-02F, 5.624093581e-03F, -1.948277503e-01F, 7.319342694e-04F, -2.742425911e-02F, -2.682920694e-01F, -4.664601982e-01F,
+    -2.285771370e-01F, -6.320154760e-03F, 7.222864032e-02F, -1.352706403e-01F, -9.123427421e-02F, -1.802321337e-02F, -3.490027413e-02F, 1.138339788e-01F,
+    2.350308299e-01F, -2.031626254e-01F, 7.195583731e-02F, 2.229893208e-02F, -5.059329327e-03F, -1.189444587e-01F, -7.260995358e-02F, -4.750703275e-01F,
+    3.668095171e-01F, -5.701663718e-02F, -1.548912078e-01F, -2.362572700e-01F, 1.738758571e-02F, -2.060942501e-01F, 1.685481519e-02F, -3.807977140e-01F,
+    -6.144805551e-01F, 5.527320877e-02F, -1.032236591e-01F, -1.996186823e-01F, 5.890016444e-03F, 4.188005999e-02F, -1.609547585e-01F, -3.045857251e-01F,
+    4.674184620e-01F, 4.126035795e-02F, -4.569346085e-02F, -1.325197220e-01F, -1.306584477e-02F, -1.728837043e-01F, -6.804201286e-03F, 5.652260035e-02F,
+    5.466039181e-01F, -4.337979481e-02F, 6.416594982e-02F, -1.618553102e-01F, -3.279503882e-01F, 2.902134147e-04F, -2.139052302e-01F, -5.586384609e-02F,
+    2.282607406e-01F, -4.472942557e-03F, -4.181734845e-02F, -2.425667048e-01F, 4.408999160e-02F, -3.069409728e-01F, 1.680385694e-02F, -5.098906755e-01F,
+    -1.258476257e+00F, 6.754285656e-03F, 9.904913604e-02F, -3.560860455e-01F, -3.680030629e-02F, -1.169947237e-01F, 3.193686903e-02F, -2.768609226e-01F,
+    -1.885379702e-01F, -2.062850744e-01F, -2.305493690e-02F, -1.216133833e-01F, -3.214714304e-02F, -1.356447786e-01F, -1.222203821e-01F, -7.836925983e-01F,
+    5.693930015e-02F, 4.618392140e-02F, 1.360948980e-01F, -1.723579466e-01F, 3.521192819e-02F, -2.140890211e-01F, -2.125618048e-02F, -1.567700952e-01F,
+    -8.422955126e-02F, -1.864371747e-01F, -2.427442968e-01F, -5.568224788e-01F, -2.847083807e-01F, -1.860479414e-01F, -1.726799011e-01F, -1.679856032e-01F,
+    -1.433846205e-01F, -1.361514479e-01F, 7.753250748e-02F, -4.862539172e-01F, -6.154036964e-04F, -1.132366061e-01F, -1.211295351e-01F, 6.441357732e-02F,
+    -4.850535989e-01F, -1.621799469e-01F, 9.251838923e-02F, -2.972749174e-01F, -4.805504344e-03F, -6.833381951e-02F, -3.089925088e-02F, -2.464533001e-01F,
+    5.602166057e-01F, -2.567969263e-01F, 6.515129656e-02F, 4.743836448e-02F, -4.601667449e-02F, 7.334162295e-02F, 7.737579942e-02F, -3.954832554e-01F,
+    3.059658967e-02F, -1.687439680e-01F, -5.062353611e-02F, 1.038192138e-01F, -3.324737027e-02F, 1.212951392e-01F, -1.555666029e-01F, 1.541781425e-01F,
+    -6.517979503e-02F, 3.134550154e-02F, 2.951612510e-02F, 1.013466269e-01F, -3.855877742e-02F, -1.065455824e-01F, -1.086206511e-01F, -5.283110216e-02F,
+    -8.636670560e-02F, -2.398268133e-01F, -2.257772684e-01F, -1.846264005e-01F, 4.762266204e-02F, -5.580445752e-02F, 4.494018853e-02F, 1.011502147e-01F,
+    2.205597758e-01F, -1.822301373e-02F, 2.209389210e-01F, 1.093105376e-01F, -3.356133029e-02F, 4.039700702e-02F, -2.020484954e-01F, -1.534773409e-01F,
+    -3.145716339e-02F, -4.162082076e-02F, 8.330727369e-02F, -2.162941545e-01F, -3.032236993e-01F, 1.329471767e-01F, -5.798365176e-02F, -4.066419303e-01F,
+    1.120927855e-01F, -1.493169367e-01F, 1.000145674e-01F, 1.048701629e-01F, 6.851723790e-02F, -2.777010761e-02F, -1.779725850e-01F, 4.204417765e-02F,
+    -7.711978555e-01F, -1.941839457e-01F, -6.679064035e-02F, -7.125214934e-01F, -4.490837753e-01F, 5.857938901e-02F, -2.483803928e-01F, -2.083928138e-01F,
+    -5.488343835e-01F, -1.031695977e-01F, -5.384822190e-02F, -2.774114488e-03F, -2.824957483e-02F, -5.856282264e-02F, -1.689837277e-01F, -6.777641177e-01F,
+    1.109765694e-01F, -1.008482426e-01F, -4.396228790e-01F, -1.881212145e-01F, 1.809715182e-01F, -2.964106761e-02F, -2.076137662e-01F, -1.077120379e-01F,
+    -6.904951334e-01F, 1.185617130e-02F, 8.761162311e-02F, -2.002308965e-01F, -3.368756473e-01F, -2.685973644e-01F, 2.796241082e-02F, -4.080287516e-01F,
+    -9.150534868e-01F, 6.114148721e-02F, 2.428315766e-02F, 8.399472386e-02F, 4.693414271e-02F, -3.413446248e-01F, -6.346199661e-02F, -7.624137998e-01F,
+    1.428478509e-01F, -1.363431960e-01F, -1.357699186e-01F, -2.540847659e-01F, -3.153584525e-02F, -2.209002972e-01F, -1.262557507e-01F, -2.973693311e-01F,
+    3.750101924e-01F, -2.539990544e-01F, 7.606474310e-02F, -1.610446721e-01F, 4.832108691e-02F, -5.654646084e-02F, -1.326260157e-02F, 1.710076779e-01F,
+    -7.262777686e-01F, -1.206804588e-01F, 6.691011041e-02F, -1.372207999e-01F, -9.385607392e-02F, -2.929437160e-02F, 8.014888503e-03F, 9.753611870e-03F,
+    -1.012619376e+00F, 1.520066801e-02F, -7.029032335e-03F, 7.628538460e-02F, -1.730939895e-01F, 1.038400009e-01F, -4.320580978e-03F, -7.121869326e-01F,
+    -8.466222882e-01F, -1.551967412e-01F, 1.062662378e-01F, -1.135617793e-01F, 4.293640144e-03F, -2.084006965e-01F, -9.692326933e-02F, 3.203966469e-02F,
+    2.751768529e-01F, 4.857628047e-02F, -1.734314114e-01F, -1.094157100e-01F, 4.457904026e-02F, 4.800954089e-02F, -2.910028398e-02F, 2.131325006e-01F,
+    -9.249900281e-02F, 3.976108134e-02F, -1.064268574e-01F, -5.207264051e-02F, -1.567852199e-01F, -5.430281162e-02F, -4.000201449e-02F, 2.845355123e-02F,
+    -2.307680261e-04F, 1.515081385e-04F, -2.200506926e-01F, -1.077163871e-02F, -7.042018231e-03F, -1.509890109e-01F, -1.079847291e-01F, -1.080847066e-02F,
+    -5.227843672e-02F, -3.561569378e-02F, -6.119444594e-02F, -2.016563565e-01F, 2.876519971e-02F, 1.809234731e-02F, 3.972580656e-03F, -6.627938747e-01F,
+    5.140700936e-02F, -2.218966931e-01F, -2.028025538e-01F, -1.302788258e-01F, -2.072744966e-01F, -2.164490670e-01F, -2.232581079e-01F, 3.473811597e-02F,
+    -2.285018563e-01F, 3.431566432e-02F, 1.010682359e-01F, -3.534666449e-02F, 3.161568567e-02F, -6.208867766e-03F, -1.566391587e-01F, 1.876302660e-01F,
+    -4.961686730e-01F, -1.144144088e-01F, -1.504921615e-01F, -4.660758376e-01F, 8.078345098e-03F, -8.577046543e-02F, -1.512106787e-02F, -4.468014091e-02F,
+    -3.063843250e-01F, -1.751088202e-01F, -1.977702603e-02F, -8.887264132e-02F, -3.634373099e-02F, -9.045359492e-02F, -9.573115408e-02F, -3.845273554e-01F,
+    -4.093255997e-01F, -1.876863092e-01F, -1.388048679e-01F, -5.167754367e-03F, 1.903542727e-01F, 3.518821299e-02F, -1.721808314e-01F, -3.954526484e-01F,
+    -1.517720073e-01F, 5.632162094e-02F, 1.741892248e-01F, 2.801204473e-02F, -4.966306686e-02F, 7.142867893e-02F, 1.201611683e-01F, -2.270815820e-01F,
+    -2.721455693e-01F, -1.544166636e-02F, 6.767827272e-02F, -4.622780085e-01F, 3.084737062e-02F, -4.762538522e-02F, -6.924045086e-02F, -5.580473542e-01F,
+    -6.433492899e-01F, -1.731432378e-01F, -2.442968190e-01F, -1.609437317e-01F, 3.357859328e-03F, -1.501462907e-01F, -1.628095210e-01F, 7.315009087e-02F,
+    1.516727358e-01F, 2.356483415e-02F, 3.523063660e-01F, -1.308498830e-01F, 1.926718354e-01F, -1.993450224e-01F, -6.655949634e-03F, -1.925895661e-01F,
+    2.703525499e-02F, 1.150448546e-01F, 2.995616794e-01F, 1.297690868e-01F, -9.528312832e-02F, -1.548386514e-01F, -4.910927732e-03F, 2.512646317e-01F,
+    2.539542019e-01F, -2.352810800e-01F, -4.723430146e-03F, -5.183467865e-01F, -3.649133071e-02F, -1.935178787e-01F, -1.519351453e-01F, -2.857372761e-01F,
+    -1.342918724e-01F, -1.648697108e-01F, 1.509668529e-01F, 8.996693790e-02F, -1.526166499e-01F, -2.535215579e-02F, -1.187735647e-01F, -3.855685890e-02F,
+    -3.262825906e-01F, -2.534669936e-01F, 1.323093027e-01F, -4.624517262e-01F, 2.026339062e-02F, -4.026509225e-01F, -6.282351911e-02F, -1.634137481e-01F,
+    -3.791493773e-01F, -2.527725399e-01F, 1.170198545e-01F, -4.635250196e-02F, 1.267104298e-01F, -3.623702228e-01F, -3.783707321e-01F, -7.477065176e-02F,
+    2.261343896e-01F, 8.993955702e-02F, 4.312591255e-02F, 2.033679783e-01F, 3.763269633e-02F, -2.481698990e-02F, -1.716985106e-01F, -6.351045966e-01F,
+    -3.815785646e-01F, -2.274716944e-01F, -6.719377637e-02F, -4.880688153e-03F, 2.303720638e-02F, 4.303318635e-02F, -3.572150692e-02F, -1.859118640e-01F,
+    -6.863100082e-02F, 1.840292960e-01F, -8.880310506e-02F, 3.797034547e-02F, -1.453920733e-02F, -1.149128154e-01F, -4.939280450e-02F, -3.996374458e-02F,
+    1.494898349e-01F, 4.602114484e-02F, 2.419321388e-01F, 1.300870180e-01F, 9.070032090e-02F, -2.509702742e-01F, -2.495726049e-01F, 2.730253637e-01F,
+    6.918036938e-02F, -3.128191456e-02F, 1.200234517e-01F, -1.432021260e-01F, -2.790223658e-01F, -1.131161023e-02F, 4.742365330e-02F, 9.666150808e-02F,
+    -5.203699470e-01F, -1.988814324e-01F, 1.463719737e-02F, -1.829176396e-01F, -3.155889362e-02F, 8.046820760e-02F, -8.885305375e-02F, -4.096437097e-01F,
+    1.824913919e-01F, -2.341088839e-02F, -1.788724214e-02F, -1.961296350e-01F, -1.273702234e-01F, -2.014505863e-01F, -1.536995173e-01F, -9.717626125e-02F,
+    -4.538740814e-01F, -2.845652401e-01F, 4.045465216e-02F, -4.896113873e-01F, -2.580377832e-02F, -1.938773394e-01F, -2.669106424e-01F, -3.735187054e-01F,
+    -1.343032569e-01F, -3.775100037e-02F, -1.032675803e-01F, -5.934897810e-02F, -4.076186568e-02F, -1.658078432e-01F, -8.277302235e-02F, -1.432345659e-01F,
+    -4.383813590e-02F, -7.183503360e-02F, -2.714862823e-01F, -1.957103759e-01F, 1.427615806e-02F, -2.950713970e-02F, -1.638413519e-01F, 4.564003348e-01F,
+    -1.959641874e-01F, -2.662674710e-02F, -6.759133339e-01F, -3.996344805e-01F, -1.592250317e-01F, 1.071220040e-01F, -1.426478475e-01F, -4.541229606e-01F,
+    -8.971646428e-01F, -1.147726029e-01F, 9.091161937e-02F, -4.286465049e-02F, -1.309220493e-02F, -1.122506261e-01F, -1.912204474e-01F, -4.647454917e-01F,
+    -3.739002645e-01F, -7.064837217e-02F, 7.437141240e-02F, -2.329142839e-01F, 2.584946528e-02F, -2.856963873e-01F, -3.086180687e-01F, -3.221796826e-02F,
+    -1.603524834e-01F, 1.762484759e-01F, -6.449077278e-02F, -1.475669593e-01F, -1.230006590e-01F, -3.222859204e-01F, 2.240436971e-01F, -6.220855117e-01F,
+    -2.176204175e-01F, -2.159197330e-01F, 1.652379185e-01F, -5.910533667e-01F, -1.089688540e-01F, -3.365132809e-01F, 9.776011109e-02F, -1.940017641e-01F,
+    -2.684668601e-01F, -2.213228494e-01F, 2.172913169e-03F, 1.072140634e-01F, -4.361144304e-01F, -2.941943407e-01F, 2.427512407e-01F, -1.095005989e+00F,
+    -2.075326256e-02F, 1.434619725e-01F, -2.242729068e-01F, -6.416423917e-01F, 3.788045421e-02F, -2.898503542e-01F, 2.205051184e-01F, -3.903824091e-01F,
+    -2.430211306e-01F, 2.628334612e-02F, -1.616535336e-01F, -2.172968537e-01F, -6.041430235e-01F, 2.440615892e-01F, 6.839873642e-02F, -1.172874272e-01F,
+    6.632351875e-02F, 7.928311825e-03F, -1.689791977e-01F, 3.209152259e-03F, -2.426325381e-01F, -1.391918510e-01F, -1.320990026e-01F, -9.403326362e-02F,
+    -1.469473392e-01F, -1.068579629e-01F, -5.205411091e-02F, -5.067480206e-01F, -1.924066991e-01F, -2.360180616e-01F, 1.140902564e-01F, -8.886340261e-02F,
+    -5.774818361e-02F, -1.941098422e-01F, -1.955232173e-01F, 1.915376931e-01F, 2.909019962e-02F, -3.761046529e-01F, -8.931077719e-01F, -3.933319449e-01F,
+    -2.059027106e-01F, 6.439626217e-02F, -7.275904715e-02F, -3.084062599e-02F, 1.046601385e-01F, -1.011946440e+00F, -3.573617041e-01F, -1.010981798e+00F,
+    -3.139450774e-02F, -7.765564322e-02F, -6.398475170e-01F, -6.334199756e-02F, -1.616617292e-02F, -5.650580302e-02F, -1.167687625e-01F, -4.558743834e-01F,
+    -6.318688393e-02F, -1.412378997e-01F, -8.525540680e-02F, -3.470651805e-01F, -5.594528317e-01F, -4.436723888e-01F, -1.712185293e-01F, 1.699025184e-01F,
+    -1.894220412e-01F, -1.683717817e-01F, -1.932626963e-01F, -4.485763609e-01F, 5.522903055e-03F, -3.648263812e-01F, -1.015144140e-01F, -1.069627553e-01F,
+    -1.381772459e-01F, -2.652329504e-01F, -6.382699609e-01F, 1.810745895e-01F, 1.666626036e-01F, -2.318866365e-02F, 8.093126863e-02F, -4.884815216e-02F,
+    -1.577785760e-01F, -1.511853188e-01F, -5.430181623e-01F, -4.280908406e-01F, -3.226065040e-01F, -5.013672635e-02F, 4.811130837e-02F, -3.043244965e-02F,
+    -1.576978415e-01F, -1.873290539e-01F, -4.055550098e-01F, -1.463343948e-01F, -2.580268085e-01F, -2.895907126e-02F, -2.857964933e-01F, -2.259989679e-01F,
+    -5.106137320e-02F, -7.709910721e-02F, -7.597452495e-03F, -2.682048380e-01F, -2.445608377e-01F, -1.291433811e+00F, -1.674424708e-01F, 7.755191624e-02F,
+    4.630548507e-02F, 1.383095980e-01F, -2.232306153e-01F, -1.313237250e-01F, -3.298063949e-02F, -3.297107294e-02F, -8.611807972e-02F, -7.807865143e-01F,
+    -1.544066072e-01F, -1.332903653e-01F, 1.638728529e-01F, -4.275551066e-02F, 4.302771389e-02F, 1.286966503e-01F, -1.925580055e-01F, 1.962158531e-01F,
+    -1.572629362e-01F, 7.647320628e-02F, -1.831675172e-01F, 4.688417166e-02F, -5.357980728e-01F, -7.805065066e-02F, -1.959462166e-01F, -6.406292915e-01F,
+    -2.302131802e-01F, -1.684181541e-01F, 4.367508367e-02F, -4.691724479e-01F, -3.543887436e-01F, -3.211288750e-01F, -2.381127030e-01F, -4.207515344e-02F,
+    -1.650440395e-01F, -1.471316069e-01F, 1.896841675e-01F, 4.552253783e-01F, -2.902609110e-01F, 2.802273333e-01F, -2.822432518e-01F, 3.784253299e-01F,
+    3.790291399e-02F, 9.527067654e-03F, -5.772153735e-01F, -2.786667943e-01F, -6.560917497e-01F, 6.988570094e-02F, -7.475407720e-01F, -5.811750889e-02F,
+    -3.272948414e-02F, 6.852196157e-02F, -2.607165277e-01F, 4.574033320e-01F, -3.544012308e-01F, -6.098471954e-02F, -8.916231394e-01F, 1.224933285e-02F,
+    9.053120017e-02F, 1.567964628e-02F, 3.816517070e-02F, -4.599347115e-01F, -3.320184946e-01F, 1.167413890e-01F, -3.936837614e-01F, -3.420865238e-01F,
+    -5.819358304e-02F, -5.683508888e-02F, -1.381217688e-01F, -4.074900448e-01F, -5.716768652e-02F, -3.520001099e-02F, -1.804233640e-01F, -4.552182853e-01F,
+    -1.049620584e-01F, -3.261623904e-02F, 2.584905922e-01F, -5.379855633e-01F, -2.995195687e-01F, 4.049908817e-01F, -1.206232384e-01F, -9.786355495e-01F,
+    -8.219376951e-02F, 5.015553907e-02F, -4.821456075e-01F, -8.440465331e-01F, -4.665265679e-01F, -1.973613910e-02F, 3.938372433e-02F, 1.391659118e-02F,
+    -2.201591730e-01F, -1.872506738e-01F, -2.257012725e-01F, 1.800862998e-01F, 2.372047007e-01F, 6.104543805e-01F, -5.022169948e-01F, 1.875176653e-02F,
+    -8.318229765e-02F, -2.086780965e-01F, -2.098397762e-01F, -6.265137792e-01F, 7.179758698e-02F, -5.130968690e-01F, 4.259899631e-02F, -1.880207062e-01F,
+    -2.759033144e-01F, 3.251948953e-02F, -3.678625226e-01F, 6.433504820e-02F, -7.328773141e-01F, -2.336439211e-03F, -7.716161013e-01F, -7.382708788e-01F,
+    -5.715830997e-02F, 8.352773264e-03F, -3.587881848e-02F, -2.844879925e-01F, -4.520307109e-02F, -1.129720137e-01F, -3.724655807e-01F, -2.256722897e-01F,
+    -1.187680513e-01F, -2.801584303e-01F, -2.698878646e-01F, -3.710199893e-01F, -5.456031561e-01F, -6.993123144e-02F, 5.229538679e-02F, -4.463815689e-01F,
+    -9.914935380e-02F, 2.207455691e-03F, -4.794005156e-01F, -1.572687328e-01F, -4.556656182e-01F, 1.584849060e-01F, 3.577129543e-01F, -8.222378790e-03F,
+    -1.707149148e-01F, 9.308494627e-02F, -6.557915211e-01F, 7.395362854e-02F, 3.270088136e-01F, 4.358326495e-01F, -6.884108484e-02F, -4.835064113e-01F,
+    -1.916034147e-03F, 1.454755478e-02F, 1.178553775e-01F, -2.318634540e-01F, -1.927002966e-01F, -1.484037638e-01F, -6.316008568e-01F, 1.201066095e-02F,
+    -1.864971966e-01F, -1.720025241e-01F, -4.962541908e-02F, 9.678606689e-02F, -2.158240676e-01F, -6.376726031e-01F, -9.393702261e-03F, 3.048298657e-01F,
+    -6.802807748e-02F, 1.907281205e-02F, 4.475361109e-01F, 1.829681545e-01F, -5.766027570e-01F, -4.089902341e-01F, 2.173370570e-01F, -1.853100955e-01F,
+    -2.652136236e-02F, -1.552611142e-01F, -3.674500585e-01F, -1.009674594e-01F, -1.787021607e-01F, 1.002295688e-02F, -1.670612097e-01F, -1.922160089e-01F,
+    1.762713045e-01F, 2.041907907e-01F, -1.071493793e-02F, -8.657112718e-03F, 2.259002626e-01F, 9.207848459e-02F, -2.731635571e-01F, 8.018942177e-02F,
+    -9.725364298e-02F, -1.681640893e-01F, -7.687182724e-02F, -6.641408801e-01F, 2.258704044e-02F, -1.477749348e-01F, 1.404063124e-02F, -7.454571873e-02F,
+    -8.871826343e-03F, 2.260626480e-02F, -8.938536644e-01F, -2.543814182e-01F, -5.345227718e-01F, 2.790004313e-01F, -6.119555235e-01F, -8.440992981e-02F,
+    -2.901870525e-03F, -3.106454313e-01F, -4.069739580e-01F, -1.316244155e-01F, 2.302835435e-01F, -9.009915590e-01F, -6.553632021e-01F, -1.395609379e-01F,
+    -2.674312890e-01F, -5.665314198e-02F, -1.723186858e-02F, 1.270282716e-01F, -4.977154359e-02F, 2.037533373e-02F, -2.908072770e-01F, -1.111577377e-01F,
+    -2.470768616e-02F, -8.935163170e-02F, -7.267904878e-01F, 1.089974120e-01F, -3.457336724e-01F, -1.923434883e-01F, 1.277522892e-01F, 1.064066067e-01F,
+    -1.203798130e-01F, -2.195160389e-01F, -3.824892938e-01F, -4.067145884e-01F, 1.672116369e-01F, -4.721552432e-01F, -1.349033415e-01F, -5.175276995e-01F,
+    -9.075105190e-03F, -9.189486504e-02F, -1.826173961e-01F, -4.695913196e-01F, -6.890287995e-02F, -8.805803955e-02F, -1.812185347e-01F, -1.079011202e+00F,
+    1.010510847e-01F, -1.034428924e-02F, -3.462088704e-01F, -1.099328175e-01F, 1.269403994e-01F, 7.602944225e-02F, 5.615639687e-01F, 6.410779059e-02F,
+    -3.438261449e-01F, -4.025955126e-02F, -1.977082193e-01F, 2.264284343e-02F, -1.051657125e-01F, -1.846061051e-01F, -4.219480231e-02F, -3.010326922e-01F,
+    -9.863554686e-02F, 9.898863733e-02F, -4.499840736e-02F, 1.174502913e-02F, -2.024264336e-01F, -8.252482861e-02F, -1.662330776e-01F, 6.859164834e-01F,
+    -1.102250516e-01F, -3.117668331e-01F, -7.252493501e-02F, -2.756615877e-01F, 2.775208326e-03F, 4.767696187e-02F, -4.818122685e-01F, -1.995064914e-01F,
+    -2.237647921e-01F, -2.037433833e-01F, -6.825771332e-01F, -2.391533554e-01F, -7.593192905e-02F, -1.618796945e+00F, -4.357016087e-01F, -6.696541607e-02F,
+    -3.790381178e-02F, -6.919262558e-02F, -2.453610450e-01F, -7.034826875e-01F, -9.253364056e-02F, 5.298550129e-01F, -1.459772587e+00F, -4.389058352e-01F,
+    2.212269790e-02F, -6.075887755e-02F, 2.094637454e-01F, -6.110462919e-02F, -6.813641638e-02F, -6.289443374e-01F, -1.754007041e-01F, -6.797044873e-01F,
+    -1.201747060e-01F, -1.864955528e-03F, 1.431247443e-01F, -4.224413540e-03F, 2.474220470e-02F, -6.744761765e-02F, -2.020005509e-02F, -8.159184456e-02F,
+    -1.247740164e-01F, -3.501402214e-02F, 1.839713939e-02F, 5.954514723e-03F, -1.015732065e-01F, 7.895535231e-02F, 2.094682902e-01F, 9.337269701e-03F,
+    -1.357475370e-01F, 1.196362153e-01F, 4.675582051e-03F, 2.128200084e-01F, -2.835222185e-01F, -6.128966063e-02F, -1.231140047e-01F, 5.869597197e-01F,
+    -4.987539351e-02F, -5.374819785e-02F, 1.184476316e-01F, -6.397479177e-01F, -6.133389473e-02F, -5.996165872e-01F, -1.559779514e-02F, -3.544632792e-01F,
+    -1.977686733e-01F, -1.756278276e-01F, 7.248064131e-02F, 2.001004294e-02F, -1.365738269e-02F, -5.750440359e-01F, -7.798349857e-01F, 1.728009433e-01F,
+    -1.988322884e-01F, -1.449119598e-01F, -6.731961370e-01F, -3.459765911e-01F, -1.844999045e-01F, -3.198961616e-01F, -1.153791621e-01F, -1.203730404e-01F,
+    -7.277873904e-02F, -2.883041799e-01F, -7.052509189e-01F, -5.064333081e-01F, -7.037485838e-01F, -6.371192336e-01F, -4.273921251e-02F, -2.424392849e-01F,
+    -2.320226729e-01F, -8.977703005e-02F, -4.043299556e-01F, -3.317798078e-01F, 8.111921698e-02F, 2.124624550e-01F, -2.677575052e-01F, -1.662390083e-01F,
+    6.613077968e-02F, 5.526077002e-02F, 3.725584596e-02F, 8.034425229e-02F, -5.374439806e-02F, -5.848365650e-02F, -2.196095288e-01F, 3.545870185e-01F,
+    -2.575678825e-01F, -1.033243090e-01F, -5.463331342e-01F, -1.060631648e-01F, -4.792757928e-01F, -1.494433731e-01F, 8.093829453e-02F, 8.566801995e-02F,
+    7.570552081e-02F, -4.238849133e-02F, -6.922779679e-01F, 4.474308491e-01F, -2.914347947e-01F, -3.042527735e-01F, 2.016627192e-01F, -7.008899748e-02F,
+    -2.105609477e-01F, -2.460617125e-01F, -1.248398066e+00F, 4.149232805e-02F, -8.115450740e-01F, 1.282137036e-01F, -1.840509661e-02F, -7.779449970e-02F,
+    -1.663090736e-01F, 2.010934055e-01F, 3.182744607e-02F, -5.064515769e-02F, -1.655092090e-01F, -2.486853600e-01F, 1.933736913e-02F, -1.220797062e+00F,
+    -2.261025459e-01F, -2.922354043e-01F, -1.265248209e-01F, -2.218842357e-01F, 2.919091880e-01F, -6.724947691e-02F, -1.108522117e-01F, -2.390699863e+00F,
+    2.359076738e-01F, -2.385661304e-01F, 1.650171280e-01F, 1.102303565e-01F, -6.681789160e-01F, 1.523827463e-01F, -1.389475167e-01F, -3.003103472e-02F,
+    1.117647216e-01F, -2.101726383e-01F, -3.337481320e-01F, -1.209540665e-01F, -1.288844943e+00F, 1.763036251e-01F, 8.897701651e-02F, -3.088193201e-02F,
+    -1.398769170e-01F, -1.454160511e-01F, -4.499920309e-01F, 9.628775297e-05F, -4.212795198e-01F, 1.032943949e-01F, -3.760172799e-02F, -7.737551630e-02F,
+    -3.494007140e-02F, -3.454556167e-01F, -1.830561757e-01F, -1.339591444e-01F, 3.673604727e-01F, -3.691883981e-01F, -9.781729430e-02F, -1.282727532e-02F,
+    -8.241444081e-02F, -7.897175103e-02F, 2.457391769e-01F, -4.084845632e-02F, -4.064337313e-01F, 7.278924435e-02F, 2.515757643e-02F, -1.006988168e+00F,
+    2.187311351e-01F, -3.269378543e-01F, -8.643988520e-02F, -1.955933422e-01F, -3.944535851e-01F, -1.349184662e-01F, -1.297338214e-02F, -1.277518272e-01F,
+    -2.073740363e-01F, -3.999253213e-01F, -2.592931986e-01F, -1.798653156e-01F, -4.219606519e-01F, 4.168211669e-02F, 2.562611178e-02F, -1.500869691e-01F,
+    -6.115938351e-02F, -9.293441474e-02F, -2.103105187e-02F, -3.487418592e-02F, -4.458301961e-01F, -2.841269076e-01F, -6.076587737e-02F, -4.619884118e-02F,
+    -4.903935790e-01F, -4.359584153e-01F, -2.227884531e-01F, -2.222602516e-01F, -6.408581138e-02F, -1.350288540e-01F, -1.467015967e-02F, -1.371942163e-01F,
+    -2.669738829e-01F, 3.146286681e-02F, -5.271109939e-01F, -1.714016646e-01F, -8.272850513e-02F, -5.220817029e-02F, -1.250206381e-01F, -1.255732495e-02F,
+    -4.224439859e-01F, -7.732874155e-01F, 1.085918322e-01F, -2.971424758e-01F, -1.583423734e+00F, 3.536896035e-02F, 1.246119589e-01F, -3.982719183e-01F,
+    -1.712281555e-01F, -4.050468653e-02F, -1.805414110e-01F, -1.516690701e-01F, -1.020309851e-01F, 6.084853783e-02F, 7.078450639e-03F, -1.208015755e-01F,
+    -1.769055985e-02F, -6.012476087e-01F, -2.838771343e-01F, -1.251984537e-01F, -3.372165933e-02F, -6.789036095e-02F, -8.001168817e-02F, -2.193455771e-02F,
+    3.694439679e-02F, -1.722285450e-01F, -3.008864820e-01F, 1.013454869e-01F, -4.314586818e-01F, -2.425409704e-01F, -1.225056276e-01F, -1.026460826e-01F,
+    1.389328688e-01F, 2.952748351e-02F, -3.621028364e-02F, -1.070715673e-02F, 1.772252321e-01F, -3.237323165e-01F, -4.242494404e-01F, 1.080643665e-02F,
+    6.543396972e-03F, 1.324907988e-01F, 2.041511536e-01F, 1.669521630e-01F, 3.581702113e-01F, -1.066588089e-01F, 4.124643654e-02F, 3.232241422e-02F,
+    -1.082710922e-01F, -8.398932219e-01F, -7.514101863e-01F, -2.682858147e-02F, 3.385086358e-01F, -2.904721498e-01F, -3.595837951e-02F, -1.207103133e+00F,
+    -1.148533970e-01F, -5.285230279e-01F, 3.051107526e-01F, 1.471615881e-01F, 8.785413951e-02F, -8.365291953e-01F, -3.318433836e-02F, -6.568605453e-02F,
+    4.099416360e-02F, 4.155637026e-01F, 3.236592561e-02F, -4.050044343e-03F, 5.735010281e-02F, -5.498084053e-02F, 4.080779850e-02F, -6.154970452e-02F,
+    -3.623103201e-01F, 8.391445130e-02F, -3.313478529e-01F, -3.578913808e-01F, -5.765401721e-01F, 1.134309620e-01F, -7.204278558e-02F, -3.071618639e-02F,
+    1.639024317e-01F, -4.033340216e-01F, 4.282728583e-02F, -1.045277193e-01F, -7.878651619e-01F, -4.283732772e-01F, -4.526338354e-02F, -2.550831623e-02F,
+    -7.896833420e-01F, -3.904294968e-01F, -4.614380002e-01F, -2.702599764e-01F, -2.421673536e-01F, -5.426856875e-01F, 4.451302066e-02F, 2.112821303e-02F,
+    9.991187602e-02F, -5.890616179e-01F, -9.204164147e-01F, -2.347849458e-01F, -3.258315027e-01F, -1.369836628e-01F, -7.152661681e-02F, -1.284349263e-01F,
+    -1.426798105e-01F, -8.779701591e-01F, 2.736800313e-01F, -9.577889740e-02F, -3.881519660e-03F, -5.555840954e-02F, 2.522060834e-02F, -9.595492482e-02F,
+    -1.843788326e-01F, -3.699572384e-01F, -1.384890676e-01F, 1.106336638e-01F, 6.313855946e-02F, 1.071409881e-01F, -6.678099930e-02F, -4.647602141e-01F,
+    -3.173021972e-01F, -1.666683555e-01F, -7.785627991e-02F, -1.223374903e-01F, -4.673172534e-01F, -2.550465763e-01F, -2.121261321e-02F, -2.277109399e-02F,
+    -9.876921773e-02F, -3.449181318e-01F, -1.465482414e-01F, 1.002897322e-01F, -7.298363000e-02F, -9.087213129e-02F, -3.049452230e-02F, -1.238462776e-01F,
+    -7.238330245e-01F, -1.384226203e+00F, -1.372750551e-01F, 2.519445866e-02F, -3.959617019e-01F, 3.749554604e-02F, -6.466260552e-02F, -4.121365398e-02F,
+    2.044344097e-01F, -4.144103453e-02F, 1.360377222e-01F, -1.015423760e-01F, -1.989424825e-01F, -2.525227889e-02F, -2.570366301e-02F, -6.814762484e-03F,
+    -3.790204525e-01F, 3.528059646e-02F, 8.941727877e-02F, 4.634450004e-02F, 4.969265759e-01F, 1.839364022e-01F, -1.690971549e-04F, -1.715241522e-01F,
+    2.155288458e-01F, -9.412559122e-02F, 2.077655047e-01F, 1.301893741e-01F, -2.271098346e-01F, -1.787361875e-02F, 6.098246202e-03F, -1.156386510e-01F,
+    7.538110018e-02F, -7.975831628e-01F, -2.725158036e-01F, -1.570932865e-01F, -2.215356082e-01F, -1.464226097e-01F, 1.266465243e-02F, 1.358280610e-02F,
+    -1.987287551e-01F, 4.835937917e-02F, -1.363846473e-03F, -1.156423166e-01F, 4.672598541e-01F, 1.013692692e-01F, -2.880512550e-02F, 2.975784242e-02F,
+    7.095882669e-03F, -9.538814425e-01F, -6.273090243e-01F, 7.558650523e-02F, -3.979445100e-01F, -2.505045831e-01F, 2.081910521e-02F, -4.588016868e-01F,
+    -4.504346102e-02F, 6.195345148e-02F, -3.951343298e-01F, -2.074247152e-01F, -8.085272312e-01F, 8.080265671e-02F, -9.576390684e-02F, 3.037920222e-02F,
+    -1.829044074e-01F, -5.289916992e-01F, -3.798400462e-01F, 4.551647604e-02F, -4.150310755e-01F, 3.438786268e-01F, -3.849013150e-02F, 4.132362083e-02F,
+    4.937350750e-02F, -5.184391141e-01F, -3.137259185e-01F, -3.414593339e-01F, -1.404907256e-01F, -2.976167500e-01F, -5.012810230e-02F, 2.356015332e-02F,
+    -5.642198920e-01F, 1.112784296e-01F, 2.515178546e-02F, 8.627462201e-03F, -4.144856930e-01F, 2.391908914e-01F, -1.625029892e-01F, -6.334868725e-03F,
+    -1.292133927e-01F, -7.324665785e-01F, -2.843807340e-01F, -5.627708137e-02F, -2.280862927e-01F, -9.595236182e-02F, -1.308972985e-01F, -2.826439142e-01F,
+    -1.567246914e-01F, -2.441997677e-01F, 1.309823245e-01F, -1.164252385e-01F, 2.411909997e-01F, 5.898853391e-02F, -3.990900889e-02F, -2.542940900e-02F,
+    -4.375320971e-01F, -5.334870815e-01F, -1.593838185e-01F, -2.531966269e-01F, -5.668959022e-01F, 1.006608307e-01F, -3.931682557e-03F, -6.277999282e-02F,
+    1.006106511e-01F, -3.475710154e-01F, -5.446794033e-01F, -6.278104335e-02F, -5.315467715e-01F, -3.081316501e-02F, -3.723747330e-03F, -9.920217991e-01F,
+    -1.680547893e-01F, -6.469429731e-01F, 6.473426223e-01F, -5.915702879e-02F, 2.687668800e-01F, -8.048058152e-01F, 1.170381624e-02F, -4.405694902e-01F,
+    -9.360377491e-02F, -5.406333134e-02F, -5.603302643e-02F, -1.806202829e-01F, -5.967015028e-01F, -1.135363936e+00F, -5.551159754e-02F, 1.750219241e-02F,
+    -3.591543138e-01F, -3.108279705e-01F, -6.052511185e-02F, -5.612206087e-02F, -1.247519478e-01F, -5.222029984e-02F, -2.745217271e-02F, -1.013069972e-02F,
+    -1.458061188e-01F, -2.126754969e-01F, 1.394525617e-01F, -8.670404553e-02F, 3.528931737e-01F, -2.276758254e-01F, -6.625856757e-01F, -1.563110016e-02F,
+    -3.962366581e-01F, -2.080194950e-01F, 6.997954845e-02F, -4.082837105e-01F, -1.490398794e-01F, 3.928564489e-02F, -1.655544490e-01F, 1.302170604e-01F,
+    -1.823924333e-01F, -7.942090183e-02F, -3.003839850e-01F, -2.893714309e-01F, -3.936133981e-01F, 9.140997380e-02F, -6.391642988e-02F, -1.930227578e-01F,
+    -3.023709059e-01F, -5.973419175e-03F, -2.170678973e-01F, 1.038843021e-01F, -1.177976653e-01F, -4.622640833e-02F, -1.551193893e-01F, -3.875995576e-01F,
+    1.903977990e-01F, -3.418904841e-01F, 1.812083181e-03F, -2.707765996e-01F, 5.223548412e-01F, -7.060365081e-01F, -1.598553616e-03F, -1.217757687e-01F,
+    -4.913454130e-02F, 2.438137382e-01F, -1.502564270e-02F, 1.386272162e-01F, 2.355943248e-02F, -4.318717867e-02F, 1.870496422e-01F, 2.008573338e-02F,
+    -3.799173981e-02F, -4.496360123e-01F, -3.337106109e-01F, -2.742149830e-01F, 5.188574791e-01F, -4.304228723e-01F, -1.989703998e-02F, -5.382362008e-02F,
+    4.142896459e-02F, 1.632938683e-01F, -1.912490427e-01F, -2.107653022e-01F, -4.949474037e-01F, -9.090853333e-01F, 1.760097444e-01F, -3.574996293e-01F,
+    -6.006413698e-01F, -9.145176411e-02F, -1.377172023e-01F, -1.148945093e-01F, 2.902899683e-01F, 7.930827886e-02F, 4.961241782e-02F, 7.396498322e-02F,
+    -3.497166932e-01F, -1.137835681e-01F, -2.634359598e-01F, 5.110837519e-02F, -2.108015865e-01F, -7.005906701e-01F, -6.945607066e-02F, 5.348928273e-02F,
+    -3.468339443e-01F, 7.044673711e-02F, -6.331035495e-01F, -4.910835624e-01F, -1.124017954e+00F, -1.370200813e-01F, -2.156864479e-02F, 1.164285373e-02F,
+    -5.126761794e-01F, -9.346961975e-01F, -4.536162913e-01F, -1.996246427e-01F, -1.132739305e+00F, -7.717286944e-01F, 1.762093161e-03F, -6.314866245e-02F,
+    -1.210832596e-01F, -2.482573502e-03F, -1.876378953e-01F, -4.138717055e-01F, -1.486212492e+00F, -1.794658601e-01F, 1.094251573e-01F, -5.515710264e-02F,
+    -2.613454461e-01F, -9.762704372e-01F, -3.080425560e-01F, -1.923159957e-01F, -6.083483100e-01F, -2.945836186e-01F, -3.376601031e-03F, -1.874740124e-01F,
+    9.720417112e-02F, -9.389930964e-02F, -4.847190380e-01F, -1.015817001e-01F, -2.799857259e-01F, -2.573240399e-01F, -6.746984087e-03F, 8.990973234e-02F,
+    -5.342593789e-01F, -5.476362258e-02F, -4.477043450e-01F, -1.328692734e-01F, 3.570268750e-01F, -6.502598524e-02F, 1.491900533e-02F, 5.356299505e-02F,
+    6.780386716e-02F, -1.464557201e-01F, -1.196089387e-01F, 5.192516372e-03F, -1.760717481e-01F, -1.019310430e-01F, -1.633045450e-02F, -4.353837371e-01F,
+    -2.225022763e-02F, -1.928807795e-01F, -1.002229229e-01F, -3.070794642e-01F, 7.160869241e-02F, -1.069628149e-01F, -2.203080356e-01F, 3.953426704e-02F,
+    5.886926129e-02F, -9.620326012e-02F, -2.172142863e-01F, -3.906819224e-01F, -3.902503252e-01F, -3.675853312e-01F, -8.220162243e-02F, -3.602034450e-01F,
+    7.522767782e-02F, -2.509355545e-02F, 1.721029170e-02F, -7.799039781e-02F, -3.904023767e-01F, -1.196057424e-01F, -3.007590175e-01F, -3.428014517e-01F,
+    4.866211861e-02F, -9.607084841e-02F, -2.825532574e-03F, -3.264275491e-01F, -9.287771583e-02F, -5.536900461e-02F, -2.878068984e-01F, 2.501946986e-01F,
+    -1.059626136e-02F, 5.400015786e-02F, 7.464455441e-03F, -1.536137760e-01F, 1.226408780e-02F, 3.791402653e-02F, -2.704159319e-01F, -6.199414730e-01F,
+    5.698079243e-02F, -1.793630272e-01F, -1.693108231e-01F, -5.104072019e-02F, 2.879761457e-01F, 2.280157804e-02F, -2.220589966e-01F, -7.187349796e-01F,
+    -4.749942571e-02F, -8.618787676e-02F, -2.220597565e-01F, 2.483058162e-02F, 1.344958544e-01F, -1.273182780e-01F, -1.542893350e-01F, -5.251641870e-01F,
+    4.563856497e-02F, -9.542439878e-02F, 1.150414050e-01F, -2.739146054e-01F, -1.570453681e-02F, -3.970851004e-02F, 6.195740029e-02F, 1.711828560e-01F,
+    -6.540035456e-02F, -1.172082946e-01F, -1.826258898e-01F, -8.170318906e-04F, -1.786077917e-01F, -1.767233908e-01F, -3.085511029e-01F, 2.242840976e-01F,
+    -3.237331752e-03F, 1.606473885e-02F, 2.008893713e-02F, -2.693138719e-01F, -1.622428000e-01F, -2.692080289e-02F, 1.366597367e-03F, -3.285614848e-01F,
+    -4.009788111e-02F, -4.357652366e-02F, -2.650266588e-01F, -1.836141646e-01F, 1.955543905e-01F, -1.661217213e-01F, -5.481516123e-01F, -1.552820653e-01F,
+    -5.974171683e-02F, -2.329165637e-01F, -3.773817718e-01F, -8.894860744e-02F, 1.590942144e-01F, 1.222030260e-02F, -3.134842217e-01F, -4.130904004e-02F,
+    -2.041921020e-01F, -1.515668482e-01F, 9.692733735e-02F, -1.283866018e-01F, -7.042562589e-03F, -3.974919021e-01F, -2.395090163e-01F, -8.589368314e-02F,
+    1.364914887e-02F, -2.201355435e-02F, 3.274694458e-02F, -2.205502540e-01F, -8.624234051e-02F, -1.142172143e-01F, -1.463590711e-01F, -1.339298934e-01F,
+    -3.432345763e-02F, -8.006356657e-02F, -2.148019969e-01F, -5.998361483e-02F, -3.934269547e-01F, 1.855434664e-02F, -1.053101644e-01F, -3.980522752e-01F,
+    -7.682549208e-02F, -3.428072035e-01F, 9.573351592e-02F, -1.521672606e-01F, -2.801767290e-01F, -5.642971992e-01F, 3.883912787e-02F, 3.530606031e-01F,
+    8.071656525e-02F, 1.257093400e-01F, -8.267638087e-01F, -1.830929369e-01F, -2.640380263e-01F, -1.546703130e-01F, -1.564561278e-01F, -1.254220903e-01F,
+    -1.630585045e-01F, -1.476929784e-01F, -1.019218713e-01F, 5.356514826e-02F, 1.678950898e-02F, 4.011370707e-03F, 4.047849029e-02F, -2.864772081e-01F,
+    -1.489246637e-02F, 1.291305423e-01F, -4.705987405e-03F, 1.011031717e-01F, -4.113307595e-01F, -1.143090576e-01F, -2.253531069e-01F, -5.587974191e-01F,
+    -8.459065109e-02F, -2.029098123e-01F, -1.741659194e-01F, -1.944653839e-01F, 4.331036210e-01F, -1.901758164e-01F, 2.390526608e-02F, -2.549243271e-01F,
+    -3.892550245e-02F, -9.962008893e-02F, 7.039439678e-02F, 7.762556523e-02F, -7.647357881e-03F, 2.220997587e-02F, 1.934261620e-01F, -3.316945434e-01F,
+    4.258222878e-03F, -1.680400223e-01F, 1.597728878e-01F, -1.114571095e-01F, 1.685306057e-02F, 1.327661127e-01F, -2.584177256e-01F, -3.746583760e-01F,
+    2.125858329e-03F, 5.030835792e-02F, -4.224991500e-01F, -9.997966141e-02F, -8.831354380e-01F, -5.053430796e-02F, 5.074573308e-02F, 3.972451389e-01F,
+    2.070634626e-02F, -1.143493205e-01F, -1.195528433e-01F, -1.563730985e-01F, -7.823325992e-01F, 7.358808070e-03F, 2.357593970e-03F, 2.403653413e-01F,
+    -1.072673826e-03F, -7.010710239e-02F, -6.398219466e-01F, 1.467835903e-01F, -2.350450158e-01F, -2.468954921e-01F, 1.409452558e-01F, -1.656669676e-01F,
+    1.489419211e-02F, -2.566586435e-01F, -2.241538316e-01F, 1.205293741e-02F, -3.059682846e-01F, -1.398951411e-01F, -1.741023809e-01F, 5.577328429e-02F,
+    2.955358475e-03F, 6.372737139e-02F, -2.645511031e-01F, 5.063499138e-02F, 2.008265555e-01F, -6.224376559e-01F, -4.831134379e-01F, -1.383699536e+00F,
+    4.127875343e-02F, -3.660585359e-02F, -2.337250393e-03F, -1.187722087e-01F, -4.034398869e-02F, -9.899979085e-02F, -1.392797679e-01F, -5.254792571e-01F,
+    -1.246310957e-02F, 8.171207458e-02F, 1.469443887e-01F, -7.893628627e-02F, -8.633099496e-02F, -2.775132954e-01F, -1.218332574e-01F, -2.376111597e-01F,
+    -5.454738066e-02F, -8.150769770e-02F, -6.334847957e-02F, -2.618285120e-01F, -7.739021629e-02F, 3.822857887e-02F, -3.487604484e-02F, 3.876194954e-01F,
+    -6.123697758e-02F, -2.006519288e-01F, 2.376064956e-01F, -3.817998245e-02F, -1.388427913e-01F, -1.593475230e-02F, -8.117173612e-02F, -1.185882449e+00F,
+    -2.902092785e-02F, -1.014459580e-01F, -1.392867714e-01F, -2.346484959e-01F, 1.440923065e-01F, -1.579503566e-01F, -9.175111353e-02F, -8.337420225e-01F,
+    -6.218103692e-02F, 6.888817251e-02F, 1.070925444e-01F, 4.813865945e-02F, 1.635056287e-01F, -3.032505214e-01F, 9.708285332e-02F, -2.007353008e-01F,
+    -1.561382562e-01F, 6.431664526e-02F, -2.353785783e-01F, 6.602361798e-02F, -2.880002856e-01F, -8.321495354e-02F, -4.161159694e-02F, -4.469898939e-01F,
+    1.936143637e-02F, 4.314302281e-02F, -1.263486445e-01F, -1.057421044e-01F, 7.134616375e-03F, 4.076303542e-02F, 9.569692612e-02F, -5.439760629e-03F,
+    1.962941606e-03F, 7.288347185e-02F, -1.335107535e-01F, -1.514906064e-02F, 1.716076285e-01F, -2.879158966e-02F, 8.427983522e-02F, 1.787210107e-01F,
+    9.304994345e-02F, 2.543656342e-02F, -3.159592748e-01F, -1.389395595e-01F, -9.740684927e-02F, 3.100254573e-02F, 4.582657665e-02F, -1.410396248e-01F,
+    1.108494867e-02F, 2.134296298e-02F, 2.602039278e-01F, 7.591687143e-02F, -8.517448902e-01F, 1.597078703e-02F, -4.061005265e-02F, 8.581481129e-02F,
+    1.127246674e-02F, -7.493759971e-03F, -2.942327559e-01F, -1.661390215e-01F, -9.038844705e-02F, 2.460798249e-02F, -1.826103032e-01F, -3.333731294e-01F,
+    1.088587120e-01F, -7.389703393e-02F, 2.713114917e-01F, -1.596618742e-01F, -9.445491433e-02F, 1.224526111e-02F, -2.218225300e-01F, 1.080909222e-01F,
+    4.733978584e-02F, -1.336544305e-01F, -1.699794978e-01F, -1.884585619e-01F, -5.815061331e-01F, -1.059470996e-01F, -1.950965375e-01F, 1.246453598e-01F,
+    -1.502921060e-02F, -1.522287130e-01F, -3.729499131e-02F, 8.035158971e-04F, -4.845233560e-01F, 1.279920619e-02F, 8.994583040e-02F, -3.902233019e-02F,
+    -7.680276781e-02F, 5.802643672e-02F, 3.050719388e-02F, -4.167266488e-01F, -1.138243526e-01F, -3.607854247e-01F, -2.206486911e-01F, -5.787765384e-01F,
+    5.162551999e-02F, -5.278629065e-02F, -4.132554233e-01F, 1.138383746e-01F, 2.929716706e-01F, 6.759620458e-02F, -2.829379141e-01F, -4.236956537e-01F,
+    -3.056744672e-02F, -3.933322057e-02F, 2.165678144e-02F, 1.548315436e-01F, 2.390508652e-01F, -2.830941379e-01F, -3.876320273e-02F, 4.782714844e-01F,
+    -1.974971145e-01F, -4.216765612e-02F, 1.545428932e-01F, 1.509038557e-04F, -2.886118293e-01F, 2.691679001e-01F, 5.864773691e-02F, -1.715689301e-01F,
+    1.812702511e-03F, -2.446118444e-01F, -3.414804339e-01F, -7.733509690e-02F, 4.791072756e-02F, -8.906771988e-02F, -4.788447618e-01F, -1.770101488e-02F,
+    -2.408730239e-01F, 5.208083615e-02F, 3.497978747e-01F, 6.649149209e-02F, 3.694984019e-01F, -1.278868169e-01F, -1.145236045e-01F, 1.790066063e-02F,
+    -1.538527906e-01F, -4.875206947e-01F, -1.057704315e-01F, -1.430647224e-01F, -7.501697540e-01F, 1.779354215e-01F, -6.329362988e-01F, -1.956354678e-01F,
+    -1.157992333e-02F, -2.158088833e-01F, -1.508599706e-02F, -2.858612537e-01F, -1.379907876e-01F, -1.680886000e-01F, -4.470466971e-01F, -1.382903606e-01F,
+    4.746875539e-02F, -7.491211593e-02F, -3.457575738e-01F, -1.237240527e-02F, -1.771473736e-01F, -2.598027289e-01F, -1.424832344e-01F, 3.411143273e-02F,
+    4.393316433e-02F, -2.007063478e-01F, -6.321350932e-01F, -1.516981125e-01F, -1.256028116e-01F, -3.854016364e-01F, -3.563100696e-01F, 2.832660079e-01F,
+    7.380100340e-02F, -2.123900354e-01F, -7.041844726e-02F, -1.539074183e-01F, -1.338176057e-02F, -3.679623082e-02F, 1.500559747e-01F, 7.978559285e-02F,
+    9.371574223e-02F, -1.379211694e-01F, -3.163254261e-01F, -1.568108648e-01F, 1.172449589e-01F, -1.431610063e-02F, -2.428378761e-01F, -6.404277682e-01F,
+    -1.130754799e-01F, -4.737135395e-02F, -3.254766390e-02F, -2.144168019e-01F, 1.531908065e-01F, 1.337325722e-01F, 9.691128135e-02F, 1.961176470e-02F,
+    -4.660808668e-02F, 4.517216980e-02F, -4.257769883e-01F, -1.000722200e-01F, -1.263348013e-01F, 5.423923954e-02F, -4.119473994e-01F, -4.600470886e-02F,
+    1.483937819e-02F, -1.315801144e-01F, -8.257347345e-02F, -2.743478715e-01F, -3.232430816e-01F, 7.911089808e-02F, -1.127293184e-01F, -1.165165305e+00F,
+    1.957730390e-03F, -3.570406735e-01F, 6.592701375e-02F, -2.085703313e-01F, -5.018458962e-01F, 9.966526926e-02F, -1.268189698e-01F, -1.481111646e-01F,
+    -1.361062657e-02F, -1.951174289e-01F, -2.479546070e-01F, -1.934099048e-01F, -8.615172654e-02F, 2.278581411e-01F, -3.370392621e-01F, 3.372799754e-01F,
+    -1.767528802e-02F, -1.826253533e-01F, -2.375065684e-01F, -2.911359966e-01F, 1.513377428e-01F, -3.677725494e-01F, -4.789789021e-01F, -2.857435346e-01F,
+    -1.687641591e-01F, -1.894207597e-01F, -2.720923722e-01F, -2.399697900e-01F, 1.095713004e-01F, -3.929644227e-01F, 8.240009099e-02F, -1.750897914e-01F,
+    1.309867483e-03F, 7.354000118e-03F, -2.738591433e-01F, -1.602511257e-01F, -2.068321854e-01F, 1.224217713e-01F, 1.451538224e-02F, -9.734227657e-01F,
+    -3.376648575e-02F, -2.291846573e-01F, 1.363599151e-01F, -3.227593601e-01F, 2.098332345e-01F, -5.055158213e-02F, -7.910796255e-02F, -9.241930842e-01F,
+    -2.498782724e-01F, -2.399802357e-01F, 1.019522995e-01F, -2.775735259e-01F, -1.215875596e-01F, -4.326015413e-01F, -6.098447740e-02F, -3.908661008e-02F,
+    -5.309187807e-03F, -4.733505473e-02F, -2.668346167e-01F, -1.561037004e-01F, -3.616070151e-01F, -4.660028964e-02F, -6.081150174e-01F, 2.627936751e-02F,
+    -8.582677841e-01F, -7.200425267e-01F, -1.757448725e-02F, -7.404774427e-02F, -7.260106802e-01F, -1.066915870e+00F, 6.480538100e-02F, -8.025228381e-01F,
+    3.723687828e-01F, -4.435035884e-01F, -7.301151156e-01F, 9.711491317e-02F, -2.713848948e-01F, -3.363156319e-01F, 2.466192991e-01F, -2.838539891e-02F,
+    9.306321293e-02F, -1.563388389e-03F, 1.936458051e-01F, -3.939756006e-02F, 1.249049008e-01F, -5.852901191e-02F, 1.820993423e-02F, -7.819870710e-01F,
+    -2.086428851e-01F, -1.250993460e-01F, -2.351333201e-01F, -5.080826953e-02F, -2.330919206e-01F, -2.630239427e-01F, -4.281952381e-01F, -1.400275230e-01F,
+    -4.321960807e-01F, -2.049185038e-01F, -1.135568172e-01F, 2.009496838e-02F, -1.371712923e+00F, -2.080038935e-01F, -3.406831622e-01F, 2.979974747e-01F,
+    -6.341903806e-01F, -2.331033945e-01F, -5.973986983e-01F, -2.479770929e-01F, -1.212330237e-01F, 1.301192027e-02F, 1.588537991e-01F, -3.937745839e-02F,
+    -4.653628767e-01F, 2.351683974e-01F, 1.728566736e-01F, -1.008350104e-01F, -1.148834467e+00F, 1.086458191e-01F, -2.926948071e-01F, -1.634887308e-01F,
+    -3.868754208e-02F, -5.325163007e-01F, -1.637751609e-01F, -2.899140120e-01F, 5.720655248e-02F, 3.702566773e-02F, -3.930209577e-01F, -3.554741293e-02F,
+    -8.681375980e-01F, -8.206510544e-02F, -7.714299113e-02F, -6.643445790e-02F, -6.274170876e-01F, -1.226451993e+00F, -2.191033810e-01F, -3.013568930e-03F,
+    -7.005203366e-01F, 6.106698141e-02F, -1.743026376e-01F, -5.844483525e-02F, 5.253735557e-02F, -1.130683161e-02F, -1.443697512e-01F, 8.974015713e-02F,
+    9.033955634e-02F, -5.958033204e-01F, -2.114474028e-01F, -2.044559270e-01F, 7.368917763e-02F, 1.039945707e-01F, -5.039614439e-01F, -2.095812559e+00F,
+    -1.326805055e-01F, -4.145136774e-01F, -1.659948707e+00F, -3.009042144e-01F, -7.119530439e-02F, -1.272388846e-01F, -3.085634112e-01F, -1.905675828e-01F,
+    -1.740643531e-01F, -8.898116946e-01F, -1.873834617e-02F, -1.126643829e-02F, -3.443681449e-02F, -5.883621797e-02F, -1.984003782e-01F, 3.899802640e-02F,
+    2.578350306e-01F, -8.741307259e-01F, -5.248900652e-01F, -3.273248672e-01F, -1.036921069e-01F, -1.646139622e-01F, -5.761216283e-01F, -5.003888011e-01F,
+    -2.731261551e-01F, -2.816992998e-01F, 2.699262202e-01F, 4.583119601e-02F, 1.927966950e-03F, -4.655343592e-01F, 4.545788281e-03F, -5.985010266e-01F,
+    -1.356340349e-01F, -1.945572793e-01F, -9.448793717e-03F, -3.143926337e-02F, 1.414761692e-01F, 1.196147352e-01F, -1.990685463e-01F, -2.052039206e-01F,
+    -3.735283017e-01F, -4.444884658e-01F, -5.495324358e-02F, 7.053851336e-02F, -6.181148887e-01F, -4.983987510e-01F, 2.293870784e-02F, -5.886562914e-02F,
+    -1.161047965e-01F, -5.747315288e-01F, -3.779160082e-01F, -1.831733063e-02F, -7.904977538e-03F, -3.424829245e-01F, -3.683844209e-01F, 2.698366046e-01F,
+    -6.033772975e-02F, 7.478284836e-02F, 2.551249564e-01F, -1.456775330e-02F, 4.011092782e-01F, -1.010497957e-01F, -3.197121993e-02F, 1.225272492e-01F,
+    -7.978599519e-02F, -3.025537431e-01F, -1.901865005e-01F, -1.563444734e-01F, -7.842303254e-03F, -5.250689387e-01F, -1.287984103e-01F, -5.586697459e-01F,
+    -7.465257496e-02F, -8.747731894e-02F, -7.461979985e-02F, 2.496453747e-02F, 1.951848716e-02F, -2.450115532e-01F, -2.842317149e-02F, 2.089584917e-01F,
+    2.002589032e-02F, -2.566639781e-01F, -7.700283825e-02F, 7.730461657e-03F, -1.156325579e+00F, -2.354452759e-01F, -3.409048915e-01F, -2.273621410e-01F,
+    -7.789154351e-02F, -2.737462223e-01F, -2.678915858e-03F, 1.023167744e-01F, 5.868395418e-02F, -1.739021093e-01F, -4.042275846e-01F, -2.372459322e-02F,
+    -5.145571232e-01F, -4.798243344e-01F, -7.884678990e-02F, -1.735224128e-01F, 2.174069136e-01F, -6.429579854e-02F, 1.701722592e-01F, -2.436729521e-01F,
+    -3.338449895e-01F, 3.557574749e-01F, -1.666282117e-01F, -1.980161220e-01F, -4.471766055e-01F, -5.382260680e-01F, 1.067616791e-01F, -1.397661716e-01F,
+    2.425297163e-02F, -9.736625850e-02F, 1.725891680e-01F, -2.756935954e-01F, -4.830545187e-02F, 8.942094445e-02F, -4.217003286e-01F, 3.547529876e-02F,
+    -4.948713258e-02F, -5.761927366e-01F, -7.115013897e-02F, -4.807206988e-02F, -6.499059796e-01F, 1.149581093e-02F, -1.328361928e-01F, 6.848180667e-03F,
+    -1.166224852e-01F, -5.216540769e-02F, -7.576692849e-02F, 5.558059737e-02F, -1.111002266e-01F, -2.601192892e-01F, 1.068966612e-01F, -8.789041638e-02F,
+    -5.035426095e-02F, -8.931217343e-02F, -4.301818609e-01F, 8.204068989e-02F, -2.831415460e-02F, -1.746996641e-01F, -2.211373448e-01F, -2.723298222e-02F,
+    -5.334733129e-01F, -6.714133024e-01F, -4.416849315e-01F, -1.521361023e-01F, 9.895022959e-02F, -3.839716613e-01F, -1.959631294e-01F, 2.107256502e-01F,
+    -1.937334836e-01F, -2.058669925e-01F, -5.599635839e-02F, -1.100665331e-01F, 3.314698488e-02F, -4.364511967e-01F, -2.723532021e-01F, -6.108973622e-01F,
+    -8.181371726e-03F, -3.482431769e-01F, -1.018172622e+00F, -2.618578449e-02F, 2.881079912e-01F, 1.527368575e-01F, 7.747491449e-02F, -2.553503215e-01F,
+    2.167896330e-01F, -1.703637242e-01F, 1.589673460e-01F, 4.595363513e-02F, -5.863032937e-01F, -1.172501221e-01F, 2.330534160e-01F, -1.641621143e-01F,
+    -1.281341910e-01F, -1.314657778e-01F, -3.216128051e-01F, 2.840506844e-02F, -3.714683652e-02F, -7.973176241e-02F, -8.700597286e-01F, -2.365433872e-01F,
+    -3.024170995e-01F, -3.244756162e-01F, -4.589593038e-02F, 1.468265429e-02F, -4.183064997e-01F, -8.183557391e-01F, -2.268256694e-01F, -4.452935457e-01F,
+    -2.155628204e-01F, 8.000233769e-02F, -8.242698014e-02F, 6.011323072e-03F, -7.190866023e-02F, -1.529873163e-01F, -5.605192482e-02F, 1.262280643e-01F,
+    -2.765761316e-01F, 3.171313703e-01F, 9.822125733e-02F, -1.414116025e-01F, -6.327003837e-01F, -2.764666677e-01F, 1.812765598e-01F, -2.090029866e-01F,
+    3.003021181e-01F, -1.752915084e-01F, -1.766448617e-01F, -1.163282990e-01F, -1.690673456e-02F, -8.048773743e-03F, -2.019147426e-01F, -7.836595774e-01F,
+    4.555778205e-01F, -8.542983532e-01F, 5.929360911e-02F, -9.728595614e-02F, -1.726036519e-01F, -3.958900869e-01F, -6.531096995e-02F, -2.776109874e-01F,
+    -3.044396043e-01F, -2.289589345e-01F, -3.640360534e-01F, 5.327805504e-02F, -4.722498357e-01F, 3.241948485e-01F, 2.364609204e-02F, -4.275678992e-01F,
+    -5.477638841e-01F, -1.343976110e-01F, -8.261980414e-01F, -6.409543753e-02F, 1.104320735e-01F, -4.793592393e-01F, -1.547169089e-01F, 4.034260660e-02F,
+    -1.386067122e-01F, -3.234819174e-01F, -3.434646428e-01F, -6.300668418e-02F, -7.674173266e-02F, -2.178470045e-01F, -7.224667817e-02F, -2.083338499e+00F,
+    3.329786286e-02F, -7.514451146e-01F, -5.294203758e-02F, 3.838675097e-02F, -1.242686152e+00F, 8.561938256e-02F, -2.309156507e-01F, -1.852552444e-01F,
+    -3.124343455e-01F, 2.082899585e-02F, 3.020358086e-01F, -1.259115934e-01F, -7.280310988e-01F, -3.196052909e-01F, 9.757977724e-02F, -8.159258403e-03F,
+    -1.221672446e-01F, 8.090480566e-01F, 2.967018187e-01F, -8.477055281e-02F, -1.489495039e-01F, -5.636057258e-01F, -5.044837296e-02F, -9.687486291e-01F,
+    -1.826527864e-01F, -2.363634259e-01F, 2.102888562e-02F, -8.701634407e-02F, 6.304738671e-02F, -1.168653607e+00F, 3.558735549e-02F, -2.534977198e-01F,
+    8.877331764e-02F, 1.100997701e-01F, -1.941122464e-03F, -3.875926137e-03F, 1.514401101e-02F, -8.816600777e-03F, 1.028779778e-03F, -1.022019163e-01F,
+    -1.896136403e-01F, -6.584348679e-01F, -5.476826429e-01F, -2.319128364e-01F, -9.820365161e-02F, -1.442465305e+00F, -4.069280028e-01F, -2.580157816e-01F,
+    -5.289363265e-01F, -2.023055851e-01F, 1.200630814e-01F, -1.624003947e-01F, -9.312281609e-01F, -5.123294890e-02F, -8.086812496e-01F, -9.834108949e-01F,
+    -2.283823043e-01F, -1.940448433e-01F, 1.829895228e-01F, -6.874715537e-02F, -1.160145521e+00F, -8.443445712e-02F, 9.038875252e-02F, -9.262152314e-01F,
+    -4.342500493e-02F, -2.160728425e-01F, -2.094817758e-01F, -1.273706108e-01F, 2.959154733e-02F, -1.403122246e-01F, -1.258696318e-01F, -3.631246686e-01F,
+    1.288767308e-01F, -2.171316147e-01F, -4.951266572e-02F, -6.429865956e-02F, 2.173148841e-01F, 1.593264751e-02F, -8.170354366e-02F, -1.386339664e-01F,
+    -2.726769149e-01F, -8.701806515e-02F, -2.174816132e-01F, -6.233213469e-02F, -8.565825969e-02F, 5.632238835e-02F, 8.013436198e-02F, -1.488981694e-01F,
+    -3.247525394e-01F, -4.194585085e-01F, -5.112142116e-02F, 3.878517076e-02F, -1.247941777e-01F, -3.152251542e-01F, -1.234648377e-01F, -7.324403524e-01F,
+    -5.387918949e-01F, -4.192119837e-01F, 1.335949600e-01F, -1.091885343e-01F, -4.546819255e-02F, -7.178928852e-01F, 2.053109929e-02F, -4.494724870e-01F,
+    -2.051263303e-01F, -6.433336735e-01F, -3.549974859e-01F, -2.755813301e-01F, -2.737320065e-01F, 5.391725805e-03F, -2.899357080e-01F, -2.290954143e-01F,
+    -8.621369004e-01F, -5.200981498e-01F, -3.650123253e-02F, -2.671166062e-01F, -3.833078220e-02F, -1.341679841e-01F, -2.749375999e-01F, 2.835482657e-01F,
+    6.163837761e-02F, -6.450310946e-01F, -7.865395397e-02F, -2.199108601e-01F, 1.864910685e-02F, -1.482193470e+00F, -2.648419440e-01F, -4.965624511e-01F,
+    -5.106544495e-01F, -1.160538523e-05F, -6.580628157e-01F, -2.707381546e-01F, -8.016179502e-02F, 2.426238358e-02F, 1.008028984e-01F, -1.314142197e-01F,
+    -2.758805268e-02F, 7.576650381e-02F, -4.202808142e-01F, 7.849360257e-02F, 3.627912402e-01F, -1.157727167e-01F, 2.123447061e-01F, -3.864367604e-01F,
+    -1.864353716e-01F, 6.581555586e-03F, -2.562225461e-01F, -3.419915438e-01F, -1.918496609e+00F, -4.888978004e-01F, -7.981428504e-02F, -5.325637758e-03F,
+    -2.598373685e-03F, -1.178551912e+00F, -1.176204458e-01F, -1.705865562e-01F, -1.077447683e-01F, -1.519883126e-01F, -2.501269281e-01F, -4.901230931e-01F,
+    -2.042241395e-01F, -2.196208984e-01F, 4.240484163e-02F, -1.426522583e-01F, -2.255713195e-01F, 7.505990565e-02F, -2.940666080e-01F, -2.710984945e-01F,
+    -1.924957037e-01F, -2.500251234e-01F, -8.512951434e-02F, -3.624768555e-02F, -1.730149239e-02F, -2.347094268e-01F, -1.046879366e-01F, -1.389778495e+00F,
+    -3.897351921e-01F, 5.132150836e-03F, -2.006452829e-01F, -1.316710562e-01F, -5.446999669e-01F, -1.837722808e-01F, -5.840176344e-01F, -6.322332621e-01F,
+    -2.271296829e-02F, 2.239399105e-01F, -1.957067549e-01F, 6.531712413e-02F, -3.071812913e-02F, -1.458425373e-01F, 1.498543750e-02F, -6.348068714e-01F,
+    -1.097149998e-01F, 2.190737277e-01F, -2.761018872e-01F, 1.394013502e-02F, -1.970780641e-01F, -1.857173592e-01F, 4.022449721e-03F, -1.532101333e-01F,
+    1.993461102e-01F, -2.463156432e-01F, -3.532276154e-01F, -9.972935170e-02F, 6.926929951e-02F, -3.184823319e-02F, -2.133815289e-01F, -7.394453883e-02F,
+    -3.920763135e-01F, -2.440312803e-01F, -1.531556547e-01F, -8.369425684e-02F, 3.356315941e-02F, 4.533553496e-02F, 8.870834857e-02F, -6.024891734e-01F,
+    -5.118190050e-01F, -1.651820093e-01F, -2.143374383e-01F, -1.589823142e-02F, -4.904403165e-02F, -2.930715680e-01F, -1.614408493e-01F, 9.503327310e-02F,
+    -2.247998565e-01F, -1.822448224e-01F, 7.639091462e-03F, -2.287768293e-03F, 5.880236253e-02F, -4.519001395e-02F, -3.117214143e-01F, 2.067257911e-01F,
+    -1.225647032e-01F, 1.562874168e-01F, -2.486318797e-01F, -7.427681983e-02F, -2.493927032e-01F, -2.563993633e-01F, 1.220220476e-01F, -3.373256922e-01F,
+    -3.986577392e-01F, 1.969199330e-01F, -3.293903470e-01F, 3.886490315e-02F, -1.419889033e-01F, -9.082117677e-02F, -5.923738480e-01F, -8.951974511e-01F,
+    -6.737571955e-01F, -1.698368937e-01F, -4.980464280e-01F, -2.275932953e-02F, -4.137852192e-01F, -6.498496979e-02F, -7.612975687e-02F, 9.600042552e-02F,
+    -2.757865489e-01F, -1.904912591e-01F, -2.032710463e-01F, -2.216245793e-02F, -4.472472519e-02F, 5.067775771e-02F, -1.616998203e-02F, -4.885856509e-01F,
+    -2.563741505e-01F, 3.903111443e-02F, -3.387536407e-01F, 1.080953050e-02F, -3.488242626e-01F, -1.246140376e-01F, 7.082655281e-02F, 2.464486286e-02F,
+    -9.805972874e-02F, 3.448658884e-01F, -2.169695944e-01F, -8.361111395e-03F, -4.396249056e-01F, -2.536885738e-01F, 2.249805182e-01F, -1.318700910e-01F,
+    -1.280159354e-01F, 1.400770694e-01F, -1.531388462e-01F, 1.170543488e-02F, -6.544530392e-02F, -3.866139799e-02F, -1.394208428e-02F, -4.360784292e-01F,
+    5.157011002e-02F, -2.220246047e-01F, -1.210484654e-01F, 1.456122287e-02F, -2.340734750e-01F, -2.582200766e-01F, -4.719418939e-03F, 4.157204032e-01F,
+    8.692795038e-02F, 2.299222201e-01F, 1.904942393e-01F, -1.372312196e-02F, -1.070227772e-01F, -7.584617008e-03F, 1.082192436e-01F, -1.852927506e-01F,
+    -2.907824814e-01F, -2.456619591e-01F, 2.285629213e-01F, -1.434206516e-01F, -2.894706130e-01F, -1.382034719e-01F, 7.462352514e-02F, -2.185655758e-02F,
+    -3.374068737e-01F, -1.583245397e-01F, -1.469289213e-01F, 3.540180624e-02F, 7.655552775e-02F, 2.157251164e-02F, -2.435230911e-01F, -8.238297105e-01F,
+    -2.324332744e-01F, 8.955796808e-02F, -2.133595347e-01F, 7.845908403e-02F, 1.116504222e-01F, 3.251948953e-02F, 2.654128075e-01F, 1.491848379e-01F,
+    -4.597304389e-02F, 2.139569968e-01F, 5.420702975e-03F, 3.737638891e-02F, -1.189555079e-01F, -7.831099629e-02F, 3.690879419e-02F, 7.813626528e-02F,
+    3.758984804e-01F, 2.035279274e-01F, -4.429064691e-01F, -6.694243290e-03F, -2.068601400e-01F, -1.150438376e-02F, 1.623656154e-01F, -3.047391213e-02F,
+    -9.636849165e-01F, 9.970617294e-02F, -2.552243471e-01F, -3.930373490e-02F, -1.955702305e-01F, 4.800931737e-02F, -4.590460062e-01F, -3.897117972e-01F,
+    1.931977458e-02F, -7.302733511e-02F, -5.021535233e-02F, 1.398866531e-02F, -2.596304417e-01F, -2.378823410e-04F, 1.037878096e-01F, 1.768610477e-01F,
+    -5.840663910e-01F, 1.127357408e-01F, -4.718127195e-03F, -1.680403203e-02F, 2.229557037e-01F, -2.985933125e-01F, 1.915715039e-01F, -3.124624789e-01F,
+    -6.835416704e-02F, 1.359878927e-01F, -1.926960945e-01F, -4.939396866e-03F, 1.000914723e-01F, 1.951819286e-02F, 1.653653830e-01F, -6.633653641e-01F,
+    3.371056914e-01F, -1.588480771e-01F, -3.231605887e-02F, -2.571880817e-02F, -3.544222564e-02F, -2.694610953e-01F, 5.572309718e-02F, -3.484709561e-01F,
+    -3.397934735e-01F, -1.017734408e-01F, -4.178231359e-01F, -5.151656643e-02F, -3.049172461e-01F, -2.960496545e-01F, -2.027124465e-01F, -7.865345478e-01F,
+    1.553659439e-01F, 2.740578949e-01F, -2.776622772e-01F, 1.629104372e-03F, -6.401781924e-03F, -2.061742097e-01F, 4.615203142e-01F, -5.596219897e-01F,
+    -7.820073366e-01F, 1.827529967e-01F, -2.587088943e-01F, 5.116480961e-02F, -5.707491934e-02F, -1.451154351e-01F, -1.448739320e-01F, -4.048916698e-01F,
+    -2.346022725e-01F, 9.403015673e-02F, 1.143697947e-01F, -1.364734117e-02F, -3.091987073e-01F, -3.290422559e-01F, 8.585157245e-02F, -1.782065034e-01F,
+    -4.999465048e-01F, -1.017728671e-01F, -1.806833595e-01F, 2.280696854e-02F, -2.182115167e-01F, -2.409379333e-01F, -1.304166615e-01F, -1.208808899e+00F,
+    -4.652641714e-01F, -4.837610722e-01F, -2.742947638e-01F, 1.549240761e-02F, -1.479445696e-01F, 2.961803600e-02F, -1.602631509e-01F, -4.545281529e-01F,
+    3.871344402e-02F, 2.560268641e-01F, -7.902119309e-02F, -5.105162412e-02F, 7.809187472e-02F, -1.842155159e-01F, -2.348389477e-01F, -1.915720254e-01F,
+    -4.051856101e-01F, -2.462527901e-01F, -5.196640640e-02F, -3.885596246e-02F, -3.817163110e-01F, -4.605308920e-02F, -8.135018498e-02F, -5.425268412e-01F,
+    -6.186575294e-01F, -1.208567247e-01F, -6.399955601e-02F, 1.396338269e-02F, -2.189700305e-01F, 1.559328381e-02F, -2.944176495e-01F, 1.877119094e-01F,
+    4.125196636e-01F, 2.925375104e-02F, -2.923499234e-02F, -3.762719687e-03F, -8.658548445e-02F, -1.478316337e-01F, 1.291493177e-01F, -2.261157632e-01F,
+    -2.765768170e-01F, 1.054663658e-01F, -1.710747629e-01F, -6.066101417e-02F, 1.385793835e-01F, -2.247575074e-01F, -1.245190278e-01F, -4.323013723e-01F,
+    9.276907891e-03F, -4.698570818e-02F, 6.863392144e-02F, 1.252651587e-02F, -9.792660922e-02F, -2.561866045e-01F, 2.100790888e-01F, -4.304733574e-01F,
+    -1.221684813e-01F, -2.753096446e-02F, -2.207861394e-01F, 1.845604368e-02F, -4.689673781e-01F, 3.674644232e-02F, -2.011830732e-02F, -6.491026282e-01F,
+    -4.013797641e-01F, 1.962346584e-01F, -1.983520538e-01F, -7.447661757e-01F, -3.564788103e-01F, -1.198218837e-01F, -1.713968664e-01F, -8.284101635e-02F,
+    -6.514120102e-01F, -1.059184149e-01F, 3.572730813e-03F, -2.437065542e-02F, 1.180687100e-01F, -1.434593052e-01F, -3.342399374e-02F, -2.033063918e-01F,
+    4.671731293e-01F, 1.541854143e-01F, -8.339526504e-02F, -1.903641969e-02F, -2.083237469e-01F, -3.342385590e-01F, 6.519578397e-02F, -5.103223920e-01F,
+    -1.130105928e-01F, -3.025244772e-01F, -1.356206741e-02F, -2.490905114e-02F, 2.190140337e-01F, 1.249170396e-02F, -3.253986537e-01F, -5.582090020e-01F,
+    -2.428680658e-01F, -2.286294475e-02F, -2.210991085e-01F, -3.776735365e-01F, -1.793525964e-01F, 1.041612327e-01F, -2.081698328e-01F, -2.705436647e-01F,
+    -1.678690081e-03F, -4.208694026e-02F, -3.967906535e-02F, 1.075901166e-01F, -4.381481111e-01F, -2.666892111e-02F, -1.133658364e-01F, -1.037823260e-01F,
+    -4.821704030e-01F, -1.275247782e-01F, -3.222408593e-01F, -7.236681134e-02F, -2.857213914e-01F, -1.368487477e-01F, -4.025971983e-03F, -6.088500619e-01F,
+    -9.601651132e-02F, -4.774647057e-01F, -1.853199303e-01F, -6.184306741e-02F, -1.545744836e-01F, -2.094676644e-01F, 1.817619801e-01F, -9.966731071e-02F,
+    -2.672562301e-01F, 1.331489086e-01F, -3.398619294e-01F, 6.180265918e-02F, -4.414925873e-01F, -2.825791836e-01F, 1.514820307e-01F, -9.787011147e-01F,
+    -6.420053244e-01F, 5.596646294e-02F, -7.501785457e-02F, -5.670299754e-02F, -2.677282989e-01F, -1.028563604e-01F, -6.037337184e-01F, -1.009077653e-01F,
+    -1.005138038e-03F, -3.342701867e-02F, 1.470060945e-01F, -4.795455188e-02F, -5.953461677e-02F, -7.099075615e-02F, -4.029065669e-01F, -5.126400590e-01F,
+    -5.474305153e-01F, 1.088697836e-01F, -1.898011565e-01F, 4.441202618e-03F, -1.733714342e-01F, 5.136113241e-02F, -4.650152847e-02F, 4.870881140e-02F,
+    7.144838572e-02F, 1.260080189e-01F, 7.005836070e-02F, 1.046772450e-01F, -9.703484178e-02F, -4.234312102e-02F, 1.228601411e-01F, -6.690515578e-02F,
+    -1.091089025e-01F, 2.047116905e-01F, 1.407431159e-02F, -7.160937041e-02F, -2.996550202e-01F, 3.583705425e-02F, 2.062910646e-01F, -7.998585105e-01F,
+    1.035090834e-01F, 4.080098569e-01F, 6.995905191e-02F, -2.958930135e-01F, -4.332586527e-01F, 1.172517091e-01F, 1.777099520e-01F, 3.574125767e-01F,
+    -4.771680832e-01F, -9.408375621e-02F, -1.032782421e-01F, -1.858351193e-02F, -9.696770459e-02F, -1.648620665e-01F, -5.027131438e-01F, -4.441832006e-01F,
+    -5.457718968e-01F, 2.373947948e-01F, 6.371691823e-02F, 7.754824590e-03F, -1.993049234e-01F, -2.583248615e-01F, -3.213422298e-01F, -2.948928177e-01F,
+    -3.026351929e-01F, 1.495208889e-01F, -5.330613256e-01F, 4.017581791e-02F, -2.043452710e-01F, -3.617255390e-01F, -1.238392070e-01F, -3.850031495e-01F,
+    -1.847236603e-01F, 1.830586344e-01F, -5.539170504e-01F, -4.634172097e-02F, -1.147908494e-01F, -8.934836835e-02F, -1.574324369e-01F, -1.011559010e+00F,
+    -3.358466625e-01F, -1.222163141e-01F, -1.025582030e-01F, 8.383540437e-03F, -2.742994577e-02F, -2.927266657e-01F, -8.258667076e-04F, -5.823028088e-01F,
+    -6.286994815e-01F, -1.301851273e-01F, -8.098417521e-02F, 3.023692872e-03F, -1.152960137e-01F, -1.696690917e-01F, 1.929245517e-02F, -5.612666011e-01F,
+    -4.287506044e-01F, 3.933689371e-02F, -2.725132704e-01F, 2.153299190e-02F, -1.684533060e-01F, 6.159108598e-03F, -2.485423982e-01F, -5.602496117e-02F,
+    -6.272031665e-01F, 1.297321171e-01F, -2.538931668e-01F, -4.702997953e-02F, -3.007175922e-01F, -3.035952151e-01F, -7.092079520e-02F, 4.809601605e-01F,
+    -4.249515235e-01F, -5.283508897e-01F, -1.117531583e-01F, -9.779328853e-02F, -1.872620881e-01F, -2.683244050e-01F, -4.763379991e-01F, -1.729817837e-01F,
+    -1.196950078e-01F, -9.619991295e-03F, 9.563819319e-02F, -7.250343263e-02F, 4.757500812e-02F, -7.406197786e-01F, -8.359422535e-02F, -2.078672647e+00F,
+    4.363620654e-02F, -7.415748239e-01F, -1.748364121e-01F, -4.270163178e-02F, -1.684449166e-01F, -1.051636457e+00F, -1.193897054e-01F, -2.290374227e-02F,
+    3.911012113e-01F, -3.261459172e-01F, -1.035780981e-01F, -8.191380501e-01F, -6.048252434e-02F, 5.222573131e-02F, 1.373607945e-02F, -9.935199618e-01F,
+    -4.057450593e-01F, -2.231411487e-01F, -2.749588788e-01F, 4.208279774e-02F, 2.079465240e-01F, -2.537240982e-01F, -1.033494174e-01F, 8.704987913e-02F,
+    2.978599370e-01F, 1.905186325e-01F, 2.453756630e-01F, 4.390775561e-01F, 1.720084697e-01F, 2.137335949e-02F, 1.691891626e-02F, -2.440510131e-02F,
+    -6.330106854e-01F, -3.865050972e-01F, -3.688627779e-01F, -2.873828113e-01F, 1.226614639e-01F, -5.638499260e-01F, 1.332470775e-02F, -1.060511172e-02F,
+    -5.351528525e-01F, -3.163579106e-01F, 1.258343011e-01F, -6.958078593e-02F, -6.568093300e-01F, -1.093552262e-01F, -5.595032871e-02F, -2.163233459e-01F,
+    8.932109177e-02F, -7.450567931e-02F, 8.612829447e-02F, -1.065255404e+00F, -6.260227561e-01F, -2.071615309e-01F, -1.844972000e-02F, -2.256243825e-01F,
+    -3.154754341e-01F, -4.103300571e-01F, 8.238486201e-02F, 1.347916871e-01F, 7.845482230e-02F, 1.968313456e-01F, 1.308842748e-01F, -1.368814349e+00F,
+    -4.371864796e-01F, 2.253262885e-02F, -1.494409889e-01F, 3.035170026e-02F, 7.760665379e-03F, 5.601111427e-02F, -8.080647588e-01F, -1.259363443e-01F,
+    -2.333650589e-01F, -8.862367272e-01F, -4.662558138e-01F, -9.145393372e-01F, -4.868010432e-02F, -7.635487318e-01F, -1.845672131e-01F, -1.463320106e-01F,
+    2.125386707e-02F, -4.301391244e-01F, -1.033514366e-01F, -8.323039860e-02F, -2.419901192e-01F, -5.320551395e-01F, 1.075227037e-01F, 2.873764560e-02F,
+    1.960929334e-01F, -3.287787139e-01F, 5.267175660e-02F, -3.295768984e-03F, -6.701506674e-02F, -5.443470478e-01F, 3.643630818e-02F, -3.798750639e-01F,
+    -5.010930300e-01F, -6.562101841e-01F, -1.808714271e-01F, 1.308608502e-01F, 3.007697165e-01F, -4.580765963e-01F, 1.243745387e-01F, -1.634934068e+00F,
+    -3.322564363e-01F, -4.614694417e-01F, -7.946220785e-02F, 2.917896770e-02F, -1.657013595e-02F, -6.714276075e-01F, -2.892811298e-01F, -1.583371460e-01F,
+    -8.758937120e-01F, -7.116867304e-01F, -7.904090881e-01F, -2.509483695e-01F, -2.346706241e-01F, 3.719306737e-02F, -2.581964992e-02F, -4.737827182e-01F,
+    -8.600778878e-02F, 1.488753855e-01F, 1.689099818e-01F, -6.402763724e-02F, 2.569265962e-01F, 2.025267668e-02F, -1.505786777e-01F, 9.453468770e-02F,
+    3.963124752e-01F, -8.768598549e-03F, -2.031338029e-02F, 4.157167673e-02F, -2.390184999e-01F, 2.246803045e-02F, 1.886975616e-01F, -5.242251232e-02F,
+    -6.785706431e-02F, -5.051143169e-01F, 1.154220626e-01F, 3.355747163e-01F, 3.881108761e-01F, -1.042268276e+00F, -3.004733622e-01F, 6.362377107e-02F,
+    -1.644734293e-01F, 3.304962218e-01F, -2.015248537e-01F, 1.994318962e-01F, -6.610634923e-02F, 8.854769915e-02F, 1.388018280e-01F, -4.572811723e-01F,
+    -2.298780382e-01F, 1.543381363e-01F, 1.114238948e-01F, -1.458232198e-02F, 2.291618586e-01F, -3.443522751e-01F, -7.649124414e-02F, -9.620841593e-02F,
+    -2.186379582e-02F, -5.601764321e-01F, 1.206288934e-01F, 1.827575117e-01F, 3.135171533e-01F, 4.408365786e-01F, 8.914268017e-02F, -2.260250300e-01F,
+    2.462681979e-01F, -6.073586345e-01F, -1.607699245e-01F, 1.813242435e-01F, 3.418654799e-01F, -2.956102192e-01F, -1.094822735e-01F, -1.140411943e-01F,
+    5.856151506e-02F, -5.529932212e-03F, 1.674066335e-01F, -2.242923230e-01F, 6.944893301e-02F, -2.053909153e-01F, -2.195605449e-02F, -2.409812529e-03F,
+    -6.167170405e-01F, -8.005281687e-01F, -1.840745509e-01F, -7.136334181e-01F, 7.258544862e-02F, -2.647935152e-01F, 8.700785041e-02F, -4.364382923e-01F,
+    -1.720480621e-01F, 3.422152102e-01F, -1.021284088e-01F, -3.776073456e-01F, -4.204676952e-03F, -1.882261038e-01F, 1.446198225e-01F, -4.166721404e-01F,
+    -2.446532845e-01F, -7.327986956e-01F, -2.322858274e-01F, -8.651259542e-02F, -4.866033420e-02F, -2.927684188e-01F, 1.721456647e-01F, 8.761736751e-02F,
+    2.841123380e-02F, -3.986938894e-01F, -8.995302320e-01F, -3.435115516e-01F, 1.721535623e-01F, 1.170135811e-01F, -2.605026960e-01F, -3.844218701e-02F,
+    -1.854015440e-01F, 3.459617198e-01F, -3.959962726e-02F, 9.870562702e-02F, 1.853733510e-01F, -1.064600796e-01F, 8.421251923e-02F, -7.425999641e-01F,
+    -1.665792763e-01F, -5.545462370e-01F, -4.309001565e-01F, -2.158964872e-01F, 1.240379959e-01F, -1.261153668e-01F, -1.238646209e-01F, -6.489857286e-02F,
+    2.716658115e-01F, -6.153016686e-01F, 8.864076436e-02F, 3.168016970e-01F, 1.271888316e-01F, 2.099274993e-01F, 4.652829468e-02F, -5.742939711e-01F,
+    -2.470607907e-01F, 3.085537851e-01F, -9.910524487e-01F, -1.354493797e-01F, -2.935825475e-02F, -3.808243871e-01F, -2.525008842e-02F, -1.227147412e-02F,
+    -1.087577701e+00F, 1.262281388e-01F, -1.479083449e-01F, -2.272690386e-01F, 7.472591102e-02F, -2.285746336e-01F, -1.207224429e-01F, 8.539284579e-03F,
+    -7.815407515e-01F, -3.955775201e-01F, -1.249600723e-01F, -1.658725366e-02F, 1.968752593e-01F, -1.778075248e-01F, -3.428503871e-01F, 1.404906809e-01F,
+    1.800254881e-01F, 5.256683230e-01F, -1.826934218e-01F, -5.024185777e-02F, 1.150316596e-01F, 2.613401413e-01F, -8.564711362e-02F, 1.360447258e-01F,
+    -1.888003014e-02F, -1.488482114e-02F, -1.315145642e-01F, -5.214796662e-01F, -1.298118383e-01F, 1.868187487e-01F, -1.487653889e-02F, -1.477143075e-02F,
+    -7.513128221e-02F, 1.672200561e-01F, -3.207991719e-01F, -3.146385849e-01F, -4.215010405e-01F, -2.635598183e-01F, 1.473001242e-01F, -8.086925149e-01F,
+    3.477360904e-01F, 2.108367682e-01F, -1.451899856e-02F, -3.767776489e-01F, -5.785749480e-02F, 3.811770380e-01F, -1.486706138e-01F, 1.118683517e-01F,
+    -5.699991807e-02F, -3.728095889e-01F, -4.650186896e-01F, -5.765225738e-02F, -1.808961332e-01F, -3.676269948e-01F, 1.050070226e-01F, 1.460718215e-01F,
+    3.024404170e-03F, -8.241379261e-01F, 1.862664148e-02F, 1.210744586e-02F, 3.036123812e-01F, -1.360368580e-01F, -3.538296744e-02F, -4.283282161e-02F,
+    -4.035210907e-01F, -5.052015781e-01F, -3.759742677e-01F, -7.512837052e-01F, -6.631608605e-01F, -3.390674889e-01F, -8.590527773e-01F, -6.199969053e-01F,
+    1.946339011e-01F, -3.944793425e-04F, -6.119293720e-02F, -2.847869694e-01F, -7.327101380e-02F, -5.109984279e-01F, 2.410772443e-02F, 1.079923958e-01F,
+    -3.284352720e-01F, -1.362204552e-01F, -7.187180519e-01F, 1.833640486e-01F, -2.865004353e-02F, -9.622817487e-02F, 2.727033012e-02F, 2.589926720e-01F,
+    1.848123223e-01F, -8.192795329e-03F, -1.532311440e-01F, -9.582711756e-02F, -2.166356593e-01F, -6.246483922e-01F, -1.721411943e-01F, 3.964874893e-02F,
+    -3.042439520e-01F, -3.721302748e-01F, -1.012580246e-01F, 1.610789895e-01F, -3.473609984e-01F, -4.279955626e-01F, -3.217787668e-02F, -8.050264418e-02F,
+    2.228778452e-01F, -5.039200187e-01F, -2.441357970e-01F, 2.584390640e-01F, -1.746870279e-01F, 9.904321283e-02F, 7.083452493e-02F, -1.416030884e+00F,
+    1.045837551e-01F, -1.165254116e-01F, -2.137223780e-01F, -1.913097948e-01F, 2.391903996e-01F, -5.633376837e-01F, -1.143584177e-01F, -4.863913730e-02F,
+    -1.853267550e-01F, 2.066511661e-01F, -1.489757597e-01F, 2.984199226e-01F, 1.208576709e-01F, -1.971201599e-01F, 4.176742956e-02F, 3.192251027e-01F,
+    -1.870341450e-01F, -2.779366076e-01F, -1.044644237e+00F, 2.211541384e-01F, -1.704188585e-01F, -4.474511147e-01F, 5.542352796e-02F, 3.300272627e-03F,
+    6.303205341e-02F, -5.558472872e-01F, -1.146082997e+00F, -1.057304889e-01F, -7.115462795e-03F, -1.824417263e-01F, -6.117911339e-01F, -1.947501451e-01F,
+    1.831548214e-01F, -6.002231240e-01F, -1.624216437e-01F, -5.822155997e-02F, -3.799949884e-01F, -4.340494275e-01F, -1.088025331e+00F, -6.761105359e-02F,
+    -8.919397593e-01F, -1.360207438e+00F, -2.827486694e-01F, -3.870905042e-01F, -1.024545789e+00F, -3.291251063e-01F, -6.377931684e-02F, 1.066252813e-01F,
+    9.554441203e-04F, 1.184251532e-01F, -1.923210770e-01F, 1.314802766e-01F, -1.684601605e-01F, -1.087657437e-01F, -4.022506997e-03F, -2.679425851e-02F,
+    -7.138550282e-01F, -3.621430136e-03F, -5.197350383e-01F, 1.712105870e-01F, 1.500569135e-01F, -4.793134630e-01F, 1.633015871e-01F, -1.462842375e-01F,
+    1.651047617e-01F, 9.927821904e-02F, -5.515081286e-01F, -2.953903079e-01F, 4.307632148e-01F, -2.925632298e-01F, -1.370407462e+00F, -3.550993279e-02F,
+    2.735090628e-02F, -5.704493523e-01F, -2.745622993e-01F, -7.178554684e-02F, -4.084818065e-01F, -8.020348549e-01F, -1.836820245e-01F, -4.349730909e-03F,
+    -4.919064939e-01F, -6.907193363e-02F, -1.157829762e-01F, -8.091374636e-01F, 2.039909065e-01F, -4.123778343e-01F, -2.052345276e-01F, -4.579786211e-02F,
+    -6.284858584e-01F, -1.885435730e-01F, -1.840466857e-01F, 1.901706606e-01F, 3.913603723e-02F, -1.988730431e-01F, -1.778422445e-01F, -4.569845274e-02F,
+    -6.498434544e-01F, -1.330544651e-01F, 2.646131255e-02F, 1.515455097e-01F, -1.916321218e-01F, 6.081533059e-02F, -1.789902449e-01F, -2.289367169e-01F,
+    -1.738612354e-01F, -3.856613860e-02F, -1.380704157e-02F, 1.853763461e-01F, -2.255130112e-01F, 4.944718629e-02F, 6.947612017e-02F, -1.607815921e-01F,
+    -2.818824947e-01F, 3.188379109e-01F, 3.215845227e-01F, -2.864017189e-01F, -1.193220243e-01F, -6.757575274e-01F, -2.549075484e-01F, -8.746261895e-02F,
+    -6.515352726e-01F, -1.171879936e-02F, -4.054770768e-01F, -1.336319745e-01F, 9.336658567e-02F, -1.296658516e+00F, -3.146817982e-01F, -3.174660355e-02F,
+    -9.300944805e-01F, -6.131030917e-01F, -3.420579946e-03F, 3.633948863e-01F, -1.332569718e-01F, -1.513125300e-01F, 6.221399177e-03F, -1.677245647e-02F,
+    6.745504737e-01F, 1.910682470e-01F, 1.982106715e-01F, -1.341156363e-01F, 8.397962898e-02F, 6.789192557e-02F, 4.997550845e-01F, -4.271064103e-01F,
+    -7.000830770e-01F, -3.412979841e-01F, -2.430456132e-01F, -3.781645298e-01F, 1.411312222e-01F, -2.347044796e-01F, -7.560795546e-01F, -6.663604975e-01F,
+    -2.476951778e-01F, -7.313698530e-01F, -5.183740258e-01F, -1.418555975e+00F, 2.989114635e-02F, 1.565361917e-01F, 9.620641917e-02F, -5.629804730e-01F,
+    1.767583489e-01F, -6.366427541e-01F, -7.934670448e-01F, -4.205610603e-02F, 7.287310958e-01F, 2.178685516e-01F, -2.924871743e-01F, -4.492517114e-01F,
+    -7.082002163e-01F, -2.009377629e-01F, 1.421774775e-01F, -5.940696225e-02F, -3.483067453e-02F, 4.471125305e-01F, -1.434466958e+00F, -7.875028998e-02F,
+    -1.100981236e-01F, 5.994314700e-02F, -1.902353019e-01F, 1.940307915e-01F, -4.166230261e-01F, -3.878990412e-01F, -9.209852815e-01F, -9.822761267e-02F,
+    -2.561863363e-01F, -3.387768567e-01F, -3.556016386e-01F, -5.524420738e-02F, -8.340602368e-02F, -2.501049638e-01F, 9.433410317e-02F, -3.655625582e-01F,
+    -1.774115264e-01F, -1.235443234e+00F, -4.307189882e-01F, 2.729331553e-01F, -1.581062824e-01F, -2.039175928e-01F, 5.403292775e-01F, -3.496094942e-01F,
+    -6.770454049e-01F, -1.083817959e+00F, 4.681459665e-01F, -4.352703989e-01F, -3.799952567e-01F, 7.656948292e-04F, 3.344795704e-01F, -9.943053871e-02F,
+    -7.429547906e-01F, -2.936501205e-01F, -7.921925783e-01F, -7.500282526e-01F, 1.469167769e-01F, 1.539780051e-01F, -3.680386767e-02F, -6.719957590e-01F,
+    -3.673986532e-03F, -1.440744400e-01F, -1.255148351e-01F, -5.287324190e-01F, 2.676447332e-01F, 1.516519934e-01F, -9.680715799e-01F, -1.399459094e-01F,
+    -4.596104324e-01F, -1.112687141e-01F, -2.776428163e-01F, 1.126909032e-01F, -4.511984810e-02F, -1.157566383e-01F, -5.596393943e-01F, -6.020082235e-01F,
+    -1.570330143e+00F, 2.421277463e-01F, 5.554453004e-03F, -3.912485242e-01F, -5.565789714e-02F, 1.160216425e-02F, -7.735865712e-01F, -9.631132483e-01F,
+    1.000918448e-01F, -1.223872066e+00F, -8.236249089e-01F, 1.230176017e-01F, -3.902113736e-01F, -4.345669746e-01F, -1.725094318e-01F, -3.190591335e-01F,
+    -3.225431442e-01F, -2.823053002e-01F, -7.439192384e-02F, -3.296149671e-01F, 1.760174334e-01F, 1.170552149e-01F, -3.707802594e-01F, -2.702180445e-01F,
+    -2.527502924e-02F, -1.615815610e-01F, -2.863213718e-01F, 2.163128555e-01F, 3.476434201e-02F, 1.356166005e-01F, -3.724356741e-02F, -3.917846084e-01F,
+    -1.012705922e+00F, -2.406599224e-01F, -6.527566910e-02F, 2.339934856e-01F, 5.850963667e-02F, -1.207645759e-01F, -1.194641218e-01F, -5.360772014e-01F,
+    1.219932660e-01F, 4.066356272e-02F, 2.086025029e-01F, 2.817705870e-01F, 3.820033669e-01F, 1.771721542e-01F, 6.770458817e-02F, -1.959860325e-01F,
+    -3.364309967e-01F, -3.874481320e-01F, -6.038226485e-01F, -3.270628154e-01F, -1.652310044e-01F, -2.163103521e-01F, -6.044813395e-01F, -1.675175726e-01F,
+    -1.753346026e-01F, -6.567575336e-01F, -5.736345649e-01F, -1.223086491e-01F, -2.567856610e-01F, -5.288512111e-01F, -1.511437654e+00F, -1.611808687e-01F,
+    -1.772845984e-01F, -2.940553725e-01F, -5.218210816e-02F, -6.236325577e-02F, -5.536837578e-01F, 3.632204831e-01F, -3.897932172e-01F, -1.198359877e-01F,
+    -9.775152802e-02F, -2.613005228e-02F, -5.795271993e-01F, -5.609781742e-01F, 4.638867080e-02F, 4.536443204e-02F, 1.110233739e-01F, -1.582988054e-01F,
+    -3.316197693e-01F, -4.063052237e-01F, -1.506714374e-01F, -2.307172418e-01F, 2.151598334e-01F, 1.289786249e-01F, -2.326686531e-01F, -7.176968455e-01F,
+    1.151815951e-01F, -6.416484714e-01F, -5.829834342e-01F, 2.779404819e-01F, -6.390516460e-02F, -9.776952863e-02F, 1.494897064e-02F, 5.209135637e-02F,
+    -2.976380289e-01F, -4.966031909e-01F, -2.849327922e-01F, -1.595723629e-01F, -2.499440163e-01F, -7.169232517e-02F, -1.302513361e+00F, -5.951474309e-01F,
+    -6.415388584e-01F, -8.905324340e-01F, -2.461545020e-01F, 2.953292727e-01F, -3.234264553e-01F, -5.690593719e-01F, -4.740200341e-01F, -2.935575545e-01F,
+    -3.368477523e-01F, -1.330892444e-01F, 8.742223680e-02F, -3.186872303e-01F, 1.418817341e-01F, 1.636763662e-01F, -7.322214246e-01F, -5.429655313e-01F,
+    2.821919620e-01F, 1.835944355e-01F, -1.058409810e+00F, -3.776849210e-01F, -7.571357489e-02F, 7.301822305e-02F, -1.806477755e-01F, -1.757075936e-01F,
+    -5.249744058e-01F, 2.801086009e-01F, -1.526970118e-01F, -1.124712110e+00F, 5.212977529e-02F, -1.492580622e-01F, -1.269795001e-01F, -8.200996518e-01F,
+    -7.646441460e-01F, 1.870569191e-03F, -6.869832277e-01F, -4.298644364e-01F, 2.638857961e-01F, 2.999604344e-01F, -1.371584892e+00F, 3.142695725e-01F,
+    -1.771348417e-01F, -6.383196265e-02F, -7.519306242e-02F, 2.178486735e-01F, -2.346074767e-02F, 6.376855075e-02F, 1.652578637e-02F, -2.931280434e-01F,
+    -8.284594417e-01F, -5.496605635e-01F, -7.162453234e-02F, -8.648871779e-01F, 2.764111459e-01F, 3.770664334e-02F, 4.516405761e-01F, 1.948317885e-01F,
+    -4.572672844e-01F, -1.310676634e-01F, -8.842939734e-01F, -4.811096787e-01F, -1.360421628e-01F, 8.358888328e-02F, -9.351483583e-01F, -6.218116879e-01F,
+    -1.195875183e-01F, 1.647186130e-01F, 2.503300086e-02F, 2.244255245e-01F, -2.527691722e-01F, -1.832535863e-02F, -7.174819112e-01F, -1.447139829e-01F,
+    4.236029983e-01F, 5.437838286e-02F, 1.917083263e-01F, -8.532927632e-01F, 2.262417525e-01F, -3.356684446e-01F, -3.122527003e-01F, 2.321957648e-01F,
+    -3.904247656e-02F, 1.129399538e-01F, -7.335145473e-01F, -2.607622147e-01F, -1.418087035e-01F, -2.835497558e-01F, -6.269069314e-01F, -2.222063988e-01F,
+    -1.009996831e-01F, 1.431408226e-01F, 2.475603223e-01F, 1.545123160e-01F, 2.071352117e-02F, -1.651217043e-01F, -8.045167327e-01F, 4.780584201e-02F,
+    -8.621944189e-01F, -5.023323894e-01F, -1.462259442e-01F, -1.854915172e-01F, 2.584867477e-01F, -6.428691745e-01F, -1.050769567e+00F, 1.588479429e-01F,
+    1.045616344e-01F, -8.306882381e-01F, -2.268986553e-01F, 3.240014911e-01F, 3.444630504e-01F, 2.904321551e-01F, -4.256026447e-01F, -2.297739387e-01F,
+    -3.660101444e-02F, -4.530546069e-01F, -8.566061854e-01F, -3.885056078e-01F, -1.290543377e-01F, -2.298780680e-01F, -9.039804339e-02F, -1.291022301e-01F,
+    -6.769987345e-01F, 2.703300416e-01F, 1.622426361e-01F, -8.211158216e-02F, -2.858366072e-01F, -3.866800293e-02F, -1.904104203e-01F, -4.055402428e-02F,
+    -1.378659755e-01F, -2.386160195e-01F, -2.092814893e-01F, -5.208147168e-01F, 2.882298231e-01F, 4.347825944e-01F, -7.257309556e-02F, -3.386394382e-01F,
+    -1.708130240e-01F, -8.774502277e-01F, -8.401950002e-01F, 3.494769633e-01F, 3.173128068e-01F, 8.741018921e-02F, -6.203622222e-01F, -2.729929984e-01F,
+    -1.176394429e-02F, -1.260023355e+00F, -1.592080146e-01F, -4.941147268e-01F, 1.415668875e-01F, 6.234174594e-02F, -3.882736862e-01F, -2.491148263e-01F,
+    -2.321617603e-01F, -7.890287042e-01F, -2.083775960e-02F, -8.556122780e-01F, -2.731330395e-01F, -5.720039606e-01F, -6.300333142e-01F, 1.356765628e-01F,
+    1.544263028e-02F, -1.443638951e-01F, -5.882961154e-01F, -7.218566537e-02F, 1.183116361e-01F, 1.857975423e-01F, -4.814450741e-01F, -2.451673597e-01F,
+    1.877638549e-01F, -7.068858482e-03F, -1.481941789e-01F, -1.564677507e-01F, -4.577852320e-03F, 9.663710743e-02F, -2.903568745e-01F, -2.963166237e-01F,
+    -4.278645217e-01F, -1.848343015e-01F, -2.908010483e-01F, -3.199640512e-01F, -4.669483304e-01F, 1.362746675e-02F, 2.792338654e-02F, 2.742311656e-01F,
+    1.185216904e-01F, 1.626624465e-01F, -1.255225018e-02F, -1.710059792e-01F, 9.320110828e-02F, 2.800115049e-01F, 1.281737089e-01F, 4.093986750e-02F,
+    -1.424976140e-01F, -1.090217710e+00F, -2.307690680e-01F, -4.464595318e-01F, -3.295515478e-02F, 2.433368117e-01F, -5.189936161e-01F, -3.357587755e-01F,
+    -8.079255819e-01F, -1.453873813e-01F, -6.381322145e-01F, -9.146690369e-02F, 6.838760525e-02F, 5.024361238e-02F, -2.749530077e-01F, -7.387018204e-01F,
+    -4.061571360e-01F, -3.486025035e-01F, 3.842406720e-02F, 3.594423532e-01F, -3.649510816e-02F, 1.839606091e-02F, -4.303282797e-01F, -3.883269131e-01F,
+    -3.891800344e-01F, -2.802507579e-02F, -1.307872832e-01F, 4.794871509e-01F, 3.198842704e-01F, 7.305406034e-02F, -8.459693193e-02F, -4.324132204e-01F,
+    -1.501066238e-01F, -1.602517366e-01F, 2.572120130e-01F, 5.685083941e-02F, -1.111558639e-02F, -2.572792582e-03F, 1.041502059e-01F, 1.743864641e-02F,
+    -1.579856873e-01F, -1.431011111e-01F, 2.258583670e-03F, -5.562580824e-01F, 1.995175630e-01F, 3.300715685e-01F, -7.582789660e-01F, -8.784151636e-03F,
+    3.042005375e-02F, 2.176734805e-01F, 1.326775998e-01F, -1.930037737e-01F, -2.171472758e-01F, 3.906437159e-01F, 5.439417958e-01F, -2.927286029e-01F,
+    -3.907019645e-02F, -8.367286921e-01F, -1.815510690e-01F, 1.387798339e-01F, 6.681281328e-02F, 3.216917068e-02F, -1.236518383e+00F, 3.251503780e-02F,
+    9.867548943e-02F, -1.237348169e-01F, 3.852801025e-02F, -2.544649839e-01F, 6.042912230e-02F, 1.078250036e-01F, -1.209840272e-02F, -2.084670067e-01F,
+    -1.545161009e-01F, 2.563029341e-02F, -2.981570959e-01F, 9.494902939e-02F, 1.217909753e-01F, 8.172404021e-03F, -1.041898131e+00F, -4.102621675e-01F,
+    -6.318404078e-01F, -7.379942387e-02F, 1.931538247e-02F, -4.743112922e-01F, 1.203799769e-01F, -1.121874675e-01F, -6.124106050e-01F, -5.636708438e-02F,
+    -7.581035495e-01F, -7.990278602e-01F, -4.643651843e-01F, 1.009205282e-01F, -8.704836369e-01F, 1.341472729e-03F, 1.199544147e-01F, 6.566920877e-02F,
+    -2.113758624e-01F, -4.461446702e-01F, -6.574308276e-01F, 3.167059422e-01F, -2.128846347e-01F, -1.136079192e+00F, 1.106780246e-01F, -2.903422713e-01F,
+    -4.400088489e-01F, -1.104996562e+00F, -4.470987618e-02F, -1.086324215e+00F, 1.117647961e-01F, 8.408227563e-02F, -2.082006186e-01F, -2.320017368e-01F,
+    -3.289574385e-01F, -1.217421770e+00F, -2.157684118e-01F, -2.591809928e-01F, 5.776714087e-01F, 2.540887296e-01F, -1.369899511e-01F, -1.509968042e-01F,
+};
+
+alignas(64) static float const ntm_aot_layer_4_biases[64] = {
+    -9.289485216e-01F, -3.876004517e-01F, 6.085912585e-01F, -5.369158983e-01F, -3.860507533e-02F, -4.146694541e-01F, -4.287272394e-01F, -4.599825442e-01F,
+    -3.023303151e-01F, -3.583387136e-01F, -1.333279610e+00F, -9.491336346e-02F, -1.521355748e+00F, 1.005300522e+00F, 6.287221313e-01F, 7.412593961e-01F,
+    -7.812876701e-01F, -3.562639952e-01F, -3.731429875e-01F, -7.251290083e-01F, -1.067432642e+00F, -8.935332894e-01F, 3.711897507e-02F, 7.559925914e-01F,
+    4.932507873e-01F, -4.271593988e-01F, 1.481748939e+00F, -4.788882434e-01F, 9.699399471e-01F, -2.339481115e+00F, -5.811726451e-01F, -8.603006005e-01F,
+    -4.982632995e-01F, -5.153295994e-01F, -6.377953887e-01F, -6.029388309e-01F, 8.578518033e-01F, 1.326542646e-01F, -5.516959429e-01F, -2.847377956e-01F,
+    -9.488339424e-01F, 1.248637080e+00F, -3.469575644e-01F, 4.099107981e-01F, -5.968010426e-01F, -4.368448257e-01F, -2.235924959e+00F, -5.249826312e-01F,
+    9.875904769e-02F, -2.730964720e-01F, 6.584571302e-02F, -2.161818504e+00F, -2.074306488e+00F, -5.674216747e-01F, 1.060352206e+00F, 9.383336306e-01F,
+    -6.109001040e-01F, -1.312006414e-01F, -6.713262200e-02F, -2.271689028e-01F, -2.322004557e+00F, -2.726200581e+00F, -8.226353526e-01F, -5.157631636e-01F,
+};
+
+static inline void ntm_aot_layer_4(float const *in_activations, float *out_activations)
+{
+    // outputs [0, 8)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_4_biases[0]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_4_biases[1]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_4_biases[2]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_4_biases[3]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_4_biases[4]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_4_biases[5]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_4_biases[6]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_4_biases[7]);
+
+        float const *const panel_weights = ntm_aot_layer_4_weights + 0U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 0U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 1U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 2U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 3U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 4U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 5U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 6U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 7U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [8, 16)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_4_biases[8]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_4_biases[9]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_4_biases[10]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_4_biases[11]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_4_biases[12]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_4_biases[13]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_4_biases[14]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_4_biases[15]);
+
+        float const *const panel_weights = ntm_aot_layer_4_weights + 512U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 8U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 9U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 10U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 11U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 12U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 13U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 14U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 15U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [16, 24)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_4_biases[16]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_4_biases[17]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_4_biases[18]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_4_biases[19]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_4_biases[20]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_4_biases[21]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_4_biases[22]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_4_biases[23]);
+
+        float const *const panel_weights = ntm_aot_layer_4_weights + 1024U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 16U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 17U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 18U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 19U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 20U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 21U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 22U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 23U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [24, 32)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_4_biases[24]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_4_biases[25]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_4_biases[26]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_4_biases[27]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_4_biases[28]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_4_biases[29]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_4_biases[30]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_4_biases[31]);
+
+        float const *const panel_weights = ntm_aot_layer_4_weights + 1536U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 24U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 25U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 26U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 27U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 28U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 29U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 30U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 31U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [32, 40)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_4_biases[32]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_4_biases[33]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_4_biases[34]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_4_biases[35]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_4_biases[36]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_4_biases[37]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_4_biases[38]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_4_biases[39]);
+
+        float const *const panel_weights = ntm_aot_layer_4_weights + 2048U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 32U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 33U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 34U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 35U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 36U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 37U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 38U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 39U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [40, 48)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_4_biases[40]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_4_biases[41]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_4_biases[42]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_4_biases[43]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_4_biases[44]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_4_biases[45]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_4_biases[46]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_4_biases[47]);
+
+        float const *const panel_weights = ntm_aot_layer_4_weights + 2560U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 40U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 41U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 42U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 43U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 44U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 45U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 46U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 47U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [48, 56)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_4_biases[48]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_4_biases[49]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_4_biases[50]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_4_biases[51]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_4_biases[52]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_4_biases[53]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_4_biases[54]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_4_biases[55]);
+
+        float const *const panel_weights = ntm_aot_layer_4_weights + 3072U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 48U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 49U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 50U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 51U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 52U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 53U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 54U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 55U, ntm_aot_relu(accumulator_7));
+    }
+    // outputs [56, 64)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_4_biases[56]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_4_biases[57]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_4_biases[58]);
+        ntm_aot_vector accumulator_3 = ntm_aot_set1(ntm_aot_layer_4_biases[59]);
+        ntm_aot_vector accumulator_4 = ntm_aot_set1(ntm_aot_layer_4_biases[60]);
+        ntm_aot_vector accumulator_5 = ntm_aot_set1(ntm_aot_layer_4_biases[61]);
+        ntm_aot_vector accumulator_6 = ntm_aot_set1(ntm_aot_layer_4_biases[62]);
+        ntm_aot_vector accumulator_7 = ntm_aot_set1(ntm_aot_layer_4_biases[63]);
+
+        float const *const panel_weights = ntm_aot_layer_4_weights + 3584U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 2U]), accumulator_2);
+            accumulator_3 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 3U]), accumulator_3);
+            accumulator_4 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 4U]), accumulator_4);
+            accumulator_5 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 5U]), accumulator_5);
+            accumulator_6 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 6U]), accumulator_6);
+            accumulator_7 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[8U * input_index + 7U]), accumulator_7);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 56U, ntm_aot_relu(accumulator_0));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 57U, ntm_aot_relu(accumulator_1));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 58U, ntm_aot_relu(accumulator_2));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 59U, ntm_aot_relu(accumulator_3));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 60U, ntm_aot_relu(accumulator_4));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 61U, ntm_aot_relu(accumulator_5));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 62U, ntm_aot_relu(accumulator_6));
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 63U, ntm_aot_relu(accumulator_7));
+    }
+}
+
+// 64 x 3 (linear)
+alignas(64) static float const ntm_aot_layer_5_weights[192] = {
+    -1.984395273e-02F, -2.134234086e-02F, -6.316623650e-03F, 8.124299347e-02F, 1.045761257e-02F, -1.868555844e-01F, 6.552191079e-02F, 2.454634011e-02F,
+    -4.931878764e-03F, 1.192690805e-02F, 1.533352491e-02F, 3.204655647e-02F, 3.249495104e-02F, 3.676374257e-02F, -3.988192230e-02F, -5.877187476e-02F,
+    6.758193020e-03F, -9.784746170e-02F, -4.752668738e-02F, -1.055057049e-01F, -1.840940677e-02F, 5.671158805e-02F, 4.182856530e-02F, 1.831863634e-02F,
+    1.203790829e-01F, -2.543357573e-02F, 9.496801347e-02F, 6.422276143e-03F, -2.653233521e-02F, -3.483342379e-02F, 2.861665189e-02F, 4.514319822e-02F,
+    4.248521477e-02F, 2.925442299e-03F, 2.394424751e-02F, 2.869920619e-02F, -3.490876034e-02F, 4.962681606e-02F, 1.211431101e-01F, 1.296000555e-02F,
+    3.264705464e-02F, 3.197056428e-02F, -1.714982279e-02F, -2.245125733e-02F, -1.385765057e-02F, -1.049607177e-03F, 1.703219861e-02F, 2.408101782e-02F,
+    3.302911296e-02F, -2.595972456e-02F, -2.014424652e-02F, 1.856883243e-02F, -3.043682873e-02F, -3.902700171e-02F, 1.211270783e-02F, 5.633612722e-02F,
+    7.843322307e-02F, 6.408268213e-02F, -4.697611555e-02F, -2.165677957e-02F, 6.326601841e-03F, 7.199695334e-03F, 6.119868252e-03F, 4.288228601e-02F,
+    1.035189838e-03F, -9.915300645e-03F, -4.054349661e-02F, -4.644779954e-03F, 3.057235479e-02F, 1.346506625e-01F, -5.203229189e-02F, -4.964007810e-02F,
+    2.337370813e-02F, 1.317566819e-02F, -4.734444618e-02F, 9.895353764e-02F, -1.580906659e-02F, 2.949704826e-01F, 1.722758077e-02F, 3.059906699e-02F,
+    3.659717739e-02F, 2.007080801e-02F, 4.372184724e-02F, -1.126288902e-02F, -2.969819866e-02F, -4.055499658e-02F, -3.489676118e-02F, -1.021345407e-01F,
+    2.528383210e-02F, 4.023732152e-03F, 6.451634318e-02F, -5.011481047e-02F, -2.342357486e-02F, -1.225205697e-02F, -2.007926628e-02F, -2.191981673e-02F,
+    6.637303531e-02F, 5.119800568e-02F, 2.236673236e-02F, 2.957838960e-02F, 4.576746747e-02F, 4.379029945e-02F, -2.927927300e-02F, 6.227203179e-03F,
+    4.174564034e-02F, 5.601339042e-02F, -1.836208254e-02F, -1.812029444e-02F, -3.390812874e-02F, -2.837576903e-03F, 3.408868983e-02F, 1.169693395e-01F,
+    -1.450622361e-02F, -9.385210276e-02F, 8.620077744e-03F, -3.199496493e-02F, -7.025192957e-03F, -4.047171772e-02F, -1.128722634e-02F, -6.030724384e-03F,
+    4.499676451e-02F, 7.210128941e-03F, -1.982061425e-03F, 3.168387711e-02F, 4.749247059e-02F, 5.457728356e-02F, 8.288558573e-03F, -7.867638767e-02F,
+    -3.844292462e-02F, 5.930542829e-04F, -4.975102469e-02F, 4.949095100e-02F, -1.543704700e-02F, 6.579630822e-02F, 2.268389612e-02F, -4.486865550e-02F,
+    1.363540441e-01F, -6.904363632e-02F, -6.355654448e-03F, -4.040621221e-02F, -8.624898642e-02F, 7.941452786e-03F, 2.534458786e-02F, 3.274233267e-02F,
+    -2.706673928e-02F, -3.336644173e-02F, -2.442193404e-02F, 4.692891985e-02F, 2.656000666e-02F, 2.309114859e-02F, 4.673580825e-02F, 2.406371385e-02F,
+    -9.184842929e-03F, -2.019148692e-02F, -2.001536265e-02F, -2.614504285e-02F, -1.091600955e-02F, -1.932266541e-02F, -2.033053711e-02F, 6.731481105e-02F,
+    5.083816126e-02F, 5.084747821e-02F, -6.354762008e-04F, 4.612629861e-02F, 1.070001051e-01F, 4.187463596e-02F, 1.032333635e-02F, -2.767457999e-02F,
+    3.497452289e-02F, 4.388753697e-02F, -5.327509134e-04F, 2.002418414e-02F, 1.302935928e-02F, 2.737214975e-02F, -2.317775227e-02F, -6.568594836e-05F,
+    -7.750279456e-02F, -1.267513353e-02F, -1.497115102e-02F, -1.425356232e-02F, -2.777271718e-02F, -3.332298994e-02F, -2.875975333e-02F, -4.036744311e-02F,
+    -1.724492386e-02F, -1.142617839e-04F, 2.686265390e-03F, 9.968889877e-03F, 2.292119712e-02F, -3.648935258e-02F, 2.107769623e-02F, -7.473700680e-03F,
+};
+
+alignas(64) static float const ntm_aot_layer_5_biases[3] = {
+    3.198956549e-01F, 3.608235717e-01F, 2.978754342e-01F,
+};
+
+static inline void ntm_aot_layer_5(float const *in_activations, float *out_activations)
+{
+    // outputs [0, 3)
+    {
+        ntm_aot_vector accumulator_0 = ntm_aot_set1(ntm_aot_layer_5_biases[0]);
+        ntm_aot_vector accumulator_1 = ntm_aot_set1(ntm_aot_layer_5_biases[1]);
+        ntm_aot_vector accumulator_2 = ntm_aot_set1(ntm_aot_layer_5_biases[2]);
+
+        float const *const panel_weights = ntm_aot_layer_5_weights + 0U;
+        for (uint32_t input_index = 0U; input_index < 64U; ++input_index)
+        {
+            ntm_aot_vector const input = ntm_aot_load(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+            accumulator_0 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[3U * input_index + 0U]), accumulator_0);
+            accumulator_1 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[3U * input_index + 1U]), accumulator_1);
+            accumulator_2 = ntm_aot_fmadd(input, ntm_aot_set1(panel_weights[3U * input_index + 2U]), accumulator_2);
+        }
+
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 0U, accumulator_0);
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 1U, accumulator_1);
+        ntm_aot_store(out_activations + NTM_CPU_BATCH_SIZE * 2U, accumulator_2);
+    }
+}
+
+// [4 * NTM_AOT_NUM_FREQUENCIES][NTM_CPU_BATCH_SIZE] -> [3][NTM_CPU_BATCH_SIZE]
+static inline void ntm_aot_network(float const *in_features, float *out_RGBs)
+{
+    alignas(64) float activations[2][NTM_AOT_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+
+    ntm_aot_layer_0(in_features, activations[0]);
+    ntm_aot_layer_1(activations[0], activations[1]);
+    ntm_aot_layer_2(activations[1], activations[0]);
+    ntm_aot_layer_3(activations[0], activations[1]);
+    ntm_aot_layer_4(activations[1], activations[0]);
+    ntm_aot_layer_5(activations[0], out_RGBs);
+}
@@ -0,0 +1,36 @@
+#include "ntm-aot-inference.h"
+#include "ntm-aot-kernels.h"
+
+extern void ntm_aot_engine_init(ntm_aot_engine *out_engine, ntm_cpu_isa isa)
+{
+    ntm_cpu_isa const supported_isa = ntm_cpu_detect_isa();
+    if (isa > supported_isa)
+    {
+        isa = supported_isa;
+    }
+
+    out_engine->isa = isa;
+    out_engine->network_hash = ntm_aot_network_hash;
+
+    switch (isa)
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+    case NTM_CPU_ISA_AVX512_VNNI:
+    case NTM_CPU_ISA_AVX512:
+        out_engine->isa = NTM_CPU_ISA_AVX512;
+        out_engine->predict = ntm_aot_predict_avx512;
+        break;
+    case NTM_CPU_ISA_AVX2:
+        out_engine->predict = ntm_aot_predict_avx2;
+        break;
+#endif
+    default:
+        out_engine->isa = NTM_CPU_ISA_SCALAR;
+        out_engine->predict = ntm_aot_predict_scalar;
+    }
+}
+
+extern void ntm_aot_engine_predict(ntm_aot_engine const *engine, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3])
+{
+    engine->predict(count, in_UVs, out_RGBs);
+}
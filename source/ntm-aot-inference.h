@@ -0,0 +1,25 @@
+#ifndef _NTM_AOT_INFERENCE_H_
+#define _NTM_AOT_INFERENCE_H_ 1
+
+#include "ntm-cpu-inference.h"
+
+// The network of the "neural-texture-mapping-aot.inl" (generated by the "compile-main.py" from the NTM asset) compiled ahead of time.
+// The shapes and the coefficients are the constants of the kernels, and thus there is neither the interpreter nor the shape dispatch at runtime.
+// Merely the ISA is selected at runtime, and the positional encoding is the same as the "ntm_cpu_engine" of the same ISA.
+typedef void (*ntm_aot_predict_kernel)(uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3]);
+
+struct ntm_aot_engine
+{
+    ntm_cpu_isa isa;
+    ntm_aot_predict_kernel predict;
+    // identifies the compiled network (the same as the "ntm_model_hash" of the NTM asset which it is compiled from)
+    uint64_t network_hash;
+};
+
+// The "isa" is downgraded to the best ISA supported by the current CPU (the VNNI is the same as the AVX512 since all layers are FP32).
+extern void ntm_aot_engine_init(ntm_aot_engine *out_engine, ntm_cpu_isa isa);
+
+// The same as the "ntm_cpu_engine_predict" of the compiled network. It is safe to call this function from multiple threads concurrently.
+extern void ntm_aot_engine_predict(ntm_aot_engine const *engine, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3]);
+
+#endif
@@ -0,0 +1,87 @@
+#include "ntm-aot-kernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+// NOTE: this translation unit is compiled with "-mavx2 -mfma -mf16c" (GCC) or "/arch:AVX2" (MSVC).
+
+// NTM_CPU_BATCH_SIZE lanes = 2 x 8
+struct ntm_aot_vector
+{
+    __m256 lanes_0;
+    __m256 lanes_1;
+};
+
+static inline ntm_aot_vector ntm_aot_load(float const *source);
+
+static inline void ntm_aot_store(float *destination, ntm_aot_vector value);
+
+static inline ntm_aot_vector ntm_aot_set1(float value);
+
+static inline ntm_aot_vector ntm_aot_fmadd(ntm_aot_vector a, ntm_aot_vector b, ntm_aot_vector c);
+
+static inline ntm_aot_vector ntm_aot_relu(ntm_aot_vector value);
+
+#include "neural-texture-mapping-aot.inl"
+
+extern void ntm_aot_predict_avx2(uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3])
+{
+    alignas(64) float features[4U * NTM_AOT_NUM_FREQUENCIES * NTM_CPU_BATCH_SIZE];
+    alignas(64) float RGBs[NTM_OUTPUT_SIZE * NTM_CPU_BATCH_SIZE];
+
+    for (uint32_t batch_begin = 0U; batch_begin < count; batch_begin += NTM_CPU_BATCH_SIZE)
+    {
+        uint32_t const batch_count = ((count - batch_begin) < NTM_CPU_BATCH_SIZE) ? (count - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+        ntm_cpu_kernels_avx2.encode(NTM_AOT_NUM_FREQUENCIES, batch_count, in_UVs + batch_begin, features);
+
+        ntm_aot_network(features, RGBs);
+
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            out_RGBs[batch_begin + lane_index][0] = RGBs[lane_index];
+            out_RGBs[batch_begin + lane_index][1] = RGBs[NTM_CPU_BATCH_SIZE + lane_index];
+            out_RGBs[batch_begin + lane_index][2] = RGBs[NTM_CPU_BATCH_SIZE * 2U + lane_index];
+        }
+    }
+}
+
+static inline ntm_aot_vector ntm_aot_load(float const *source)
+{
+    ntm_aot_vector value;
+    value.lanes_0 = _mm256_load_ps(source);
+    value.lanes_1 = _mm256_load_ps(source + 8);
+    return value;
+}
+
+static inline void ntm_aot_store(float *destination, ntm_aot_vector value)
+{
+    _mm256_store_ps(destination, value.lanes_0);
+    _mm256_store_ps(destination + 8, value.lanes_1);
+}
+
+static inline ntm_aot_vector ntm_aot_set1(float value)
+{
+    ntm_aot_vector vector;
+    vector.lanes_0 = _mm256_set1_ps(value);
+    vector.lanes_1 = vector.lanes_0;
+    return vector;
+}
+
+static inline ntm_aot_vector ntm_aot_fmadd(ntm_aot_vector a, ntm_aot_vector b, ntm_aot_vector c)
+{
+    ntm_aot_vector value;
+    value.lanes_0 = _mm256_fmadd_ps(a.lanes_0, b.lanes_0, c.lanes_0);
+    value.lanes_1 = _mm256_fmadd_ps(a.lanes_1, b.lanes_1, c.lanes_1);
+    return value;
+}
+
+static inline ntm_aot_vector ntm_aot_relu(ntm_aot_vector value)
+{
+    value.lanes_0 = _mm256_max_ps(value.lanes_0, _mm256_setzero_ps());
+    value.lanes_1 = _mm256_max_ps(value.lanes_1, _mm256_setzero_ps());
+    return value;
+}
+
+#endif
@@ -0,0 +1,71 @@
+#include "ntm-aot-kernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+// NOTE: this translation unit is compiled with "-mavx512f -mavx512bw -mfma" (GCC) or "/arch:AVX512" (MSVC).
+
+// NTM_CPU_BATCH_SIZE lanes = 1 x 16
+typedef __m512 ntm_aot_vector;
+
+static inline ntm_aot_vector ntm_aot_load(float const *source);
+
+static inline void ntm_aot_store(float *destination, ntm_aot_vector value);
+
+static inline ntm_aot_vector ntm_aot_set1(float value);
+
+static inline ntm_aot_vector ntm_aot_fmadd(ntm_aot_vector a, ntm_aot_vector b, ntm_aot_vector c);
+
+static inline ntm_aot_vector ntm_aot_relu(ntm_aot_vector value);
+
+#include "neural-texture-mapping-aot.inl"
+
+extern void ntm_aot_predict_avx512(uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3])
+{
+    alignas(64) float features[4U * NTM_AOT_NUM_FREQUENCIES * NTM_CPU_BATCH_SIZE];
+    alignas(64) float RGBs[NTM_OUTPUT_SIZE * NTM_CPU_BATCH_SIZE];
+
+    for (uint32_t batch_begin = 0U; batch_begin < count; batch_begin += NTM_CPU_BATCH_SIZE)
+    {
+        uint32_t const batch_count = ((count - batch_begin) < NTM_CPU_BATCH_SIZE) ? (count - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+        ntm_cpu_kernels_avx512.encode(NTM_AOT_NUM_FREQUENCIES, batch_count, in_UVs + batch_begin, features);
+
+        ntm_aot_network(features, RGBs);
+
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            out_RGBs[batch_begin + lane_index][0] = RGBs[lane_index];
+            out_RGBs[batch_begin + lane_index][1] = RGBs[NTM_CPU_BATCH_SIZE + lane_index];
+            out_RGBs[batch_begin + lane_index][2] = RGBs[NTM_CPU_BATCH_SIZE * 2U + lane_index];
+        }
+    }
+}
+
+static inline ntm_aot_vector ntm_aot_load(float const *source)
+{
+    return _mm512_load_ps(source);
+}
+
+static inline void ntm_aot_store(float *destination, ntm_aot_vector value)
+{
+    _mm512_store_ps(destination, value);
+}
+
+static inline ntm_aot_vector ntm_aot_set1(float value)
+{
+    return _mm512_set1_ps(value);
+}
+
+static inline ntm_aot_vector ntm_aot_fmadd(ntm_aot_vector a, ntm_aot_vector b, ntm_aot_vector c)
+{
+    return _mm512_fmadd_ps(a, b, c);
+}
+
+static inline ntm_aot_vector ntm_aot_relu(ntm_aot_vector value)
+{
+    return _mm512_max_ps(value, _mm512_setzero_ps());
+}
+
+#endif
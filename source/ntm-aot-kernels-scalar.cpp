@@ -0,0 +1,90 @@
+#include "ntm-aot-kernels.h"
+
+struct ntm_aot_vector
+{
+    float lanes[NTM_CPU_BATCH_SIZE];
+};
+
+static inline ntm_aot_vector ntm_aot_load(float const *source);
+
+static inline void ntm_aot_store(float *destination, ntm_aot_vector value);
+
+static inline ntm_aot_vector ntm_aot_set1(float value);
+
+static inline ntm_aot_vector ntm_aot_fmadd(ntm_aot_vector a, ntm_aot_vector b, ntm_aot_vector c);
+
+static inline ntm_aot_vector ntm_aot_relu(ntm_aot_vector value);
+
+#include "neural-texture-mapping-aot.inl"
+
+extern uint64_t const ntm_aot_network_hash = NTM_AOT_NETWORK_HASH;
+
+extern void ntm_aot_predict_scalar(uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3])
+{
+    alignas(64) float features[4U * NTM_AOT_NUM_FREQUENCIES * NTM_CPU_BATCH_SIZE];
+    alignas(64) float RGBs[NTM_OUTPUT_SIZE * NTM_CPU_BATCH_SIZE];
+
+    for (uint32_t batch_begin = 0U; batch_begin < count; batch_begin += NTM_CPU_BATCH_SIZE)
+    {
+        uint32_t const batch_count = ((count - batch_begin) < NTM_CPU_BATCH_SIZE) ? (count - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+        ntm_cpu_kernels_scalar.encode(NTM_AOT_NUM_FREQUENCIES, batch_count, in_UVs + batch_begin, features);
+
+        ntm_aot_network(features, RGBs);
+
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            out_RGBs[batch_begin + lane_index][0] = RGBs[lane_index];
+            out_RGBs[batch_begin + lane_index][1] = RGBs[NTM_CPU_BATCH_SIZE + lane_index];
+            out_RGBs[batch_begin + lane_index][2] = RGBs[NTM_CPU_BATCH_SIZE * 2U + lane_index];
+        }
+    }
+}
+
+static inline ntm_aot_vector ntm_aot_load(float const *source)
+{
+    ntm_aot_vector value;
+    for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+    {
+        value.lanes[lane_index] = source[lane_index];
+    }
+    return value;
+}
+
+static inline void ntm_aot_store(float *destination, ntm_aot_vector value)
+{
+    for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+    {
+        destination[lane_index] = value.lanes[lane_index];
+    }
+}
+
+static inline ntm_aot_vector ntm_aot_set1(float value)
+{
+    ntm_aot_vector vector;
+    for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+    {
+        vector.lanes[lane_index] = value;
+    }
+    return vector;
+}
+
+static inline ntm_aot_vector ntm_aot_fmadd(ntm_aot_vector a, ntm_aot_vector b, ntm_aot_vector c)
+{
+    // the same as the "ntm_cpu_dense_scalar" (NOT fused)
+    ntm_aot_vector value;
+    for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+    {
+        value.lanes[lane_index] = c.lanes[lane_index] + b.lanes[lane_index] * a.lanes[lane_index];
+    }
+    return value;
+}
+
+static inline ntm_aot_vector ntm_aot_relu(ntm_aot_vector value)
+{
+    for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+    {
+        value.lanes[lane_index] = (value.lanes[lane_index] < 0.0F) ? 0.0F : value.lanes[lane_index];
+    }
+    return value;
+}
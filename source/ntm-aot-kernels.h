@@ -0,0 +1,21 @@
+#ifndef _NTM_AOT_KERNELS_H_
+#define _NTM_AOT_KERNELS_H_ 1
+
+#include "ntm-cpu-kernels.h"
+
+// NOTE: the same as the "ntm-cpu-kernels.h", this header is included by the translation units which are compiled with the ISA specific flags.
+
+// Each translation unit defines the "ntm_aot_vector" (NTM_CPU_BATCH_SIZE lanes) and the "ntm_aot_load" / "ntm_aot_store" / "ntm_aot_set1" / "ntm_aot_fmadd" / "ntm_aot_relu" before including the "neural-texture-mapping-aot.inl".
+
+// The "NTM_AOT_NETWORK_HASH" of the "neural-texture-mapping-aot.inl" (defined by the scalar translation unit, which is always compiled).
+extern uint64_t const ntm_aot_network_hash;
+
+extern void ntm_aot_predict_scalar(uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3]);
+
+#if defined(__x86_64__) || defined(_M_X64)
+extern void ntm_aot_predict_avx2(uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3]);
+
+extern void ntm_aot_predict_avx512(uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3]);
+#endif
+
+#endif
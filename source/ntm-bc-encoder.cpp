@@ -0,0 +1,923 @@
+#include "ntm-bc-encoder.h"
+#include "ntm-bc-kernels.h"
+#include "ntm-profiler.h"
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+// The strip of the grid which is decoded at once: 64 x 16 texels x 4 bytes = 4KB, which fits in the L1 cache.
+// The vectors of the 1st layer of the grid path are evaluated for every 64 columns and every 16 rows (one batch), and thus the strip is merely 1/16 more evaluations of the column vectors than the whole tile.
+static constexpr uint32_t const NTM_BC_STRIP_COLUMNS = 64U;
+static constexpr uint32_t const NTM_BC_STRIP_ROWS = 16U;
+
+// 2^3 = 8 power iterations
+static constexpr int const NTM_BC_POWER_SQUARINGS = 3;
+
+// The least squares refinements of the HIGH quality (stopped as soon as the error is NOT reduced)
+static constexpr int const NTM_BC_REFINE_ITERATIONS = 3;
+
+// The number of the partitions (with the least residuals of the principal axes) which are encoded by the modes 1 and 3 of the HIGH quality
+static constexpr uint32_t const NTM_BC7_PARTITION_CANDIDATES = 4U;
+
+static constexpr uint32_t const NTM_BC7_NUM_PARTITIONS = 64U;
+
+// https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html#bptc_bc7
+// bit i: the subset of the texel i
+static uint16_t const ntm_bc7_partitions[NTM_BC7_NUM_PARTITIONS] = {
+    0XCCCC, 0X8888, 0XEEEE, 0XECC8, 0XC880, 0XFEEC, 0XFEC8, 0XEC80,
+    0XC800, 0XFFEC, 0XFE80, 0XE800, 0XFFE8, 0XFF00, 0XFFF0, 0XF000,
+    0XF710, 0X008E, 0X7100, 0X08CE, 0X008C, 0X7310, 0X3100, 0X8CCE,
+    0X088C, 0X3110, 0X6666, 0X366C, 0X17E8, 0X0FF0, 0X718E, 0X399C,
+    0XAAAA, 0XF0F0, 0X5A5A, 0X33CC, 0X3C3C, 0X55AA, 0X9696, 0XA55A,
+    0X73CE, 0X13C8, 0X324C, 0X3BDC, 0X6996, 0XC33C, 0X9966, 0X0660,
+    0X0272, 0X04E4, 0X4E40, 0X2720, 0XC936, 0X936C, 0X39C6, 0X639C,
+    0X9336, 0X9CC6, 0X817E, 0XE718, 0XCCF0, 0X0FCC, 0X7744, 0XEE22};
+
+// The anchor texel of the subset 1 (the anchor texel of the subset 0 is always the texel 0)
+static uint8_t const ntm_bc7_anchors[NTM_BC7_NUM_PARTITIONS] = {
+    15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15,
+    15, 2, 8, 2, 2, 8, 8, 15,
+    2, 8, 2, 2, 8, 8, 2, 2,
+    15, 15, 6, 8, 2, 8, 15, 15,
+    2, 8, 2, 2, 2, 15, 15, 6,
+    6, 2, 6, 8, 15, 15, 2, 2,
+    15, 15, 15, 15, 15, 2, 2, 15};
+
+// The interpolation: "((64 - weight) * endpoint 0 + weight * endpoint 1 + 32) >> 6"
+static uint32_t const ntm_bc7_weights_2[4] = {0U, 21U, 43U, 64U};
+static uint32_t const ntm_bc7_weights_3[8] = {0U, 9U, 18U, 27U, 37U, 46U, 55U, 64U};
+static uint32_t const ntm_bc7_weights_4[16] = {0U, 4U, 9U, 13U, 17U, 21U, 26U, 30U, 34U, 38U, 43U, 47U, 51U, 55U, 60U, 64U};
+
+// The sums over the texels of one subset: the count, R G B, and RR RG RB GG GB BB
+struct ntm_bc_moments
+{
+    float count;
+    float sums[3];
+    float products[6];
+};
+
+struct ntm_bc7_mode
+{
+    uint32_t mode;
+    uint32_t num_subsets;
+    // the bits of each endpoint (without the p-bit)
+    uint32_t color_bits;
+    uint32_t index_bits;
+    uint32_t const *weights;
+    // mode 6: both p-bits are 1 (such that the alpha is 255)
+    // mode 1: one p-bit shared by both endpoints of the subset
+    // mode 3: one p-bit for each endpoint
+    uint32_t num_pbits_candidates;
+    uint32_t pbits_candidates[4][2];
+};
+
+static ntm_bc7_mode const ntm_bc7_mode_1 = {1U, 2U, 6U, 3U, ntm_bc7_weights_3, 2U, {{0U, 0U}, {1U, 1U}}};
+static ntm_bc7_mode const ntm_bc7_mode_3 = {3U, 2U, 7U, 2U, ntm_bc7_weights_2, 4U, {{0U, 0U}, {0U, 1U}, {1U, 0U}, {1U, 1U}}};
+static ntm_bc7_mode const ntm_bc7_mode_6 = {6U, 1U, 7U, 4U, ntm_bc7_weights_4, 1U, {{1U, 1U}}};
+
+struct ntm_bc7_subset
+{
+    // the codes of the endpoints (without the p-bits)
+    uint32_t endpoints[2][3];
+    uint32_t pbits[2];
+};
+
+struct ntm_bc7_block
+{
+    ntm_bc7_mode const *mode;
+    uint32_t partition_index;
+    ntm_bc7_subset subsets[2];
+    uint8_t indices[NTM_BC_BLOCK_TEXELS];
+    float error;
+};
+
+static inline void ntm_bc_load_block(uint32_t width, uint32_t height, uint8_t const *in_texels, size_t in_row_pitch, uint32_t block_x, float *out_texels);
+
+static inline void ntm_bc_accumulate_moments(float const *texels, uint32_t mask, ntm_bc_moments *out_moments);
+
+static inline float ntm_bc_principal_axis(ntm_bc_moments const *moments, float out_mean[3], float out_axis[3]);
+
+static inline void ntm_bc_line_endpoints(float const *texels, uint32_t mask, float const mean[3], float const axis[3], float out_endpoints[2][3]);
+
+static inline bool ntm_bc_least_squares(float const *texels, uint32_t mask, uint8_t const *indices, float const *weights, float out_endpoints[2][3]);
+
+static inline uint32_t ntm_bc_unquantize(uint32_t code, uint32_t bits);
+
+static inline uint32_t ntm_bc_quantize(float value, uint32_t color_bits, bool has_pbit, uint32_t pbit);
+
+static inline float ntm_bc1_encode_block(ntm_bc_encoder const *encoder, ntm_bc_quality quality, float const *texels, uint8_t *out_block);
+
+static inline float ntm_bc1_evaluate(ntm_bc_encoder const *encoder, float const *texels, float const endpoints[2][3], uint32_t out_colors[2], uint8_t *out_indices);
+
+static inline float ntm_bc7_encode_block(ntm_bc_encoder const *encoder, ntm_bc_quality quality, float const *texels, uint8_t *out_block);
+
+static inline void ntm_bc7_encode_mode(ntm_bc_encoder const *encoder, ntm_bc_quality quality, ntm_bc7_mode const *mode, uint32_t partition_index, float const *texels, ntm_bc7_block *out_block);
+
+static inline float ntm_bc7_fit_subset(ntm_bc_encoder const *encoder, ntm_bc7_mode const *mode, float const *texels, uint32_t mask, float const endpoints[2][3], ntm_bc7_subset *out_subset, uint8_t *inout_indices);
+
+static inline void ntm_bc7_write_block(ntm_bc7_block const *block, uint8_t *out_block);
+
+static inline void ntm_bc7_write_bits(uint8_t *block, uint32_t *inout_bit_offset, uint32_t value, uint32_t num_bits);
+
+extern void ntm_bc_encoder_init(ntm_bc_encoder *out_encoder, ntm_cpu_isa isa)
+{
+    ntm_cpu_isa const supported_isa = ntm_cpu_detect_isa();
+    if (isa > supported_isa)
+    {
+        isa = supported_isa;
+    }
+
+    out_encoder->isa = isa;
+
+    switch (isa)
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+    case NTM_CPU_ISA_AVX512_VNNI:
+    case NTM_CPU_ISA_AVX512:
+        out_encoder->isa = NTM_CPU_ISA_AVX512;
+        out_encoder->fit = ntm_bc_fit_avx512;
+        break;
+    case NTM_CPU_ISA_AVX2:
+        out_encoder->fit = ntm_bc_fit_avx2;
+        break;
+#endif
+    default:
+        out_encoder->isa = NTM_CPU_ISA_SCALAR;
+        out_encoder->fit = ntm_bc_fit_scalar;
+    }
+}
+
+extern char const *ntm_bc_format_name(ntm_bc_format format)
+{
+    switch (format)
+    {
+    case NTM_BC_FORMAT_BC1:
+        return "bc1";
+    case NTM_BC_FORMAT_BC7:
+        return "bc7";
+    default:
+        assert(false);
+        return "unknown";
+    }
+}
+
+extern bool ntm_bc_format_parse(char const *name, ntm_bc_format *out_format)
+{
+    if (0 == strcmp(name, "bc1"))
+    {
+        (*out_format) = NTM_BC_FORMAT_BC1;
+        return true;
+    }
+    else if (0 == strcmp(name, "bc7"))
+    {
+        (*out_format) = NTM_BC_FORMAT_BC7;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+extern char const *ntm_bc_quality_name(ntm_bc_quality quality)
+{
+    switch (quality)
+    {
+    case NTM_BC_QUALITY_FAST:
+        return "fast";
+    case NTM_BC_QUALITY_HIGH:
+        return "high";
+    default:
+        assert(false);
+        return "unknown";
+    }
+}
+
+extern bool ntm_bc_quality_parse(char const *name, ntm_bc_quality *out_quality)
+{
+    if (0 == strcmp(name, "fast"))
+    {
+        (*out_quality) = NTM_BC_QUALITY_FAST;
+        return true;
+    }
+    else if (0 == strcmp(name, "high"))
+    {
+        (*out_quality) = NTM_BC_QUALITY_HIGH;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+extern uint32_t ntm_bc_block_size(ntm_bc_format format)
+{
+    assert((NTM_BC_FORMAT_BC1 == format) || (NTM_BC_FORMAT_BC7 == format));
+    return (NTM_BC_FORMAT_BC1 == format) ? 8U : 16U;
+}
+
+extern uint64_t ntm_bc_encoder_encode_rows(ntm_bc_encoder const *encoder, ntm_bc_encoding const *encoding, uint32_t width, uint32_t height, void const *in_texels, size_t in_row_pitch, void *out_blocks)
+{
+    assert((width >= 1U) && (height >= 1U) && (height <= 4U));
+
+    uint32_t const block_size = ntm_bc_block_size(encoding->format);
+    uint32_t const num_blocks = (width + 3U) / 4U;
+
+    uint64_t error = 0U;
+    for (uint32_t block_index = 0U; block_index < num_blocks; ++block_index)
+    {
+        // [R, G, B][NTM_BC_BLOCK_TEXELS]
+        alignas(64) float texels[3U * NTM_BC_BLOCK_TEXELS];
+        ntm_bc_load_block(width, height, static_cast<uint8_t const *>(in_texels), in_row_pitch, 4U * block_index, texels);
+
+        uint8_t *const out_block = static_cast<uint8_t *>(out_blocks) + static_cast<size_t>(block_size) * block_index;
+        float const block_error = (NTM_BC_FORMAT_BC1 == encoding->format) ? ntm_bc1_encode_block(encoder, encoding->quality, texels, out_block) : ntm_bc7_encode_block(encoder, encoding->quality, texels, out_block);
+
+        error += static_cast<uint64_t>(block_error);
+    }
+
+    return error;
+}
+
+extern uint64_t ntm_bc_encoder_predict_grid(ntm_bc_encoder const *encoder, ntm_bc_encoding const *encoding, ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, uint32_t grid_x, uint32_t grid_y, uint32_t grid_width, uint32_t grid_height, void *out_blocks, size_t out_row_pitch)
+{
+    assert((0U == (grid_x % 4U)) && (0U == (grid_y % 4U)));
+    assert((0U == (grid_width % 4U)) || ((grid_x + grid_width) == texture_width));
+    assert((0U == (grid_height % 4U)) || ((grid_y + grid_height) == texture_height));
+
+    uint32_t const block_size = ntm_bc_block_size(encoding->format);
+    ntm_pixel_encoding const pixel_encoding = {NTM_PIXEL_FORMAT_B8G8R8A8_UNORM, false};
+
+    bool const profile = ntm_profiler_is_enabled();
+    uint64_t profile_duration = 0U;
+
+    // B8G8R8A8
+    uint8_t strip[NTM_BC_STRIP_ROWS][NTM_BC_STRIP_COLUMNS][4];
+
+    uint64_t error = 0U;
+    for (uint32_t rows_begin = 0U; rows_begin < grid_height; rows_begin += NTM_BC_STRIP_ROWS)
+    {
+        uint32_t const rows_count = ((grid_height - rows_begin) < NTM_BC_STRIP_ROWS) ? (grid_height - rows_begin) : NTM_BC_STRIP_ROWS;
+
+        for (uint32_t columns_begin = 0U; columns_begin < grid_width; columns_begin += NTM_BC_STRIP_COLUMNS)
+        {
+            uint32_t const columns_count = ((grid_width - columns_begin) < NTM_BC_STRIP_COLUMNS) ? (grid_width - columns_begin) : NTM_BC_STRIP_COLUMNS;
+
+            ntm_cpu_engine_predict_grid_pixels(engine, texture_width, texture_height, grid_x + columns_begin, grid_y + rows_begin, columns_count, rows_count, &pixel_encoding, strip, sizeof(strip[0]));
+
+            uint64_t const encode_begin = profile ? ntm_profiler_now() : 0U;
+
+            for (uint32_t block_rows_begin = 0U; block_rows_begin < rows_count; block_rows_begin += 4U)
+            {
+                uint32_t const block_rows_count = ((rows_count - block_rows_begin) < 4U) ? (rows_count - block_rows_begin) : 4U;
+
+                uint8_t *const out_block_row = static_cast<uint8_t *>(out_blocks) + (out_row_pitch * ((rows_begin + block_rows_begin) / 4U) + static_cast<size_t>(block_size) * (columns_begin / 4U));
+                error += ntm_bc_encoder_encode_rows(encoder, encoding, columns_count, block_rows_count, strip[block_rows_begin], sizeof(strip[0]), out_block_row);
+            }
+
+            if (profile)
+            {
+                profile_duration += (ntm_profiler_now() - encode_begin);
+            }
+        }
+    }
+
+    if (profile)
+    {
+        ntm_profiler_record_duration(NTM_PROFILER_STAGE_BLOCK_COMPRESS, profile_duration);
+    }
+
+    return error;
+}
+
+static inline void ntm_bc_load_block(uint32_t width, uint32_t height, uint8_t const *in_texels, size_t in_row_pitch, uint32_t block_x, float *out_texels)
+{
+    for (uint32_t y = 0U; y < 4U; ++y)
+    {
+        // the edges are replicated
+        uint8_t const *const in_row = in_texels + in_row_pitch * ((y < height) ? y : (height - 1U));
+        for (uint32_t x = 0U; x < 4U; ++x)
+        {
+            uint32_t const texel_x = ((block_x + x) < width) ? (block_x + x) : (width - 1U);
+            uint8_t const *const in_texel = in_row + 4U * texel_x;
+
+            // B8G8R8A8
+            uint32_t const texel_index = 4U * y + x;
+            out_texels[texel_index] = static_cast<float>(in_texel[2]);
+            out_texels[NTM_BC_BLOCK_TEXELS + texel_index] = static_cast<float>(in_texel[1]);
+            out_texels[NTM_BC_BLOCK_TEXELS * 2U + texel_index] = static_cast<float>(in_texel[0]);
+        }
+    }
+}
+
+static inline void ntm_bc_accumulate_moments(float const *texels, uint32_t mask, ntm_bc_moments *out_moments)
+{
+    // branchless (the partitions are NOT predictable), and the sums of the integers are exact in any order
+    (*out_moments) = ntm_bc_moments{};
+    for (uint32_t texel_index = 0U; texel_index < NTM_BC_BLOCK_TEXELS; ++texel_index)
+    {
+        float const weight = static_cast<float>((mask >> texel_index) & 1U);
+        float const r = weight * texels[texel_index];
+        float const g = weight * texels[NTM_BC_BLOCK_TEXELS + texel_index];
+        float const b = weight * texels[NTM_BC_BLOCK_TEXELS * 2U + texel_index];
+        out_moments->count += weight;
+        out_moments->sums[0] += r;
+        out_moments->sums[1] += g;
+        out_moments->sums[2] += b;
+        out_moments->products[0] += r * r;
+        out_moments->products[1] += r * g;
+        out_moments->products[2] += r * b;
+        out_moments->products[3] += g * g;
+        out_moments->products[4] += g * b;
+        out_moments->products[5] += b * b;
+    }
+}
+
+static inline float ntm_bc_principal_axis(ntm_bc_moments const *moments, float out_mean[3], float out_axis[3])
+{
+    assert(moments->count > 0.0F);
+    for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+    {
+        out_mean[channel_index] = moments->sums[channel_index] / moments->count;
+    }
+
+    // the covariance (NOT divided by the count): RR, RG, RB, GG, GB, BB
+    float const covariance[6] = {
+        moments->products[0] - moments->sums[0] * out_mean[0],
+        moments->products[1] - moments->sums[0] * out_mean[1],
+        moments->products[2] - moments->sums[0] * out_mean[2],
+        moments->products[3] - moments->sums[1] * out_mean[1],
+        moments->products[4] - moments->sums[1] * out_mean[2],
+        moments->products[5] - moments->sums[2] * out_mean[2]};
+
+    float const trace = covariance[0] + covariance[3] + covariance[5];
+    if (!(trace > 1E-3F))
+    {
+        // all texels are (almost) the same
+        out_axis[0] = 0.57735027F;
+        out_axis[1] = 0.57735027F;
+        out_axis[2] = 0.57735027F;
+        return 0.0F;
+    }
+
+    // The power iteration by the repeated squaring: the matrix is squared (and normalized by the trace to avoid the overflow) NTM_BC_POWER_SQUARINGS times, and the column of the largest diagonal is the axis.
+    float power[6];
+    for (uint32_t element_index = 0U; element_index < 6U; ++element_index)
+    {
+        power[element_index] = covariance[element_index] / trace;
+    }
+
+    for (int squaring_index = 0; squaring_index < NTM_BC_POWER_SQUARINGS; ++squaring_index)
+    {
+        float const squared[6] = {
+            power[0] * power[0] + power[1] * power[1] + power[2] * power[2],
+            power[0] * power[1] + power[1] * power[3] + power[2] * power[4],
+            power[0] * power[2] + power[1] * power[4] + power[2] * power[5],
+            power[1] * power[1] + power[3] * power[3] + power[4] * power[4],
+            power[1] * power[2] + power[3] * power[4] + power[4] * power[5],
+            power[2] * power[2] + power[4] * power[4] + power[5] * power[5]};
+
+        // the trace of the square of the nonzero symmetric matrix is positive
+        float const scale = 1.0F / (squared[0] + squared[3] + squared[5]);
+        for (uint32_t element_index = 0U; element_index < 6U; ++element_index)
+        {
+            power[element_index] = squared[element_index] * scale;
+        }
+    }
+
+    float axis[3];
+    if ((power[0] >= power[3]) && (power[0] >= power[5]))
+    {
+        axis[0] = power[0];
+        axis[1] = power[1];
+        axis[2] = power[2];
+    }
+    else if (power[3] >= power[5])
+    {
+        axis[0] = power[1];
+        axis[1] = power[3];
+        axis[2] = power[4];
+    }
+    else
+    {
+        axis[0] = power[2];
+        axis[1] = power[4];
+        axis[2] = power[5];
+    }
+
+    float const length = sqrtf(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    axis[0] /= length;
+    axis[1] /= length;
+    axis[2] /= length;
+
+    // the Rayleigh quotient of the normalized axis
+    float const eigenvalue =
+        axis[0] * (covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2]) +
+        axis[1] * (covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2]) +
+        axis[2] * (covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2]);
+
+    out_axis[0] = axis[0];
+    out_axis[1] = axis[1];
+    out_axis[2] = axis[2];
+
+    // the sum of the squared distances to the principal axis
+    float const residual = trace - eigenvalue;
+    return (residual > 0.0F) ? residual : 0.0F;
+}
+
+static inline void ntm_bc_line_endpoints(float const *texels, uint32_t mask, float const mean[3], float const axis[3], float out_endpoints[2][3])
+{
+    float minimum = 0.0F;
+    float maximum = 0.0F;
+    for (uint32_t texel_index = 0U; texel_index < NTM_BC_BLOCK_TEXELS; ++texel_index)
+    {
+        if (0U != (mask & (1U << texel_index)))
+        {
+            float const projection = (texels[texel_index] - mean[0]) * axis[0] + (texels[NTM_BC_BLOCK_TEXELS + texel_index] - mean[1]) * axis[1] + (texels[NTM_BC_BLOCK_TEXELS * 2U + texel_index] - mean[2]) * axis[2];
+            minimum = (projection < minimum) ? projection : minimum;
+            maximum = (projection > maximum) ? projection : maximum;
+        }
+    }
+
+    for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+    {
+        float const endpoint_0 = mean[channel_index] + minimum * axis[channel_index];
+        float const endpoint_1 = mean[channel_index] + maximum * axis[channel_index];
+        out_endpoints[0][channel_index] = (endpoint_0 < 0.0F) ? 0.0F : ((endpoint_0 > 255.0F) ? 255.0F : endpoint_0);
+        out_endpoints[1][channel_index] = (endpoint_1 < 0.0F) ? 0.0F : ((endpoint_1 > 255.0F) ? 255.0F : endpoint_1);
+    }
+}
+
+static inline bool ntm_bc_least_squares(float const *texels, uint32_t mask, uint8_t const *indices, float const *weights, float out_endpoints[2][3])
+{
+    // texel = (1 - w) * endpoint 0 + w * endpoint 1
+    float aa = 0.0F;
+    float ab = 0.0F;
+    float bb = 0.0F;
+    float ax[3] = {0.0F, 0.0F, 0.0F};
+    float bx[3] = {0.0F, 0.0F, 0.0F};
+    for (uint32_t texel_index = 0U; texel_index < NTM_BC_BLOCK_TEXELS; ++texel_index)
+    {
+        if (0U != (mask & (1U << texel_index)))
+        {
+            float const b = weights[indices[texel_index]];
+            float const a = 1.0F - b;
+            aa += a * a;
+            ab += a * b;
+            bb += b * b;
+            for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+            {
+                float const x = texels[NTM_BC_BLOCK_TEXELS * channel_index + texel_index];
+                ax[channel_index] += a * x;
+                bx[channel_index] += b * x;
+            }
+        }
+    }
+
+    // singular: e.g. all texels select the same index
+    float const determinant = aa * bb - ab * ab;
+    if (!(fabsf(determinant) > 1E-6F))
+    {
+        return false;
+    }
+
+    for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+    {
+        float const endpoint_0 = (bb * ax[channel_index] - ab * bx[channel_index]) / determinant;
+        float const endpoint_1 = (aa * bx[channel_index] - ab * ax[channel_index]) / determinant;
+        out_endpoints[0][channel_index] = (endpoint_0 < 0.0F) ? 0.0F : ((endpoint_0 > 255.0F) ? 255.0F : endpoint_0);
+        out_endpoints[1][channel_index] = (endpoint_1 < 0.0F) ? 0.0F : ((endpoint_1 > 255.0F) ? 255.0F : endpoint_1);
+    }
+
+    return true;
+}
+
+static inline uint32_t ntm_bc_unquantize(uint32_t code, uint32_t bits)
+{
+    // the high bits are replicated into the low bits
+    assert((bits >= 4U) && (bits <= 8U));
+    return (code << (8U - bits)) | (code >> (2U * bits - 8U));
+}
+
+static inline uint32_t ntm_bc_quantize(float value, uint32_t color_bits, bool has_pbit, uint32_t pbit)
+{
+    uint32_t const bits = color_bits + (has_pbit ? 1U : 0U);
+    uint32_t const maximum_code = (1U << color_bits) - 1U;
+
+    float const scaled = value * static_cast<float>((1U << bits) - 1U) / 255.0F;
+    int const guess = static_cast<int>(has_pbit ? ((scaled - static_cast<float>(pbit)) * 0.5F + 0.5F) : (scaled + 0.5F));
+
+    // the rounding of the "unquantize" is NOT linear, and thus the neighbors are also tried
+    uint32_t best_code = 0U;
+    float best_error = NTM_BC_MAX_ERROR;
+    for (int code = guess - 1; code <= (guess + 1); ++code)
+    {
+        if ((code < 0) || (static_cast<uint32_t>(code) > maximum_code))
+        {
+            continue;
+        }
+
+        uint32_t const full_code = has_pbit ? ((static_cast<uint32_t>(code) << 1U) | pbit) : static_cast<uint32_t>(code);
+        float const error = fabsf(static_cast<float>(ntm_bc_unquantize(full_code, bits)) - value);
+        if (error < best_error)
+        {
+            best_error = error;
+            best_code = static_cast<uint32_t>(code);
+        }
+    }
+
+    return best_code;
+}
+
+static inline float ntm_bc1_encode_block(ntm_bc_encoder const *encoder, ntm_bc_quality quality, float const *texels, uint8_t *out_block)
+{
+    uint32_t const mask = (1U << NTM_BC_BLOCK_TEXELS) - 1U;
+
+    ntm_bc_moments moments;
+    ntm_bc_accumulate_moments(texels, mask, &moments);
+
+    float mean[3];
+    float axis[3];
+    ntm_bc_principal_axis(&moments, mean, axis);
+
+    float endpoints[2][3];
+    ntm_bc_line_endpoints(texels, mask, mean, axis, endpoints);
+
+    uint32_t colors[2];
+    uint8_t indices[NTM_BC_BLOCK_TEXELS];
+    float error = ntm_bc1_evaluate(encoder, texels, endpoints, colors, indices);
+
+    if (NTM_BC_QUALITY_HIGH == quality)
+    {
+        // the palette: color 0, color 1, 2/3 * color 0 + 1/3 * color 1, 1/3 * color 0 + 2/3 * color 1
+        static float const weights[4] = {0.0F, 1.0F, 1.0F / 3.0F, 2.0F / 3.0F};
+
+        for (int iteration_index = 0; (iteration_index < NTM_BC_REFINE_ITERATIONS) && (error > 0.0F); ++iteration_index)
+        {
+            // the indices of the 1 color palette (color 0 == color 1) are all 0
+            if ((colors[0] == colors[1]) || (!ntm_bc_least_squares(texels, mask, indices, weights, endpoints)))
+            {
+                break;
+            }
+
+            uint32_t refined_colors[2];
+            uint8_t refined_indices[NTM_BC_BLOCK_TEXELS];
+            float const refined_error = ntm_bc1_evaluate(encoder, texels, endpoints, refined_colors, refined_indices);
+            if (!(refined_error < error))
+            {
+                break;
+            }
+
+            error = refined_error;
+            colors[0] = refined_colors[0];
+            colors[1] = refined_colors[1];
+            memcpy(indices, refined_indices, sizeof(indices));
+        }
+    }
+
+    // color 0 (RGB565), color 1 (RGB565), 2 bits for each texel
+    uint32_t packed_indices = 0U;
+    for (uint32_t texel_index = 0U; texel_index < NTM_BC_BLOCK_TEXELS; ++texel_index)
+    {
+        packed_indices |= (static_cast<uint32_t>(indices[texel_index]) << (2U * texel_index));
+    }
+
+    out_block[0] = static_cast<uint8_t>(colors[0] & 0XFFU);
+    out_block[1] = static_cast<uint8_t>(colors[0] >> 8U);
+    out_block[2] = static_cast<uint8_t>(colors[1] & 0XFFU);
+    out_block[3] = static_cast<uint8_t>(colors[1] >> 8U);
+    out_block[4] = static_cast<uint8_t>(packed_indices & 0XFFU);
+    out_block[5] = static_cast<uint8_t>((packed_indices >> 8U) & 0XFFU);
+    out_block[6] = static_cast<uint8_t>((packed_indices >> 16U) & 0XFFU);
+    out_block[7] = static_cast<uint8_t>(packed_indices >> 24U);
+
+    return error;
+}
+
+static inline float ntm_bc1_evaluate(ntm_bc_encoder const *encoder, float const *texels, float const endpoints[2][3], uint32_t out_colors[2], uint8_t *out_indices)
+{
+    uint32_t codes[2][3];
+    for (uint32_t endpoint_index = 0U; endpoint_index < 2U; ++endpoint_index)
+    {
+        codes[endpoint_index][0] = ntm_bc_quantize(endpoints[endpoint_index][0], 5U, false, 0U);
+        codes[endpoint_index][1] = ntm_bc_quantize(endpoints[endpoint_index][1], 6U, false, 0U);
+        codes[endpoint_index][2] = ntm_bc_quantize(endpoints[endpoint_index][2], 5U, false, 0U);
+    }
+
+    uint32_t colors[2];
+    for (uint32_t endpoint_index = 0U; endpoint_index < 2U; ++endpoint_index)
+    {
+        colors[endpoint_index] = (codes[endpoint_index][0] << 11U) | (codes[endpoint_index][1] << 5U) | codes[endpoint_index][2];
+    }
+
+    // the 4 colors mode requires "color 0 > color 1"
+    uint32_t const first = (colors[0] >= colors[1]) ? 0U : 1U;
+    out_colors[0] = colors[first];
+    out_colors[1] = colors[first ^ 1U];
+
+    float palette[4][3];
+    palette[0][0] = static_cast<float>(ntm_bc_unquantize(codes[first][0], 5U));
+    palette[0][1] = static_cast<float>(ntm_bc_unquantize(codes[first][1], 6U));
+    palette[0][2] = static_cast<float>(ntm_bc_unquantize(codes[first][2], 5U));
+    palette[1][0] = static_cast<float>(ntm_bc_unquantize(codes[first ^ 1U][0], 5U));
+    palette[1][1] = static_cast<float>(ntm_bc_unquantize(codes[first ^ 1U][1], 6U));
+    palette[1][2] = static_cast<float>(ntm_bc_unquantize(codes[first ^ 1U][2], 5U));
+    for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+    {
+        uint32_t const value_0 = static_cast<uint32_t>(palette[0][channel_index]);
+        uint32_t const value_1 = static_cast<uint32_t>(palette[1][channel_index]);
+        palette[2][channel_index] = static_cast<float>((2U * value_0 + value_1 + 1U) / 3U);
+        palette[3][channel_index] = static_cast<float>((value_0 + 2U * value_1 + 1U) / 3U);
+    }
+
+    // "color 0 == color 1" is the 3 colors mode, and thus merely the index 0 is used
+    uint32_t const num_colors = (out_colors[0] == out_colors[1]) ? 1U : 4U;
+    return encoder->fit((1U << NTM_BC_BLOCK_TEXELS) - 1U, num_colors, palette, texels, out_indices);
+}
+
+static inline float ntm_bc7_encode_block(ntm_bc_encoder const *encoder, ntm_bc_quality quality, float const *texels, uint8_t *out_block)
+{
+    ntm_bc7_block best_block;
+    ntm_bc7_encode_mode(encoder, quality, &ntm_bc7_mode_6, 0U, texels, &best_block);
+
+    if ((NTM_BC_QUALITY_HIGH == quality) && (best_block.error > 0.0F))
+    {
+        // The partitions are estimated by the residuals of the principal axes of both subsets, and merely the best candidates are encoded.
+        // The moments of the subset 0 are the moments of the whole block minus the moments of the subset 1.
+        ntm_bc_moments block_moments;
+        ntm_bc_accumulate_moments(texels, (1U << NTM_BC_BLOCK_TEXELS) - 1U, &block_moments);
+
+        uint32_t candidates[NTM_BC7_PARTITION_CANDIDATES];
+        float candidate_residuals[NTM_BC7_PARTITION_CANDIDATES];
+        uint32_t num_candidates = 0U;
+        for (uint32_t partition_index = 0U; partition_index < NTM_BC7_NUM_PARTITIONS; ++partition_index)
+        {
+            ntm_bc_moments moments_1;
+            ntm_bc_accumulate_moments(texels, ntm_bc7_partitions[partition_index], &moments_1);
+
+            ntm_bc_moments moments_0;
+            moments_0.count = block_moments.count - moments_1.count;
+            for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+            {
+                moments_0.sums[channel_index] = block_moments.sums[channel_index] - moments_1.sums[channel_index];
+            }
+            for (uint32_t product_index = 0U; product_index < 6U; ++product_index)
+            {
+                moments_0.products[product_index] = block_moments.products[product_index] - moments_1.products[product_index];
+            }
+
+            float mean[3];
+            float axis[3];
+            float const residual = ntm_bc_principal_axis(&moments_0, mean, axis) + ntm_bc_principal_axis(&moments_1, mean, axis);
+
+            // insertion sort
+            uint32_t insert_index = num_candidates;
+            while ((insert_index > 0U) && (residual < candidate_residuals[insert_index - 1U]))
+            {
+                if (insert_index < NTM_BC7_PARTITION_CANDIDATES)
+                {
+                    candidates[insert_index] = candidates[insert_index - 1U];
+                    candidate_residuals[insert_index] = candidate_residuals[insert_index - 1U];
+                }
+                --insert_index;
+            }
+
+            if (insert_index < NTM_BC7_PARTITION_CANDIDATES)
+            {
+                candidates[insert_index] = partition_index;
+                candidate_residuals[insert_index] = residual;
+                num_candidates += ((num_candidates < NTM_BC7_PARTITION_CANDIDATES) ? 1U : 0U);
+            }
+        }
+
+        for (uint32_t candidate_index = 0U; candidate_index < num_candidates; ++candidate_index)
+        {
+            ntm_bc7_mode const *const modes[2] = {&ntm_bc7_mode_1, &ntm_bc7_mode_3};
+            for (uint32_t mode_index = 0U; mode_index < 2U; ++mode_index)
+            {
+                ntm_bc7_block block;
+                ntm_bc7_encode_mode(encoder, quality, modes[mode_index], candidates[candidate_index], texels, &block);
+                if (block.error < best_block.error)
+                {
+                    best_block = block;
+                }
+            }
+        }
+    }
+
+    ntm_bc7_write_block(&best_block, out_block);
+
+    return best_block.error;
+}
+
+static inline void ntm_bc7_encode_mode(ntm_bc_encoder const *encoder, ntm_bc_quality quality, ntm_bc7_mode const *mode, uint32_t partition_index, float const *texels, ntm_bc7_block *out_block)
+{
+    out_block->mode = mode;
+    out_block->partition_index = partition_index;
+    out_block->error = 0.0F;
+
+    float weights[NTM_BC_MAX_COLORS];
+    for (uint32_t color_index = 0U; color_index < (1U << mode->index_bits); ++color_index)
+    {
+        weights[color_index] = static_cast<float>(mode->weights[color_index]) / 64.0F;
+    }
+
+    for (uint32_t subset_index = 0U; subset_index < mode->num_subsets; ++subset_index)
+    {
+        uint32_t const partition_mask = (mode->num_subsets > 1U) ? ntm_bc7_partitions[partition_index] : 0U;
+        uint32_t const mask = ((0U == subset_index) ? (~partition_mask) : partition_mask) & ((1U << NTM_BC_BLOCK_TEXELS) - 1U);
+
+        ntm_bc_moments moments;
+        ntm_bc_accumulate_moments(texels, mask, &moments);
+
+        float mean[3];
+        float axis[3];
+        ntm_bc_principal_axis(&moments, mean, axis);
+
+        float endpoints[2][3];
+        ntm_bc_line_endpoints(texels, mask, mean, axis, endpoints);
+
+        ntm_bc7_subset *const subset = &out_block->subsets[subset_index];
+        float error = ntm_bc7_fit_subset(encoder, mode, texels, mask, endpoints, subset, out_block->indices);
+
+        if (NTM_BC_QUALITY_HIGH == quality)
+        {
+            for (int iteration_index = 0; (iteration_index < NTM_BC_REFINE_ITERATIONS) && (error > 0.0F); ++iteration_index)
+            {
+                if (!ntm_bc_least_squares(texels, mask, out_block->indices, weights, endpoints))
+                {
+                    break;
+                }
+
+                ntm_bc7_subset refined_subset;
+                uint8_t refined_indices[NTM_BC_BLOCK_TEXELS];
+                float const refined_error = ntm_bc7_fit_subset(encoder, mode, texels, mask, endpoints, &refined_subset, refined_indices);
+                if (!(refined_error < error))
+                {
+                    break;
+                }
+
+                error = refined_error;
+                (*subset) = refined_subset;
+                for (uint32_t texel_index = 0U; texel_index < NTM_BC_BLOCK_TEXELS; ++texel_index)
+                {
+                    if (0U != (mask & (1U << texel_index)))
+                    {
+                        out_block->indices[texel_index] = refined_indices[texel_index];
+                    }
+                }
+            }
+        }
+
+        out_block->error += error;
+    }
+}
+
+static inline float ntm_bc7_fit_subset(ntm_bc_encoder const *encoder, ntm_bc7_mode const *mode, float const *texels, uint32_t mask, float const endpoints[2][3], ntm_bc7_subset *out_subset, uint8_t *inout_indices)
+{
+    // The p-bits are selected by the quantization errors of the endpoints merely, and thus there is exactly one fit for each subset.
+    uint32_t values[2][3];
+    float best_quantization_error = NTM_BC_MAX_ERROR;
+    for (uint32_t pbits_index = 0U; pbits_index < mode->num_pbits_candidates; ++pbits_index)
+    {
+        ntm_bc7_subset subset;
+        uint32_t subset_values[2][3];
+        float quantization_error = 0.0F;
+        for (uint32_t endpoint_index = 0U; endpoint_index < 2U; ++endpoint_index)
+        {
+            uint32_t const pbit = mode->pbits_candidates[pbits_index][endpoint_index];
+            subset.pbits[endpoint_index] = pbit;
+            for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+            {
+                uint32_t const code = ntm_bc_quantize(endpoints[endpoint_index][channel_index], mode->color_bits, true, pbit);
+                subset.endpoints[endpoint_index][channel_index] = code;
+                subset_values[endpoint_index][channel_index] = ntm_bc_unquantize((code << 1U) | pbit, mode->color_bits + 1U);
+
+                float const delta = static_cast<float>(subset_values[endpoint_index][channel_index]) - endpoints[endpoint_index][channel_index];
+                quantization_error += delta * delta;
+            }
+        }
+
+        if (quantization_error < best_quantization_error)
+        {
+            best_quantization_error = quantization_error;
+            (*out_subset) = subset;
+            memcpy(values, subset_values, sizeof(values));
+        }
+    }
+
+    uint32_t const num_colors = 1U << mode->index_bits;
+    float palette[NTM_BC_MAX_COLORS][3];
+    for (uint32_t color_index = 0U; color_index < num_colors; ++color_index)
+    {
+        uint32_t const weight = mode->weights[color_index];
+        for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+        {
+            palette[color_index][channel_index] = static_cast<float>(((64U - weight) * values[0][channel_index] + weight * values[1][channel_index] + 32U) >> 6U);
+        }
+    }
+
+    return encoder->fit(mask, num_colors, palette, texels, inout_indices);
+}
+
+static inline void ntm_bc7_write_block(ntm_bc7_block const *block, uint8_t *out_block)
+{
+    ntm_bc7_mode const *const mode = block->mode;
+    uint32_t const max_index = (1U << mode->index_bits) - 1U;
+    uint32_t const partition_mask = (mode->num_subsets > 1U) ? ntm_bc7_partitions[block->partition_index] : 0U;
+
+    // The MSB of the index of the anchor texel of each subset is implicitly 0, and thus the endpoints (and the indices) of the subset are swapped if necessary.
+    // Since the weights are symmetric ("weight[i] + weight[max - i] = 64"), the colors are the same.
+    ntm_bc7_subset subsets[2];
+    uint8_t indices[NTM_BC_BLOCK_TEXELS];
+    memcpy(indices, block->indices, sizeof(indices));
+    for (uint32_t subset_index = 0U; subset_index < mode->num_subsets; ++subset_index)
+    {
+        subsets[subset_index] = block->subsets[subset_index];
+
+        uint32_t const anchor_index = (0U == subset_index) ? 0U : ntm_bc7_anchors[block->partition_index];
+        if (indices[anchor_index] > (max_index >> 1U))
+        {
+            for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+            {
+                subsets[subset_index].endpoints[0][channel_index] = block->subsets[subset_index].endpoints[1][channel_index];
+                subsets[subset_index].endpoints[1][channel_index] = block->subsets[subset_index].endpoints[0][channel_index];
+            }
+            subsets[subset_index].pbits[0] = block->subsets[subset_index].pbits[1];
+            subsets[subset_index].pbits[1] = block->subsets[subset_index].pbits[0];
+
+            for (uint32_t texel_index = 0U; texel_index < NTM_BC_BLOCK_TEXELS; ++texel_index)
+            {
+                if (((partition_mask >> texel_index) & 1U) == subset_index)
+                {
+                    indices[texel_index] = static_cast<uint8_t>(max_index - indices[texel_index]);
+                }
+            }
+        }
+    }
+
+    memset(out_block, 0, 16U);
+    uint32_t bit_offset = 0U;
+
+    // the mode "m" is "m" zeros followed by one
+    ntm_bc7_write_bits(out_block, &bit_offset, 1U << mode->mode, mode->mode + 1U);
+
+    if (mode->num_subsets > 1U)
+    {
+        ntm_bc7_write_bits(out_block, &bit_offset, block->partition_index, 6U);
+    }
+
+    // R0 R1 (R2 R3) G0 G1 (G2 G3) B0 B1 (B2 B3)
+    for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+    {
+        for (uint32_t subset_index = 0U; subset_index < mode->num_subsets; ++subset_index)
+        {
+            ntm_bc7_write_bits(out_block, &bit_offset, subsets[subset_index].endpoints[0][channel_index], mode->color_bits);
+            ntm_bc7_write_bits(out_block, &bit_offset, subsets[subset_index].endpoints[1][channel_index], mode->color_bits);
+        }
+    }
+
+    if (6U == mode->mode)
+    {
+        // A0 A1: 127 with the p-bit 1 is 255
+        ntm_bc7_write_bits(out_block, &bit_offset, 0X7FU, 7U);
+        ntm_bc7_write_bits(out_block, &bit_offset, 0X7FU, 7U);
+    }
+
+    for (uint32_t subset_index = 0U; subset_index < mode->num_subsets; ++subset_index)
+    {
+        ntm_bc7_write_bits(out_block, &bit_offset, subsets[subset_index].pbits[0], 1U);
+        if (1U != mode->mode)
+        {
+            ntm_bc7_write_bits(out_block, &bit_offset, subsets[subset_index].pbits[1], 1U);
+        }
+        else
+        {
+            // the p-bit of the mode 1 is shared by both endpoints
+            assert(subsets[subset_index].pbits[0] == subsets[subset_index].pbits[1]);
+        }
+    }
+
+    uint32_t const anchor_index_1 = (mode->num_subsets > 1U) ? ntm_bc7_anchors[block->partition_index] : 0U;
+    for (uint32_t texel_index = 0U; texel_index < NTM_BC_BLOCK_TEXELS; ++texel_index)
+    {
+        bool const anchor = (0U == texel_index) || ((mode->num_subsets > 1U) && (anchor_index_1 == texel_index));
+        ntm_bc7_write_bits(out_block, &bit_offset, indices[texel_index], anchor ? (mode->index_bits - 1U) : mode->index_bits);
+    }
+
+    assert(128U == bit_offset);
+}
+
+static inline void ntm_bc7_write_bits(uint8_t *block, uint32_t *inout_bit_offset, uint32_t value, uint32_t num_bits)
+{
+    // LSB first
+    for (uint32_t bit_index = 0U; bit_index < num_bits; ++bit_index)
+    {
+        uint32_t const bit_offset = (*inout_bit_offset) + bit_index;
+        block[bit_offset >> 3U] |= static_cast<uint8_t>(((value >> bit_index) & 1U) << (bit_offset & 7U));
+    }
+
+    (*inout_bit_offset) += num_bits;
+}
@@ -0,0 +1,73 @@
+#ifndef _NTM_BC_ENCODER_H_
+#define _NTM_BC_ENCODER_H_ 1
+
+#include "ntm-cpu-inference.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// The decoded texels are encoded into the GPU block-compressed formats directly, and thus the engine can upload the blocks without recompressing them.
+// https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html#S3TC
+// https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html#BPTC
+enum ntm_bc_format
+{
+    // 8 bytes per 4x4 block: two RGB565 endpoints and the 2-bit indices (merely the 4 colors mode)
+    NTM_BC_FORMAT_BC1 = 0,
+    // 16 bytes per 4x4 block: merely the opaque modes (1, 3 and 6), namely, the alpha is always 255
+    NTM_BC_FORMAT_BC7 = 1
+};
+
+enum ntm_bc_quality
+{
+    // BC1: the endpoints are the extremes along the principal axis
+    // BC7: the mode 6 merely
+    NTM_BC_QUALITY_FAST = 0,
+    // BC1: the endpoints are refined by the least squares
+    // BC7: the mode 6 is refined by the least squares, and the 2 subsets modes (1 and 3) are tried for the best partitions (estimated by the residuals of the principal axes)
+    NTM_BC_QUALITY_HIGH = 1
+};
+
+struct ntm_bc_encoding
+{
+    ntm_bc_format format;
+    ntm_bc_quality quality;
+};
+
+// The 16 texels of one block are [R, G, B][16] (the integers in [0, 255]), namely, each SIMD lane evaluates one texel (the same as the batch of the CPU engine).
+// Each texel selected by the "mask" (bit i: texel i) selects the nearest color of the palette ([num_colors][R, G, B], the integers in [0, 255]), and the sum of the squared errors of these texels is returned.
+// Since all values are integers and the sum is less than 2^24, the error is exact in float, and thus all ISAs select the same indices (the first one of the ties).
+typedef float (*ntm_bc_fit_kernel)(uint32_t mask, uint32_t num_colors, float const (*in_palette)[3], float const *in_texels, uint8_t *out_indices);
+
+struct ntm_bc_encoder
+{
+    ntm_cpu_isa isa;
+    ntm_bc_fit_kernel fit;
+};
+
+// The "isa" is downgraded to the best ISA supported by the current CPU (the VNNI is the same as the AVX512).
+extern void ntm_bc_encoder_init(ntm_bc_encoder *out_encoder, ntm_cpu_isa isa);
+
+// "bc1" or "bc7"
+extern char const *ntm_bc_format_name(ntm_bc_format format);
+
+extern bool ntm_bc_format_parse(char const *name, ntm_bc_format *out_format);
+
+// "fast" or "high"
+extern char const *ntm_bc_quality_name(ntm_bc_quality quality);
+
+extern bool ntm_bc_quality_parse(char const *name, ntm_bc_quality *out_quality);
+
+// The size (in bytes) of one 4x4 block
+extern uint32_t ntm_bc_block_size(ntm_bc_format format);
+
+// One row of the blocks: the texels are B8G8R8A8 (the same as the "bit_RGBs") [height][in_row_pitch], and the "out_blocks" is "(width + 3) / 4" contiguous blocks.
+// The "height" is at most 4, and the blocks at the edges replicate the last column (or the last row) of the texels.
+// The sum of the squared errors (of the RGB of all the texels of the blocks) is returned, e.g. for the PSNR.
+// It is safe to call this function from multiple threads concurrently.
+extern uint64_t ntm_bc_encoder_encode_rows(ntm_bc_encoder const *encoder, ntm_bc_encoding const *encoding, uint32_t width, uint32_t height, void const *in_texels, size_t in_row_pitch, void *out_blocks);
+
+// The same as the "ntm_cpu_engine_predict_grid_pixels" (B8G8R8A8) except that the grid is encoded into the blocks: the block (x, y) of the grid is written to "out_blocks + out_row_pitch * y + ntm_bc_block_size(format) * x".
+// The grid is decoded strip by strip into the scratch memory on the stack (within the L1 cache), and each strip is encoded as soon as it has been decoded, namely, the texels never touch the uncompressed texture.
+// The "grid_x" and the "grid_y" are multiples of 4, and the "grid_width" (or the "grid_height") is a multiple of 4 unless the grid is at the edge of the texture.
+extern uint64_t ntm_bc_encoder_predict_grid(ntm_bc_encoder const *encoder, ntm_bc_encoding const *encoding, ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, uint32_t grid_x, uint32_t grid_y, uint32_t grid_width, uint32_t grid_height, void *out_blocks, size_t out_row_pitch);
+
+#endif
@@ -0,0 +1,71 @@
+#include "ntm-bc-kernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+// NOTE: this translation unit is compiled with "-mavx2 -mfma -mf16c" (GCC) or "/arch:AVX2" (MSVC).
+
+// NTM_BC_BLOCK_TEXELS lanes = 2 x 8
+extern float ntm_bc_fit_avx2(uint32_t mask, uint32_t num_colors, float const (*in_palette)[3], float const *in_texels, uint8_t *out_indices)
+{
+    __m256 const r_0 = _mm256_load_ps(in_texels);
+    __m256 const r_1 = _mm256_load_ps(in_texels + 8);
+    __m256 const g_0 = _mm256_load_ps(in_texels + NTM_BC_BLOCK_TEXELS);
+    __m256 const g_1 = _mm256_load_ps(in_texels + NTM_BC_BLOCK_TEXELS + 8);
+    __m256 const b_0 = _mm256_load_ps(in_texels + NTM_BC_BLOCK_TEXELS * 2U);
+    __m256 const b_1 = _mm256_load_ps(in_texels + NTM_BC_BLOCK_TEXELS * 2U + 8);
+
+    __m256 best_error_0 = _mm256_set1_ps(NTM_BC_MAX_ERROR);
+    __m256 best_error_1 = _mm256_set1_ps(NTM_BC_MAX_ERROR);
+    __m256 best_color_index_0 = _mm256_setzero_ps();
+    __m256 best_color_index_1 = _mm256_setzero_ps();
+
+    for (uint32_t color_index = 0U; color_index < num_colors; ++color_index)
+    {
+        __m256 const palette_r = _mm256_set1_ps(in_palette[color_index][0]);
+        __m256 const palette_g = _mm256_set1_ps(in_palette[color_index][1]);
+        __m256 const palette_b = _mm256_set1_ps(in_palette[color_index][2]);
+
+        // the products and the sums are integers less than 2^24, and thus the FMA is exact
+        __m256 const delta_r_0 = _mm256_sub_ps(r_0, palette_r);
+        __m256 const delta_r_1 = _mm256_sub_ps(r_1, palette_r);
+        __m256 const delta_g_0 = _mm256_sub_ps(g_0, palette_g);
+        __m256 const delta_g_1 = _mm256_sub_ps(g_1, palette_g);
+        __m256 const delta_b_0 = _mm256_sub_ps(b_0, palette_b);
+        __m256 const delta_b_1 = _mm256_sub_ps(b_1, palette_b);
+        __m256 const error_0 = _mm256_fmadd_ps(delta_b_0, delta_b_0, _mm256_fmadd_ps(delta_g_0, delta_g_0, _mm256_mul_ps(delta_r_0, delta_r_0)));
+        __m256 const error_1 = _mm256_fmadd_ps(delta_b_1, delta_b_1, _mm256_fmadd_ps(delta_g_1, delta_g_1, _mm256_mul_ps(delta_r_1, delta_r_1)));
+
+        // the first one of the ties
+        __m256 const less_0 = _mm256_cmp_ps(error_0, best_error_0, _CMP_LT_OQ);
+        __m256 const less_1 = _mm256_cmp_ps(error_1, best_error_1, _CMP_LT_OQ);
+        __m256 const color_index_vector = _mm256_set1_ps(static_cast<float>(color_index));
+        best_error_0 = _mm256_blendv_ps(best_error_0, error_0, less_0);
+        best_error_1 = _mm256_blendv_ps(best_error_1, error_1, less_1);
+        best_color_index_0 = _mm256_blendv_ps(best_color_index_0, color_index_vector, less_0);
+        best_color_index_1 = _mm256_blendv_ps(best_color_index_1, color_index_vector, less_1);
+    }
+
+    alignas(32) float best_errors[NTM_BC_BLOCK_TEXELS];
+    alignas(32) int32_t best_color_indices[NTM_BC_BLOCK_TEXELS];
+    _mm256_store_ps(best_errors, best_error_0);
+    _mm256_store_ps(best_errors + 8, best_error_1);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(best_color_indices), _mm256_cvttps_epi32(best_color_index_0));
+    _mm256_store_si256(reinterpret_cast<__m256i *>(best_color_indices + 8), _mm256_cvttps_epi32(best_color_index_1));
+
+    // the sum of the integers is exact in any order
+    float error = 0.0F;
+    for (uint32_t texel_index = 0U; texel_index < NTM_BC_BLOCK_TEXELS; ++texel_index)
+    {
+        if (0U != (mask & (1U << texel_index)))
+        {
+            out_indices[texel_index] = static_cast<uint8_t>(best_color_indices[texel_index]);
+            error += best_errors[texel_index];
+        }
+    }
+
+    return error;
+}
+
+#endif
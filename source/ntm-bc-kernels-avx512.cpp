@@ -0,0 +1,40 @@
+#include "ntm-bc-kernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+// NOTE: this translation unit is compiled with "-mavx512f -mavx512bw -mfma" (GCC) or "/arch:AVX512" (MSVC).
+
+// NTM_BC_BLOCK_TEXELS lanes = 1 x 16
+extern float ntm_bc_fit_avx512(uint32_t mask, uint32_t num_colors, float const (*in_palette)[3], float const *in_texels, uint8_t *out_indices)
+{
+    __m512 const r = _mm512_load_ps(in_texels);
+    __m512 const g = _mm512_load_ps(in_texels + NTM_BC_BLOCK_TEXELS);
+    __m512 const b = _mm512_load_ps(in_texels + NTM_BC_BLOCK_TEXELS * 2U);
+
+    __m512 best_error = _mm512_set1_ps(NTM_BC_MAX_ERROR);
+    __m512i best_color_index = _mm512_setzero_si512();
+
+    for (uint32_t color_index = 0U; color_index < num_colors; ++color_index)
+    {
+        // the products and the sums are integers less than 2^24, and thus the FMA is exact
+        __m512 const delta_r = _mm512_sub_ps(r, _mm512_set1_ps(in_palette[color_index][0]));
+        __m512 const delta_g = _mm512_sub_ps(g, _mm512_set1_ps(in_palette[color_index][1]));
+        __m512 const delta_b = _mm512_sub_ps(b, _mm512_set1_ps(in_palette[color_index][2]));
+        __m512 const error = _mm512_fmadd_ps(delta_b, delta_b, _mm512_fmadd_ps(delta_g, delta_g, _mm512_mul_ps(delta_r, delta_r)));
+
+        // the first one of the ties
+        __mmask16 const less = _mm512_cmp_ps_mask(error, best_error, _CMP_LT_OQ);
+        best_error = _mm512_mask_mov_ps(best_error, less, error);
+        best_color_index = _mm512_mask_mov_epi32(best_color_index, less, _mm512_set1_epi32(static_cast<int>(color_index)));
+    }
+
+    __mmask16 const texel_mask = static_cast<__mmask16>(mask & 0XFFFFU);
+    _mm512_mask_cvtepi32_storeu_epi8(out_indices, texel_mask, best_color_index);
+
+    // the sum of the integers is exact in any order
+    return _mm512_mask_reduce_add_ps(texel_mask, best_error);
+}
+
+#endif
@@ -0,0 +1,34 @@
+#include "ntm-bc-kernels.h"
+
+extern float ntm_bc_fit_scalar(uint32_t mask, uint32_t num_colors, float const (*in_palette)[3], float const *in_texels, uint8_t *out_indices)
+{
+    float error = 0.0F;
+    for (uint32_t texel_index = 0U; texel_index < NTM_BC_BLOCK_TEXELS; ++texel_index)
+    {
+        if (0U == (mask & (1U << texel_index)))
+        {
+            continue;
+        }
+
+        float best_error = NTM_BC_MAX_ERROR;
+        uint32_t best_color_index = 0U;
+        for (uint32_t color_index = 0U; color_index < num_colors; ++color_index)
+        {
+            float const delta_r = in_texels[texel_index] - in_palette[color_index][0];
+            float const delta_g = in_texels[NTM_BC_BLOCK_TEXELS + texel_index] - in_palette[color_index][1];
+            float const delta_b = in_texels[NTM_BC_BLOCK_TEXELS * 2U + texel_index] - in_palette[color_index][2];
+            float const color_error = delta_r * delta_r + delta_g * delta_g + delta_b * delta_b;
+
+            if (color_error < best_error)
+            {
+                best_error = color_error;
+                best_color_index = color_index;
+            }
+        }
+
+        out_indices[texel_index] = static_cast<uint8_t>(best_color_index);
+        error += best_error;
+    }
+
+    return error;
+}
@@ -0,0 +1,25 @@
+#ifndef _NTM_BC_KERNELS_H_
+#define _NTM_BC_KERNELS_H_ 1
+
+#include "ntm-bc-encoder.h"
+
+// NOTE: the same as the "ntm-cpu-kernels.h", this header is included by the translation units which are compiled with the ISA specific flags.
+
+// The texels of one 4x4 block (row-major), namely, one lane for each texel.
+static constexpr uint32_t const NTM_BC_BLOCK_TEXELS = 16U;
+
+// At most 16 colors (the 4-bit indices of the BC7 mode 6)
+static constexpr uint32_t const NTM_BC_MAX_COLORS = 16U;
+
+// Larger than any squared error of one texel (3 * 255^2)
+static constexpr float const NTM_BC_MAX_ERROR = 1E30F;
+
+extern float ntm_bc_fit_scalar(uint32_t mask, uint32_t num_colors, float const (*in_palette)[3], float const *in_texels, uint8_t *out_indices);
+
+#if defined(__x86_64__) || defined(_M_X64)
+extern float ntm_bc_fit_avx2(uint32_t mask, uint32_t num_colors, float const (*in_palette)[3], float const *in_texels, uint8_t *out_indices);
+
+extern float ntm_bc_fit_avx512(uint32_t mask, uint32_t num_colors, float const (*in_palette)[3], float const *in_texels, uint8_t *out_indices);
+#endif
+
+#endif
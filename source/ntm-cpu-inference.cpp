@@ -0,0 +1,837 @@
+#include "ntm-cpu-inference.h"
+#include "ntm-cpu-kernels.h"
+#include "ntm-profiler.h"
+#include <math.h>
+#include <assert.h>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// The number of the columns of which the vectors are cached by the grid decode.
+static constexpr uint32_t const NTM_CPU_GRID_COLUMNS = 4U * NTM_CPU_BATCH_SIZE;
+
+// The frequency of which the attenuation (of both U and V) is below this threshold is dropped.
+static constexpr double const NTM_CPU_LOD_DROP_THRESHOLD = 1.0 / 256.0;
+
+// The 1st layer band-limited by the footprint.
+struct ntm_cpu_lod_layer
+{
+    // the frequencies [0, num_frequencies) are evaluated, and the other frequencies are dropped
+    uint32_t num_frequencies;
+    // [frequency][U, V]
+    float attenuations[NTM_MAX_FREQUENCIES][2];
+    // the same weights as the 1st layer of the model except that the "input_size" is "4 * num_frequencies" and the "biases" is the "lod_biases"
+    ntm_layer layer;
+    // the biases plus the means of the attenuated (and the dropped) features
+    float lod_biases[NTM_MAX_LAYER_WIDTH];
+};
+
+// The vectors of one batch of the rows, which are reused by all the column chunks of the grid decode.
+struct ntm_cpu_grid_row_vectors
+{
+    // [neuron][NTM_CPU_BATCH_SIZE]
+    alignas(64) float values[NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+};
+
+static inline ntm_cpu_kernels const *ntm_cpu_select_kernels(ntm_cpu_isa *inout_isa);
+
+static inline void ntm_cpu_engine_predict_grid_internal(ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, uint32_t grid_x, uint32_t grid_y, uint32_t grid_width, uint32_t grid_height, float (*out_RGBs)[3], ntm_pixel_encoding const *encoding, void *out_pixels, size_t out_row_pitch);
+
+static inline float const *ntm_cpu_engine_predict_batch(ntm_cpu_engine const *engine, ntm_cpu_lod_layer const *lod_layer, uint32_t batch_count, float const (*in_UVs)[2], float (*activations)[NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE]);
+
+static inline uint32_t ntm_cpu_engine_lod_attenuations(ntm_cpu_engine const *engine, float footprint_u, float footprint_v, float (*out_attenuations)[2]);
+
+static inline bool ntm_cpu_engine_init_lod_layer(ntm_cpu_engine const *engine, float footprint_u, float footprint_v, float (*scratch_activations)[NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE], ntm_cpu_lod_layer *out_lod_layer);
+
+static inline void ntm_cpu_lod_attenuate(ntm_cpu_lod_layer const *lod_layer, float *inout_features);
+
+static inline void ntm_cpu_positional_encoding_axis(ntm_cpu_encode_kernel encode, uint32_t num_frequencies, uint32_t axis, uint32_t count, float const *in_coordinates, float *out_features);
+
+static inline ntm_cpu_dense_kernel const *ntm_cpu_engine_dense_kernels(ntm_cpu_engine const *engine);
+
+static inline void ntm_cpu_profiler_lap(bool profile, uint64_t *inout_timestamp, uint64_t *inout_duration);
+
+extern ntm_cpu_isa ntm_cpu_detect_isa()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // "__builtin_cpu_supports" also checks whether the OS saves the AVX/AVX-512 states (XCR0)
+    // NOTE: every CPU which supports both the AVX2 and the FMA also supports the F16C
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return __builtin_cpu_supports("avx512vnni") ? NTM_CPU_ISA_AVX512_VNNI : NTM_CPU_ISA_AVX512;
+    }
+    else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        return NTM_CPU_ISA_AVX2;
+    }
+    else
+    {
+        return NTM_CPU_ISA_SCALAR;
+    }
+#elif defined(_MSC_VER) && defined(_M_X64)
+    int cpu_info_1[4];
+    __cpuid(cpu_info_1, 1);
+
+    bool const os_xsave = (0 != (cpu_info_1[2] & (1 << 27)));
+    bool const fma = (0 != (cpu_info_1[2] & (1 << 12)));
+    if (!os_xsave)
+    {
+        return NTM_CPU_ISA_SCALAR;
+    }
+
+    unsigned __int64 const xcr0 = _xgetbv(0);
+
+    int cpu_info_7[4];
+    __cpuidex(cpu_info_7, 7, 0);
+
+    bool const avx2 = (0 != (cpu_info_7[1] & (1 << 5)));
+    bool const avx512f = (0 != (cpu_info_7[1] & (1 << 16)));
+    bool const avx512bw = (0 != (cpu_info_7[1] & (1 << 30)));
+    bool const avx512vnni = (0 != (cpu_info_7[2] & (1 << 11)));
+    bool const f16c = (0 != (cpu_info_1[2] & (1 << 29)));
+
+    // XMM | YMM | OPMASK | ZMM_Hi256 | Hi16_ZMM
+    if (avx512f && avx512bw && (0XE6U == (xcr0 & 0XE6U)))
+    {
+        return avx512vnni ? NTM_CPU_ISA_AVX512_VNNI : NTM_CPU_ISA_AVX512;
+    }
+    // XMM | YMM
+    else if (avx2 && fma && f16c && (0X6U == (xcr0 & 0X6U)))
+    {
+        return NTM_CPU_ISA_AVX2;
+    }
+    else
+    {
+        return NTM_CPU_ISA_SCALAR;
+    }
+#else
+    return NTM_CPU_ISA_SCALAR;
+#endif
+}
+
+extern char const *ntm_cpu_isa_name(ntm_cpu_isa isa)
+{
+    switch (isa)
+    {
+    case NTM_CPU_ISA_AVX512_VNNI:
+        return "avx512vnni";
+    case NTM_CPU_ISA_AVX512:
+        return "avx512";
+    case NTM_CPU_ISA_AVX2:
+        return "avx2";
+    default:
+        assert(NTM_CPU_ISA_SCALAR == isa);
+        return "scalar";
+    }
+}
+
+extern void ntm_cpu_engine_init(ntm_cpu_engine *out_engine, ntm_model const *model, ntm_cpu_isa isa)
+{
+    out_engine->model = (*model);
+    out_engine->kernels = ntm_cpu_select_kernels(&isa);
+    out_engine->isa = isa;
+    out_engine->lod_base_width = 0U;
+    out_engine->lod_base_height = 0U;
+    out_engine->sparse = false;
+    for (uint32_t feature_index = 0U; feature_index < (4U * NTM_MAX_FREQUENCIES); ++feature_index)
+    {
+        out_engine->lod_feature_means[feature_index] = 0.0F;
+    }
+}
+
+extern void ntm_cpu_engine_enable_sparsity(ntm_cpu_engine *engine)
+{
+    engine->sparse = true;
+}
+
+extern void ntm_cpu_engine_enable_lod(ntm_cpu_engine *engine, uint32_t base_width, uint32_t base_height)
+{
+    assert(base_width >= 1U && base_height >= 1U);
+
+    engine->lod_base_width = base_width;
+    engine->lod_base_height = base_height;
+
+    // The higher frequencies are NOT band-limited by the training (e.g. "sin(2^10 * pi * U)" is constant at the texel centers of 512 texels), and thus the mean is over the texel centers (the same as the "generate_UVs") rather than over [0, 1].
+    for (uint32_t frequency_index = 0U; frequency_index < engine->model.num_frequencies; ++frequency_index)
+    {
+        float const frequency = static_cast<float>(1U << frequency_index) * NTM_PI;
+
+        for (uint32_t axis = 0U; axis < 2U; ++axis)
+        {
+            uint32_t const base_size = (0U == axis) ? base_width : base_height;
+
+            double sin_sum = 0.0;
+            double cos_sum = 0.0;
+            for (uint32_t texel_index = 0U; texel_index < base_size; ++texel_index)
+            {
+                float const coordinate = (static_cast<float>(texel_index) + 0.5F) / static_cast<float>(base_size);
+                double const argument = static_cast<double>(frequency * coordinate);
+                sin_sum += sin(argument);
+                cos_sum += cos(argument);
+            }
+
+            engine->lod_feature_means[4U * frequency_index + axis] = static_cast<float>(sin_sum / static_cast<double>(base_size));
+            engine->lod_feature_means[4U * frequency_index + 2U + axis] = static_cast<float>(cos_sum / static_cast<double>(base_size));
+        }
+    }
+}
+
+extern uint32_t ntm_cpu_engine_lod_num_frequencies(ntm_cpu_engine const *engine, float footprint_u, float footprint_v)
+{
+    float attenuations[NTM_MAX_FREQUENCIES][2];
+    return ntm_cpu_engine_lod_attenuations(engine, footprint_u, footprint_v, attenuations);
+}
+
+extern void ntm_cpu_engine_predict(ntm_cpu_engine const *engine, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3])
+{
+    // ping-pong
+    alignas(64) float activations[2][NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+
+    for (uint32_t batch_begin = 0U; batch_begin < count; batch_begin += NTM_CPU_BATCH_SIZE)
+    {
+        uint32_t const batch_count = ((count - batch_begin) < NTM_CPU_BATCH_SIZE) ? (count - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+        float const *const RGBs = ntm_cpu_engine_predict_batch(engine, NULL, batch_count, in_UVs + batch_begin, activations);
+
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            out_RGBs[batch_begin + lane_index][0] = RGBs[lane_index];
+            out_RGBs[batch_begin + lane_index][1] = RGBs[NTM_CPU_BATCH_SIZE + lane_index];
+            out_RGBs[batch_begin + lane_index][2] = RGBs[NTM_CPU_BATCH_SIZE * 2U + lane_index];
+        }
+    }
+}
+
+extern void ntm_cpu_engine_sample(ntm_cpu_engine const *engine, ntm_sampler const *sampler, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3])
+{
+    // ping-pong
+    alignas(64) float activations[2][NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+
+    for (uint32_t batch_begin = 0U; batch_begin < count; batch_begin += NTM_CPU_BATCH_SIZE)
+    {
+        uint32_t const batch_count = ((count - batch_begin) < NTM_CPU_BATCH_SIZE) ? (count - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+        float UVs[NTM_CPU_BATCH_SIZE][2];
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            UVs[lane_index][0] = ntm_cpu_address(sampler->address_mode_u, in_UVs[batch_begin + lane_index][0]);
+            UVs[lane_index][1] = ntm_cpu_address(sampler->address_mode_v, in_UVs[batch_begin + lane_index][1]);
+        }
+
+        float const *const RGBs = ntm_cpu_engine_predict_batch(engine, NULL, batch_count, UVs, activations);
+
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            out_RGBs[batch_begin + lane_index][0] = RGBs[lane_index];
+            out_RGBs[batch_begin + lane_index][1] = RGBs[NTM_CPU_BATCH_SIZE + lane_index];
+            out_RGBs[batch_begin + lane_index][2] = RGBs[NTM_CPU_BATCH_SIZE * 2U + lane_index];
+        }
+    }
+}
+
+extern void ntm_cpu_engine_sample_soa(ntm_cpu_engine const *engine, ntm_sampler const *sampler, uint32_t count, float const *in_Us, float const *in_Vs, float *out_Rs, float *out_Gs, float *out_Bs)
+{
+    // ping-pong
+    alignas(64) float activations[2][NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+
+    for (uint32_t batch_begin = 0U; batch_begin < count; batch_begin += NTM_CPU_BATCH_SIZE)
+    {
+        uint32_t const batch_count = ((count - batch_begin) < NTM_CPU_BATCH_SIZE) ? (count - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+        float UVs[NTM_CPU_BATCH_SIZE][2];
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            UVs[lane_index][0] = ntm_cpu_address(sampler->address_mode_u, in_Us[batch_begin + lane_index]);
+            UVs[lane_index][1] = ntm_cpu_address(sampler->address_mode_v, in_Vs[batch_begin + lane_index]);
+        }
+
+        float const *const RGBs = ntm_cpu_engine_predict_batch(engine, NULL, batch_count, UVs, activations);
+
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            out_Rs[batch_begin + lane_index] = RGBs[lane_index];
+            out_Gs[batch_begin + lane_index] = RGBs[NTM_CPU_BATCH_SIZE + lane_index];
+            out_Bs[batch_begin + lane_index] = RGBs[NTM_CPU_BATCH_SIZE * 2U + lane_index];
+        }
+    }
+}
+
+extern void ntm_cpu_engine_sample_lod(ntm_cpu_engine const *engine, ntm_sampler const *sampler, float footprint_u, float footprint_v, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3])
+{
+    // ping-pong
+    alignas(64) float activations[2][NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+
+    ntm_cpu_lod_layer lod_layer;
+    bool const lod = ntm_cpu_engine_init_lod_layer(engine, footprint_u, footprint_v, activations, &lod_layer);
+
+    for (uint32_t batch_begin = 0U; batch_begin < count; batch_begin += NTM_CPU_BATCH_SIZE)
+    {
+        uint32_t const batch_count = ((count - batch_begin) < NTM_CPU_BATCH_SIZE) ? (count - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+        float UVs[NTM_CPU_BATCH_SIZE][2];
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            UVs[lane_index][0] = ntm_cpu_address(sampler->address_mode_u, in_UVs[batch_begin + lane_index][0]);
+            UVs[lane_index][1] = ntm_cpu_address(sampler->address_mode_v, in_UVs[batch_begin + lane_index][1]);
+        }
+
+        float const *const RGBs = ntm_cpu_engine_predict_batch(engine, lod ? (&lod_layer) : NULL, batch_count, UVs, activations);
+
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            out_RGBs[batch_begin + lane_index][0] = RGBs[lane_index];
+            out_RGBs[batch_begin + lane_index][1] = RGBs[NTM_CPU_BATCH_SIZE + lane_index];
+            out_RGBs[batch_begin + lane_index][2] = RGBs[NTM_CPU_BATCH_SIZE * 2U + lane_index];
+        }
+    }
+}
+
+extern float ntm_cpu_address(ntm_address_mode address_mode, float coordinate)
+{
+    if (NTM_ADDRESS_MODE_WRAP == address_mode)
+    {
+        // "coordinate - floor(coordinate)" may be rounded to 1.0 for the tiny negative coordinate
+        float const wrapped = coordinate - floorf(coordinate);
+        return (wrapped < 1.0F) ? wrapped : 0.0F;
+    }
+    else
+    {
+        assert(NTM_ADDRESS_MODE_CLAMP == address_mode);
+        return (coordinate > 1.0F) ? 1.0F : ((coordinate > 0.0F) ? coordinate : 0.0F);
+    }
+}
+
+extern void ntm_cpu_engine_predict_grid(ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, uint32_t grid_x, uint32_t grid_y, uint32_t grid_width, uint32_t grid_height, float (*out_RGBs)[3])
+{
+    ntm_cpu_engine_predict_grid_internal(engine, texture_width, texture_height, grid_x, grid_y, grid_width, grid_height, out_RGBs, NULL, NULL, 0U);
+}
+
+extern void ntm_cpu_engine_predict_grid_pixels(ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, uint32_t grid_x, uint32_t grid_y, uint32_t grid_width, uint32_t grid_height, ntm_pixel_encoding const *encoding, void *out_pixels, size_t out_row_pitch)
+{
+    assert(NULL != encoding);
+    assert(out_row_pitch >= (static_cast<size_t>(ntm_pixel_format_size(encoding->format)) * grid_width));
+
+    ntm_cpu_engine_predict_grid_internal(engine, texture_width, texture_height, grid_x, grid_y, grid_width, grid_height, NULL, encoding, out_pixels, out_row_pitch);
+}
+
+extern uint32_t ntm_pixel_format_size(ntm_pixel_format format)
+{
+    return (NTM_PIXEL_FORMAT_R16G16B16A16_SFLOAT == format) ? 8U : 4U;
+}
+
+extern void ntm_cpu_pack_pixels(ntm_cpu_isa isa, ntm_pixel_encoding const *encoding, uint32_t count, float const (*in_RGBs)[3], void *out_pixels)
+{
+    ntm_cpu_pack_kernel const pack = ntm_cpu_select_kernels(&isa)->pack;
+    uint32_t const pixel_size = ntm_pixel_format_size(encoding->format);
+
+    // [R, G, B][NTM_CPU_BATCH_SIZE]
+    alignas(64) float RGBs[3U * NTM_CPU_BATCH_SIZE];
+
+    for (uint32_t batch_begin = 0U; batch_begin < count; batch_begin += NTM_CPU_BATCH_SIZE)
+    {
+        uint32_t const batch_count = ((count - batch_begin) < NTM_CPU_BATCH_SIZE) ? (count - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+        // the unused lanes replicate the last pixel
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            uint32_t const pixel_index = batch_begin + ((lane_index < batch_count) ? lane_index : (batch_count - 1U));
+            RGBs[lane_index] = in_RGBs[pixel_index][0];
+            RGBs[NTM_CPU_BATCH_SIZE + lane_index] = in_RGBs[pixel_index][1];
+            RGBs[NTM_CPU_BATCH_SIZE * 2U + lane_index] = in_RGBs[pixel_index][2];
+        }
+
+        pack(encoding->format, encoding->linear_to_srgb, batch_count, RGBs, static_cast<uint8_t *>(out_pixels) + static_cast<size_t>(pixel_size) * batch_begin);
+    }
+}
+
+static inline ntm_cpu_kernels const *ntm_cpu_select_kernels(ntm_cpu_isa *inout_isa)
+{
+    ntm_cpu_isa const supported_isa = ntm_cpu_detect_isa();
+    if ((*inout_isa) > supported_isa)
+    {
+        (*inout_isa) = supported_isa;
+    }
+
+    switch (*inout_isa)
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+    case NTM_CPU_ISA_AVX512_VNNI:
+        return &ntm_cpu_kernels_avx512_vnni;
+    case NTM_CPU_ISA_AVX512:
+        return &ntm_cpu_kernels_avx512;
+    case NTM_CPU_ISA_AVX2:
+        return &ntm_cpu_kernels_avx2;
+#endif
+    default:
+        (*inout_isa) = NTM_CPU_ISA_SCALAR;
+        return &ntm_cpu_kernels_scalar;
+    }
+}
+
+// Either the "out_RGBs" or the "encoding" (and the "out_pixels") is used.
+static inline void ntm_cpu_engine_predict_grid_internal(ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, uint32_t grid_x, uint32_t grid_y, uint32_t grid_width, uint32_t grid_height, float (*out_RGBs)[3], ntm_pixel_encoding const *encoding, void *out_pixels, size_t out_row_pitch)
+{
+    ntm_model const *const model = &engine->model;
+    ntm_cpu_dense_kernel const *const dense = ntm_cpu_engine_dense_kernels(engine);
+    // The features of the other axis are zero for all the lanes, and thus the "dense_sparse" kernels merely evaluate the 2F inputs of one axis (instead of the 4F inputs).
+    ntm_cpu_dense_kernel const *const axis_dense = engine->kernels->dense_sparse;
+    ntm_cpu_pack_kernel const pack = engine->kernels->pack;
+    uint32_t const pixel_size = (NULL != encoding) ? ntm_pixel_format_size(encoding->format) : 0U;
+
+    // The durations of the stages are accumulated over the grid, since one batch is too short to be recorded individually.
+    bool const profile = ntm_profiler_is_enabled();
+    uint64_t profile_timestamp = profile ? ntm_profiler_now() : 0U;
+    uint64_t profile_encode_duration = 0U;
+    uint64_t profile_layer_durations[NTM_MAX_LAYERS] = {};
+    uint64_t profile_output_duration = 0U;
+
+    // [column batch][neuron][NTM_CPU_BATCH_SIZE]
+    alignas(64) float column_vectors[NTM_CPU_GRID_COLUMNS / NTM_CPU_BATCH_SIZE][NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+
+    // The vectors of the rows are evaluated by the 1st column chunk and reused by the other column chunks.
+    // The grid of merely one column chunk (e.g. the tile) does NOT need the cache, and the vectors are evaluated for each chunk if the allocation fails.
+    uint32_t const num_row_batches = (grid_height + NTM_CPU_BATCH_SIZE - 1U) / NTM_CPU_BATCH_SIZE;
+    ntm_cpu_grid_row_vectors *const cached_row_vectors = (grid_width > NTM_CPU_GRID_COLUMNS) ? new (std::nothrow) ntm_cpu_grid_row_vectors[num_row_batches] : NULL;
+    ntm_cpu_grid_row_vectors uncached_row_vectors;
+
+    // ping-pong
+    alignas(64) float activations[2][NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+
+    // the footprint of the pixel is the texel of the texture
+    ntm_cpu_lod_layer lod_layer;
+    bool const lod = ntm_cpu_engine_init_lod_layer(engine, 1.0F / static_cast<float>(texture_width), 1.0F / static_cast<float>(texture_height), activations, &lod_layer);
+
+    ntm_layer const *const first_layer = lod ? (&lod_layer.layer) : (&model->layers[0]);
+    uint32_t const num_frequencies = lod ? lod_layer.num_frequencies : model->num_frequencies;
+    uint32_t const first_layer_output_size = first_layer->output_size;
+    bool const first_layer_relu = (model->num_layers > 1U);
+
+    // The biases of the 1st layer are merely added to the vectors of the columns.
+    static float const zero_biases[NTM_MAX_LAYER_WIDTH] = {};
+    ntm_layer row_layer = (*first_layer);
+    row_layer.biases = zero_biases;
+
+    for (uint32_t columns_begin = 0U; columns_begin < grid_width; columns_begin += NTM_CPU_GRID_COLUMNS)
+    {
+        uint32_t const columns_count = ((grid_width - columns_begin) < NTM_CPU_GRID_COLUMNS) ? (grid_width - columns_begin) : NTM_CPU_GRID_COLUMNS;
+        uint32_t const num_column_batches = (columns_count + NTM_CPU_BATCH_SIZE - 1U) / NTM_CPU_BATCH_SIZE;
+
+        // W_u * enc(u) + biases
+        for (uint32_t column_batch_index = 0U; column_batch_index < num_column_batches; ++column_batch_index)
+        {
+            uint32_t const column_batch_begin = columns_begin + NTM_CPU_BATCH_SIZE * column_batch_index;
+            uint32_t const column_batch_count = ((grid_width - column_batch_begin) < NTM_CPU_BATCH_SIZE) ? (grid_width - column_batch_begin) : NTM_CPU_BATCH_SIZE;
+
+            float Us[NTM_CPU_BATCH_SIZE];
+            for (uint32_t lane_index = 0U; lane_index < column_batch_count; ++lane_index)
+            {
+                // the same as the "generate_UVs"
+                Us[lane_index] = (static_cast<float>(grid_x + column_batch_begin + lane_index) + 0.5F) / static_cast<float>(texture_width);
+            }
+
+            ntm_cpu_positional_encoding_axis(engine->kernels->encode, num_frequencies, 0U, column_batch_count, Us, activations[0]);
+            if (lod)
+            {
+                ntm_cpu_lod_attenuate(&lod_layer, activations[0]);
+            }
+            ntm_cpu_profiler_lap(profile, &profile_timestamp, &profile_encode_duration);
+
+            axis_dense[first_layer->coefficient_type](first_layer, false, activations[0], column_vectors[column_batch_index]);
+            ntm_cpu_profiler_lap(profile, &profile_timestamp, &profile_layer_durations[0]);
+        }
+
+        for (uint32_t rows_begin = 0U; rows_begin < grid_height; rows_begin += NTM_CPU_BATCH_SIZE)
+        {
+            uint32_t const rows_count = ((grid_height - rows_begin) < NTM_CPU_BATCH_SIZE) ? (grid_height - rows_begin) : NTM_CPU_BATCH_SIZE;
+
+            // W_v * enc(v)
+            float *const row_vectors = ((NULL != cached_row_vectors) ? cached_row_vectors[rows_begin / NTM_CPU_BATCH_SIZE].values : uncached_row_vectors.values);
+            if ((NULL == cached_row_vectors) || (0U == columns_begin))
+            {
+                float Vs[NTM_CPU_BATCH_SIZE];
+                for (uint32_t lane_index = 0U; lane_index < rows_count; ++lane_index)
+                {
+                    Vs[lane_index] = (static_cast<float>(grid_y + rows_begin + lane_index) + 0.5F) / static_cast<float>(texture_height);
+                }
+
+                ntm_cpu_positional_encoding_axis(engine->kernels->encode, num_frequencies, 1U, rows_count, Vs, activations[0]);
+                if (lod)
+                {
+                    ntm_cpu_lod_attenuate(&lod_layer, activations[0]);
+                }
+                ntm_cpu_profiler_lap(profile, &profile_timestamp, &profile_encode_duration);
+
+                axis_dense[row_layer.coefficient_type](&row_layer, false, activations[0], row_vectors);
+                ntm_cpu_profiler_lap(profile, &profile_timestamp, &profile_layer_durations[0]);
+            }
+
+            for (uint32_t row_index = 0U; row_index < rows_count; ++row_index)
+            {
+                // the local copy of the vector of this row, such that the vector add below is NOT aliased with the "activations"
+                float row_values[NTM_MAX_LAYER_WIDTH];
+                for (uint32_t neuron_index = 0U; neuron_index < first_layer_output_size; ++neuron_index)
+                {
+                    row_values[neuron_index] = row_vectors[NTM_CPU_BATCH_SIZE * neuron_index + row_index];
+                }
+
+                for (uint32_t column_batch_index = 0U; column_batch_index < num_column_batches; ++column_batch_index)
+                {
+                    uint32_t const column_batch_begin = columns_begin + NTM_CPU_BATCH_SIZE * column_batch_index;
+                    uint32_t const column_batch_count = ((grid_width - column_batch_begin) < NTM_CPU_BATCH_SIZE) ? (grid_width - column_batch_begin) : NTM_CPU_BATCH_SIZE;
+
+                    float const *const column_vector = column_vectors[column_batch_index];
+                    for (uint32_t neuron_index = 0U; neuron_index < first_layer_output_size; ++neuron_index)
+                    {
+                        float const row_value = row_values[neuron_index];
+                        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+                        {
+                            float const value = column_vector[NTM_CPU_BATCH_SIZE * neuron_index + lane_index] + row_value;
+                            activations[1][NTM_CPU_BATCH_SIZE * neuron_index + lane_index] = (first_layer_relu && (value < 0.0F)) ? 0.0F : value;
+                        }
+                    }
+                    ntm_cpu_profiler_lap(profile, &profile_timestamp, &profile_layer_durations[0]);
+
+                    uint32_t activation_index = 1U;
+                    for (uint32_t layer_index = 1U; layer_index < model->num_layers; ++layer_index)
+                    {
+                        bool const relu = ((layer_index + 1U) < model->num_layers);
+                        dense[model->layers[layer_index].coefficient_type](&model->layers[layer_index], relu, activations[activation_index], activations[activation_index ^ 1U]);
+                        activation_index ^= 1U;
+                        ntm_cpu_profiler_lap(profile, &profile_timestamp, &profile_layer_durations[layer_index]);
+                    }
+
+                    if (NULL != out_RGBs)
+                    {
+                        float(*const out_row_RGBs)[3] = out_RGBs + (static_cast<size_t>(grid_width) * (rows_begin + row_index) + column_batch_begin);
+                        for (uint32_t lane_index = 0U; lane_index < column_batch_count; ++lane_index)
+                        {
+                            out_row_RGBs[lane_index][0] = activations[activation_index][lane_index];
+                            out_row_RGBs[lane_index][1] = activations[activation_index][NTM_CPU_BATCH_SIZE + lane_index];
+                            out_row_RGBs[lane_index][2] = activations[activation_index][NTM_CPU_BATCH_SIZE * 2U + lane_index];
+                        }
+                    }
+                    else
+                    {
+                        // the output stage is fused: the activations of the last layer are packed into the destination directly
+                        uint8_t *const out_row_pixels = static_cast<uint8_t *>(out_pixels) + (out_row_pitch * (rows_begin + row_index) + static_cast<size_t>(pixel_size) * column_batch_begin);
+                        pack(encoding->format, encoding->linear_to_srgb, column_batch_count, activations[activation_index], out_row_pixels);
+                    }
+                    ntm_cpu_profiler_lap(profile, &profile_timestamp, &profile_output_duration);
+                }
+            }
+        }
+    }
+
+    delete[] cached_row_vectors;
+
+    if (profile)
+    {
+        ntm_profiler_record_duration(NTM_PROFILER_STAGE_ENCODE, profile_encode_duration);
+        for (uint32_t layer_index = 0U; layer_index < model->num_layers; ++layer_index)
+        {
+            ntm_profiler_record_duration(static_cast<ntm_profiler_stage>(NTM_PROFILER_STAGE_LAYER_0 + layer_index), profile_layer_durations[layer_index]);
+        }
+        ntm_profiler_record_duration(NTM_PROFILER_STAGE_OUTPUT, profile_output_duration);
+    }
+}
+
+extern void ntm_cpu_engine_measure_encoding_error(ntm_cpu_engine const *engine, uint32_t count, float const (*in_UVs)[2], float out_max_errors[NTM_MAX_FREQUENCIES])
+{
+    uint32_t const num_frequencies = engine->model.num_frequencies;
+
+    for (uint32_t frequency_index = 0U; frequency_index < NTM_MAX_FREQUENCIES; ++frequency_index)
+    {
+        out_max_errors[frequency_index] = 0.0F;
+    }
+
+    alignas(64) float features[4U * NTM_MAX_FREQUENCIES * NTM_CPU_BATCH_SIZE];
+
+    for (uint32_t batch_begin = 0U; batch_begin < count; batch_begin += NTM_CPU_BATCH_SIZE)
+    {
+        uint32_t const batch_count = ((count - batch_begin) < NTM_CPU_BATCH_SIZE) ? (count - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+        engine->kernels->encode(num_frequencies, batch_count, in_UVs + batch_begin, features);
+
+        for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+        {
+            for (uint32_t frequency_index = 0U; frequency_index < num_frequencies; ++frequency_index)
+            {
+                float const frequency = static_cast<float>(1U << frequency_index) * NTM_PI;
+
+                for (uint32_t axis = 0U; axis < 2U; ++axis)
+                {
+                    double const argument = static_cast<double>(frequency * in_UVs[batch_begin + lane_index][axis]);
+
+                    double const sin_error = fabs(static_cast<double>(features[NTM_CPU_BATCH_SIZE * (4U * frequency_index + axis) + lane_index]) - sin(argument));
+                    double const cos_error = fabs(static_cast<double>(features[NTM_CPU_BATCH_SIZE * (4U * frequency_index + 2U + axis) + lane_index]) - cos(argument));
+
+                    float const error = static_cast<float>((sin_error > cos_error) ? sin_error : cos_error);
+                    if (error > out_max_errors[frequency_index])
+                    {
+                        out_max_errors[frequency_index] = error;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// The "lod_layer" is optional (NULL: the 1st layer of the model).
+extern void ntm_cpu_engine_measure_sparsity(ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, ntm_cpu_sparsity_statistics *out_statistics)
+{
+    ntm_model const *const model = &engine->model;
+    ntm_cpu_dense_kernel const *const dense = ntm_cpu_engine_dense_kernels(engine);
+
+    out_statistics->num_layers = model->num_layers - 1U;
+    out_statistics->num_pixels = static_cast<uint64_t>(texture_width) * texture_height;
+    out_statistics->num_batches = 0U;
+    for (uint32_t layer_index = 0U; layer_index < NTM_MAX_LAYERS; ++layer_index)
+    {
+        out_statistics->layer_sizes[layer_index] = (layer_index < out_statistics->num_layers) ? model->layers[layer_index].output_size : 0U;
+        for (uint32_t neuron_index = 0U; neuron_index < NTM_MAX_LAYER_WIDTH; ++neuron_index)
+        {
+            out_statistics->zero_pixels[layer_index][neuron_index] = 0U;
+            out_statistics->zero_batches[layer_index][neuron_index] = 0U;
+        }
+    }
+
+    // ping-pong
+    alignas(64) float activations[2][NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+
+    for (uint32_t y = 0U; y < texture_height; ++y)
+    {
+        for (uint32_t batch_begin = 0U; batch_begin < texture_width; batch_begin += NTM_CPU_BATCH_SIZE)
+        {
+            uint32_t const batch_count = ((texture_width - batch_begin) < NTM_CPU_BATCH_SIZE) ? (texture_width - batch_begin) : NTM_CPU_BATCH_SIZE;
+
+            float UVs[NTM_CPU_BATCH_SIZE][2];
+            for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+            {
+                // the same as the "generate_UVs"
+                UVs[lane_index][0] = (static_cast<float>(batch_begin + lane_index) + 0.5F) / static_cast<float>(texture_width);
+                UVs[lane_index][1] = (static_cast<float>(y) + 0.5F) / static_cast<float>(texture_height);
+            }
+
+            engine->kernels->encode(model->num_frequencies, batch_count, UVs, activations[0]);
+
+            uint32_t activation_index = 0U;
+            for (uint32_t layer_index = 0U; layer_index < out_statistics->num_layers; ++layer_index)
+            {
+                ntm_layer const *const layer = &model->layers[layer_index];
+                dense[layer->coefficient_type](layer, true, activations[activation_index], activations[activation_index ^ 1U]);
+                activation_index ^= 1U;
+
+                // the unused lanes replicate the last pixel and thus are NOT counted
+                for (uint32_t neuron_index = 0U; neuron_index < layer->output_size; ++neuron_index)
+                {
+                    uint32_t num_zero_lanes = 0U;
+                    for (uint32_t lane_index = 0U; lane_index < batch_count; ++lane_index)
+                    {
+                        num_zero_lanes += (0.0F == activations[activation_index][NTM_CPU_BATCH_SIZE * neuron_index + lane_index]) ? 1U : 0U;
+                    }
+
+                    out_statistics->zero_pixels[layer_index][neuron_index] += num_zero_lanes;
+                    out_statistics->zero_batches[layer_index][neuron_index] += (batch_count == num_zero_lanes) ? 1U : 0U;
+                }
+            }
+
+            ++out_statistics->num_batches;
+        }
+    }
+}
+
+static inline float const *ntm_cpu_engine_predict_batch(ntm_cpu_engine const *engine, ntm_cpu_lod_layer const *lod_layer, uint32_t batch_count, float const (*in_UVs)[2], float (*activations)[NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE])
+{
+    ntm_model const *const model = &engine->model;
+    ntm_cpu_dense_kernel const *const dense = ntm_cpu_engine_dense_kernels(engine);
+
+    if (NULL != lod_layer)
+    {
+        engine->kernels->encode(lod_layer->num_frequencies, batch_count, in_UVs, activations[0]);
+        ntm_cpu_lod_attenuate(lod_layer, activations[0]);
+    }
+    else
+    {
+        engine->kernels->encode(model->num_frequencies, batch_count, in_UVs, activations[0]);
+    }
+
+    uint32_t activation_index = 0U;
+    for (uint32_t layer_index = 0U; layer_index < model->num_layers; ++layer_index)
+    {
+        bool const relu = ((layer_index + 1U) < model->num_layers);
+        ntm_layer const *const layer = ((0U == layer_index) && (NULL != lod_layer)) ? (&lod_layer->layer) : (&model->layers[layer_index]);
+        dense[layer->coefficient_type](layer, relu, activations[activation_index], activations[activation_index ^ 1U]);
+        activation_index ^= 1U;
+    }
+
+    // [R, G, B][NTM_CPU_BATCH_SIZE]
+    return activations[activation_index];
+}
+
+// The number of the frequencies which are NOT dropped, and the "out_attenuations" of the dropped frequencies are zero.
+static inline uint32_t ntm_cpu_engine_lod_attenuations(ntm_cpu_engine const *engine, float footprint_u, float footprint_v, float (*out_attenuations)[2])
+{
+    uint32_t const model_num_frequencies = engine->model.num_frequencies;
+
+    if ((0U == engine->lod_base_width) || (0U == engine->lod_base_height))
+    {
+        for (uint32_t frequency_index = 0U; frequency_index < model_num_frequencies; ++frequency_index)
+        {
+            out_attenuations[frequency_index][0] = 1.0F;
+            out_attenuations[frequency_index][1] = 1.0F;
+        }
+        return model_num_frequencies;
+    }
+
+    // the variance of the box filter of the footprint minus the variance of the box filter of the base texel
+    double variances[2];
+    for (uint32_t axis = 0U; axis < 2U; ++axis)
+    {
+        double const footprint = fabs(static_cast<double>((0U == axis) ? footprint_u : footprint_v));
+        double const base_footprint = 1.0 / static_cast<double>((0U == axis) ? engine->lod_base_width : engine->lod_base_height);
+        double const variance = (footprint * footprint - base_footprint * base_footprint) / 12.0;
+        variances[axis] = (variance > 0.0) ? variance : 0.0;
+    }
+
+    // the attenuation decreases with the frequency, and thus the frequencies which are NOT dropped are always the prefix
+    // NOTE: the frequency 0 is never dropped
+    uint32_t num_frequencies = 0U;
+    for (uint32_t frequency_index = 0U; frequency_index < model_num_frequencies; ++frequency_index)
+    {
+        double const frequency = static_cast<double>(1U << frequency_index) * static_cast<double>(NTM_PI);
+
+        double attenuations[2];
+        for (uint32_t axis = 0U; axis < 2U; ++axis)
+        {
+            attenuations[axis] = exp(-0.5 * frequency * frequency * variances[axis]);
+        }
+
+        if ((0U == frequency_index) || (attenuations[0] >= NTM_CPU_LOD_DROP_THRESHOLD) || (attenuations[1] >= NTM_CPU_LOD_DROP_THRESHOLD))
+        {
+            out_attenuations[frequency_index][0] = static_cast<float>(attenuations[0]);
+            out_attenuations[frequency_index][1] = static_cast<float>(attenuations[1]);
+            num_frequencies = frequency_index + 1U;
+        }
+        else
+        {
+            out_attenuations[frequency_index][0] = 0.0F;
+            out_attenuations[frequency_index][1] = 0.0F;
+        }
+    }
+
+    return num_frequencies;
+}
+
+// false: nothing is attenuated (e.g. the LOD is disabled, or the footprint is NOT larger than the base texel), and the 1st layer of the model should be used instead.
+static inline bool ntm_cpu_engine_init_lod_layer(ntm_cpu_engine const *engine, float footprint_u, float footprint_v, float (*scratch_activations)[NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE], ntm_cpu_lod_layer *out_lod_layer)
+{
+    ntm_model const *const model = &engine->model;
+    ntm_layer const *const first_layer = &model->layers[0];
+
+    out_lod_layer->num_frequencies = ntm_cpu_engine_lod_attenuations(engine, footprint_u, footprint_v, out_lod_layer->attenuations);
+
+    bool attenuated = false;
+    for (uint32_t frequency_index = 0U; frequency_index < model->num_frequencies; ++frequency_index)
+    {
+        if ((out_lod_layer->attenuations[frequency_index][0] < 1.0F) || (out_lod_layer->attenuations[frequency_index][1] < 1.0F))
+        {
+            attenuated = true;
+        }
+    }
+
+    if (!attenuated)
+    {
+        return false;
+    }
+
+    // the INT8 is NOT allowed for the 1st layer, and thus the prefix of the rows of the weights is exactly the columns of the frequencies which are NOT dropped
+    assert(NTM_COEFFICIENT_TYPE_INT8 != first_layer->coefficient_type);
+
+    // "W * ((1 - a) * mean)" is evaluated by the dense kernel itself (with zero biases), and thus there is no conversion of the FP16 weights here.
+    static float const zero_biases[NTM_MAX_LAYER_WIDTH] = {};
+    ntm_layer mean_layer = (*first_layer);
+    mean_layer.biases = zero_biases;
+
+    for (uint32_t frequency_index = 0U; frequency_index < model->num_frequencies; ++frequency_index)
+    {
+        for (uint32_t feature_index = 0U; feature_index < 4U; ++feature_index)
+        {
+            uint32_t const axis = feature_index & 1U;
+            float const mean = (1.0F - out_lod_layer->attenuations[frequency_index][axis]) * engine->lod_feature_means[4U * frequency_index + feature_index];
+            for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+            {
+                scratch_activations[0][NTM_CPU_BATCH_SIZE * (4U * frequency_index + feature_index) + lane_index] = mean;
+            }
+        }
+    }
+
+    ntm_cpu_engine_dense_kernels(engine)[mean_layer.coefficient_type](&mean_layer, false, scratch_activations[0], scratch_activations[1]);
+
+    for (uint32_t neuron_index = 0U; neuron_index < first_layer->output_size; ++neuron_index)
+    {
+        out_lod_layer->lod_biases[neuron_index] = first_layer->biases[neuron_index] + scratch_activations[1][NTM_CPU_BATCH_SIZE * neuron_index];
+    }
+
+    out_lod_layer->layer = (*first_layer);
+    out_lod_layer->layer.input_size = 4U * out_lod_layer->num_frequencies;
+    out_lod_layer->layer.biases = out_lod_layer->lod_biases;
+    return true;
+}
+
+// [4 * num_frequencies][NTM_CPU_BATCH_SIZE]: "a * feature" (the "(1 - a) * mean" is in the biases)
+static inline void ntm_cpu_lod_attenuate(ntm_cpu_lod_layer const *lod_layer, float *inout_features)
+{
+    for (uint32_t frequency_index = 0U; frequency_index < lod_layer->num_frequencies; ++frequency_index)
+    {
+        for (uint32_t feature_index = 0U; feature_index < 4U; ++feature_index)
+        {
+            float const attenuation = lod_layer->attenuations[frequency_index][feature_index & 1U];
+            for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+            {
+                inout_features[NTM_CPU_BATCH_SIZE * (4U * frequency_index + feature_index) + lane_index] *= attenuation;
+            }
+        }
+    }
+}
+
+static inline void ntm_cpu_positional_encoding_axis(ntm_cpu_encode_kernel encode, uint32_t num_frequencies, uint32_t axis, uint32_t count, float const *in_coordinates, float *out_features)
+{
+    assert(count >= 1U && count <= NTM_CPU_BATCH_SIZE);
+    assert(axis <= 1U);
+
+    float UVs[NTM_CPU_BATCH_SIZE][2];
+    for (uint32_t lane_index = 0U; lane_index < count; ++lane_index)
+    {
+        UVs[lane_index][axis] = in_coordinates[lane_index];
+        UVs[lane_index][axis ^ 1U] = 0.0F;
+    }
+
+    encode(num_frequencies, count, UVs, out_features);
+
+    // The features of the other axis are zero, and thus the dense kernel merely accumulates the weights of this axis.
+    for (uint32_t frequency_index = 0U; frequency_index < num_frequencies; ++frequency_index)
+    {
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            out_features[NTM_CPU_BATCH_SIZE * (4U * frequency_index + (axis ^ 1U)) + lane_index] = 0.0F;
+            out_features[NTM_CPU_BATCH_SIZE * (4U * frequency_index + 2U + (axis ^ 1U)) + lane_index] = 0.0F;
+        }
+    }
+}
+
+static inline ntm_cpu_dense_kernel const *ntm_cpu_engine_dense_kernels(ntm_cpu_engine const *engine)
+{
+    return engine->sparse ? engine->kernels->dense_sparse : engine->kernels->dense;
+}
+
+static inline void ntm_cpu_profiler_lap(bool profile, uint64_t *inout_timestamp, uint64_t *inout_duration)
+{
+    if (profile)
+    {
+        uint64_t const timestamp = ntm_profiler_now();
+        (*inout_duration) += (timestamp - (*inout_timestamp));
+        (*inout_timestamp) = timestamp;
+    }
+}
@@ -0,0 +1,154 @@
+#ifndef _NTM_CPU_INFERENCE_H_
+#define _NTM_CPU_INFERENCE_H_ 1
+
+#include "ntm-model.h"
+
+enum ntm_cpu_isa
+{
+    NTM_CPU_ISA_SCALAR = 0,
+    NTM_CPU_ISA_AVX2 = 1,
+    NTM_CPU_ISA_AVX512 = 2,
+    // the same as the AVX512 except that the INT8 layers use the "vpdpbusd"
+    NTM_CPU_ISA_AVX512_VNNI = 3
+};
+
+// The maximum absolute difference (before clamping) between the RGB predicted by the "ntm_cpu_engine" and the RGB predicted by the TFLite interpreter (without any delegate).
+// Namely, the 8-bit outputs differ by at most 1.
+// NOTE: this merely applies to the FP32 coefficients, and the FP16 / INT8 coefficients are measured by the PSNR instead.
+static constexpr float const NTM_CPU_TOLERANCE = 1.0F / 255.0F;
+
+// The UV outside [0, 1] is addressed before the inference, which is the same as the sampler of the GPU.
+enum ntm_address_mode
+{
+    // the fractional part, the same as the "D3D12_TEXTURE_ADDRESS_MODE_WRAP" / "VK_SAMPLER_ADDRESS_MODE_REPEAT"
+    NTM_ADDRESS_MODE_WRAP = 0,
+    // clamped to [0, 1], the same as the "D3D12_TEXTURE_ADDRESS_MODE_CLAMP" / "VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE"
+    NTM_ADDRESS_MODE_CLAMP = 1
+};
+
+struct ntm_sampler
+{
+    ntm_address_mode address_mode_u;
+    ntm_address_mode address_mode_v;
+};
+
+// The pixel formats of the "ntm_cpu_engine_predict_grid_pixels" and the "ntm_cpu_pack_pixels".
+// The RGB is clamped to [0, 1], and the UNORM is rounded to the nearest.
+enum ntm_pixel_format
+{
+    // uint8_t [4]: B, G, R, A = 255 (the same as the "store_bit_RGBs")
+    NTM_PIXEL_FORMAT_B8G8R8A8_UNORM = 0,
+    // uint8_t [4]: R, G, B, A = 255
+    NTM_PIXEL_FORMAT_R8G8B8A8_UNORM = 1,
+    // uint32_t: R (bits 0-9), G (bits 10-19), B (bits 20-29), A = 3 (bits 30-31), the same as the "DXGI_FORMAT_R10G10B10A2_UNORM" / "VK_FORMAT_A2B10G10R10_UNORM_PACK32"
+    NTM_PIXEL_FORMAT_R10G10B10A2_UNORM = 2,
+    // uint16_t [4] (IEEE half): R, G, B, A = 1.0
+    NTM_PIXEL_FORMAT_R16G16B16A16_SFLOAT = 3
+};
+
+struct ntm_pixel_encoding
+{
+    ntm_pixel_format format;
+    // the RGB is encoded by the sRGB transfer function (after clamping), namely, the network predicts the linear RGB while the pixel is sRGB
+    bool linear_to_srgb;
+};
+
+// The size (in bytes) of one pixel
+extern uint32_t ntm_pixel_format_size(ntm_pixel_format format);
+
+struct ntm_cpu_kernels;
+
+// The "ntm_cpu_engine" merely references the coefficients of the "ntm_model" and never copies them.
+struct ntm_cpu_engine
+{
+    ntm_model model;
+    ntm_cpu_isa isa;
+    ntm_cpu_kernels const *kernels;
+    // 0: the LOD is disabled (see the "ntm_cpu_engine_enable_lod")
+    uint32_t lod_base_width;
+    uint32_t lod_base_height;
+    // the mean of each feature of the positional encoding over the texel centers of the base resolution
+    float lod_feature_means[4U * NTM_MAX_FREQUENCIES];
+    // the "dense_sparse" kernels are used (see the "ntm_cpu_engine_enable_sparsity")
+    bool sparse;
+};
+
+// The statistics of the outputs of each layer with the "relu" (namely, all the layers except the last one) over the texel centers of the texture.
+// The batches are the same as the grid path, namely, NTM_CPU_BATCH_SIZE consecutive texels of one row.
+struct ntm_cpu_sparsity_statistics
+{
+    uint32_t num_layers;
+    uint32_t layer_sizes[NTM_MAX_LAYERS];
+    uint64_t num_pixels;
+    uint64_t num_batches;
+    // [layer][neuron]: the number of the pixels of which the output is zero
+    uint64_t zero_pixels[NTM_MAX_LAYERS][NTM_MAX_LAYER_WIDTH];
+    // [layer][neuron]: the number of the batches of which the output is zero for all the pixels, namely, the rows of the weights of the next layer which are skipped by the "dense_sparse" kernels
+    uint64_t zero_batches[NTM_MAX_LAYERS][NTM_MAX_LAYER_WIDTH];
+};
+
+extern ntm_cpu_isa ntm_cpu_detect_isa();
+
+extern char const *ntm_cpu_isa_name(ntm_cpu_isa isa);
+
+// The "isa" is downgraded to the best ISA supported by the current CPU.
+extern void ntm_cpu_engine_init(ntm_cpu_engine *out_engine, ntm_model const *model, ntm_cpu_isa isa);
+
+// The LOD is disabled by default, namely, every decode evaluates all the frequencies of the positional encoding.
+// The "base_width" / "base_height" is the resolution at which the network was trained (e.g. the 512x512 of the "target.png"), and the footprint (the size of one pixel in UV) larger than the texel of the base resolution is band-limited:
+// Each feature of the frequency "w = 2^i * pi" is attenuated to "a * feature + (1 - a) * mean" where "a = exp(-0.5 * w^2 * sigma^2)" is the response of the Gaussian of which the variance is the same as the box filter of the footprint (minus the box filter of the base texel), namely, the same as the box filter of the mip chain.
+// Since the attenuation is linear, it is folded into the 1st layer: the "(1 - a) * mean" is merely added to the biases, and the frequencies of which "a < 1 / 256" (both U and V) are dropped, namely, the encoding and the columns of the 1st layer of these frequencies are skipped entirely.
+// The footprint which is NOT larger than the base texel (e.g. the level 0) is NOT changed at all.
+extern void ntm_cpu_engine_enable_lod(ntm_cpu_engine *engine, uint32_t base_width, uint32_t base_height);
+
+// The number of the frequencies which are evaluated for the footprint (e.g. "1 / mip width" and "1 / mip height").
+extern uint32_t ntm_cpu_engine_lod_num_frequencies(ntm_cpu_engine const *engine, float footprint_u, float footprint_v);
+
+// The sparsity is disabled by default.
+// The inputs of each layer which are zero for all the pixels of the batch (e.g. the ReLU outputs of the dead neurons, or the features of the other axis of the grid path) are skipped, namely, neither the weights nor the activations of these inputs are loaded.
+// The outputs are the same, and merely the INT8 layers are NOT affected (the inputs are quantized in groups of 4).
+extern void ntm_cpu_engine_enable_sparsity(ntm_cpu_engine *engine);
+
+// The "ntm_cpu_engine" is immutable after initialization, and the scratch memory is on the stack of the calling thread.
+// Thus, it is safe to call this function from multiple threads concurrently.
+extern void ntm_cpu_engine_predict(ntm_cpu_engine const *engine, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3]);
+
+// Random access (e.g. the texture fetch of the software rasterizer or the path tracer).
+// The queries are evaluated NTM_CPU_BATCH_SIZE at once (one query for each SIMD lane), and there is neither allocation nor any other per call cost.
+// It is safe to call these functions from multiple threads concurrently.
+extern void ntm_cpu_engine_sample(ntm_cpu_engine const *engine, ntm_sampler const *sampler, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3]);
+
+// The same as the "ntm_cpu_engine_sample" except that the UVs and the RGBs are SoA.
+extern void ntm_cpu_engine_sample_soa(ntm_cpu_engine const *engine, ntm_sampler const *sampler, uint32_t count, float const *in_Us, float const *in_Vs, float *out_Rs, float *out_Gs, float *out_Bs);
+
+// The same as the "ntm_cpu_engine_sample" except that the queries are band-limited by the footprint (e.g. the UV derivatives, or "1 / mip width" and "1 / mip height").
+// The footprint is shared by all the queries of one call, and thus the queries should be grouped by the footprint (e.g. by the mip level).
+extern void ntm_cpu_engine_sample_lod(ntm_cpu_engine const *engine, ntm_sampler const *sampler, float footprint_u, float footprint_v, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3]);
+
+// The coordinate (U or V) addressed by the "ntm_cpu_engine_sample", namely, in [0, 1].
+extern float ntm_cpu_address(ntm_address_mode address_mode, float coordinate);
+
+// The UV of the pixel (x, y) of the grid is ((grid_x + x + 0.5) / texture_width, (grid_y + y + 0.5) / texture_height), namely, the texel centers of the texture.
+// Since U merely depends on the column and V merely depends on the row, the pre-activation of the 1st layer is the sum of the vector of the column and the vector of the row.
+// Thus, there is no sin/cos for each pixel, and the 1st layer (merely the 2F inputs of one axis) is evaluated once for each column and once for each row plus one vector add for each pixel.
+// When the LOD is enabled, the texture smaller than the base resolution (e.g. the mip level) is band-limited by the footprint "(1 / texture_width, 1 / texture_height)", namely, the mip chain is prefiltered directly at the resolution of each level.
+// The "out_RGBs" is [grid_height][grid_width]. It is safe to call this function from multiple threads concurrently.
+extern void ntm_cpu_engine_predict_grid(ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, uint32_t grid_x, uint32_t grid_y, uint32_t grid_width, uint32_t grid_height, float (*out_RGBs)[3]);
+
+// The same as the "ntm_cpu_engine_predict_grid" except that the output stage (clamp, optional sRGB encoding, rounding and packing) is fused into the last layer, and thus there is no intermediate float RGB.
+// The pixel (x, y) of the grid is written to "out_pixels + out_row_pitch * y + ntm_pixel_format_size(format) * x", namely, the "out_pixels" can be the (sub-rectangle of the) destination image directly.
+extern void ntm_cpu_engine_predict_grid_pixels(ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, uint32_t grid_x, uint32_t grid_y, uint32_t grid_width, uint32_t grid_height, ntm_pixel_encoding const *encoding, void *out_pixels, size_t out_row_pitch);
+
+// The same output stage for the RGBs predicted by the other paths (e.g. the TFLite interpreter).
+// The "isa" is downgraded to the best ISA supported by the current CPU.
+extern void ntm_cpu_pack_pixels(ntm_cpu_isa isa, ntm_pixel_encoding const *encoding, uint32_t count, float const (*in_RGBs)[3], void *out_pixels);
+
+// The offline pass for the pruning: the neuron which is zero for all the texel centers of the reference texture (e.g. the 512x512 of the "target.png") is dead, and can be removed from the NTM asset without changing the output at these texel centers.
+// The "zero_batches" predicts the speedup of the "ntm_cpu_engine_enable_sparsity".
+extern void ntm_cpu_engine_measure_sparsity(ntm_cpu_engine const *engine, uint32_t texture_width, uint32_t texture_height, ntm_cpu_sparsity_statistics *out_statistics);
+
+// The SIMD kernels derive the sin/cos of the higher frequencies by the double-angle recurrences instead of evaluating the sin/cos of each frequency.
+// The "out_max_errors" is the maximum absolute difference (of both sin and cos of both U and V) for each frequency between the positional encoding of the "ntm_cpu_engine" and the double precision sin/cos of the same float32 argument.
+extern void ntm_cpu_engine_measure_encoding_error(ntm_cpu_engine const *engine, uint32_t count, float const (*in_UVs)[2], float out_max_errors[NTM_MAX_FREQUENCIES]);
+
+#endif
@@ -0,0 +1,743 @@
+#include "ntm-cpu-kernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+#include <string.h>
+#include <assert.h>
+
+// NOTE: this translation unit is compiled with "-mavx2 -mfma -mf16c" (GCC) or "/arch:AVX2" (MSVC).
+
+static void ntm_cpu_dense_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_fp16_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_int8_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_sparse_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_fp16_sparse_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_encode_avx2(uint32_t num_frequencies, uint32_t count, float const (*in_UVs)[2], float *out_features);
+
+static void ntm_cpu_pack_avx2(ntm_pixel_format format, bool linear_to_srgb, uint32_t count, float const *in_RGBs, void *out_pixels);
+
+static inline void ntm_cpu_dense_block_avx2(uint32_t input_size, float const *weights, size_t weight_stride, float const *biases, bool relu, float const *in_activations, float *out_activations);
+
+static inline void ntm_cpu_dense_single_avx2(uint32_t input_size, float const *weights, size_t weight_stride, float bias, bool relu, float const *in_activations, float *out_activations);
+
+static inline uint32_t ntm_cpu_active_inputs_avx2(uint32_t input_size, float const *in_activations, uint8_t *out_active_inputs);
+
+static inline void ntm_cpu_dense_block_sparse_avx2(uint32_t num_active_inputs, uint8_t const *active_inputs, float const *weights, size_t weight_stride, float const *biases, bool relu, float const *in_activations, float *out_activations);
+
+static inline void ntm_cpu_dense_single_sparse_avx2(uint32_t num_active_inputs, uint8_t const *active_inputs, float const *weights, size_t weight_stride, float bias, bool relu, float const *in_activations, float *out_activations);
+
+static inline __m256i ntm_cpu_broadcast_weight_group_avx2(int8_t const *weight_group);
+
+static inline __m256i ntm_cpu_int8_dot_avx2(__m256i accumulator, __m256i activation_even, __m256i activation_odd, __m256i weight_group);
+
+static inline void ntm_cpu_int8_store_avx2(__m256i accumulator_0, __m256i accumulator_1, __m256 output_range_0, __m256 output_range_1, float scale, float bias, bool relu, float *out_activations);
+
+static inline void ntm_cpu_sincos_avx2(__m256 x, __m256 *out_sin, __m256 *out_cos);
+
+static inline __m256 ntm_cpu_linear_to_srgb_avx2(__m256 x);
+
+static inline void ntm_cpu_store_half_RGBAs_avx2(__m128i half_R, __m128i half_G, __m128i half_B, uint8_t *destination);
+
+extern ntm_cpu_kernels const ntm_cpu_kernels_avx2 = {
+    {ntm_cpu_dense_avx2, ntm_cpu_dense_fp16_avx2, ntm_cpu_dense_int8_avx2},
+    {ntm_cpu_dense_sparse_avx2, ntm_cpu_dense_fp16_sparse_avx2, ntm_cpu_dense_int8_avx2},
+    ntm_cpu_encode_avx2,
+    ntm_cpu_pack_avx2};
+
+static_assert(16U == NTM_CPU_BATCH_SIZE, "one batch is two AVX2 registers");
+
+static void ntm_cpu_dense_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    float const *const weights = static_cast<float const *>(layer->weights);
+    float const *const biases = layer->biases;
+
+    uint32_t output_index = 0U;
+
+    for (; (output_index + 4U) <= output_size; output_index += 4U)
+    {
+        ntm_cpu_dense_block_avx2(input_size, weights + output_index, output_size, biases + output_index, relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+
+    // e.g. the last layer (R, G, B)
+    for (; output_index < output_size; ++output_index)
+    {
+        ntm_cpu_dense_single_avx2(input_size, weights + output_index, output_size, biases[output_index], relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static void ntm_cpu_dense_fp16_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    uint16_t const *const weights = static_cast<uint16_t const *>(layer->weights);
+    float const *const biases = layer->biases;
+
+    // The weights of the 4 neurons are converted (F16C) once for the 16 pixels of the batch.
+    alignas(32) float block_weights[NTM_MAX_LAYER_WIDTH * 4U];
+
+    uint32_t output_index = 0U;
+
+    for (; (output_index + 4U) <= output_size; output_index += 4U)
+    {
+        for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+        {
+            _mm_store_ps(block_weights + 4U * input_index, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(weights + static_cast<size_t>(output_size) * input_index + output_index))));
+        }
+
+        ntm_cpu_dense_block_avx2(input_size, block_weights, 4U, biases + output_index, relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+
+    for (; output_index < output_size; ++output_index)
+    {
+        for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+        {
+            block_weights[input_index] = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(weights[static_cast<size_t>(output_size) * input_index + output_index])));
+        }
+
+        ntm_cpu_dense_single_avx2(input_size, block_weights, 1U, biases[output_index], relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static void ntm_cpu_dense_int8_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    uint32_t const num_input_groups = (input_size + 3U) / 4U;
+    int8_t const *const weights = static_cast<int8_t const *>(layer->weights);
+    float const *const scales = layer->scales;
+    float const *const biases = layer->biases;
+
+    __m256 input_range_0 = _mm256_set1_ps(NTM_CPU_INT8_MIN_RANGE);
+    __m256 input_range_1 = input_range_0;
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        input_range_0 = _mm256_max_ps(input_range_0, _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index));
+        input_range_1 = _mm256_max_ps(input_range_1, _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index + 8U));
+    }
+
+    // [num_input_groups][2][NTM_CPU_BATCH_SIZE] where each int32 is the int16 pair of the inputs (4i, 4i + 2) or (4i + 1, 4i + 3), namely, the operand of the "vpmaddwd"
+    // The int8 weights (4i, 4i + 1, 4i + 2, 4i + 3) are broadcast as one int32, and the even and odd bytes are sign extended to the int16 pairs (4i, 4i + 2) and (4i + 1, 4i + 3) by merely two shifts.
+    alignas(32) int32_t quantized_activations[(NTM_MAX_LAYER_WIDTH / 2U) * NTM_CPU_BATCH_SIZE];
+    {
+        __m256 const input_scale_0 = _mm256_div_ps(_mm256_set1_ps(255.0F), input_range_0);
+        __m256 const input_scale_1 = _mm256_div_ps(_mm256_set1_ps(255.0F), input_range_1);
+
+        for (uint32_t input_group_index = 0U; input_group_index < num_input_groups; ++input_group_index)
+        {
+            __m256i quantized_0[4];
+            __m256i quantized_1[4];
+            for (uint32_t input_subindex = 0U; input_subindex < 4U; ++input_subindex)
+            {
+                uint32_t const input_index = 4U * input_group_index + input_subindex;
+                if (input_index < input_size)
+                {
+                    quantized_0[input_subindex] = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index), input_scale_0));
+                    quantized_1[input_subindex] = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index + 8U), input_scale_1));
+                }
+                else
+                {
+                    quantized_0[input_subindex] = _mm256_setzero_si256();
+                    quantized_1[input_subindex] = _mm256_setzero_si256();
+                }
+            }
+
+            int32_t *const quantized_group = quantized_activations + NTM_CPU_BATCH_SIZE * (2U * input_group_index);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(quantized_group), _mm256_or_si256(quantized_0[0], _mm256_slli_epi32(quantized_0[2], 16)));
+            _mm256_store_si256(reinterpret_cast<__m256i *>(quantized_group + 8U), _mm256_or_si256(quantized_1[0], _mm256_slli_epi32(quantized_1[2], 16)));
+            _mm256_store_si256(reinterpret_cast<__m256i *>(quantized_group + NTM_CPU_BATCH_SIZE), _mm256_or_si256(quantized_0[1], _mm256_slli_epi32(quantized_0[3], 16)));
+            _mm256_store_si256(reinterpret_cast<__m256i *>(quantized_group + NTM_CPU_BATCH_SIZE + 8U), _mm256_or_si256(quantized_1[1], _mm256_slli_epi32(quantized_1[3], 16)));
+        }
+    }
+
+    __m256 const output_range_0 = _mm256_mul_ps(input_range_0, _mm256_set1_ps(1.0F / 255.0F));
+    __m256 const output_range_1 = _mm256_mul_ps(input_range_1, _mm256_set1_ps(1.0F / 255.0F));
+
+    uint32_t output_index = 0U;
+
+    // 4 neurons x 2 registers = 8 accumulators
+    for (; (output_index + 4U) <= output_size; output_index += 4U)
+    {
+        __m256i accumulator_0_0 = _mm256_setzero_si256();
+        __m256i accumulator_0_1 = _mm256_setzero_si256();
+        __m256i accumulator_1_0 = _mm256_setzero_si256();
+        __m256i accumulator_1_1 = _mm256_setzero_si256();
+        __m256i accumulator_2_0 = _mm256_setzero_si256();
+        __m256i accumulator_2_1 = _mm256_setzero_si256();
+        __m256i accumulator_3_0 = _mm256_setzero_si256();
+        __m256i accumulator_3_1 = _mm256_setzero_si256();
+
+        for (uint32_t input_group_index = 0U; input_group_index < num_input_groups; ++input_group_index)
+        {
+            int32_t const *const quantized_group = quantized_activations + NTM_CPU_BATCH_SIZE * (2U * input_group_index);
+            __m256i const activation_even_0 = _mm256_load_si256(reinterpret_cast<__m256i const *>(quantized_group));
+            __m256i const activation_even_1 = _mm256_load_si256(reinterpret_cast<__m256i const *>(quantized_group + 8U));
+            __m256i const activation_odd_0 = _mm256_load_si256(reinterpret_cast<__m256i const *>(quantized_group + NTM_CPU_BATCH_SIZE));
+            __m256i const activation_odd_1 = _mm256_load_si256(reinterpret_cast<__m256i const *>(quantized_group + NTM_CPU_BATCH_SIZE + 8U));
+
+            int8_t const *const weight_groups = weights + 4U * (static_cast<size_t>(output_size) * input_group_index + output_index);
+
+            __m256i const weight_0 = ntm_cpu_broadcast_weight_group_avx2(weight_groups);
+            accumulator_0_0 = ntm_cpu_int8_dot_avx2(accumulator_0_0, activation_even_0, activation_odd_0, weight_0);
+            accumulator_0_1 = ntm_cpu_int8_dot_avx2(accumulator_0_1, activation_even_1, activation_odd_1, weight_0);
+
+            __m256i const weight_1 = ntm_cpu_broadcast_weight_group_avx2(weight_groups + 4U);
+            accumulator_1_0 = ntm_cpu_int8_dot_avx2(accumulator_1_0, activation_even_0, activation_odd_0, weight_1);
+            accumulator_1_1 = ntm_cpu_int8_dot_avx2(accumulator_1_1, activation_even_1, activation_odd_1, weight_1);
+
+            __m256i const weight_2 = ntm_cpu_broadcast_weight_group_avx2(weight_groups + 8U);
+            accumulator_2_0 = ntm_cpu_int8_dot_avx2(accumulator_2_0, activation_even_0, activation_odd_0, weight_2);
+            accumulator_2_1 = ntm_cpu_int8_dot_avx2(accumulator_2_1, activation_even_1, activation_odd_1, weight_2);
+
+            __m256i const weight_3 = ntm_cpu_broadcast_weight_group_avx2(weight_groups + 12U);
+            accumulator_3_0 = ntm_cpu_int8_dot_avx2(accumulator_3_0, activation_even_0, activation_odd_0, weight_3);
+            accumulator_3_1 = ntm_cpu_int8_dot_avx2(accumulator_3_1, activation_even_1, activation_odd_1, weight_3);
+        }
+
+        float *const out_activation = out_activations + NTM_CPU_BATCH_SIZE * output_index;
+        ntm_cpu_int8_store_avx2(accumulator_0_0, accumulator_0_1, output_range_0, output_range_1, scales[output_index], biases[output_index], relu, out_activation);
+        ntm_cpu_int8_store_avx2(accumulator_1_0, accumulator_1_1, output_range_0, output_range_1, scales[output_index + 1U], biases[output_index + 1U], relu, out_activation + NTM_CPU_BATCH_SIZE);
+        ntm_cpu_int8_store_avx2(accumulator_2_0, accumulator_2_1, output_range_0, output_range_1, scales[output_index + 2U], biases[output_index + 2U], relu, out_activation + NTM_CPU_BATCH_SIZE * 2U);
+        ntm_cpu_int8_store_avx2(accumulator_3_0, accumulator_3_1, output_range_0, output_range_1, scales[output_index + 3U], biases[output_index + 3U], relu, out_activation + NTM_CPU_BATCH_SIZE * 3U);
+    }
+
+    // e.g. the last layer (R, G, B)
+    for (; output_index < output_size; ++output_index)
+    {
+        __m256i accumulator_0 = _mm256_setzero_si256();
+        __m256i accumulator_1 = _mm256_setzero_si256();
+
+        for (uint32_t input_group_index = 0U; input_group_index < num_input_groups; ++input_group_index)
+        {
+            int32_t const *const quantized_group = quantized_activations + NTM_CPU_BATCH_SIZE * (2U * input_group_index);
+
+            __m256i const weight = ntm_cpu_broadcast_weight_group_avx2(weights + 4U * (static_cast<size_t>(output_size) * input_group_index + output_index));
+            accumulator_0 = ntm_cpu_int8_dot_avx2(accumulator_0, _mm256_load_si256(reinterpret_cast<__m256i const *>(quantized_group)), _mm256_load_si256(reinterpret_cast<__m256i const *>(quantized_group + NTM_CPU_BATCH_SIZE)), weight);
+            accumulator_1 = ntm_cpu_int8_dot_avx2(accumulator_1, _mm256_load_si256(reinterpret_cast<__m256i const *>(quantized_group + 8U)), _mm256_load_si256(reinterpret_cast<__m256i const *>(quantized_group + NTM_CPU_BATCH_SIZE + 8U)), weight);
+        }
+
+        ntm_cpu_int8_store_avx2(accumulator_0, accumulator_1, output_range_0, output_range_1, scales[output_index], biases[output_index], relu, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static void ntm_cpu_dense_sparse_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    float const *const weights = static_cast<float const *>(layer->weights);
+    float const *const biases = layer->biases;
+
+    uint8_t active_inputs[NTM_MAX_LAYER_WIDTH];
+    uint32_t const num_active_inputs = ntm_cpu_active_inputs_avx2(input_size, in_activations, active_inputs);
+    if (num_active_inputs == input_size)
+    {
+        ntm_cpu_dense_avx2(layer, relu, in_activations, out_activations);
+        return;
+    }
+
+    uint32_t output_index = 0U;
+
+    for (; (output_index + 4U) <= output_size; output_index += 4U)
+    {
+        ntm_cpu_dense_block_sparse_avx2(num_active_inputs, active_inputs, weights + output_index, output_size, biases + output_index, relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+
+    for (; output_index < output_size; ++output_index)
+    {
+        ntm_cpu_dense_single_sparse_avx2(num_active_inputs, active_inputs, weights + output_index, output_size, biases[output_index], relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static void ntm_cpu_dense_fp16_sparse_avx2(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    uint16_t const *const weights = static_cast<uint16_t const *>(layer->weights);
+    float const *const biases = layer->biases;
+
+    uint8_t active_inputs[NTM_MAX_LAYER_WIDTH];
+    uint32_t const num_active_inputs = ntm_cpu_active_inputs_avx2(input_size, in_activations, active_inputs);
+    if (num_active_inputs == input_size)
+    {
+        ntm_cpu_dense_fp16_avx2(layer, relu, in_activations, out_activations);
+        return;
+    }
+
+    // merely the weights of the active inputs are converted (at the same positions as the "ntm_cpu_dense_fp16_avx2")
+    alignas(32) float block_weights[NTM_MAX_LAYER_WIDTH * 4U];
+
+    uint32_t output_index = 0U;
+
+    for (; (output_index + 4U) <= output_size; output_index += 4U)
+    {
+        for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+        {
+            uint32_t const input_index = active_inputs[active_index];
+            _mm_store_ps(block_weights + 4U * input_index, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(weights + static_cast<size_t>(output_size) * input_index + output_index))));
+        }
+
+        ntm_cpu_dense_block_sparse_avx2(num_active_inputs, active_inputs, block_weights, 4U, biases + output_index, relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+
+    for (; output_index < output_size; ++output_index)
+    {
+        for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+        {
+            uint32_t const input_index = active_inputs[active_index];
+            block_weights[input_index] = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(weights[static_cast<size_t>(output_size) * input_index + output_index])));
+        }
+
+        ntm_cpu_dense_single_sparse_avx2(num_active_inputs, active_inputs, block_weights, 1U, biases[output_index], relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static inline void ntm_cpu_dense_block_avx2(uint32_t input_size, float const *weights, size_t weight_stride, float const *biases, bool relu, float const *in_activations, float *out_activations)
+{
+    __m256 const zero = _mm256_setzero_ps();
+
+    // 4 neurons x 2 registers = 8 accumulators
+    __m256 accumulator_0_0 = _mm256_broadcast_ss(biases);
+    __m256 accumulator_0_1 = accumulator_0_0;
+    __m256 accumulator_1_0 = _mm256_broadcast_ss(biases + 1U);
+    __m256 accumulator_1_1 = accumulator_1_0;
+    __m256 accumulator_2_0 = _mm256_broadcast_ss(biases + 2U);
+    __m256 accumulator_2_1 = accumulator_2_0;
+    __m256 accumulator_3_0 = _mm256_broadcast_ss(biases + 3U);
+    __m256 accumulator_3_1 = accumulator_3_0;
+
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        __m256 const activation_0 = _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+        __m256 const activation_1 = _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index + 8U);
+
+        float const *const weight_row = weights + weight_stride * input_index;
+
+        __m256 const weight_0 = _mm256_broadcast_ss(weight_row);
+        accumulator_0_0 = _mm256_fmadd_ps(weight_0, activation_0, accumulator_0_0);
+        accumulator_0_1 = _mm256_fmadd_ps(weight_0, activation_1, accumulator_0_1);
+
+        __m256 const weight_1 = _mm256_broadcast_ss(weight_row + 1U);
+        accumulator_1_0 = _mm256_fmadd_ps(weight_1, activation_0, accumulator_1_0);
+        accumulator_1_1 = _mm256_fmadd_ps(weight_1, activation_1, accumulator_1_1);
+
+        __m256 const weight_2 = _mm256_broadcast_ss(weight_row + 2U);
+        accumulator_2_0 = _mm256_fmadd_ps(weight_2, activation_0, accumulator_2_0);
+        accumulator_2_1 = _mm256_fmadd_ps(weight_2, activation_1, accumulator_2_1);
+
+        __m256 const weight_3 = _mm256_broadcast_ss(weight_row + 3U);
+        accumulator_3_0 = _mm256_fmadd_ps(weight_3, activation_0, accumulator_3_0);
+        accumulator_3_1 = _mm256_fmadd_ps(weight_3, activation_1, accumulator_3_1);
+    }
+
+    if (relu)
+    {
+        accumulator_0_0 = _mm256_max_ps(accumulator_0_0, zero);
+        accumulator_0_1 = _mm256_max_ps(accumulator_0_1, zero);
+        accumulator_1_0 = _mm256_max_ps(accumulator_1_0, zero);
+        accumulator_1_1 = _mm256_max_ps(accumulator_1_1, zero);
+        accumulator_2_0 = _mm256_max_ps(accumulator_2_0, zero);
+        accumulator_2_1 = _mm256_max_ps(accumulator_2_1, zero);
+        accumulator_3_0 = _mm256_max_ps(accumulator_3_0, zero);
+        accumulator_3_1 = _mm256_max_ps(accumulator_3_1, zero);
+    }
+
+    _mm256_store_ps(out_activations, accumulator_0_0);
+    _mm256_store_ps(out_activations + 8U, accumulator_0_1);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE, accumulator_1_0);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE + 8U, accumulator_1_1);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 2U, accumulator_2_0);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 2U + 8U, accumulator_2_1);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 3U, accumulator_3_0);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 3U + 8U, accumulator_3_1);
+}
+
+static inline void ntm_cpu_dense_single_avx2(uint32_t input_size, float const *weights, size_t weight_stride, float bias, bool relu, float const *in_activations, float *out_activations)
+{
+    __m256 const zero = _mm256_setzero_ps();
+
+    __m256 accumulator_0 = _mm256_set1_ps(bias);
+    __m256 accumulator_1 = accumulator_0;
+
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        __m256 const weight = _mm256_broadcast_ss(weights + weight_stride * input_index);
+        accumulator_0 = _mm256_fmadd_ps(weight, _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index), accumulator_0);
+        accumulator_1 = _mm256_fmadd_ps(weight, _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index + 8U), accumulator_1);
+    }
+
+    if (relu)
+    {
+        accumulator_0 = _mm256_max_ps(accumulator_0, zero);
+        accumulator_1 = _mm256_max_ps(accumulator_1, zero);
+    }
+
+    _mm256_store_ps(out_activations, accumulator_0);
+    _mm256_store_ps(out_activations + 8U, accumulator_1);
+}
+
+static void ntm_cpu_encode_avx2(uint32_t num_frequencies, uint32_t count, float const (*in_UVs)[2], float *out_features)
+{
+    assert(count >= 1U && count <= NTM_CPU_BATCH_SIZE);
+
+    alignas(32) float Us[NTM_CPU_BATCH_SIZE];
+    alignas(32) float Vs[NTM_CPU_BATCH_SIZE];
+    for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+    {
+        // the unused lanes replicate the last pixel
+        uint32_t const pixel_index = (lane_index < count) ? lane_index : (count - 1U);
+        Us[lane_index] = in_UVs[pixel_index][0];
+        Vs[lane_index] = in_UVs[pixel_index][1];
+    }
+
+    for (uint32_t half_index = 0U; half_index < 2U; ++half_index)
+    {
+        __m256 const U = _mm256_load_ps(Us + 8U * half_index);
+        __m256 const V = _mm256_load_ps(Vs + 8U * half_index);
+
+        __m256 sin_U = _mm256_setzero_ps();
+        __m256 sin_V = _mm256_setzero_ps();
+        __m256 cos_U = _mm256_setzero_ps();
+        __m256 cos_V = _mm256_setzero_ps();
+
+        for (uint32_t frequency_index = 0U; frequency_index < num_frequencies; ++frequency_index)
+        {
+            if (0U == (frequency_index % NTM_CPU_ENCODE_RESEED_PERIOD))
+            {
+                // the same argument as the "ntm_cpu_encode_scalar"
+                __m256 const frequency = _mm256_set1_ps(static_cast<float>(1U << frequency_index) * NTM_PI);
+                ntm_cpu_sincos_avx2(_mm256_mul_ps(frequency, U), &sin_U, &cos_U);
+                ntm_cpu_sincos_avx2(_mm256_mul_ps(frequency, V), &sin_V, &cos_V);
+            }
+            else
+            {
+                __m256 const next_sin_U = _mm256_mul_ps(_mm256_add_ps(sin_U, sin_U), cos_U);
+                __m256 const next_sin_V = _mm256_mul_ps(_mm256_add_ps(sin_V, sin_V), cos_V);
+                cos_U = _mm256_mul_ps(_mm256_sub_ps(cos_U, sin_U), _mm256_add_ps(cos_U, sin_U));
+                cos_V = _mm256_mul_ps(_mm256_sub_ps(cos_V, sin_V), _mm256_add_ps(cos_V, sin_V));
+                sin_U = next_sin_U;
+                sin_V = next_sin_V;
+            }
+
+            float *const out_feature = out_features + NTM_CPU_BATCH_SIZE * (4U * frequency_index) + 8U * half_index;
+            _mm256_store_ps(out_feature, sin_U);
+            _mm256_store_ps(out_feature + NTM_CPU_BATCH_SIZE, sin_V);
+            _mm256_store_ps(out_feature + NTM_CPU_BATCH_SIZE * 2U, cos_U);
+            _mm256_store_ps(out_feature + NTM_CPU_BATCH_SIZE * 3U, cos_V);
+        }
+    }
+}
+
+// The indices of the inputs which are NOT zero (neither +0 nor -0) for at least one lane of the batch.
+static inline uint32_t ntm_cpu_active_inputs_avx2(uint32_t input_size, float const *in_activations, uint8_t *out_active_inputs)
+{
+    __m256 const zero = _mm256_setzero_ps();
+
+    uint32_t num_active_inputs = 0U;
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        // NaN is NOT equal to zero, and thus is active
+        __m256 const active_0 = _mm256_cmp_ps(_mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index), zero, _CMP_NEQ_UQ);
+        __m256 const active_1 = _mm256_cmp_ps(_mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index + 8U), zero, _CMP_NEQ_UQ);
+
+        // branchless: the index is always written, but merely counted when active
+        out_active_inputs[num_active_inputs] = static_cast<uint8_t>(input_index);
+        num_active_inputs += (0 != _mm256_movemask_ps(_mm256_or_ps(active_0, active_1))) ? 1U : 0U;
+    }
+    return num_active_inputs;
+}
+
+static inline void ntm_cpu_dense_block_sparse_avx2(uint32_t num_active_inputs, uint8_t const *active_inputs, float const *weights, size_t weight_stride, float const *biases, bool relu, float const *in_activations, float *out_activations)
+{
+    __m256 const zero = _mm256_setzero_ps();
+
+    __m256 accumulator_0_0 = _mm256_broadcast_ss(biases);
+    __m256 accumulator_0_1 = accumulator_0_0;
+    __m256 accumulator_1_0 = _mm256_broadcast_ss(biases + 1U);
+    __m256 accumulator_1_1 = accumulator_1_0;
+    __m256 accumulator_2_0 = _mm256_broadcast_ss(biases + 2U);
+    __m256 accumulator_2_1 = accumulator_2_0;
+    __m256 accumulator_3_0 = _mm256_broadcast_ss(biases + 3U);
+    __m256 accumulator_3_1 = accumulator_3_0;
+
+    for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+    {
+        uint32_t const input_index = active_inputs[active_index];
+
+        __m256 const activation_0 = _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+        __m256 const activation_1 = _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index + 8U);
+
+        float const *const weight_row = weights + weight_stride * input_index;
+
+        __m256 const weight_0 = _mm256_broadcast_ss(weight_row);
+        accumulator_0_0 = _mm256_fmadd_ps(weight_0, activation_0, accumulator_0_0);
+        accumulator_0_1 = _mm256_fmadd_ps(weight_0, activation_1, accumulator_0_1);
+
+        __m256 const weight_1 = _mm256_broadcast_ss(weight_row + 1U);
+        accumulator_1_0 = _mm256_fmadd_ps(weight_1, activation_0, accumulator_1_0);
+        accumulator_1_1 = _mm256_fmadd_ps(weight_1, activation_1, accumulator_1_1);
+
+        __m256 const weight_2 = _mm256_broadcast_ss(weight_row + 2U);
+        accumulator_2_0 = _mm256_fmadd_ps(weight_2, activation_0, accumulator_2_0);
+        accumulator_2_1 = _mm256_fmadd_ps(weight_2, activation_1, accumulator_2_1);
+
+        __m256 const weight_3 = _mm256_broadcast_ss(weight_row + 3U);
+        accumulator_3_0 = _mm256_fmadd_ps(weight_3, activation_0, accumulator_3_0);
+        accumulator_3_1 = _mm256_fmadd_ps(weight_3, activation_1, accumulator_3_1);
+    }
+
+    if (relu)
+    {
+        accumulator_0_0 = _mm256_max_ps(accumulator_0_0, zero);
+        accumulator_0_1 = _mm256_max_ps(accumulator_0_1, zero);
+        accumulator_1_0 = _mm256_max_ps(accumulator_1_0, zero);
+        accumulator_1_1 = _mm256_max_ps(accumulator_1_1, zero);
+        accumulator_2_0 = _mm256_max_ps(accumulator_2_0, zero);
+        accumulator_2_1 = _mm256_max_ps(accumulator_2_1, zero);
+        accumulator_3_0 = _mm256_max_ps(accumulator_3_0, zero);
+        accumulator_3_1 = _mm256_max_ps(accumulator_3_1, zero);
+    }
+
+    _mm256_store_ps(out_activations, accumulator_0_0);
+    _mm256_store_ps(out_activations + 8U, accumulator_0_1);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE, accumulator_1_0);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE + 8U, accumulator_1_1);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 2U, accumulator_2_0);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 2U + 8U, accumulator_2_1);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 3U, accumulator_3_0);
+    _mm256_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 3U + 8U, accumulator_3_1);
+}
+
+static inline void ntm_cpu_dense_single_sparse_avx2(uint32_t num_active_inputs, uint8_t const *active_inputs, float const *weights, size_t weight_stride, float bias, bool relu, float const *in_activations, float *out_activations)
+{
+    __m256 const zero = _mm256_setzero_ps();
+
+    __m256 accumulator_0 = _mm256_set1_ps(bias);
+    __m256 accumulator_1 = accumulator_0;
+
+    for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+    {
+        uint32_t const input_index = active_inputs[active_index];
+        __m256 const weight = _mm256_broadcast_ss(weights + weight_stride * input_index);
+        accumulator_0 = _mm256_fmadd_ps(weight, _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index), accumulator_0);
+        accumulator_1 = _mm256_fmadd_ps(weight, _mm256_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index + 8U), accumulator_1);
+    }
+
+    if (relu)
+    {
+        accumulator_0 = _mm256_max_ps(accumulator_0, zero);
+        accumulator_1 = _mm256_max_ps(accumulator_1, zero);
+    }
+
+    _mm256_store_ps(out_activations, accumulator_0);
+    _mm256_store_ps(out_activations + 8U, accumulator_1);
+}
+
+static inline __m256i ntm_cpu_broadcast_weight_group_avx2(int8_t const *weight_group)
+{
+    int32_t value;
+    memcpy(&value, weight_group, sizeof(int32_t));
+    return _mm256_set1_epi32(value);
+}
+
+static inline __m256i ntm_cpu_int8_dot_avx2(__m256i accumulator, __m256i activation_even, __m256i activation_odd, __m256i weight_group)
+{
+    // sign extend the bytes (4i, 4i + 2) and (4i + 1, 4i + 3) to int16
+    __m256i const weight_even = _mm256_srai_epi16(_mm256_slli_epi16(weight_group, 8), 8);
+    __m256i const weight_odd = _mm256_srai_epi16(weight_group, 8);
+    return _mm256_add_epi32(accumulator, _mm256_add_epi32(_mm256_madd_epi16(activation_even, weight_even), _mm256_madd_epi16(activation_odd, weight_odd)));
+}
+
+static inline void ntm_cpu_int8_store_avx2(__m256i accumulator_0, __m256i accumulator_1, __m256 output_range_0, __m256 output_range_1, float scale, float bias, bool relu, float *out_activations)
+{
+    __m256 value_0 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(accumulator_0), _mm256_mul_ps(output_range_0, _mm256_set1_ps(scale)), _mm256_set1_ps(bias));
+    __m256 value_1 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(accumulator_1), _mm256_mul_ps(output_range_1, _mm256_set1_ps(scale)), _mm256_set1_ps(bias));
+
+    if (relu)
+    {
+        value_0 = _mm256_max_ps(value_0, _mm256_setzero_ps());
+        value_1 = _mm256_max_ps(value_1, _mm256_setzero_ps());
+    }
+
+    _mm256_store_ps(out_activations, value_0);
+    _mm256_store_ps(out_activations + 8U, value_1);
+}
+
+static inline void ntm_cpu_sincos_avx2(__m256 x, __m256 *out_sin, __m256 *out_cos)
+{
+    // x = k * (pi / 2) + r (double precision)
+    __m256d const x_0 = _mm256_cvtps_pd(_mm256_castps256_ps128(x));
+    __m256d const x_1 = _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+
+    __m256d const k_0 = _mm256_round_pd(_mm256_mul_pd(x_0, _mm256_set1_pd(NTM_CPU_2_OVER_PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d const k_1 = _mm256_round_pd(_mm256_mul_pd(x_1, _mm256_set1_pd(NTM_CPU_2_OVER_PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    __m256d const r_0 = _mm256_fnmadd_pd(k_0, _mm256_set1_pd(NTM_CPU_PI_OVER_2_LO), _mm256_fnmadd_pd(k_0, _mm256_set1_pd(NTM_CPU_PI_OVER_2_HI), x_0));
+    __m256d const r_1 = _mm256_fnmadd_pd(k_1, _mm256_set1_pd(NTM_CPU_PI_OVER_2_LO), _mm256_fnmadd_pd(k_1, _mm256_set1_pd(NTM_CPU_PI_OVER_2_HI), x_1));
+
+    // q = k mod 4 (k may be out of the range of the int32)
+    __m256d const q_0 = _mm256_fnmadd_pd(_mm256_floor_pd(_mm256_mul_pd(k_0, _mm256_set1_pd(0.25))), _mm256_set1_pd(4.0), k_0);
+    __m256d const q_1 = _mm256_fnmadd_pd(_mm256_floor_pd(_mm256_mul_pd(k_1, _mm256_set1_pd(0.25))), _mm256_set1_pd(4.0), k_1);
+
+    __m256 const r = _mm256_set_m128(_mm256_cvtpd_ps(r_1), _mm256_cvtpd_ps(r_0));
+    __m256i const q = _mm256_set_m128i(_mm256_cvtpd_epi32(q_1), _mm256_cvtpd_epi32(q_0));
+
+    // r in [-pi/4, pi/4]
+    __m256 const z = _mm256_mul_ps(r, r);
+
+    __m256 sin_r = _mm256_fmadd_ps(_mm256_set1_ps(NTM_CPU_SIN_C2), z, _mm256_set1_ps(NTM_CPU_SIN_C1));
+    sin_r = _mm256_fmadd_ps(sin_r, z, _mm256_set1_ps(NTM_CPU_SIN_C0));
+    sin_r = _mm256_fmadd_ps(sin_r, _mm256_mul_ps(z, r), r);
+
+    __m256 cos_r = _mm256_fmadd_ps(_mm256_set1_ps(NTM_CPU_COS_C2), z, _mm256_set1_ps(NTM_CPU_COS_C1));
+    cos_r = _mm256_fmadd_ps(cos_r, z, _mm256_set1_ps(NTM_CPU_COS_C0));
+    cos_r = _mm256_fmadd_ps(cos_r, _mm256_mul_ps(z, z), _mm256_fnmadd_ps(_mm256_set1_ps(0.5F), z, _mm256_set1_ps(1.0F)));
+
+    // q = 1: (sin, cos) = (cos(r), -sin(r))
+    // q = 2: (sin, cos) = (-sin(r), -cos(r))
+    // q = 3: (sin, cos) = (-cos(r), sin(r))
+    __m256 const swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+    __m256 const sin_sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+    __m256 const cos_sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+
+    (*out_sin) = _mm256_xor_ps(_mm256_blendv_ps(sin_r, cos_r, swap), sin_sign);
+    (*out_cos) = _mm256_xor_ps(_mm256_blendv_ps(cos_r, sin_r, swap), cos_sign);
+}
+
+static void ntm_cpu_pack_avx2(ntm_pixel_format format, bool linear_to_srgb, uint32_t count, float const *in_RGBs, void *out_pixels)
+{
+    assert(count >= 1U && count <= NTM_CPU_BATCH_SIZE);
+
+    uint32_t const pixel_size = ntm_pixel_format_size(format);
+
+    // the partial batch is packed into the scratch memory at first
+    alignas(64) uint8_t scratch_pixels[8U * NTM_CPU_BATCH_SIZE];
+    uint8_t *const pixels = (NTM_CPU_BATCH_SIZE == count) ? static_cast<uint8_t *>(out_pixels) : scratch_pixels;
+
+    __m256 const zero = _mm256_setzero_ps();
+    __m256 const one = _mm256_set1_ps(1.0F);
+
+    for (uint32_t lane_begin = 0U; lane_begin < NTM_CPU_BATCH_SIZE; lane_begin += 8U)
+    {
+        // NaN is clamped to 0 (the "vmaxps" returns the 2nd operand)
+        __m256 R = _mm256_min_ps(_mm256_max_ps(_mm256_load_ps(in_RGBs + lane_begin), zero), one);
+        __m256 G = _mm256_min_ps(_mm256_max_ps(_mm256_load_ps(in_RGBs + NTM_CPU_BATCH_SIZE + lane_begin), zero), one);
+        __m256 B = _mm256_min_ps(_mm256_max_ps(_mm256_load_ps(in_RGBs + NTM_CPU_BATCH_SIZE * 2U + lane_begin), zero), one);
+
+        if (linear_to_srgb)
+        {
+            R = ntm_cpu_linear_to_srgb_avx2(R);
+            G = ntm_cpu_linear_to_srgb_avx2(G);
+            B = ntm_cpu_linear_to_srgb_avx2(B);
+        }
+
+        uint8_t *const destination = pixels + pixel_size * lane_begin;
+
+        switch (format)
+        {
+        case NTM_PIXEL_FORMAT_B8G8R8A8_UNORM:
+        case NTM_PIXEL_FORMAT_R8G8B8A8_UNORM:
+        {
+            // the "vcvtps2dq" rounds to the nearest even, the same as the "lrintf"
+            __m256 const scale = _mm256_set1_ps(255.0F);
+            __m256i const integer_R = _mm256_cvtps_epi32(_mm256_mul_ps(R, scale));
+            __m256i const integer_G = _mm256_cvtps_epi32(_mm256_mul_ps(G, scale));
+            __m256i const integer_B = _mm256_cvtps_epi32(_mm256_mul_ps(B, scale));
+
+            __m256i const byte_0 = (NTM_PIXEL_FORMAT_B8G8R8A8_UNORM == format) ? integer_B : integer_R;
+            __m256i const byte_2 = (NTM_PIXEL_FORMAT_B8G8R8A8_UNORM == format) ? integer_R : integer_B;
+
+            __m256i const pixel = _mm256_or_si256(_mm256_or_si256(byte_0, _mm256_slli_epi32(integer_G, 8)), _mm256_or_si256(_mm256_slli_epi32(byte_2, 16), _mm256_set1_epi32(static_cast<int>(0XFF000000U))));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), pixel);
+        }
+        break;
+        case NTM_PIXEL_FORMAT_R10G10B10A2_UNORM:
+        {
+            __m256 const scale = _mm256_set1_ps(1023.0F);
+            __m256i const integer_R = _mm256_cvtps_epi32(_mm256_mul_ps(R, scale));
+            __m256i const integer_G = _mm256_cvtps_epi32(_mm256_mul_ps(G, scale));
+            __m256i const integer_B = _mm256_cvtps_epi32(_mm256_mul_ps(B, scale));
+
+            __m256i const pixel = _mm256_or_si256(_mm256_or_si256(integer_R, _mm256_slli_epi32(integer_G, 10)), _mm256_or_si256(_mm256_slli_epi32(integer_B, 20), _mm256_set1_epi32(static_cast<int>(0XC0000000U))));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), pixel);
+        }
+        break;
+        default:
+        {
+            assert(NTM_PIXEL_FORMAT_R16G16B16A16_SFLOAT == format);
+
+            __m128i const half_R = _mm256_cvtps_ph(R, _MM_FROUND_TO_NEAREST_INT);
+            __m128i const half_G = _mm256_cvtps_ph(G, _MM_FROUND_TO_NEAREST_INT);
+            __m128i const half_B = _mm256_cvtps_ph(B, _MM_FROUND_TO_NEAREST_INT);
+
+            ntm_cpu_store_half_RGBAs_avx2(half_R, half_G, half_B, destination);
+        }
+        }
+    }
+
+    if (NTM_CPU_BATCH_SIZE != count)
+    {
+        memcpy(out_pixels, scratch_pixels, static_cast<size_t>(pixel_size) * count);
+    }
+}
+
+static inline __m256 ntm_cpu_linear_to_srgb_avx2(__m256 x)
+{
+    // log2(x) = exponent + log2(mantissa) where the mantissa is in [sqrt(1/2), sqrt(2)]
+    __m256i const bits = _mm256_castps_si256(_mm256_max_ps(x, _mm256_set1_ps(NTM_CPU_SRGB_LINEAR_THRESHOLD)));
+    __m256i exponent = _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127));
+    __m256 mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0X7FFFFF)), _mm256_set1_epi32(0X3F800000)));
+
+    __m256 const large = _mm256_cmp_ps(mantissa, _mm256_set1_ps(NTM_CPU_SQRT_2), _CMP_GT_OQ);
+    mantissa = _mm256_blendv_ps(mantissa, _mm256_mul_ps(mantissa, _mm256_set1_ps(0.5F)), large);
+    // the mask is -1
+    exponent = _mm256_sub_epi32(exponent, _mm256_castps_si256(large));
+
+    // log2(m) = (2 / ln(2)) * atanh(t) where t = (m - 1) / (m + 1) is in [-0.172, 0.172]
+    __m256 const t = _mm256_div_ps(_mm256_sub_ps(mantissa, _mm256_set1_ps(1.0F)), _mm256_add_ps(mantissa, _mm256_set1_ps(1.0F)));
+    __m256 const t2 = _mm256_mul_ps(t, t);
+    __m256 log2_mantissa = _mm256_fmadd_ps(t2, _mm256_set1_ps(NTM_CPU_LOG2_C7), _mm256_set1_ps(NTM_CPU_LOG2_C5));
+    log2_mantissa = _mm256_fmadd_ps(t2, log2_mantissa, _mm256_set1_ps(NTM_CPU_LOG2_C3));
+    log2_mantissa = _mm256_fmadd_ps(t2, log2_mantissa, _mm256_set1_ps(NTM_CPU_LOG2_C1));
+    __m256 const y = _mm256_mul_ps(_mm256_fmadd_ps(t, log2_mantissa, _mm256_cvtepi32_ps(exponent)), _mm256_set1_ps(1.0F / 2.4F));
+
+    // exp2(y) = 2^n * exp(f * ln(2)) where f = y - n is in [-1/2, 1/2]
+    __m256 const n = _mm256_round_ps(y, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 const z = _mm256_mul_ps(_mm256_sub_ps(y, n), _mm256_set1_ps(NTM_CPU_LN_2));
+    __m256 power = _mm256_fmadd_ps(z, _mm256_set1_ps(1.0F / 720.0F), _mm256_set1_ps(1.0F / 120.0F));
+    power = _mm256_fmadd_ps(z, power, _mm256_set1_ps(1.0F / 24.0F));
+    power = _mm256_fmadd_ps(z, power, _mm256_set1_ps(1.0F / 6.0F));
+    power = _mm256_fmadd_ps(z, power, _mm256_set1_ps(0.5F));
+    power = _mm256_fmadd_ps(z, power, _mm256_set1_ps(1.0F));
+    power = _mm256_fmadd_ps(z, power, _mm256_set1_ps(1.0F));
+    power = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(power), _mm256_slli_epi32(_mm256_cvtps_epi32(n), 23)));
+
+    __m256 const srgb = _mm256_fmsub_ps(_mm256_set1_ps(1.055F), power, _mm256_set1_ps(0.055F));
+    __m256 const linear = _mm256_mul_ps(x, _mm256_set1_ps(12.92F));
+    return _mm256_blendv_ps(srgb, linear, _mm256_cmp_ps(x, _mm256_set1_ps(NTM_CPU_SRGB_LINEAR_THRESHOLD), _CMP_LE_OQ));
+}
+
+static inline void ntm_cpu_store_half_RGBAs_avx2(__m128i half_R, __m128i half_G, __m128i half_B, uint8_t *destination)
+{
+    // 1.0
+    __m128i const half_A = _mm_set1_epi16(0X3C00);
+
+    // R0 G0 R1 G1 ... / B0 A0 B1 A1 ...
+    __m128i const RG_0 = _mm_unpacklo_epi16(half_R, half_G);
+    __m128i const RG_1 = _mm_unpackhi_epi16(half_R, half_G);
+    __m128i const BA_0 = _mm_unpacklo_epi16(half_B, half_A);
+    __m128i const BA_1 = _mm_unpackhi_epi16(half_B, half_A);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm_unpacklo_epi32(RG_0, BA_0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + 16), _mm_unpackhi_epi32(RG_0, BA_0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + 32), _mm_unpacklo_epi32(RG_1, BA_1));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + 48), _mm_unpackhi_epi32(RG_1, BA_1));
+}
+
+#endif
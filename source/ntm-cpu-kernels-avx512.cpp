@@ -0,0 +1,797 @@
+#include "ntm-cpu-kernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+#include <string.h>
+#include <assert.h>
+
+// NOTE: this translation unit is compiled with "-mavx512f -mavx512bw" (GCC) or "/arch:AVX512" (MSVC).
+// The VNNI kernel is merely selected when the CPU supports the VNNI, and thus only that function is compiled with the VNNI.
+#if defined(__GNUC__)
+#define NTM_CPU_TARGET_AVX512_VNNI __attribute__((target("avx512vnni")))
+#elif defined(_MSC_VER)
+#define NTM_CPU_TARGET_AVX512_VNNI
+#else
+#error Unknown Compiler
+#endif
+
+static void ntm_cpu_dense_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_fp16_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_int8_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+NTM_CPU_TARGET_AVX512_VNNI static void ntm_cpu_dense_int8_avx512_vnni(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_sparse_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_fp16_sparse_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_encode_avx512(uint32_t num_frequencies, uint32_t count, float const (*in_UVs)[2], float *out_features);
+
+static void ntm_cpu_pack_avx512(ntm_pixel_format format, bool linear_to_srgb, uint32_t count, float const *in_RGBs, void *out_pixels);
+
+static inline void ntm_cpu_dense_block_avx512(uint32_t input_size, float const *weights, size_t weight_stride, float const *biases, bool relu, float const *in_activations, float *out_activations);
+
+static inline void ntm_cpu_dense_single_avx512(uint32_t input_size, float const *weights, size_t weight_stride, float bias, bool relu, float const *in_activations, float *out_activations);
+
+static inline uint32_t ntm_cpu_active_inputs_avx512(uint32_t input_size, float const *in_activations, uint8_t *out_active_inputs);
+
+static inline void ntm_cpu_dense_block_sparse_avx512(uint32_t num_active_inputs, uint8_t const *active_inputs, float const *weights, size_t weight_stride, float const *biases, bool relu, float const *in_activations, float *out_activations);
+
+static inline void ntm_cpu_dense_single_sparse_avx512(uint32_t num_active_inputs, uint8_t const *active_inputs, float const *weights, size_t weight_stride, float bias, bool relu, float const *in_activations, float *out_activations);
+
+static inline __m512 ntm_cpu_int8_input_range_avx512(uint32_t input_size, float const *in_activations);
+
+static inline __m512i ntm_cpu_broadcast_weight_group_avx512(int8_t const *weight_group);
+
+static inline __m512i ntm_cpu_int8_dot_avx512(__m512i accumulator, __m512i activation_even, __m512i activation_odd, __m512i weight_group);
+
+static inline void ntm_cpu_int8_store_avx512(__m512i accumulator, __m512 output_range, float scale, float bias, bool relu, float *out_activations);
+
+static inline void ntm_cpu_sincos_avx512(__m512 x, __m512 *out_sin, __m512 *out_cos);
+
+static inline __m512 ntm_cpu_linear_to_srgb_avx512(__m512 x);
+
+static inline void ntm_cpu_store_half_RGBAs_avx512(__m128i half_R, __m128i half_G, __m128i half_B, uint8_t *destination);
+
+extern ntm_cpu_kernels const ntm_cpu_kernels_avx512 = {
+    {ntm_cpu_dense_avx512, ntm_cpu_dense_fp16_avx512, ntm_cpu_dense_int8_avx512},
+    {ntm_cpu_dense_sparse_avx512, ntm_cpu_dense_fp16_sparse_avx512, ntm_cpu_dense_int8_avx512},
+    ntm_cpu_encode_avx512,
+    ntm_cpu_pack_avx512};
+
+extern ntm_cpu_kernels const ntm_cpu_kernels_avx512_vnni = {
+    {ntm_cpu_dense_avx512, ntm_cpu_dense_fp16_avx512, ntm_cpu_dense_int8_avx512_vnni},
+    {ntm_cpu_dense_sparse_avx512, ntm_cpu_dense_fp16_sparse_avx512, ntm_cpu_dense_int8_avx512_vnni},
+    ntm_cpu_encode_avx512,
+    ntm_cpu_pack_avx512};
+
+static_assert(16U == NTM_CPU_BATCH_SIZE, "one batch is one AVX-512 register");
+
+static void ntm_cpu_dense_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    float const *const weights = static_cast<float const *>(layer->weights);
+    float const *const biases = layer->biases;
+
+    uint32_t output_index = 0U;
+
+    for (; (output_index + 8U) <= output_size; output_index += 8U)
+    {
+        ntm_cpu_dense_block_avx512(input_size, weights + output_index, output_size, biases + output_index, relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+
+    // e.g. the last layer (R, G, B)
+    for (; output_index < output_size; ++output_index)
+    {
+        ntm_cpu_dense_single_avx512(input_size, weights + output_index, output_size, biases[output_index], relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static void ntm_cpu_dense_fp16_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    uint16_t const *const weights = static_cast<uint16_t const *>(layer->weights);
+    float const *const biases = layer->biases;
+
+    // The weights of the 8 neurons are converted once for the 16 pixels of the batch.
+    alignas(64) float block_weights[NTM_MAX_LAYER_WIDTH * 8U];
+
+    uint32_t output_index = 0U;
+
+    for (; (output_index + 8U) <= output_size; output_index += 8U)
+    {
+        for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+        {
+            __m128i const half_weights = _mm_loadu_si128(reinterpret_cast<__m128i const *>(weights + static_cast<size_t>(output_size) * input_index + output_index));
+            _mm256_store_ps(block_weights + 8U * input_index, _mm512_castps512_ps256(_mm512_cvtph_ps(_mm256_zextsi128_si256(half_weights))));
+        }
+
+        ntm_cpu_dense_block_avx512(input_size, block_weights, 8U, biases + output_index, relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+
+    for (; output_index < output_size; ++output_index)
+    {
+        for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+        {
+            block_weights[input_index] = _mm512_cvtss_f32(_mm512_cvtph_ps(_mm256_zextsi128_si256(_mm_cvtsi32_si128(weights[static_cast<size_t>(output_size) * input_index + output_index]))));
+        }
+
+        ntm_cpu_dense_single_avx512(input_size, block_weights, 1U, biases[output_index], relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static void ntm_cpu_dense_int8_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    uint32_t const num_input_groups = (input_size + 3U) / 4U;
+    int8_t const *const weights = static_cast<int8_t const *>(layer->weights);
+
+    __m512 const input_range = ntm_cpu_int8_input_range_avx512(input_size, in_activations);
+
+    // [num_input_groups][2][NTM_CPU_BATCH_SIZE] where each int32 is the int16 pair of the inputs (4i, 4i + 2) or (4i + 1, 4i + 3), namely, the operand of the "vpmaddwd"
+    // The int8 weights (4i, 4i + 1, 4i + 2, 4i + 3) are broadcast as one int32, and the even and odd bytes are sign extended to the int16 pairs (4i, 4i + 2) and (4i + 1, 4i + 3) by merely two shifts.
+    alignas(64) int32_t quantized_activations[(NTM_MAX_LAYER_WIDTH / 2U) * NTM_CPU_BATCH_SIZE];
+    {
+        __m512 const input_scale = _mm512_div_ps(_mm512_set1_ps(255.0F), input_range);
+
+        for (uint32_t pair_index = 0U; pair_index < (2U * num_input_groups); ++pair_index)
+        {
+            __m512i pair = _mm512_setzero_si512();
+            for (uint32_t input_subindex = 0U; input_subindex < 2U; ++input_subindex)
+            {
+                // pair 2i: (4i, 4i + 2) pair 2i + 1: (4i + 1, 4i + 3)
+                uint32_t const input_index = 4U * (pair_index / 2U) + (pair_index % 2U) + 2U * input_subindex;
+                if (input_index < input_size)
+                {
+                    __m512i const quantized = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index), input_scale));
+                    pair = _mm512_or_si512(pair, _mm512_slli_epi32(quantized, 16U * input_subindex));
+                }
+            }
+
+            _mm512_store_si512(quantized_activations + NTM_CPU_BATCH_SIZE * pair_index, pair);
+        }
+    }
+
+    __m512 const output_range = _mm512_mul_ps(input_range, _mm512_set1_ps(1.0F / 255.0F));
+
+    uint32_t output_index = 0U;
+
+    // 8 neurons x 1 register = 8 accumulators
+    for (; (output_index + 8U) <= output_size; output_index += 8U)
+    {
+        __m512i accumulator_0 = _mm512_setzero_si512();
+        __m512i accumulator_1 = _mm512_setzero_si512();
+        __m512i accumulator_2 = _mm512_setzero_si512();
+        __m512i accumulator_3 = _mm512_setzero_si512();
+        __m512i accumulator_4 = _mm512_setzero_si512();
+        __m512i accumulator_5 = _mm512_setzero_si512();
+        __m512i accumulator_6 = _mm512_setzero_si512();
+        __m512i accumulator_7 = _mm512_setzero_si512();
+
+        for (uint32_t input_group_index = 0U; input_group_index < num_input_groups; ++input_group_index)
+        {
+            __m512i const activation_even = _mm512_load_si512(quantized_activations + NTM_CPU_BATCH_SIZE * (2U * input_group_index));
+            __m512i const activation_odd = _mm512_load_si512(quantized_activations + NTM_CPU_BATCH_SIZE * (2U * input_group_index + 1U));
+
+            int8_t const *const weight_groups = weights + 4U * (static_cast<size_t>(output_size) * input_group_index + output_index);
+
+            accumulator_0 = ntm_cpu_int8_dot_avx512(accumulator_0, activation_even, activation_odd, ntm_cpu_broadcast_weight_group_avx512(weight_groups));
+            accumulator_1 = ntm_cpu_int8_dot_avx512(accumulator_1, activation_even, activation_odd, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 4U));
+            accumulator_2 = ntm_cpu_int8_dot_avx512(accumulator_2, activation_even, activation_odd, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 8U));
+            accumulator_3 = ntm_cpu_int8_dot_avx512(accumulator_3, activation_even, activation_odd, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 12U));
+            accumulator_4 = ntm_cpu_int8_dot_avx512(accumulator_4, activation_even, activation_odd, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 16U));
+            accumulator_5 = ntm_cpu_int8_dot_avx512(accumulator_5, activation_even, activation_odd, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 20U));
+            accumulator_6 = ntm_cpu_int8_dot_avx512(accumulator_6, activation_even, activation_odd, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 24U));
+            accumulator_7 = ntm_cpu_int8_dot_avx512(accumulator_7, activation_even, activation_odd, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 28U));
+        }
+
+        float const *const scales = layer->scales + output_index;
+        float const *const biases = layer->biases + output_index;
+        float *const out_activation = out_activations + NTM_CPU_BATCH_SIZE * output_index;
+        ntm_cpu_int8_store_avx512(accumulator_0, output_range, scales[0], biases[0], relu, out_activation);
+        ntm_cpu_int8_store_avx512(accumulator_1, output_range, scales[1], biases[1], relu, out_activation + NTM_CPU_BATCH_SIZE * 1U);
+        ntm_cpu_int8_store_avx512(accumulator_2, output_range, scales[2], biases[2], relu, out_activation + NTM_CPU_BATCH_SIZE * 2U);
+        ntm_cpu_int8_store_avx512(accumulator_3, output_range, scales[3], biases[3], relu, out_activation + NTM_CPU_BATCH_SIZE * 3U);
+        ntm_cpu_int8_store_avx512(accumulator_4, output_range, scales[4], biases[4], relu, out_activation + NTM_CPU_BATCH_SIZE * 4U);
+        ntm_cpu_int8_store_avx512(accumulator_5, output_range, scales[5], biases[5], relu, out_activation + NTM_CPU_BATCH_SIZE * 5U);
+        ntm_cpu_int8_store_avx512(accumulator_6, output_range, scales[6], biases[6], relu, out_activation + NTM_CPU_BATCH_SIZE * 6U);
+        ntm_cpu_int8_store_avx512(accumulator_7, output_range, scales[7], biases[7], relu, out_activation + NTM_CPU_BATCH_SIZE * 7U);
+    }
+
+    // e.g. the last layer (R, G, B)
+    for (; output_index < output_size; ++output_index)
+    {
+        __m512i accumulator = _mm512_setzero_si512();
+
+        for (uint32_t input_group_index = 0U; input_group_index < num_input_groups; ++input_group_index)
+        {
+            __m512i const weight_group = ntm_cpu_broadcast_weight_group_avx512(weights + 4U * (static_cast<size_t>(output_size) * input_group_index + output_index));
+            accumulator = ntm_cpu_int8_dot_avx512(accumulator, _mm512_load_si512(quantized_activations + NTM_CPU_BATCH_SIZE * (2U * input_group_index)), _mm512_load_si512(quantized_activations + NTM_CPU_BATCH_SIZE * (2U * input_group_index + 1U)), weight_group);
+        }
+
+        ntm_cpu_int8_store_avx512(accumulator, output_range, layer->scales[output_index], layer->biases[output_index], relu, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+NTM_CPU_TARGET_AVX512_VNNI static void ntm_cpu_dense_int8_avx512_vnni(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    uint32_t const num_input_groups = (input_size + 3U) / 4U;
+    int8_t const *const weights = static_cast<int8_t const *>(layer->weights);
+
+    __m512 const input_range = ntm_cpu_int8_input_range_avx512(input_size, in_activations);
+
+    // [num_input_groups][NTM_CPU_BATCH_SIZE] where each int32 is the 4 uint8 of the inputs (4i, 4i + 1, 4i + 2, 4i + 3), namely, the operand of the "vpdpbusd"
+    alignas(64) int32_t quantized_activations[(NTM_MAX_LAYER_WIDTH / 4U) * NTM_CPU_BATCH_SIZE];
+    {
+        __m512 const input_scale = _mm512_div_ps(_mm512_set1_ps(255.0F), input_range);
+
+        for (uint32_t input_group_index = 0U; input_group_index < num_input_groups; ++input_group_index)
+        {
+            __m512i group = _mm512_setzero_si512();
+            for (uint32_t input_subindex = 0U; input_subindex < 4U; ++input_subindex)
+            {
+                uint32_t const input_index = 4U * input_group_index + input_subindex;
+                if (input_index < input_size)
+                {
+                    __m512i const quantized = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index), input_scale));
+                    group = _mm512_or_si512(group, _mm512_slli_epi32(quantized, 8U * input_subindex));
+                }
+            }
+
+            _mm512_store_si512(quantized_activations + NTM_CPU_BATCH_SIZE * input_group_index, group);
+        }
+    }
+
+    __m512 const output_range = _mm512_mul_ps(input_range, _mm512_set1_ps(1.0F / 255.0F));
+
+    uint32_t output_index = 0U;
+
+    // 8 neurons x 1 register = 8 accumulators
+    for (; (output_index + 8U) <= output_size; output_index += 8U)
+    {
+        __m512i accumulator_0 = _mm512_setzero_si512();
+        __m512i accumulator_1 = _mm512_setzero_si512();
+        __m512i accumulator_2 = _mm512_setzero_si512();
+        __m512i accumulator_3 = _mm512_setzero_si512();
+        __m512i accumulator_4 = _mm512_setzero_si512();
+        __m512i accumulator_5 = _mm512_setzero_si512();
+        __m512i accumulator_6 = _mm512_setzero_si512();
+        __m512i accumulator_7 = _mm512_setzero_si512();
+
+        for (uint32_t input_group_index = 0U; input_group_index < num_input_groups; ++input_group_index)
+        {
+            __m512i const activation = _mm512_load_si512(quantized_activations + NTM_CPU_BATCH_SIZE * input_group_index);
+
+            int8_t const *const weight_groups = weights + 4U * (static_cast<size_t>(output_size) * input_group_index + output_index);
+
+            accumulator_0 = _mm512_dpbusd_epi32(accumulator_0, activation, ntm_cpu_broadcast_weight_group_avx512(weight_groups));
+            accumulator_1 = _mm512_dpbusd_epi32(accumulator_1, activation, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 4U));
+            accumulator_2 = _mm512_dpbusd_epi32(accumulator_2, activation, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 8U));
+            accumulator_3 = _mm512_dpbusd_epi32(accumulator_3, activation, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 12U));
+            accumulator_4 = _mm512_dpbusd_epi32(accumulator_4, activation, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 16U));
+            accumulator_5 = _mm512_dpbusd_epi32(accumulator_5, activation, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 20U));
+            accumulator_6 = _mm512_dpbusd_epi32(accumulator_6, activation, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 24U));
+            accumulator_7 = _mm512_dpbusd_epi32(accumulator_7, activation, ntm_cpu_broadcast_weight_group_avx512(weight_groups + 28U));
+        }
+
+        float const *const scales = layer->scales + output_index;
+        float const *const biases = layer->biases + output_index;
+        float *const out_activation = out_activations + NTM_CPU_BATCH_SIZE * output_index;
+        ntm_cpu_int8_store_avx512(accumulator_0, output_range, scales[0], biases[0], relu, out_activation);
+        ntm_cpu_int8_store_avx512(accumulator_1, output_range, scales[1], biases[1], relu, out_activation + NTM_CPU_BATCH_SIZE * 1U);
+        ntm_cpu_int8_store_avx512(accumulator_2, output_range, scales[2], biases[2], relu, out_activation + NTM_CPU_BATCH_SIZE * 2U);
+        ntm_cpu_int8_store_avx512(accumulator_3, output_range, scales[3], biases[3], relu, out_activation + NTM_CPU_BATCH_SIZE * 3U);
+        ntm_cpu_int8_store_avx512(accumulator_4, output_range, scales[4], biases[4], relu, out_activation + NTM_CPU_BATCH_SIZE * 4U);
+        ntm_cpu_int8_store_avx512(accumulator_5, output_range, scales[5], biases[5], relu, out_activation + NTM_CPU_BATCH_SIZE * 5U);
+        ntm_cpu_int8_store_avx512(accumulator_6, output_range, scales[6], biases[6], relu, out_activation + NTM_CPU_BATCH_SIZE * 6U);
+        ntm_cpu_int8_store_avx512(accumulator_7, output_range, scales[7], biases[7], relu, out_activation + NTM_CPU_BATCH_SIZE * 7U);
+    }
+
+    // e.g. the last layer (R, G, B)
+    for (; output_index < output_size; ++output_index)
+    {
+        __m512i accumulator = _mm512_setzero_si512();
+
+        for (uint32_t input_group_index = 0U; input_group_index < num_input_groups; ++input_group_index)
+        {
+            __m512i const weight_group = ntm_cpu_broadcast_weight_group_avx512(weights + 4U * (static_cast<size_t>(output_size) * input_group_index + output_index));
+            accumulator = _mm512_dpbusd_epi32(accumulator, _mm512_load_si512(quantized_activations + NTM_CPU_BATCH_SIZE * input_group_index), weight_group);
+        }
+
+        ntm_cpu_int8_store_avx512(accumulator, output_range, layer->scales[output_index], layer->biases[output_index], relu, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static void ntm_cpu_dense_sparse_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    float const *const weights = static_cast<float const *>(layer->weights);
+    float const *const biases = layer->biases;
+
+    uint8_t active_inputs[NTM_MAX_LAYER_WIDTH];
+    uint32_t const num_active_inputs = ntm_cpu_active_inputs_avx512(input_size, in_activations, active_inputs);
+    if (num_active_inputs == input_size)
+    {
+        ntm_cpu_dense_avx512(layer, relu, in_activations, out_activations);
+        return;
+    }
+
+    uint32_t output_index = 0U;
+
+    for (; (output_index + 8U) <= output_size; output_index += 8U)
+    {
+        ntm_cpu_dense_block_sparse_avx512(num_active_inputs, active_inputs, weights + output_index, output_size, biases + output_index, relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+
+    for (; output_index < output_size; ++output_index)
+    {
+        ntm_cpu_dense_single_sparse_avx512(num_active_inputs, active_inputs, weights + output_index, output_size, biases[output_index], relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static void ntm_cpu_dense_fp16_sparse_avx512(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    uint16_t const *const weights = static_cast<uint16_t const *>(layer->weights);
+    float const *const biases = layer->biases;
+
+    uint8_t active_inputs[NTM_MAX_LAYER_WIDTH];
+    uint32_t const num_active_inputs = ntm_cpu_active_inputs_avx512(input_size, in_activations, active_inputs);
+    if (num_active_inputs == input_size)
+    {
+        ntm_cpu_dense_fp16_avx512(layer, relu, in_activations, out_activations);
+        return;
+    }
+
+    // merely the weights of the active inputs are converted (at the same positions as the "ntm_cpu_dense_fp16_avx512")
+    alignas(64) float block_weights[NTM_MAX_LAYER_WIDTH * 8U];
+
+    uint32_t output_index = 0U;
+
+    for (; (output_index + 8U) <= output_size; output_index += 8U)
+    {
+        for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+        {
+            uint32_t const input_index = active_inputs[active_index];
+            __m128i const half_weights = _mm_loadu_si128(reinterpret_cast<__m128i const *>(weights + static_cast<size_t>(output_size) * input_index + output_index));
+            _mm256_store_ps(block_weights + 8U * input_index, _mm512_castps512_ps256(_mm512_cvtph_ps(_mm256_zextsi128_si256(half_weights))));
+        }
+
+        ntm_cpu_dense_block_sparse_avx512(num_active_inputs, active_inputs, block_weights, 8U, biases + output_index, relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+
+    for (; output_index < output_size; ++output_index)
+    {
+        for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+        {
+            uint32_t const input_index = active_inputs[active_index];
+            block_weights[input_index] = _mm512_cvtss_f32(_mm512_cvtph_ps(_mm256_zextsi128_si256(_mm_cvtsi32_si128(weights[static_cast<size_t>(output_size) * input_index + output_index]))));
+        }
+
+        ntm_cpu_dense_single_sparse_avx512(num_active_inputs, active_inputs, block_weights, 1U, biases[output_index], relu, in_activations, out_activations + NTM_CPU_BATCH_SIZE * output_index);
+    }
+}
+
+static inline void ntm_cpu_dense_block_avx512(uint32_t input_size, float const *weights, size_t weight_stride, float const *biases, bool relu, float const *in_activations, float *out_activations)
+{
+    __m512 const zero = _mm512_setzero_ps();
+
+    // 8 neurons x 1 register = 8 accumulators
+    __m512 accumulator_0 = _mm512_set1_ps(biases[0]);
+    __m512 accumulator_1 = _mm512_set1_ps(biases[1]);
+    __m512 accumulator_2 = _mm512_set1_ps(biases[2]);
+    __m512 accumulator_3 = _mm512_set1_ps(biases[3]);
+    __m512 accumulator_4 = _mm512_set1_ps(biases[4]);
+    __m512 accumulator_5 = _mm512_set1_ps(biases[5]);
+    __m512 accumulator_6 = _mm512_set1_ps(biases[6]);
+    __m512 accumulator_7 = _mm512_set1_ps(biases[7]);
+
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        __m512 const activation = _mm512_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+
+        float const *const weight_row = weights + weight_stride * input_index;
+
+        accumulator_0 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[0]), activation, accumulator_0);
+        accumulator_1 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[1]), activation, accumulator_1);
+        accumulator_2 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[2]), activation, accumulator_2);
+        accumulator_3 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[3]), activation, accumulator_3);
+        accumulator_4 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[4]), activation, accumulator_4);
+        accumulator_5 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[5]), activation, accumulator_5);
+        accumulator_6 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[6]), activation, accumulator_6);
+        accumulator_7 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[7]), activation, accumulator_7);
+    }
+
+    if (relu)
+    {
+        accumulator_0 = _mm512_max_ps(accumulator_0, zero);
+        accumulator_1 = _mm512_max_ps(accumulator_1, zero);
+        accumulator_2 = _mm512_max_ps(accumulator_2, zero);
+        accumulator_3 = _mm512_max_ps(accumulator_3, zero);
+        accumulator_4 = _mm512_max_ps(accumulator_4, zero);
+        accumulator_5 = _mm512_max_ps(accumulator_5, zero);
+        accumulator_6 = _mm512_max_ps(accumulator_6, zero);
+        accumulator_7 = _mm512_max_ps(accumulator_7, zero);
+    }
+
+    _mm512_store_ps(out_activations, accumulator_0);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE, accumulator_1);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 2U, accumulator_2);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 3U, accumulator_3);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 4U, accumulator_4);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 5U, accumulator_5);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 6U, accumulator_6);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 7U, accumulator_7);
+}
+
+static inline void ntm_cpu_dense_single_avx512(uint32_t input_size, float const *weights, size_t weight_stride, float bias, bool relu, float const *in_activations, float *out_activations)
+{
+    __m512 accumulator = _mm512_set1_ps(bias);
+
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        accumulator = _mm512_fmadd_ps(_mm512_set1_ps(weights[weight_stride * input_index]), _mm512_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index), accumulator);
+    }
+
+    if (relu)
+    {
+        accumulator = _mm512_max_ps(accumulator, _mm512_setzero_ps());
+    }
+
+    _mm512_store_ps(out_activations, accumulator);
+}
+
+// The indices of the inputs which are NOT zero (neither +0 nor -0) for at least one lane of the batch.
+static inline uint32_t ntm_cpu_active_inputs_avx512(uint32_t input_size, float const *in_activations, uint8_t *out_active_inputs)
+{
+    __m512 const zero = _mm512_setzero_ps();
+
+    uint32_t num_active_inputs = 0U;
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        // NaN is NOT equal to zero, and thus is active
+        __mmask16 const active = _mm512_cmp_ps_mask(_mm512_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index), zero, _CMP_NEQ_UQ);
+
+        // branchless: the index is always written, but merely counted when active
+        out_active_inputs[num_active_inputs] = static_cast<uint8_t>(input_index);
+        num_active_inputs += (0 != active) ? 1U : 0U;
+    }
+    return num_active_inputs;
+}
+
+static inline void ntm_cpu_dense_block_sparse_avx512(uint32_t num_active_inputs, uint8_t const *active_inputs, float const *weights, size_t weight_stride, float const *biases, bool relu, float const *in_activations, float *out_activations)
+{
+    __m512 const zero = _mm512_setzero_ps();
+
+    __m512 accumulator_0 = _mm512_set1_ps(biases[0]);
+    __m512 accumulator_1 = _mm512_set1_ps(biases[1]);
+    __m512 accumulator_2 = _mm512_set1_ps(biases[2]);
+    __m512 accumulator_3 = _mm512_set1_ps(biases[3]);
+    __m512 accumulator_4 = _mm512_set1_ps(biases[4]);
+    __m512 accumulator_5 = _mm512_set1_ps(biases[5]);
+    __m512 accumulator_6 = _mm512_set1_ps(biases[6]);
+    __m512 accumulator_7 = _mm512_set1_ps(biases[7]);
+
+    for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+    {
+        uint32_t const input_index = active_inputs[active_index];
+
+        __m512 const activation = _mm512_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index);
+
+        float const *const weight_row = weights + weight_stride * input_index;
+
+        accumulator_0 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[0]), activation, accumulator_0);
+        accumulator_1 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[1]), activation, accumulator_1);
+        accumulator_2 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[2]), activation, accumulator_2);
+        accumulator_3 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[3]), activation, accumulator_3);
+        accumulator_4 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[4]), activation, accumulator_4);
+        accumulator_5 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[5]), activation, accumulator_5);
+        accumulator_6 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[6]), activation, accumulator_6);
+        accumulator_7 = _mm512_fmadd_ps(_mm512_set1_ps(weight_row[7]), activation, accumulator_7);
+    }
+
+    if (relu)
+    {
+        accumulator_0 = _mm512_max_ps(accumulator_0, zero);
+        accumulator_1 = _mm512_max_ps(accumulator_1, zero);
+        accumulator_2 = _mm512_max_ps(accumulator_2, zero);
+        accumulator_3 = _mm512_max_ps(accumulator_3, zero);
+        accumulator_4 = _mm512_max_ps(accumulator_4, zero);
+        accumulator_5 = _mm512_max_ps(accumulator_5, zero);
+        accumulator_6 = _mm512_max_ps(accumulator_6, zero);
+        accumulator_7 = _mm512_max_ps(accumulator_7, zero);
+    }
+
+    _mm512_store_ps(out_activations, accumulator_0);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE, accumulator_1);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 2U, accumulator_2);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 3U, accumulator_3);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 4U, accumulator_4);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 5U, accumulator_5);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 6U, accumulator_6);
+    _mm512_store_ps(out_activations + NTM_CPU_BATCH_SIZE * 7U, accumulator_7);
+}
+
+static inline void ntm_cpu_dense_single_sparse_avx512(uint32_t num_active_inputs, uint8_t const *active_inputs, float const *weights, size_t weight_stride, float bias, bool relu, float const *in_activations, float *out_activations)
+{
+    __m512 accumulator = _mm512_set1_ps(bias);
+
+    for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+    {
+        uint32_t const input_index = active_inputs[active_index];
+        accumulator = _mm512_fmadd_ps(_mm512_set1_ps(weights[weight_stride * input_index]), _mm512_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index), accumulator);
+    }
+
+    if (relu)
+    {
+        accumulator = _mm512_max_ps(accumulator, _mm512_setzero_ps());
+    }
+
+    _mm512_store_ps(out_activations, accumulator);
+}
+
+static inline __m512 ntm_cpu_int8_input_range_avx512(uint32_t input_size, float const *in_activations)
+{
+    __m512 input_range = _mm512_set1_ps(NTM_CPU_INT8_MIN_RANGE);
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        input_range = _mm512_max_ps(input_range, _mm512_load_ps(in_activations + NTM_CPU_BATCH_SIZE * input_index));
+    }
+    return input_range;
+}
+
+static inline __m512i ntm_cpu_broadcast_weight_group_avx512(int8_t const *weight_group)
+{
+    int32_t value;
+    memcpy(&value, weight_group, sizeof(int32_t));
+    return _mm512_set1_epi32(value);
+}
+
+static inline __m512i ntm_cpu_int8_dot_avx512(__m512i accumulator, __m512i activation_even, __m512i activation_odd, __m512i weight_group)
+{
+    // sign extend the bytes (4i, 4i + 2) and (4i + 1, 4i + 3) to int16
+    __m512i const weight_even = _mm512_srai_epi16(_mm512_slli_epi16(weight_group, 8), 8);
+    __m512i const weight_odd = _mm512_srai_epi16(weight_group, 8);
+    return _mm512_add_epi32(accumulator, _mm512_add_epi32(_mm512_madd_epi16(activation_even, weight_even), _mm512_madd_epi16(activation_odd, weight_odd)));
+}
+
+static inline void ntm_cpu_int8_store_avx512(__m512i accumulator, __m512 output_range, float scale, float bias, bool relu, float *out_activations)
+{
+    __m512 value = _mm512_fmadd_ps(_mm512_cvtepi32_ps(accumulator), _mm512_mul_ps(output_range, _mm512_set1_ps(scale)), _mm512_set1_ps(bias));
+
+    if (relu)
+    {
+        value = _mm512_max_ps(value, _mm512_setzero_ps());
+    }
+
+    _mm512_store_ps(out_activations, value);
+}
+
+static void ntm_cpu_encode_avx512(uint32_t num_frequencies, uint32_t count, float const (*in_UVs)[2], float *out_features)
+{
+    assert(count >= 1U && count <= NTM_CPU_BATCH_SIZE);
+
+    alignas(64) float Us[NTM_CPU_BATCH_SIZE];
+    alignas(64) float Vs[NTM_CPU_BATCH_SIZE];
+    for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+    {
+        // the unused lanes replicate the last pixel
+        uint32_t const pixel_index = (lane_index < count) ? lane_index : (count - 1U);
+        Us[lane_index] = in_UVs[pixel_index][0];
+        Vs[lane_index] = in_UVs[pixel_index][1];
+    }
+
+    __m512 const U = _mm512_load_ps(Us);
+    __m512 const V = _mm512_load_ps(Vs);
+
+    __m512 sin_U = _mm512_setzero_ps();
+    __m512 sin_V = _mm512_setzero_ps();
+    __m512 cos_U = _mm512_setzero_ps();
+    __m512 cos_V = _mm512_setzero_ps();
+
+    for (uint32_t frequency_index = 0U; frequency_index < num_frequencies; ++frequency_index)
+    {
+        if (0U == (frequency_index % NTM_CPU_ENCODE_RESEED_PERIOD))
+        {
+            // the same argument as the "ntm_cpu_encode_scalar"
+            __m512 const frequency = _mm512_set1_ps(static_cast<float>(1U << frequency_index) * NTM_PI);
+            ntm_cpu_sincos_avx512(_mm512_mul_ps(frequency, U), &sin_U, &cos_U);
+            ntm_cpu_sincos_avx512(_mm512_mul_ps(frequency, V), &sin_V, &cos_V);
+        }
+        else
+        {
+            __m512 const next_sin_U = _mm512_mul_ps(_mm512_add_ps(sin_U, sin_U), cos_U);
+            __m512 const next_sin_V = _mm512_mul_ps(_mm512_add_ps(sin_V, sin_V), cos_V);
+            cos_U = _mm512_mul_ps(_mm512_sub_ps(cos_U, sin_U), _mm512_add_ps(cos_U, sin_U));
+            cos_V = _mm512_mul_ps(_mm512_sub_ps(cos_V, sin_V), _mm512_add_ps(cos_V, sin_V));
+            sin_U = next_sin_U;
+            sin_V = next_sin_V;
+        }
+
+        float *const out_feature = out_features + NTM_CPU_BATCH_SIZE * (4U * frequency_index);
+        _mm512_store_ps(out_feature, sin_U);
+        _mm512_store_ps(out_feature + NTM_CPU_BATCH_SIZE, sin_V);
+        _mm512_store_ps(out_feature + NTM_CPU_BATCH_SIZE * 2U, cos_U);
+        _mm512_store_ps(out_feature + NTM_CPU_BATCH_SIZE * 3U, cos_V);
+    }
+}
+
+static inline void ntm_cpu_sincos_avx512(__m512 x, __m512 *out_sin, __m512 *out_cos)
+{
+    // x = k * (pi / 2) + r (double precision)
+    __m512d const x_0 = _mm512_cvtps_pd(_mm512_castps512_ps256(x));
+    __m512d const x_1 = _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1)));
+
+    __m512d const k_0 = _mm512_roundscale_pd(_mm512_mul_pd(x_0, _mm512_set1_pd(NTM_CPU_2_OVER_PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512d const k_1 = _mm512_roundscale_pd(_mm512_mul_pd(x_1, _mm512_set1_pd(NTM_CPU_2_OVER_PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    __m512d const r_0 = _mm512_fnmadd_pd(k_0, _mm512_set1_pd(NTM_CPU_PI_OVER_2_LO), _mm512_fnmadd_pd(k_0, _mm512_set1_pd(NTM_CPU_PI_OVER_2_HI), x_0));
+    __m512d const r_1 = _mm512_fnmadd_pd(k_1, _mm512_set1_pd(NTM_CPU_PI_OVER_2_LO), _mm512_fnmadd_pd(k_1, _mm512_set1_pd(NTM_CPU_PI_OVER_2_HI), x_1));
+
+    // q = k mod 4 (k may be out of the range of the int32)
+    __m512d const q_0 = _mm512_fnmadd_pd(_mm512_roundscale_pd(_mm512_mul_pd(k_0, _mm512_set1_pd(0.25)), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC), _mm512_set1_pd(4.0), k_0);
+    __m512d const q_1 = _mm512_fnmadd_pd(_mm512_roundscale_pd(_mm512_mul_pd(k_1, _mm512_set1_pd(0.25)), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC), _mm512_set1_pd(4.0), k_1);
+
+    // "_mm512_insertf32x8" is AVX512DQ
+    __m512 const r = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(r_0))), _mm256_castps_pd(_mm512_cvtpd_ps(r_1)), 1));
+    __m512i const q = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtpd_epi32(q_0)), _mm512_cvtpd_epi32(q_1), 1);
+
+    // r in [-pi/4, pi/4]
+    __m512 const z = _mm512_mul_ps(r, r);
+
+    __m512 sin_r = _mm512_fmadd_ps(_mm512_set1_ps(NTM_CPU_SIN_C2), z, _mm512_set1_ps(NTM_CPU_SIN_C1));
+    sin_r = _mm512_fmadd_ps(sin_r, z, _mm512_set1_ps(NTM_CPU_SIN_C0));
+    sin_r = _mm512_fmadd_ps(sin_r, _mm512_mul_ps(z, r), r);
+
+    __m512 cos_r = _mm512_fmadd_ps(_mm512_set1_ps(NTM_CPU_COS_C2), z, _mm512_set1_ps(NTM_CPU_COS_C1));
+    cos_r = _mm512_fmadd_ps(cos_r, z, _mm512_set1_ps(NTM_CPU_COS_C0));
+    cos_r = _mm512_fmadd_ps(cos_r, _mm512_mul_ps(z, z), _mm512_fnmadd_ps(_mm512_set1_ps(0.5F), z, _mm512_set1_ps(1.0F)));
+
+    // q = 1: (sin, cos) = (cos(r), -sin(r))
+    // q = 2: (sin, cos) = (-sin(r), -cos(r))
+    // q = 3: (sin, cos) = (-cos(r), sin(r))
+    __mmask16 const swap = _mm512_test_epi32_mask(q, _mm512_set1_epi32(1));
+    __m512i const sin_sign = _mm512_slli_epi32(_mm512_and_si512(q, _mm512_set1_epi32(2)), 30);
+    __m512i const cos_sign = _mm512_slli_epi32(_mm512_and_si512(_mm512_add_epi32(q, _mm512_set1_epi32(1)), _mm512_set1_epi32(2)), 30);
+
+    // "_mm512_xor_ps" is AVX512DQ
+    (*out_sin) = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(swap, sin_r, cos_r)), sin_sign));
+    (*out_cos) = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(swap, cos_r, sin_r)), cos_sign));
+}
+
+static void ntm_cpu_pack_avx512(ntm_pixel_format format, bool linear_to_srgb, uint32_t count, float const *in_RGBs, void *out_pixels)
+{
+    assert(count >= 1U && count <= NTM_CPU_BATCH_SIZE);
+
+    uint32_t const pixel_size = ntm_pixel_format_size(format);
+
+    // the partial batch is packed into the scratch memory at first
+    alignas(64) uint8_t scratch_pixels[8U * NTM_CPU_BATCH_SIZE];
+    uint8_t *const pixels = (NTM_CPU_BATCH_SIZE == count) ? static_cast<uint8_t *>(out_pixels) : scratch_pixels;
+
+    __m512 const zero = _mm512_setzero_ps();
+    __m512 const one = _mm512_set1_ps(1.0F);
+
+    // NaN is clamped to 0 (the "vmaxps" returns the 2nd operand)
+    __m512 R = _mm512_min_ps(_mm512_max_ps(_mm512_load_ps(in_RGBs), zero), one);
+    __m512 G = _mm512_min_ps(_mm512_max_ps(_mm512_load_ps(in_RGBs + NTM_CPU_BATCH_SIZE), zero), one);
+    __m512 B = _mm512_min_ps(_mm512_max_ps(_mm512_load_ps(in_RGBs + NTM_CPU_BATCH_SIZE * 2U), zero), one);
+
+    if (linear_to_srgb)
+    {
+        R = ntm_cpu_linear_to_srgb_avx512(R);
+        G = ntm_cpu_linear_to_srgb_avx512(G);
+        B = ntm_cpu_linear_to_srgb_avx512(B);
+    }
+
+    switch (format)
+    {
+    case NTM_PIXEL_FORMAT_B8G8R8A8_UNORM:
+    case NTM_PIXEL_FORMAT_R8G8B8A8_UNORM:
+    {
+        // the "vcvtps2dq" rounds to the nearest even, the same as the "lrintf"
+        __m512 const scale = _mm512_set1_ps(255.0F);
+        __m512i const integer_R = _mm512_cvtps_epi32(_mm512_mul_ps(R, scale));
+        __m512i const integer_G = _mm512_cvtps_epi32(_mm512_mul_ps(G, scale));
+        __m512i const integer_B = _mm512_cvtps_epi32(_mm512_mul_ps(B, scale));
+
+        __m512i const byte_0 = (NTM_PIXEL_FORMAT_B8G8R8A8_UNORM == format) ? integer_B : integer_R;
+        __m512i const byte_2 = (NTM_PIXEL_FORMAT_B8G8R8A8_UNORM == format) ? integer_R : integer_B;
+
+        __m512i const pixel = _mm512_or_si512(_mm512_or_si512(byte_0, _mm512_slli_epi32(integer_G, 8)), _mm512_or_si512(_mm512_slli_epi32(byte_2, 16), _mm512_set1_epi32(static_cast<int>(0XFF000000U))));
+        _mm512_storeu_si512(pixels, pixel);
+    }
+    break;
+    case NTM_PIXEL_FORMAT_R10G10B10A2_UNORM:
+    {
+        __m512 const scale = _mm512_set1_ps(1023.0F);
+        __m512i const integer_R = _mm512_cvtps_epi32(_mm512_mul_ps(R, scale));
+        __m512i const integer_G = _mm512_cvtps_epi32(_mm512_mul_ps(G, scale));
+        __m512i const integer_B = _mm512_cvtps_epi32(_mm512_mul_ps(B, scale));
+
+        __m512i const pixel = _mm512_or_si512(_mm512_or_si512(integer_R, _mm512_slli_epi32(integer_G, 10)), _mm512_or_si512(_mm512_slli_epi32(integer_B, 20), _mm512_set1_epi32(static_cast<int>(0XC0000000U))));
+        _mm512_storeu_si512(pixels, pixel);
+    }
+    break;
+    default:
+    {
+        assert(NTM_PIXEL_FORMAT_R16G16B16A16_SFLOAT == format);
+
+        __m256i const half_R = _mm512_cvtps_ph(R, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256i const half_G = _mm512_cvtps_ph(G, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256i const half_B = _mm512_cvtps_ph(B, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+        ntm_cpu_store_half_RGBAs_avx512(_mm256_castsi256_si128(half_R), _mm256_castsi256_si128(half_G), _mm256_castsi256_si128(half_B), pixels);
+        ntm_cpu_store_half_RGBAs_avx512(_mm256_extracti128_si256(half_R, 1), _mm256_extracti128_si256(half_G, 1), _mm256_extracti128_si256(half_B, 1), pixels + 64);
+    }
+    }
+
+    if (NTM_CPU_BATCH_SIZE != count)
+    {
+        memcpy(out_pixels, scratch_pixels, static_cast<size_t>(pixel_size) * count);
+    }
+}
+
+static inline __m512 ntm_cpu_linear_to_srgb_avx512(__m512 x)
+{
+    // log2(x) = exponent + log2(mantissa) where the mantissa is in [sqrt(1/2), sqrt(2)]
+    __m512i const bits = _mm512_castps_si512(_mm512_max_ps(x, _mm512_set1_ps(NTM_CPU_SRGB_LINEAR_THRESHOLD)));
+    __m512i exponent = _mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(127));
+    __m512 mantissa = _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0X7FFFFF)), _mm512_set1_epi32(0X3F800000)));
+
+    __mmask16 const large = _mm512_cmp_ps_mask(mantissa, _mm512_set1_ps(NTM_CPU_SQRT_2), _CMP_GT_OQ);
+    mantissa = _mm512_mask_mul_ps(mantissa, large, mantissa, _mm512_set1_ps(0.5F));
+    exponent = _mm512_mask_add_epi32(exponent, large, exponent, _mm512_set1_epi32(1));
+
+    // log2(m) = (2 / ln(2)) * atanh(t) where t = (m - 1) / (m + 1) is in [-0.172, 0.172]
+    __m512 const t = _mm512_div_ps(_mm512_sub_ps(mantissa, _mm512_set1_ps(1.0F)), _mm512_add_ps(mantissa, _mm512_set1_ps(1.0F)));
+    __m512 const t2 = _mm512_mul_ps(t, t);
+    __m512 log2_mantissa = _mm512_fmadd_ps(t2, _mm512_set1_ps(NTM_CPU_LOG2_C7), _mm512_set1_ps(NTM_CPU_LOG2_C5));
+    log2_mantissa = _mm512_fmadd_ps(t2, log2_mantissa, _mm512_set1_ps(NTM_CPU_LOG2_C3));
+    log2_mantissa = _mm512_fmadd_ps(t2, log2_mantissa, _mm512_set1_ps(NTM_CPU_LOG2_C1));
+    __m512 const y = _mm512_mul_ps(_mm512_fmadd_ps(t, log2_mantissa, _mm512_cvtepi32_ps(exponent)), _mm512_set1_ps(1.0F / 2.4F));
+
+    // exp2(y) = 2^n * exp(f * ln(2)) where f = y - n is in [-1/2, 1/2]
+    __m512 const n = _mm512_roundscale_ps(y, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512 const z = _mm512_mul_ps(_mm512_sub_ps(y, n), _mm512_set1_ps(NTM_CPU_LN_2));
+    __m512 power = _mm512_fmadd_ps(z, _mm512_set1_ps(1.0F / 720.0F), _mm512_set1_ps(1.0F / 120.0F));
+    power = _mm512_fmadd_ps(z, power, _mm512_set1_ps(1.0F / 24.0F));
+    power = _mm512_fmadd_ps(z, power, _mm512_set1_ps(1.0F / 6.0F));
+    power = _mm512_fmadd_ps(z, power, _mm512_set1_ps(0.5F));
+    power = _mm512_fmadd_ps(z, power, _mm512_set1_ps(1.0F));
+    power = _mm512_fmadd_ps(z, power, _mm512_set1_ps(1.0F));
+    power = _mm512_castsi512_ps(_mm512_add_epi32(_mm512_castps_si512(power), _mm512_slli_epi32(_mm512_cvtps_epi32(n), 23)));
+
+    __m512 const srgb = _mm512_fmsub_ps(_mm512_set1_ps(1.055F), power, _mm512_set1_ps(0.055F));
+    __mmask16 const linear = _mm512_cmp_ps_mask(x, _mm512_set1_ps(NTM_CPU_SRGB_LINEAR_THRESHOLD), _CMP_LE_OQ);
+    return _mm512_mask_mul_ps(srgb, linear, x, _mm512_set1_ps(12.92F));
+}
+
+static inline void ntm_cpu_store_half_RGBAs_avx512(__m128i half_R, __m128i half_G, __m128i half_B, uint8_t *destination)
+{
+    // 1.0
+    __m128i const half_A = _mm_set1_epi16(0X3C00);
+
+    // R0 G0 R1 G1 ... / B0 A0 B1 A1 ...
+    __m128i const RG_0 = _mm_unpacklo_epi16(half_R, half_G);
+    __m128i const RG_1 = _mm_unpackhi_epi16(half_R, half_G);
+    __m128i const BA_0 = _mm_unpacklo_epi16(half_B, half_A);
+    __m128i const BA_1 = _mm_unpackhi_epi16(half_B, half_A);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm_unpacklo_epi32(RG_0, BA_0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + 16), _mm_unpackhi_epi32(RG_0, BA_0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + 32), _mm_unpacklo_epi32(RG_1, BA_1));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + 48), _mm_unpackhi_epi32(RG_1, BA_1));
+}
+
+#endif
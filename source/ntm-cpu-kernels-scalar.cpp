@@ -0,0 +1,411 @@
+#include "ntm-cpu-kernels.h"
+#include <math.h>
+#include <string.h>
+#include <assert.h>
+
+static void ntm_cpu_dense_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_fp16_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_int8_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_sparse_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_dense_fp16_sparse_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+static void ntm_cpu_encode_scalar(uint32_t num_frequencies, uint32_t count, float const (*in_UVs)[2], float *out_features);
+
+static void ntm_cpu_pack_scalar(ntm_pixel_format format, bool linear_to_srgb, uint32_t count, float const *in_RGBs, void *out_pixels);
+
+static inline uint32_t ntm_cpu_active_inputs_scalar(uint32_t input_size, float const *in_activations, uint8_t *out_active_inputs);
+
+static inline float ntm_cpu_half_to_float(uint16_t half);
+
+static inline uint16_t ntm_cpu_float_to_half(float value);
+
+extern ntm_cpu_kernels const ntm_cpu_kernels_scalar = {
+    {ntm_cpu_dense_scalar, ntm_cpu_dense_fp16_scalar, ntm_cpu_dense_int8_scalar},
+    {ntm_cpu_dense_sparse_scalar, ntm_cpu_dense_fp16_sparse_scalar, ntm_cpu_dense_int8_scalar},
+    ntm_cpu_encode_scalar,
+    ntm_cpu_pack_scalar};
+
+static void ntm_cpu_dense_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    float const *const weights = static_cast<float const *>(layer->weights);
+
+    for (uint32_t output_index = 0U; output_index < output_size; ++output_index)
+    {
+        float accumulators[NTM_CPU_BATCH_SIZE];
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            accumulators[lane_index] = layer->biases[output_index];
+        }
+
+        for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+        {
+            float const weight = weights[static_cast<size_t>(output_size) * input_index + output_index];
+            for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+            {
+                accumulators[lane_index] += weight * in_activations[NTM_CPU_BATCH_SIZE * input_index + lane_index];
+            }
+        }
+
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            out_activations[NTM_CPU_BATCH_SIZE * output_index + lane_index] = (relu && (accumulators[lane_index] < 0.0F)) ? 0.0F : accumulators[lane_index];
+        }
+    }
+}
+
+static void ntm_cpu_dense_fp16_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    uint16_t const *const weights = static_cast<uint16_t const *>(layer->weights);
+
+    for (uint32_t output_index = 0U; output_index < output_size; ++output_index)
+    {
+        float accumulators[NTM_CPU_BATCH_SIZE];
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            accumulators[lane_index] = layer->biases[output_index];
+        }
+
+        for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+        {
+            float const weight = ntm_cpu_half_to_float(weights[static_cast<size_t>(output_size) * input_index + output_index]);
+            for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+            {
+                accumulators[lane_index] += weight * in_activations[NTM_CPU_BATCH_SIZE * input_index + lane_index];
+            }
+        }
+
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            out_activations[NTM_CPU_BATCH_SIZE * output_index + lane_index] = (relu && (accumulators[lane_index] < 0.0F)) ? 0.0F : accumulators[lane_index];
+        }
+    }
+}
+
+static void ntm_cpu_dense_int8_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const input_size = layer->input_size;
+    uint32_t const output_size = layer->output_size;
+    uint32_t const num_input_groups = (input_size + 3U) / 4U;
+    int8_t const *const weights = static_cast<int8_t const *>(layer->weights);
+
+    float input_ranges[NTM_CPU_BATCH_SIZE];
+    for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+    {
+        input_ranges[lane_index] = NTM_CPU_INT8_MIN_RANGE;
+    }
+
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            float const activation = in_activations[NTM_CPU_BATCH_SIZE * input_index + lane_index];
+            input_ranges[lane_index] = (activation > input_ranges[lane_index]) ? activation : input_ranges[lane_index];
+        }
+    }
+
+    // [4 * num_input_groups][NTM_CPU_BATCH_SIZE] (the missing inputs are zero)
+    int32_t quantized_activations[NTM_MAX_LAYER_WIDTH * NTM_CPU_BATCH_SIZE];
+    {
+        float input_scales[NTM_CPU_BATCH_SIZE];
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            input_scales[lane_index] = 255.0F / input_ranges[lane_index];
+        }
+
+        for (uint32_t input_index = 0U; input_index < (4U * num_input_groups); ++input_index)
+        {
+            for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+            {
+                // round to nearest even (the same as the "cvtps2dq")
+                quantized_activations[NTM_CPU_BATCH_SIZE * input_index + lane_index] = (input_index < input_size) ? static_cast<int32_t>(nearbyintf(in_activations[NTM_CPU_BATCH_SIZE * input_index + lane_index] * input_scales[lane_index])) : 0;
+            }
+        }
+    }
+
+    for (uint32_t output_index = 0U; output_index < output_size; ++output_index)
+    {
+        int32_t accumulators[NTM_CPU_BATCH_SIZE] = {};
+
+        for (uint32_t input_group_index = 0U; input_group_index < num_input_groups; ++input_group_index)
+        {
+            int8_t const *const weight_group = weights + 4U * (static_cast<size_t>(output_size) * input_group_index + output_index);
+            for (uint32_t input_subindex = 0U; input_subindex < 4U; ++input_subindex)
+            {
+                int32_t const weight = weight_group[input_subindex];
+                for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+                {
+                    accumulators[lane_index] += weight * quantized_activations[NTM_CPU_BATCH_SIZE * (4U * input_group_index + input_subindex) + lane_index];
+                }
+            }
+        }
+
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            float const value = static_cast<float>(accumulators[lane_index]) * ((input_ranges[lane_index] * (1.0F / 255.0F)) * layer->scales[output_index]) + layer->biases[output_index];
+            out_activations[NTM_CPU_BATCH_SIZE * output_index + lane_index] = (relu && (value < 0.0F)) ? 0.0F : value;
+        }
+    }
+}
+
+static void ntm_cpu_dense_sparse_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const output_size = layer->output_size;
+    float const *const weights = static_cast<float const *>(layer->weights);
+
+    uint8_t active_inputs[NTM_MAX_LAYER_WIDTH];
+    uint32_t const num_active_inputs = ntm_cpu_active_inputs_scalar(layer->input_size, in_activations, active_inputs);
+
+    for (uint32_t output_index = 0U; output_index < output_size; ++output_index)
+    {
+        float accumulators[NTM_CPU_BATCH_SIZE];
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            accumulators[lane_index] = layer->biases[output_index];
+        }
+
+        for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+        {
+            uint32_t const input_index = active_inputs[active_index];
+            float const weight = weights[static_cast<size_t>(output_size) * input_index + output_index];
+            for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+            {
+                accumulators[lane_index] += weight * in_activations[NTM_CPU_BATCH_SIZE * input_index + lane_index];
+            }
+        }
+
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            out_activations[NTM_CPU_BATCH_SIZE * output_index + lane_index] = (relu && (accumulators[lane_index] < 0.0F)) ? 0.0F : accumulators[lane_index];
+        }
+    }
+}
+
+static void ntm_cpu_dense_fp16_sparse_scalar(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations)
+{
+    uint32_t const output_size = layer->output_size;
+    uint16_t const *const weights = static_cast<uint16_t const *>(layer->weights);
+
+    uint8_t active_inputs[NTM_MAX_LAYER_WIDTH];
+    uint32_t const num_active_inputs = ntm_cpu_active_inputs_scalar(layer->input_size, in_activations, active_inputs);
+
+    for (uint32_t output_index = 0U; output_index < output_size; ++output_index)
+    {
+        float accumulators[NTM_CPU_BATCH_SIZE];
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            accumulators[lane_index] = layer->biases[output_index];
+        }
+
+        for (uint32_t active_index = 0U; active_index < num_active_inputs; ++active_index)
+        {
+            uint32_t const input_index = active_inputs[active_index];
+            float const weight = ntm_cpu_half_to_float(weights[static_cast<size_t>(output_size) * input_index + output_index]);
+            for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+            {
+                accumulators[lane_index] += weight * in_activations[NTM_CPU_BATCH_SIZE * input_index + lane_index];
+            }
+        }
+
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            out_activations[NTM_CPU_BATCH_SIZE * output_index + lane_index] = (relu && (accumulators[lane_index] < 0.0F)) ? 0.0F : accumulators[lane_index];
+        }
+    }
+}
+
+// The reference of the SIMD kernels: the "sinf" and "cosf" of the C runtime are evaluated for each frequency.
+static void ntm_cpu_encode_scalar(uint32_t num_frequencies, uint32_t count, float const (*in_UVs)[2], float *out_features)
+{
+    assert(count >= 1U && count <= NTM_CPU_BATCH_SIZE);
+
+    for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+    {
+        // the unused lanes replicate the last pixel
+        uint32_t const pixel_index = (lane_index < count) ? lane_index : (count - 1U);
+        float const U = in_UVs[pixel_index][0];
+        float const V = in_UVs[pixel_index][1];
+
+        for (uint32_t frequency_index = 0U; frequency_index < num_frequencies; ++frequency_index)
+        {
+            // "(1 << i) * pi" is exact and only the product with the UV is rounded, which is the same as the float32 TensorFlow graph
+            float const frequency = static_cast<float>(1U << frequency_index) * NTM_PI;
+            float const frequency_U = frequency * U;
+            float const frequency_V = frequency * V;
+
+            out_features[NTM_CPU_BATCH_SIZE * (4U * frequency_index) + lane_index] = sinf(frequency_U);
+            out_features[NTM_CPU_BATCH_SIZE * (4U * frequency_index + 1U) + lane_index] = sinf(frequency_V);
+            out_features[NTM_CPU_BATCH_SIZE * (4U * frequency_index + 2U) + lane_index] = cosf(frequency_U);
+            out_features[NTM_CPU_BATCH_SIZE * (4U * frequency_index + 3U) + lane_index] = cosf(frequency_V);
+        }
+    }
+}
+
+static void ntm_cpu_pack_scalar(ntm_pixel_format format, bool linear_to_srgb, uint32_t count, float const *in_RGBs, void *out_pixels)
+{
+    assert(count >= 1U && count <= NTM_CPU_BATCH_SIZE);
+
+    for (uint32_t lane_index = 0U; lane_index < count; ++lane_index)
+    {
+        float RGB[3];
+        for (uint32_t channel_index = 0U; channel_index < 3U; ++channel_index)
+        {
+            float const value = in_RGBs[NTM_CPU_BATCH_SIZE * channel_index + lane_index];
+
+            // NaN is clamped to 0
+            float clamped_value = (value > 0.0F) ? ((value < 1.0F) ? value : 1.0F) : 0.0F;
+
+            if (linear_to_srgb)
+            {
+                clamped_value = (clamped_value <= NTM_CPU_SRGB_LINEAR_THRESHOLD) ? (12.92F * clamped_value) : (1.055F * powf(clamped_value, 1.0F / 2.4F) - 0.055F);
+            }
+
+            RGB[channel_index] = clamped_value;
+        }
+
+        switch (format)
+        {
+        case NTM_PIXEL_FORMAT_B8G8R8A8_UNORM:
+        case NTM_PIXEL_FORMAT_R8G8B8A8_UNORM:
+        {
+            uint32_t const R = static_cast<uint32_t>(lrintf(RGB[0] * 255.0F));
+            uint32_t const G = static_cast<uint32_t>(lrintf(RGB[1] * 255.0F));
+            uint32_t const B = static_cast<uint32_t>(lrintf(RGB[2] * 255.0F));
+
+            uint8_t *const pixel = static_cast<uint8_t *>(out_pixels) + 4U * lane_index;
+            pixel[0] = static_cast<uint8_t>((NTM_PIXEL_FORMAT_B8G8R8A8_UNORM == format) ? B : R);
+            pixel[1] = static_cast<uint8_t>(G);
+            pixel[2] = static_cast<uint8_t>((NTM_PIXEL_FORMAT_B8G8R8A8_UNORM == format) ? R : B);
+            pixel[3] = 255U;
+        }
+        break;
+        case NTM_PIXEL_FORMAT_R10G10B10A2_UNORM:
+        {
+            uint32_t const R = static_cast<uint32_t>(lrintf(RGB[0] * 1023.0F));
+            uint32_t const G = static_cast<uint32_t>(lrintf(RGB[1] * 1023.0F));
+            uint32_t const B = static_cast<uint32_t>(lrintf(RGB[2] * 1023.0F));
+
+            uint32_t const pixel = R | (G << 10) | (B << 20) | (3U << 30);
+            memcpy(static_cast<uint8_t *>(out_pixels) + 4U * lane_index, &pixel, sizeof(uint32_t));
+        }
+        break;
+        default:
+        {
+            assert(NTM_PIXEL_FORMAT_R16G16B16A16_SFLOAT == format);
+
+            uint16_t const pixel[4] = {ntm_cpu_float_to_half(RGB[0]), ntm_cpu_float_to_half(RGB[1]), ntm_cpu_float_to_half(RGB[2]), 0X3C00U};
+            memcpy(static_cast<uint8_t *>(out_pixels) + 8U * lane_index, pixel, sizeof(pixel));
+        }
+        }
+    }
+}
+
+// The indices of the inputs which are NOT zero (neither +0 nor -0) for at least one lane of the batch.
+static inline uint32_t ntm_cpu_active_inputs_scalar(uint32_t input_size, float const *in_activations, uint8_t *out_active_inputs)
+{
+    uint32_t num_active_inputs = 0U;
+    for (uint32_t input_index = 0U; input_index < input_size; ++input_index)
+    {
+        bool active = false;
+        for (uint32_t lane_index = 0U; lane_index < NTM_CPU_BATCH_SIZE; ++lane_index)
+        {
+            // NaN is NOT equal to zero, and thus is active
+            active = active || (0.0F != in_activations[NTM_CPU_BATCH_SIZE * input_index + lane_index]);
+        }
+
+        if (active)
+        {
+            out_active_inputs[num_active_inputs] = static_cast<uint8_t>(input_index);
+            ++num_active_inputs;
+        }
+    }
+    return num_active_inputs;
+}
+
+static inline float ntm_cpu_half_to_float(uint16_t half)
+{
+    uint32_t const sign = static_cast<uint32_t>(half & 0X8000U) << 16;
+    uint32_t const exponent = (half >> 10) & 0X1FU;
+    uint32_t const mantissa = half & 0X3FFU;
+
+    float magnitude;
+    if (0U == exponent)
+    {
+        // zero or subnormal
+        magnitude = ldexpf(static_cast<float>(mantissa), -24);
+    }
+    else if (0X1FU == exponent)
+    {
+        magnitude = (0U == mantissa) ? HUGE_VALF : NAN;
+    }
+    else
+    {
+        magnitude = ldexpf(static_cast<float>(mantissa | 0X400U), static_cast<int>(exponent) - 25);
+    }
+
+    uint32_t bits;
+    memcpy(&bits, &magnitude, sizeof(float));
+    bits |= sign;
+
+    float value;
+    memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+static inline uint16_t ntm_cpu_float_to_half(float value)
+{
+    // round to the nearest even, the same as the "vcvtps2ph" (imm8 = 0)
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(float));
+
+    uint16_t const sign = static_cast<uint16_t>((bits >> 16) & 0X8000U);
+    int32_t const exponent = static_cast<int32_t>((bits >> 23) & 0XFFU) - 127;
+    uint32_t const mantissa = bits & 0X7FFFFFU;
+
+    if (128 == exponent)
+    {
+        // Inf or NaN
+        return static_cast<uint16_t>(sign | 0X7C00U | ((0U != mantissa) ? 0X200U : 0U));
+    }
+    else if (exponent > 15)
+    {
+        // overflow
+        return static_cast<uint16_t>(sign | 0X7C00U);
+    }
+    else if (exponent >= -14)
+    {
+        // normal (the carry of the rounding may propagate into the exponent, which is still correct)
+        uint32_t half = (static_cast<uint32_t>(exponent + 15) << 10) | (mantissa >> 13);
+        uint32_t const remainder = mantissa & 0X1FFFU;
+        if ((remainder > 0X1000U) || ((0X1000U == remainder) && (0U != (half & 1U))))
+        {
+            ++half;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+    else if (exponent >= -25)
+    {
+        // subnormal
+        uint32_t const significand = mantissa | 0X800000U;
+        uint32_t const shift = static_cast<uint32_t>(-1 - exponent);
+        uint32_t half = significand >> shift;
+        uint32_t const remainder = significand & ((1U << shift) - 1U);
+        uint32_t const halfway = 1U << (shift - 1U);
+        if ((remainder > halfway) || ((remainder == halfway) && (0U != (half & 1U))))
+        {
+            ++half;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+    else
+    {
+        return sign;
+    }
+}
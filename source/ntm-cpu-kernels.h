@@ -0,0 +1,87 @@
+#ifndef _NTM_CPU_KERNELS_H_
+#define _NTM_CPU_KERNELS_H_ 1
+
+#include "ntm-cpu-inference.h"
+
+// NOTE: this header is included by the translation units which are compiled with the ISA specific flags (e.g. "-mavx2").
+// Do NOT include any header which may instantiate the inline functions (e.g. the STL) here, since the linker may pick the ISA specific instance for the generic code.
+
+// The number of the pixels which are evaluated together.
+static constexpr uint32_t const NTM_CPU_BATCH_SIZE = 16;
+
+// The activations of one batch are stored as [neuron][NTM_CPU_BATCH_SIZE], namely, each SIMD lane evaluates one pixel.
+// The activations must be aligned to 64 bytes.
+typedef void (*ntm_cpu_dense_kernel)(ntm_layer const *layer, bool relu, float const *in_activations, float *out_activations);
+
+// INT8: the inputs (non-negative, since the INT8 is NOT allowed for the 1st layer) are quantized to [0, 255] for each lane (pixel) by the maximum of the inputs of this lane, and the dot products are in int32 (exact).
+// Namely, "output = (float(int32 dot product) * (input maximum / 255) * scale) + bias", and all ISAs (even with or without the VNNI) evaluate the same integer dot products.
+// The maximum is clamped to NTM_CPU_INT8_MIN_RANGE such that the inputs which are all zero are still quantized to zero.
+static constexpr float const NTM_CPU_INT8_MIN_RANGE = 1E-30F;
+
+// [sin(f0 * U), sin(f0 * V), cos(f0 * U), cos(f0 * V), sin(f1 * U), ...] ([4 * num_frequencies][NTM_CPU_BATCH_SIZE]) which is the same as the "PositionalEncodingLayer"
+// The unused lanes (count < NTM_CPU_BATCH_SIZE) replicate the last pixel.
+typedef void (*ntm_cpu_encode_kernel)(uint32_t num_frequencies, uint32_t count, float const (*in_UVs)[2], float *out_features);
+
+// The output stage: [R, G, B][NTM_CPU_BATCH_SIZE] -> "count" pixels of the "format" which are contiguous.
+typedef void (*ntm_cpu_pack_kernel)(ntm_pixel_format format, bool linear_to_srgb, uint32_t count, float const *in_RGBs, void *out_pixels);
+
+struct ntm_cpu_kernels
+{
+    // indexed by the "ntm_coefficient_type" of the layer
+    ntm_cpu_dense_kernel dense[NTM_COEFFICIENT_TYPE_COUNT];
+    // The same as the "dense" except that the inputs which are zero for all the lanes of the batch (e.g. the dead ReLU neurons) are skipped, namely, neither the weights nor the activations of these inputs are loaded.
+    // Since the products of these inputs are zero, the outputs are the same as the "dense".
+    // NOTE: the INT8 is merely the "dense", since the inputs are quantized in groups of 4.
+    ntm_cpu_dense_kernel dense_sparse[NTM_COEFFICIENT_TYPE_COUNT];
+    ntm_cpu_encode_kernel encode;
+    ntm_cpu_pack_kernel pack;
+};
+
+// The sparse kernels store the indices of the active inputs as uint8_t.
+static_assert((NTM_MAX_LAYER_WIDTH <= 256U) && ((4U * NTM_MAX_FREQUENCIES) <= 256U), "the index of the input fits in uint8_t");
+
+// the same as "tensorflow.constant(numpy.pi)" (float32)
+static constexpr float const NTM_PI = 3.14159265358979323846F;
+
+// The argument of the frequency i is "float(1 << i) * pi * U" where "(1 << i) * pi" is exact, namely, the argument of the frequency i is exactly 2^i times the argument of the frequency 0.
+// Thus, the SIMD kernels merely evaluate sin/cos of one frequency and derive the next frequencies by the double-angle recurrences:
+// sin(2a) = 2 * sin(a) * cos(a)
+// cos(2a) = (cos(a) - sin(a)) * (cos(a) + sin(a))
+// Since the absolute error is (at most) about doubled by each recurrence, sin/cos is evaluated again (re-seeded) every NTM_CPU_ENCODE_RESEED_PERIOD frequencies.
+static constexpr uint32_t const NTM_CPU_ENCODE_RESEED_PERIOD = 4;
+
+// The range reduction "a = k * (pi / 2) + r" is in double precision, and thus is accurate for all the arguments of NTM_MAX_FREQUENCIES.
+static constexpr double const NTM_CPU_PI_OVER_2_HI = 1.57079632679489655800e+00;
+static constexpr double const NTM_CPU_PI_OVER_2_LO = 6.12323399573676603587e-17;
+static constexpr double const NTM_CPU_2_OVER_PI = 6.36619772367581382433e-01;
+
+// The minimax polynomials on [-pi/4, pi/4] (Cephes "sinf" and "cosf")
+static constexpr float const NTM_CPU_SIN_C0 = -1.6666654611E-1F;
+static constexpr float const NTM_CPU_SIN_C1 = 8.3321608736E-3F;
+static constexpr float const NTM_CPU_SIN_C2 = -1.9515295891E-4F;
+static constexpr float const NTM_CPU_COS_C0 = 4.166664568298827E-2F;
+static constexpr float const NTM_CPU_COS_C1 = -1.388731625493765E-3F;
+static constexpr float const NTM_CPU_COS_C2 = 2.443315711809948E-5F;
+
+// sRGB = (x <= NTM_CPU_SRGB_LINEAR_THRESHOLD) ? (12.92 * x) : (1.055 * x^(1 / 2.4) - 0.055)
+// The SIMD kernels evaluate the x^(1 / 2.4) by "exp2(log2(x) / 2.4)" where the log2 is the atanh series of the mantissa (in [sqrt(1/2), sqrt(2)]) and the exp2 is the Taylor series of the fraction (in [-1/2, 1/2]).
+static constexpr float const NTM_CPU_SRGB_LINEAR_THRESHOLD = 0.0031308F;
+static constexpr float const NTM_CPU_SQRT_2 = 1.41421356237309504880F;
+// 2 / ln(2)
+static constexpr float const NTM_CPU_LOG2_C1 = 2.88539008177792681472F;
+static constexpr float const NTM_CPU_LOG2_C3 = NTM_CPU_LOG2_C1 / 3.0F;
+static constexpr float const NTM_CPU_LOG2_C5 = NTM_CPU_LOG2_C1 / 5.0F;
+static constexpr float const NTM_CPU_LOG2_C7 = NTM_CPU_LOG2_C1 / 7.0F;
+static constexpr float const NTM_CPU_LN_2 = 0.69314718055994530942F;
+
+extern ntm_cpu_kernels const ntm_cpu_kernels_scalar;
+
+#if defined(__x86_64__) || defined(_M_X64)
+extern ntm_cpu_kernels const ntm_cpu_kernels_avx2;
+
+extern ntm_cpu_kernels const ntm_cpu_kernels_avx512;
+
+extern ntm_cpu_kernels const ntm_cpu_kernels_avx512_vnni;
+#endif
+
+#endif
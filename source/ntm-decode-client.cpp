@@ -0,0 +1,256 @@
+#include "ntm-decode-client.h"
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <assert.h>
+#include <new>
+#include <vector>
+
+struct ntm_decode_client_buffer
+{
+    uint32_t buffer_id;
+    void *memory;
+    size_t size;
+};
+
+struct ntm_decode_client
+{
+    int socket_fd;
+    uint32_t next_buffer_id;
+    uint32_t next_request_id;
+    std::vector<ntm_decode_client_buffer> buffers;
+};
+
+static inline bool ntm_decode_client_send(ntm_decode_client *client, ntm_decode_message const *message, int fd);
+
+extern ntm_decode_client *ntm_decode_client_connect(char const *socket_path)
+{
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(address.sun_path))
+    {
+        return NULL;
+    }
+    strcpy(address.sun_path, socket_path);
+
+    int const socket_fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (-1 == socket_fd)
+    {
+        return NULL;
+    }
+
+    if (-1 == connect(socket_fd, reinterpret_cast<sockaddr const *>(&address), sizeof(address)))
+    {
+        close(socket_fd);
+        return NULL;
+    }
+
+    ntm_decode_client *client = new (std::nothrow) ntm_decode_client;
+    if (NULL == client)
+    {
+        close(socket_fd);
+        return NULL;
+    }
+
+    client->socket_fd = socket_fd;
+    client->next_buffer_id = 1U;
+    client->next_request_id = 1U;
+
+    return client;
+}
+
+extern void ntm_decode_client_disconnect(ntm_decode_client *client)
+{
+    // the daemon unmaps the buffers after the pending requests have been dropped
+    close(client->socket_fd);
+
+    for (ntm_decode_client_buffer const &buffer : client->buffers)
+    {
+        munmap(buffer.memory, buffer.size);
+    }
+
+    delete client;
+}
+
+extern void *ntm_decode_client_create_buffer(ntm_decode_client *client, size_t size, uint32_t *out_buffer_id)
+{
+    assert(size >= 1U);
+
+    // The daemon writes into the mapping, and thus the buffer is sealed against shrinking (otherwise the daemon would be killed by the SIGBUS).
+    int const memfd = memfd_create("ntm-decode-buffer", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (-1 == memfd)
+    {
+        return NULL;
+    }
+
+    if ((-1 == ftruncate(memfd, static_cast<off_t>(size))) || (-1 == fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL)))
+    {
+        close(memfd);
+        return NULL;
+    }
+
+    void *const memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    if (MAP_FAILED == memory)
+    {
+        close(memfd);
+        return NULL;
+    }
+
+    ntm_decode_message message = {};
+    message.version = NTM_DECODE_PROTOCOL_VERSION;
+    message.type = NTM_DECODE_MESSAGE_MAP_BUFFER;
+    message.buffer_id = client->next_buffer_id;
+    message.buffer_size = size;
+
+    // the daemon holds its own reference to the memfd
+    bool const result_send = ntm_decode_client_send(client, &message, memfd);
+    close(memfd);
+
+    if (!result_send)
+    {
+        munmap(memory, size);
+        return NULL;
+    }
+
+    ntm_decode_client_buffer buffer;
+    buffer.buffer_id = client->next_buffer_id;
+    buffer.memory = memory;
+    buffer.size = size;
+    client->buffers.push_back(buffer);
+
+    ++client->next_buffer_id;
+
+    (*out_buffer_id) = buffer.buffer_id;
+    return memory;
+}
+
+extern void ntm_decode_client_destroy_buffer(ntm_decode_client *client, uint32_t buffer_id)
+{
+    for (size_t buffer_index = 0U; buffer_index < client->buffers.size(); ++buffer_index)
+    {
+        if (buffer_id == client->buffers[buffer_index].buffer_id)
+        {
+            ntm_decode_message message = {};
+            message.version = NTM_DECODE_PROTOCOL_VERSION;
+            message.type = NTM_DECODE_MESSAGE_UNMAP_BUFFER;
+            message.buffer_id = buffer_id;
+            ntm_decode_client_send(client, &message, -1);
+
+            munmap(client->buffers[buffer_index].memory, client->buffers[buffer_index].size);
+            client->buffers.erase(client->buffers.begin() + buffer_index);
+            return;
+        }
+    }
+
+    assert(false);
+}
+
+extern bool ntm_decode_client_submit(ntm_decode_client *client, ntm_decode_client_request const *request, uint32_t *out_request_id)
+{
+    size_t const name_size = strlen(request->texture_name);
+    if (name_size >= NTM_DECODE_MAX_NAME_SIZE)
+    {
+        return false;
+    }
+
+    ntm_decode_message message = {};
+    message.version = NTM_DECODE_PROTOCOL_VERSION;
+    message.type = NTM_DECODE_MESSAGE_DECODE;
+    message.request_id = client->next_request_id;
+    message.buffer_id = request->buffer_id;
+    message.buffer_offset = request->buffer_offset;
+    message.row_pitch = request->row_pitch;
+    memcpy(message.texture_name, request->texture_name, name_size);
+    message.width = request->width;
+    message.height = request->height;
+    message.mip_level = request->mip_level;
+    message.region_x = request->region_x;
+    message.region_y = request->region_y;
+    message.region_width = request->region_width;
+    message.region_height = request->region_height;
+    message.pixel_format = static_cast<uint32_t>(request->encoding.format);
+    message.linear_to_srgb = request->encoding.linear_to_srgb ? 1U : 0U;
+    message.priority = request->priority;
+    message.deadline_microseconds = request->deadline_microseconds;
+
+    if (!ntm_decode_client_send(client, &message, -1))
+    {
+        return false;
+    }
+
+    // zero is NOT used
+    ++client->next_request_id;
+    client->next_request_id += ((0U == client->next_request_id) ? 1U : 0U);
+
+    (*out_request_id) = message.request_id;
+    return true;
+}
+
+extern bool ntm_decode_client_wait(ntm_decode_client *client, uint32_t *out_request_id, ntm_decode_status *out_status)
+{
+    while (true)
+    {
+        ntm_decode_message message;
+        ssize_t const result_recv = recv(client->socket_fd, &message, sizeof(message), 0);
+        if ((-1 == result_recv) && (EINTR == errno))
+        {
+            continue;
+        }
+
+        if ((sizeof(message) != static_cast<size_t>(result_recv)) || (NTM_DECODE_PROTOCOL_VERSION != message.version) || (NTM_DECODE_MESSAGE_COMPLETE != message.type))
+        {
+            // 0: the daemon has exited
+            return false;
+        }
+
+        (*out_request_id) = message.request_id;
+        (*out_status) = static_cast<ntm_decode_status>(message.status);
+        return true;
+    }
+}
+
+static inline bool ntm_decode_client_send(ntm_decode_client *client, ntm_decode_message const *message, int fd)
+{
+    iovec io_vector;
+    io_vector.iov_base = const_cast<ntm_decode_message *>(message);
+    io_vector.iov_len = sizeof(ntm_decode_message);
+
+    union
+    {
+        cmsghdr header;
+        char data[CMSG_SPACE(sizeof(int))];
+    } control;
+
+    msghdr message_header = {};
+    message_header.msg_iov = &io_vector;
+    message_header.msg_iovlen = 1;
+
+    if (-1 != fd)
+    {
+        memset(&control, 0, sizeof(control));
+        message_header.msg_control = control.data;
+        message_header.msg_controllen = sizeof(control.data);
+
+        cmsghdr *const control_header = CMSG_FIRSTHDR(&message_header);
+        control_header->cmsg_level = SOL_SOCKET;
+        control_header->cmsg_type = SCM_RIGHTS;
+        control_header->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(control_header), &fd, sizeof(int));
+    }
+
+    while (true)
+    {
+        ssize_t const result_send = sendmsg(client->socket_fd, &message_header, MSG_NOSIGNAL);
+        if ((-1 == result_send) && (EINTR == errno))
+        {
+            continue;
+        }
+
+        return (sizeof(ntm_decode_message) == static_cast<size_t>(result_send));
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef _NTM_DECODE_CLIENT_H_
+#define _NTM_DECODE_CLIENT_H_ 1
+
+#include "ntm-decode-protocol.h"
+#include "ntm-cpu-inference.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// The client of the decode daemon ("--daemon"), namely, the process neither embeds the TFLite nor loads the model.
+// NOTE: the client is NOT thread-safe, and each thread should connect separately.
+struct ntm_decode_client;
+
+struct ntm_decode_client_request
+{
+    // the name of the texture in the pack of the daemon
+    char const *texture_name;
+    // the resolution of the level 0
+    uint32_t width;
+    uint32_t height;
+    uint32_t mip_level;
+    // the region of the mip level
+    uint32_t region_x;
+    uint32_t region_y;
+    uint32_t region_width;
+    uint32_t region_height;
+    ntm_pixel_encoding encoding;
+    int32_t priority;
+    // 0: no deadline
+    uint32_t deadline_microseconds;
+    // The texel (region_x + i, region_y + j) is written to "buffer + buffer_offset + row_pitch * j + ntm_pixel_format_size(format) * i".
+    uint32_t buffer_id;
+    size_t buffer_offset;
+    size_t row_pitch;
+};
+
+// NULL: the daemon is NOT running
+extern ntm_decode_client *ntm_decode_client_connect(char const *socket_path);
+
+// The buffers are unmapped, and the completions of the pending requests are discarded (the daemon still writes into its own mappings of the buffers).
+extern void ntm_decode_client_disconnect(ntm_decode_client *client);
+
+// The buffer (memfd) is mapped by both the client and the daemon, and the daemon writes the decoded pixels into it directly.
+// NULL: the buffer can NOT be created (or sent to the daemon)
+extern void *ntm_decode_client_create_buffer(ntm_decode_client *client, size_t size, uint32_t *out_buffer_id);
+
+// NOTE: the daemon still writes into the buffer until the pending requests (of this buffer) have been completed, while the memory of the client is unmapped immediately.
+extern void ntm_decode_client_destroy_buffer(ntm_decode_client *client, uint32_t buffer_id);
+
+// The request is merely sent to the daemon, and the completion is received by the "ntm_decode_client_wait".
+extern bool ntm_decode_client_submit(ntm_decode_client *client, ntm_decode_client_request const *request, uint32_t *out_request_id);
+
+// Blocks until the next request has been completed (the requests are completed in the order of the priority rather than the submission).
+// false: the daemon has exited
+extern bool ntm_decode_client_wait(ntm_decode_client *client, uint32_t *out_request_id, ntm_decode_status *out_status);
+
+#endif
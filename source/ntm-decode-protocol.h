@@ -0,0 +1,81 @@
+#ifndef _NTM_DECODE_PROTOCOL_H_
+#define _NTM_DECODE_PROTOCOL_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The protocol between the decode daemon ("--daemon") and the clients ("ntm-decode-client.h") on the same machine.
+// The socket is the Unix domain SOCK_SEQPACKET, and thus each message is exactly one "ntm_decode_message" (the boundaries are preserved).
+// The pixels never cross the socket: the client shares the buffers (memfd) with the daemon, and the daemon writes the decoded pixels into these buffers directly.
+static constexpr uint32_t const NTM_DECODE_PROTOCOL_VERSION = 1U;
+
+// including the null terminator
+static constexpr uint32_t const NTM_DECODE_MAX_NAME_SIZE = 128U;
+
+enum ntm_decode_message_type
+{
+    // client -> daemon: the memfd of the buffer is attached (SCM_RIGHTS), and it must be sealed against shrinking (F_SEAL_SHRINK)
+    NTM_DECODE_MESSAGE_MAP_BUFFER = 0,
+    // client -> daemon: the buffer is unmapped after all the requests which write into it have been completed
+    NTM_DECODE_MESSAGE_UNMAP_BUFFER = 1,
+    // client -> daemon
+    NTM_DECODE_MESSAGE_DECODE = 2,
+    // daemon -> client: one for each "DECODE" (in the order of the completion rather than the submission)
+    NTM_DECODE_MESSAGE_COMPLETE = 3
+};
+
+enum ntm_decode_status
+{
+    NTM_DECODE_STATUS_SUCCESS = 0,
+    // the name is NOT in the pack of the daemon
+    NTM_DECODE_STATUS_UNKNOWN_TEXTURE = 1,
+    // the region is NOT within the mip level (or the mip level is NOT within the chain)
+    NTM_DECODE_STATUS_INVALID_REGION = 2,
+    NTM_DECODE_STATUS_INVALID_FORMAT = 3,
+    // the buffer has NOT been mapped (or the daemon failed to map it)
+    NTM_DECODE_STATUS_UNKNOWN_BUFFER = 4,
+    // the region (with the row pitch) exceeds the buffer
+    NTM_DECODE_STATUS_OUT_OF_BUFFER = 5
+};
+
+// All the messages are the same size, and the fields which are NOT used by the type are zero.
+struct ntm_decode_message
+{
+    uint32_t version;
+    // ntm_decode_message_type
+    uint32_t type;
+    // DECODE / COMPLETE: chosen by the client
+    uint32_t request_id;
+    // MAP_BUFFER / UNMAP_BUFFER / DECODE: chosen by the client
+    uint32_t buffer_id;
+    // MAP_BUFFER
+    uint64_t buffer_size;
+
+    // DECODE: the texel (region_x + i, region_y + j) is written to "buffer + buffer_offset + row_pitch * j + ntm_pixel_format_size(pixel_format) * i"
+    uint64_t buffer_offset;
+    uint64_t row_pitch;
+    // DECODE: the name of the texture in the pack (null-terminated)
+    char texture_name[NTM_DECODE_MAX_NAME_SIZE];
+    // DECODE: the resolution of the level 0, and the region of the mip level (of which the resolution is "max(1, width >> mip_level)" x "max(1, height >> mip_level)")
+    uint32_t width;
+    uint32_t height;
+    uint32_t mip_level;
+    uint32_t region_x;
+    uint32_t region_y;
+    uint32_t region_width;
+    uint32_t region_height;
+    // DECODE: ntm_pixel_format, and the sRGB transfer function (0 or 1)
+    uint32_t pixel_format;
+    uint32_t linear_to_srgb;
+    // DECODE: the same as the "ntm_decode_request"
+    int32_t priority;
+    // DECODE: relative to the reception by the daemon (0: no deadline)
+    uint32_t deadline_microseconds;
+
+    // COMPLETE: ntm_decode_status
+    uint32_t status;
+};
+
+static_assert(216U == sizeof(ntm_decode_message), "the layout of the message is fixed");
+
+#endif
@@ -0,0 +1,304 @@
+#include "ntm-decode-scheduler.h"
+#include "ntm-thread-pool.h"
+#include <assert.h>
+#include <new>
+#include <mutex>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+struct ntm_decode_scheduler_request
+{
+    ntm_decode_request request;
+    uint64_t sequence;
+    uint32_t num_tiles_x;
+    uint32_t num_tiles;
+    // the tiles [0, next_tile) have been dispatched
+    uint32_t next_tile;
+};
+
+struct ntm_decode_scheduler_tile
+{
+    // index into the "dispatched_requests"
+    uint32_t request_index;
+    uint32_t tile_index;
+};
+
+struct ntm_decode_scheduler
+{
+    ntm_thread_pool *thread_pool;
+
+    // submitted by any thread
+    std::mutex pending_mutex;
+    std::vector<ntm_decode_scheduler_request> submitted_requests;
+    uint64_t next_sequence;
+
+    // merely accessed by the thread which calls the "ntm_decode_scheduler_dispatch"
+    std::vector<ntm_decode_scheduler_request> pending_requests;
+    std::vector<ntm_decode_scheduler_request const *> dispatched_requests;
+    // for each dispatched request, the index of the first dispatched request of the same texture (the same "engine")
+    std::vector<uint32_t> dispatched_textures;
+    std::vector<ntm_decode_scheduler_tile> tiles;
+
+    std::mutex statistics_mutex;
+    ntm_decode_scheduler_statistics statistics;
+};
+
+static void ntm_decode_scheduler_tile_task(void *user_data, uint32_t worker_index, uint32_t task_index);
+
+static inline bool ntm_decode_scheduler_request_less(ntm_decode_scheduler_request const &left, ntm_decode_scheduler_request const &right);
+
+static inline int ntm_decode_scheduler_compare_shape(ntm_model const *left, ntm_model const *right);
+
+extern ntm_decode_scheduler *ntm_decode_scheduler_create(uint32_t num_threads)
+{
+    ntm_decode_scheduler *scheduler = new (std::nothrow) ntm_decode_scheduler;
+    if (NULL == scheduler)
+    {
+        return NULL;
+    }
+
+    scheduler->thread_pool = ntm_thread_pool_create(num_threads);
+    if (NULL == scheduler->thread_pool)
+    {
+        delete scheduler;
+        return NULL;
+    }
+
+    scheduler->next_sequence = 0U;
+
+    scheduler->statistics.completed_requests = 0U;
+    scheduler->statistics.missed_deadlines = 0U;
+    scheduler->statistics.decoded_tiles = 0U;
+    scheduler->statistics.batches = 0U;
+
+    return scheduler;
+}
+
+extern void ntm_decode_scheduler_destroy(ntm_decode_scheduler *scheduler)
+{
+    ntm_thread_pool_destroy(scheduler->thread_pool);
+
+    delete scheduler;
+}
+
+extern uint64_t ntm_decode_scheduler_now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+extern void ntm_decode_scheduler_submit(ntm_decode_scheduler *scheduler, ntm_decode_request const *request)
+{
+    assert(NULL != request->engine);
+    assert((request->width >= 1U) && (request->height >= 1U));
+    assert((request->x < request->texture_width) && (request->width <= (request->texture_width - request->x)));
+    assert((request->y < request->texture_height) && (request->height <= (request->texture_height - request->y)));
+
+    ntm_decode_scheduler_request scheduler_request;
+    scheduler_request.request = (*request);
+    scheduler_request.num_tiles_x = (request->width + NTM_DECODE_SCHEDULER_TILE_SIZE - 1U) / NTM_DECODE_SCHEDULER_TILE_SIZE;
+    scheduler_request.num_tiles = scheduler_request.num_tiles_x * ((request->height + NTM_DECODE_SCHEDULER_TILE_SIZE - 1U) / NTM_DECODE_SCHEDULER_TILE_SIZE);
+    scheduler_request.next_tile = 0U;
+
+    std::lock_guard<std::mutex> lock(scheduler->pending_mutex);
+    scheduler_request.sequence = scheduler->next_sequence;
+    ++scheduler->next_sequence;
+    scheduler->submitted_requests.push_back(scheduler_request);
+}
+
+extern uint32_t ntm_decode_scheduler_dispatch(ntm_decode_scheduler *scheduler, uint32_t max_tiles)
+{
+    assert(max_tiles >= 1U);
+
+    {
+        std::lock_guard<std::mutex> lock(scheduler->pending_mutex);
+        scheduler->pending_requests.insert(scheduler->pending_requests.end(), scheduler->submitted_requests.begin(), scheduler->submitted_requests.end());
+        scheduler->submitted_requests.clear();
+    }
+
+    if (scheduler->pending_requests.empty())
+    {
+        return 0U;
+    }
+
+    std::sort(scheduler->pending_requests.begin(), scheduler->pending_requests.end(), ntm_decode_scheduler_request_less);
+
+    // the first requests
+    uint32_t num_dispatched_requests = 0U;
+    uint32_t num_tiles = 0U;
+    scheduler->dispatched_requests.clear();
+    scheduler->dispatched_textures.clear();
+    scheduler->tiles.clear();
+    for (ntm_decode_scheduler_request &pending_request : scheduler->pending_requests)
+    {
+        if (num_tiles >= max_tiles)
+        {
+            break;
+        }
+
+        uint32_t const request_index = static_cast<uint32_t>(scheduler->dispatched_requests.size());
+        scheduler->dispatched_requests.push_back(&pending_request);
+
+        // the batch merely has a few requests
+        uint32_t texture = 0U;
+        while (scheduler->dispatched_requests[texture]->request.engine != pending_request.request.engine)
+        {
+            ++texture;
+        }
+        scheduler->dispatched_textures.push_back(texture);
+
+        uint32_t const tiles_begin = pending_request.next_tile;
+        uint32_t const tiles_end = ((pending_request.num_tiles - tiles_begin) < (max_tiles - num_tiles)) ? pending_request.num_tiles : (tiles_begin + (max_tiles - num_tiles));
+        for (uint32_t tile_index = tiles_begin; tile_index < tiles_end; ++tile_index)
+        {
+            ntm_decode_scheduler_tile tile;
+            tile.request_index = request_index;
+            tile.tile_index = tile_index;
+            scheduler->tiles.push_back(tile);
+        }
+
+        pending_request.next_tile = tiles_end;
+        num_tiles += (tiles_end - tiles_begin);
+        ++num_dispatched_requests;
+    }
+
+    // group by the shape of the network, and then by the texture (the textures are in the order of their first requests), and then by the request (stable: the tiles of each request remain in order)
+    std::stable_sort(scheduler->tiles.begin(), scheduler->tiles.end(), [scheduler](ntm_decode_scheduler_tile const &left, ntm_decode_scheduler_tile const &right) {
+        ntm_cpu_engine const *const left_engine = scheduler->dispatched_requests[left.request_index]->request.engine;
+        ntm_cpu_engine const *const right_engine = scheduler->dispatched_requests[right.request_index]->request.engine;
+
+        int const shape = ntm_decode_scheduler_compare_shape(&left_engine->model, &right_engine->model);
+        if (0 != shape)
+        {
+            return (shape < 0);
+        }
+
+        uint32_t const left_texture = scheduler->dispatched_textures[left.request_index];
+        uint32_t const right_texture = scheduler->dispatched_textures[right.request_index];
+        if (left_texture != right_texture)
+        {
+            return (left_texture < right_texture);
+        }
+
+        return (left.request_index < right.request_index);
+    });
+
+    ntm_thread_pool_parallel_for(scheduler->thread_pool, num_tiles, ntm_decode_scheduler_tile_task, scheduler);
+
+    // completion
+    uint64_t const now = ntm_decode_scheduler_now();
+    uint32_t num_completed_requests = 0U;
+    uint32_t num_missed_deadlines = 0U;
+    for (uint32_t request_index = 0U; request_index < num_dispatched_requests; ++request_index)
+    {
+        ntm_decode_scheduler_request const *const dispatched_request = &scheduler->pending_requests[request_index];
+        if (dispatched_request->next_tile == dispatched_request->num_tiles)
+        {
+            ++num_completed_requests;
+
+            if ((0U != dispatched_request->request.deadline) && (now > dispatched_request->request.deadline))
+            {
+                ++num_missed_deadlines;
+            }
+
+            if (NULL != dispatched_request->request.callback)
+            {
+                dispatched_request->request.callback(dispatched_request->request.user_data);
+            }
+        }
+    }
+
+    // the completed requests are always the first requests (at most the last dispatched request is partially dispatched)
+    scheduler->pending_requests.erase(scheduler->pending_requests.begin(), scheduler->pending_requests.begin() + num_completed_requests);
+
+    {
+        std::lock_guard<std::mutex> lock(scheduler->statistics_mutex);
+        scheduler->statistics.completed_requests += num_completed_requests;
+        scheduler->statistics.missed_deadlines += num_missed_deadlines;
+        scheduler->statistics.decoded_tiles += num_tiles;
+        ++scheduler->statistics.batches;
+    }
+
+    return num_tiles;
+}
+
+extern void ntm_decode_scheduler_flush(ntm_decode_scheduler *scheduler, uint32_t max_tiles)
+{
+    while (0U != ntm_decode_scheduler_dispatch(scheduler, max_tiles))
+    {
+    }
+}
+
+extern void ntm_decode_scheduler_get_statistics(ntm_decode_scheduler *scheduler, ntm_decode_scheduler_statistics *out_statistics)
+{
+    std::lock_guard<std::mutex> lock(scheduler->statistics_mutex);
+    (*out_statistics) = scheduler->statistics;
+}
+
+static void ntm_decode_scheduler_tile_task(void *user_data, uint32_t worker_index, uint32_t task_index)
+{
+    (void)worker_index;
+
+    ntm_decode_scheduler *const scheduler = static_cast<ntm_decode_scheduler *>(user_data);
+    ntm_decode_scheduler_tile const *const tile = &scheduler->tiles[task_index];
+    ntm_decode_scheduler_request const *const scheduler_request = scheduler->dispatched_requests[tile->request_index];
+    ntm_decode_request const *const request = &scheduler_request->request;
+
+    uint32_t const tile_x = NTM_DECODE_SCHEDULER_TILE_SIZE * (tile->tile_index % scheduler_request->num_tiles_x);
+    uint32_t const tile_y = NTM_DECODE_SCHEDULER_TILE_SIZE * (tile->tile_index / scheduler_request->num_tiles_x);
+    uint32_t const tile_width = ((request->width - tile_x) < NTM_DECODE_SCHEDULER_TILE_SIZE) ? (request->width - tile_x) : NTM_DECODE_SCHEDULER_TILE_SIZE;
+    uint32_t const tile_height = ((request->height - tile_y) < NTM_DECODE_SCHEDULER_TILE_SIZE) ? (request->height - tile_y) : NTM_DECODE_SCHEDULER_TILE_SIZE;
+
+    // the texels are written into the destination directly
+    void *const out_tile = static_cast<uint8_t *>(request->out_pixels) + (request->out_row_pitch * tile_y + static_cast<size_t>(ntm_pixel_format_size(request->encoding.format)) * tile_x);
+    ntm_cpu_engine_predict_grid_pixels(request->engine, request->texture_width, request->texture_height, request->x + tile_x, request->y + tile_y, tile_width, tile_height, &request->encoding, out_tile, request->out_row_pitch);
+}
+
+static inline bool ntm_decode_scheduler_request_less(ntm_decode_scheduler_request const &left, ntm_decode_scheduler_request const &right)
+{
+    if (left.request.priority != right.request.priority)
+    {
+        return (left.request.priority > right.request.priority);
+    }
+
+    // no deadline is the latest
+    uint64_t const left_deadline = (0U != left.request.deadline) ? left.request.deadline : ~static_cast<uint64_t>(0U);
+    uint64_t const right_deadline = (0U != right.request.deadline) ? right.request.deadline : ~static_cast<uint64_t>(0U);
+    if (left_deadline != right_deadline)
+    {
+        return (left_deadline < right_deadline);
+    }
+
+    return (left.sequence < right.sequence);
+}
+
+static inline int ntm_decode_scheduler_compare_shape(ntm_model const *left, ntm_model const *right)
+{
+    if (left->num_frequencies != right->num_frequencies)
+    {
+        return (left->num_frequencies < right->num_frequencies) ? -1 : 1;
+    }
+
+    if (left->num_layers != right->num_layers)
+    {
+        return (left->num_layers < right->num_layers) ? -1 : 1;
+    }
+
+    for (uint32_t layer_index = 0U; layer_index < left->num_layers; ++layer_index)
+    {
+        ntm_layer const *const left_layer = &left->layers[layer_index];
+        ntm_layer const *const right_layer = &right->layers[layer_index];
+
+        if (left_layer->output_size != right_layer->output_size)
+        {
+            return (left_layer->output_size < right_layer->output_size) ? -1 : 1;
+        }
+
+        if (left_layer->coefficient_type != right_layer->coefficient_type)
+        {
+            return (left_layer->coefficient_type < right_layer->coefficient_type) ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+#ifndef _NTM_DECODE_SCHEDULER_H_
+#define _NTM_DECODE_SCHEDULER_H_ 1
+
+#include "ntm-cpu-inference.h"
+
+// The textures are decoded in the tiles of NTM_DECODE_SCHEDULER_TILE_SIZE x NTM_DECODE_SCHEDULER_TILE_SIZE texels.
+static constexpr uint32_t const NTM_DECODE_SCHEDULER_TILE_SIZE = 64;
+
+// Invoked by the thread which calls the "ntm_decode_scheduler_dispatch" after all the tiles of the request have been decoded.
+typedef void (*ntm_decode_callback)(void *user_data);
+
+struct ntm_decode_request
+{
+    // NOTE: the "engine" and the "out_pixels" must remain valid until the "callback" is invoked.
+    ntm_cpu_engine const *engine;
+    // The UVs are the texel centers of the texture (e.g. the resolution of the mip level), and merely the region [x, x + width) x [y, y + height) is decoded.
+    uint32_t texture_width;
+    uint32_t texture_height;
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+    // e.g. R8G8B8A8_UNORM (A is always 255)
+    ntm_pixel_encoding encoding;
+    // The texel (x + i, y + j) is written to "out_pixels + out_row_pitch * j + ntm_pixel_format_size(format) * i".
+    void *out_pixels;
+    size_t out_row_pitch;
+    // the higher priority is decoded first
+    int32_t priority;
+    // the "ntm_decode_scheduler_now" before which the request should have been completed (0: no deadline)
+    // The requests of the same priority are decoded in the order of the deadlines (earliest first).
+    uint64_t deadline;
+    ntm_decode_callback callback;
+    void *user_data;
+};
+
+struct ntm_decode_scheduler_statistics
+{
+    uint64_t completed_requests;
+    uint64_t missed_deadlines;
+    uint64_t decoded_tiles;
+    // the number of the batched jobs (one "parallel for" of the thread pool for each batch)
+    uint64_t batches;
+};
+
+struct ntm_decode_scheduler;
+
+// 0 == num_threads: one worker for each hardware thread
+extern ntm_decode_scheduler *ntm_decode_scheduler_create(uint32_t num_threads);
+
+extern void ntm_decode_scheduler_destroy(ntm_decode_scheduler *scheduler);
+
+// The monotonic clock (nanoseconds) of the "deadline"
+extern uint64_t ntm_decode_scheduler_now();
+
+// It is safe to submit the requests from multiple threads concurrently (even during the "ntm_decode_scheduler_dispatch").
+extern void ntm_decode_scheduler_submit(ntm_decode_scheduler *scheduler, ntm_decode_request const *request);
+
+// The pending requests are ordered by (priority, deadline, submission), and at most "max_tiles" tiles of the first requests are decoded as one batched job.
+// Within the batch, the tiles are grouped by the shape of the network (frequencies, layers, widths and coefficient types), and then by the texture (in the order of the most urgent request of each texture), even if the requests of the same texture are NOT adjacent in the queue.
+// Since the thread pool splits the tiles into one contiguous range for each worker, each worker decodes the consecutive tiles of the same texture (the weights remain in the cache).
+// The remaining tiles stay pending, and thus the urgent request submitted later jumps the queue at the next dispatch.
+// Returns the number of the decoded tiles (0: no pending request).
+// NOTE: at most one thread can call this function at the same time.
+extern uint32_t ntm_decode_scheduler_dispatch(ntm_decode_scheduler *scheduler, uint32_t max_tiles);
+
+// Dispatch until there is no pending request.
+extern void ntm_decode_scheduler_flush(ntm_decode_scheduler *scheduler, uint32_t max_tiles);
+
+extern void ntm_decode_scheduler_get_statistics(ntm_decode_scheduler *scheduler, ntm_decode_scheduler_statistics *out_statistics);
+
+#endif
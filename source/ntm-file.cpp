@@ -0,0 +1,90 @@
+#include "ntm-file.h"
+#include <string.h>
+#include <assert.h>
+
+#if defined(__GNUC__)
+#elif defined(_MSC_VER)
+#include <sdkddkver.h>
+#define WIN32_LEAN_AND_MEAN
+#define NOCOMM
+#define NOMINMAX
+#include <Windows.h>
+#else
+#error Unknown Compiler
+#endif
+
+extern FILE *ntm_fopen_utf8(char const *path, char const *mode)
+{
+    FILE *file = NULL;
+#if defined(__GNUC__)
+    file = fopen(path, mode);
+#elif defined(_MSC_VER)
+    {
+        std::vector<wchar_t> wide_path;
+        if (!ntm_utf8_to_wide(path, wide_path))
+        {
+            return NULL;
+        }
+
+        // the mode is ASCII
+        size_t const mode_length = strlen(mode);
+        std::vector<wchar_t> wide_mode(mode_length + 1U);
+        for (size_t index = 0U; index <= mode_length; ++index)
+        {
+            wide_mode[index] = static_cast<wchar_t>(mode[index]);
+        }
+
+        errno_t result_wfopen = _wfopen_s(&file, &wide_path[0], &wide_mode[0]);
+        if (0 != result_wfopen)
+        {
+            file = NULL;
+        }
+    }
+#else
+#error Unknown Compiler
+#endif
+    return file;
+}
+
+extern bool ntm_read_file(char const *path, std::vector<uint8_t> &out_data)
+{
+    FILE *file = ntm_fopen_utf8(path, "rb");
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    out_data.clear();
+
+    uint8_t buffer[4096];
+    size_t read_size;
+    while ((read_size = fread(buffer, 1U, sizeof(buffer), file)) > 0U)
+    {
+        out_data.insert(out_data.end(), buffer, buffer + read_size);
+    }
+
+    bool const result = (0 == ferror(file)) && (!out_data.empty());
+
+    fclose(file);
+
+    return result;
+}
+
+#if defined(_MSC_VER)
+extern bool ntm_utf8_to_wide(char const *path, std::vector<wchar_t> &out_wide_path)
+{
+    int wide_path_size = MultiByteToWideChar(CP_UTF8, 0U, path, -1, NULL, 0);
+    if (wide_path_size <= 0)
+    {
+        return false;
+    }
+
+    out_wide_path.resize(static_cast<size_t>(wide_path_size));
+
+    int result_multi_byte_to_wide_char = MultiByteToWideChar(CP_UTF8, 0U, path, -1, &out_wide_path[0], wide_path_size);
+    assert(wide_path_size == result_multi_byte_to_wide_char);
+    (void)result_multi_byte_to_wide_char;
+
+    return true;
+}
+#endif
@@ -0,0 +1,22 @@
+#ifndef _NTM_FILE_H_
+#define _NTM_FILE_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+// The paths are UTF-8 on all platforms (the "fopen" of the MSVC runtime interprets the "char" path as the ANSI code page, and thus the path is converted to UTF-16 and opened by the "_wfopen_s").
+// The "mode" is the same as the "fopen", e.g. "rb", "wb" or "ab".
+extern FILE *ntm_fopen_utf8(char const *path, char const *mode);
+
+// The whole file is read into the "out_data".
+// False if the file can NOT be opened or read, or if the file is empty.
+extern bool ntm_read_file(char const *path, std::vector<uint8_t> &out_data);
+
+#if defined(_MSC_VER)
+// UTF-8 to UTF-16 (null-terminated), e.g. for the "CreateFileW".
+extern bool ntm_utf8_to_wide(char const *path, std::vector<wchar_t> &out_wide_path);
+#endif
+
+#endif
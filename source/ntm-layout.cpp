@@ -0,0 +1,205 @@
+#include "ntm-layout.h"
+#include <assert.h>
+#include <string.h>
+
+static constexpr uint32_t const NTM_LAYOUT_TILE_TEXELS = NTM_LAYOUT_TILE_SIZE * NTM_LAYOUT_TILE_SIZE;
+
+static_assert(64U == NTM_LAYOUT_TILE_SIZE, "the Morton code of the tile is 12 bits");
+
+static inline uint32_t ntm_layout_morton_spread(uint32_t value);
+
+static inline uint32_t ntm_layout_morton_compact(uint32_t value);
+
+static inline uint32_t ntm_layout_get_tile_index(ntm_layout layout, uint32_t x, uint32_t y);
+
+extern char const *ntm_layout_name(ntm_layout layout)
+{
+    switch (layout)
+    {
+    case NTM_LAYOUT_TILED:
+        return "tiled";
+    case NTM_LAYOUT_MORTON:
+        return "morton";
+    default:
+        assert(NTM_LAYOUT_LINEAR == layout);
+        return "linear";
+    }
+}
+
+extern bool ntm_layout_parse(char const *name, ntm_layout *out_layout)
+{
+    for (uint32_t layout_index = 0U; layout_index < NTM_LAYOUT_COUNT; ++layout_index)
+    {
+        ntm_layout const layout = static_cast<ntm_layout>(layout_index);
+        if (0 == strcmp(name, ntm_layout_name(layout)))
+        {
+            (*out_layout) = layout;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+extern size_t ntm_layout_get_size(ntm_layout layout, uint32_t width, uint32_t height)
+{
+    if (NTM_LAYOUT_LINEAR == layout)
+    {
+        return static_cast<size_t>(width) * static_cast<size_t>(height);
+    }
+
+    size_t const num_tiles_x = (width + NTM_LAYOUT_TILE_SIZE - 1U) / NTM_LAYOUT_TILE_SIZE;
+    size_t const num_tiles_y = (height + NTM_LAYOUT_TILE_SIZE - 1U) / NTM_LAYOUT_TILE_SIZE;
+    return num_tiles_x * num_tiles_y * NTM_LAYOUT_TILE_TEXELS;
+}
+
+extern size_t ntm_layout_get_index(ntm_layout layout, uint32_t width, uint32_t x, uint32_t y)
+{
+    if (NTM_LAYOUT_LINEAR == layout)
+    {
+        return static_cast<size_t>(width) * y + x;
+    }
+
+    size_t const num_tiles_x = (width + NTM_LAYOUT_TILE_SIZE - 1U) / NTM_LAYOUT_TILE_SIZE;
+    size_t const tile_index = num_tiles_x * (y / NTM_LAYOUT_TILE_SIZE) + (x / NTM_LAYOUT_TILE_SIZE);
+    return NTM_LAYOUT_TILE_TEXELS * tile_index + ntm_layout_get_tile_index(layout, x % NTM_LAYOUT_TILE_SIZE, y % NTM_LAYOUT_TILE_SIZE);
+}
+
+extern void ntm_layout_get_coordinate(ntm_layout layout, uint32_t width, size_t index, uint32_t *out_x, uint32_t *out_y)
+{
+    if (NTM_LAYOUT_LINEAR == layout)
+    {
+        (*out_x) = static_cast<uint32_t>(index % width);
+        (*out_y) = static_cast<uint32_t>(index / width);
+        return;
+    }
+
+    uint32_t const num_tiles_x = (width + NTM_LAYOUT_TILE_SIZE - 1U) / NTM_LAYOUT_TILE_SIZE;
+    uint32_t const tile_index = static_cast<uint32_t>(index / NTM_LAYOUT_TILE_TEXELS);
+    uint32_t const texel_index = static_cast<uint32_t>(index % NTM_LAYOUT_TILE_TEXELS);
+
+    uint32_t texel_x;
+    uint32_t texel_y;
+    if (NTM_LAYOUT_TILED == layout)
+    {
+        texel_x = texel_index % NTM_LAYOUT_TILE_SIZE;
+        texel_y = texel_index / NTM_LAYOUT_TILE_SIZE;
+    }
+    else
+    {
+        assert(NTM_LAYOUT_MORTON == layout);
+        texel_x = ntm_layout_morton_compact(texel_index);
+        texel_y = ntm_layout_morton_compact(texel_index >> 1U);
+    }
+
+    (*out_x) = NTM_LAYOUT_TILE_SIZE * (tile_index % num_tiles_x) + texel_x;
+    (*out_y) = NTM_LAYOUT_TILE_SIZE * (tile_index / num_tiles_x) + texel_y;
+}
+
+extern void ntm_layout_deswizzle(ntm_layout layout, uint32_t width, uint32_t height, void const *in_texels, void *out_texels, size_t out_row_pitch)
+{
+    uint8_t const(*const in_tiles)[4] = static_cast<uint8_t const(*)[4]>(in_texels);
+
+    if (NTM_LAYOUT_LINEAR == layout)
+    {
+        for (uint32_t y = 0U; y < height; ++y)
+        {
+            memcpy(static_cast<uint8_t *>(out_texels) + out_row_pitch * y, in_tiles + static_cast<size_t>(width) * y, sizeof(uint8_t[4]) * width);
+        }
+        return;
+    }
+
+    uint32_t const num_tiles_x = (width + NTM_LAYOUT_TILE_SIZE - 1U) / NTM_LAYOUT_TILE_SIZE;
+    uint32_t const num_tiles_y = (height + NTM_LAYOUT_TILE_SIZE - 1U) / NTM_LAYOUT_TILE_SIZE;
+
+    for (uint32_t tile_y = 0U; tile_y < num_tiles_y; ++tile_y)
+    {
+        for (uint32_t tile_x = 0U; tile_x < num_tiles_x; ++tile_x)
+        {
+            uint8_t const(*const in_tile)[4] = in_tiles + static_cast<size_t>(NTM_LAYOUT_TILE_TEXELS) * (static_cast<size_t>(num_tiles_x) * tile_y + tile_x);
+
+            uint32_t const x_begin = NTM_LAYOUT_TILE_SIZE * tile_x;
+            uint32_t const y_begin = NTM_LAYOUT_TILE_SIZE * tile_y;
+            uint32_t const tile_width = ((width - x_begin) < NTM_LAYOUT_TILE_SIZE) ? (width - x_begin) : NTM_LAYOUT_TILE_SIZE;
+            uint32_t const tile_height = ((height - y_begin) < NTM_LAYOUT_TILE_SIZE) ? (height - y_begin) : NTM_LAYOUT_TILE_SIZE;
+
+            for (uint32_t y = 0U; y < tile_height; ++y)
+            {
+                uint8_t(*const out_row)[4] = reinterpret_cast<uint8_t(*)[4]>(static_cast<uint8_t *>(out_texels) + out_row_pitch * (y_begin + y)) + x_begin;
+
+                if (NTM_LAYOUT_TILED == layout)
+                {
+                    memcpy(out_row, in_tile + NTM_LAYOUT_TILE_SIZE * y, sizeof(uint8_t[4]) * tile_width);
+                }
+                else
+                {
+                    assert(NTM_LAYOUT_MORTON == layout);
+
+                    // the bits of y are the same for the whole row
+                    uint32_t const morton_y = ntm_layout_morton_spread(y) << 1U;
+                    for (uint32_t x = 0U; x < tile_width; ++x)
+                    {
+                        memcpy(out_row[x], in_tile[morton_y | ntm_layout_morton_spread(x)], sizeof(uint8_t[4]));
+                    }
+                }
+            }
+        }
+    }
+}
+
+extern void ntm_layout_swizzle_tile(ntm_layout layout, uint32_t tile_width, uint32_t tile_height, void const *in_texels, size_t in_row_pitch, void *out_tile_texels)
+{
+    assert((tile_width <= NTM_LAYOUT_TILE_SIZE) && (tile_height <= NTM_LAYOUT_TILE_SIZE));
+
+    uint8_t(*const out_tile)[4] = static_cast<uint8_t(*)[4]>(out_tile_texels);
+
+    for (uint32_t y = 0U; y < tile_height; ++y)
+    {
+        uint8_t const(*const in_row)[4] = reinterpret_cast<uint8_t const(*)[4]>(static_cast<uint8_t const *>(in_texels) + in_row_pitch * y);
+
+        if (NTM_LAYOUT_MORTON == layout)
+        {
+            uint32_t const morton_y = ntm_layout_morton_spread(y) << 1U;
+            for (uint32_t x = 0U; x < tile_width; ++x)
+            {
+                memcpy(out_tile[morton_y | ntm_layout_morton_spread(x)], in_row[x], sizeof(uint8_t[4]));
+            }
+        }
+        else
+        {
+            // the LINEAR storage of one tile is the same as the TILED
+            memcpy(out_tile + NTM_LAYOUT_TILE_SIZE * y, in_row, sizeof(uint8_t[4]) * tile_width);
+        }
+    }
+}
+
+static inline uint32_t ntm_layout_morton_spread(uint32_t value)
+{
+    // 6 bits: "abcdef" -> "0a0b0c0d0e0f"
+    value &= 0X3FU;
+    value = (value | (value << 4U)) & 0X30FU;
+    value = (value | (value << 2U)) & 0X333U;
+    value = (value | (value << 1U)) & 0X555U;
+    return value;
+}
+
+static inline uint32_t ntm_layout_morton_compact(uint32_t value)
+{
+    // the inverse of the "ntm_layout_morton_spread"
+    value &= 0X555U;
+    value = (value | (value >> 1U)) & 0X333U;
+    value = (value | (value >> 2U)) & 0X30FU;
+    value = (value | (value >> 4U)) & 0X3FU;
+    return value;
+}
+
+static inline uint32_t ntm_layout_get_tile_index(ntm_layout layout, uint32_t x, uint32_t y)
+{
+    if (NTM_LAYOUT_TILED == layout)
+    {
+        return NTM_LAYOUT_TILE_SIZE * y + x;
+    }
+
+    assert(NTM_LAYOUT_MORTON == layout);
+    return (ntm_layout_morton_spread(y) << 1U) | ntm_layout_morton_spread(x);
+}
@@ -0,0 +1,45 @@
+#ifndef _NTM_LAYOUT_H_
+#define _NTM_LAYOUT_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The order in which the texels are evaluated and stored.
+// LINEAR: row-major
+// TILED: the tiles of NTM_LAYOUT_TILE_SIZE x NTM_LAYOUT_TILE_SIZE texels (row-major), and the texels of each tile are contiguous (row-major), which is similar to the macro tiles of the GPU
+// MORTON: the same tiles as the TILED except that the texels of each tile are in the Z-order (Morton order), namely, each 16 consecutive texels (one batch of the CPU engine) are one 4x4 block
+enum ntm_layout
+{
+    NTM_LAYOUT_LINEAR = 0,
+    NTM_LAYOUT_TILED = 1,
+    NTM_LAYOUT_MORTON = 2
+};
+
+static constexpr uint32_t const NTM_LAYOUT_COUNT = 3;
+
+// 64 x 64 x 4 bytes = 16KB, which fits in the L1 cache (or at least the L2 cache)
+static constexpr uint32_t const NTM_LAYOUT_TILE_SIZE = 64;
+
+// "linear", "tiled" or "morton"
+extern char const *ntm_layout_name(ntm_layout layout);
+
+extern bool ntm_layout_parse(char const *name, ntm_layout *out_layout);
+
+// The number of the texels of the storage.
+// The TILED and the MORTON are padded to the whole tiles, and the padding texels are unspecified.
+extern size_t ntm_layout_get_size(ntm_layout layout, uint32_t width, uint32_t height);
+
+// The index of the texel (x, y) in the storage.
+extern size_t ntm_layout_get_index(ntm_layout layout, uint32_t width, uint32_t x, uint32_t y);
+
+// The inverse of the "ntm_layout_get_index", and the padding texels are outside the texture (x >= width or y >= height).
+extern void ntm_layout_get_coordinate(ntm_layout layout, uint32_t width, size_t index, uint32_t *out_x, uint32_t *out_y);
+
+// The texels (4 bytes each) of the "in_texels" (the storage of the "layout") are written to the row-major "out_texels", e.g. for the presentation.
+// The tiles are visited one by one, and thus both the reads and the writes of one tile are within the cache.
+extern void ntm_layout_deswizzle(ntm_layout layout, uint32_t width, uint32_t height, void const *in_texels, void *out_texels, size_t out_row_pitch);
+
+// The texels (4 bytes each) of one tile (row-major with the "in_row_pitch", and maybe smaller than the whole tile at the edges) are written to the storage of the tile (NTM_LAYOUT_TILE_SIZE x NTM_LAYOUT_TILE_SIZE texels).
+extern void ntm_layout_swizzle_tile(ntm_layout layout, uint32_t tile_width, uint32_t tile_height, void const *in_texels, size_t in_row_pitch, void *out_tile_texels);
+
+#endif
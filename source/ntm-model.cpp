@@ -0,0 +1,203 @@
+#include "ntm-model.h"
+#include <string.h>
+#include <assert.h>
+
+static inline bool ntm_read_uint32(uint8_t const *data, size_t size, size_t *inout_offset, uint32_t *out_value);
+
+static inline uint64_t ntm_hash(uint64_t hash, void const *data, size_t size);
+
+extern bool ntm_model_parse(void const *data, size_t size, ntm_model *out_model)
+{
+    uint8_t const *const bytes = static_cast<uint8_t const *>(data);
+
+    // The coefficients are referenced rather than copied
+    if (0U != (reinterpret_cast<uintptr_t>(bytes) & (alignof(float) - 1U)))
+    {
+        return false;
+    }
+
+    size_t offset = 0U;
+
+    uint32_t fourcc;
+    if ((!ntm_read_uint32(bytes, size, &offset, &fourcc)) || ((NTM_FOURCC != fourcc) && (NTM_QUANTIZED_FOURCC != fourcc)))
+    {
+        return false;
+    }
+
+    uint32_t num_frequencies;
+    if ((!ntm_read_uint32(bytes, size, &offset, &num_frequencies)) || (num_frequencies < 1U) || (num_frequencies > NTM_MAX_FREQUENCIES))
+    {
+        return false;
+    }
+
+    uint32_t num_layers;
+    if ((!ntm_read_uint32(bytes, size, &offset, &num_layers)) || (num_layers < 1U) || (num_layers > NTM_MAX_LAYERS))
+    {
+        return false;
+    }
+
+    ntm_model model = {};
+    model.num_frequencies = num_frequencies;
+    model.num_layers = num_layers;
+
+    uint32_t input_size = 4U * num_frequencies;
+    for (uint32_t layer_index = 0U; layer_index < num_layers; ++layer_index)
+    {
+        ntm_coefficient_type coefficient_type = NTM_COEFFICIENT_TYPE_FP32;
+        if (NTM_QUANTIZED_FOURCC == fourcc)
+        {
+            uint32_t value;
+            if ((!ntm_read_uint32(bytes, size, &offset, &value)) || (value >= NTM_COEFFICIENT_TYPE_COUNT) || ((0U == layer_index) && (NTM_COEFFICIENT_TYPE_INT8 == value)))
+            {
+                return false;
+            }
+
+            coefficient_type = static_cast<ntm_coefficient_type>(value);
+        }
+
+        uint32_t num_coefficients;
+        if (!ntm_read_uint32(bytes, size, &offset, &num_coefficients))
+        {
+            return false;
+        }
+
+        // weights: input_size * output_size
+        // biases: output_size
+        if (0U != (num_coefficients % (input_size + 1U)))
+        {
+            return false;
+        }
+
+        uint32_t const output_size = num_coefficients / (input_size + 1U);
+        if ((output_size < 1U) || (output_size > NTM_MAX_LAYER_WIDTH))
+        {
+            return false;
+        }
+
+        size_t const coefficients_size = ntm_layer_coefficients_size(coefficient_type, input_size, output_size);
+        if ((size - offset) < coefficients_size)
+        {
+            return false;
+        }
+
+        ntm_layer_init(&model.layers[layer_index], coefficient_type, input_size, output_size, bytes + offset);
+
+        offset += coefficients_size;
+        input_size = output_size;
+    }
+
+    if (NTM_OUTPUT_SIZE != input_size)
+    {
+        return false;
+    }
+
+    (*out_model) = model;
+    return true;
+}
+
+extern size_t ntm_layer_coefficients_size(ntm_coefficient_type coefficient_type, uint32_t input_size, uint32_t output_size)
+{
+    switch (coefficient_type)
+    {
+    case NTM_COEFFICIENT_TYPE_FP16:
+        return sizeof(float) * output_size + ((sizeof(uint16_t) * input_size * output_size + 3U) & (~static_cast<size_t>(3U)));
+    case NTM_COEFFICIENT_TYPE_INT8:
+        return sizeof(float) * 2U * output_size + sizeof(int8_t) * 4U * ((input_size + 3U) / 4U) * output_size;
+    default:
+        assert(NTM_COEFFICIENT_TYPE_FP32 == coefficient_type);
+        return sizeof(float) * (static_cast<size_t>(input_size) + 1U) * output_size;
+    }
+}
+
+extern void ntm_layer_init(ntm_layer *out_layer, ntm_coefficient_type coefficient_type, uint32_t input_size, uint32_t output_size, void const *coefficients)
+{
+    float const *const floats = static_cast<float const *>(coefficients);
+
+    out_layer->input_size = input_size;
+    out_layer->output_size = output_size;
+    out_layer->coefficient_type = coefficient_type;
+
+    switch (coefficient_type)
+    {
+    case NTM_COEFFICIENT_TYPE_FP16:
+        out_layer->weights = floats + output_size;
+        out_layer->scales = NULL;
+        out_layer->biases = floats;
+        break;
+    case NTM_COEFFICIENT_TYPE_INT8:
+        out_layer->weights = floats + 2U * output_size;
+        out_layer->scales = floats;
+        out_layer->biases = floats + output_size;
+        break;
+    default:
+        assert(NTM_COEFFICIENT_TYPE_FP32 == coefficient_type);
+        out_layer->weights = floats;
+        out_layer->scales = NULL;
+        out_layer->biases = floats + static_cast<size_t>(input_size) * output_size;
+    }
+}
+
+extern uint64_t ntm_model_hash(ntm_model const *model)
+{
+    // FNV-1a offset basis
+    uint64_t hash = 0XCBF29CE484222325ULL;
+
+    hash = ntm_hash(hash, &model->num_frequencies, sizeof(model->num_frequencies));
+    hash = ntm_hash(hash, &model->num_layers, sizeof(model->num_layers));
+
+    for (uint32_t layer_index = 0U; layer_index < model->num_layers; ++layer_index)
+    {
+        ntm_layer const *const layer = &model->layers[layer_index];
+
+        uint32_t const shape[3] = {layer->input_size, layer->output_size, static_cast<uint32_t>(layer->coefficient_type)};
+        hash = ntm_hash(hash, shape, sizeof(shape));
+
+        size_t weights_size;
+        switch (layer->coefficient_type)
+        {
+        case NTM_COEFFICIENT_TYPE_FP16:
+            weights_size = sizeof(uint16_t) * layer->input_size * layer->output_size;
+            break;
+        case NTM_COEFFICIENT_TYPE_INT8:
+            weights_size = sizeof(int8_t[4]) * ((layer->input_size + 3U) / 4U) * layer->output_size;
+            break;
+        default:
+            assert(NTM_COEFFICIENT_TYPE_FP32 == layer->coefficient_type);
+            weights_size = sizeof(float) * layer->input_size * layer->output_size;
+        }
+
+        hash = ntm_hash(hash, layer->weights, weights_size);
+        hash = ntm_hash(hash, layer->biases, sizeof(float) * layer->output_size);
+        if (NULL != layer->scales)
+        {
+            hash = ntm_hash(hash, layer->scales, sizeof(float) * layer->output_size);
+        }
+    }
+
+    return hash;
+}
+
+static inline bool ntm_read_uint32(uint8_t const *data, size_t size, size_t *inout_offset, uint32_t *out_value)
+{
+    if ((size < sizeof(uint32_t)) || ((*inout_offset) > (size - sizeof(uint32_t))))
+    {
+        return false;
+    }
+
+    // NOTE: the asset is always little-endian
+    memcpy(out_value, data + (*inout_offset), sizeof(uint32_t));
+    (*inout_offset) += sizeof(uint32_t);
+    return true;
+}
+
+static inline uint64_t ntm_hash(uint64_t hash, void const *data, size_t size)
+{
+    // FNV-1a
+    uint8_t const *const bytes = static_cast<uint8_t const *>(data);
+    for (size_t byte_index = 0U; byte_index < size; ++byte_index)
+    {
+        hash ^= bytes[byte_index];
+        hash *= 0X100000001B3ULL;
+    }
+    return hash;
+}
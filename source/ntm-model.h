@@ -0,0 +1,73 @@
+#ifndef _NTM_MODEL_H_
+#define _NTM_MODEL_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+// FourCC('N', 'T', 'M', ' ')
+static constexpr uint32_t const NTM_FOURCC = (static_cast<uint32_t>('N') | (static_cast<uint32_t>('T') << 8) | (static_cast<uint32_t>('M') << 16) | (static_cast<uint32_t>(' ') << 24));
+
+// FourCC('N', 'T', 'M', 'Q')
+// The same as the NTM asset except that the number of the coefficients of each layer is preceded by the "ntm_coefficient_type".
+static constexpr uint32_t const NTM_QUANTIZED_FOURCC = (static_cast<uint32_t>('N') | (static_cast<uint32_t>('T') << 8) | (static_cast<uint32_t>('M') << 16) | (static_cast<uint32_t>('Q') << 24));
+
+// The limits are chosen such that the activations of one batch always fit on the stack of the calling thread.
+static constexpr uint32_t const NTM_MAX_FREQUENCIES = 32;
+static constexpr uint32_t const NTM_MAX_LAYERS = 16;
+static constexpr uint32_t const NTM_MAX_LAYER_WIDTH = 256;
+
+// The number of the outputs of the last texture mapping layer (R, G, B)
+static constexpr uint32_t const NTM_OUTPUT_SIZE = 3;
+
+// The biases (and the scales) are always float.
+// FP32: weights[input_size][output_size], biases[output_size]
+// FP16: biases[output_size], weights (IEEE half) [input_size][output_size], padding to 4 bytes
+// INT8: scales[output_size], biases[output_size], weights[(input_size + 3) / 4][output_size][4]
+enum ntm_coefficient_type
+{
+    NTM_COEFFICIENT_TYPE_FP32 = 0,
+    NTM_COEFFICIENT_TYPE_FP16 = 1,
+    NTM_COEFFICIENT_TYPE_INT8 = 2
+};
+
+static constexpr uint32_t const NTM_COEFFICIENT_TYPE_COUNT = 3;
+
+struct ntm_layer
+{
+    uint32_t input_size;
+    uint32_t output_size;
+    ntm_coefficient_type coefficient_type;
+    // FP32: float [input_size][output_size] which is the same as "keras.layers.Dense.get_weights()[0]"
+    // FP16: uint16_t [input_size][output_size]
+    // INT8: int8_t [(input_size + 3) / 4][output_size][4] where the 4 consecutive inputs of each output are adjacent (the missing inputs are zero), and the weight is "scales[output] * int8"
+    void const *weights;
+    // INT8: [output_size] (per output channel), otherwise: NULL
+    float const *scales;
+    // [output_size] which is the same as "keras.layers.Dense.get_weights()[1]"
+    float const *biases;
+};
+
+// All layers except the last one use the "relu" activation, and the last layer uses the "linear" activation.
+struct ntm_model
+{
+    uint32_t num_frequencies;
+    uint32_t num_layers;
+    ntm_layer layers[NTM_MAX_LAYERS];
+};
+
+// NOTE: the memory of the "data" must remain valid as long as the "ntm_model" is still in use.
+// The output size of each layer is derived from the number of the coefficients, since the input size of the 1st layer is "4 * number of frequencies".
+// Both the NTM asset and the quantized NTM asset are accepted.
+// The inputs of the 1st layer (positional encoding) are signed, and thus the INT8 is NOT allowed for the 1st layer.
+extern bool ntm_model_parse(void const *data, size_t size, ntm_model *out_model);
+
+// FNV-1a of the shapes, the coefficient types and the coefficients, which identifies the network (e.g. the same as the "NTM_AOT_NETWORK_HASH" of the network compiled from the same FP32 NTM asset).
+extern uint64_t ntm_model_hash(ntm_model const *model);
+
+// The size (in bytes, multiple of 4) of the coefficients of one layer.
+extern size_t ntm_layer_coefficients_size(ntm_coefficient_type coefficient_type, uint32_t input_size, uint32_t output_size);
+
+// The "out_layer" references the "coefficients" (aligned to 4 bytes) directly.
+extern void ntm_layer_init(ntm_layer *out_layer, ntm_coefficient_type coefficient_type, uint32_t input_size, uint32_t output_size, void const *coefficients);
+
+#endif
@@ -0,0 +1,307 @@
+#include "ntm-pack.h"
+#include "ntm-file.h"
+#include <string.h>
+#include <assert.h>
+#include <new>
+
+#if defined(__GNUC__)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_MSC_VER)
+#include <sdkddkver.h>
+#define WIN32_LEAN_AND_MEAN
+#define NOCOMM
+#define NOMINMAX
+#include <Windows.h>
+#include <vector>
+#else
+#error Unknown Compiler
+#endif
+
+struct ntm_pack
+{
+    uint8_t const *base;
+    size_t size;
+    ntm_pack_header const *header;
+    ntm_pack_entry const *entries;
+#if defined(_MSC_VER)
+    HANDLE file;
+    HANDLE file_mapping;
+#endif
+};
+
+static inline bool ntm_pack_validate_entry(ntm_pack const *pack, ntm_pack_entry const *entry);
+
+extern ntm_pack *ntm_pack_open(char const *path)
+{
+    uint8_t const *base = NULL;
+    size_t size = 0U;
+#if defined(__GNUC__)
+    {
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (-1 == fd)
+        {
+            return NULL;
+        }
+
+        struct stat stat_buffer;
+        if ((0 != fstat(fd, &stat_buffer)) || (stat_buffer.st_size < static_cast<off_t>(sizeof(ntm_pack_header))))
+        {
+            close(fd);
+            return NULL;
+        }
+
+        size = static_cast<size_t>(stat_buffer.st_size);
+
+        void *mapped = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+
+        // the mapping remains valid after the file descriptor is closed
+        close(fd);
+
+        if (MAP_FAILED == mapped)
+        {
+            return NULL;
+        }
+
+        base = static_cast<uint8_t const *>(mapped);
+    }
+#elif defined(_MSC_VER)
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE file_mapping = NULL;
+    {
+        std::vector<wchar_t> wide_path;
+        if (!ntm_utf8_to_wide(path, wide_path))
+        {
+            return NULL;
+        }
+
+        file = CreateFileW(&wide_path[0], GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+        if (INVALID_HANDLE_VALUE == file)
+        {
+            return NULL;
+        }
+
+        LARGE_INTEGER file_size;
+        if ((FALSE == GetFileSizeEx(file, &file_size)) || (file_size.QuadPart < static_cast<LONGLONG>(sizeof(ntm_pack_header))))
+        {
+            CloseHandle(file);
+            return NULL;
+        }
+
+        size = static_cast<size_t>(file_size.QuadPart);
+
+        file_mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0U, 0U, NULL);
+        if (NULL == file_mapping)
+        {
+            CloseHandle(file);
+            return NULL;
+        }
+
+        base = static_cast<uint8_t const *>(MapViewOfFile(file_mapping, FILE_MAP_READ, 0U, 0U, 0U));
+        if (NULL == base)
+        {
+            CloseHandle(file_mapping);
+            CloseHandle(file);
+            return NULL;
+        }
+    }
+#else
+#error Unknown Compiler
+#endif
+
+    ntm_pack_header const *const header = reinterpret_cast<ntm_pack_header const *>(base);
+
+    bool valid = (NTM_PACK_FOURCC == header->fourcc) && (header->version >= 1U) && (header->version <= NTM_PACK_VERSION);
+    valid = valid && (0U == (header->entries_offset % alignof(ntm_pack_entry))) && (header->entries_offset <= size);
+    valid = valid && ((size - static_cast<size_t>(header->entries_offset)) / sizeof(ntm_pack_entry) >= header->num_entries);
+
+    ntm_pack *pack = NULL;
+    if (valid)
+    {
+        pack = new (std::nothrow) ntm_pack;
+    }
+
+    if (NULL == pack)
+    {
+#if defined(__GNUC__)
+        munmap(const_cast<uint8_t *>(base), size);
+#elif defined(_MSC_VER)
+        UnmapViewOfFile(base);
+        CloseHandle(file_mapping);
+        CloseHandle(file);
+#else
+#error Unknown Compiler
+#endif
+        return NULL;
+    }
+
+    pack->base = base;
+    pack->size = size;
+    pack->header = header;
+    pack->entries = reinterpret_cast<ntm_pack_entry const *>(base + header->entries_offset);
+#if defined(_MSC_VER)
+    pack->file = file;
+    pack->file_mapping = file_mapping;
+#endif
+    return pack;
+}
+
+extern void ntm_pack_close(ntm_pack *pack)
+{
+#if defined(__GNUC__)
+    int result_munmap = munmap(const_cast<uint8_t *>(pack->base), pack->size);
+    assert(0 == result_munmap);
+    (void)result_munmap;
+#elif defined(_MSC_VER)
+    BOOL result_unmap_view_of_file = UnmapViewOfFile(pack->base);
+    assert(FALSE != result_unmap_view_of_file);
+    (void)result_unmap_view_of_file;
+
+    CloseHandle(pack->file_mapping);
+    CloseHandle(pack->file);
+#else
+#error Unknown Compiler
+#endif
+    delete pack;
+}
+
+extern uint32_t ntm_pack_get_count(ntm_pack const *pack)
+{
+    return pack->header->num_entries;
+}
+
+extern uint64_t ntm_pack_hash_name(char const *name, size_t name_size)
+{
+    // FNV-1a 64-bit
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t character_index = 0U; character_index < name_size; ++character_index)
+    {
+        hash ^= static_cast<uint8_t>(name[character_index]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+extern bool ntm_pack_get(ntm_pack const *pack, uint32_t index, ntm_model *out_model, char const **out_name, uint32_t *out_name_size)
+{
+    if (index >= pack->header->num_entries)
+    {
+        return false;
+    }
+
+    ntm_pack_entry const *const entry = pack->entries + index;
+    if (!ntm_pack_validate_entry(pack, entry))
+    {
+        return false;
+    }
+
+    if (NULL != out_model)
+    {
+        ntm_model model = {};
+        model.num_frequencies = entry->num_frequencies;
+        model.num_layers = entry->num_layers;
+
+        uint32_t input_size = 4U * entry->num_frequencies;
+        for (uint32_t layer_index = 0U; layer_index < entry->num_layers; ++layer_index)
+        {
+            uint32_t const output_size = entry->layer_output_sizes[layer_index];
+            ntm_coefficient_type const coefficient_type = static_cast<ntm_coefficient_type>((entry->layer_coefficient_types >> (2U * layer_index)) & 3U);
+
+            ntm_layer_init(&model.layers[layer_index], coefficient_type, input_size, output_size, pack->base + entry->layer_coefficients_offsets[layer_index]);
+
+            input_size = output_size;
+        }
+
+        (*out_model) = model;
+    }
+
+    if (NULL != out_name)
+    {
+        (*out_name) = reinterpret_cast<char const *>(pack->base + entry->name_offset);
+    }
+
+    if (NULL != out_name_size)
+    {
+        (*out_name_size) = entry->name_size;
+    }
+
+    return true;
+}
+
+extern bool ntm_pack_find(ntm_pack const *pack, char const *name, ntm_model *out_model)
+{
+    size_t const name_size = strlen(name);
+    uint64_t const name_hash = ntm_pack_hash_name(name, name_size);
+
+    // lower bound
+    uint32_t first = 0U;
+    uint32_t count = pack->header->num_entries;
+    while (count > 0U)
+    {
+        uint32_t const step = count / 2U;
+        if (pack->entries[first + step].name_hash < name_hash)
+        {
+            first += (step + 1U);
+            count -= (step + 1U);
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    for (uint32_t index = first; (index < pack->header->num_entries) && (name_hash == pack->entries[index].name_hash); ++index)
+    {
+        char const *entry_name;
+        uint32_t entry_name_size;
+        if (ntm_pack_get(pack, index, NULL, &entry_name, &entry_name_size) && (name_size == entry_name_size) && (0 == memcmp(name, entry_name, name_size)))
+        {
+            return ntm_pack_get(pack, index, out_model, NULL, NULL);
+        }
+    }
+
+    return false;
+}
+
+static inline bool ntm_pack_validate_entry(ntm_pack const *pack, ntm_pack_entry const *entry)
+{
+    if ((entry->name_offset > pack->size) || (entry->name_size > (pack->size - entry->name_offset)))
+    {
+        return false;
+    }
+
+    if ((entry->num_frequencies < 1U) || (entry->num_frequencies > NTM_MAX_FREQUENCIES) || (entry->num_layers < 1U) || (entry->num_layers > NTM_MAX_LAYERS))
+    {
+        return false;
+    }
+
+    uint32_t input_size = 4U * entry->num_frequencies;
+    for (uint32_t layer_index = 0U; layer_index < entry->num_layers; ++layer_index)
+    {
+        uint32_t const output_size = entry->layer_output_sizes[layer_index];
+        if ((output_size < 1U) || (output_size > NTM_MAX_LAYER_WIDTH))
+        {
+            return false;
+        }
+
+        uint32_t const coefficient_type = (entry->layer_coefficient_types >> (2U * layer_index)) & 3U;
+        if ((coefficient_type >= NTM_COEFFICIENT_TYPE_COUNT) || ((0U == layer_index) && (NTM_COEFFICIENT_TYPE_INT8 == coefficient_type)))
+        {
+            return false;
+        }
+
+        uint64_t const coefficients_offset = entry->layer_coefficients_offsets[layer_index];
+        uint64_t const coefficients_size = ntm_layer_coefficients_size(static_cast<ntm_coefficient_type>(coefficient_type), input_size, output_size);
+        if ((0U != (coefficients_offset % NTM_PACK_ALIGNMENT)) || (coefficients_offset > pack->size) || (coefficients_size > (pack->size - coefficients_offset)))
+        {
+            return false;
+        }
+
+        input_size = output_size;
+    }
+
+    return (NTM_OUTPUT_SIZE == input_size);
+}
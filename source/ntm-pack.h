@@ -0,0 +1,63 @@
+#ifndef _NTM_PACK_H_
+#define _NTM_PACK_H_ 1
+
+#include "ntm-model.h"
+
+// FourCC('N', 'T', 'M', 'P')
+static constexpr uint32_t const NTM_PACK_FOURCC = (static_cast<uint32_t>('N') | (static_cast<uint32_t>('T') << 8) | (static_cast<uint32_t>('M') << 16) | (static_cast<uint32_t>('P') << 24));
+
+// version 1: all layers are FP32 (the "layer_coefficient_types" is zero)
+// version 2: the "layer_coefficient_types"
+static constexpr uint32_t const NTM_PACK_VERSION = 2;
+
+// The coefficients of each texture mapping layer start at the cache line boundary, which is also the alignment of the AVX-512 load.
+static constexpr uint32_t const NTM_PACK_ALIGNMENT = 64;
+
+// All offsets are relative to the beginning of the pack, and all values are little-endian.
+struct ntm_pack_header
+{
+    uint32_t fourcc;
+    uint32_t version;
+    uint32_t num_entries;
+    uint32_t reserved;
+    // ntm_pack_entry[num_entries] sorted by the "name_hash"
+    uint64_t entries_offset;
+};
+
+struct ntm_pack_entry
+{
+    // FNV-1a 64-bit of the name (without the null terminator)
+    uint64_t name_hash;
+    uint64_t name_offset;
+    uint32_t name_size;
+    uint32_t num_frequencies;
+    uint32_t num_layers;
+    // the "ntm_coefficient_type" of the layer i is the bits [2i, 2i + 2)
+    uint32_t layer_coefficient_types;
+    uint32_t layer_output_sizes[NTM_MAX_LAYERS];
+    // the same as the coefficients of each layer of the (quantized) NTM asset, e.g. weights ([number of inputs][number of outputs]) followed by biases ([number of outputs]) for FP32
+    uint64_t layer_coefficients_offsets[NTM_MAX_LAYERS];
+};
+
+static_assert(24U == sizeof(ntm_pack_header), "the layout of the pack is fixed");
+static_assert(224U == sizeof(ntm_pack_entry), "the layout of the pack is fixed");
+
+struct ntm_pack;
+
+// The pack is memory mapped, and only the header is validated. The pages of the index and the coefficients are merely faulted in when they are touched.
+extern ntm_pack *ntm_pack_open(char const *path);
+
+// NOTE: all "ntm_model" handed out by the pack are invalid after the pack is closed.
+extern void ntm_pack_close(ntm_pack *pack);
+
+extern uint32_t ntm_pack_get_count(ntm_pack const *pack);
+
+extern uint64_t ntm_pack_hash_name(char const *name, size_t name_size);
+
+// The "ntm_model" references the coefficients in the mapped memory directly, namely, there is neither copy nor parse step.
+extern bool ntm_pack_get(ntm_pack const *pack, uint32_t index, ntm_model *out_model, char const **out_name, uint32_t *out_name_size);
+
+// Binary search by the hash of the name, and then compare the name to resolve the collision.
+extern bool ntm_pack_find(ntm_pack const *pack, char const *name, ntm_model *out_model);
+
+#endif
@@ -0,0 +1,411 @@
+#include "ntm-profiler.h"
+#include <assert.h>
+#include <new>
+#include <atomic>
+#include <chrono>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// log2(NTM_PROFILER_SUB_BUCKETS)
+static constexpr uint32_t const NTM_PROFILER_SUB_BUCKET_BITS = 5U;
+static_assert((1U << NTM_PROFILER_SUB_BUCKET_BITS) == NTM_PROFILER_SUB_BUCKETS, "NTM_PROFILER_SUB_BUCKET_BITS");
+
+// The values (nanoseconds) are clamped to 2^40 (about 18 minutes).
+static constexpr uint32_t const NTM_PROFILER_MAX_VALUE_BITS = 40U;
+static constexpr uint32_t const NTM_PROFILER_NUM_BUCKETS = (NTM_PROFILER_SUB_BUCKETS / 2U) * (NTM_PROFILER_MAX_VALUE_BITS - NTM_PROFILER_SUB_BUCKET_BITS + 2U);
+
+// The trace events beyond the capacity are dropped (1.5 MB for each thread).
+static constexpr uint32_t const NTM_PROFILER_MAX_TRACE_EVENTS = 65536U;
+
+static_assert(NTM_MAX_LAYERS == 16U, "the names of the layers");
+
+static char const *const ntm_profiler_stage_names[NTM_PROFILER_STAGE_COUNT] = {
+    "decode",
+    "generate_uvs",
+    "tflite_invoke",
+    "aot_predict",
+    "encode",
+    "layer_0",
+    "layer_1",
+    "layer_2",
+    "layer_3",
+    "layer_4",
+    "layer_5",
+    "layer_6",
+    "layer_7",
+    "layer_8",
+    "layer_9",
+    "layer_10",
+    "layer_11",
+    "layer_12",
+    "layer_13",
+    "layer_14",
+    "layer_15",
+    "output",
+    "block_compress",
+    "deswizzle",
+    "upload",
+    "present"};
+
+// The values are merely written by the owner thread, and thus the relaxed "load + store" is used instead of the "fetch_add" (no locked instruction).
+struct ntm_profiler_histogram
+{
+    std::atomic<uint64_t> num_samples;
+    std::atomic<uint64_t> total;
+    std::atomic<uint64_t> min;
+    std::atomic<uint64_t> max;
+    std::atomic<uint64_t> counts[NTM_PROFILER_NUM_BUCKETS];
+};
+
+struct ntm_profiler_trace_event
+{
+    uint64_t begin;
+    uint64_t duration;
+    ntm_profiler_stage stage;
+};
+
+struct ntm_profiler_thread
+{
+    // the list of all the threads which have recorded (push front merely)
+    ntm_profiler_thread *next;
+    uint32_t thread_index;
+    // NULL: the trace was NOT enabled when this thread recorded the first time
+    ntm_profiler_trace_event *trace_events;
+    // the events [0, num_trace_events) have been written
+    std::atomic<uint32_t> num_trace_events;
+    ntm_profiler_histogram histograms[NTM_PROFILER_STAGE_COUNT];
+};
+
+static std::atomic<bool> ntm_profiler_enabled(false);
+static std::atomic<bool> ntm_profiler_tracing(false);
+static std::atomic<ntm_profiler_thread *> ntm_profiler_threads(NULL);
+static std::atomic<uint32_t> ntm_profiler_num_threads(0U);
+
+static thread_local ntm_profiler_thread *ntm_profiler_current_thread = NULL;
+
+static inline ntm_profiler_thread *ntm_profiler_get_current_thread();
+
+static inline uint32_t ntm_profiler_bucket_index(uint64_t value);
+
+static inline uint64_t ntm_profiler_bucket_upper_bound(uint32_t bucket_index);
+
+static inline void ntm_profiler_merge(ntm_profiler_stage stage, uint64_t *out_num_samples, uint64_t *out_total, uint64_t *out_min, uint64_t *out_max, uint64_t out_counts[NTM_PROFILER_NUM_BUCKETS]);
+
+static inline uint64_t ntm_profiler_percentile(uint64_t num_samples, uint64_t max, uint64_t const counts[NTM_PROFILER_NUM_BUCKETS], double percentile);
+
+extern void ntm_profiler_enable(bool trace)
+{
+    ntm_profiler_tracing.store(trace, std::memory_order_relaxed);
+    ntm_profiler_enabled.store(true, std::memory_order_release);
+}
+
+extern bool ntm_profiler_is_enabled()
+{
+    return ntm_profiler_enabled.load(std::memory_order_relaxed);
+}
+
+extern uint64_t ntm_profiler_now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+extern void ntm_profiler_record(ntm_profiler_stage stage, uint64_t begin, uint64_t end)
+{
+    if (!ntm_profiler_is_enabled())
+    {
+        return;
+    }
+
+    ntm_profiler_record_duration(stage, (end > begin) ? (end - begin) : 0U);
+
+    ntm_profiler_thread *const thread = ntm_profiler_get_current_thread();
+    if ((NULL != thread) && (NULL != thread->trace_events))
+    {
+        uint32_t const num_trace_events = thread->num_trace_events.load(std::memory_order_relaxed);
+        if (num_trace_events < NTM_PROFILER_MAX_TRACE_EVENTS)
+        {
+            thread->trace_events[num_trace_events].begin = begin;
+            thread->trace_events[num_trace_events].duration = (end > begin) ? (end - begin) : 0U;
+            thread->trace_events[num_trace_events].stage = stage;
+
+            // the event is published after it has been written
+            thread->num_trace_events.store(num_trace_events + 1U, std::memory_order_release);
+        }
+    }
+}
+
+extern void ntm_profiler_record_duration(ntm_profiler_stage stage, uint64_t duration)
+{
+    assert((stage >= 0) && (stage < NTM_PROFILER_STAGE_COUNT));
+
+    if (!ntm_profiler_is_enabled())
+    {
+        return;
+    }
+
+    ntm_profiler_thread *const thread = ntm_profiler_get_current_thread();
+    if (NULL == thread)
+    {
+        return;
+    }
+
+    ntm_profiler_histogram *const histogram = &thread->histograms[stage];
+
+    histogram->num_samples.store(histogram->num_samples.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+    histogram->total.store(histogram->total.load(std::memory_order_relaxed) + duration, std::memory_order_relaxed);
+
+    if (duration < histogram->min.load(std::memory_order_relaxed))
+    {
+        histogram->min.store(duration, std::memory_order_relaxed);
+    }
+
+    if (duration > histogram->max.load(std::memory_order_relaxed))
+    {
+        histogram->max.store(duration, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> *const count = &histogram->counts[ntm_profiler_bucket_index(duration)];
+    count->store(count->load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+}
+
+extern char const *ntm_profiler_stage_name(ntm_profiler_stage stage)
+{
+    assert((stage >= 0) && (stage < NTM_PROFILER_STAGE_COUNT));
+    return ntm_profiler_stage_names[stage];
+}
+
+extern bool ntm_profiler_write_json(FILE *file)
+{
+    fprintf(file, "{\n  \"stages\": [");
+
+    bool first = true;
+    for (int stage_index = 0; stage_index < NTM_PROFILER_STAGE_COUNT; ++stage_index)
+    {
+        ntm_profiler_stage const stage = static_cast<ntm_profiler_stage>(stage_index);
+
+        uint64_t num_samples;
+        uint64_t total;
+        uint64_t min;
+        uint64_t max;
+        uint64_t counts[NTM_PROFILER_NUM_BUCKETS];
+        ntm_profiler_merge(stage, &num_samples, &total, &min, &max, counts);
+
+        if (0U == num_samples)
+        {
+            continue;
+        }
+
+        fprintf(file, "%s\n    {\"stage\": \"%s\", \"count\": %llu, \"mean_ms\": %.6f, \"min_ms\": %.6f, \"p50_ms\": %.6f, \"p90_ms\": %.6f, \"p99_ms\": %.6f, \"p999_ms\": %.6f, \"max_ms\": %.6f}", first ? "" : ",", ntm_profiler_stage_name(stage), static_cast<unsigned long long>(num_samples), 1E-6 * static_cast<double>(total) / static_cast<double>(num_samples), 1E-6 * static_cast<double>(min), 1E-6 * static_cast<double>(ntm_profiler_percentile(num_samples, max, counts, 0.5)), 1E-6 * static_cast<double>(ntm_profiler_percentile(num_samples, max, counts, 0.9)), 1E-6 * static_cast<double>(ntm_profiler_percentile(num_samples, max, counts, 0.99)), 1E-6 * static_cast<double>(ntm_profiler_percentile(num_samples, max, counts, 0.999)), 1E-6 * static_cast<double>(max));
+        first = false;
+    }
+
+    fprintf(file, "\n  ]\n}\n");
+
+    return (0 == ferror(file));
+}
+
+extern bool ntm_profiler_write_csv(FILE *file)
+{
+    fprintf(file, "stage,count,mean_ms,min_ms,p50_ms,p90_ms,p99_ms,p999_ms,max_ms\n");
+
+    for (int stage_index = 0; stage_index < NTM_PROFILER_STAGE_COUNT; ++stage_index)
+    {
+        ntm_profiler_stage const stage = static_cast<ntm_profiler_stage>(stage_index);
+
+        uint64_t num_samples;
+        uint64_t total;
+        uint64_t min;
+        uint64_t max;
+        uint64_t counts[NTM_PROFILER_NUM_BUCKETS];
+        ntm_profiler_merge(stage, &num_samples, &total, &min, &max, counts);
+
+        if (0U == num_samples)
+        {
+            continue;
+        }
+
+        fprintf(file, "%s,%llu,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f\n", ntm_profiler_stage_name(stage), static_cast<unsigned long long>(num_samples), 1E-6 * static_cast<double>(total) / static_cast<double>(num_samples), 1E-6 * static_cast<double>(min), 1E-6 * static_cast<double>(ntm_profiler_percentile(num_samples, max, counts, 0.5)), 1E-6 * static_cast<double>(ntm_profiler_percentile(num_samples, max, counts, 0.9)), 1E-6 * static_cast<double>(ntm_profiler_percentile(num_samples, max, counts, 0.99)), 1E-6 * static_cast<double>(ntm_profiler_percentile(num_samples, max, counts, 0.999)), 1E-6 * static_cast<double>(max));
+    }
+
+    return (0 == ferror(file));
+}
+
+extern bool ntm_profiler_write_trace(FILE *file)
+{
+    // the timestamps are relative to the earliest event
+    uint64_t base = UINT64_MAX;
+    for (ntm_profiler_thread const *thread = ntm_profiler_threads.load(std::memory_order_acquire); NULL != thread; thread = thread->next)
+    {
+        uint32_t const num_trace_events = thread->num_trace_events.load(std::memory_order_acquire);
+        for (uint32_t event_index = 0U; event_index < num_trace_events; ++event_index)
+        {
+            if (thread->trace_events[event_index].begin < base)
+            {
+                base = thread->trace_events[event_index].begin;
+            }
+        }
+    }
+
+    fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+
+    bool first = true;
+    for (ntm_profiler_thread const *thread = ntm_profiler_threads.load(std::memory_order_acquire); NULL != thread; thread = thread->next)
+    {
+        uint32_t const num_trace_events = thread->num_trace_events.load(std::memory_order_acquire);
+        for (uint32_t event_index = 0U; event_index < num_trace_events; ++event_index)
+        {
+            ntm_profiler_trace_event const *const event = &thread->trace_events[event_index];
+
+            // microseconds
+            fprintf(file, "%s\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f}", first ? "" : ",", ntm_profiler_stage_name(event->stage), thread->thread_index, 1E-3 * static_cast<double>(event->begin - base), 1E-3 * static_cast<double>(event->duration));
+            first = false;
+        }
+    }
+
+    fprintf(file, "\n]}\n");
+
+    return (0 == ferror(file));
+}
+
+static inline ntm_profiler_thread *ntm_profiler_get_current_thread()
+{
+    ntm_profiler_thread *thread = ntm_profiler_current_thread;
+    if (NULL != thread)
+    {
+        return thread;
+    }
+
+    thread = new (std::nothrow) ntm_profiler_thread;
+    if (NULL == thread)
+    {
+        return NULL;
+    }
+
+    thread->thread_index = ntm_profiler_num_threads.fetch_add(1U, std::memory_order_relaxed);
+
+    thread->trace_events = NULL;
+    if (ntm_profiler_tracing.load(std::memory_order_relaxed))
+    {
+        thread->trace_events = new (std::nothrow) ntm_profiler_trace_event[NTM_PROFILER_MAX_TRACE_EVENTS];
+    }
+    thread->num_trace_events.store(0U, std::memory_order_relaxed);
+
+    for (int stage_index = 0; stage_index < NTM_PROFILER_STAGE_COUNT; ++stage_index)
+    {
+        ntm_profiler_histogram *const histogram = &thread->histograms[stage_index];
+        histogram->num_samples.store(0U, std::memory_order_relaxed);
+        histogram->total.store(0U, std::memory_order_relaxed);
+        histogram->min.store(UINT64_MAX, std::memory_order_relaxed);
+        histogram->max.store(0U, std::memory_order_relaxed);
+        for (uint32_t bucket_index = 0U; bucket_index < NTM_PROFILER_NUM_BUCKETS; ++bucket_index)
+        {
+            histogram->counts[bucket_index].store(0U, std::memory_order_relaxed);
+        }
+    }
+
+    // push front (the initialization is published by the release)
+    ntm_profiler_thread *head = ntm_profiler_threads.load(std::memory_order_relaxed);
+    do
+    {
+        thread->next = head;
+    } while (!ntm_profiler_threads.compare_exchange_weak(head, thread, std::memory_order_release, std::memory_order_relaxed));
+
+    ntm_profiler_current_thread = thread;
+    return thread;
+}
+
+static inline uint32_t ntm_profiler_bucket_index(uint64_t value)
+{
+    if (value < static_cast<uint64_t>(NTM_PROFILER_SUB_BUCKETS))
+    {
+        return static_cast<uint32_t>(value);
+    }
+
+    if (value >= (static_cast<uint64_t>(1U) << NTM_PROFILER_MAX_VALUE_BITS))
+    {
+        value = (static_cast<uint64_t>(1U) << NTM_PROFILER_MAX_VALUE_BITS) - 1U;
+    }
+
+#if defined(__GNUC__)
+    uint32_t const most_significant_bit = 63U - static_cast<uint32_t>(__builtin_clzll(value));
+#elif defined(_MSC_VER)
+    unsigned long most_significant_bit;
+    _BitScanReverse64(&most_significant_bit, value);
+#else
+#error Unknown Compiler
+#endif
+
+    // (value >> shift) is in [NTM_PROFILER_SUB_BUCKETS / 2, NTM_PROFILER_SUB_BUCKETS)
+    uint32_t const shift = static_cast<uint32_t>(most_significant_bit) - (NTM_PROFILER_SUB_BUCKET_BITS - 1U);
+    uint32_t const bucket_index = (NTM_PROFILER_SUB_BUCKETS / 2U) * shift + static_cast<uint32_t>(value >> shift);
+    assert(bucket_index < NTM_PROFILER_NUM_BUCKETS);
+    return bucket_index;
+}
+
+static inline uint64_t ntm_profiler_bucket_upper_bound(uint32_t bucket_index)
+{
+    if (bucket_index < NTM_PROFILER_SUB_BUCKETS)
+    {
+        return bucket_index;
+    }
+
+    uint32_t const shift = bucket_index / (NTM_PROFILER_SUB_BUCKETS / 2U) - 1U;
+    uint64_t const sub_bucket_index = bucket_index - (NTM_PROFILER_SUB_BUCKETS / 2U) * shift;
+    return ((sub_bucket_index + 1U) << shift) - 1U;
+}
+
+static inline void ntm_profiler_merge(ntm_profiler_stage stage, uint64_t *out_num_samples, uint64_t *out_total, uint64_t *out_min, uint64_t *out_max, uint64_t out_counts[NTM_PROFILER_NUM_BUCKETS])
+{
+    (*out_num_samples) = 0U;
+    (*out_total) = 0U;
+    (*out_min) = UINT64_MAX;
+    (*out_max) = 0U;
+    for (uint32_t bucket_index = 0U; bucket_index < NTM_PROFILER_NUM_BUCKETS; ++bucket_index)
+    {
+        out_counts[bucket_index] = 0U;
+    }
+
+    for (ntm_profiler_thread const *thread = ntm_profiler_threads.load(std::memory_order_acquire); NULL != thread; thread = thread->next)
+    {
+        ntm_profiler_histogram const *const histogram = &thread->histograms[stage];
+
+        uint64_t const min = histogram->min.load(std::memory_order_relaxed);
+        uint64_t const max = histogram->max.load(std::memory_order_relaxed);
+        (*out_min) = (min < (*out_min)) ? min : (*out_min);
+        (*out_max) = (max > (*out_max)) ? max : (*out_max);
+        (*out_total) += histogram->total.load(std::memory_order_relaxed);
+
+        // the "num_samples" is the sum of the buckets, which is consistent with the percentiles
+        for (uint32_t bucket_index = 0U; bucket_index < NTM_PROFILER_NUM_BUCKETS; ++bucket_index)
+        {
+            uint64_t const count = histogram->counts[bucket_index].load(std::memory_order_relaxed);
+            out_counts[bucket_index] += count;
+            (*out_num_samples) += count;
+        }
+    }
+}
+
+static inline uint64_t ntm_profiler_percentile(uint64_t num_samples, uint64_t max, uint64_t const counts[NTM_PROFILER_NUM_BUCKETS], double percentile)
+{
+    assert(num_samples > 0U);
+
+    // the rank of the sample (1-based)
+    uint64_t rank = static_cast<uint64_t>(percentile * static_cast<double>(num_samples) + 0.5);
+    rank = (rank < 1U) ? 1U : ((rank > num_samples) ? num_samples : rank);
+
+    uint64_t cumulative_count = 0U;
+    for (uint32_t bucket_index = 0U; bucket_index < NTM_PROFILER_NUM_BUCKETS; ++bucket_index)
+    {
+        cumulative_count += counts[bucket_index];
+        if (cumulative_count >= rank)
+        {
+            // the highest value which is equivalent to this bucket (the same as the HdrHistogram), which is NOT greater than the maximum
+            uint64_t const upper_bound = ntm_profiler_bucket_upper_bound(bucket_index);
+            return (upper_bound < max) ? upper_bound : max;
+        }
+    }
+
+    return max;
+}
@@ -0,0 +1,63 @@
+#ifndef _NTM_PROFILER_H_
+#define _NTM_PROFILER_H_ 1
+
+#include "ntm-model.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// The stages of the hot path.
+enum ntm_profiler_stage
+{
+    // the "predict" of the whole texture (or the band)
+    NTM_PROFILER_STAGE_DECODE = 0,
+    NTM_PROFILER_STAGE_GENERATE_UVS = 1,
+    NTM_PROFILER_STAGE_TFLITE_INVOKE = 2,
+    // the network is fused by the AOT compiler, and thus the layers are NOT measured separately
+    NTM_PROFILER_STAGE_AOT_PREDICT = 3,
+    // CPU engine: the positional encoding and each layer (accumulated over the grid)
+    NTM_PROFILER_STAGE_ENCODE = 4,
+    NTM_PROFILER_STAGE_LAYER_0 = 5,
+    // float RGB -> pixels (fused into the grid decode of the CPU engine)
+    NTM_PROFILER_STAGE_OUTPUT = NTM_PROFILER_STAGE_LAYER_0 + NTM_MAX_LAYERS,
+    // the pixels -> the BC1 / BC7 blocks
+    NTM_PROFILER_STAGE_BLOCK_COMPRESS,
+    // the TILED or MORTON layout -> the row-major frame buffer
+    NTM_PROFILER_STAGE_DESWIZZLE,
+    // "xcb_put_image" or "SetDIBits"
+    NTM_PROFILER_STAGE_UPLOAD,
+    NTM_PROFILER_STAGE_PRESENT,
+    NTM_PROFILER_STAGE_COUNT
+};
+
+// The histograms are log-linear (the same as the HdrHistogram): the values (nanoseconds) within [2^k, 2^(k+1)) are split into NTM_PROFILER_SUB_BUCKETS / 2 buckets, and thus the relative error of the percentiles is less than 2 / NTM_PROFILER_SUB_BUCKETS.
+static constexpr uint32_t const NTM_PROFILER_SUB_BUCKETS = 32U;
+
+// Each thread owns the histograms (and the trace events) written by this thread merely, and thus the recording is lock-free.
+// The records of the threads are never freed, since the threads (e.g. the workers of the thread pool) may have exited before the report is written.
+// The profiler is disabled by default, and the cost of the disabled profiler is merely one relaxed load.
+extern void ntm_profiler_enable(bool trace);
+
+extern bool ntm_profiler_is_enabled();
+
+// nanoseconds (monotonic)
+extern uint64_t ntm_profiler_now();
+
+// The trace event is also recorded if the trace is enabled.
+extern void ntm_profiler_record(ntm_profiler_stage stage, uint64_t begin, uint64_t end);
+
+// The histogram merely (e.g. the duration accumulated over the batches).
+extern void ntm_profiler_record_duration(ntm_profiler_stage stage, uint64_t duration);
+
+extern char const *ntm_profiler_stage_name(ntm_profiler_stage stage);
+
+// The stages without any sample are skipped, and the times are in milliseconds.
+// May be called while the other threads are still recording, and the report is a snapshot which may be slightly inconsistent.
+extern bool ntm_profiler_write_json(FILE *file);
+
+extern bool ntm_profiler_write_csv(FILE *file);
+
+// The Trace Event Format which can be opened by the "chrome://tracing" or the Perfetto.
+extern bool ntm_profiler_write_trace(FILE *file);
+
+#endif
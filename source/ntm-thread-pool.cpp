@@ -0,0 +1,265 @@
+#include "ntm-thread-pool.h"
+#include <assert.h>
+#include <new>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+// Each range is on its own cache line to avoid the false sharing between the workers.
+struct alignas(64) ntm_thread_pool_range
+{
+    std::mutex mutex;
+    uint32_t begin;
+    uint32_t end;
+};
+
+struct ntm_thread_pool
+{
+    uint32_t num_workers;
+    ntm_thread_pool_range *ranges;
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable job_condition;
+    std::condition_variable done_condition;
+    uint64_t job_generation;
+    uint32_t num_busy_workers;
+    bool quit;
+    ntm_thread_pool_task task;
+    void *user_data;
+};
+
+static inline void ntm_thread_pool_worker_main(ntm_thread_pool *thread_pool, uint32_t worker_index);
+
+static inline void ntm_thread_pool_run(ntm_thread_pool *thread_pool, uint32_t worker_index, ntm_thread_pool_task task, void *user_data);
+
+static inline bool ntm_thread_pool_pop(ntm_thread_pool_range *range, uint32_t *out_task_index);
+
+static inline bool ntm_thread_pool_steal(ntm_thread_pool *thread_pool, uint32_t worker_index);
+
+extern ntm_thread_pool *ntm_thread_pool_create(uint32_t num_workers)
+{
+    if (0U == num_workers)
+    {
+        // may be zero if NOT computable
+        num_workers = std::thread::hardware_concurrency();
+        if (0U == num_workers)
+        {
+            num_workers = 1U;
+        }
+    }
+
+    ntm_thread_pool *thread_pool = new (std::nothrow) ntm_thread_pool;
+    if (NULL == thread_pool)
+    {
+        return NULL;
+    }
+
+    thread_pool->ranges = new (std::nothrow) ntm_thread_pool_range[num_workers];
+    if (NULL == thread_pool->ranges)
+    {
+        delete thread_pool;
+        return NULL;
+    }
+
+    thread_pool->num_workers = num_workers;
+    for (uint32_t worker_index = 0U; worker_index < num_workers; ++worker_index)
+    {
+        thread_pool->ranges[worker_index].begin = 0U;
+        thread_pool->ranges[worker_index].end = 0U;
+    }
+    thread_pool->job_generation = 0U;
+    thread_pool->num_busy_workers = 0U;
+    thread_pool->quit = false;
+    thread_pool->task = NULL;
+    thread_pool->user_data = NULL;
+
+    // the worker 0 is the calling thread of the "ntm_thread_pool_parallel_for"
+    thread_pool->threads.reserve(num_workers - 1U);
+    for (uint32_t worker_index = 1U; worker_index < num_workers; ++worker_index)
+    {
+        thread_pool->threads.emplace_back(ntm_thread_pool_worker_main, thread_pool, worker_index);
+    }
+
+    return thread_pool;
+}
+
+extern void ntm_thread_pool_destroy(ntm_thread_pool *thread_pool)
+{
+    {
+        std::lock_guard<std::mutex> lock(thread_pool->mutex);
+        assert(0U == thread_pool->num_busy_workers);
+        thread_pool->quit = true;
+    }
+    thread_pool->job_condition.notify_all();
+
+    for (std::thread &thread : thread_pool->threads)
+    {
+        thread.join();
+    }
+
+    delete[] thread_pool->ranges;
+    delete thread_pool;
+}
+
+extern uint32_t ntm_thread_pool_get_num_workers(ntm_thread_pool const *thread_pool)
+{
+    return thread_pool->num_workers;
+}
+
+extern void ntm_thread_pool_parallel_for(ntm_thread_pool *thread_pool, uint32_t num_tasks, ntm_thread_pool_task task, void *user_data)
+{
+    if (0U == num_tasks)
+    {
+        return;
+    }
+
+    uint32_t const num_workers = thread_pool->num_workers;
+
+    // no need to wake up the other workers
+    if ((1U == num_workers) || (1U == num_tasks))
+    {
+        for (uint32_t task_index = 0U; task_index < num_tasks; ++task_index)
+        {
+            task(user_data, 0U, task_index);
+        }
+        return;
+    }
+
+    for (uint32_t worker_index = 0U; worker_index < num_workers; ++worker_index)
+    {
+        ntm_thread_pool_range *const range = &thread_pool->ranges[worker_index];
+
+        std::lock_guard<std::mutex> lock(range->mutex);
+        range->begin = static_cast<uint32_t>((static_cast<uint64_t>(num_tasks) * worker_index) / num_workers);
+        range->end = static_cast<uint32_t>((static_cast<uint64_t>(num_tasks) * (worker_index + 1U)) / num_workers);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(thread_pool->mutex);
+        assert(0U == thread_pool->num_busy_workers);
+        thread_pool->task = task;
+        thread_pool->user_data = user_data;
+        thread_pool->num_busy_workers = num_workers - 1U;
+        ++thread_pool->job_generation;
+    }
+    thread_pool->job_condition.notify_all();
+
+    ntm_thread_pool_run(thread_pool, 0U, task, user_data);
+
+    {
+        std::unique_lock<std::mutex> lock(thread_pool->mutex);
+        thread_pool->done_condition.wait(lock, [thread_pool]() { return (0U == thread_pool->num_busy_workers); });
+    }
+}
+
+static inline void ntm_thread_pool_worker_main(ntm_thread_pool *thread_pool, uint32_t worker_index)
+{
+    uint64_t job_generation = 0U;
+    while (true)
+    {
+        ntm_thread_pool_task task;
+        void *user_data;
+        {
+            std::unique_lock<std::mutex> lock(thread_pool->mutex);
+            thread_pool->job_condition.wait(lock, [thread_pool, job_generation]() { return thread_pool->quit || (job_generation != thread_pool->job_generation); });
+
+            if (thread_pool->quit)
+            {
+                break;
+            }
+
+            job_generation = thread_pool->job_generation;
+            task = thread_pool->task;
+            user_data = thread_pool->user_data;
+        }
+
+        ntm_thread_pool_run(thread_pool, worker_index, task, user_data);
+
+        bool last_worker;
+        {
+            std::lock_guard<std::mutex> lock(thread_pool->mutex);
+            assert(thread_pool->num_busy_workers > 0U);
+            --thread_pool->num_busy_workers;
+            last_worker = (0U == thread_pool->num_busy_workers);
+        }
+
+        if (last_worker)
+        {
+            thread_pool->done_condition.notify_one();
+        }
+    }
+}
+
+static inline void ntm_thread_pool_run(ntm_thread_pool *thread_pool, uint32_t worker_index, ntm_thread_pool_task task, void *user_data)
+{
+    ntm_thread_pool_range *const range = &thread_pool->ranges[worker_index];
+
+    do
+    {
+        uint32_t task_index;
+        while (ntm_thread_pool_pop(range, &task_index))
+        {
+            task(user_data, worker_index, task_index);
+        }
+    } while (ntm_thread_pool_steal(thread_pool, worker_index));
+}
+
+static inline bool ntm_thread_pool_pop(ntm_thread_pool_range *range, uint32_t *out_task_index)
+{
+    std::lock_guard<std::mutex> lock(range->mutex);
+
+    if (range->begin < range->end)
+    {
+        (*out_task_index) = range->begin;
+        ++range->begin;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+static inline bool ntm_thread_pool_steal(ntm_thread_pool *thread_pool, uint32_t worker_index)
+{
+    uint32_t const num_workers = thread_pool->num_workers;
+
+    // The tasks stolen are "in flight" until they are stored into the range of the thief, during which the other thieves may NOT see them.
+    // But they will always be executed by this thief, and thus no task is lost.
+    for (uint32_t victim_offset = 1U; victim_offset < num_workers; ++victim_offset)
+    {
+        ntm_thread_pool_range *const victim_range = &thread_pool->ranges[(worker_index + victim_offset) % num_workers];
+
+        uint32_t stolen_begin;
+        uint32_t stolen_end;
+        {
+            std::lock_guard<std::mutex> lock(victim_range->mutex);
+
+            if (victim_range->begin >= victim_range->end)
+            {
+                continue;
+            }
+
+            // the back half (round up) since the victim is popping the front
+            uint32_t const num_stolen_tasks = (victim_range->end - victim_range->begin + 1U) / 2U;
+            stolen_end = victim_range->end;
+            stolen_begin = stolen_end - num_stolen_tasks;
+            victim_range->end = stolen_begin;
+        }
+
+        {
+            ntm_thread_pool_range *const range = &thread_pool->ranges[worker_index];
+
+            std::lock_guard<std::mutex> lock(range->mutex);
+            assert(range->begin >= range->end);
+            range->begin = stolen_begin;
+            range->end = stolen_end;
+        }
+
+        return true;
+    }
+
+    return false;
+}
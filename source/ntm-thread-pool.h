@@ -0,0 +1,24 @@
+#ifndef _NTM_THREAD_POOL_H_
+#define _NTM_THREAD_POOL_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct ntm_thread_pool;
+
+// The "worker_index" is in [0, number of workers), and can be used to index the state owned by each worker.
+typedef void (*ntm_thread_pool_task)(void *user_data, uint32_t worker_index, uint32_t task_index);
+
+// 0: one worker for each hardware thread
+// The calling thread of the "ntm_thread_pool_parallel_for" is always the worker 0, and thus only (number of workers - 1) threads are created.
+extern ntm_thread_pool *ntm_thread_pool_create(uint32_t num_workers);
+
+extern void ntm_thread_pool_destroy(ntm_thread_pool *thread_pool);
+
+extern uint32_t ntm_thread_pool_get_num_workers(ntm_thread_pool const *thread_pool);
+
+// The tasks are evenly split into one contiguous range for each worker. When the range of a worker is exhausted, the worker steals the back half of the range of another worker.
+// This function returns after all tasks have been completed. It is NOT reentrant, namely, the tasks must NOT call this function of the same thread pool.
+extern void ntm_thread_pool_parallel_for(ntm_thread_pool *thread_pool, uint32_t num_tasks, ntm_thread_pool_task task, void *user_data);
+
+#endif
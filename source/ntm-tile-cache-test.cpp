@@ -0,0 +1,198 @@
+#include "ntm-tile-cache.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+// The tests of the "ntm_tile_cache" (built and run by the "test" target of the Linux makefile).
+// The network is a tiny synthetic NTM asset (2 frequencies, 8 -> 16 -> 3), since merely the bookkeeping of the cache is tested, and each tile is compared with the tile decoded by the "ntm_cpu_engine_predict_grid_pixels" directly.
+
+static constexpr uint32_t const TEST_TEXTURE_SIZE = 4U * NTM_TILE_CACHE_TILE_SIZE;
+
+static inline bool test_create_model(std::vector<uint32_t> &out_data, ntm_model *out_model);
+
+static inline bool test_check(bool condition, char const *name, char const *message);
+
+static inline bool test_tile_equal(ntm_cpu_engine const *engine, ntm_tile_key const *key, ntm_tile_texel const *tile);
+
+static inline bool test_cached(ntm_tile_cache *cache, ntm_cpu_engine const *engine, ntm_tile_key const *key);
+
+static inline bool test_duplicate_keys(ntm_cpu_engine const *engine);
+
+static inline bool test_hit_then_miss(ntm_cpu_engine const *engine);
+
+static inline bool test_capacity_overflow(ntm_cpu_engine const *engine);
+
+int main()
+{
+    std::vector<uint32_t> data;
+    ntm_model model;
+    if (!test_create_model(data, &model))
+    {
+        fprintf(stderr, "Invalid NTM asset\n");
+        return 1;
+    }
+
+    ntm_cpu_engine engine;
+    ntm_cpu_engine_init(&engine, &model, ntm_cpu_detect_isa());
+
+    bool passed = true;
+    passed = test_duplicate_keys(&engine) && passed;
+    passed = test_hit_then_miss(&engine) && passed;
+    passed = test_capacity_overflow(&engine) && passed;
+
+    fprintf(stdout, "%s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}
+
+static inline bool test_duplicate_keys(ntm_cpu_engine const *engine)
+{
+    char const *const name = "duplicate keys";
+
+    ntm_tile_cache *cache = ntm_tile_cache_create(4U, 1U, 4U);
+    uint32_t const texture = ntm_tile_cache_register_texture(cache, engine, TEST_TEXTURE_SIZE, TEST_TEXTURE_SIZE);
+
+    // the same tile is merely decoded once
+    ntm_tile_key const keys[4] = {{texture, 0U, 1U, 2U}, {texture, 0U, 1U, 2U}, {texture, 0U, 3U, 3U}, {texture, 0U, 1U, 2U}};
+    ntm_tile_cache_prefetch(cache, 4U, keys);
+
+    ntm_tile_cache_statistics statistics;
+    ntm_tile_cache_get_statistics(cache, &statistics);
+
+    bool passed = test_check(2U == statistics.prefetches, name, "the duplicated keys are decoded more than once");
+    passed = test_check(test_cached(cache, engine, &keys[0]), name, "the tile of the duplicated keys is NOT cached") && passed;
+    passed = test_check(test_cached(cache, engine, &keys[2]), name, "the tile after the duplicated keys is NOT cached") && passed;
+
+    ntm_tile_cache_destroy(cache);
+    return passed;
+}
+
+static inline bool test_hit_then_miss(ntm_cpu_engine const *engine)
+{
+    char const *const name = "hit then miss";
+
+    ntm_tile_cache *cache = ntm_tile_cache_create(2U, 1U, 4U);
+    uint32_t const texture = ntm_tile_cache_register_texture(cache, engine, TEST_TEXTURE_SIZE, TEST_TEXTURE_SIZE);
+
+    ntm_tile_key const X = {texture, 0U, 0U, 0U};
+    ntm_tile_key const Y = {texture, 0U, 1U, 0U};
+    ntm_tile_key const N1 = {texture, 0U, 2U, 0U};
+    ntm_tile_key const N2 = {texture, 0U, 3U, 0U};
+
+    ntm_tile_cache_acquire(cache, &X);
+    ntm_tile_cache_acquire(cache, &Y);
+
+    // The hit of "Y" moves it to the front of the LRU list, and thus the "N1" (allocated by the same call) is the least recently used when the "N2" misses.
+    // Since both slots are used by this call, the "N2" exceeds the "max_tiles" and is NOT decoded.
+    ntm_tile_key const keys[3] = {N1, Y, N2};
+    ntm_tile_cache_prefetch(cache, 3U, keys);
+
+    ntm_tile_cache_statistics statistics;
+    ntm_tile_cache_get_statistics(cache, &statistics);
+
+    bool passed = test_check(1U == statistics.prefetches, name, "the slot allocated by the same call is decoded twice");
+    passed = test_check(test_cached(cache, engine, &N1), name, "the tile allocated by the same call is evicted") && passed;
+    passed = test_check(test_cached(cache, engine, &Y), name, "the hit of the same call is evicted") && passed;
+
+    ntm_tile_cache_destroy(cache);
+    return passed;
+}
+
+static inline bool test_capacity_overflow(ntm_cpu_engine const *engine)
+{
+    char const *const name = "capacity overflow";
+
+    ntm_tile_cache *cache = ntm_tile_cache_create(3U, 1U, 4U);
+    uint32_t const texture = ntm_tile_cache_register_texture(cache, engine, TEST_TEXTURE_SIZE, TEST_TEXTURE_SIZE);
+
+    // the invalid key is ignored, and merely the first "max_tiles" distinct keys are decoded
+    ntm_tile_key const keys[6] = {{texture, 0U, 0U, 1U}, {texture, 0U, 4U, 0U}, {texture, 0U, 1U, 1U}, {texture, 0U, 2U, 1U}, {texture, 0U, 3U, 1U}, {texture, 0U, 0U, 2U}};
+    ntm_tile_cache_prefetch(cache, 6U, keys);
+
+    ntm_tile_cache_statistics statistics;
+    ntm_tile_cache_get_statistics(cache, &statistics);
+
+    bool passed = test_check(3U == statistics.prefetches, name, "the number of the decoded tiles is NOT the max_tiles");
+    passed = test_check(0U == statistics.evictions, name, "the tiles of the same call evict each other") && passed;
+    passed = test_check(test_cached(cache, engine, &keys[0]), name, "the 1st tile is NOT cached") && passed;
+    passed = test_check(test_cached(cache, engine, &keys[2]), name, "the 2nd tile is NOT cached") && passed;
+    passed = test_check(test_cached(cache, engine, &keys[3]), name, "the 3rd tile is NOT cached") && passed;
+
+    // the next call evicts the least recently used tiles of the previous call
+    ntm_tile_cache_prefetch(cache, 2U, keys + 4U);
+    ntm_tile_cache_get_statistics(cache, &statistics);
+
+    passed = test_check(5U == statistics.prefetches, name, "the tiles of the next call are NOT decoded") && passed;
+    passed = test_check(2U == statistics.evictions, name, "the tiles of the previous call are NOT evicted") && passed;
+    passed = test_check(test_cached(cache, engine, &keys[4]), name, "the 1st tile of the next call is NOT cached") && passed;
+    passed = test_check(test_cached(cache, engine, &keys[5]), name, "the 2nd tile of the next call is NOT cached") && passed;
+
+    ntm_tile_cache_destroy(cache);
+    return passed;
+}
+
+static inline bool test_create_model(std::vector<uint32_t> &out_data, ntm_model *out_model)
+{
+    static constexpr uint32_t const num_frequencies = 2U;
+    static constexpr uint32_t const layer_sizes[3] = {4U * num_frequencies, 16U, NTM_OUTPUT_SIZE};
+
+    out_data.clear();
+    out_data.push_back(NTM_FOURCC);
+    out_data.push_back(num_frequencies);
+    out_data.push_back(2U);
+
+    // deterministic coefficients of the order of magnitude of the trained network
+    uint32_t coefficient_index = 0U;
+    for (uint32_t layer_index = 0U; layer_index < 2U; ++layer_index)
+    {
+        uint32_t const num_coefficients = (layer_sizes[layer_index] + 1U) * layer_sizes[layer_index + 1U];
+        out_data.push_back(num_coefficients);
+
+        for (uint32_t index = 0U; index < num_coefficients; ++index)
+        {
+            float const coefficient = 0.5F * sinf(0.7F * static_cast<float>(coefficient_index) + 0.3F);
+            ++coefficient_index;
+
+            uint32_t value;
+            memcpy(&value, &coefficient, sizeof(value));
+            out_data.push_back(value);
+        }
+    }
+
+    return ntm_model_parse(&out_data[0], sizeof(uint32_t) * out_data.size(), out_model);
+}
+
+static inline bool test_check(bool condition, char const *name, char const *message)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "%s: %s\n", name, message);
+    }
+    return condition;
+}
+
+static inline bool test_tile_equal(ntm_cpu_engine const *engine, ntm_tile_key const *key, ntm_tile_texel const *tile)
+{
+    // all the tiles of the test are of the full size (mip 0)
+    std::vector<ntm_tile_texel> reference(NTM_TILE_CACHE_TILE_SIZE * NTM_TILE_CACHE_TILE_SIZE);
+    ntm_pixel_encoding const encoding = {NTM_PIXEL_FORMAT_R8G8B8A8_UNORM, false};
+    ntm_cpu_engine_predict_grid_pixels(engine, TEST_TEXTURE_SIZE, TEST_TEXTURE_SIZE, NTM_TILE_CACHE_TILE_SIZE * key->tile_x, NTM_TILE_CACHE_TILE_SIZE * key->tile_y, NTM_TILE_CACHE_TILE_SIZE, NTM_TILE_CACHE_TILE_SIZE, &encoding, &reference[0], sizeof(ntm_tile_texel) * NTM_TILE_CACHE_TILE_SIZE);
+
+    return 0 == memcmp(&reference[0], tile, sizeof(ntm_tile_texel) * reference.size());
+}
+
+static inline bool test_cached(ntm_tile_cache *cache, ntm_cpu_engine const *engine, ntm_tile_key const *key)
+{
+    // the tile is cached if the "acquire" is a hit (and the texels are the same as the direct decode)
+    ntm_tile_cache_statistics before;
+    ntm_tile_cache_get_statistics(cache, &before);
+
+    ntm_tile_texel const *const tile = ntm_tile_cache_acquire(cache, key);
+
+    ntm_tile_cache_statistics after;
+    ntm_tile_cache_get_statistics(cache, &after);
+
+    return (NULL != tile) && (after.misses == before.misses) && test_tile_equal(engine, key, tile);
+}
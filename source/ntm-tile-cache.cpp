@@ -0,0 +1,498 @@
+#include "ntm-tile-cache.h"
+#include "ntm-thread-pool.h"
+#include <assert.h>
+#include <string.h>
+#include <new>
+#include <vector>
+
+static constexpr uint32_t const NTM_TILE_CACHE_INVALID_INDEX = ~0U;
+
+static constexpr uint32_t const NTM_TILE_CACHE_TILE_TEXELS = NTM_TILE_CACHE_TILE_SIZE * NTM_TILE_CACHE_TILE_SIZE;
+
+struct ntm_tile_cache_texture
+{
+    ntm_cpu_engine const *engine;
+    uint32_t width;
+    uint32_t height;
+    uint32_t num_mips;
+};
+
+// The slot of the pool holds one tile.
+// The slots are linked into both the LRU list (doubly linked, the head is the most recently used) and the bucket of the page table (singly linked).
+struct ntm_tile_cache_slot
+{
+    ntm_tile_key key;
+    uint32_t lru_previous;
+    uint32_t lru_next;
+    uint32_t bucket_next;
+    // the slot is pinned while it is equal to the "pin_generation" of the cache (see the "ntm_tile_cache_prefetch")
+    uint32_t pin_generation;
+    bool valid;
+};
+
+struct ntm_tile_cache
+{
+    uint32_t max_tiles;
+    ntm_tile_cache_slot *slots;
+    ntm_tile_texel *texels;
+    // the number of the buckets is a power of 2 (at least twice the "max_tiles")
+    uint32_t bucket_mask;
+    uint32_t *buckets;
+    uint32_t lru_head;
+    uint32_t lru_tail;
+    // the slots which have never been used
+    uint32_t num_used_slots;
+
+    uint32_t max_textures;
+    uint32_t num_textures;
+    ntm_tile_cache_texture *textures;
+
+    ntm_thread_pool *thread_pool;
+    // the slots to be decoded by the "ntm_tile_cache_prefetch"
+    std::vector<uint32_t> prefetch_slots;
+    // odd: the "ntm_tile_cache_prefetch" is in progress, and the slots of this generation are NOT evicted
+    // even: no slot is pinned
+    uint32_t pin_generation;
+
+    ntm_tile_cache_statistics statistics;
+};
+
+static void ntm_tile_cache_prefetch_task(void *user_data, uint32_t worker_index, uint32_t task_index);
+
+static inline bool ntm_tile_cache_validate_key(ntm_tile_cache const *cache, ntm_tile_key const *key, uint32_t *out_tile_width, uint32_t *out_tile_height);
+
+static inline uint32_t ntm_tile_cache_hash(ntm_tile_key const *key);
+
+static inline uint32_t ntm_tile_cache_find(ntm_tile_cache const *cache, ntm_tile_key const *key);
+
+static inline uint32_t ntm_tile_cache_allocate(ntm_tile_cache *cache, ntm_tile_key const *key);
+
+static inline void ntm_tile_cache_lru_remove(ntm_tile_cache *cache, uint32_t slot_index);
+
+static inline void ntm_tile_cache_lru_push_front(ntm_tile_cache *cache, uint32_t slot_index);
+
+static inline void ntm_tile_cache_decode(ntm_tile_cache const *cache, uint32_t slot_index);
+
+extern ntm_tile_cache *ntm_tile_cache_create(uint32_t max_tiles, uint32_t max_textures, uint32_t num_threads)
+{
+    assert((max_tiles >= 1U) && (max_tiles <= (NTM_TILE_CACHE_INVALID_INDEX / 4U)));
+    assert(max_textures >= 1U);
+
+    ntm_tile_cache *cache = new (std::nothrow) ntm_tile_cache;
+    if (NULL == cache)
+    {
+        return NULL;
+    }
+
+    uint32_t num_buckets = 1U;
+    while (num_buckets < (2U * max_tiles))
+    {
+        num_buckets *= 2U;
+    }
+
+    cache->max_tiles = max_tiles;
+    cache->slots = new (std::nothrow) ntm_tile_cache_slot[max_tiles];
+    cache->texels = new (std::nothrow) ntm_tile_texel[static_cast<size_t>(NTM_TILE_CACHE_TILE_TEXELS) * max_tiles];
+    cache->bucket_mask = num_buckets - 1U;
+    cache->buckets = new (std::nothrow) uint32_t[num_buckets];
+    cache->max_textures = max_textures;
+    cache->num_textures = 0U;
+    cache->textures = new (std::nothrow) ntm_tile_cache_texture[max_textures];
+    cache->thread_pool = ntm_thread_pool_create(num_threads);
+
+    if ((NULL == cache->slots) || (NULL == cache->texels) || (NULL == cache->buckets) || (NULL == cache->textures) || (NULL == cache->thread_pool))
+    {
+        if (NULL != cache->thread_pool)
+        {
+            ntm_thread_pool_destroy(cache->thread_pool);
+        }
+        delete[] cache->textures;
+        delete[] cache->buckets;
+        delete[] cache->texels;
+        delete[] cache->slots;
+        delete cache;
+        return NULL;
+    }
+
+    for (uint32_t slot_index = 0U; slot_index < max_tiles; ++slot_index)
+    {
+        cache->slots[slot_index].pin_generation = 0U;
+        cache->slots[slot_index].valid = false;
+    }
+
+    for (uint32_t bucket_index = 0U; bucket_index < num_buckets; ++bucket_index)
+    {
+        cache->buckets[bucket_index] = NTM_TILE_CACHE_INVALID_INDEX;
+    }
+
+    cache->lru_head = NTM_TILE_CACHE_INVALID_INDEX;
+    cache->lru_tail = NTM_TILE_CACHE_INVALID_INDEX;
+    cache->num_used_slots = 0U;
+
+    cache->prefetch_slots.reserve(max_tiles);
+    cache->pin_generation = 0U;
+
+    cache->statistics.hits = 0U;
+    cache->statistics.misses = 0U;
+    cache->statistics.prefetches = 0U;
+    cache->statistics.evictions = 0U;
+
+    return cache;
+}
+
+extern void ntm_tile_cache_destroy(ntm_tile_cache *cache)
+{
+    ntm_thread_pool_destroy(cache->thread_pool);
+    delete[] cache->textures;
+    delete[] cache->buckets;
+    delete[] cache->texels;
+    delete[] cache->slots;
+    delete cache;
+}
+
+extern uint32_t ntm_tile_cache_register_texture(ntm_tile_cache *cache, ntm_cpu_engine const *engine, uint32_t width, uint32_t height)
+{
+    assert((width >= 1U) && (height >= 1U));
+
+    if (cache->num_textures >= cache->max_textures)
+    {
+        return NTM_TILE_CACHE_INVALID_INDEX;
+    }
+
+    uint32_t num_mips = 1U;
+    while ((num_mips < NTM_TILE_CACHE_MAX_MIPS) && (((width >> num_mips) >= 1U) || ((height >> num_mips) >= 1U)))
+    {
+        ++num_mips;
+    }
+
+    uint32_t const texture = cache->num_textures;
+    cache->textures[texture].engine = engine;
+    cache->textures[texture].width = width;
+    cache->textures[texture].height = height;
+    cache->textures[texture].num_mips = num_mips;
+    ++cache->num_textures;
+
+    return texture;
+}
+
+extern ntm_tile_texel const *ntm_tile_cache_acquire(ntm_tile_cache *cache, ntm_tile_key const *key)
+{
+    uint32_t tile_width;
+    uint32_t tile_height;
+    if (!ntm_tile_cache_validate_key(cache, key, &tile_width, &tile_height))
+    {
+        return NULL;
+    }
+
+    uint32_t slot_index = ntm_tile_cache_find(cache, key);
+    if (NTM_TILE_CACHE_INVALID_INDEX != slot_index)
+    {
+        ++cache->statistics.hits;
+
+        ntm_tile_cache_lru_remove(cache, slot_index);
+        ntm_tile_cache_lru_push_front(cache, slot_index);
+    }
+    else
+    {
+        ++cache->statistics.misses;
+
+        slot_index = ntm_tile_cache_allocate(cache, key);
+
+        ntm_tile_cache_decode(cache, slot_index);
+    }
+
+    return cache->texels + static_cast<size_t>(NTM_TILE_CACHE_TILE_TEXELS) * slot_index;
+}
+
+extern void ntm_tile_cache_prefetch(ntm_tile_cache *cache, uint32_t count, ntm_tile_key const *keys)
+{
+    cache->prefetch_slots.clear();
+
+    // The slots used by this call (both the hits and the allocated slots) are pinned, since a hit moves the older slot to the front of the LRU list, and thus the later miss may otherwise evict the slot allocated by this call (which would be decoded twice concurrently).
+    ++cache->pin_generation;
+    assert(0U != (cache->pin_generation & 1U));
+
+    // At least one slot is NOT pinned when the slot is allocated.
+    uint32_t num_pinned_slots = 0U;
+    for (uint32_t key_index = 0U; (key_index < count) && (num_pinned_slots < cache->max_tiles); ++key_index)
+    {
+        uint32_t tile_width;
+        uint32_t tile_height;
+        if (!ntm_tile_cache_validate_key(cache, &keys[key_index], &tile_width, &tile_height))
+        {
+            continue;
+        }
+
+        uint32_t slot_index = ntm_tile_cache_find(cache, &keys[key_index]);
+        if (NTM_TILE_CACHE_INVALID_INDEX != slot_index)
+        {
+            // NOT counted as the hit, since the tile is NOT actually used
+            ntm_tile_cache_lru_remove(cache, slot_index);
+            ntm_tile_cache_lru_push_front(cache, slot_index);
+        }
+        else
+        {
+            // The slot is inserted into the page table immediately, and thus the duplicated keys are merely decoded once.
+            slot_index = ntm_tile_cache_allocate(cache, &keys[key_index]);
+            cache->prefetch_slots.push_back(slot_index);
+        }
+
+        if (cache->slots[slot_index].pin_generation != cache->pin_generation)
+        {
+            cache->slots[slot_index].pin_generation = cache->pin_generation;
+            ++num_pinned_slots;
+        }
+    }
+
+    cache->statistics.prefetches += cache->prefetch_slots.size();
+
+    ntm_thread_pool_parallel_for(cache->thread_pool, static_cast<uint32_t>(cache->prefetch_slots.size()), ntm_tile_cache_prefetch_task, cache);
+
+    // unpin all slots
+    ++cache->pin_generation;
+
+    // the stale generations of the slots may NOT be reused after the wraparound
+    if (0U == cache->pin_generation)
+    {
+        for (uint32_t slot_index = 0U; slot_index < cache->max_tiles; ++slot_index)
+        {
+            cache->slots[slot_index].pin_generation = 0U;
+        }
+    }
+}
+
+extern void ntm_tile_cache_sample(ntm_tile_cache *cache, uint32_t texture, uint32_t mip, ntm_sampler const *sampler, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3])
+{
+    assert(texture < cache->num_textures);
+    assert(mip < cache->textures[texture].num_mips);
+
+    uint32_t const mip_width = (cache->textures[texture].width >> mip) > 1U ? (cache->textures[texture].width >> mip) : 1U;
+    uint32_t const mip_height = (cache->textures[texture].height >> mip) > 1U ? (cache->textures[texture].height >> mip) : 1U;
+
+    // the queries with locality are likely to hit the same tile
+    ntm_tile_key key = {texture, mip, NTM_TILE_CACHE_INVALID_INDEX, NTM_TILE_CACHE_INVALID_INDEX};
+    ntm_tile_texel const *tile = NULL;
+
+    for (uint32_t query_index = 0U; query_index < count; ++query_index)
+    {
+        float const U = ntm_cpu_address(sampler->address_mode_u, in_UVs[query_index][0]);
+        float const V = ntm_cpu_address(sampler->address_mode_v, in_UVs[query_index][1]);
+
+        uint32_t x = static_cast<uint32_t>(U * static_cast<float>(mip_width));
+        uint32_t y = static_cast<uint32_t>(V * static_cast<float>(mip_height));
+        x = (x < mip_width) ? x : (mip_width - 1U);
+        y = (y < mip_height) ? y : (mip_height - 1U);
+
+        uint32_t const tile_x = x / NTM_TILE_CACHE_TILE_SIZE;
+        uint32_t const tile_y = y / NTM_TILE_CACHE_TILE_SIZE;
+        if ((NULL == tile) || (tile_x != key.tile_x) || (tile_y != key.tile_y))
+        {
+            key.tile_x = tile_x;
+            key.tile_y = tile_y;
+            tile = ntm_tile_cache_acquire(cache, &key);
+            assert(NULL != tile);
+        }
+        else
+        {
+            // the same tile as the previous query (the LRU order does NOT change)
+            ++cache->statistics.hits;
+        }
+
+        ntm_tile_texel const *const texel = tile + (NTM_TILE_CACHE_TILE_SIZE * (y % NTM_TILE_CACHE_TILE_SIZE) + (x % NTM_TILE_CACHE_TILE_SIZE));
+        out_RGBs[query_index][0] = static_cast<float>((*texel)[0]) * (1.0F / 255.0F);
+        out_RGBs[query_index][1] = static_cast<float>((*texel)[1]) * (1.0F / 255.0F);
+        out_RGBs[query_index][2] = static_cast<float>((*texel)[2]) * (1.0F / 255.0F);
+    }
+}
+
+extern void ntm_tile_cache_get_statistics(ntm_tile_cache const *cache, ntm_tile_cache_statistics *out_statistics)
+{
+    (*out_statistics) = cache->statistics;
+}
+
+static void ntm_tile_cache_prefetch_task(void *user_data, uint32_t worker_index, uint32_t task_index)
+{
+    ntm_tile_cache *const cache = static_cast<ntm_tile_cache *>(user_data);
+
+    (void)worker_index;
+
+    ntm_tile_cache_decode(cache, cache->prefetch_slots[task_index]);
+}
+
+static inline bool ntm_tile_cache_validate_key(ntm_tile_cache const *cache, ntm_tile_key const *key, uint32_t *out_tile_width, uint32_t *out_tile_height)
+{
+    if ((key->texture >= cache->num_textures) || (key->mip >= cache->textures[key->texture].num_mips))
+    {
+        return false;
+    }
+
+    ntm_tile_cache_texture const *const texture = &cache->textures[key->texture];
+    uint32_t const mip_width = ((texture->width >> key->mip) > 1U) ? (texture->width >> key->mip) : 1U;
+    uint32_t const mip_height = ((texture->height >> key->mip) > 1U) ? (texture->height >> key->mip) : 1U;
+
+    if ((key->tile_x >= ((mip_width + NTM_TILE_CACHE_TILE_SIZE - 1U) / NTM_TILE_CACHE_TILE_SIZE)) || (key->tile_y >= ((mip_height + NTM_TILE_CACHE_TILE_SIZE - 1U) / NTM_TILE_CACHE_TILE_SIZE)))
+    {
+        return false;
+    }
+
+    uint32_t const tile_x = NTM_TILE_CACHE_TILE_SIZE * key->tile_x;
+    uint32_t const tile_y = NTM_TILE_CACHE_TILE_SIZE * key->tile_y;
+    (*out_tile_width) = ((mip_width - tile_x) < NTM_TILE_CACHE_TILE_SIZE) ? (mip_width - tile_x) : NTM_TILE_CACHE_TILE_SIZE;
+    (*out_tile_height) = ((mip_height - tile_y) < NTM_TILE_CACHE_TILE_SIZE) ? (mip_height - tile_y) : NTM_TILE_CACHE_TILE_SIZE;
+    return true;
+}
+
+static inline uint32_t ntm_tile_cache_hash(ntm_tile_key const *key)
+{
+    // the finalizer of the "MurmurHash3" (fmix64)
+    uint64_t hash = (static_cast<uint64_t>(key->texture) << 40) ^ (static_cast<uint64_t>(key->mip) << 32) ^ (static_cast<uint64_t>(key->tile_y) << 16) ^ static_cast<uint64_t>(key->tile_x);
+    hash ^= (hash >> 33);
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= (hash >> 33);
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= (hash >> 33);
+    return static_cast<uint32_t>(hash);
+}
+
+static inline uint32_t ntm_tile_cache_find(ntm_tile_cache const *cache, ntm_tile_key const *key)
+{
+    for (uint32_t slot_index = cache->buckets[ntm_tile_cache_hash(key) & cache->bucket_mask]; NTM_TILE_CACHE_INVALID_INDEX != slot_index; slot_index = cache->slots[slot_index].bucket_next)
+    {
+        ntm_tile_key const *const slot_key = &cache->slots[slot_index].key;
+        if ((slot_key->texture == key->texture) && (slot_key->mip == key->mip) && (slot_key->tile_x == key->tile_x) && (slot_key->tile_y == key->tile_y))
+        {
+            return slot_index;
+        }
+    }
+
+    return NTM_TILE_CACHE_INVALID_INDEX;
+}
+
+static inline uint32_t ntm_tile_cache_allocate(ntm_tile_cache *cache, ntm_tile_key const *key)
+{
+    uint32_t slot_index;
+    if (cache->num_used_slots < cache->max_tiles)
+    {
+        slot_index = cache->num_used_slots;
+        ++cache->num_used_slots;
+    }
+    else
+    {
+        ++cache->statistics.evictions;
+
+        // the least recently used which is NOT pinned (the pinned slots are near the front of the LRU list)
+        slot_index = cache->lru_tail;
+        assert(NTM_TILE_CACHE_INVALID_INDEX != slot_index);
+        while ((0U != (cache->pin_generation & 1U)) && (cache->slots[slot_index].pin_generation == cache->pin_generation))
+        {
+            slot_index = cache->slots[slot_index].lru_previous;
+            assert(NTM_TILE_CACHE_INVALID_INDEX != slot_index);
+        }
+        assert(cache->slots[slot_index].valid);
+
+        ntm_tile_cache_lru_remove(cache, slot_index);
+
+        // remove from the bucket
+        uint32_t *link = &cache->buckets[ntm_tile_cache_hash(&cache->slots[slot_index].key) & cache->bucket_mask];
+        while ((*link) != slot_index)
+        {
+            assert(NTM_TILE_CACHE_INVALID_INDEX != (*link));
+            link = &cache->slots[(*link)].bucket_next;
+        }
+        (*link) = cache->slots[slot_index].bucket_next;
+    }
+
+    ntm_tile_cache_slot *const slot = &cache->slots[slot_index];
+    slot->key = (*key);
+    slot->valid = true;
+
+    uint32_t *const bucket = &cache->buckets[ntm_tile_cache_hash(key) & cache->bucket_mask];
+    slot->bucket_next = (*bucket);
+    (*bucket) = slot_index;
+
+    ntm_tile_cache_lru_push_front(cache, slot_index);
+
+    return slot_index;
+}
+
+static inline void ntm_tile_cache_lru_remove(ntm_tile_cache *cache, uint32_t slot_index)
+{
+    ntm_tile_cache_slot *const slot = &cache->slots[slot_index];
+
+    if (NTM_TILE_CACHE_INVALID_INDEX != slot->lru_previous)
+    {
+        cache->slots[slot->lru_previous].lru_next = slot->lru_next;
+    }
+    else
+    {
+        assert(cache->lru_head == slot_index);
+        cache->lru_head = slot->lru_next;
+    }
+
+    if (NTM_TILE_CACHE_INVALID_INDEX != slot->lru_next)
+    {
+        cache->slots[slot->lru_next].lru_previous = slot->lru_previous;
+    }
+    else
+    {
+        assert(cache->lru_tail == slot_index);
+        cache->lru_tail = slot->lru_previous;
+    }
+}
+
+static inline void ntm_tile_cache_lru_push_front(ntm_tile_cache *cache, uint32_t slot_index)
+{
+    ntm_tile_cache_slot *const slot = &cache->slots[slot_index];
+
+    slot->lru_previous = NTM_TILE_CACHE_INVALID_INDEX;
+    slot->lru_next = cache->lru_head;
+
+    if (NTM_TILE_CACHE_INVALID_INDEX != cache->lru_head)
+    {
+        cache->slots[cache->lru_head].lru_previous = slot_index;
+    }
+    else
+    {
+        cache->lru_tail = slot_index;
+    }
+
+    cache->lru_head = slot_index;
+}
+
+static inline void ntm_tile_cache_decode(ntm_tile_cache const *cache, uint32_t slot_index)
+{
+    ntm_tile_key const *const key = &cache->slots[slot_index].key;
+    ntm_tile_cache_texture const *const texture = &cache->textures[key->texture];
+
+    uint32_t tile_width;
+    uint32_t tile_height;
+    bool const valid = ntm_tile_cache_validate_key(cache, key, &tile_width, &tile_height);
+    assert(valid);
+    (void)valid;
+
+    uint32_t const mip_width = ((texture->width >> key->mip) > 1U) ? (texture->width >> key->mip) : 1U;
+    uint32_t const mip_height = ((texture->height >> key->mip) > 1U) ? (texture->height >> key->mip) : 1U;
+
+    // the tile is a regular grid of the mip, and the texels are written into the slot directly
+    ntm_tile_texel *const texels = cache->texels + static_cast<size_t>(NTM_TILE_CACHE_TILE_TEXELS) * slot_index;
+    ntm_pixel_encoding const encoding = {NTM_PIXEL_FORMAT_R8G8B8A8_UNORM, false};
+    ntm_cpu_engine_predict_grid_pixels(texture->engine, mip_width, mip_height, NTM_TILE_CACHE_TILE_SIZE * key->tile_x, NTM_TILE_CACHE_TILE_SIZE * key->tile_y, tile_width, tile_height, &encoding, texels, sizeof(ntm_tile_texel) * NTM_TILE_CACHE_TILE_SIZE);
+
+    // the padding replicates the edge of the mip
+    for (uint32_t y = 0U; y < NTM_TILE_CACHE_TILE_SIZE; ++y)
+    {
+        ntm_tile_texel *const row = &texels[NTM_TILE_CACHE_TILE_SIZE * y];
+
+        if (y >= tile_height)
+        {
+            memcpy(row, &texels[NTM_TILE_CACHE_TILE_SIZE * (tile_height - 1U)], sizeof(ntm_tile_texel) * NTM_TILE_CACHE_TILE_SIZE);
+        }
+        else
+        {
+            for (uint32_t x = tile_width; x < NTM_TILE_CACHE_TILE_SIZE; ++x)
+            {
+                memcpy(&row[x], &row[tile_width - 1U], sizeof(ntm_tile_texel));
+            }
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef _NTM_TILE_CACHE_H_
+#define _NTM_TILE_CACHE_H_ 1
+
+#include "ntm-cpu-inference.h"
+
+// The decoded texels are stored in the tiles of NTM_TILE_CACHE_TILE_SIZE x NTM_TILE_CACHE_TILE_SIZE texels, which is the same as the virtual texture.
+static constexpr uint32_t const NTM_TILE_CACHE_TILE_SIZE = 64;
+
+static constexpr uint32_t const NTM_TILE_CACHE_MAX_MIPS = 16;
+
+// The texel of the tile is R8G8B8A8_UNORM (A is always 255), and the tiles at the edges of the mip are padded to the full size.
+typedef uint8_t ntm_tile_texel[4];
+
+// The page table is keyed by (texture, mip, tile), where the "texture" is returned by the "ntm_tile_cache_register_texture".
+struct ntm_tile_key
+{
+    uint32_t texture;
+    uint32_t mip;
+    uint32_t tile_x;
+    uint32_t tile_y;
+};
+
+struct ntm_tile_cache_statistics
+{
+    // the tiles found in the cache
+    uint64_t hits;
+    // the tiles decoded on demand (by the calling thread)
+    uint64_t misses;
+    // the tiles decoded by the "ntm_tile_cache_prefetch"
+    uint64_t prefetches;
+    // the least recently used tiles replaced by the other tiles
+    uint64_t evictions;
+};
+
+struct ntm_tile_cache;
+
+// The pool of "max_tiles" tiles is allocated up front, and there is no allocation after creation.
+// 0 == num_threads: one worker for each hardware thread (merely used by the "ntm_tile_cache_prefetch")
+extern ntm_tile_cache *ntm_tile_cache_create(uint32_t max_tiles, uint32_t max_textures, uint32_t num_threads);
+
+extern void ntm_tile_cache_destroy(ntm_tile_cache *cache);
+
+// The mip i is max(1, width >> i) x max(1, height >> i), and the texel (x, y) of the mip is the prediction of the UV of the texel center.
+// NOTE: the "engine" must remain valid as long as the "ntm_tile_cache" is still in use.
+// Returns ~0U if the "max_textures" is exceeded.
+extern uint32_t ntm_tile_cache_register_texture(ntm_tile_cache *cache, ntm_cpu_engine const *engine, uint32_t width, uint32_t height);
+
+// The "ntm_tile_cache" is NOT thread safe (the page table and the LRU list are NOT locked).
+// The returned tile ([NTM_TILE_CACHE_TILE_SIZE][NTM_TILE_CACHE_TILE_SIZE]) is decoded on demand if it is NOT in the cache, and merely remains valid until the next call which may evict it.
+// Returns NULL if the key is out of range.
+extern ntm_tile_texel const *ntm_tile_cache_acquire(ntm_tile_cache *cache, ntm_tile_key const *key);
+
+// All the tiles which are NOT in the cache are decoded in parallel (e.g. ahead of time for the next frame).
+// At most "max_tiles" tiles are decoded, and the invalid keys are ignored.
+// The tiles of the keys (the first "max_tiles" distinct valid keys) are NOT evicted by each other, and thus are all in the cache after this call.
+extern void ntm_tile_cache_prefetch(ntm_tile_cache *cache, uint32_t count, ntm_tile_key const *keys);
+
+// The point sampling (the nearest texel) of the mip through the cache, which can be used instead of the "ntm_cpu_engine_sample".
+extern void ntm_tile_cache_sample(ntm_tile_cache *cache, uint32_t texture, uint32_t mip, ntm_sampler const *sampler, uint32_t count, float const (*in_UVs)[2], float (*out_RGBs)[3]);
+
+extern void ntm_tile_cache_get_statistics(ntm_tile_cache const *cache, ntm_tile_cache_statistics *out_statistics);
+
+#endif
@@ -0,0 +1,131 @@
+import os
+import sys
+import struct
+
+# The layout is the same as the "ntm_pack_header" and "ntm_pack_entry" in "ntm-pack.h"
+NTM_PACK_VERSION = 2
+NTM_PACK_ALIGNMENT = 64
+NTM_MAX_LAYERS = 16
+NTM_PACK_HEADER_SIZE = 24
+NTM_PACK_ENTRY_SIZE = 224
+
+# The same as the "ntm_coefficient_type" in "ntm-model.h"
+NTM_COEFFICIENT_TYPE_FP32 = 0
+NTM_COEFFICIENT_TYPE_FP16 = 1
+NTM_COEFFICIENT_TYPE_INT8 = 2
+
+# Usage: python pack-main.py <output pack> <NTM asset> [<NTM asset> ...]
+# The name of each texture is the file name of the NTM asset without the extension.
+# Both the NTM asset (convert-main.py) and the quantized NTM asset (quantize-main.py) are accepted.
+if len(sys.argv) < 3:
+    print("Usage: python pack-main.py <output pack> <NTM asset> [<NTM asset> ...]")
+    sys.exit(1)
+
+pack_path = sys.argv[1]
+ntm_paths = sys.argv[2:]
+
+
+def fnv1a_64(data):
+    hash = 14695981039346656037
+    for byte in data:
+        hash ^= byte
+        hash = (hash * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    return hash
+
+
+def align_up(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+
+# The same as the "ntm_layer_coefficients_size" in "ntm-model.cpp"
+def layer_coefficients_size(coefficient_type, input_size, output_size):
+    if coefficient_type == NTM_COEFFICIENT_TYPE_FP16:
+        return 4 * output_size + align_up(2 * input_size * output_size, 4)
+    elif coefficient_type == NTM_COEFFICIENT_TYPE_INT8:
+        return 4 * 2 * output_size + 4 * ((input_size + 3) // 4) * output_size
+    else:
+        assert coefficient_type == NTM_COEFFICIENT_TYPE_FP32
+        return 4 * (input_size + 1) * output_size
+
+
+# Data
+textures = []
+for ntm_path in ntm_paths:
+    file_ntm_binary = open(ntm_path, 'rb')
+    ntm_data = file_ntm_binary.read()
+    file_ntm_binary.close()
+
+    fourcc, num_frequencies, num_layers = struct.unpack_from('<4sII', ntm_data, 0)
+    assert fourcc == b'NTM ' or fourcc == b'NTMQ'
+    assert num_layers <= NTM_MAX_LAYERS
+
+    offset = 12
+    input_size = 4 * num_frequencies
+    layer_coefficient_types = 0
+    layer_output_sizes = []
+    layer_coefficients = []
+    for i in range(num_layers):
+        coefficient_type = NTM_COEFFICIENT_TYPE_FP32
+        if fourcc == b'NTMQ':
+            coefficient_type, = struct.unpack_from('<I', ntm_data, offset)
+            offset += 4
+            assert coefficient_type in (NTM_COEFFICIENT_TYPE_FP32, NTM_COEFFICIENT_TYPE_FP16, NTM_COEFFICIENT_TYPE_INT8)
+            assert i > 0 or coefficient_type != NTM_COEFFICIENT_TYPE_INT8
+        num_coefficients, = struct.unpack_from('<I', ntm_data, offset)
+        offset += 4
+        assert num_coefficients % (input_size + 1) == 0
+        output_size = num_coefficients // (input_size + 1)
+        coefficients_size = layer_coefficients_size(coefficient_type, input_size, output_size)
+        layer_coefficient_types |= coefficient_type << (2 * i)
+        layer_output_sizes.append(output_size)
+        layer_coefficients.append(ntm_data[offset:offset + coefficients_size])
+        offset += coefficients_size
+        input_size = output_size
+    assert input_size == 3
+
+    name = os.path.splitext(os.path.basename(ntm_path))[0].encode('utf-8')
+    textures.append((fnv1a_64(name), name, num_frequencies, num_layers, layer_coefficient_types, layer_output_sizes, layer_coefficients))
+
+assert len(set(texture[1] for texture in textures)) == len(textures), "the names of the textures must be unique"
+
+textures.sort(key=lambda texture: (texture[0], texture[1]))
+
+# Layout
+# header | entries | names | coefficients (aligned)
+entries_offset = NTM_PACK_HEADER_SIZE
+names_offset = entries_offset + NTM_PACK_ENTRY_SIZE * len(textures)
+
+names_data = b''.join(texture[1] for texture in textures)
+
+coefficients_offset = align_up(names_offset + len(names_data), NTM_PACK_ALIGNMENT)
+
+entries_chunks = []
+coefficients_chunks = []
+coefficients_end = coefficients_offset
+name_offset = names_offset
+for name_hash, name, num_frequencies, num_layers, layer_coefficient_types, layer_output_sizes, layer_coefficients in textures:
+    layer_coefficients_offsets = []
+    for coefficients in layer_coefficients:
+        coefficients_chunks.append(b'\0' * (align_up(coefficients_end, NTM_PACK_ALIGNMENT) - coefficients_end))
+        coefficients_end = align_up(coefficients_end, NTM_PACK_ALIGNMENT)
+        layer_coefficients_offsets.append(coefficients_end)
+        coefficients_chunks.append(coefficients)
+        coefficients_end += len(coefficients)
+
+    entries_chunks.append(struct.pack('<QQIIII', name_hash, name_offset, len(name), num_frequencies, num_layers, layer_coefficient_types))
+    entries_chunks.append(struct.pack('<%dI' % NTM_MAX_LAYERS, *(layer_output_sizes + [0] * (NTM_MAX_LAYERS - num_layers))))
+    entries_chunks.append(struct.pack('<%dQ' % NTM_MAX_LAYERS, *(layer_coefficients_offsets + [0] * (NTM_MAX_LAYERS - num_layers))))
+    name_offset += len(name)
+
+entries_data = b''.join(entries_chunks)
+assert len(entries_data) == NTM_PACK_ENTRY_SIZE * len(textures)
+
+# Serialization
+file_pack_binary = open(pack_path, 'wb')
+file_pack_binary.write(struct.pack('<4sIIIQ', b'NTMP', NTM_PACK_VERSION, len(textures), 0, entries_offset))
+file_pack_binary.write(entries_data)
+file_pack_binary.write(names_data)
+file_pack_binary.write(b'\0' * (coefficients_offset - (names_offset + len(names_data))))
+for coefficients_chunk in coefficients_chunks:
+    file_pack_binary.write(coefficients_chunk)
+file_pack_binary.close()
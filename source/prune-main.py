@@ -0,0 +1,85 @@
+import sys
+import json
+import struct
+
+# Usage: python prune-main.py <input NTM asset> <sparsity report> <output NTM asset>
+# The input is the (FP32) NTM asset output by the convert-main.py, and the sparsity report is written by the "--sparsity" of the same NTM asset.
+# The dead neurons (the ReLU output is zero at all the texel centers of the measured resolution) are removed: the columns (and the biases) of the layer and the rows of the next layer.
+# Thus, the output is the same at these texel centers. The pruned NTM asset can still be quantized by the quantize-main.py.
+if len(sys.argv) != 4:
+    print("Usage: python prune-main.py <input NTM asset> <sparsity report> <output NTM asset>")
+    sys.exit(1)
+
+input_path = sys.argv[1]
+report_path = sys.argv[2]
+output_path = sys.argv[3]
+
+# Data
+file_ntm_binary = open(input_path, 'rb')
+ntm_data = file_ntm_binary.read()
+file_ntm_binary.close()
+
+fourcc, num_frequencies, num_layers = struct.unpack_from('<4sII', ntm_data, 0)
+assert fourcc == b'NTM '
+
+file_report = open(report_path, 'r')
+report = json.load(file_report)
+file_report.close()
+
+# the last layer (R, G, B) is linear and thus is never pruned
+assert len(report['layers']) == num_layers - 1
+
+layers = []
+offset = 12
+input_size = 4 * num_frequencies
+for layer_index in range(num_layers):
+    num_coefficients, = struct.unpack_from('<I', ntm_data, offset)
+    offset += 4
+    assert num_coefficients % (input_size + 1) == 0
+    output_size = num_coefficients // (input_size + 1)
+    coefficients = struct.unpack_from('<%df' % num_coefficients, ntm_data, offset)
+    offset += 4 * num_coefficients
+
+    # weights: [number of inputs][number of outputs]
+    weights = [list(coefficients[input_index * output_size:(input_index + 1) * output_size]) for input_index in range(input_size)]
+    biases = list(coefficients[input_size * output_size:])
+    layers.append((weights, biases))
+
+    input_size = output_size
+assert input_size == 3
+
+# Pruning
+for layer_index in range(num_layers - 1):
+    layer_report = report['layers'][layer_index]
+    weights, biases = layers[layer_index]
+    assert layer_report['layer'] == layer_index and layer_report['neurons'] == len(biases)
+
+    dead = set(layer_report['dead'])
+    # at least one neuron is kept such that the layer is still valid
+    if len(dead) == len(biases):
+        dead.discard(0)
+    alive = [neuron_index for neuron_index in range(len(biases)) if neuron_index not in dead]
+
+    # the outputs of the layer
+    layers[layer_index] = ([[row[neuron_index] for neuron_index in alive] for row in weights], [biases[neuron_index] for neuron_index in alive])
+
+    # the inputs of the next layer
+    next_weights, next_biases = layers[layer_index + 1]
+    layers[layer_index + 1] = ([next_weights[neuron_index] for neuron_index in alive], next_biases)
+
+    print("layer %d: %d -> %d neurons" % (layer_index, len(biases), len(alive)))
+
+# Serialization
+fp32_size = 0
+file_ntm_binary = open(output_path, 'wb')
+file_ntm_binary.write(struct.pack('<4sII', b'NTM ', num_frequencies, num_layers))
+for weights, biases in layers:
+    num_coefficients = len(weights) * len(biases) + len(biases)
+    file_ntm_binary.write(struct.pack('<I', num_coefficients))
+    for row in weights:
+        file_ntm_binary.write(struct.pack('<%df' % len(row), *row))
+    file_ntm_binary.write(struct.pack('<%df' % len(biases), *biases))
+    fp32_size += 4 * num_coefficients
+file_ntm_binary.close()
+
+print("coefficients: %d bytes (FP32, %d bytes before pruning)" % (fp32_size, len(ntm_data) - 12 - 4 * num_layers))
@@ -0,0 +1,110 @@
+import sys
+import struct
+
+# The same as the "ntm_coefficient_type" in "ntm-model.h"
+NTM_COEFFICIENT_TYPE_FP32 = 0
+NTM_COEFFICIENT_TYPE_FP16 = 1
+NTM_COEFFICIENT_TYPE_INT8 = 2
+
+# Usage: python quantize-main.py <input NTM asset> <output quantized NTM asset> fp16|int8
+# The input is the (FP32) NTM asset output by the convert-main.py.
+# fp16: the weights of all layers are FP16.
+# int8: the weights of the 1st layer are FP16 (the inputs of the 1st layer are the signed positional encoding), and the weights of the other layers are INT8 (symmetric per output channel).
+# The biases (and the scales) are always FP32.
+if len(sys.argv) != 4 or sys.argv[3] not in ('fp16', 'int8'):
+    print("Usage: python quantize-main.py <input NTM asset> <output quantized NTM asset> fp16|int8")
+    sys.exit(1)
+
+input_path = sys.argv[1]
+output_path = sys.argv[2]
+mode = sys.argv[3]
+
+
+def align_up(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+
+def quantize_fp16(weights, input_size, output_size, biases):
+    # biases: [number of outputs]
+    # weights: [number of inputs][number of outputs]
+    data = struct.pack('<%df' % output_size, *biases)
+    data += struct.pack('<%de' % (input_size * output_size), *weights)
+    return data + b'\0' * (align_up(len(data), 4) - len(data))
+
+
+def quantize_int8(weights, input_size, output_size, biases):
+    scales = []
+    for output_index in range(output_size):
+        max_weight = max(abs(weights[input_index * output_size + output_index]) for input_index in range(input_size))
+        scales.append(max_weight / 127.0 if max_weight > 0.0 else 1.0)
+
+    # weights: [(number of inputs + 3) / 4][number of outputs][4]
+    num_input_groups = (input_size + 3) // 4
+    quantized_weights = []
+    for input_group_index in range(num_input_groups):
+        for output_index in range(output_size):
+            for input_subindex in range(4):
+                input_index = 4 * input_group_index + input_subindex
+                if input_index < input_size:
+                    quantized_weight = int(round(weights[input_index * output_size + output_index] / scales[output_index]))
+                    quantized_weights.append(max(-127, min(127, quantized_weight)))
+                else:
+                    quantized_weights.append(0)
+
+    # scales: [number of outputs]
+    # biases: [number of outputs]
+    data = struct.pack('<%df' % output_size, *scales)
+    data += struct.pack('<%df' % output_size, *biases)
+    data += struct.pack('<%db' % len(quantized_weights), *quantized_weights)
+    return data
+
+
+# Data
+file_ntm_binary = open(input_path, 'rb')
+ntm_data = file_ntm_binary.read()
+file_ntm_binary.close()
+
+fourcc, num_frequencies, num_layers = struct.unpack_from('<4sII', ntm_data, 0)
+assert fourcc == b'NTM '
+
+# Quantization
+fp32_size = 0
+quantized_size = 0
+
+quantized_layers = []
+offset = 12
+input_size = 4 * num_frequencies
+for layer_index in range(num_layers):
+    num_coefficients, = struct.unpack_from('<I', ntm_data, offset)
+    offset += 4
+    assert num_coefficients % (input_size + 1) == 0
+    output_size = num_coefficients // (input_size + 1)
+    coefficients = struct.unpack_from('<%df' % num_coefficients, ntm_data, offset)
+    offset += 4 * num_coefficients
+
+    weights = coefficients[:input_size * output_size]
+    biases = coefficients[input_size * output_size:]
+
+    if mode == 'int8' and layer_index > 0:
+        coefficient_type = NTM_COEFFICIENT_TYPE_INT8
+        data = quantize_int8(weights, input_size, output_size, biases)
+    else:
+        coefficient_type = NTM_COEFFICIENT_TYPE_FP16
+        data = quantize_fp16(weights, input_size, output_size, biases)
+
+    quantized_layers.append((coefficient_type, num_coefficients, data))
+
+    fp32_size += 4 * num_coefficients
+    quantized_size += len(data)
+    input_size = output_size
+assert input_size == 3
+
+# Serialization
+file_ntm_binary = open(output_path, 'wb')
+file_ntm_binary.write(struct.pack('<4sII', b'NTMQ', num_frequencies, num_layers))
+for coefficient_type, num_coefficients, data in quantized_layers:
+    file_ntm_binary.write(struct.pack('<II', coefficient_type, num_coefficients))
+    file_ntm_binary.write(data)
+file_ntm_binary.close()
+
+print("coefficients: %d bytes (FP32) -> %d bytes (%s)" % (fp32_size, quantized_size, mode))